@@ -0,0 +1,221 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bezier.h"
+#include "jobs.h"
+#include <algorithm>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <xmmintrin.h>
+#define BEZIER_SSE
+#endif
+
+namespace Models {
+
+	BezierSurface::BezierSurface() {
+		patchBuffer = 0;
+	}
+
+	BezierSurface::BezierSurface(const vector<vec3> &patchPoints) {
+		patchBuffer = 0;
+		for (size_t i = 0; i < patchPoints.size(); i++) this->patchPoints.push_back(vec4(patchPoints[i], 1.0f));
+	}
+
+	BezierSurface::~BezierSurface() {
+		clearCache();
+	}
+
+	void BezierSurface::setPatches(const vector<vec3> &controlPoints, const vector<int> &patches) {
+		clearCache();
+		patchPoints.clear();
+		for (size_t i = 0; i < patches.size(); i++) patchPoints.push_back(vec4(controlPoints[patches[i]], 1.0f));
+	}
+
+	void BezierSurface::clearCache() {
+		for (map<int, Mesh*>::iterator it = cache.begin(); it != cache.end(); ++it) delete it->second;
+		cache.clear();
+	}
+
+	Mesh& BezierSurface::tessellate(int divisions) {
+		map<int, Mesh*>::iterator it = cache.find(divisions);
+		if (it != cache.end()) return *it->second;
+
+		vector<vec4> v, n, tc;
+		vector<unsigned int> indices;
+		tessellate(divisions, v, n, tc, indices);
+		Mesh* mesh = new Mesh();
+		mesh->build(v, n, tc, indices);
+		cache[divisions] = mesh;
+		return *mesh;
+	}
+
+
+	//Cubic Bernstein polynomials and their derivatives at t
+	static void bernstein(float t, float *b, float *d) {
+		float s = 1.0f - t;
+		b[0] = s * s * s;
+		b[1] = 3.0f * t * s * s;
+		b[2] = 3.0f * t * t * s;
+		b[3] = t * t * t;
+		d[0] = -3.0f * s * s;
+		d[1] = 3.0f * s * s - 6.0f * t * s;
+		d[2] = 6.0f * t * s - 3.0f * t * t;
+		d[3] = 3.0f * t * t;
+	}
+
+	//Point and both partial derivatives, used where the fast path meets a collapsed patch edge
+	static void evaluatePatch(const vec4 *c, float u, float v, vec3 &p, vec3 &pu, vec3 &pv) {
+		float bu[4], du[4], bv[4], dv[4];
+		bernstein(u, bu, du);
+		bernstein(v, bv, dv);
+		p = pu = pv = vec3(0.0f);
+		for (int j = 0; j < 4; j++) {
+			for (int k = 0; k < 4; k++) {
+				vec3 point = vec3(c[j * 4 + k]);
+				p += bu[j] * bv[k] * point;
+				pu += du[j] * bv[k] * point;
+				pv += bu[j] * dv[k] * point;
+			}
+		}
+	}
+
+	//One patch on the (n+1)x(n+1) grid. basis holds b and d for every grid parameter, 8 floats each.
+	//Curves along u are built once per v column, so the inner loop is three 4-term sums.
+	static void tessellatePatch(const vec4 *c, int n, const float *basis, vec4 *vertices, vec4 *normals, vec4 *texCoords) {
+		for (int k = 0; k <= n; k++) {
+			const float *bv = basis + 8 * k, *dv = bv + 4;
+#ifdef BEZIER_SSE
+			__m128 q[4], qd[4]; //Control points of the curve at v and of its v derivative
+			for (int j = 0; j < 4; j++) {
+				q[j] = _mm_setzero_ps();
+				qd[j] = _mm_setzero_ps();
+				for (int i = 0; i < 4; i++) {
+					__m128 point = _mm_loadu_ps(&c[j * 4 + i].x);
+					q[j] = _mm_add_ps(q[j], _mm_mul_ps(_mm_set1_ps(bv[i]), point));
+					qd[j] = _mm_add_ps(qd[j], _mm_mul_ps(_mm_set1_ps(dv[i]), point));
+				}
+			}
+#else
+			vec4 q[4], qd[4];
+			for (int j = 0; j < 4; j++) {
+				q[j] = bv[0] * c[j * 4] + bv[1] * c[j * 4 + 1] + bv[2] * c[j * 4 + 2] + bv[3] * c[j * 4 + 3];
+				qd[j] = dv[0] * c[j * 4] + dv[1] * c[j * 4 + 1] + dv[2] * c[j * 4 + 2] + dv[3] * c[j * 4 + 3];
+			}
+#endif
+			for (int j = 0; j <= n; j++) {
+				const float *bu = basis + 8 * j, *du = bu + 4;
+				int index = j * (n + 1) + k;
+				vec3 pu, pv;
+#ifdef BEZIER_SSE
+				__m128 p = _mm_setzero_ps(), dpu = _mm_setzero_ps(), dpv = _mm_setzero_ps();
+				for (int i = 0; i < 4; i++) {
+					__m128 b = _mm_set1_ps(bu[i]);
+					p = _mm_add_ps(p, _mm_mul_ps(b, q[i]));
+					dpu = _mm_add_ps(dpu, _mm_mul_ps(_mm_set1_ps(du[i]), q[i]));
+					dpv = _mm_add_ps(dpv, _mm_mul_ps(b, qd[i]));
+				}
+				_mm_storeu_ps(&vertices[index].x, p); //w sums the basis to 1
+				float a[4], b[4];
+				_mm_storeu_ps(a, dpu);
+				_mm_storeu_ps(b, dpv);
+				pu = vec3(a[0], a[1], a[2]);
+				pv = vec3(b[0], b[1], b[2]);
+#else
+				vertices[index] = bu[0] * q[0] + bu[1] * q[1] + bu[2] * q[2] + bu[3] * q[3];
+				pu = vec3(du[0] * q[0] + du[1] * q[1] + du[2] * q[2] + du[3] * q[3]);
+				pv = vec3(bu[0] * qd[0] + bu[1] * qd[1] + bu[2] * qd[2] + bu[3] * qd[3]);
+#endif
+				vec3 normal = cross(pu, pv);
+				if (dot(normal, normal) < 1e-12f) { //Collapsed edge, take the normal from just inside the patch
+					float u = (float)j / n, v = (float)k / n;
+					vec3 p;
+					evaluatePatch(c, u + (u < 0.5f ? 1e-3f : -1e-3f), v + (v < 0.5f ? 1e-3f : -1e-3f), p, pu, pv);
+					normal = cross(pu, pv);
+				}
+				normals[index] = vec4(normalize(normal), 0.0f);
+				texCoords[index] = vec4((float)j / n, (float)k / n, 0.0f, 0.0f);
+			}
+		}
+	}
+
+	void BezierSurface::tessellate(int divisions, vector<vec4> &vertices, vector<vec4> &vertexNormals, vector<vec4> &texCoords, vector<unsigned int> &indices) const {
+		int n = std::max(divisions, 1);
+		int patchVertices = (n + 1) * (n + 1), patchIndices = 6 * n * n;
+		int count = patchCount();
+
+		vector<float> basis(8 * (n + 1));
+		for (int i = 0; i <= n; i++) bernstein((float)i / n, &basis[8 * i], &basis[8 * i + 4]);
+
+		//Every patch owns a fixed range of the outputs, so workers never share a cache line of writes
+		vertices.resize((size_t)count * patchVertices);
+		vertexNormals.resize(vertices.size());
+		texCoords.resize(vertices.size());
+		indices.resize((size_t)count * patchIndices);
+
+		auto tessellateRange = [&](int begin, int end) {
+			for (int p = begin; p < end; p++) {
+				size_t first = (size_t)p * patchVertices;
+				tessellatePatch(&patchPoints[p * 16], n, basis.data(), &vertices[first], &vertexNormals[first], &texCoords[first]);
+
+				unsigned int *index = &indices[(size_t)p * patchIndices];
+				for (int j = 0; j < n; j++) {
+					for (int k = 0; k < n; k++) {
+						unsigned int a = (unsigned int)(first + j * (n + 1) + k); //(u, v)
+						unsigned int b = a + n + 1; //(u + du, v)
+						//Clockwise seen from the u x v side, like the rest of the teapot
+						*index++ = a; *index++ = a + 1; *index++ = b;
+						*index++ = b; *index++ = a + 1; *index++ = b + 1;
+					}
+				}
+			}
+		};
+
+		Jobs::parallelFor(0, count, 1, tessellateRange); //Runs on the calling thread alone after Jobs::setThreadCount(1)
+	}
+
+
+	bool BezierSurface::tessellationSupported() {
+		return GLEW_VERSION_4_0 || GLEW_ARB_tessellation_shader;
+	}
+
+	void BezierSurface::upload() {
+		release();
+		glGenBuffers(1, &patchBuffer);
+		glBindBuffer(GL_ARRAY_BUFFER, patchBuffer);
+		glBufferData(GL_ARRAY_BUFFER, patchPoints.size() * sizeof(vec4), patchPoints.data(), GL_STATIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void BezierSurface::drawTessellated(float level) {
+		if (patchBuffer == 0) upload();
+
+		glEnableVertexAttribArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, patchBuffer);
+		glVertexAttribPointer(0, 4, GL_FLOAT, false, 0, NULL);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glPatchParameteri(GL_PATCH_VERTICES, 16);
+		float levels[4] = { level, level, level, level };
+		glPatchParameterfv(GL_PATCH_DEFAULT_OUTER_LEVEL, levels);
+		glPatchParameterfv(GL_PATCH_DEFAULT_INNER_LEVEL, levels);
+		glDrawArrays(GL_PATCHES, 0, (GLsizei)patchPoints.size());
+
+		glDisableVertexAttribArray(0);
+	}
+
+	void BezierSurface::release() {
+		if (patchBuffer != 0) glDeleteBuffers(1, &patchBuffer);
+		patchBuffer = 0;
+	}
+}
@@ -0,0 +1,63 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BEZIER_H
+#define BEZIER_H
+
+//Model made out of bicubic Bezier patches, tessellated at any resolution.
+//tessellate(n) evaluates every patch on an (n+1)x(n+1) grid: the Bernstein
+//basis is tabulated once per resolution and the sums run on SSE registers,
+//patches are spread over the job system. Results are cached per resolution.
+//drawTessellated() is the GPU variant: the patches go to the tessellation
+//evaluation shader of spBezier (te_bezier.glsl), the level is set with
+//glPatchParameterfv so no control shader is needed.
+
+#include <map>
+#include "mesh.h"
+
+namespace Models {
+
+	using namespace std;
+	using namespace glm;
+
+	class BezierSurface {
+		public:
+			BezierSurface();
+			BezierSurface(const vector<vec3> &patchPoints); //16 consecutive control points per patch
+			~BezierSurface();
+
+			//patches - 16 control point indices per patch, 4 rows along u; faces are on the u x v side
+			void setPatches(const vector<vec3> &controlPoints, const vector<int> &patches);
+			int patchCount() const { return (int)patchPoints.size() / 16; }
+
+			Mesh& tessellate(int divisions); //Cached, divisions segments along each patch edge
+			void tessellate(int divisions, vector<vec4> &vertices, vector<vec4> &vertexNormals, vector<vec4> &texCoords, vector<unsigned int> &indices) const;
+			void clearCache();
+
+			static bool tessellationSupported(); //True if the context can run drawTessellated
+			void upload(); //Control points for the GPU variant, call with a current context
+			void drawTessellated(float level); //spBezier has to be in use, level - segments per patch edge
+			void release();
+
+		private:
+			vector<vec4> patchPoints; //16 per patch, w=1
+			map<int, Mesh*> cache;
+			GLuint patchBuffer;
+	};
+
+	extern BezierSurface teapotSurface; //Newell's 32 patches in the frame of Models::teapot
+}
+
+#endif
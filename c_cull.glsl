@@ -0,0 +1,83 @@
+#version 430
+
+//Frustum and Hi-Z occlusion test of every static object.
+//Survivors are appended to a compacted indirect draw list; visibleIds
+//remembers which object each compacted command belongs to.
+
+layout (local_size_x=64) in;
+
+struct Bounds {
+    vec4 bmin;
+    vec4 bmax;
+};
+
+struct Command {
+    uint count;
+    uint instanceCount;
+    uint first;
+    uint baseInstance;
+};
+
+layout (std430, binding=0) readonly buffer Objects { Bounds bounds[]; };
+layout (std430, binding=1) readonly buffer Commands { Command commands[]; };
+layout (std430, binding=2) writeonly buffer VisibleCommands { Command visibleCommands[]; };
+layout (std430, binding=3) writeonly buffer VisibleIds { uint visibleIds[]; };
+layout (std430, binding=4) buffer Parameters { uint visibleCount; };
+layout (std430, binding=5) writeonly buffer Flags { uint visibleFlags[]; };
+
+uniform mat4 PV;
+uniform int objectCount;
+uniform int useHiZ; //0 until the first Hi-Z pyramid exists
+uniform sampler2D hiz;
+uniform vec2 hizSize;
+uniform int hizLevels;
+
+bool occluded(vec3 ndcMin, vec3 ndcMax) {
+    vec2 uvMin=clamp(ndcMin.xy*0.5+0.5,0.0,1.0);
+    vec2 uvMax=clamp(ndcMax.xy*0.5+0.5,0.0,1.0);
+
+    //Pick the level where the box covers at most 2x2 texels, then 4 taps cover it entirely
+    vec2 extent=(uvMax-uvMin)*hizSize;
+    float lod=clamp(ceil(log2(max(max(extent.x,extent.y),1.0))),0.0,float(hizLevels-1));
+
+    float farthest=max(max(textureLod(hiz,uvMin,lod).r,textureLod(hiz,vec2(uvMax.x,uvMin.y),lod).r),
+                       max(textureLod(hiz,vec2(uvMin.x,uvMax.y),lod).r,textureLod(hiz,uvMax,lod).r));
+
+    float nearest=ndcMin.z*0.5+0.5;
+    return nearest>farthest;
+}
+
+void main(void) {
+    uint i=gl_GlobalInvocationID.x;
+    if (i>=uint(objectCount)) return;
+
+    Bounds b=bounds[i];
+    vec3 ndcMin=vec3(1.0);
+    vec3 ndcMax=vec3(-1.0);
+    bool crossesNear=false;
+
+    for (int c=0;c<8;c++) {
+        vec3 corner=mix(b.bmin.xyz,b.bmax.xyz,vec3(c&1,(c>>1)&1,(c>>2)&1));
+        vec4 clip=PV*vec4(corner,1.0);
+        if (clip.w<=0.0) {
+            crossesNear=true;
+            break;
+        }
+        vec3 ndc=clip.xyz/clip.w;
+        ndcMin=min(ndcMin,ndc);
+        ndcMax=max(ndcMax,ndc);
+    }
+
+    bool visible=true;
+    if (!crossesNear) { //Boxes around the camera are always drawn
+        if (ndcMin.x>1.0 || ndcMin.y>1.0 || ndcMax.x<-1.0 || ndcMax.y<-1.0 || ndcMin.z>1.0) visible=false;
+        else if (useHiZ!=0 && occluded(ndcMin,ndcMax)) visible=false;
+    }
+
+    visibleFlags[i]=visible ? 1u : 0u;
+    if (visible) {
+        uint slot=atomicAdd(visibleCount,1u);
+        visibleCommands[slot]=commands[i];
+        visibleIds[slot]=i;
+    }
+}
@@ -0,0 +1,42 @@
+#version 430
+
+//Builds one level of the hierarchical depth buffer.
+//Level 0 is copied from the depth texture, every other level keeps
+//the farthest depth of the 2x2 (3x3 at odd edges) texels below it.
+
+layout (local_size_x=8, local_size_y=8) in;
+
+uniform int level;
+uniform sampler2D depth;
+
+layout (r32f, binding=0) uniform readonly image2D src;
+layout (r32f, binding=1) uniform writeonly image2D dst;
+
+float load(ivec2 p, ivec2 size) {
+    return imageLoad(src,min(p,size-1)).r;
+}
+
+void main(void) {
+    ivec2 p=ivec2(gl_GlobalInvocationID.xy);
+    ivec2 size=imageSize(dst);
+    if (p.x>=size.x || p.y>=size.y) return;
+
+    float d;
+    if (level==0) {
+        d=texelFetch(depth,p,0).r;
+    } else {
+        ivec2 srcSize=imageSize(src);
+        ivec2 s=p*2;
+        d=max(max(load(s,srcSize),load(s+ivec2(1,0),srcSize)),
+              max(load(s+ivec2(0,1),srcSize),load(s+ivec2(1,1),srcSize)));
+
+        //Odd source sizes leave an extra row/column for the last texel
+        bool extraX=(srcSize.x&1)!=0 && p.x==size.x-1;
+        bool extraY=(srcSize.y&1)!=0 && p.y==size.y-1;
+        if (extraX) d=max(d,max(load(s+ivec2(2,0),srcSize),load(s+ivec2(2,1),srcSize)));
+        if (extraY) d=max(d,max(load(s+ivec2(0,2),srcSize),load(s+ivec2(1,2),srcSize)));
+        if (extraX && extraY) d=max(d,load(s+ivec2(2,2),srcSize));
+    }
+
+    imageStore(dst,p,vec4(d));
+}
@@ -0,0 +1,282 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "capture.h"
+#include <GLFW/glfw3.h>
+#include <string>
+#include <algorithm>
+#include "lodepng.h"
+
+FrameCapture::FrameCapture() {
+	for (Slot& slot : slots) {
+		slot.buffer = 0;
+		slot.capacity = 0;
+		slot.fence = 0;
+		slot.pixels = NULL;
+		slot.state = slotFree;
+	}
+	recordingCount = 0;
+	wasRecording = false;
+	stopping = false;
+	video = NULL;
+	videoRecording = 0;
+	videoWidth = 0;
+	videoHeight = 0;
+	screenshots = 0;
+	frames = 0;
+	dropped = 0;
+	renderMs = 0;
+}
+
+//First name of the form prefix###.extension that is not taken
+static std::string freeName(const char* prefix, const char* extension) {
+	for (int i = 0;; i++) {
+		char name[64];
+		snprintf(name, sizeof(name), "%s%03d.%s", prefix, i, extension);
+		FILE* f = fopen(name, "rb");
+		if (f == NULL) return name;
+		fclose(f);
+	}
+}
+
+//Unmaps buffers the encoder is done with
+void FrameCapture::recycle() {
+	for (Slot& slot : slots) {
+		if (slot.state.load() != slotEncoded) continue;
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		slot.pixels = NULL;
+		slot.state = slotFree;
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+//Maps finished readbacks and queues them for the encoder, in capture order
+void FrameCapture::retire(bool block) {
+	while (!inFlight.empty()) {
+		Slot& slot = slots[inFlight.front()];
+		GLenum result = glClientWaitSync(slot.fence, block ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, block ? 1000000000ull : 0);
+		if (result == GL_TIMEOUT_EXPIRED) return;
+		glDeleteSync(slot.fence);
+		slot.fence = 0;
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		slot.pixels = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (size_t)slot.width * slot.height * 4, GL_MAP_READ_BIT);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		if (slot.pixels == NULL) {
+			dropped++;
+			slot.state = slotFree;
+		}
+		else {
+			slot.state = slotEncoding;
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push_back(inFlight.front());
+			wake.notify_one();
+		}
+		inFlight.pop_front();
+	}
+}
+
+void FrameCapture::capture(int width, int height, bool screenshot, bool recording) {
+	if (!screenshot && !recording && !wasRecording && inFlight.empty()) {
+		recycle();
+		return;
+	}
+	double start = glfwGetTime();
+	recycle();
+	retire(false);
+	if (recording != wasRecording) {
+		if (recording) {
+			recordingCount++;
+			printf("Recording started\n");
+		}
+		else {
+			//Every frame of the recording goes to the encoder before it closes the file
+			while (!inFlight.empty()) retire(true);
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push_back(closeVideo);
+			wake.notify_one();
+		}
+		wasRecording = recording;
+	}
+
+	if ((screenshot || recording) && width > 0 && height > 0) {
+		Slot* slot = NULL;
+		for (int i = 0; i < slotCount && slot == NULL; i++)
+			if (slots[i].state.load() == slotFree) {
+				slot = &slots[i];
+				inFlight.push_back(i);
+			}
+		if (slot == NULL) dropped++;
+		else {
+			if (!encoder.joinable()) {
+				stopping = false;
+				encoder = std::thread(&FrameCapture::encodeLoop, this);
+			}
+			size_t bytes = (size_t)width * height * 4;
+			if (slot->buffer == 0) glGenBuffers(1, &slot->buffer);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer);
+			if (slot->capacity < bytes) {
+				glBufferData(GL_PIXEL_PACK_BUFFER, bytes, NULL, GL_STREAM_READ);
+				slot->capacity = bytes;
+			}
+			//Into the buffer: returns at once, the copy happens when the GPU gets there
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+			glReadBuffer(GL_BACK);
+			glPixelStorei(GL_PACK_ALIGNMENT, 4);
+			glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			slot->width = width;
+			slot->height = height;
+			slot->screenshot = screenshot;
+			slot->video = recording;
+			slot->recording = recordingCount;
+			slot->state = slotReading;
+			if (screenshot) screenshots++;
+			if (recording) frames++;
+		}
+	}
+	renderMs += (glfwGetTime() - start) * 1000.0;
+}
+
+void FrameCapture::release() {
+	while (!inFlight.empty()) retire(true);
+	if (wasRecording) {
+		std::lock_guard<std::mutex> lock(mutex);
+		queue.push_back(closeVideo);
+		wasRecording = false;
+	}
+	if (encoder.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wake.notify_one();
+		encoder.join();
+	}
+	recycle();
+	for (Slot& slot : slots) {
+		if (slot.buffer) glDeleteBuffers(1, &slot.buffer);
+		slot.buffer = 0;
+		slot.capacity = 0;
+	}
+}
+
+void FrameCapture::encodeLoop() {
+	for (;;) {
+		int s;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wake.wait(lock, [this] { return stopping || !queue.empty(); });
+			if (queue.empty()) break; //Stopping and nothing left
+			s = queue.front();
+			queue.pop_front();
+		}
+		if (s == closeVideo) {
+			if (video) {
+				fclose(video);
+				video = NULL;
+				printf("Recording saved\n");
+			}
+			continue;
+		}
+		Slot& slot = slots[s];
+		if (slot.screenshot) writeScreenshot(slot);
+		if (slot.video) writeVideoFrame(slot);
+		slot.state = slotEncoded;
+	}
+	if (video) fclose(video);
+	video = NULL;
+}
+
+//Bottom-up RGBA from glReadPixels to a top-down RGB PNG
+void FrameCapture::writeScreenshot(const Slot& slot) {
+	const int w = slot.width, h = slot.height;
+	std::vector<unsigned char> rgb((size_t)w * h * 3);
+	for (int y = 0; y < h; y++) {
+		const unsigned char* src = slot.pixels + (size_t)(h - 1 - y) * w * 4;
+		unsigned char* dst = rgb.data() + (size_t)y * w * 3;
+		for (int x = 0; x < w; x++, src += 4, dst += 3) {
+			dst[0] = src[0];
+			dst[1] = src[1];
+			dst[2] = src[2];
+		}
+	}
+	std::string name = freeName("screenshot", "png");
+	lodepng::State state;
+	state.info_raw.colortype = LCT_RGB;
+	state.encoder.zlibsettings.restart_interval = screenshotRestartInterval; //Decodes on all cores when loaded back as a texture
+	std::vector<unsigned char> png;
+	unsigned error = lodepng::encode(png, rgb, w, h, state);
+	if (!error) error = lodepng::save_file(png, name);
+	if (error) fprintf(stderr, "Can't write %s: %s\n", name.c_str(), lodepng_error_text(error));
+	else printf("Saved %s\n", name.c_str());
+}
+
+//BT.601 studio range, chroma of every 2x2 block averaged (4:2:0, odd edges repeat)
+void FrameCapture::writeVideoFrame(const Slot& slot) {
+	const int w = slot.width, h = slot.height;
+	if (video && videoRecording != slot.recording) {
+		fclose(video);
+		video = NULL;
+	}
+	if (video == NULL) {
+		std::string name = freeName("recording", "y4m");
+		video = fopen(name.c_str(), "wb");
+		if (video == NULL) {
+			fprintf(stderr, "%s: cannot create\n", name.c_str());
+			return;
+		}
+		videoRecording = slot.recording;
+		videoWidth = w;
+		videoHeight = h;
+		planes.resize((size_t)w * h + 2 * (size_t)((w + 1) / 2) * ((h + 1) / 2));
+		fprintf(video, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", w, h, videoFrameRate);
+		printf("Recording to %s\n", name.c_str());
+	}
+	if (w != videoWidth || h != videoHeight) return; //The header fixes the size: frames after a window resize are left out
+
+	const int cw = (w + 1) / 2, ch = (h + 1) / 2;
+	unsigned char* yPlane = planes.data();
+	unsigned char* uPlane = yPlane + (size_t)w * h;
+	unsigned char* vPlane = uPlane + (size_t)cw * ch;
+	for (int y = 0; y < h; y++) {
+		const unsigned char* src = slot.pixels + (size_t)(h - 1 - y) * w * 4;
+		unsigned char* dst = yPlane + (size_t)y * w;
+		for (int x = 0; x < w; x++, src += 4)
+			dst[x] = (unsigned char)(((66 * src[0] + 129 * src[1] + 25 * src[2] + 128) >> 8) + 16);
+	}
+	for (int y = 0; y < ch; y++) {
+		const unsigned char* row0 = slot.pixels + (size_t)(h - 1 - 2 * y) * w * 4;
+		const unsigned char* row1 = slot.pixels + (size_t)(h - 1 - std::min(2 * y + 1, h - 1)) * w * 4;
+		for (int x = 0; x < cw; x++) {
+			int x0 = 2 * x * 4, x1 = std::min(2 * x + 1, w - 1) * 4;
+			int r = row0[x0] + row0[x1] + row1[x0] + row1[x1];
+			int g = row0[x0 + 1] + row0[x1 + 1] + row1[x0 + 1] + row1[x1 + 1];
+			int b = row0[x0 + 2] + row0[x1 + 2] + row1[x0 + 2] + row1[x1 + 2];
+			uPlane[(size_t)y * cw + x] = (unsigned char)(((-38 * r - 74 * g + 112 * b + 512) >> 10) + 128);
+			vPlane[(size_t)y * cw + x] = (unsigned char)(((112 * r - 94 * g - 18 * b + 512) >> 10) + 128);
+		}
+	}
+	fputs("FRAME\n", video);
+	fwrite(planes.data(), 1, planes.size(), video);
+}
+
+void FrameCapture::printStats() {
+	if (screenshots == 0 && frames == 0) return;
+	printf("Capture: %d screenshots, %d video frames, %d dropped, %.3f ms per captured frame on the render thread\n",
+		screenshots, frames, dropped, renderMs / (screenshots + frames));
+}
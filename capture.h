@@ -0,0 +1,91 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+//Screenshots and video capture without stalling the render thread.
+//capture() starts an asynchronous glReadPixels of the back buffer into one of
+//slotCount pixel pack buffers and fences it. Later frames map the buffers whose
+//fences are signalled and queue them for the encoder thread, which writes
+//screenshots as PNG (lodepng) and recordings as raw Y4M video (4:2:0, BT.601),
+//then hands the buffer back to be unmapped. If every buffer is busy the frame
+//is dropped and counted rather than waited for.
+
+#include <GL/glew.h>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+class FrameCapture {
+public:
+	FrameCapture();
+
+	//Render thread, after drawing and before the swap
+	void capture(int width, int height, bool screenshot, bool recording);
+	void release(); //Render thread: finishes the readbacks in flight, encodes them and stops the encoder
+	void printStats();
+
+	static const int slotCount = 4; //Readbacks in flight
+	static const int videoFrameRate = 60; //Written to the Y4M header, frames are stored as captured
+	static const unsigned screenshotRestartInterval = 1 << 20; //Bytes of scanlines between deflate restart points
+
+private:
+	enum SlotState { slotFree, slotReading, slotEncoding, slotEncoded };
+	struct Slot {
+		GLuint buffer;
+		size_t capacity;
+		GLsync fence;
+		int width, height;
+		bool screenshot, video;
+		int recording; //Which recording the frame belongs to
+		const unsigned char* pixels; //Mapped while encoding
+		std::atomic<int> state;
+	};
+
+	Slot slots[slotCount];
+	std::deque<int> inFlight; //Slots being read back, oldest first
+	int recordingCount; //Recordings started so far, the current one if recording
+	bool wasRecording;
+
+	std::thread encoder;
+	std::mutex mutex; //Guards queue and stopping
+	std::condition_variable wake;
+	std::deque<int> queue; //Mapped slots in capture order, closeVideo ends the recording
+	enum { closeVideo = -1 };
+	bool stopping;
+
+	//Encoder thread only
+	FILE* video;
+	int videoRecording;
+	int videoWidth, videoHeight;
+	std::vector<unsigned char> planes;
+
+	int screenshots, frames, dropped;
+	double renderMs;
+
+	void retire(bool block);
+	void recycle();
+	void encodeLoop();
+	void writeScreenshot(const Slot& slot);
+	void writeVideoFrame(const Slot& slot);
+};
+
+#endif
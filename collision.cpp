@@ -0,0 +1,177 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "collision.h"
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+
+static const float skin = 1e-4f; //Distance kept from a surface after a hit
+static const int maxSlides = 4;
+
+CollisionWorld::CollisionWorld() {
+	origin = glm::vec2(0.0f);
+	cellSize = 1.0f;
+	width = depth = 0;
+}
+
+void CollisionWorld::clear() {
+	boxes.clear();
+	cellStart.clear();
+	cellBoxes.clear();
+	width = depth = 0;
+}
+
+void CollisionWorld::addBox(const glm::vec3& bmin, const glm::vec3& bmax) {
+	boxes.push_back({ glm::min(bmin, bmax), glm::max(bmin, bmax) });
+}
+
+bool CollisionWorld::cellRange(const glm::vec3& bmin, const glm::vec3& bmax, int& x0, int& z0, int& x1, int& z1) const {
+	x0 = std::max(0, (int)floorf((bmin.x - origin.x) / cellSize));
+	z0 = std::max(0, (int)floorf((bmin.z - origin.y) / cellSize));
+	x1 = std::min(width - 1, (int)floorf((bmax.x - origin.x) / cellSize));
+	z1 = std::min(depth - 1, (int)floorf((bmax.z - origin.y) / cellSize));
+	return x0 <= x1 && z0 <= z1;
+}
+
+//Counting sort of the boxes into every cell they overlap
+void CollisionWorld::build(float cellSize) {
+	this->cellSize = cellSize;
+	width = depth = 0;
+	cellStart.assign(1, 0);
+	cellBoxes.clear();
+	if (boxes.empty()) return;
+
+	glm::vec3 bmin = boxes[0].bmin, bmax = boxes[0].bmax;
+	for (const Box& b : boxes) {
+		bmin = glm::min(bmin, b.bmin);
+		bmax = glm::max(bmax, b.bmax);
+	}
+	origin = glm::vec2(bmin.x, bmin.z);
+	width = (int)floorf((bmax.x - bmin.x) / cellSize) + 1;
+	depth = (int)floorf((bmax.z - bmin.z) / cellSize) + 1;
+
+	cellStart.assign((size_t)width * depth + 1, 0);
+	int x0, z0, x1, z1;
+	for (const Box& b : boxes) {
+		if (!cellRange(b.bmin, b.bmax, x0, z0, x1, z1)) continue;
+		for (int z = z0; z <= z1; z++)
+			for (int x = x0; x <= x1; x++) cellStart[(size_t)z * width + x + 1]++;
+	}
+	for (size_t c = 1; c < cellStart.size(); c++) cellStart[c] += cellStart[c - 1];
+	cellBoxes.resize(cellStart.back());
+	std::vector<int> next(cellStart.begin(), cellStart.end() - 1);
+	for (int i = 0; i < (int)boxes.size(); i++) {
+		if (!cellRange(boxes[i].bmin, boxes[i].bmax, x0, z0, x1, z1)) continue;
+		for (int z = z0; z <= z1; z++)
+			for (int x = x0; x <= x1; x++) cellBoxes[next[(size_t)z * width + x]++] = i;
+	}
+	printf("Collision grid: %dx%d cells of %.2f, %d boxes, %.1f per cell\n", width, depth, cellSize, (int)boxes.size(), (float)cellBoxes.size() / (width * depth));
+}
+
+//Moves the centre out of every box grown by radius, along the shallowest axis.
+//Boxes spanning several cells may be visited more than once, which does no harm.
+glm::vec3 CollisionWorld::pushOut(glm::vec3 center, float radius) const {
+	int x0, z0, x1, z1;
+	if (!cellRange(center - radius, center + radius, x0, z0, x1, z1)) return center;
+	for (int z = z0; z <= z1; z++)
+		for (int x = x0; x <= x1; x++) {
+			size_t c = (size_t)z * width + x;
+			for (int k = cellStart[c]; k < cellStart[c + 1]; k++) {
+				const Box& b = boxes[cellBoxes[k]];
+				glm::vec3 low = center - (b.bmin - radius), high = (b.bmax + radius) - center;
+				if (low.x <= 0 || low.y <= 0 || low.z <= 0 || high.x <= 0 || high.y <= 0 || high.z <= 0) continue;
+				int axis = 0;
+				float depth = std::min(low.x, high.x);
+				for (int a = 1; a < 3; a++) if (std::min(low[a], high[a]) < depth) depth = std::min(low[a], high[a]), axis = a;
+				center[axis] = low[axis] < high[axis] ? b.bmin[axis] - radius - skin : b.bmax[axis] + radius + skin;
+			}
+		}
+	return center;
+}
+
+//Earliest hit of the sphere moving by delta, as a ray against the boxes grown by radius (slab test).
+//Growing the box instead of rounding its edges treats the sphere as its bounding cube:
+//cheap, and only errs on the safe side.
+bool CollisionWorld::sweep(const glm::vec3& position, const glm::vec3& delta, float radius, float& t, glm::vec3& normal) const {
+	int x0, z0, x1, z1;
+	glm::vec3 end = position + delta;
+	if (!cellRange(glm::min(position, end) - radius, glm::max(position, end) + radius, x0, z0, x1, z1)) return false;
+	bool hit = false;
+	t = 1.0f;
+	for (int z = z0; z <= z1; z++)
+		for (int x = x0; x <= x1; x++) {
+			size_t c = (size_t)z * width + x;
+			for (int k = cellStart[c]; k < cellStart[c + 1]; k++) {
+				const Box& b = boxes[cellBoxes[k]];
+				float enter = -1.0f, exit = 2.0f;
+				int enterAxis = -1;
+				bool miss = false;
+				for (int a = 0; a < 3 && !miss; a++) {
+					float lo = b.bmin[a] - radius, hi = b.bmax[a] + radius;
+					if (fabsf(delta[a]) < 1e-12f) {
+						miss = position[a] <= lo || position[a] >= hi;
+						continue;
+					}
+					float inv = 1.0f / delta[a];
+					float t0 = (lo - position[a]) * inv, t1 = (hi - position[a]) * inv;
+					if (t0 > t1) std::swap(t0, t1);
+					if (t0 > enter) enter = t0, enterAxis = a;
+					exit = std::min(exit, t1);
+					miss = enter >= exit;
+				}
+				//Starting inside (enter < 0) was resolved by pushOut, moving out of the box is fine
+				if (miss || enterAxis < 0 || enter < 0.0f || enter >= t) continue;
+				t = enter;
+				normal = glm::vec3(0.0f);
+				normal[enterAxis] = delta[enterAxis] > 0.0f ? -1.0f : 1.0f;
+				hit = true;
+			}
+		}
+	return hit;
+}
+
+glm::vec3 CollisionWorld::move(const glm::vec3& position, const glm::vec3& delta, float radius) const {
+	glm::vec3 p = pushOut(position, radius);
+	glm::vec3 d = delta;
+	for (int i = 0; i < maxSlides && glm::dot(d, d) > 1e-14f; i++) {
+		float t;
+		glm::vec3 n;
+		if (!sweep(p, d, radius, t, n)) {
+			p += d;
+			break;
+		}
+		//Stop at the wall and keep the part of the motion along it
+		p += d * t + n * skin;
+		d *= 1.0f - t;
+		d -= n * glm::dot(d, n);
+	}
+	return p;
+}
+
+bool CollisionWorld::overlaps(const glm::vec3& center, float radius) const {
+	int x0, z0, x1, z1;
+	if (!cellRange(center - radius, center + radius, x0, z0, x1, z1)) return false;
+	for (int z = z0; z <= z1; z++)
+		for (int x = x0; x <= x1; x++) {
+			size_t c = (size_t)z * width + x;
+			for (int k = cellStart[c]; k < cellStart[c + 1]; k++) {
+				const Box& b = boxes[cellBoxes[k]];
+				if (glm::all(glm::greaterThan(center + radius, b.bmin)) && glm::all(glm::lessThan(center - radius, b.bmax))) return true;
+			}
+		}
+	return false;
+}
@@ -0,0 +1,59 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef COLLISION_H
+#define COLLISION_H
+
+//Static axis aligned boxes (walls, floors, paintings) bucketed into a uniform
+//grid on the xz plane, built once after the gallery is recorded.
+//move() sweeps a sphere through the boxes and slides it along whatever it hits,
+//so the camera and the visitors cannot pass through walls.
+
+#include <vector>
+#include <glm/glm.hpp>
+
+class CollisionWorld {
+public:
+	CollisionWorld();
+
+	void clear();
+	void addBox(const glm::vec3& bmin, const glm::vec3& bmax);
+	void build(float cellSize); //Call after all boxes were added
+
+	glm::vec3 move(const glm::vec3& position, const glm::vec3& delta, float radius) const; //Where a sphere moved by delta ends up
+	bool overlaps(const glm::vec3& center, float radius) const; //Like move(), treats the sphere as its bounding cube
+
+	int boxCount() const { return (int)boxes.size(); }
+
+private:
+	struct Box {
+		glm::vec3 bmin;
+		glm::vec3 bmax;
+	};
+
+	std::vector<Box> boxes;
+	std::vector<int> cellStart; //Boxes of cell c: cellBoxes[cellStart[c]..cellStart[c + 1])
+	std::vector<int> cellBoxes;
+	glm::vec2 origin; //xz of the corner of cell 0
+	float cellSize;
+	int width, depth;
+
+	bool cellRange(const glm::vec3& bmin, const glm::vec3& bmax, int& x0, int& z0, int& x1, int& z1) const;
+	glm::vec3 pushOut(glm::vec3 center, float radius) const;
+	bool sweep(const glm::vec3& position, const glm::vec3& delta, float radius, float& t, glm::vec3& normal) const;
+};
+
+#endif
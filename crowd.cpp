@@ -0,0 +1,491 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "crowd.h"
+#include "shaderprogram.h"
+#include "allmodels.h"
+#include "lod.h"
+#include "navgrid.h"
+#include "collision.h"
+#include "jobs.h"
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CROWD_SSE
+#endif
+
+static const float spinSpeed = 0.05f; //Radians of yaw per unit of mov
+static const float driftSpeed = 0.007f; //Distance from the standing point per unit of mov
+static const float hipHeight = -0.68f;
+static const float headScale = 0.05f;
+static const float bodyCenter = -0.55f; //Where the collision sphere sits, relative to y
+static const float arriveDistance = 0.3f; //Close enough to look at the painting
+static const float acceleration = 4.0f; //Fraction of the velocity error removed per second
+static const float turnSpeed = 4.0f; //Radians per second
+
+Crowd::Crowd() {
+	count = 0;
+	instanceBuffer = 0;
+	colorsChanged = false;
+	walking = false;
+	walkSpeed = 0.35f;
+	personalSpace = 0.2f;
+	radius = 0.08f;
+	planBudgetMs = 2.0f;
+	frame = 0;
+	random = 12345;
+	steeringMs = 0;
+	steeredFrames = 0;
+}
+
+Crowd::~Crowd() {
+}
+
+int Crowd::add(const glm::vec3& position, float heading, const glm::vec3& color, float phase) {
+	x.push_back(position.x);
+	y.push_back(position.y);
+	z.push_back(position.z);
+	this->heading.push_back(heading);
+	this->phase.push_back(phase);
+	red.push_back(color.r);
+	green.push_back(color.g);
+	blue.push_back(color.b);
+	headLevel.push_back(-1);
+	vx.push_back(0.0f);
+	vz.push_back(0.0f);
+	goal.push_back(-1);
+	wait.push_back(0.0f);
+	lastX.push_back(position.x);
+	lastZ.push_back(position.z);
+	lastHeading.push_back(heading);
+	colorsChanged = true;
+	return count++;
+}
+
+int Crowd::add(const glm::mat4& M, const glm::vec3& color, float phase) {
+	//Rotation around y maps the x axis to (cos, 0, -sin)
+	return add(glm::vec3(M[3]), atan2f(-M[0].z, M[0].x), color, phase);
+}
+
+void Crowd::clear() {
+	x.clear(); y.clear(); z.clear();
+	heading.clear();
+	phase.clear();
+	red.clear(); green.clear(); blue.clear();
+	headLevel.clear();
+	vx.clear(); vz.clear();
+	goal.clear();
+	wait.clear();
+	lastX.clear(); lastZ.clear(); lastHeading.clear();
+	count = 0;
+	colorsChanged = true;
+}
+
+//Small integer hash, also a source of per-visitor random numbers inside the parallel loop
+static unsigned int mix(unsigned int h) {
+	h ^= h >> 16;
+	h *= 0x7feb352du;
+	h ^= h >> 15;
+	h *= 0x846ca68bu;
+	h ^= h >> 16;
+	return h;
+}
+
+int Crowd::bucketOf(int cx, int cz) const {
+	return (int)(mix((unsigned int)cx * 73856093u ^ (unsigned int)cz * 19349663u) & (unsigned int)(hashStart.size() - 2));
+}
+
+//Counting sort of the visitors into buckets of personalSpace sized cells
+void Crowd::buildHash() {
+	size_t buckets = 64;
+	while (buckets < 2 * (size_t)count) buckets *= 2;
+	hashStart.assign(buckets + 1, 0);
+	hashAgents.resize(count);
+	agentBucket.resize(count);
+	for (int i = 0; i < count; i++) {
+		int b = bucketOf((int)floorf(x[i] / personalSpace), (int)floorf(z[i] / personalSpace));
+		agentBucket[i] = b;
+		hashStart[b + 1]++;
+	}
+	for (size_t b = 1; b <= buckets; b++) hashStart[b] += hashStart[b - 1];
+	std::vector<int> next(hashStart.begin(), hashStart.end() - 1);
+	for (int i = 0; i < count; i++) hashAgents[next[agentBucket[i]]++] = i;
+}
+
+static float wrapAngle(float a) {
+	while (a > PI) a -= 2 * PI;
+	while (a < -PI) a += 2 * PI;
+	return a;
+}
+
+void Crowd::steerRange(const NavGrid& nav, const CollisionWorld* walls, const std::vector<const unsigned char*>& goalFields, float dt, int begin, int end) {
+	float space2 = personalSpace * personalSpace;
+	for (int i = begin; i < end; i++) {
+		glm::vec2 p(x[i], z[i]), v(vx[i], vz[i]);
+		glm::vec2 desired(0.0f);
+		float yaw = heading[i];
+		const NavGrid::Goal& g = nav.goal(goal[i]);
+		float goalDistance = glm::length(g.position - p);
+		bool arrived = goalDistance < arriveDistance || (goalDistance < 3.0f * arriveDistance && glm::length(v) < 0.2f * walkSpeed); //Or held back by the visitors already there
+
+		if (wait[i] > 0.0f) {
+			//Looking at the painting
+			wait[i] -= dt;
+			if (wait[i] <= 0.0f) goal[i] = -1;
+			glm::vec2 look = g.lookAt - p;
+			if (glm::length(look) > 1e-4f) yaw = atan2f(-look.y, look.x);
+		}
+		else if (arrived) {
+			wait[i] = 3.0f + (mix(i * 7919u + frame) % 1000) * 0.005f;
+		}
+		else if (goalFields[goal[i]] != NULL) {
+			//Aim two cells down the flow field, or straight at the goal once there is no direction left
+			const unsigned char* field = goalFields[goal[i]];
+			int cell = nav.cellOf(p.x, p.y);
+			if (cell >= 0 && field[cell] == NavGrid::noDirection && cell != g.cell) {
+				//Pushed against a wall, into the margin the grid keeps around it: continue from a neighbour
+				for (unsigned char k = 0; k < 8; k++) {
+					int next = nav.step(cell, k);
+					if (next >= 0 && next < nav.width * nav.depth && field[next] != NavGrid::noDirection) {
+						cell = next;
+						break;
+					}
+				}
+			}
+			glm::vec2 target = g.position;
+			if (cell >= 0 && field[cell] != NavGrid::noDirection) {
+				int next = nav.step(cell, field[cell]);
+				if (field[next] != NavGrid::noDirection) next = nav.step(next, field[next]);
+				target = nav.cellCenter(next);
+			}
+			glm::vec2 d = target - p;
+			float length = glm::length(d);
+			if (length > 1e-5f) desired = d * (walkSpeed / length);
+		}
+
+		//Separation from the visitors in the 3x3 neighbouring cells (buckets may repeat)
+		glm::vec2 push(0.0f);
+		int cx = (int)floorf(p.x / personalSpace), cz = (int)floorf(p.y / personalSpace);
+		int visited[9], visitedCount = 0;
+		for (int oz = -1; oz <= 1; oz++)
+			for (int ox = -1; ox <= 1; ox++) {
+				int b = bucketOf(cx + ox, cz + oz);
+				if (std::find(visited, visited + visitedCount, b) != visited + visitedCount) continue;
+				visited[visitedCount++] = b;
+				for (int k = hashStart[b]; k < hashStart[b + 1]; k++) {
+					int j = hashAgents[k];
+					if (j == i) continue;
+					glm::vec2 d(p.x - x[j], p.y - z[j]);
+					float d2 = glm::dot(d, d);
+					if (d2 >= space2) continue;
+					if (d2 < 1e-10f) d = glm::vec2((float)((i > j) - (i < j)), 0.0f), d2 = 1.0f; //Same spot: split by index
+					float distance = sqrtf(d2);
+					push += d * ((1.0f - distance / personalSpace) / distance);
+				}
+			}
+		desired += push * walkSpeed * 1.5f;
+
+		v += (desired - v) * std::min(1.0f, acceleration * dt);
+		float speed = glm::length(v);
+		if (speed > walkSpeed * 1.5f) v *= walkSpeed * 1.5f / speed;
+
+		//Move, sliding along walls: swept against the wall boxes, or on the grid by dropping the blocked axis
+		glm::vec2 moved = p + v * dt;
+		if (walls != NULL) {
+			glm::vec3 body(p.x, y[i] + bodyCenter, p.y);
+			glm::vec3 end = walls->move(body, glm::vec3(v.x * dt, 0.0f, v.y * dt), radius);
+			moved = glm::vec2(end.x, end.z);
+			if (dt > 0.0f) v = (moved - p) / dt;
+		}
+		else if (nav.walkable(p.x, p.y) && !nav.walkable(moved.x, moved.y)) {
+			if (nav.walkable(moved.x, p.y)) moved.y = p.y, v.y = 0.0f;
+			else if (nav.walkable(p.x, moved.y)) moved.x = p.x, v.x = 0.0f;
+			else moved = p, v = glm::vec2(0.0f);
+		}
+
+		if (wait[i] <= 0.0f && glm::length(v) > 0.05f) {
+			float turn = wrapAngle(atan2f(-v.y, v.x) - yaw);
+			float maxTurn = turnSpeed * dt;
+			yaw += glm::clamp(turn, -maxTurn, maxTurn);
+		}
+
+		nextX[i] = moved.x;
+		nextZ[i] = moved.y;
+		nextVx[i] = v.x;
+		nextVz[i] = v.y;
+		nextHeading[i] = wrapAngle(yaw);
+	}
+}
+
+void Crowd::steer(NavGrid& nav, float dt, const CollisionWorld* walls) {
+	if (count == 0 || nav.goalCount() == 0) return;
+	auto start = std::chrono::steady_clock::now();
+	dt = std::min(dt, 0.1f); //Keep a long frame from throwing visitors through walls
+	frame++;
+	lastX = x;
+	lastZ = z;
+	lastHeading = heading;
+
+	for (int i = 0; i < count; i++) {
+		if (goal[i] >= 0 && goal[i] < nav.goalCount()) continue;
+		random = random * 1664525u + 1013904223u;
+		goal[i] = (int)((random >> 8) % (unsigned int)nav.goalCount());
+		wait[i] = 0.0f;
+	}
+
+	//Request the fields of the goals in use, then let the planner spend its budget
+	std::vector<char> used(nav.goalCount(), 0);
+	for (int i = 0; i < count; i++) used[goal[i]] = 1;
+	for (int g = 0; g < nav.goalCount(); g++) if (used[g]) nav.flowField(g);
+	nav.plan(planBudgetMs);
+	std::vector<const unsigned char*> goalFields(nav.goalCount(), (const unsigned char*)NULL);
+	for (int g = 0; g < nav.goalCount(); g++) if (used[g]) goalFields[g] = nav.flowField(g);
+
+	buildHash();
+	nextX.resize(count); nextZ.resize(count);
+	nextVx.resize(count); nextVz.resize(count);
+	nextHeading.resize(count);
+	Jobs::parallelFor(0, count, 256, [&](int begin, int end) {
+		steerRange(nav, walls, goalFields, dt, begin, end);
+	});
+	x.swap(nextX); z.swap(nextZ);
+	vx.swap(nextVx); vz.swap(nextVz);
+	heading.swap(nextHeading);
+
+	steeringMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	steeredFrames++;
+}
+
+void Crowd::printStats() {
+	if (steeredFrames == 0) return;
+	printf("Crowd: %d visitors, steering %.3f ms per frame\n", count, steeringMs / steeredFrames);
+}
+
+#ifdef CROWD_SSE
+//sin and cos of four angles: Cody-Waite reduction to [-pi/4, pi/4] and the Cephes polynomials
+static void sinCos4(__m128 a, __m128& s, __m128& c) {
+	__m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(a, _mm_set1_ps(0.63661977236f))); //round(a / (pi/2))
+	__m128 q = _mm_cvtepi32_ps(quadrant);
+	__m128 r = _mm_sub_ps(a, _mm_mul_ps(q, _mm_set1_ps(1.5703125f)));
+	r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(4.837512969970703125e-4f)));
+	r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(7.54978995489188216e-8f)));
+	__m128 r2 = _mm_mul_ps(r, r);
+
+	__m128 ps = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), r2), _mm_set1_ps(8.3321608736e-3f));
+	ps = _mm_add_ps(_mm_mul_ps(ps, r2), _mm_set1_ps(-1.6666654611e-1f));
+	ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, r2), r), r);
+
+	__m128 pc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), r2), _mm_set1_ps(-1.388731625493765e-3f));
+	pc = _mm_add_ps(_mm_mul_ps(pc, r2), _mm_set1_ps(4.166664568298827e-2f));
+	pc = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(pc, r2), r2), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(r2, _mm_set1_ps(0.5f))));
+
+	//Odd quadrants swap sin and cos, quadrants 1-2 negate sin and 2-3 negate cos
+	__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	__m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+	__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+	s = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, pc), _mm_andnot_ps(swap, ps)), sinSign);
+	c = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, ps), _mm_andnot_ps(swap, pc)), cosSign);
+}
+#endif
+
+void Crowd::update(float mov, float alpha) {
+	placements.resize(count);
+	//Blocks of four visitors, so every slice but the last one stays on the SSE path
+	Jobs::parallelFor(0, (count + 3) / 4, 1024, [&](int begin, int end) {
+		updateRange(mov, alpha, begin * 4, std::min(end * 4, count));
+	});
+}
+
+void Crowd::updateRange(float mov, float alpha, int begin, int end) {
+	float animation = walking ? 0.0f : 1.0f; //Steered visitors stand where steer() put them
+	int i = begin;
+#ifdef CROWD_SSE
+	const __m128 movs = _mm_set1_ps(mov);
+	const __m128 animations = _mm_set1_ps(animation);
+	const __m128 alphas = _mm_set1_ps(alpha);
+	const __m128 twoPi = _mm_set1_ps(2 * PI);
+	for (; i + 4 <= end; i += 4) {
+		//Blend the last two steps, taking the short way around for the heading
+		__m128 lx = _mm_loadu_ps(&lastX[i]), lz = _mm_loadu_ps(&lastZ[i]), lh = _mm_loadu_ps(&lastHeading[i]);
+		__m128 bx = _mm_add_ps(lx, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&x[i]), lx), alphas));
+		__m128 bz = _mm_add_ps(lz, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&z[i]), lz), alphas));
+		__m128 turn = _mm_sub_ps(_mm_loadu_ps(&heading[i]), lh);
+		turn = _mm_sub_ps(turn, _mm_mul_ps(twoPi, _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_div_ps(turn, twoPi)))));
+		__m128 bh = _mm_add_ps(lh, _mm_mul_ps(turn, alphas));
+
+		__m128 t = _mm_mul_ps(_mm_add_ps(movs, _mm_loadu_ps(&phase[i])), animations);
+		__m128 yaw = _mm_add_ps(bh, _mm_mul_ps(t, _mm_set1_ps(spinSpeed)));
+		__m128 drift = _mm_mul_ps(t, _mm_set1_ps(driftSpeed));
+		__m128 s, c;
+		sinCos4(yaw, s, c);
+
+		//Origin = standing point + yaw rotation of (drift, hipHeight, 0)
+		__m128 px = _mm_add_ps(bx, _mm_mul_ps(c, drift));
+		__m128 py = _mm_add_ps(_mm_loadu_ps(&y[i]), _mm_set1_ps(hipHeight));
+		__m128 pz = _mm_sub_ps(bz, _mm_mul_ps(s, drift));
+		_MM_TRANSPOSE4_PS(px, py, pz, yaw);
+		_mm_storeu_ps(&placements[i].x, px);
+		_mm_storeu_ps(&placements[i + 1].x, py);
+		_mm_storeu_ps(&placements[i + 2].x, pz);
+		_mm_storeu_ps(&placements[i + 3].x, yaw);
+	}
+#endif
+	for (; i < end; i++) {
+		float bx = lastX[i] + (x[i] - lastX[i]) * alpha;
+		float bz = lastZ[i] + (z[i] - lastZ[i]) * alpha;
+		float bh = lastHeading[i] + wrapAngle(heading[i] - lastHeading[i]) * alpha;
+		float t = (mov + phase[i]) * animation;
+		float yaw = bh + t * spinSpeed;
+		float drift = t * driftSpeed;
+		placements[i] = glm::vec4(bx + cosf(yaw) * drift, y[i] + hipHeight, bz - sinf(yaw) * drift, yaw);
+	}
+}
+
+//Body part matrices in the frame of a visitor, as character() built them
+static void partMatrices(glm::mat4* parts) {
+	glm::mat4 I = glm::mat4(1.0f);
+	glm::vec3 limb = 0.1f * glm::vec3(0.125f, 0.5f, 0.20f);
+	parts[0] = glm::translate(glm::scale(I, 0.1f * glm::vec3(0.125f, 0.5f, 0.5f)), glm::vec3(0.0f, 2.0f, 0.0f)); //Corpus
+	parts[1] = glm::translate(glm::scale(I, limb), glm::vec3(0.0f, 0.0f, -1.5f)); //Legs
+	parts[2] = glm::translate(glm::scale(I, limb), glm::vec3(0.0f, 0.0f, 1.5f));
+	parts[3] = glm::translate(glm::scale(I, limb), glm::vec3(0.0f, 2.0f, 3.5f)); //Hands
+	parts[4] = glm::translate(glm::scale(I, limb), glm::vec3(0.0f, 2.0f, -3.5f));
+	parts[5] = glm::translate(glm::scale(I, glm::vec3(headScale)), glm::vec3(0.0f, 4.0f, 0.0f)); //Head
+}
+
+static void bindInstances(GLuint buffer, size_t placementOffset, size_t colorOffset, GLuint divisor) {
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glVertexAttribPointer(4, 4, GL_FLOAT, false, 0, (const void*)(placementOffset * sizeof(glm::vec4)));
+	glVertexAttribPointer(5, 4, GL_FLOAT, false, 0, (const void*)(colorOffset * sizeof(glm::vec4)));
+	glVertexAttribDivisor(4, divisor);
+	glVertexAttribDivisor(5, divisor);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+static void bindModel(Models::Model& model, bool smooth, bool packed) {
+	if (packed && model.bindPacked(smooth)) return;
+	glVertexAttribPointer(0, 4, GL_FLOAT, false, 0, model.vertices);
+	glVertexAttribPointer(1, 4, GL_FLOAT, false, 0, smooth ? model.vertexNormals : model.normals);
+}
+
+void Crowd::prepare(const glm::vec3& eye, float fovY, float viewportHeight, bool headLod, CrowdFrame& frame) {
+	frame.count = count;
+	if (count == 0) return;
+	if ((int)placements.size() != count) update(0.0f);
+	if (colorsChanged) {
+		colors.resize(count);
+		for (int i = 0; i < count; i++) colors[i] = glm::vec4(red[i], green[i], blue[i], 1.0f);
+		colorsChanged = false;
+	}
+
+	//Heads are grouped by level, each group is one instanced draw.
+	//Bucket 0 holds the heads drawn without LOD, bucket l + 1 level l.
+	const Models::LodChain& heads = Models::sphereLod;
+	std::vector<int>& bucketStart = frame.headBuckets;
+	bucketStart.assign(heads.levels() + 2, 0);
+	for (int i = 0; i < count; i++) {
+		if (headLod) {
+			glm::vec3 head = glm::vec3(placements[i]) + glm::vec3(0.0f, 4.0f * headScale, 0.0f);
+			float distance = glm::max(glm::length(head - eye), headScale);
+			float size = heads.radius * headScale * viewportHeight / (distance * tanf(fovY * 0.5f));
+			headLevel[i] = heads.select(size, headLevel[i]);
+		}
+		else headLevel[i] = -1;
+		bucketStart[headLevel[i] + 2]++;
+	}
+	for (size_t b = 1; b < bucketStart.size(); b++) bucketStart[b] += bucketStart[b - 1];
+
+	//Layout: body placements, body colors, head placements, head colors
+	std::vector<glm::vec4>& instanceData = frame.instances;
+	instanceData.resize(4 * (size_t)count);
+	glm::vec4* headPlacements = &instanceData[2 * (size_t)count];
+	glm::vec4* headColors = &instanceData[3 * (size_t)count];
+	std::copy(placements.begin(), placements.end(), instanceData.begin());
+	std::copy(colors.begin(), colors.end(), instanceData.begin() + count);
+	std::vector<int> next(bucketStart);
+	for (int i = 0; i < count; i++) {
+		int slot = next[headLevel[i] + 1]++;
+		headPlacements[slot] = placements[i];
+		headColors[slot] = colors[i];
+	}
+}
+
+void Crowd::draw(const glm::mat4& P, const glm::mat4& V, const CrowdFrame& frame, bool packed) {
+	int count = frame.count;
+	if (count == 0) return;
+	const std::vector<glm::vec4>& instanceData = frame.instances;
+	const std::vector<int>& bucketStart = frame.headBuckets;
+	const Models::LodChain& heads = Models::sphereLod;
+
+	if (instanceBuffer == 0) glGenBuffers(1, &instanceBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+	glBufferData(GL_ARRAY_BUFFER, instanceData.size() * sizeof(glm::vec4), NULL, GL_STREAM_DRAW); //Orphan last frame's data
+	glBufferSubData(GL_ARRAY_BUFFER, 0, instanceData.size() * sizeof(glm::vec4), instanceData.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glm::mat4 parts[bodyParts + 1];
+	partMatrices(parts);
+	//alpha 1 - fixed part color, 0 - the visitor's color
+	const glm::vec4 partColors[bodyParts + 1] = {
+		glm::vec4(0.0f), glm::vec4(0, 0, 0, 1), glm::vec4(0, 0, 0, 1), glm::vec4(0.0f), glm::vec4(0.0f), glm::vec4(1.0f, 0.89f, 0.8f, 1.0f)
+	};
+
+	spCrowd->use();
+	glUniformMatrix4fv(spCrowd->u("P"), 1, false, glm::value_ptr(P));
+	glUniformMatrix4fv(spCrowd->u("V"), 1, false, glm::value_ptr(V));
+	glUniformMatrix4fv(spCrowd->u("parts"), bodyParts + 1, false, glm::value_ptr(parts[0]));
+	glUniform4fv(spCrowd->u("partColors"), bodyParts + 1, glm::value_ptr(partColors[0]));
+
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(4);
+	glEnableVertexAttribArray(5);
+
+	//Bodies: every visitor is bodyParts consecutive instances
+	glUniform1i(spCrowd->u("firstPart"), 0);
+	glUniform1i(spCrowd->u("partCount"), bodyParts);
+	bindModel(Models::cube, false, packed);
+	bindInstances(instanceBuffer, 0, count, bodyParts);
+	glDrawArraysInstanced(GL_TRIANGLES, 0, Models::cube.vertexCount, count * bodyParts);
+
+	glUniform1i(spCrowd->u("firstPart"), bodyParts);
+	glUniform1i(spCrowd->u("partCount"), 1);
+	for (int l = -1; l < heads.levels(); l++) {
+		int first = bucketStart[l + 1], instances = bucketStart[l + 2] - first;
+		if (instances == 0) continue;
+		Models::Model& head = l < 0 ? (Models::Model&)Models::sphere : heads.level(l);
+		bindModel(head, true, packed);
+		bindInstances(instanceBuffer, 2 * (size_t)count + first, 3 * (size_t)count + first, 1);
+		if (head.indexCount > 0) glDrawElementsInstanced(GL_TRIANGLES, head.indexCount, head.indexType, head.indices, instances);
+		else glDrawArraysInstanced(GL_TRIANGLES, 0, head.vertexCount, instances);
+	}
+
+	glVertexAttribDivisor(4, 0);
+	glVertexAttribDivisor(5, 0);
+	glDisableVertexAttribArray(0);
+	glDisableVertexAttribArray(1);
+	glDisableVertexAttribArray(4);
+	glDisableVertexAttribArray(5);
+}
+
+void Crowd::release() {
+	if (instanceBuffer != 0) glDeleteBuffers(1, &instanceBuffer);
+	instanceBuffer = 0;
+}
@@ -0,0 +1,103 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CROWD_H
+#define CROWD_H
+
+//Gallery visitors kept as structure-of-arrays state.
+//update() turns the state into one placement (position, yaw) per visitor,
+//four visitors at a time on SSE registers. prepare() picks head levels and
+//lays the placements out in a CrowdFrame, which draw() (possibly on another
+//thread) uploads once and draws every body part of every visitor with instanced draws of
+//Models::cube and the levels of Models::sphereLod (v_crowd.glsl): one call
+//for the bodies and one per head level in use.
+//With walking set, steer() moves the visitors between the goals of a
+//NavGrid (flow fields) and keeps them apart with a uniform spatial hash.
+
+#include <GL/glew.h>
+#include <vector>
+#include <glm/glm.hpp>
+
+class NavGrid;
+class CollisionWorld;
+
+//Everything Crowd::draw() needs, written by Crowd::prepare()
+struct CrowdFrame {
+	int count = 0;
+	std::vector<glm::vec4> instances; //Body placements, body colors, head placements, head colors; count each
+	std::vector<int> headBuckets; //Heads [headBuckets[b], headBuckets[b + 1]) use bucket b: 0 - no LOD, l + 1 - Models::sphereLod level l
+};
+
+class Crowd {
+public:
+	Crowd();
+	~Crowd();
+
+	int add(const glm::vec3& position, float heading, const glm::vec3& color, float phase = 0.0f); //Returns the visitor index
+	int add(const glm::mat4& M, const glm::vec3& color, float phase = 0.0f); //M has to keep the y axis up
+	void clear();
+	int size() const { return count; }
+
+	void steer(NavGrid& nav, float dt, const CollisionWorld* walls = NULL); //Walks the visitors between the goals of nav, sliding along walls if given
+	void update(float mov, float alpha = 1.0f); //Placements for draw(): spinning animation driven by mov as character() used to do, or the steered pose if walking, alpha of the way from the step before the last steer()
+	void prepare(const glm::vec3& eye, float fovY, float viewportHeight, bool headLod, CrowdFrame& frame);
+	void draw(const glm::mat4& P, const glm::mat4& V, const CrowdFrame& frame, bool packed = true); //GL calls only, touches no visitor state; packed draws the body and head models from their PackedVertex copies
+	void release();
+
+	static const int bodyParts = 5; //Corpus, two legs, two hands; the head is drawn separately
+
+	//Per-visitor state
+	std::vector<float> x, y, z; //Where the visitor stands
+	std::vector<float> heading; //Rotation around y, radians
+	std::vector<float> phase; //Offset of the animation
+	std::vector<float> red, green, blue;
+	std::vector<int> headLevel; //Current level in Models::sphereLod, -1 until the first draw
+	std::vector<float> vx, vz; //Walking velocity
+	std::vector<int> goal; //NavGrid goal, -1 picks a new one
+	std::vector<float> wait; //Seconds left in front of the goal
+	std::vector<float> lastX, lastZ, lastHeading; //State before the last steer(), for interpolation
+
+	bool walking;
+	float walkSpeed; //Units per second
+	float personalSpace; //Visitors closer than this push each other away
+	float radius; //Size of a visitor for collisions with walls
+	float planBudgetMs; //Time per frame for computing flow fields
+
+	void printStats();
+
+private:
+	int count;
+	std::vector<glm::vec4> placements; //xyz - body origin, w - yaw; written by update()
+	std::vector<glm::vec4> colors;
+	GLuint instanceBuffer;
+	bool colorsChanged;
+
+	//Spatial hash of the visitors, rebuilt by steer(): the visitors in bucket b are hashAgents[hashStart[b]..hashStart[b + 1])
+	std::vector<int> hashStart;
+	std::vector<int> hashAgents;
+	std::vector<int> agentBucket;
+	std::vector<float> nextX, nextZ, nextVx, nextVz, nextHeading;
+	unsigned int frame;
+	unsigned int random;
+	double steeringMs;
+	int steeredFrames;
+
+	int bucketOf(int cx, int cz) const;
+	void buildHash();
+	void updateRange(float mov, float alpha, int begin, int end);
+	void steerRange(const NavGrid& nav, const CollisionWorld* walls, const std::vector<const unsigned char*>& goalFields, float dt, int begin, int end);
+};
+
+#endif
@@ -0,0 +1,16 @@
+#version 430
+
+
+uniform sampler2DArray tex;
+uniform int cullDebug=0;
+
+out vec4 pixelColor; //Output variable of the fragment shader. (Almost) final pixel color.
+
+//Varying variables
+in vec2 i_tc;
+flat in int i_layer;
+
+void main(void) {
+	if (cullDebug!=0) pixelColor=vec4(1,0,0,1);
+	else pixelColor=texture(tex,vec3(i_tc,i_layer));
+}
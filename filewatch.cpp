@@ -0,0 +1,119 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "filewatch.h"
+#include <stdio.h>
+#include <algorithm>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+const double FileWatcher::pollInterval = 0.25;
+
+#ifdef __linux__
+
+FileWatcher::FileWatcher() {
+	fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (fd < 0) perror("inotify_init1");
+}
+
+FileWatcher::~FileWatcher() {
+	if (fd >= 0) close(fd);
+}
+
+void FileWatcher::watch(const std::string& path) {
+	if (fd < 0) return;
+	size_t slash = path.find_last_of('/');
+	std::string directory = slash == std::string::npos ? "." : path.substr(0, std::max((size_t)1, slash));
+	std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+
+	std::map<std::string, int>::iterator d = directories.find(directory);
+	if (d == directories.end()) {
+		int wd = inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+		if (wd < 0) {
+			fprintf(stderr, "%s: cannot watch\n", directory.c_str());
+			return;
+		}
+		d = directories.insert(std::make_pair(directory, wd)).first;
+	}
+	files[std::make_pair(d->second, name)] = path;
+}
+
+void FileWatcher::clear() {
+	for (const auto& d : directories) inotify_rm_watch(fd, d.second);
+	directories.clear();
+	files.clear();
+}
+
+void FileWatcher::poll(std::vector<std::string>& changed) {
+	if (fd < 0) return;
+	size_t first = changed.size();
+	alignas(inotify_event) char buffer[4096];
+	for (;;) {
+		ssize_t length = read(fd, buffer, sizeof(buffer));
+		if (length <= 0) {
+			if (length < 0 && errno != EAGAIN) perror("inotify read");
+			break;
+		}
+		for (char* p = buffer; p < buffer + length; ) {
+			const inotify_event* e = (const inotify_event*)p;
+			p += sizeof(inotify_event) + e->len;
+			if (e->len == 0) continue; //Event of the directory itself
+			std::map<std::pair<int, std::string>, std::string>::const_iterator f = files.find(std::make_pair(e->wd, std::string(e->name)));
+			if (f != files.end() && std::find(changed.begin() + first, changed.end(), f->second) == changed.end())
+				changed.push_back(f->second);
+		}
+	}
+}
+
+#else
+
+static long long modificationTime(const std::string& path) {
+	struct stat st;
+	return stat(path.c_str(), &st) == 0 ? (long long)st.st_mtime : -1;
+}
+
+FileWatcher::FileWatcher() {
+	lastPoll = std::chrono::steady_clock::now();
+}
+
+FileWatcher::~FileWatcher() {
+}
+
+void FileWatcher::watch(const std::string& path) {
+	files[path] = modificationTime(path);
+}
+
+void FileWatcher::clear() {
+	files.clear();
+}
+
+void FileWatcher::poll(std::vector<std::string>& changed) {
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if (std::chrono::duration<double>(now - lastPoll).count() < pollInterval) return;
+	lastPoll = now;
+	for (auto& f : files) {
+		long long time = modificationTime(f.first);
+		if (time == f.second) continue;
+		f.second = time;
+		if (time >= 0) changed.push_back(f.first);
+	}
+}
+
+#endif
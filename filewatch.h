@@ -0,0 +1,55 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef FILEWATCH_H
+#define FILEWATCH_H
+
+//Reports watched files that were written since the last poll().
+//Linux: inotify on the directories of the files, so files replaced by a rename
+//(as many editors save) are seen too; events are read without blocking.
+//Elsewhere: modification times, compared at most every pollInterval seconds.
+
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+
+class FileWatcher {
+public:
+	FileWatcher();
+	~FileWatcher();
+
+	void watch(const std::string& path); //A file relative to the working directory or absolute, watching it twice is harmless
+	void clear();
+	void poll(std::vector<std::string>& changed); //Appends the changed files, each once and as passed to watch()
+
+	static const double pollInterval;
+
+private:
+#ifdef __linux__
+	int fd; //inotify instance, -1 if it could not be created
+	std::map<std::string, int> directories; //Directory -> watch descriptor
+	std::map<std::pair<int, std::string>, std::string> files; //Watch descriptor and file name -> watched path
+#else
+	std::map<std::string, long long> files; //Watched path -> modification time
+	std::chrono::steady_clock::time_point lastPoll;
+#endif
+
+	FileWatcher(const FileWatcher&); //Owns the inotify descriptor
+	FileWatcher& operator=(const FileWatcher&);
+};
+
+#endif
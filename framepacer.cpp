@@ -0,0 +1,106 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "framepacer.h"
+#include <stdio.h>
+#include <algorithm>
+
+FramePacer::FramePacer() {
+	rawMouseMotion = false;
+	adaptiveVsync = false;
+	supported = false;
+	lowLatencyMode = false;
+	maxQueued = maxFramesInFlight;
+	waitMs = 0;
+	frameCount = 0;
+}
+
+void FramePacer::setup(GLFWwindow* window) {
+	supported = GLEW_VERSION_3_2 || GLEW_ARB_sync;
+	if (glfwRawMouseMotionSupported()) {
+		glfwSetInputMode(window, GLFW_RAW_MOUSE_MOTION, GLFW_TRUE);
+		rawMouseMotion = true;
+	}
+	adaptiveVsync = glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+	printf("Frame pacing: fences %s, raw mouse motion %s, adaptive vsync %s\n",
+		supported ? "yes" : "no", rawMouseMotion ? "yes" : "no", adaptiveVsync ? "yes" : "no");
+	applySwapInterval();
+}
+
+void FramePacer::applySwapInterval() {
+	glfwSwapInterval(lowLatencyMode && adaptiveVsync ? -1 : 1);
+}
+
+void FramePacer::setLowLatency(bool enabled) {
+	lowLatencyMode = enabled;
+	maxQueued = enabled ? 1 : maxFramesInFlight;
+	applySwapInterval();
+	resetStats();
+}
+
+void FramePacer::setFramesInFlight(int frames) {
+	maxQueued = std::max(1, std::min<int>(frames, maxFramesInFlight));
+	resetStats();
+}
+
+bool FramePacer::retire(bool block) {
+	if (frames.empty()) return false;
+	Frame& f = frames.front();
+	GLenum result = glClientWaitSync(f.fence, GL_SYNC_FLUSH_COMMANDS_BIT, block ? 1000000000ull : 0);
+	if (result == GL_TIMEOUT_EXPIRED) return false;
+	//GL_WAIT_FAILED too: drop the frame rather than wait on it forever
+	if (result != GL_WAIT_FAILED) latencies.push_back((float)((glfwGetTime() - f.inputTime) * 1000.0));
+	glDeleteSync(f.fence);
+	frames.pop_front();
+	return true;
+}
+
+void FramePacer::waitForFrames() {
+	if (!supported) return;
+	while (retire(false));
+	double start = glfwGetTime();
+	while ((int)frames.size() >= maxQueued && retire(true));
+	waitMs += (glfwGetTime() - start) * 1000.0;
+}
+
+void FramePacer::frameSubmitted(double inputTime) {
+	frameCount++;
+	if (!supported) return;
+	while (retire(false)); //Stamp frames that finished during the swap now, not at the next waitForFrames()
+	frames.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), inputTime });
+}
+
+void FramePacer::release() {
+	for (Frame& f : frames) glDeleteSync(f.fence);
+	frames.clear();
+}
+
+void FramePacer::resetStats() {
+	latencies.clear();
+	waitMs = 0;
+	frameCount = 0;
+}
+
+void FramePacer::printStats() {
+	if (latencies.empty()) return;
+	std::vector<float> sorted(latencies);
+	std::sort(sorted.begin(), sorted.end());
+	double sum = 0;
+	for (float l : sorted) sum += l;
+	printf("Frame pacing (%s, %d in flight): %d frames, input to present %.2f ms average, %.2f ms median, %.2f ms 99th percentile, %.2f ms max, %.2f ms waiting per frame\n",
+		lowLatencyMode ? "low latency" : "normal", maxQueued, frameCount, sum / sorted.size(), sorted[sorted.size() / 2],
+		sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)], sorted.back(), waitMs / std::max(1, frameCount));
+}
@@ -0,0 +1,75 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+//Frame pacing and input latency measurement, used by the thread that owns the context.
+//Every presented frame gets a fence (glFenceSync) right after its swap.
+//waitForFrames() blocks until at most framesInFlight - 1 earlier frames are still
+//queued on the GPU, so the CPU cannot run ahead and input sampled afterwards
+//reaches the screen sooner. Input to present latency is measured from the
+//input time passed to frameSubmitted() to the moment the frame's fence is seen signalled.
+//Fences are polled right after every swap and before input is sampled, so a
+//latency is at most the time between two such polls too high.
+//Low latency mode allows one frame in flight and uses adaptive vsync where the
+//driver supports it.
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <deque>
+#include <vector>
+
+class FramePacer {
+public:
+	FramePacer();
+
+	void setup(GLFWwindow* window); //Call once the context is current and the cursor is disabled
+	void setLowLatency(bool enabled);
+	void setFramesInFlight(int frames);
+	void waitForFrames(); //Before sampling input
+	void frameSubmitted(double inputTime); //Right after glfwSwapBuffers, inputTime - glfwGetTime() when the frame's input was sampled
+	void release();
+	void printStats();
+	void resetStats();
+
+	bool lowLatency() const { return lowLatencyMode; }
+	int framesInFlight() const { return maxQueued; }
+	bool rawMouseMotion; //Unscaled, unaccelerated mouse deltas are used
+	bool adaptiveVsync; //Swap interval -1 (tear instead of waiting a whole refresh when late) is available
+
+	enum { maxFramesInFlight = 3 };
+
+private:
+	struct Frame {
+		GLsync fence;
+		double inputTime;
+	};
+
+	bool supported; //ARB_sync is available
+	bool lowLatencyMode;
+	int maxQueued;
+	std::deque<Frame> frames;
+
+	std::vector<float> latencies; //ms, since the last resetStats()
+	double waitMs;
+	int frameCount;
+
+	bool retire(bool block); //Retires the oldest frame once its fence is signalled
+	void applySwapInterval();
+};
+
+#endif
@@ -0,0 +1,181 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//Writes a procedural gallery as a text layout (see layoutfile.h), for stress scenes.
+//Usage: gallerygen output.txt [-s seed] [-r rooms] [-v visitorsPerRoom] [-t textures.txt]
+//Rooms lie on a square grid, 6 units apart. A random spanning tree of the grid,
+//plus a few extra links for loops, decides which neighbours a corridor joins.
+//Paintings are sampled from the textures declared in textures.txt (gallery.txt
+//by default) other than wall, floor and ceiling. The same arguments always
+//produce the same gallery.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <numeric>
+
+//xorshift64*, so the output does not depend on the standard library
+struct Random {
+	unsigned long long state;
+	Random(unsigned long long seed) : state(seed * 0x9E3779B97F4A7C15ull + 1) {}
+	unsigned int next() {
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return (unsigned int)((state * 0x2545F4914F6CDD1Dull) >> 32);
+	}
+	int below(int n) { return (int)(next() % (unsigned int)n); }
+	float uniform(float a, float b) { return a + (b - a) * (next() >> 8) * (1.0f / 16777216.0f); }
+};
+
+//Union-find over grid cells for the spanning tree
+static int root(std::vector<int>& parent, int i) {
+	while (parent[i] != i) i = parent[i] = parent[parent[i]];
+	return i;
+}
+
+static bool readTextures(const char* path, std::vector<std::string>& declarations, std::vector<std::string>& paintings) {
+	FILE* f = fopen(path, "r");
+	if (f == NULL) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return false;
+	}
+	char line[1024], name[256], file[768];
+	bool wall = false, floor = false, ceiling = false;
+	while (fgets(line, sizeof(line), f)) {
+		if (sscanf(line, " texture %255s %767s", name, file) != 2) continue;
+		declarations.push_back(std::string("texture ") + name + " " + file);
+		if (strcmp(name, "wall") == 0) wall = true;
+		else if (strcmp(name, "floor") == 0) floor = true;
+		else if (strcmp(name, "ceiling") == 0) ceiling = true;
+		else paintings.push_back(name);
+	}
+	fclose(f);
+	if (!wall || !floor || !ceiling || paintings.empty()) {
+		fprintf(stderr, "%s: needs the textures wall, floor, ceiling and at least one painting\n", path);
+		return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv) {
+	const char* usage = "usage: gallerygen output.txt [-s seed] [-r rooms] [-v visitorsPerRoom] [-t textures.txt]\n";
+	if (argc < 2) {
+		fprintf(stderr, "%s", usage);
+		return 1;
+	}
+	unsigned long long seed = 1;
+	int rooms = 100, visitorsPerRoom = 2;
+	const char* texturePath = "gallery.txt";
+	for (int i = 2; i < argc; i++) {
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "-s") == 0 && hasValue) seed = strtoull(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-r") == 0 && hasValue) rooms = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-v") == 0 && hasValue) visitorsPerRoom = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-t") == 0 && hasValue) texturePath = argv[++i];
+		else {
+			fprintf(stderr, "gallerygen: bad argument %s\n%s", argv[i], usage);
+			return 1;
+		}
+	}
+	if (rooms < 1 || visitorsPerRoom < 0) {
+		fprintf(stderr, "gallerygen: needs at least one room\n");
+		return 1;
+	}
+
+	std::vector<std::string> declarations, paintings;
+	if (!readTextures(texturePath, declarations, paintings)) return 1;
+
+	Random random(seed);
+	int columns = (int)ceil(sqrt((double)rooms));
+
+	//Links to the east (+x) and south (+z) neighbour of every room
+	std::vector<char> east(rooms, 0), south(rooms, 0);
+	std::vector<int> edges; //2 * room + 0 for east, + 1 for south
+	for (int r = 0; r < rooms; r++) {
+		if (r % columns + 1 < columns && r + 1 < rooms) edges.push_back(2 * r);
+		if (r + columns < rooms) edges.push_back(2 * r + 1);
+	}
+	for (int i = (int)edges.size() - 1; i > 0; i--) std::swap(edges[i], edges[random.below(i + 1)]);
+	std::vector<int> parent(rooms);
+	std::iota(parent.begin(), parent.end(), 0);
+	for (int e : edges) {
+		int a = e / 2, b = e % 2 ? a + columns : a + 1;
+		int ra = root(parent, a), rb = root(parent, b);
+		bool loop = ra == rb;
+		if (loop && random.below(10) != 0) continue; //Every tenth surplus link stays, for loops
+		parent[ra] = rb;
+		(e % 2 ? south : east)[a] = 1;
+	}
+
+	FILE* f = fopen(argv[1], "w");
+	if (f == NULL) {
+		fprintf(stderr, "%s: cannot create\n", argv[1]);
+		return 1;
+	}
+	fprintf(f, "# Generated by gallerygen -s %llu -r %d -v %d -t %s\n", seed, rooms, visitorsPerRoom, texturePath);
+	fprintf(f, "# %d rooms on a grid of %d columns\n\n", rooms, columns);
+	for (const std::string& d : declarations) fprintf(f, "%s\n", d.c_str());
+	fprintf(f, "\nexhibit teapot -1.3 -0.69 -0.35 0.1\n");
+	fprintf(f, "rotate 180 1 0 0 # Upside down like gallery.txt, frame z is world -z\n");
+
+	const float alongSlots[4] = { -1.44f, -0.72f, 0.72f, 1.44f };
+	const float acrossSlots[2] = { -1.17f, 1.17f };
+	const char* sideNames[4] = { "north", "south", "east", "west" };
+	int paintingCount = 0, corridorCount = 0;
+	for (int r = 0; r < rooms; r++) {
+		int x = r % columns, z = r / columns;
+		bool doors[4] = { z > 0 && south[r - columns] != 0, south[r] != 0, east[r] != 0, x > 0 && east[r - 1] != 0 };
+		fprintf(f, "\npush\ntranslate %d 0 %d\n", 6 * x, 6 * z);
+		fprintf(f, "room %s %s %s %s\n", doors[0] ? "door" : "wall", doors[1] ? "door" : "wall", doors[2] ? "door" : "wall", doors[3] ? "door" : "wall");
+		for (int side = 0; side < 4; side++) {
+			bool alongX = side < 2;
+			int slots = alongX ? 4 : 2;
+			for (int k = 0; k <= slots; k++) {
+				if (k == slots && doors[side]) break; //The middle slot is the door
+				if (random.below(4) == 0) continue; //Leave some walls empty
+				float offset = k == slots ? 0.0f : (alongX ? alongSlots[k] : acrossSlots[k]);
+				fprintf(f, "painting %s %s %g\n", paintings[random.below((int)paintings.size())].c_str(), sideNames[side], offset);
+				paintingCount++;
+			}
+		}
+		fprintf(f, "pop\n");
+		if (east[r]) {
+			fprintf(f, "push\ntranslate %d 0 %d\ncorridor\npop\n", 6 * x + 3, 6 * z);
+			corridorCount++;
+		}
+		if (south[r]) {
+			fprintf(f, "push\ntranslate %d 0 %d\nrotate 90 0 1 0\ncorridor\npop\n", 6 * x, 6 * z + 3);
+			corridorCount++;
+		}
+		for (int v = 0; v < visitorsPerRoom; v++) { //World coordinates: frame z is world -z
+			fprintf(f, "visitor %.2f 0 %.2f %.0f %.2f %.2f %.2f\n", 6 * x + random.uniform(-1.4f, 1.4f), -6 * z + random.uniform(-1.4f, 1.4f),
+				random.uniform(-180.0f, 180.0f), random.uniform(0.1f, 0.9f), random.uniform(0.1f, 0.9f), random.uniform(0.1f, 0.9f));
+		}
+	}
+
+	bool ok = ferror(f) == 0;
+	if (fclose(f) != 0) ok = false;
+	if (!ok) {
+		fprintf(stderr, "%s: write failed\n", argv[1]);
+		return 1;
+	}
+	printf("%d rooms, %d corridors, %d paintings, %d visitors\n", rooms, corridorCount, paintingCount, rooms * visitorsPerRoom);
+	return 0;
+}
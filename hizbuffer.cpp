@@ -0,0 +1,95 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "hizbuffer.h"
+#include "shaderprogram.h"
+#include <algorithm>
+
+HiZBuffer::HiZBuffer() {
+	depthCopy = 0;
+	pyramid = 0;
+	levelWidth = 0;
+	levelHeight = 0;
+	levelCount = 0;
+	ready = false;
+}
+
+HiZBuffer::~HiZBuffer() {
+	//GL objects are freed by release(), the context is already gone here
+}
+
+void HiZBuffer::resize(int width, int height) {
+	release();
+
+	levelWidth = width;
+	levelHeight = height;
+	levelCount = 1;
+	for (int size = std::max(width, height); size > 1; size /= 2) levelCount++;
+
+	glGenTextures(1, &depthCopy);
+	glBindTexture(GL_TEXTURE_2D, depthCopy);
+	glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH_COMPONENT32F, width, height);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+	glGenTextures(1, &pyramid);
+	glBindTexture(GL_TEXTURE_2D, pyramid);
+	glTexStorage2D(GL_TEXTURE_2D, levelCount, GL_R32F, width, height);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void HiZBuffer::build(int width, int height) {
+	if (width <= 0 || height <= 0) return;
+	if (width != levelWidth || height != levelHeight || pyramid == 0) resize(width, height);
+
+	//Grab the depth of the frame that was just rendered
+	glBindTexture(GL_TEXTURE_2D, depthCopy);
+	glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, width, height);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	spHiZ->use();
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, depthCopy);
+	glUniform1i(spHiZ->u("depth"), 0);
+
+	int w = width, h = height;
+	for (int level = 0; level < levelCount; level++) {
+		glUniform1i(spHiZ->u("level"), level);
+		glBindImageTexture(0, pyramid, std::max(level - 1, 0), GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+		glBindImageTexture(1, pyramid, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+		glDispatchCompute((w + 7) / 8, (h + 7) / 8, 1);
+		glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+
+		w = std::max(w / 2, 1);
+		h = std::max(h / 2, 1);
+	}
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	ready = true;
+}
+
+void HiZBuffer::release() {
+	glDeleteTextures(1, &depthCopy);
+	glDeleteTextures(1, &pyramid);
+	depthCopy = 0;
+	pyramid = 0;
+	ready = false;
+}
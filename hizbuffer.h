@@ -0,0 +1,51 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HIZBUFFER_H
+#define HIZBUFFER_H
+
+//Hierarchical depth buffer.
+//build() copies the depth of the current framebuffer and reduces it to a mip chain
+//where every texel keeps the farthest depth of the texels it covers.
+//The next frame tests bounding boxes against it in c_cull.glsl.
+
+#include <GL/glew.h>
+
+class HiZBuffer {
+public:
+	HiZBuffer();
+	~HiZBuffer();
+
+	void build(int width, int height); //Call after the scene was rendered, before swapping buffers
+	void release();
+
+	bool valid() const { return ready; } //False until the first pyramid was built
+	GLuint texture() const { return pyramid; }
+	int width() const { return levelWidth; }
+	int height() const { return levelHeight; }
+	int levels() const { return levelCount; }
+
+private:
+	GLuint depthCopy; //GL_DEPTH_COMPONENT32F copy of the framebuffer depth
+	GLuint pyramid; //GL_R32F texture with the full mip chain
+	int levelWidth;
+	int levelHeight;
+	int levelCount;
+	bool ready;
+
+	void resize(int width, int height);
+};
+
+#endif
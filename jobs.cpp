@@ -0,0 +1,322 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "jobs.h"
+#include <stdio.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+
+namespace Jobs {
+
+	struct Job {
+		void (*execute)(Job *job);
+	};
+
+	//Chase-Lev work-stealing deque of a fixed capacity (push() fails when it is full)
+	class Deque {
+		public:
+			static const long capacity = 1024;
+
+			Deque() : top(0), bottom(0) {
+				for (long i = 0; i < capacity; i++) ring[i].store(nullptr, std::memory_order_relaxed);
+			}
+
+			bool push(Job *job) { //Owner only
+				long b = bottom.load(std::memory_order_relaxed);
+				long t = top.load(std::memory_order_acquire);
+				if (b - t >= capacity) return false;
+				ring[b & (capacity - 1)].store(job, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				bottom.store(b + 1, std::memory_order_relaxed);
+				return true;
+			}
+
+			Job *pop() { //Owner only, newest first
+				long b = bottom.load(std::memory_order_relaxed) - 1;
+				bottom.store(b, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				long t = top.load(std::memory_order_relaxed);
+				if (t > b) {
+					bottom.store(b + 1, std::memory_order_relaxed);
+					return nullptr;
+				}
+				Job *job = ring[b & (capacity - 1)].load(std::memory_order_relaxed);
+				if (t == b) {
+					//Last job: race the thieves for it
+					if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) job = nullptr;
+					bottom.store(b + 1, std::memory_order_relaxed);
+				}
+				return job;
+			}
+
+			Job *steal() { //Any thread, oldest first
+				long t = top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				long b = bottom.load(std::memory_order_acquire);
+				if (t >= b) return nullptr;
+				Job *job = ring[t & (capacity - 1)].load(std::memory_order_relaxed);
+				if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return nullptr;
+				return job;
+			}
+
+		private:
+			alignas(64) std::atomic<long> top;
+			alignas(64) std::atomic<long> bottom;
+			std::atomic<Job*> ring[capacity];
+	};
+
+	static thread_local int localDeque = -1; //Index of the calling thread's deque
+
+	class Scheduler {
+		public:
+			enum { maxDeques = 64 }; //Workers and submitting threads together
+
+			Scheduler() : registered(0), sleeping(0), quit(false), executed(0), stolen(0) {
+				workers = std::max(0, (int)std::thread::hardware_concurrency() - 1);
+				workers = std::min<int>(workers, maxDeques / 2);
+				registered = workers;
+				active = workers;
+				for (int i = 0; i < workers; i++) threads.push_back(std::thread(&Scheduler::workerLoop, this, i));
+			}
+
+			~Scheduler() {
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					quit = true;
+				}
+				wake.notify_all();
+				parked.notify_all();
+				for (std::thread &t : threads) t.join();
+			}
+
+			//Deque of the calling thread, registered on first use; NULL if all are taken
+			Deque *local() {
+				if (localDeque < 0) {
+					int i = registered.fetch_add(1);
+					if (i >= maxDeques) return nullptr;
+					localDeque = i;
+				}
+				return &deques[localDeque];
+			}
+
+			void submit(Deque *own, Job *job) {
+				if (!own->push(job)) {
+					job->execute(job); //Full, run it right away
+					return;
+				}
+				if (sleeping.load(std::memory_order_relaxed) > 0) wake.notify_one();
+			}
+
+			//A job of the own deque or one stolen from another thread
+			Job *find(Deque *own) {
+				if (own != nullptr) {
+					Job *job = own->pop();
+					if (job != nullptr) return job;
+				}
+				int count = std::min<int>(registered.load(std::memory_order_relaxed), maxDeques);
+				thread_local unsigned int seed = (unsigned int)std::hash<std::thread::id>()(std::this_thread::get_id());
+				seed = seed * 1664525u + 1013904223u;
+				int start = count > 0 ? (int)((seed >> 8) % (unsigned int)count) : 0;
+				for (int k = 0; k < count; k++) {
+					Deque &victim = deques[(start + k) % count];
+					if (&victim == own) continue;
+					Job *job = victim.steal();
+					if (job != nullptr) {
+						stolen.fetch_add(1, std::memory_order_relaxed);
+						return job;
+					}
+				}
+				return nullptr;
+			}
+
+			void execute(Job *job) {
+				executed.fetch_add(1, std::memory_order_relaxed);
+				job->execute(job);
+			}
+
+			//Runs other jobs until done() holds
+			template <class Condition> void helpUntil(Deque *own, Condition done) {
+				for (int idle = 0; !done(); ) {
+					Job *job = find(own);
+					if (job != nullptr) {
+						execute(job);
+						idle = 0;
+					}
+					else if (++idle > 64) std::this_thread::yield();
+				}
+			}
+
+			void setActive(int count) {
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					active = count;
+				}
+				parked.notify_all();
+			}
+
+			int workers;
+			std::atomic<int> active; //Workers with a lower index run jobs
+			std::atomic<int> registered;
+			std::atomic<int> sleeping;
+			bool quit;
+			std::atomic<long long> executed;
+			std::atomic<long long> stolen;
+
+		private:
+			Deque deques[maxDeques];
+			std::vector<std::thread> threads;
+			std::mutex mutex;
+			std::condition_variable wake;
+			std::condition_variable parked; //Workers above the active count
+
+			void workerLoop(int index) {
+				localDeque = index;
+				Deque *own = &deques[index];
+				int idle = 0;
+				for (;;) {
+					if (index >= active.load(std::memory_order_relaxed)) {
+						std::unique_lock<std::mutex> lock(mutex);
+						parked.wait(lock, [&] { return quit || index < active.load(std::memory_order_relaxed); });
+						if (quit) return;
+					}
+					Job *job = find(own);
+					if (job != nullptr) {
+						execute(job);
+						idle = 0;
+						continue;
+					}
+					if (++idle < 256) {
+						std::this_thread::yield();
+						continue;
+					}
+					//Nothing to do for a while: sleep, with a timeout in case a wake-up is missed
+					std::unique_lock<std::mutex> lock(mutex);
+					if (quit) return;
+					sleeping++;
+					wake.wait_for(lock, std::chrono::milliseconds(2));
+					sleeping--;
+					idle = 0;
+				}
+			}
+	};
+
+	static Scheduler &scheduler() {
+		static Scheduler instance; //Started on first use, also during static initialization
+		return instance;
+	}
+
+	struct RangeJob: public Job {
+		int begin, end, grain;
+		const std::function<void(int, int)> *body;
+		std::atomic<bool> done;
+	};
+
+	static void splitRange(Scheduler &s, Deque *own, int begin, int end, int grain, const std::function<void(int, int)> &body);
+
+	static void executeRange(Job *job) {
+		RangeJob *r = (RangeJob*)job;
+		Scheduler &s = scheduler();
+		splitRange(s, s.local(), r->begin, r->end, r->grain, *r->body);
+		r->done.store(true, std::memory_order_release);
+	}
+
+	//Offers the upper half to thieves and keeps splitting the lower one; the half comes back
+	//through pop() if nobody took it, otherwise the thread helps with other jobs until it is done
+	static void splitRange(Scheduler &s, Deque *own, int begin, int end, int grain, const std::function<void(int, int)> &body) {
+		while (own != nullptr && end - begin > grain && end - begin >= 2) {
+			int middle = begin + (end - begin) / 2;
+			RangeJob upper;
+			upper.execute = executeRange;
+			upper.begin = middle;
+			upper.end = end;
+			upper.grain = grain;
+			upper.body = &body;
+			upper.done.store(false, std::memory_order_relaxed);
+			s.submit(own, &upper);
+			splitRange(s, own, begin, middle, grain, body);
+			s.helpUntil(own, [&] { return upper.done.load(std::memory_order_acquire); });
+			return;
+		}
+		body(begin, end);
+	}
+
+	void parallelFor(int begin, int end, int grain, const std::function<void(int, int)> &body) {
+		if (end <= begin) return;
+		grain = std::max(grain, 1);
+		Scheduler &s = scheduler();
+		if (end - begin <= grain || s.active.load(std::memory_order_relaxed) == 0) {
+			body(begin, end);
+			return;
+		}
+		splitRange(s, s.local(), begin, end, grain, body);
+	}
+
+	struct FunctionJob: public Job {
+		std::function<void()> task;
+		TaskGroup *group;
+	};
+
+	static void executeFunction(Job *job) {
+		FunctionJob *f = (FunctionJob*)job;
+		f->task();
+		f->group->pending.fetch_sub(1, std::memory_order_release);
+		delete f;
+	}
+
+	TaskGroup::TaskGroup() : pending(0) {
+	}
+
+	TaskGroup::~TaskGroup() {
+		wait();
+	}
+
+	void TaskGroup::run(std::function<void()> task) {
+		Scheduler &s = scheduler();
+		Deque *own = s.local();
+		if (own == nullptr) {
+			task();
+			return;
+		}
+		FunctionJob *job = new FunctionJob;
+		job->execute = executeFunction;
+		job->task = std::move(task);
+		job->group = this;
+		pending.fetch_add(1, std::memory_order_relaxed);
+		s.submit(own, job);
+	}
+
+	void TaskGroup::wait() {
+		Scheduler &s = scheduler();
+		s.helpUntil(s.local(), [&] { return pending.load(std::memory_order_acquire) == 0; });
+	}
+
+	int threadCount() {
+		return scheduler().active.load(std::memory_order_relaxed) + 1;
+	}
+
+	void setThreadCount(int count) {
+		Scheduler &s = scheduler();
+		s.setActive(count <= 0 || count > s.workers ? s.workers : count - 1);
+	}
+
+	void printStats() {
+		Scheduler &s = scheduler();
+		printf("Jobs: %d workers, %lld jobs run, %lld stolen\n", s.workers, s.executed.load(), s.stolen.load());
+	}
+}
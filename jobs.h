@@ -0,0 +1,55 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef JOBS_H
+#define JOBS_H
+
+//Work-stealing job scheduler.
+//One worker thread per extra hardware thread, each with a Chase-Lev deque:
+//the owner pushes and pops jobs at the bottom, idle threads steal from the top.
+//Any other thread that submits work (the main thread, a loader) gets a deque of
+//its own on first use, so it can be stolen from as well.
+//Waiting never blocks a thread: wait() and parallelFor() run queued jobs until
+//their own work is done, so jobs may spawn and wait for more jobs (continuations
+//without fibers).
+
+#include <atomic>
+#include <functional>
+
+namespace Jobs {
+
+	//Runs body(begin, end) on slices of [begin, end) of at least grain items.
+	//The range is split in halves lazily: a half is only handed out when another thread steals it.
+	void parallelFor(int begin, int end, int grain, const std::function<void(int, int)> &body);
+
+	//Tasks run in any order on any thread; wait() (also done by the destructor) helps until all of them finished
+	class TaskGroup {
+		public:
+			TaskGroup();
+			~TaskGroup();
+			void run(std::function<void()> task);
+			void wait();
+			std::atomic<int> pending;
+	};
+
+	int threadCount(); //Worker threads plus the calling thread
+	//Lets only count - 1 workers run jobs, the others wait until the limit is raised again.
+	//0 or less, or more than there are, allows all of them.
+	void setThreadCount(int count);
+	void printStats();
+}
+
+#endif
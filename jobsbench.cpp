@@ -0,0 +1,109 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//Microbenchmarks of the job system (jobs.h) from 1 thread up to all of them.
+//Usage: jobsbench [maxThreads]
+//For every thread count it prints:
+//spawn - time per empty TaskGroup task, submitted from one thread (allocation, push, steal or pop, run)
+//split - time per item of a parallelFor over empty items with grain 1 (one range job per item)
+//work, speedup - time of a fixed compute bound parallelFor and how much faster it is than on one thread
+//Every figure is the best of several runs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include "jobs.h"
+
+static const int runs = 5;
+static const int spawnTasks = 100000;
+static const int splitItems = 100000;
+static const int workItems = 4096;
+static const int workPerItem = 20000;
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double spawn() {
+	std::atomic<int> done(0);
+	auto start = std::chrono::steady_clock::now();
+	{
+		Jobs::TaskGroup group;
+		for (int i = 0; i < spawnTasks; i++) group.run([&done] { done.fetch_add(1, std::memory_order_relaxed); });
+		group.wait();
+	}
+	double time = seconds(start);
+	if (done.load() != spawnTasks) fprintf(stderr, "spawn: %d of %d tasks ran\n", done.load(), spawnTasks);
+	return time;
+}
+
+static double split() {
+	std::atomic<int> done(0);
+	auto start = std::chrono::steady_clock::now();
+	Jobs::parallelFor(0, splitItems, 1, [&done](int begin, int end) { done.fetch_add(end - begin, std::memory_order_relaxed); });
+	double time = seconds(start);
+	if (done.load() != splitItems) fprintf(stderr, "split: %d of %d items ran\n", done.load(), splitItems);
+	return time;
+}
+
+//Some floating point work per item that the compiler cannot drop, the result is checked against one thread
+static double work(double &result) {
+	static double sums[workItems];
+	auto start = std::chrono::steady_clock::now();
+	Jobs::parallelFor(0, workItems, 1, [](int begin, int end) {
+		for (int i = begin; i < end; i++) {
+			double x = i, sum = 0;
+			for (int k = 0; k < workPerItem; k++) {
+				x = x * 1.0000001 + 0.5;
+				sum += sqrt(x);
+			}
+			sums[i] = sum;
+		}
+	});
+	double time = seconds(start);
+	result = 0;
+	for (int i = 0; i < workItems; i++) result += sums[i];
+	return time;
+}
+
+int main(int argc, char **argv) {
+	Jobs::setThreadCount(0);
+	int maxThreads = Jobs::threadCount();
+	if (argc > 1) maxThreads = std::max(1, std::min(maxThreads, atoi(argv[1])));
+
+	printf("%7s %12s %12s %10s %8s %10s\n", "threads", "spawn ns", "split ns", "work ms", "speedup", "efficiency");
+	double single = 0, expected = 0;
+	for (int threads = 1; threads <= maxThreads; threads++) {
+		Jobs::setThreadCount(threads);
+		double spawnTime = 1e30, splitTime = 1e30, workTime = 1e30, result = 0;
+		for (int run = 0; run < runs; run++) {
+			spawnTime = std::min(spawnTime, spawn());
+			splitTime = std::min(splitTime, split());
+			workTime = std::min(workTime, work(result));
+		}
+		if (threads == 1) {
+			single = workTime;
+			expected = result;
+		} else if (result != expected) fprintf(stderr, "work: result differs on %d threads\n", threads);
+		printf("%7d %12.1f %12.1f %10.2f %8.2f %9.0f%%\n", threads, spawnTime * 1e9 / spawnTasks, splitTime * 1e9 / splitItems,
+			workTime * 1e3, single / workTime, single / workTime / threads * 100);
+	}
+	Jobs::printStats();
+	return 0;
+}
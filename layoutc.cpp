@@ -0,0 +1,35 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//Compiles a text gallery layout into a .layout file (see layoutfile.h).
+//Usage: layoutc input.txt output.layout
+
+#include "layoutfile.h"
+#include <stdio.h>
+
+int main(int argc, char** argv) {
+	if (argc != 3) {
+		fprintf(stderr, "usage: layoutc input.txt output.layout\n");
+		return 1;
+	}
+	if (!compileLayout(argv[1], argv[2])) return 1;
+
+	LayoutFile layout; //Read back what the gallery will load
+	if (!layout.open(argv[2])) return 1;
+	printf("%d textures, %d boxes, %d visitors, %d exhibits\n",
+		layout.textureCount(), layout.boxCount(), layout.visitorCount(), layout.exhibitCount());
+	return 0;
+}
@@ -0,0 +1,335 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#define GLM_FORCE_RADIANS
+
+#include "layoutfile.h"
+#include "transforms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+static_assert(sizeof(LayoutFileHeader) == 64, "LayoutFileHeader is part of the file format");
+static_assert(sizeof(LayoutTexture) == 16, "LayoutTexture is part of the file format");
+static_assert(sizeof(LayoutBox) == 96, "LayoutBox is part of the file format");
+static_assert(sizeof(LayoutVisitor) == 32, "LayoutVisitor is part of the file format");
+static_assert(sizeof(LayoutExhibit) == 16, "LayoutExhibit is part of the file format");
+
+bool LayoutFile::open(const char* path) {
+	if (!mapping.open(path)) return false;
+	if (!validate(path)) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+//Everything the loader will read has to lie inside the file
+bool LayoutFile::validate(const char* path) const {
+	uint64_t size = mapping.size();
+	if (size < sizeof(LayoutFileHeader) || memcmp(header().magic, layoutFileMagic, 4) != 0) {
+		fprintf(stderr, "%s: not a layout file\n", path);
+		return false;
+	}
+	if (header().version != layoutFileVersion) {
+		fprintf(stderr, "%s: layout file version %u, expected %u\n", path, header().version, layoutFileVersion);
+		return false;
+	}
+
+	const LayoutFileHeader& h = header();
+	uint64_t blocks[4][2] = {
+		{ h.textures, (uint64_t)h.textureCount * sizeof(LayoutTexture) }, { h.boxes, (uint64_t)h.boxCount * sizeof(LayoutBox) },
+		{ h.visitors, (uint64_t)h.visitorCount * sizeof(LayoutVisitor) }, { h.exhibits, (uint64_t)h.exhibitCount * sizeof(LayoutExhibit) }
+	};
+	for (int b = 0; b < 4; b++) {
+		if (blocks[b][0] % 16 != 0 || blocks[b][0] < sizeof(LayoutFileHeader) || blocks[b][0] > size || blocks[b][1] > size - blocks[b][0]) {
+			fprintf(stderr, "%s: bad block table\n", path);
+			return false;
+		}
+	}
+	for (int i = 0; i < textureCount(); i++) {
+		const LayoutTexture& t = textures()[i];
+		if (t.path >= size || t.length >= size - t.path || ((const char*)at(t.path))[t.length] != 0) {
+			fprintf(stderr, "%s: texture %d is corrupt\n", path, i);
+			return false;
+		}
+	}
+	for (int i = 0; i < boxCount(); i++) {
+		if (boxes()[i].texture >= h.textureCount || boxes()[i].kind > layoutPainting) {
+			fprintf(stderr, "%s: box %d is corrupt\n", path, i);
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//Compiler state while the text is read
+struct LayoutBuilder {
+	std::vector<std::string> paths;
+	std::map<std::string, int> names;
+	std::vector<LayoutBox> boxes;
+	std::vector<LayoutVisitor> visitors;
+	std::vector<LayoutExhibit> exhibits;
+	glm::mat4 frame = glm::mat4(1.0f);
+	std::vector<glm::mat4> saved; //Frames stored by push
+	std::vector<glm::mat4> frames; //Frames boxes were placed in, consecutive duplicates merged
+	TransformBatch locals; //Box i is frames[parent] * translate(center) * scale(halfSize), composed by finish()
+
+	static void setMatrix(LayoutBox& b, const glm::mat4& M) {
+		memcpy(b.M, &M[0][0], sizeof(b.M));
+		glm::vec3 center = glm::vec3(M[3]);
+		glm::vec3 extent = glm::abs(glm::vec3(M[0])) + glm::abs(glm::vec3(M[1])) + glm::abs(glm::vec3(M[2]));
+		for (int k = 0; k < 3; k++) {
+			b.boundsMin[k] = center[k] - extent[k];
+			b.boundsMax[k] = center[k] + extent[k];
+		}
+	}
+
+	//Matrices and bounds of all boxes, in one batch
+	void finish() {
+		std::vector<glm::mat4> M(boxes.size());
+		locals.compose(frames.data(), M.data());
+		for (size_t i = 0; i < boxes.size(); i++) setMatrix(boxes[i], M[i]);
+	}
+
+	//Texture rooms and corridors are built from
+	int surface(const char* name, const char*& problem) const {
+		std::map<std::string, int>::const_iterator it = names.find(name);
+		if (it != names.end()) return it->second;
+		if (problem == NULL) problem = "rooms and corridors need the textures wall, floor and ceiling";
+		return 0;
+	}
+
+	//Box with the given center and half size in the current frame
+	void place(glm::vec3 center, glm::vec3 halfSize, int texture, uint32_t kind) {
+		if (frames.empty() || frames.back() != frame) frames.push_back(frame);
+		locals.add((int)frames.size() - 1, center, halfSize);
+		LayoutBox b;
+		b.texture = (uint32_t)texture;
+		b.kind = kind;
+		boxes.push_back(b);
+	}
+
+	//One side of a room, along x for north and south, along z for east and west; doors leave a 0.8 wide gap in the middle
+	void roomSide(const std::string& side, const std::string& type, int wall) {
+		bool alongX = side == "north" || side == "south";
+		float across = side == "north" || side == "west" ? -2.0f : 2.0f;
+		glm::vec3 center = alongX ? glm::vec3(0.0f, 0.375f, across) : glm::vec3(across, 0.375f, 0.0f);
+		glm::vec3 along = alongX ? glm::vec3(1, 0, 0) : glm::vec3(0, 0, 1);
+		glm::vec3 thin = alongX ? glm::vec3(0, 0, 0.025f) : glm::vec3(0.025f, 0, 0);
+		if (type == "wall") place(center, thin + glm::vec3(0, 0.375f, 0) + along * 2.0f, wall, layoutWall);
+		else if (type == "door") {
+			place(center + along * 1.2f, thin + glm::vec3(0, 0.375f, 0) + along * 0.8f, wall, layoutWall);
+			place(center - along * 1.2f, thin + glm::vec3(0, 0.375f, 0) + along * 0.8f, wall, layoutWall);
+		}
+	}
+};
+
+static bool parseNumbers(const std::vector<std::string>& tokens, size_t first, size_t count, float* out) {
+	if (tokens.size() < first + count) return false;
+	for (size_t i = 0; i < count; i++) {
+		char* end;
+		out[i] = strtof(tokens[first + i].c_str(), &end);
+		if (*end != 0) return false;
+	}
+	return true;
+}
+
+static bool isSide(const std::string& s) {
+	return s == "north" || s == "south" || s == "east" || s == "west";
+}
+
+static bool readLayout(const char* path, LayoutBuilder& out) {
+	FILE* f = fopen(path, "r");
+	if (f == NULL) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return false;
+	}
+
+	char line[1024];
+	int lineNumber = 0;
+	bool ok = true;
+	while (ok && fgets(line, sizeof(line), f)) {
+		lineNumber++;
+		char* comment = strchr(line, '#');
+		if (comment != NULL) *comment = 0;
+		std::vector<std::string> t;
+		for (char* token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) t.push_back(token);
+		if (t.empty()) continue;
+
+		const char* problem = NULL;
+		float v[8];
+		auto texture = [&](const std::string& name) {
+			std::map<std::string, int>::const_iterator it = out.names.find(name);
+			if (it == out.names.end()) problem = "unknown texture";
+			return it == out.names.end() ? 0 : it->second;
+		};
+
+		if (t[0] == "texture") {
+			if (t.size() != 3) problem = "expected: texture name path";
+			else if (out.names.count(t[1])) problem = "texture declared twice";
+			else {
+				out.names[t[1]] = (int)out.paths.size();
+				out.paths.push_back(t[2]);
+			}
+		}
+		else if (t[0] == "translate") {
+			if (t.size() != 4 || !parseNumbers(t, 1, 3, v)) problem = "expected: translate x y z";
+			else out.frame = glm::translate(out.frame, glm::vec3(v[0], v[1], v[2]));
+		}
+		else if (t[0] == "rotate") {
+			if (t.size() != 5 || !parseNumbers(t, 1, 4, v) || (v[1] == 0 && v[2] == 0 && v[3] == 0)) problem = "expected: rotate degrees x y z";
+			else out.frame = glm::rotate(out.frame, glm::radians(v[0]), glm::vec3(v[1], v[2], v[3]));
+		}
+		else if (t[0] == "push") {
+			if (t.size() != 1) problem = "expected: push";
+			else out.saved.push_back(out.frame);
+		}
+		else if (t[0] == "pop") {
+			if (t.size() != 1 || out.saved.empty()) problem = "pop without push";
+			else {
+				out.frame = out.saved.back();
+				out.saved.pop_back();
+			}
+		}
+		else if (t[0] == "room") {
+			const char* sides[4] = { "north", "south", "east", "west" };
+			for (size_t i = 1; i < t.size(); i++) if (t[i] != "wall" && t[i] != "door" && t[i] != "open") problem = "room sides are wall, door or open";
+			if (t.size() != 5) problem = "expected: room north south east west";
+			int wall = out.surface("wall", problem), floor = out.surface("floor", problem), ceiling = out.surface("ceiling", problem);
+			if (problem == NULL) {
+				out.place(glm::vec3(0.0f), glm::vec3(2.0f, 0.025f, 2.0f), ceiling, layoutCeiling);
+				out.place(glm::vec3(0.0f, 0.75f, 0.0f), glm::vec3(2.0f, 0.025f, 2.0f), floor, layoutFloor);
+				for (int i = 0; i < 4; i++) out.roomSide(sides[i], t[i + 1], wall);
+			}
+		}
+		else if (t[0] == "corridor") {
+			if (t.size() != 1) problem = "expected: corridor";
+			int wall = out.surface("wall", problem), floor = out.surface("floor", problem), ceiling = out.surface("ceiling", problem);
+			if (problem == NULL) {
+				out.place(glm::vec3(0.0f), glm::vec3(1.0f, 0.025f, 0.45f), ceiling, layoutCeiling);
+				out.place(glm::vec3(0.0f, 0.75f, 0.0f), glm::vec3(1.0f, 0.025f, 0.45f), floor, layoutFloor);
+				out.place(glm::vec3(0.0f, 0.375f, 0.425f), glm::vec3(1.0f, 0.375f, 0.025f), wall, layoutWall);
+				out.place(glm::vec3(0.0f, 0.375f, -0.425f), glm::vec3(1.0f, 0.375f, 0.025f), wall, layoutWall);
+			}
+		}
+		else if (t[0] == "painting") {
+			v[1] = 0.36f;
+			if ((t.size() != 4 && t.size() != 5) || !isSide(t[2]) || !parseNumbers(t, 3, t.size() - 3, v)) problem = "expected: painting name north|south|east|west offset [height]";
+			int image = problem == NULL ? texture(t[1]) : 0;
+			if (problem == NULL) {
+				bool alongX = t[2] == "north" || t[2] == "south";
+				float across = t[2] == "north" || t[2] == "west" ? -1.98f : 1.98f;
+				out.place(alongX ? glm::vec3(v[0], v[1], across) : glm::vec3(across, v[1], v[0]),
+					alongX ? glm::vec3(0.18f, 0.18f, 0.02f) : glm::vec3(0.02f, 0.18f, 0.18f), image, layoutPainting);
+			}
+		}
+		else if (t[0] == "box") {
+			const char* kinds[4] = { "floor", "ceiling", "wall", "painting" };
+			int kind = -1;
+			for (int k = 0; k < 4; k++) if (t.size() > 1 && t[1] == kinds[k]) kind = k;
+			if (t.size() != 9 || kind < 0 || !parseNumbers(t, 3, 6, v)) problem = "expected: box floor|ceiling|wall|painting name sx sy sz x y z";
+			int image = problem == NULL ? texture(t[2]) : 0;
+			if (problem == NULL) out.place(glm::vec3(v[3], v[4], v[5]), glm::vec3(v[0], v[1], v[2]), image, (uint32_t)kind);
+		}
+		else if (t[0] == "visitor") {
+			if (t.size() != 8 || !parseNumbers(t, 1, 7, v)) problem = "expected: visitor x y z heading r g b";
+			else {
+				LayoutVisitor visitor = { { v[0], v[1], v[2] }, glm::radians(v[3]), { v[4], v[5], v[6] }, 0.0f };
+				out.visitors.push_back(visitor);
+			}
+		}
+		else if (t[0] == "exhibit") {
+			if (t.size() != 6 || t[1] != "teapot" || !parseNumbers(t, 2, 4, v)) problem = "expected: exhibit teapot x y z scale";
+			else {
+				LayoutExhibit exhibit = { { v[0], v[1], v[2] }, v[3] };
+				out.exhibits.push_back(exhibit);
+			}
+		}
+		else problem = "unknown statement";
+
+		if (problem != NULL) {
+			fprintf(stderr, "%s:%d: %s\n", path, lineNumber, problem);
+			ok = false;
+		}
+	}
+	fclose(f);
+	return ok;
+}
+
+static uint64_t alignOffset(uint64_t offset) {
+	return (offset + 15) / 16 * 16;
+}
+
+bool compileLayout(const char* textPath, const char* layoutPath) {
+	LayoutBuilder layout;
+	if (!readLayout(textPath, layout)) return false;
+	layout.finish();
+
+	LayoutFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, layoutFileMagic, 4);
+	header.version = layoutFileVersion;
+	header.textureCount = (uint32_t)layout.paths.size();
+	header.boxCount = (uint32_t)layout.boxes.size();
+	header.visitorCount = (uint32_t)layout.visitors.size();
+	header.exhibitCount = (uint32_t)layout.exhibits.size();
+
+	std::vector<LayoutTexture> textures(layout.paths.size());
+	std::string strings;
+	uint64_t offset = sizeof(LayoutFileHeader);
+	uint64_t* fields[4] = { &header.textures, &header.boxes, &header.visitors, &header.exhibits };
+	size_t sizes[4] = { textures.size() * sizeof(LayoutTexture), layout.boxes.size() * sizeof(LayoutBox),
+		layout.visitors.size() * sizeof(LayoutVisitor), layout.exhibits.size() * sizeof(LayoutExhibit) };
+	for (int b = 0; b < 4; b++) {
+		*fields[b] = offset;
+		offset = alignOffset(offset + sizes[b]);
+	}
+	for (size_t i = 0; i < textures.size(); i++) {
+		textures[i].path = offset + strings.size();
+		textures[i].length = (uint32_t)layout.paths[i].size();
+		textures[i].reserved = 0;
+		strings += layout.paths[i];
+		strings += '\0';
+	}
+
+	FILE* f = fopen(layoutPath, "wb");
+	if (f == NULL) {
+		fprintf(stderr, "%s: cannot create\n", layoutPath);
+		return false;
+	}
+	const void* sources[4] = { textures.data(), layout.boxes.data(), layout.visitors.data(), layout.exhibits.data() };
+	static const char zeros[16] = { 0 };
+	fwrite(&header, sizeof(header), 1, f);
+	uint64_t written = sizeof(header);
+	for (int b = 0; b < 4; b++) {
+		fwrite(sources[b], 1, sizes[b], f);
+		written += sizes[b];
+		fwrite(zeros, 1, (size_t)(alignOffset(written) - written), f);
+		written = alignOffset(written);
+	}
+	fwrite(strings.data(), 1, strings.size(), f);
+	bool ok = ferror(f) == 0;
+	if (fclose(f) != 0) ok = false;
+	if (!ok) fprintf(stderr, "%s: write failed\n", layoutPath);
+	return ok;
+}
@@ -0,0 +1,129 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef LAYOUTFILE_H
+#define LAYOUTFILE_H
+
+//Gallery layout: a text description (gallery.txt) compiled by layoutc into a
+//binary .layout file that is memory mapped at load time.
+//
+//Text format, one statement per line, # starts a comment:
+//  texture name path                   - declares a texture, rooms use the ones named wall, floor and ceiling
+//  translate x y z                     - moves the current frame, like glm::translate
+//  rotate degrees x y z                - rotates the current frame around an axis
+//  push, pop                           - saves and restores the current frame
+//  room north south east west          - 4x4 room centered in the frame, every side is wall, door or open
+//  corridor                            - 2 long (along x) and 0.9 wide passage between two room doors
+//  painting name side offset [height]  - painting on a wall of the room in the frame, height defaults to 0.36
+//  box kind name sx sy sz x y z        - any other [-1, 1] cube: frame * translate(x, y, z) * scale(sx, sy, sz),
+//                                        kind is floor, ceiling, wall or painting
+//  visitor x y z heading r g b         - world position, heading in degrees around y, color
+//  exhibit teapot x y z scale          - the Bezier teapot, world position
+//The frame starts as the identity. Rooms use the old gallery units: the floor
+//lies at y 0.75 of the frame, the ceiling at 0, so the frame is turned upside
+//down (rotate 180 0 0 1) before the first room.
+//
+//Binary layout, little endian:
+//LayoutFileHeader
+//blocks at the offsets in the header, each starting at a multiple of 16:
+//  LayoutTexture[textureCount], LayoutBox[boxCount], LayoutVisitor[visitorCount],
+//  LayoutExhibit[exhibitCount], NUL terminated texture paths
+//Boxes carry their world bounds, so one linear pass builds the draws, the
+//culling and collision boxes and the navigation grid input.
+
+#include <stdint.h>
+#include "mappedfile.h"
+
+const char layoutFileMagic[4] = { 'G', 'L', 'A', 'Y' };
+const uint32_t layoutFileVersion = 1;
+
+//What a box is for navigation: floors are walkable, walls and paintings block, paintings are also goals
+const uint32_t layoutFloor = 0;
+const uint32_t layoutCeiling = 1;
+const uint32_t layoutWall = 2;
+const uint32_t layoutPainting = 3;
+
+struct LayoutFileHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t textureCount;
+	uint32_t boxCount;
+	uint32_t visitorCount;
+	uint32_t exhibitCount;
+	uint32_t flags; //Reserved, 0
+	uint32_t reserved;
+	uint64_t textures; //Offsets of the blocks
+	uint64_t boxes;
+	uint64_t visitors;
+	uint64_t exhibits;
+};
+
+struct LayoutTexture {
+	uint64_t path; //Offset of the NUL terminated path
+	uint32_t length; //Without the NUL
+	uint32_t reserved;
+};
+
+struct LayoutBox {
+	float M[16]; //Column major, transforms the [-1, 1] cube
+	float boundsMin[3]; //World space bounding box
+	uint32_t texture;
+	float boundsMax[3];
+	uint32_t kind; //layoutFloor ... layoutPainting
+};
+
+struct LayoutVisitor {
+	float position[3];
+	float heading; //Radians around y
+	float color[3];
+	float phase; //Walk cycle offset
+};
+
+struct LayoutExhibit {
+	float position[3];
+	float scale;
+};
+
+//Read-only mapping of a .layout file, validated on open
+class LayoutFile {
+public:
+	bool open(const char* path); //Prints the reason and returns false on failure
+	void close() { mapping.close(); }
+	bool isOpen() const { return mapping.isOpen(); }
+
+	const LayoutFileHeader& header() const { return *(const LayoutFileHeader*)mapping.data(); }
+	int textureCount() const { return (int)header().textureCount; }
+	int boxCount() const { return (int)header().boxCount; }
+	int visitorCount() const { return (int)header().visitorCount; }
+	int exhibitCount() const { return (int)header().exhibitCount; }
+
+	const char* texturePath(int i) const { return (const char*)at(textures()[i].path); }
+	const LayoutBox* boxes() const { return (const LayoutBox*)at(header().boxes); }
+	const LayoutVisitor* visitors() const { return (const LayoutVisitor*)at(header().visitors); }
+	const LayoutExhibit* exhibits() const { return (const LayoutExhibit*)at(header().exhibits); }
+
+private:
+	MappedFile mapping;
+
+	const void* at(uint64_t offset) const { return mapping.data() + offset; }
+	const LayoutTexture* textures() const { return (const LayoutTexture*)at(header().textures); }
+	bool validate(const char* path) const;
+};
+
+//Parses a text layout and writes it as a .layout file. Errors are printed with their line.
+bool compileLayout(const char* textPath, const char* layoutPath);
+
+#endif
@@ -0,0 +1,95 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "lod.h"
+#include "sphere.h"
+#include "torus.h"
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+
+namespace Models {
+
+	LodChain::LodChain(float radius) {
+		this->radius = radius;
+		hysteresis = 0.15f;
+	}
+
+	void LodChain::add(Model *model, float minScreenSize) {
+		models.push_back(model);
+		minScreenSizes.push_back(minScreenSize);
+	}
+
+	void LodChain::clear() {
+		models.clear();
+		minScreenSizes.clear();
+	}
+
+	int LodChain::select(float screenSize, int current) const {
+		int last = levels() - 1;
+		if (current < 0 || current > last) {
+			current = 0;
+			while (current < last && screenSize < minScreenSizes[current]) current++;
+			return current;
+		}
+		while (current > 0 && screenSize >= minScreenSizes[current - 1] * (1.0f + hysteresis)) current--;
+		while (current < last && screenSize < minScreenSizes[current] * (1.0f - hysteresis)) current++;
+		return current;
+	}
+
+	void LodChain::printStats(const char* name) const {
+		printf("%s LOD:", name);
+		for (int i = 0; i < levels(); i++) {
+			int triangles = (models[i]->indexCount > 0 ? models[i]->indexCount : models[i]->vertexCount) / 3;
+			printf(" %d tris (>=%.0f px)", triangles, minScreenSizes[i]);
+		}
+		printf("\n");
+	}
+
+
+	float projectedSize(const mat4 &M, float radius, const vec3 &eye, float fovY, float viewportHeight) {
+		float scale = std::max(length(vec3(M[0])), std::max(length(vec3(M[1])), length(vec3(M[2]))));
+		float r = radius * scale;
+		float distance = std::max(length(vec3(M[3]) - eye), r);
+		return r * viewportHeight / (distance * tanf(fovY * 0.5f));
+	}
+
+
+	//Level 2 of the sphere and level 1 of the torus are the default models themselves
+	static Sphere sphere48(1, 48, 48), sphere24(1, 24, 24), sphere6(1, 6, 6);
+	static Torus torus40(0.75, 0.25, 40, 40), torus10(0.75, 0.25, 10, 10), torus6(0.75, 0.25, 6, 6);
+
+	static LodChain makeSphereLod() {
+		LodChain chain(1.0f);
+		chain.add(&sphere48, 300);
+		chain.add(&sphere24, 120);
+		chain.add(&sphere, 40);
+		chain.add(&sphere6, 0);
+		return chain;
+	}
+
+	static LodChain makeTorusLod() {
+		LodChain chain(1.0f);
+		chain.add(&torus40, 300);
+		chain.add(&torus, 100);
+		chain.add(&torus10, 30);
+		chain.add(&torus6, 0);
+		return chain;
+	}
+
+	LodChain sphereLod = makeSphereLod();
+	LodChain torusLod = makeTorusLod();
+	LodChain teapotLod(1.0f); //Filled from teapot.mesh by Teapot::load
+}
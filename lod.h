@@ -0,0 +1,59 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOD_H
+#define LOD_H
+
+//Levels of detail chosen by the projected size of the model on screen.
+//Level 0 is the finest one. Every level has the smallest on-screen diameter
+//(in pixels) it is used for; select() only moves to a neighbouring level
+//once the size has left that band by more than the hysteresis margin,
+//so models standing near a threshold do not flicker between levels.
+
+#include "mesh.h"
+
+namespace Models {
+
+	using namespace std;
+	using namespace glm;
+
+	class LodChain {
+		public:
+			LodChain(float radius);
+
+			void add(Model *model, float minScreenSize); //Add levels from the finest to the coarsest
+			void clear();
+			int select(float screenSize, int current) const; //current<0 picks without hysteresis
+			Model& level(int i) const { return *models[i]; }
+			int levels() const { return (int)models.size(); }
+			void printStats(const char* name) const;
+
+			float radius; //Bounding sphere radius in model space
+			float hysteresis; //Relative margin around the thresholds
+
+		private:
+			vector<Model*> models;
+			vector<float> minScreenSizes;
+	};
+
+	//On-screen diameter in pixels of a bounding sphere of the given model space radius placed by M
+	float projectedSize(const mat4 &M, float radius, const vec3 &eye, float fovY, float viewportHeight);
+
+	extern LodChain sphereLod;
+	extern LodChain torusLod;
+	extern LodChain teapotLod;
+}
+
+#endif
@@ -191,7 +191,6 @@ static void uivector_init(uivector* p)
   p->size = p->allocsize = 0;
 }
 
-#ifdef LODEPNG_COMPILE_ENCODER
 /*returns 1 if success, 0 if failure ==> nothing done*/
 static unsigned uivector_push_back(uivector* p, unsigned c)
 {
@@ -199,7 +198,6 @@ static unsigned uivector_push_back(uivector* p, unsigned c)
   p->data[p->size - 1] = c;
   return 1;
 }
-#endif /*LODEPNG_COMPILE_ENCODER*/
 #endif /*LODEPNG_COMPILE_ZLIB*/
 
 /* /////////////////////////////////////////////////////////////////////////// */
@@ -1196,17 +1194,17 @@ static unsigned inflateNoCompression(ucvector* out, const unsigned char* in, siz
   p = (*bp) / 8; /*byte position*/
 
   /*read LEN (2 bytes) and NLEN (2 bytes)*/
-  if(p + 4 >= inlength) return 52; /*error, bit pointer will jump past memory*/
+  if(p + 4 > inlength) return 52; /*error, bit pointer will jump past memory*/
   LEN = in[p] + 256u * in[p + 1]; p += 2;
   NLEN = in[p] + 256u * in[p + 1]; p += 2;
 
   /*check if 16-bit NLEN is really the one's complement of LEN*/
   if(LEN + NLEN != 65535) return 21; /*error: NLEN is not one's complement of LEN*/
 
-  if(!ucvector_resize(out, (*pos) + LEN)) return 83; /*alloc fail*/
-
   /*read the literal data: LEN bytes are now stored in the out buffer*/
   if(p + LEN > inlength) return 23; /*error: reading outside of in buffer*/
+
+  if(!ucvector_resize(out, (*pos) + LEN)) return 83; /*alloc fail*/
   for(n = 0; n < LEN; ++n) out->data[(*pos)++] = in[p++];
 
   (*bp) = p * 8;
@@ -1214,19 +1212,20 @@ static unsigned inflateNoCompression(ucvector* out, const unsigned char* in, siz
   return error;
 }
 
-static unsigned lodepng_inflatev(ucvector* out,
-                                 const unsigned char* in, size_t insize,
-                                 const LodePNGDecompressSettings* settings)
+/*Inflates the blocks from byte start on, until the final block or, if stop is not 0, until
+the block that ends exactly at byte stop (a restart point). Matches may not reach before start.
+With a stop, no block may read past it, so a wrong guess of a restart point fails within its
+own bytes instead of running on through the rest of the stream.*/
+static unsigned inflateBlocks(ucvector* out, const unsigned char* in, size_t insize, size_t start, size_t stop)
 {
   /*bit pointer in the "in" data, current byte is bp >> 3, current bit is bp & 0x7 (from lsb to msb of the byte)*/
-  size_t bp = 0;
+  size_t bp = start * 8;
   unsigned BFINAL = 0;
   size_t pos = 0; /*byte position in the out buffer*/
   unsigned error = 0;
 
-  (void)settings;
-
-  while(!BFINAL)
+  if(stop != 0) insize = stop;
+  while(!BFINAL && (stop == 0 || bp < stop * 8))
   {
     unsigned BTYPE;
     if(bp + 2 >= insize * 8) return 52; /*error, bit pointer will jump past memory*/
@@ -1241,9 +1240,18 @@ static unsigned lodepng_inflatev(ucvector* out,
     if(error) return error;
   }
 
+  if(stop != 0 && (BFINAL || bp != stop * 8)) return 95; /*error: not a restart point*/
   return error;
 }
 
+static unsigned lodepng_inflatev(ucvector* out,
+                                 const unsigned char* in, size_t insize,
+                                 const LodePNGDecompressSettings* settings)
+{
+  (void)settings;
+  return inflateBlocks(out, in, insize, 0, 0);
+}
+
 unsigned lodepng_inflate(unsigned char** out, size_t* outsize,
                          const unsigned char* in, size_t insize,
                          const LodePNGDecompressSettings* settings)
@@ -1323,48 +1331,52 @@ static void addLengthDistance(uivector* values, size_t length, size_t distance)
   uivector_push_back(values, extra_distance);
 }
 
-/*3 bytes of data get encoded into two bytes. The hash cannot use more than 3
-bytes as input because 3 is the minimum match length for deflate*/
+/*Match finder: positions are chained by a hash of their first 4 bytes, and the
+most recent position per 3 byte hash is kept for the short matches the chains
+do not see. The chains hold absolute positions so an entry that went out of the
+window is recognized by its distance. Positions starting a run of 3 or more
+zeros, which dominate filtered PNG data, are kept out of the hash chains and
+chained by the length of their run instead; a search there starts with the run
+itself at distance 1 and only compares the bytes after the run.*/
+static const unsigned HASH_BITS = 16;
 static const unsigned HASH_NUM_VALUES = 65536;
-static const unsigned HASH_BIT_MASK = 65535; /*HASH_NUM_VALUES - 1, but C90 does not like that as initializer*/
 
 typedef struct Hash
 {
-  int* head; /*hash value to head circular pos - can be outdated if went around window*/
-  /*circular pos to prev circular pos*/
-  unsigned short* chain;
-  int* val; /*circular pos to hash value*/
-
-  /*TODO: do this not only for zeros but for any repeated byte. However for PNG
-  it's always going to be the zeros that dominate, so not important for PNG*/
-  int* headz; /*similar to head, but for chainz*/
-  unsigned short* chainz; /*those with same amount of zeros*/
-  unsigned short* zeros; /*length of zeros streak, used as a second hash chain*/
+  int* head; /*4 byte hash value to most recent position, -1 if none*/
+  int* prev; /*pos & (windowsize - 1) to the previous position with the same hash*/
+  int* head3; /*3 byte hash value to most recent position, -1 if none*/
+  int prev3; /*what head3 held for the last chained position before it*/
+  int* headz; /*zero run length to most recent position starting such a run*/
+  int* prevz; /*pos & (windowsize - 1) to the previous position with the same run length*/
+  unsigned mask; /*windowsize - 1*/
 } Hash;
 
-static unsigned hash_init(Hash* hash, unsigned windowsize)
+/*forgets all positions, at a restart point of the stream*/
+static void hash_reset(Hash* hash)
 {
   unsigned i;
-  hash->head = (int*)lodepng_malloc(sizeof(int) * HASH_NUM_VALUES);
-  hash->val = (int*)lodepng_malloc(sizeof(int) * windowsize);
-  hash->chain = (unsigned short*)lodepng_malloc(sizeof(unsigned short) * windowsize);
+  for(i = 0; i != HASH_NUM_VALUES; ++i) hash->head[i] = hash->head3[i] = -1;
+  for(i = 0; i <= MAX_SUPPORTED_DEFLATE_LENGTH; ++i) hash->headz[i] = -1;
+  hash->prev3 = -1;
+}
 
-  hash->zeros = (unsigned short*)lodepng_malloc(sizeof(unsigned short) * windowsize);
+static unsigned hash_init(Hash* hash, unsigned windowsize)
+{
+  hash->head = (int*)lodepng_malloc(sizeof(int) * HASH_NUM_VALUES);
+  hash->prev = (int*)lodepng_malloc(sizeof(int) * windowsize);
+  hash->head3 = (int*)lodepng_malloc(sizeof(int) * HASH_NUM_VALUES);
   hash->headz = (int*)lodepng_malloc(sizeof(int) * (MAX_SUPPORTED_DEFLATE_LENGTH + 1));
-  hash->chainz = (unsigned short*)lodepng_malloc(sizeof(unsigned short) * windowsize);
+  hash->prevz = (int*)lodepng_malloc(sizeof(int) * windowsize);
+  hash->mask = windowsize - 1;
 
-  if(!hash->head || !hash->chain || !hash->val  || !hash->headz|| !hash->chainz || !hash->zeros)
+  if(!hash->head || !hash->prev || !hash->head3 || !hash->headz || !hash->prevz)
   {
     return 83; /*alloc fail*/
   }
 
-  /*initialize hash table*/
-  for(i = 0; i != HASH_NUM_VALUES; ++i) hash->head[i] = -1;
-  for(i = 0; i != windowsize; ++i) hash->val[i] = -1;
-  for(i = 0; i != windowsize; ++i) hash->chain[i] = i; /*same value as index indicates uninitialized*/
-
-  for(i = 0; i <= MAX_SUPPORTED_DEFLATE_LENGTH; ++i) hash->headz[i] = -1;
-  for(i = 0; i != windowsize; ++i) hash->chainz[i] = i; /*same value as index indicates uninitialized*/
+  /*initialize hash table, prev entries are only read after they were written*/
+  hash_reset(hash);
 
   return 0;
 }
@@ -1372,35 +1384,23 @@ static unsigned hash_init(Hash* hash, unsigned windowsize)
 static void hash_cleanup(Hash* hash)
 {
   lodepng_free(hash->head);
-  lodepng_free(hash->val);
-  lodepng_free(hash->chain);
-
-  lodepng_free(hash->zeros);
+  lodepng_free(hash->prev);
+  lodepng_free(hash->head3);
   lodepng_free(hash->headz);
-  lodepng_free(hash->chainz);
+  lodepng_free(hash->prevz);
 }
 
+/*multiplicative hashes of the 3 or 4 bytes at data*/
+static unsigned getHash3(const unsigned char* data)
+{
+  unsigned value = (unsigned)data[0] | ((unsigned)data[1] << 8u) | ((unsigned)data[2] << 16u);
+  return (value * 2654435761u) >> (32u - HASH_BITS);
+}
 
-
-static unsigned getHash(const unsigned char* data, size_t size, size_t pos)
+static unsigned getHash4(const unsigned char* data)
 {
-  unsigned result = 0;
-  if(pos + 2 < size)
-  {
-    /*A simple shift and xor hash is used. Since the data of PNGs is dominated
-    by zeroes due to the filters, a better hash does not have a significant
-    effect on speed in traversing the chain, and causes more time spend on
-    calculating the hash.*/
-    result ^= (unsigned)(data[pos + 0] << 0u);
-    result ^= (unsigned)(data[pos + 1] << 4u);
-    result ^= (unsigned)(data[pos + 2] << 8u);
-  } else {
-    size_t amount, i;
-    if(pos >= size) return 0;
-    amount = size - pos;
-    for(i = 0; i != amount; ++i) result ^= (unsigned)(data[pos + i] << (i * 8u));
-  }
-  return result & HASH_BIT_MASK;
+  unsigned value = (unsigned)data[0] | ((unsigned)data[1] << 8u) | ((unsigned)data[2] << 16u) | ((unsigned)data[3] << 24u);
+  return (value * 2654435761u) >> (32u - HASH_BITS);
 }
 
 static unsigned countZeros(const unsigned char* data, size_t size, size_t pos)
@@ -1414,18 +1414,146 @@ static unsigned countZeros(const unsigned char* data, size_t size, size_t pos)
   return (unsigned)(data - start);
 }
 
-/*wpos = pos & (windowsize - 1)*/
-static void updateHashChain(Hash* hash, size_t wpos, unsigned hashval, unsigned short numzeros)
+/*Chains position pos. Positions must be inserted in order, numzeros carries the
+zero run length of the previous position and is updated for this one.*/
+static void updateHashChain(Hash* hash, const unsigned char* in, size_t insize, size_t pos, unsigned* numzeros)
 {
-  hash->val[wpos] = (int)hashval;
-  if(hash->head[hashval] != -1) hash->chain[wpos] = hash->head[hashval];
-  hash->head[hashval] = wpos;
+  size_t wpos = pos & hash->mask;
+  unsigned hashval;
+  if(pos + 3 > insize) return; /*too close to the end to start a match*/
+  if(in[pos] == 0 && in[pos + 1] == 0 && in[pos + 2] == 0)
+  {
+    if(*numzeros == 0) *numzeros = countZeros(in, insize, pos);
+    else if(pos + *numzeros > insize || in[pos + *numzeros - 1] != 0) --*numzeros;
+    hash->prevz[wpos] = hash->headz[*numzeros];
+    hash->headz[*numzeros] = (int)pos;
+    return;
+  }
+  *numzeros = 0;
+  hashval = getHash3(&in[pos]);
+  hash->prev3 = hash->head3[hashval];
+  hash->head3[hashval] = (int)pos;
+  if(pos + 4 <= insize)
+  {
+    hashval = getHash4(&in[pos]);
+    hash->prev[wpos] = hash->head[hashval];
+    hash->head[hashval] = (int)pos;
+  }
+}
 
-  hash->zeros[wpos] = numzeros;
-  if(hash->headz[numzeros] != -1) hash->chainz[wpos] = hash->headz[numzeros];
-  hash->headz[numzeros] = wpos;
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define LODEPNG_WORD_MATCH
+static unsigned lodepng_ctz64(unsigned long long x) { return (unsigned)__builtin_ctzll(x); }
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#define LODEPNG_WORD_MATCH
+static unsigned lodepng_ctz64(unsigned long long x) { unsigned long i; _BitScanForward64(&i, x); return (unsigned)i; }
+#endif
+
+/*Length of the common prefix of a and b, b stops at end. Compares 8 bytes at a
+time on little endian targets: the lowest differing bit gives the first differing byte.*/
+static unsigned matchLength(const unsigned char* a, const unsigned char* b, const unsigned char* end)
+{
+  const unsigned char* start = b;
+#ifdef LODEPNG_WORD_MATCH
+  while(end - b >= 8)
+  {
+    unsigned long long x, y;
+    memcpy(&x, a, 8);
+    memcpy(&y, b, 8);
+    if(x != y) return (unsigned)(b - start) + (lodepng_ctz64(x ^ y) >> 3u);
+    a += 8;
+    b += 8;
+  }
+#endif
+  while(b != end && *a == *b)
+  {
+    ++a;
+    ++b;
+  }
+  return (unsigned)(b - start);
 }
 
+/*Longest match for pos (already chained) among at most maxchain earlier
+positions closer than windowsize, stops early at nicematch*/
+static void findMatch(const Hash* hash, const unsigned char* in, size_t insize, size_t pos, unsigned numzeros,
+                      unsigned windowsize, unsigned maxchain, unsigned nicematch, unsigned* length, unsigned* offset)
+{
+  const unsigned char* end = &in[insize < pos + MAX_SUPPORTED_DEFLATE_LENGTH ? insize : pos + MAX_SUPPORTED_DEFLATE_LENGTH];
+  const unsigned char* current = &in[pos];
+  unsigned best = 2, bestoffset = 0, skip = 0; /*only matches of 3 or more count*/
+  const int* chain = hash->prev;
+  int candidate, next;
+  *length = 0;
+  *offset = 0;
+  if(end - current < 3) return;
+
+  if(numzeros >= 3)
+  {
+    /*the run continues the zero before it, other runs of the same length may be followed by more matching bytes*/
+    if(pos > 0 && in[pos - 1] == 0)
+    {
+      best = numzeros;
+      bestoffset = 1;
+    }
+    skip = numzeros;
+    chain = hash->prevz;
+  }
+  else
+  {
+    /*the chains only hold 4 byte matches, a 3 byte one can only come from the most recent position*/
+    candidate = hash->prev3;
+    if(candidate >= 0 && pos - (size_t)candidate < windowsize
+       && in[candidate] == current[0] && in[candidate + 1] == current[1] && in[candidate + 2] == current[2])
+    {
+      best = 3;
+      bestoffset = (unsigned)(pos - (size_t)candidate);
+    }
+    if(end - current < 4) maxchain = 0;
+  }
+
+  candidate = chain[pos & hash->mask];
+  while(candidate >= 0 && best < nicematch && maxchain-- > 0)
+  {
+    size_t distance = pos - (size_t)candidate;
+    if(distance >= windowsize) break;
+    /*a longer match has to agree on the last byte of the best one so far and the byte after it*/
+    if(current + best >= end) break;
+    if(in[candidate + best] == current[best] && in[candidate + best - 1] == current[best - 1])
+    {
+      unsigned current_length = skip + matchLength(&in[candidate + skip], current + skip, end);
+      if(current_length > best)
+      {
+        best = current_length;
+        bestoffset = (unsigned)distance;
+      }
+    }
+    next = chain[candidate & hash->mask];
+    if(next >= candidate) break; /*the slot was reused by a newer position*/
+    candidate = next;
+  }
+
+  if(bestoffset == 0) return;
+  *length = best;
+  *offset = bestoffset;
+}
+
+/*match finder effort per level: chain length, match length from which only a
+quarter of the chain is searched, longest match that still waits for a better
+one at the next byte (0: greedy), match length that ends the search*/
+static const unsigned LZ77_LEVELS[10][4] = {
+  {0, 0, 0, 0}, /*0: from windowsize, nicematch and lazymatching*/
+  {4, 4, 0, 8},
+  {8, 4, 0, 16},
+  {32, 4, 0, 32},
+  {16, 4, 4, 16},
+  {32, 8, 16, 32},
+  {128, 8, 16, 128},
+  {256, 8, 32, 128},
+  {1024, 32, 128, 258},
+  {4096, 32, 258, 258}
+};
+
 /*
 LZ77-encode the data. Return value is error code. The input are raw bytes, the output
 is in the form of unsigned integers with codes representing for example literal bytes, or
@@ -1434,181 +1562,93 @@ It uses a hash table technique to let it encode faster. When doing LZ77 encoding
 sliding window (of windowsize) is used, and all past bytes in that window can be used as
 the "dictionary". A brute force search through all possible distances would be slow, and
 this hash technique is one out of several ways to speed this up.
+With lazy matching a match is only taken if the next byte does not start a longer one.
 */
 static unsigned encodeLZ77(uivector* out, Hash* hash,
                            const unsigned char* in, size_t inpos, size_t insize, unsigned windowsize,
-                           unsigned minmatch, unsigned nicematch, unsigned lazymatching)
+                           unsigned minmatch, unsigned nicematch, unsigned lazymatching, unsigned level)
 {
-  size_t pos;
-  unsigned i, error = 0;
-  /*for large window lengths, assume the user wants no compression loss. Otherwise, max hash chain length speedup.*/
-  unsigned maxchainlength = windowsize >= 8192 ? windowsize : windowsize / 8;
-  unsigned maxlazymatch = windowsize >= 8192 ? MAX_SUPPORTED_DEFLATE_LENGTH : 64;
-
-  unsigned usezeros = 1; /*not sure if setting it to false for windowsize < 8192 is better or worse*/
+  size_t pos, i;
+  unsigned error = 0;
+  unsigned maxchain, goodlength, maxlazy;
   unsigned numzeros = 0;
-
-  unsigned offset; /*the offset represents the distance in LZ77 terminology*/
-  unsigned length;
-  unsigned lazy = 0;
-  unsigned lazylength = 0, lazyoffset = 0;
-  unsigned hashval;
-  unsigned current_offset, current_length;
-  unsigned prev_offset;
-  const unsigned char *lastptr, *foreptr, *backptr;
-  unsigned hashpos;
+  unsigned length, offset;
+  unsigned prevlength = 0, prevoffset = 0; /*match at pos - 1 waiting for the lazy check*/
+  unsigned pending = 0; /*whether pos - 1 is still to be encoded*/
 
   if(windowsize == 0 || windowsize > 32768) return 60; /*error: windowsize smaller/larger than allowed*/
   if((windowsize & (windowsize - 1)) != 0) return 90; /*error: must be power of two*/
 
+  if(level == 0)
+  {
+    /*for large window lengths, assume the user wants no compression loss. Otherwise, max hash chain length speedup.*/
+    maxchain = windowsize >= 8192 ? windowsize : windowsize / 8;
+    goodlength = MAX_SUPPORTED_DEFLATE_LENGTH;
+    maxlazy = lazymatching ? (windowsize >= 8192 ? MAX_SUPPORTED_DEFLATE_LENGTH : 64) : 0;
+  }
+  else
+  {
+    if(level > 9) level = 9;
+    maxchain = LZ77_LEVELS[level][0];
+    goodlength = LZ77_LEVELS[level][1];
+    maxlazy = LZ77_LEVELS[level][2];
+    nicematch = LZ77_LEVELS[level][3];
+  }
   if(nicematch > MAX_SUPPORTED_DEFLATE_LENGTH) nicematch = MAX_SUPPORTED_DEFLATE_LENGTH;
+  if(minmatch < 3) minmatch = 3;
 
   for(pos = inpos; pos < insize; ++pos)
   {
-    size_t wpos = pos & (windowsize - 1); /*position for in 'circular' hash buffers*/
-    unsigned chainlength = 0;
+    updateHashChain(hash, in, insize, pos, &numzeros);
 
-    hashval = getHash(in, insize, pos);
-
-    if(usezeros && hashval == 0)
-    {
-      if(numzeros == 0) numzeros = countZeros(in, insize, pos);
-      else if(pos + numzeros > insize || in[pos + numzeros - 1] != 0) --numzeros;
-    }
-    else
-    {
-      numzeros = 0;
-    }
-
-    updateHashChain(hash, wpos, hashval, numzeros);
-
-    /*the length and offset found for the current position*/
     length = 0;
     offset = 0;
-
-    hashpos = hash->chain[wpos];
-
-    lastptr = &in[insize < pos + MAX_SUPPORTED_DEFLATE_LENGTH ? insize : pos + MAX_SUPPORTED_DEFLATE_LENGTH];
-
-    /*search for the longest string*/
-    prev_offset = 0;
-    for(;;)
+    if(!pending || prevlength < maxlazy)
     {
-      if(chainlength++ >= maxchainlength) break;
-      current_offset = hashpos <= wpos ? wpos - hashpos : wpos - hashpos + windowsize;
-
-      if(current_offset < prev_offset) break; /*stop when went completely around the circular buffer*/
-      prev_offset = current_offset;
-      if(current_offset > 0)
-      {
-        /*test the next characters*/
-        foreptr = &in[pos];
-        backptr = &in[pos - current_offset];
-
-        /*common case in PNGs is lots of zeros. Quickly skip over them as a speedup*/
-        if(numzeros >= 3)
-        {
-          unsigned skip = hash->zeros[hashpos];
-          if(skip > numzeros) skip = numzeros;
-          backptr += skip;
-          foreptr += skip;
-        }
-
-        while(foreptr != lastptr && *backptr == *foreptr) /*maximum supported length by deflate is max length*/
-        {
-          ++backptr;
-          ++foreptr;
-        }
-        current_length = (unsigned)(foreptr - &in[pos]);
-
-        if(current_length > length)
-        {
-          length = current_length; /*the longest length*/
-          offset = current_offset; /*the offset that is related to this longest length*/
-          /*jump out once a length of max length is found (speed gain). This also jumps
-          out if length is MAX_SUPPORTED_DEFLATE_LENGTH*/
-          if(current_length >= nicematch) break;
-        }
-      }
-
-      if(hashpos == hash->chain[hashpos]) break;
-
-      if(numzeros >= 3 && length > numzeros)
-      {
-        hashpos = hash->chainz[hashpos];
-        if(hash->zeros[hashpos] != numzeros) break;
-      }
-      else
-      {
-        hashpos = hash->chain[hashpos];
-        /*outdated hash value, happens if particular value was not encountered in whole last window*/
-        if(hash->val[hashpos] != (int)hashval) break;
-      }
+      findMatch(hash, in, insize, pos, numzeros, windowsize, pending && prevlength >= goodlength ? maxchain / 4 + 1 : maxchain,
+                nicematch, &length, &offset);
+      /*compensate for the fact that longer offsets have more extra bits, a
+      length of only 3 may be not worth it then*/
+      if(length < minmatch || (length == 3 && offset > 4096)) length = 0;
     }
 
-    if(lazymatching)
+    if(pending && prevlength >= 3 && length <= prevlength)
     {
-      if(!lazy && length >= 3 && length <= maxlazymatch && length < MAX_SUPPORTED_DEFLATE_LENGTH)
-      {
-        lazy = 1;
-        lazylength = length;
-        lazyoffset = offset;
-        continue; /*try the next byte*/
-      }
-      if(lazy)
-      {
-        lazy = 0;
-        if(pos == 0) ERROR_BREAK(81);
-        if(length > lazylength + 1)
-        {
-          /*push the previous character as literal*/
-          if(!uivector_push_back(out, in[pos - 1])) ERROR_BREAK(83 /*alloc fail*/);
-        }
-        else
-        {
-          length = lazylength;
-          offset = lazyoffset;
-          hash->head[hashval] = -1; /*the same hashchain update will be done, this ensures no wrong alteration*/
-          hash->headz[numzeros] = -1; /*idem*/
-          --pos;
-        }
-      }
+      /*the match at pos - 1 wins, chain the positions it covers*/
+      addLengthDistance(out, prevlength, prevoffset);
+      for(i = pos + 1; i < pos - 1 + prevlength; ++i) updateHashChain(hash, in, insize, i, &numzeros);
+      pos += prevlength - 2;
+      pending = 0;
+      continue;
     }
-    if(length >= 3 && offset > windowsize) ERROR_BREAK(86 /*too big (or overflown negative) offset*/);
+    if(pending && !uivector_push_back(out, in[pos - 1])) ERROR_BREAK(83 /*alloc fail*/);
 
-    /*encode it as length/distance pair or literal value*/
-    if(length < 3) /*only lengths of 3 or higher are supported as length/distance pair*/
-    {
-      if(!uivector_push_back(out, in[pos])) ERROR_BREAK(83 /*alloc fail*/);
-    }
-    else if(length < minmatch || (length == 3 && offset > 4096))
+    if(maxlazy > 0 && length < MAX_SUPPORTED_DEFLATE_LENGTH)
     {
-      /*compensate for the fact that longer offsets have more extra bits, a
-      length of only 3 may be not worth it then*/
-      if(!uivector_push_back(out, in[pos])) ERROR_BREAK(83 /*alloc fail*/);
+      /*wait whether the next byte starts a longer match*/
+      pending = 1;
+      prevlength = length;
+      prevoffset = offset;
     }
     else
     {
-      addLengthDistance(out, length, offset);
-      for(i = 1; i < length; ++i)
+      pending = 0;
+      if(length >= 3)
       {
-        ++pos;
-        wpos = pos & (windowsize - 1);
-        hashval = getHash(in, insize, pos);
-        if(usezeros && hashval == 0)
-        {
-          if(numzeros == 0) numzeros = countZeros(in, insize, pos);
-          else if(pos + numzeros > insize || in[pos + numzeros - 1] != 0) --numzeros;
-        }
-        else
-        {
-          numzeros = 0;
-        }
-        updateHashChain(hash, wpos, hashval, numzeros);
+        addLengthDistance(out, length, offset);
+        for(i = pos + 1; i < pos + length; ++i) updateHashChain(hash, in, insize, i, &numzeros);
+        pos += length - 1;
       }
+      else if(!uivector_push_back(out, in[pos])) ERROR_BREAK(83 /*alloc fail*/);
     }
   } /*end of the loop through each character of input*/
 
+  if(!error && pending)
+  {
+    if(prevlength >= 3) addLengthDistance(out, prevlength, prevoffset);
+    else if(!uivector_push_back(out, in[insize - 1])) error = 83; /*alloc fail*/
+  }
+
   return error;
 }
 
@@ -1747,7 +1787,7 @@ static unsigned deflateDynamic(ucvector* out, size_t* bp, Hash* hash,
     if(settings->use_lz77)
     {
       error = encodeLZ77(&lz77_encoded, hash, data, datapos, dataend, settings->windowsize,
-                         settings->minmatch, settings->nicematch, settings->lazymatching);
+                         settings->minmatch, settings->nicematch, settings->lazymatching, settings->level);
       if(error) break;
     }
     else
@@ -1957,7 +1997,7 @@ static unsigned deflateFixed(ucvector* out, size_t* bp, Hash* hash,
     uivector lz77_encoded;
     uivector_init(&lz77_encoded);
     error = encodeLZ77(&lz77_encoded, hash, data, datapos, dataend, settings->windowsize,
-                       settings->minmatch, settings->nicematch, settings->lazymatching);
+                       settings->minmatch, settings->nicematch, settings->lazymatching, settings->level);
     if(!error) writeLZ77data(bp, out, &lz77_encoded, &tree_ll, &tree_d);
     uivector_cleanup(&lz77_encoded);
   }
@@ -1978,11 +2018,25 @@ static unsigned deflateFixed(ucvector* out, size_t* bp, Hash* hash,
   return error;
 }
 
+/*an empty stored block: the decoder finds the next block at a byte boundary right after
+the bytes 00 00 FF FF, which together with no matches across it makes a restart point*/
+static void addRestartPoint(ucvector* out, size_t* bp)
+{
+  addBitToStream(bp, out, 0); /*BFINAL*/
+  addBitsToStream(bp, out, 0, 2); /*BTYPE 00*/
+  *bp = (*bp + 7) & ~(size_t)7; /*the rest of the byte is padding*/
+  ucvector_push_back(out, 0);
+  ucvector_push_back(out, 0);
+  ucvector_push_back(out, 255);
+  ucvector_push_back(out, 255);
+  *bp += 32;
+}
+
 static unsigned lodepng_deflatev(ucvector* out, const unsigned char* in, size_t insize,
                                  const LodePNGCompressSettings* settings)
 {
   unsigned error = 0;
-  size_t i, blocksize, numdeflateblocks;
+  size_t i, blocksize, numdeflateblocks, segmentstart = 0;
   size_t bp = 0; /*the bit pointer*/
   Hash hash;
 
@@ -1997,22 +2051,40 @@ static unsigned lodepng_deflatev(ucvector* out, const unsigned char* in, size_t
     if(blocksize > 262144) blocksize = 262144;
   }
 
-  numdeflateblocks = (insize + blocksize - 1) / blocksize;
-  if(numdeflateblocks == 0) numdeflateblocks = 1;
-
   error = hash_init(&hash, settings->windowsize);
   if(error) return error;
 
-  for(i = 0; i != numdeflateblocks && !error; ++i)
+  /*blocks do not cross restart points*/
+  do
   {
-    unsigned final = (i == numdeflateblocks - 1);
-    size_t start = i * blocksize;
-    size_t end = start + blocksize;
-    if(end > insize) end = insize;
+    size_t segmentend = insize;
+    if(settings->restart_interval && insize - segmentstart > settings->restart_interval)
+    {
+      segmentend = segmentstart + settings->restart_interval;
+    }
+
+    numdeflateblocks = (segmentend - segmentstart + blocksize - 1) / blocksize;
+    if(numdeflateblocks == 0) numdeflateblocks = 1;
 
-    if(settings->btype == 1) error = deflateFixed(out, &bp, &hash, in, start, end, settings, final);
-    else if(settings->btype == 2) error = deflateDynamic(out, &bp, &hash, in, start, end, settings, final);
+    for(i = 0; i != numdeflateblocks && !error; ++i)
+    {
+      unsigned final = (segmentend == insize && i == numdeflateblocks - 1);
+      size_t start = segmentstart + i * blocksize;
+      size_t end = start + blocksize;
+      if(end > segmentend) end = segmentend;
+
+      if(settings->btype == 1) error = deflateFixed(out, &bp, &hash, in, start, end, settings, final);
+      else if(settings->btype == 2) error = deflateDynamic(out, &bp, &hash, in, start, end, settings, final);
+    }
+
+    if(!error && segmentend != insize)
+    {
+      addRestartPoint(out, &bp);
+      hash_reset(&hash);
+    }
+    segmentstart = segmentend;
   }
+  while(!error && segmentstart != insize);
 
   hash_cleanup(&hash);
 
@@ -2087,10 +2159,136 @@ static unsigned adler32(const unsigned char* data, unsigned len)
 
 #ifdef LODEPNG_COMPILE_DECODER
 
-unsigned lodepng_zlib_decompress(unsigned char** out, size_t* outsize, const unsigned char* in,
-                                 size_t insize, const LodePNGDecompressSettings* settings)
+/*Adler32 of the concatenation of two byte ranges, from their checksums and the length of the second*/
+static unsigned adler32_combine(unsigned adler1, unsigned adler2, size_t len2)
+{
+  const unsigned base = 65521;
+  unsigned rem = (unsigned)(len2 % base);
+  unsigned s1 = adler1 & 0xffff;
+  unsigned s2 = (rem * s1) % base;
+  s1 += (adler2 & 0xffff) + base - 1;
+  s2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + base - rem;
+  if(s1 >= base) s1 -= base;
+  if(s1 >= base) s1 -= base;
+  if(s2 >= (base << 1)) s2 -= (base << 1);
+  if(s2 >= base) s2 -= base;
+  return (s2 << 16) | s1;
+}
+
+/*Restart points closer than this to the previous segment start are not split at. It bounds the
+number of segments, so the bytes 00 00 FF FF repeating by chance (in stored blocks, say) cannot
+make many tasks that each fail after inflating their part.*/
+static const size_t MIN_INFLATE_SEGMENT = 8192;
+
+/*A part of a deflate stream between two restart points, inflated on its own*/
+typedef struct InflateSegment
+{
+  size_t start; /*first byte in the deflate data*/
+  size_t stop; /*byte where the next segment starts, 0 for the last one*/
+  size_t outpos; /*position of its data in the whole inflated stream*/
+  ucvector out;
+  unsigned adler;
+  unsigned error;
+} InflateSegment;
+
+typedef struct InflateSegments
+{
+  const unsigned char* in; /*deflate data*/
+  size_t insize;
+  InflateSegment* segments;
+  unsigned numsegments;
+  const LodePNGDecompressSettings* settings;
+} InflateSegments;
+
+static void inflateSegments_cleanup(InflateSegments* s)
+{
+  unsigned i;
+  for(i = 0; i != s->numsegments; ++i) ucvector_cleanup(&s->segments[i].out);
+  lodepng_free(s->segments);
+  s->segments = 0;
+  s->numsegments = 0;
+}
+
+static void inflateSegmentTask(void* data, unsigned i)
+{
+  InflateSegments* s = (InflateSegments*)data;
+  InflateSegment* segment = &s->segments[i];
+  segment->error = inflateBlocks(&segment->out, s->in, s->insize, segment->start, segment->stop);
+  if(!segment->error && !s->settings->ignore_adler32)
+  {
+    segment->adler = adler32(segment->out.data, (unsigned)segment->out.size);
+  }
+}
+
+/*
+Splits the zlib stream at restart points and inflates the segments with settings->parallel_for.
+A restart point is an empty stored block after which no match reaches back (a full flush), it
+shows up as the bytes 00 00 FF FF. Those bytes can also occur by chance, or come from a flush that
+keeps the history: then a segment does not end at the next one or refers to data before its start.
+In that case, if there are no restart points or if memory for the segments runs out, it returns
+without segments and the caller inflates the stream the usual way, which also reports any errors
+the stream really has.
+*/
+static unsigned inflateSegments(InflateSegments* s, const unsigned char* in, size_t insize,
+                                const LodePNGDecompressSettings* settings)
+{
+  uivector starts;
+  size_t i, outpos = 0;
+  unsigned adler = 1, error = 0, nomemory = 0;
+
+  s->in = in + 2; /*skip the zlib header*/
+  s->insize = insize - 2;
+  s->segments = 0;
+  s->numsegments = 0;
+  s->settings = settings;
+
+  uivector_init(&starts);
+  if(!uivector_push_back(&starts, 0)) nomemory = 1;
+  for(i = MIN_INFLATE_SEGMENT - 4; !nomemory && i + 8 < s->insize; ++i) /*at least the adler32 follows the last segment*/
+  {
+    if(s->in[i] == 0 && s->in[i + 1] == 0 && s->in[i + 2] == 255 && s->in[i + 3] == 255)
+    {
+      if(!uivector_push_back(&starts, (unsigned)(i + 4))) nomemory = 1;
+      i += MIN_INFLATE_SEGMENT - 1;
+    }
+  }
+
+  if(!nomemory && starts.size > 1)
+  {
+    s->segments = (InflateSegment*)lodepng_malloc(sizeof(InflateSegment) * starts.size);
+  }
+  if(s->segments)
+  {
+    s->numsegments = (unsigned)starts.size;
+    for(i = 0; i != starts.size; ++i)
+    {
+      s->segments[i].start = starts.data[i];
+      s->segments[i].stop = i + 1 < starts.size ? starts.data[i + 1] : 0;
+      s->segments[i].adler = 1;
+      s->segments[i].error = 0;
+      ucvector_init(&s->segments[i].out);
+    }
+    settings->parallel_for(inflateSegmentTask, s, s->numsegments, settings);
+
+    for(i = 0; i != s->numsegments; ++i)
+    {
+      if(s->segments[i].error) break;
+      s->segments[i].outpos = outpos;
+      outpos += s->segments[i].out.size;
+      adler = adler32_combine(adler, s->segments[i].adler, s->segments[i].out.size);
+    }
+    if(i != s->numsegments) inflateSegments_cleanup(s); /*not restart points after all*/
+    else if(!settings->ignore_adler32 && adler != lodepng_read32bitInt(&in[insize - 4])) error = 58;
+  }
+  uivector_cleanup(&starts);
+
+  if(error) inflateSegments_cleanup(s);
+  return error;
+}
+
+/*checks the 2 byte zlib header, returns an error code*/
+static unsigned checkZlibHeader(const unsigned char* in, size_t insize)
 {
-  unsigned error = 0;
   unsigned CM, CINFO, FDICT;
 
   if(insize < 2) return 53; /*error, size of zlib data too small*/
@@ -2119,6 +2317,43 @@ unsigned lodepng_zlib_decompress(unsigned char** out, size_t* outsize, const uns
     return 26;
   }
 
+  return 0;
+}
+
+unsigned lodepng_zlib_decompress(unsigned char** out, size_t* outsize, const unsigned char* in,
+                                 size_t insize, const LodePNGDecompressSettings* settings)
+{
+  unsigned error = checkZlibHeader(in, insize);
+  if(error) return error;
+
+  if(settings->parallel_for && !settings->custom_inflate)
+  {
+    InflateSegments segments;
+    error = inflateSegments(&segments, in, insize, settings);
+    if(error) return error;
+    if(segments.numsegments)
+    {
+      ucvector v;
+      unsigned i;
+      const InflateSegment* last = &segments.segments[segments.numsegments - 1];
+      ucvector_init_buffer(&v, *out, *outsize);
+      /*if this fails, the memory the segments held is given back before inflating again*/
+      if(ucvector_resize(&v, last->outpos + last->out.size))
+      {
+        for(i = 0; i != segments.numsegments; ++i)
+        {
+          const InflateSegment* segment = &segments.segments[i];
+          if(segment->out.size) memcpy(v.data + segment->outpos, segment->out.data, segment->out.size);
+        }
+        *out = v.data;
+        *outsize = v.size;
+        inflateSegments_cleanup(&segments);
+        return 0;
+      }
+      inflateSegments_cleanup(&segments);
+    }
+  }
+
   error = inflate(out, outsize, in + 2, insize - 2, settings);
   if(error) return error;
 
@@ -2232,7 +2467,8 @@ static unsigned zlib_compress(unsigned char** out, size_t* outsize, const unsign
 #ifdef LODEPNG_COMPILE_ENCODER
 
 /*this is a good tradeoff between speed and compression ratio*/
-#define DEFAULT_WINDOWSIZE 2048
+#define DEFAULT_WINDOWSIZE 32768
+#define DEFAULT_LEVEL 2
 
 void lodepng_compress_settings_init(LodePNGCompressSettings* settings)
 {
@@ -2243,13 +2479,15 @@ void lodepng_compress_settings_init(LodePNGCompressSettings* settings)
   settings->minmatch = 3;
   settings->nicematch = 128;
   settings->lazymatching = 1;
+  settings->level = DEFAULT_LEVEL;
+  settings->restart_interval = 0;
 
   settings->custom_zlib = 0;
   settings->custom_deflate = 0;
   settings->custom_context = 0;
 }
 
-const LodePNGCompressSettings lodepng_default_compress_settings = {2, 1, DEFAULT_WINDOWSIZE, 3, 128, 1, 0, 0, 0};
+const LodePNGCompressSettings lodepng_default_compress_settings = {2, 1, DEFAULT_WINDOWSIZE, 3, 128, 1, DEFAULT_LEVEL, 0, 0, 0, 0};
 
 
 #endif /*LODEPNG_COMPILE_ENCODER*/
@@ -2262,10 +2500,11 @@ void lodepng_decompress_settings_init(LodePNGDecompressSettings* settings)
 
   settings->custom_zlib = 0;
   settings->custom_inflate = 0;
+  settings->parallel_for = 0;
   settings->custom_context = 0;
 }
 
-const LodePNGDecompressSettings lodepng_default_decompress_settings = {0, 0, 0, 0};
+const LodePNGDecompressSettings lodepng_default_decompress_settings = {0, 0, 0, 0, 0};
 
 #endif /*LODEPNG_COMPILE_DECODER*/
 
@@ -3383,6 +3622,112 @@ static void getPixelColorsRGBA8(unsigned char* buffer, size_t numpixels,
   }
 }
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LODEPNG_SSE2
+#endif
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define LODEPNG_SSSE3
+#endif
+
+/*Fast paths of getPixelColorsRGBA8 for the conversions textures need most. Palette and grey
+of up to 8 bits go through a 256 entry table of output colors, also holding the color key,
+RGB to RGBA without color key and RGBA 16 to 8 bit copy several pixels per step with SIMD
+where available. Returns 0 if it does not handle mode, the generic loops run then.*/
+static unsigned getPixelColorsRGBA8Fast(unsigned char* buffer, size_t numpixels,
+                                        unsigned has_alpha, const unsigned char* in,
+                                        const LodePNGColorMode* mode)
+{
+  unsigned num_channels = has_alpha ? 4 : 3;
+  size_t i = 0;
+  if((mode->colortype == LCT_PALETTE || mode->colortype == LCT_GREY) && mode->bitdepth <= 8)
+  {
+    unsigned char table[256 * 4];
+    unsigned bits = mode->bitdepth, shift = 8 - bits, mask = (1u << bits) - 1u, index;
+    const unsigned char* color;
+    size_t j = 0;
+    for(index = 0; index != 256; ++index)
+    {
+      unsigned char* entry = &table[index * 4];
+      if(mode->colortype == LCT_GREY)
+      {
+        entry[0] = entry[1] = entry[2] = (unsigned char)(index <= mask ? (index * 255) / mask : 0);
+        entry[3] = mode->key_defined && index == mode->key_r ? 0 : 255;
+      }
+      else if(index < mode->palettesize)
+      {
+        entry[0] = mode->palette[index * 4 + 0];
+        entry[1] = mode->palette[index * 4 + 1];
+        entry[2] = mode->palette[index * 4 + 2];
+        entry[3] = mode->palette[index * 4 + 3];
+      }
+      else
+      {
+        /*out of range indices are black, like in getPixelColorsRGBA8*/
+        entry[0] = entry[1] = entry[2] = 0;
+        entry[3] = 255;
+      }
+    }
+    if(bits == 8)
+    {
+      if(has_alpha) for(i = 0; i != numpixels; ++i) memcpy(&buffer[i * 4], &table[in[i] * 4], 4);
+      else for(i = 0; i != numpixels; ++i) memcpy(&buffer[i * 3], &table[in[i] * 4], 3);
+      return 1;
+    }
+    /*the pixels are packed without padding, the first in the high bits of a byte*/
+    for(i = 0; i != numpixels; ++i, buffer += num_channels)
+    {
+      color = &table[((in[j] >> shift) & mask) * 4];
+      if(shift == 0)
+      {
+        shift = 8 - bits;
+        ++j;
+      }
+      else shift -= bits;
+      memcpy(buffer, color, num_channels);
+    }
+    return 1;
+  }
+  if(mode->colortype == LCT_RGB && mode->bitdepth == 8 && has_alpha && !mode->key_defined)
+  {
+#ifdef LODEPNG_SSSE3
+    /*four pixels per step from 12 of the 16 bytes loaded, so stop 6 pixels before the end*/
+    const __m128i spread = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i opaque = _mm_set1_epi32((int)0xff000000u);
+    for(; i + 6 <= numpixels; i += 4)
+    {
+      __m128i rgb = _mm_loadu_si128((const __m128i*)&in[i * 3]);
+      _mm_storeu_si128((__m128i*)&buffer[i * 4], _mm_or_si128(_mm_shuffle_epi8(rgb, spread), opaque));
+    }
+#endif /*LODEPNG_SSSE3*/
+    for(; i != numpixels; ++i)
+    {
+      buffer[i * 4 + 0] = in[i * 3 + 0];
+      buffer[i * 4 + 1] = in[i * 3 + 1];
+      buffer[i * 4 + 2] = in[i * 3 + 2];
+      buffer[i * 4 + 3] = 255;
+    }
+    return 1;
+  }
+  if(mode->colortype == LCT_RGBA && mode->bitdepth == 16 && has_alpha)
+  {
+#ifdef LODEPNG_SSE2
+    /*the high byte of each big endian sample is the low byte of a little endian 16-bit lane*/
+    const __m128i low = _mm_set1_epi16(255);
+    for(; i + 4 <= numpixels; i += 4)
+    {
+      __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i*)&in[i * 8]), low);
+      __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i*)&in[i * 8 + 16]), low);
+      _mm_storeu_si128((__m128i*)&buffer[i * 4], _mm_packus_epi16(a, b));
+    }
+#endif /*LODEPNG_SSE2*/
+    for(i *= 4; i != numpixels * 4; ++i) buffer[i] = in[i * 2];
+    return 1;
+  }
+  return 0;
+}
+
 /*Get RGBA16 color of pixel with index i (y * width + x) from the raw image with
 given color type, but the given color type must be 16-bit itself.*/
 static void getPixelColorRGBA16(unsigned short* r, unsigned short* g, unsigned short* b, unsigned short* a,
@@ -3430,7 +3775,7 @@ unsigned lodepng_convert(unsigned char* out, const unsigned char* in,
   if(lodepng_color_mode_equal(mode_out, mode_in))
   {
     size_t numbytes = lodepng_get_raw_size(w, h, mode_in);
-    for(i = 0; i != numbytes; ++i) out[i] = in[i];
+    memcpy(out, in, numbytes);
     return 0;
   }
 
@@ -3467,11 +3812,11 @@ unsigned lodepng_convert(unsigned char* out, const unsigned char* in,
   }
   else if(mode_out->bitdepth == 8 && mode_out->colortype == LCT_RGBA)
   {
-    getPixelColorsRGBA8(out, numpixels, 1, in, mode_in);
+    if(!getPixelColorsRGBA8Fast(out, numpixels, 1, in, mode_in)) getPixelColorsRGBA8(out, numpixels, 1, in, mode_in);
   }
   else if(mode_out->bitdepth == 8 && mode_out->colortype == LCT_RGB)
   {
-    getPixelColorsRGBA8(out, numpixels, 0, in, mode_in);
+    if(!getPixelColorsRGBA8Fast(out, numpixels, 0, in, mode_in)) getPixelColorsRGBA8(out, numpixels, 0, in, mode_in);
   }
   else
   {
@@ -3970,22 +4315,11 @@ static unsigned unfilterScanline(unsigned char* recon, const unsigned char* scan
   return 0;
 }
 
-static unsigned unfilter(unsigned char* out, const unsigned char* in, unsigned w, unsigned h, unsigned bpp)
+/*unfilters h scanlines, prevline is the already unfiltered scanline above the first one or 0*/
+static unsigned unfilterRows(unsigned char* out, const unsigned char* in, const unsigned char* prevline,
+                             size_t h, size_t linebytes, size_t bytewidth)
 {
-  /*
-  For PNG filter method 0
-  this function unfilters a single image (e.g. without interlacing this is called once, with Adam7 seven times)
-  out must have enough bytes allocated already, in must have the scanlines + 1 filtertype byte per scanline
-  w and h are image dimensions or dimensions of reduced image, bpp is bits per pixel
-  in and out are allowed to be the same memory address (but aren't the same size since in has the extra filter bytes)
-  */
-
-  unsigned y;
-  unsigned char* prevline = 0;
-
-  /*bytewidth is used for filtering, is 1 when bpp < 8, number of bytes per pixel otherwise*/
-  size_t bytewidth = (bpp + 7) / 8;
-  size_t linebytes = (w * bpp + 7) / 8;
+  size_t y;
 
   for(y = 0; y < h; ++y)
   {
@@ -4001,6 +4335,23 @@ static unsigned unfilter(unsigned char* out, const unsigned char* in, unsigned w
   return 0;
 }
 
+static unsigned unfilter(unsigned char* out, const unsigned char* in, unsigned w, unsigned h, unsigned bpp)
+{
+  /*
+  For PNG filter method 0
+  this function unfilters a single image (e.g. without interlacing this is called once, with Adam7 seven times)
+  out must have enough bytes allocated already, in must have the scanlines + 1 filtertype byte per scanline
+  w and h are image dimensions or dimensions of reduced image, bpp is bits per pixel
+  in and out are allowed to be the same memory address (but aren't the same size since in has the extra filter bytes)
+  */
+
+  /*bytewidth is used for filtering, is 1 when bpp < 8, number of bytes per pixel otherwise*/
+  size_t bytewidth = (bpp + 7) / 8;
+  size_t linebytes = (w * bpp + 7) / 8;
+
+  return unfilterRows(out, in, 0, h, linebytes, bytewidth);
+}
+
 /*
 in: Adam7 interlaced image, with no padding bits between scanlines, but between
  reduced images so that each reduced image starts at a byte.
@@ -4449,6 +4800,111 @@ static unsigned readChunk_pHYs(LodePNGInfo* info, const unsigned char* data, siz
 #endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
 
 /*read a PNG, the result will be in the same color type as the PNG (hence "generic")*/
+#ifdef LODEPNG_COMPILE_ZLIB
+typedef struct UnfilterBands
+{
+  unsigned char* out;
+  InflateSegment* segments; /*the scanlines of a band, starting at a restart point*/
+  const unsigned* groups; /*bands groups[i] up to groups[i + 1] depend on each other, one task each*/
+  size_t linebytes;
+  size_t bytewidth;
+} UnfilterBands;
+
+static void unfilterBandsTask(void* data, unsigned i)
+{
+  UnfilterBands* u = (UnfilterBands*)data;
+  const unsigned char* prevline = 0;
+  unsigned error = 0, band;
+  for(band = u->groups[i]; band != u->groups[i + 1] && !error; ++band)
+  {
+    const InflateSegment* segment = &u->segments[band];
+    size_t rows = segment->out.size / (u->linebytes + 1);
+    unsigned char* recon = &u->out[segment->outpos / (u->linebytes + 1) * u->linebytes];
+    error = unfilterRows(recon, segment->out.data, prevline, rows, u->linebytes, u->bytewidth);
+    if(rows) prevline = &recon[(rows - 1) * u->linebytes];
+  }
+  u->segments[u->groups[i]].error = error;
+}
+
+/*
+Decodes a non-interlaced image whose zlib stream has restart points with settings->parallel_for:
+the segments are inflated concurrently, and if they hold whole scanlines, the bands are also
+unfiltered concurrently into *out. A band whose first scanline uses the one above (filter Up,
+Average or Paeth) is unfiltered after the band before it by the same task. If the segments do
+not split at scanlines, their data is put in scanlines for the usual unfiltering instead. Without
+restart points it does nothing.
+*/
+static unsigned decodeSegments(unsigned char** out, ucvector* scanlines, unsigned w, unsigned h,
+                               const LodePNGInfo* info_png, const unsigned char* in, size_t insize,
+                               size_t predict, const LodePNGDecompressSettings* settings)
+{
+  InflateSegments segments;
+  uivector groups;
+  unsigned bpp = lodepng_get_bpp(&info_png->color);
+  size_t linebytes = (w * bpp + 7) / 8;
+  unsigned i, error, aligned;
+
+  if(bpp == 0) return 31; /*error: invalid colortype*/
+  error = checkZlibHeader(in, insize);
+  if(!error) error = inflateSegments(&segments, in, insize, settings);
+  if(error || !segments.numsegments) return error;
+
+  /*there are no padding bits to remove and every segment holds whole scanlines*/
+  aligned = !(bpp < 8 && w * bpp != linebytes * 8);
+  uivector_init(&groups);
+  for(i = 0; i != segments.numsegments && aligned; ++i)
+  {
+    const InflateSegment* segment = &segments.segments[i];
+    if(segment->outpos % (linebytes + 1) != 0) aligned = 0;
+    if(i == 0 || (segment->out.size && segment->out.data[0] <= 1))
+    {
+      if(!uivector_push_back(&groups, i)) aligned = 0; /*out of memory: unfilter the usual way*/
+    }
+  }
+  if(aligned && !uivector_push_back(&groups, segments.numsegments)) aligned = 0;
+  if(segments.segments[segments.numsegments - 1].outpos
+     + segments.segments[segments.numsegments - 1].out.size != predict)
+  {
+    error = 91; /*decompressed size doesn't match prediction*/
+  }
+
+  if(!error && aligned)
+  {
+    *out = (unsigned char*)lodepng_malloc(lodepng_get_raw_size(w, h, &info_png->color));
+    if(!*out) aligned = 0; /*unfilter the usual way, which needs the same memory and reports it*/
+  }
+  if(!error && aligned)
+  {
+    UnfilterBands bands;
+    bands.out = *out;
+    bands.segments = segments.segments;
+    bands.groups = groups.data;
+    bands.linebytes = linebytes;
+    bands.bytewidth = (bpp + 7) / 8;
+    settings->parallel_for(unfilterBandsTask, &bands, (unsigned)groups.size - 1, settings);
+    for(i = 0; i + 1 < groups.size && !error; ++i) error = segments.segments[groups.data[i]].error;
+  }
+  else if(!error)
+  {
+    if(!ucvector_resize(scanlines, predict)) error = 83; /*alloc fail*/
+    for(i = 0; i != segments.numsegments && !error; ++i)
+    {
+      const InflateSegment* segment = &segments.segments[i];
+      if(segment->out.size) memcpy(scanlines->data + segment->outpos, segment->out.data, segment->out.size);
+    }
+  }
+
+  if(error)
+  {
+    lodepng_free(*out);
+    *out = 0;
+  }
+  uivector_cleanup(&groups);
+  inflateSegments_cleanup(&segments);
+  return error;
+}
+#endif /*LODEPNG_COMPILE_ZLIB*/
+
 static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
                           LodePNGState* state,
                           const unsigned char* in, size_t insize)
@@ -4460,6 +4916,7 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
   ucvector scanlines;
   size_t predict;
   size_t numpixels;
+  LodePNGDecompressSettings zlibsettings = state->decoder.zlibsettings;
 
   /*for unknown chunk order*/
   unsigned unknown = 0;
@@ -4627,15 +5084,24 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
     predict += lodepng_get_raw_size_idat((*w + 0), (*h + 0) >> 1, color) + ((*h + 0) >> 1);
   }
   if(!state->error && !ucvector_reserve(&scanlines, predict)) state->error = 83; /*alloc fail*/
-  if(!state->error)
+#ifdef LODEPNG_COMPILE_ZLIB
+  if(!state->error && state->decoder.zlibsettings.parallel_for && state->info_png.interlace_method == 0
+     && !state->decoder.zlibsettings.custom_zlib && !state->decoder.zlibsettings.custom_inflate)
+  {
+    state->error = decodeSegments(out, &scanlines, *w, *h, &state->info_png, idat.data, idat.size,
+                                  predict, &state->decoder.zlibsettings);
+    zlibsettings.parallel_for = 0; /*the stream was already tried for restart points*/
+  }
+#endif /*LODEPNG_COMPILE_ZLIB*/
+  if(!state->error && !*out && !scanlines.size)
   {
     state->error = zlib_decompress(&scanlines.data, &scanlines.size, idat.data,
-                                   idat.size, &state->decoder.zlibsettings);
+                                   idat.size, &zlibsettings);
     if(!state->error && scanlines.size != predict) state->error = 91; /*decompressed size doesn't match prediction*/
   }
   ucvector_cleanup(&idat);
 
-  if(!state->error)
+  if(!state->error && !*out)
   {
     size_t outsize = lodepng_get_raw_size(*w, *h, &state->info_png.color);
     *out = (unsigned char*)lodepng_malloc(outsize);
@@ -5132,13 +5598,25 @@ static float flog2(float f)
   return result + 1.442695f * (f * f * f / 3 - 3 * f * f / 2 + 3 * f - 1.83333f);
 }
 
+/*scanlines between restart points of the zlib stream of a non-interlaced image, 0 if it has none*/
+static size_t restartRows(const LodePNGCompressSettings* zlibsettings, size_t linebytes)
+{
+  size_t rows;
+  if(!zlibsettings->restart_interval) return 0;
+  rows = zlibsettings->restart_interval / (linebytes + 1);
+  return rows ? rows : 1;
+}
+
 static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w, unsigned h,
-                       const LodePNGColorMode* info, const LodePNGEncoderSettings* settings)
+                       const LodePNGColorMode* info, const LodePNGEncoderSettings* settings, size_t bandrows)
 {
   /*
   For PNG filter method 0
   out must be a buffer with as size: h + (w * h * bpp + 7) / 8, because there are
   the scanlines with 1 extra byte per scanline
+  if bandrows is not 0, every scanline y > 0 with y % bandrows == 0 starts a band after a
+  restart point and the adaptive strategies only try the filters None and Sub there, which
+  do not use the scanline above: the bands can then be unfiltered independently
   */
 
   unsigned bpp = lodepng_get_bpp(info);
@@ -5199,7 +5677,8 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
       for(y = 0; y != h; ++y)
       {
         /*try the 5 filter types*/
-        for(type = 0; type != 5; ++type)
+        unsigned char numtypes = bandrows && y && y % bandrows == 0 ? 2 : 5;
+        for(type = 0; type != numtypes; ++type)
         {
           filterScanline(attempt[type], &in[y * linebytes], prevline, linebytes, bytewidth, type);
 
@@ -5256,7 +5735,8 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
     for(y = 0; y != h; ++y)
     {
       /*try the 5 filter types*/
-      for(type = 0; type != 5; ++type)
+      unsigned numtypes = bandrows && y && y % bandrows == 0 ? 2 : 5;
+      for(type = 0; type != numtypes; ++type)
       {
         filterScanline(attempt[type], &in[y * linebytes], prevline, linebytes, bytewidth, type);
         for(x = 0; x != 256; ++x) count[x] = 0;
@@ -5317,6 +5797,7 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
     images only, so disable it*/
     zlibsettings.custom_zlib = 0;
     zlibsettings.custom_deflate = 0;
+    zlibsettings.restart_interval = 0;
     for(type = 0; type != 5; ++type)
     {
       attempt[type] = (unsigned char*)lodepng_malloc(linebytes);
@@ -5324,7 +5805,8 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
     }
     for(y = 0; y != h; ++y) /*try the 5 filter types*/
     {
-      for(type = 0; type != 5; ++type)
+      unsigned numtypes = bandrows && y && y % bandrows == 0 ? 2 : 5;
+      for(type = 0; type != numtypes; ++type)
       {
         unsigned testsize = linebytes;
         /*if(testsize > 8) testsize /= 8;*/ /*it already works good enough by testing a part of the row*/
@@ -5450,6 +5932,7 @@ static unsigned preProcessScanlines(unsigned char** out, size_t* outsize, const
 
   if(info_png->interlace_method == 0)
   {
+    size_t bandrows = restartRows(&settings->zlibsettings, (w * bpp + 7) / 8);
     *outsize = h + (h * ((w * bpp + 7) / 8)); /*image size plus an extra byte per scanline + possible padding bits*/
     *out = (unsigned char*)lodepng_malloc(*outsize);
     if(!(*out) && (*outsize)) error = 83; /*alloc fail*/
@@ -5464,14 +5947,14 @@ static unsigned preProcessScanlines(unsigned char** out, size_t* outsize, const
         if(!error)
         {
           addPaddingBits(padded, in, ((w * bpp + 7) / 8) * 8, w * bpp, h);
-          error = filter(*out, padded, w, h, &info_png->color, settings);
+          error = filter(*out, padded, w, h, &info_png->color, settings, bandrows);
         }
         lodepng_free(padded);
       }
       else
       {
         /*we can immediately filter into the out buffer, no other steps needed*/
-        error = filter(*out, in, w, h, &info_png->color, settings);
+        error = filter(*out, in, w, h, &info_png->color, settings, bandrows);
       }
     }
   }
@@ -5504,13 +5987,13 @@ static unsigned preProcessScanlines(unsigned char** out, size_t* outsize, const
           addPaddingBits(padded, &adam7[passstart[i]],
                          ((passw[i] * bpp + 7) / 8) * 8, passw[i] * bpp, passh[i]);
           error = filter(&(*out)[filter_passstart[i]], padded,
-                         passw[i], passh[i], &info_png->color, settings);
+                         passw[i], passh[i], &info_png->color, settings, 0);
           lodepng_free(padded);
         }
         else
         {
           error = filter(&(*out)[filter_passstart[i]], &adam7[padded_passstart[i]],
-                         passw[i], passh[i], &info_png->color, settings);
+                         passw[i], passh[i], &info_png->color, settings, 0);
         }
 
         if(error) break;
@@ -5673,7 +6156,17 @@ unsigned lodepng_encode(unsigned char** out, size_t* outsize,
     }
 #endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
     /*IDAT (multiple IDAT chunks must be consecutive)*/
-    state->error = addChunk_IDAT(&outv, data, datasize, &state->encoder.zlibsettings);
+    {
+      /*restart points between whole scanlines, the bands the filters were chosen for*/
+      LodePNGCompressSettings zlibsettings = state->encoder.zlibsettings;
+      zlibsettings.restart_interval = 0;
+      if(info.interlace_method == 0)
+      {
+        size_t linebytes = (w * lodepng_get_bpp(&info.color) + 7) / 8;
+        zlibsettings.restart_interval = (unsigned)(restartRows(&state->encoder.zlibsettings, linebytes) * (linebytes + 1));
+      }
+      state->error = addChunk_IDAT(&outv, data, datasize, &zlibsettings);
+    }
     if(state->error) break;
 #ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
     /*tIME*/
@@ -5924,6 +6417,7 @@ const char* lodepng_error_text(unsigned code)
     case 92: return "too many pixels, not supported";
     case 93: return "zero width or height is invalid";
     case 94: return "header chunk must have a size of 13 bytes";
+    case 95: return "deflate restart point is not at a block boundary";
   }
   return "unknown error code";
 }
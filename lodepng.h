@@ -268,6 +268,13 @@ struct LodePNGDecompressSettings
                              const unsigned char*, size_t,
                              const LodePNGDecompressSettings*);
 
+  /*optional: run task(data, i) for every i in [0, count) and return when all are done, on as
+  many threads as available. If set, zlib streams with restart points (full flushes) are inflated
+  one segment per task, and so are the scanlines of non-interlaced PNGs unfiltered. Restart points
+  less than 8 KB of deflate data apart are joined into one segment (default: null)*/
+  void (*parallel_for)(void (*task)(void*, unsigned), void* data, unsigned count,
+                       const LodePNGDecompressSettings*);
+
   const void* custom_context; /*optional custom settings for custom functions*/
 };
 
@@ -286,10 +293,17 @@ struct LodePNGCompressSettings /*deflate = compress*/
   /*LZ77 related settings*/
   unsigned btype; /*the block type for LZ (0, 1, 2 or 3, see zlib standard). Should be 2 for proper compression.*/
   unsigned use_lz77; /*whether or not to use LZ77. Should be 1 for proper compression.*/
-  unsigned windowsize; /*must be a power of two <= 32768. higher compresses more but is slower. Default value: 2048.*/
+  unsigned windowsize; /*must be a power of two <= 32768. higher compresses more but is slower. Default value: 32768.*/
   unsigned minmatch; /*mininum lz77 length. 3 is normally best, 6 can be better for some PNGs. Default: 0*/
   unsigned nicematch; /*stop searching if >= this length found. Set to 258 for best compression. Default: 128*/
   unsigned lazymatching; /*use lazy matching: better compression but a bit slower. Default: true*/
+  /*match finder effort from 1 (fastest) to 9 (smallest output), like zlib levels. It replaces
+  nicematch and lazymatching and the chain length derived from windowsize. 0 keeps those. Default: 2*/
+  unsigned level;
+  /*if not 0, restart the deflate stream (a full flush, no matches across it) every this many input
+  bytes, so that a decoder can inflate the parts in parallel. The PNG encoder rounds it to whole
+  scanlines and filters the first scanline of every part without the one above it. Default: 0*/
+  unsigned restart_interval;
 
   /*use custom zlib encoder instead of built in one (default: null)*/
   unsigned (*custom_zlib)(unsigned char**, size_t*,
@@ -1170,7 +1184,9 @@ can encode the colors of all pixels without information loss.
 *) use_lz77: whether or not to use LZ77 for compressed block types. Should be
    true for proper compression.
 *) windowsize: the window size used by the LZ77 encoder (1 - 32768). Has value
-   2048 by default, but can be set to 32768 for better, but slow, compression.
+   32768 by default, smaller windows compress less and are hardly faster.
+*) level: effort of the LZ77 match finder, 1 (fastest) to 9 (smallest), 2 by
+   default. 0 uses nicematch, lazymatching and a chain length from windowsize.
 *) force_palette: if colortype is 2 or 6, you can make the encoder write a PLTE
    chunk if force_palette is true. This can used as suggested palette to convert
    to by viewers that don't support more than 256 colors (if those still exist)
@@ -1564,6 +1580,7 @@ A quick reference of some settings to set on the LodePNGState
 For decoding:
 
 state.decoder.zlibsettings.ignore_adler32: ignore ADLER32 checksums
+state.decoder.zlibsettings.parallel_for: decode images with restart points on several threads
 state.decoder.zlibsettings.custom_...: use custom inflate function
 state.decoder.ignore_crc: ignore CRC checksums
 state.decoder.color_convert: convert internal PNG color to chosen one
@@ -1582,6 +1599,8 @@ state.encoder.zlibsettings.windowsize: tweak LZ77 windowsize
 state.encoder.zlibsettings.minmatch: tweak min LZ77 length to match
 state.encoder.zlibsettings.nicematch: tweak LZ77 match where to stop searching
 state.encoder.zlibsettings.lazymatching: try one more LZ77 matching
+state.encoder.zlibsettings.level: LZ77 speed versus size, overrides the three above
+state.encoder.zlibsettings.restart_interval: write restart points for parallel decoding
 state.encoder.zlibsettings.custom_...: use custom deflate function
 state.encoder.auto_convert: choose optimal PNG color type, if 0 uses info_png
 state.encoder.filter_palette_zero: PNG filter strategy for palette
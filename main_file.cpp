@@ -17,6 +17,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define GLM_FORCE_RADIANS
 
 #include <map>
+#include <string>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
@@ -24,10 +30,27 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <glm/gtc/matrix_transform.hpp>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
 #include "constants.h"
 #include "allmodels.h"
 #include "lodepng.h"
 #include "shaderprogram.h"
+#include "staticbatch.h"
+#include "hizbuffer.h"
+#include "lod.h"
+#include "bezier.h"
+#include "crowd.h"
+#include "navgrid.h"
+#include "collision.h"
+#include "framepacer.h"
+#include "triplebuffer.h"
+#include "jobs.h"
+#include "layoutfile.h"
+#include "filewatch.h"
+#include "texturecache.h"
+#include "uploadring.h"
+#include "capture.h"
 #include "myCube.h"
 
 glm::vec3 cameraPos = glm::vec3(0.0f, -0.5f, 0.0f);
@@ -41,92 +64,88 @@ float lastX =  800.0f / 2.0;
 float lastY =  600.0 / 2.0;
 float fov   =  45.0f;
 
-float deltaTime = 0.0f;	// time between current frame and last frame
-float lastFrame = 0.0f;
+//Simulation runs in fixed steps, drawing interpolates between the last two of them
+double simulationRate = 120.0; //Steps per second
+const double maxFrameTime = 0.25; //Longer frames are dropped instead of simulated in a burst
+double simulationTime = 0.0; //Time not simulated yet
+glm::vec3 cameraVelocity = glm::vec3(0.0f); //Set by processInput(), applied by simulate()
+glm::vec3 previousCameraPos = cameraPos;
+glm::vec3 eyePos = cameraPos; //Interpolated camera position for drawing
 
+FramePacer framePacer; //Used by the render thread only
+bool lowLatency = false; //Build each frame packet just in time for the render thread (key F)
+int framesInFlight = FramePacer::maxFramesInFlight; //GPU frames queued at most (keys 1-3)
+
+FrameCapture frameCapture; //Used by the render thread only
+int screenshotRequests = 0; //Screenshots asked for so far (key K)
+int capturedScreenshots = 0; //... and taken by the render thread
+bool recording = false; //Every drawn frame goes to a Y4M video (key R)
+
+const float movSpeed = 10.0f; //Animation units per second
 float mov = 0.0f;
+float previousMov = 0.0f;
+
+std::string galleryText = "gallery.txt"; //Layout source, compiled into galleryLayout when it is newer; empty for none
+std::string galleryLayout = "gallery.layout";
+std::vector<GLuint> galleryTextures; //Textures of the layout, by layout index
+std::vector<std::string> galleryTexturePaths;
 
-GLuint wall;
-GLuint floor10;
-GLuint ceiling;
-
-std::map<const char*, GLuint> tex;
-
-const char *files[] = {
-	"portrety/mozart.png",
-	"portrety/beethoven.png",
-	"portrety/gutenberg.png",
-	"portrety/kolubm.png",
-	"portrety/kopernik.png",
-	"portrety/mona_lisa.png",
-	"portrety/sienkiewicz.png",
-	"portrety/woman.png",
-	"portrety/napoleon.png",
-	"portrety/newton.png",
-	"portrety/picasso.png",
-	"portrety/shakespeare.png",
-	"portrety/van_gogh.png",
-	"portrety/mickiewicz.png",
-	"portrety/davinvi.png",
-	"obrazy/1.png",
-	"obrazy/2.png",
-	"obrazy/3.png",
-	"obrazy/4.png",
-	"obrazy/5.png",
-	"obrazy/6.png",
-	"obrazy/7.png",
-	"obrazy/8.png",
-	"obrazy/9.png",
-	"obrazy/10.png",
-	"obrazy/11.png",
-	"obrazy/12.png",
-	"obrazy/13.png",
-	"obrazy/14.png",
-  "art/beksinski.png",
-  "art/girl.png",
-  "art/klimt.png",
-  "art/lato.png",
-  "art/mirrors.png",
-  "art/munch.png",
-  "art/night.png",
-  "art/persistence.png",
-  "art/pomaranczarka.png",
-  "art/wanderer.png",
-  "art/waterlilies.png",
-  "art/frida.png",
-  "art/macierzynstwo.png",
-  "art/witkacy.png",
-  "pop/abbey-road.png",
-  "pop/comics.png",
-  "pop/death-note.png",
-  "pop/joy.png",
-  "pop/lotr.png",
-  "pop/star-trek.png",
-  "pop/type.png",
-  "pop/wars.png",
-  "pop/doom.png",
-  "pop/fallout.png",
-  "pop/queen.png",
-  "pop/tupac.png",
-  "pop/bb.png",
-  "pop/matrix.png",
-  "pop/robot.png"
+//Static part of the gallery (rooms, corridors, paintings), read once by loadGallery()
+struct StaticDraw {
+	glm::mat4 M;
+	GLuint tex;
+	glm::vec3 bmin; //World space bounds (the [-1, 1] cube transformed by M)
+	glm::vec3 bmax;
+	uint32_t kind; //layoutFloor ... layoutPainting
 };
 
+std::vector<StaticDraw> staticDraws;
+Crowd crowd; //Gallery visitors, placed by loadGallery()
+NavGrid nav; //Where the visitors can walk, built from staticDraws by initGallery()
+CollisionWorld walls; //Boxes of staticDraws that the camera and the visitors cannot pass through
+const float cameraRadius = 0.1f;
+
+StaticBatch galleryBatch;
+bool useGalleryBatch = false; //Submit the static draws with one glMultiDrawArraysIndirect
+
+HiZBuffer hiz; //Depth pyramid of the previous frame
+bool useOcclusionCulling = false; //Cull the static draws on the GPU against hiz (key C)
+bool showCulled = false; //Overlay culled objects in red (key X)
+
+bool usePackedVertices = true; //Draw models from the 16 byte PackedVertex layout (key P)
+bool useLod = true; //Pick head detail by projected size (key L)
+float viewportHeight = 1080.0f; //Framebuffer height, for projected sizes
+
+glm::mat4 teapotExhibit; //Bezier teapot next to the first visitor, placed by loadGallery()
+bool hasTeapotExhibit = false;
+Models::LodChain bezierTeapotLod(1.0f); //CPU tessellations of Models::teapotSurface
+int teapotExhibitLod = -1;
+bool useTessellationShader = false; //Tessellate the exhibit on the GPU instead (key T)
+
 void processInput(GLFWwindow *window)
 {
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
         glfwSetWindowShouldClose(window, true);
 
-    float cameraSpeed = static_cast<float>(2.5 * deltaTime);
+    float cameraSpeed = 2.5f;
+    cameraVelocity = glm::vec3(0.0f);
     if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
-        cameraPos += cameraSpeed * cameraFront;
+        cameraVelocity += cameraSpeed * cameraFront;
     if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
-        cameraPos -= cameraSpeed * cameraFront;
+        cameraVelocity -= cameraSpeed * cameraFront;
     if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
-        cameraPos -= glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
+        cameraVelocity -= glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
     if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
-        cameraPos += glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
+        cameraVelocity += glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraSpeed;
+}
+
+//One fixed step of everything that moves
+void simulate(float dt) {
+    previousCameraPos = cameraPos;
+    cameraPos = walls.move(cameraPos, cameraVelocity * dt, cameraRadius); //Slides along the walls instead of passing through them
+    previousMov = mov;
+    mov += movSpeed * dt;
+    if (crowd.walking) crowd.steer(nav, dt, &walls);
 }
 
 // glfw: whenever the mouse moves, this callback is called
@@ -168,6 +187,38 @@ void mouse_callback(GLFWwindow* window, double xposIn, double yposIn)
     cameraFront = glm::normalize(front);
 }
 
+void addCrowd(int count);
+
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+  if (action != GLFW_PRESS)
+    return;
+  if (key == GLFW_KEY_C && spCull != NULL && useGalleryBatch)
+    useOcclusionCulling = !useOcclusionCulling; //The render thread drops the stale pyramid
+  if (key == GLFW_KEY_X)
+    showCulled = !showCulled;
+  if (key == GLFW_KEY_P)
+    usePackedVertices = !usePackedVertices;
+  if (key == GLFW_KEY_L)
+    useLod = !useLod;
+  if (key == GLFW_KEY_T && spBezier != NULL)
+    useTessellationShader = !useTessellationShader;
+  if (key == GLFW_KEY_V)
+    addCrowd(250);
+  if (key == GLFW_KEY_F) {
+    lowLatency = !lowLatency;
+    framesInFlight = lowLatency ? 1 : FramePacer::maxFramesInFlight;
+  }
+  if (key >= GLFW_KEY_1 && key <= GLFW_KEY_3)
+    framesInFlight = key - GLFW_KEY_1 + 1;
+  if (key == GLFW_KEY_N)
+    crowd.walking = !crowd.walking && nav.goalCount() > 0;
+  if (key == GLFW_KEY_K)
+    screenshotRequests++;
+  if (key == GLFW_KEY_R)
+    recording = !recording;
+}
+
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
 {
   fov -= (float)yoffset;
@@ -183,33 +234,96 @@ void error_callback(int error, const char* description) {
 }
 
 
-GLuint readTexture(const char* filename) {
-	GLuint tex;
-	glActiveTexture(GL_TEXTURE0);
+//Decoded textures with their mip chains, kept between runs
+TextureCache textureCache("texcache", (uint64_t)1 << 30, true);
 
-	//Read into computers memory
-	std::vector<unsigned char> image;   //Allocate memory 
-	unsigned width, height;   //Variables for image size
-	//Read the image
-	unsigned error = lodepng::decode(image, width, height, filename);
+//Persistently mapped staging memory for texture uploads, written by the job threads
+UploadRing uploadRing;
+const size_t uploadRingBytes = 64 << 20;
 
-	//Import to graphics card memory
-	glGenTextures(1, &tex); //Initialize one handle
+//Texture on its way to the GPU: its levels are copied into the upload ring when it
+//has room, otherwise they are uploaded from the image in client memory
+struct StagedTexture {
+	TextureImage image;
+	UploadRing::Span span = UploadRing::Span();
+};
+
+//Any thread, after reserving the span
+void copyToRing(StagedTexture& staged) {
+	if (staged.span.data) memcpy(staged.span.data, staged.image.pixels(0), staged.image.dataSize());
+}
+
+//Copies the image into tex, replacing what it held before
+void fillTexture(GLuint tex, const StagedTexture& staged) {
+	const TextureImage& image = staged.image;
+	glActiveTexture(GL_TEXTURE0);
 	glBindTexture(GL_TEXTURE_2D, tex); //Activate handle
-	//Copy image to graphics cards memory reprezented by the active handle
-	glTexImage2D(GL_TEXTURE_2D, 0, 4, width, height, 0,
-		GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char*)image.data());
+	//Copy image to graphics cards memory reprezented by the active handle, one call per mip level.
+	//From the ring the pixel pointers are offsets into the bound unpack buffer.
+	//RGB8 rows are tightly packed, so they need not start at multiples of 4.
+	GLenum format = image.format() == textureFormatRGB8 ? GL_RGB : GL_RGBA;
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (staged.span.data) glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploadRing.handle());
+	for (int level = 0; level < image.levelCount(); level++)
+		glTexImage2D(GL_TEXTURE_2D, level, image.bytesPerPixel(), image.width(level), image.height(level), 0, format, GL_UNSIGNED_BYTE,
+			staged.span.data ? (const void*)(staged.span.offset + image.levelOffset(level)) : (const void*)image.pixels(level));
+	if (staged.span.data) {
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		uploadRing.uploaded(staged.span);
+	}
 
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, image.levelCount() - 1);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, image.levelCount() > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
 
+GLuint uploadTexture(const StagedTexture& staged) {
+	GLuint tex;
+	//Import to graphics card memory
+	glGenTextures(1, &tex); //Initialize one handle
+	if (!staged.image.empty()) fillTexture(tex, staged);
 	return tex;
 }
 
-void populateTextures() {
-  for (auto f : files) {
-    tex[f] = readTexture(f);
+//Cache lookups and PNG decoding run on the job system, uploads stay on the thread that owns the context.
+//Textures go through the upload ring in batches that fit it: this thread reserves the spans,
+//the job threads copy into them and each batch is uploaded while the next one is copied.
+void populateTextures(const LayoutFile& layout) {
+  const int count = layout.textureCount();
+  std::vector<StagedTexture> staged(count);
+  double start = glfwGetTime();
+  Jobs::parallelFor(0, count, 1, [&](int begin, int end) {
+    for (int i = begin; i < end; i++) textureCache.load(layout.texturePath(i), staged[i].image);
+  });
+  galleryTextures.resize(count);
+  galleryTexturePaths.resize(count);
+  for (int first = 0; first < count;) {
+    int last = first;
+    for (; last < count; last++) {
+      staged[last].span = uploadRing.allocate(staged[last].image.dataSize());
+      if (staged[last].span.data == NULL) break;
+    }
+    if (last == first) {
+      if (!uploadRing.idle()) { //Full of earlier batches still being uploaded
+        uploadRing.retire(true);
+        continue;
+      }
+      last++; //No ring, or the texture does not fit in it
+    }
+    Jobs::parallelFor(first, last, 1, [&](int begin, int end) {
+      for (int i = begin; i < end; i++) copyToRing(staged[i]);
+    });
+    for (int i = first; i < last; i++) {
+      galleryTextures[i] = uploadTexture(staged[i]);
+      staged[i].image.release();
+      galleryTexturePaths[i] = layout.texturePath(i);
+    }
+    first = last;
   }
+  uploadRing.retire(false);
+  textureCache.save();
+  printf("Textures: %d loaded on %d threads and uploaded in %.1f ms\n", count, Jobs::threadCount(), (glfwGetTime() - start) * 1000.0);
+  textureCache.printStats();
 }
 
 void texCube(glm::mat4 P, glm::mat4 V, glm::mat4 M, GLuint tex) {
@@ -237,348 +351,411 @@ void texCube(glm::mat4 P, glm::mat4 V, glm::mat4 M, GLuint tex) {
 	glDisableVertexAttribArray(spTextured->a("color"));
 }
 
+//Hot reload: the main thread polls assetWatcher every frame and decodes changed PNGs
+//on the job system, the render thread swaps the results in between two frames.
+//Only the changed texture is decoded and only programs using a changed shader are rebuilt.
+FileWatcher assetWatcher; //Layout textures and shader sources
+Jobs::TaskGroup* reloadJobs; //Decodes of changed textures
+struct TextureReload {
+	int texture; //Layout index
+	StagedTexture staged; //Already in the upload ring if it had room
+};
+std::mutex reloadMutex; //Guards the two lists below
+std::vector<TextureReload> reloadedTextures; //Decoded, waiting for the render thread
+std::vector<std::string> reloadedShaders;
+
+void watchAssets() {
+	assetWatcher.clear();
+	for (const std::string& path : galleryTexturePaths) assetWatcher.watch(path);
+	std::vector<std::string> shaders;
+	shaderFiles(shaders);
+	for (const std::string& path : shaders) assetWatcher.watch(path);
+}
+
+//Main thread, once per frame
+void pollAssets() {
+	std::vector<std::string> changed;
+	assetWatcher.poll(changed);
+	for (const std::string& path : changed) {
+		bool texture = false;
+		for (int i = 0; i < (int)galleryTexturePaths.size(); i++) {
+			if (galleryTexturePaths[i] != path) continue;
+			texture = true;
+			reloadJobs->run([i] {
+				TextureReload reload;
+				reload.texture = i;
+				if (!textureCache.load(galleryTexturePaths[i].c_str(), reload.staged.image)) return; //Keep the old image, the file may still be written
+				reload.staged.span = uploadRing.allocate(reload.staged.image.dataSize());
+				copyToRing(reload.staged);
+				std::lock_guard<std::mutex> lock(reloadMutex);
+				reloadedTextures.push_back(std::move(reload));
+			});
+		}
+		if (!texture) {
+			std::lock_guard<std::mutex> lock(reloadMutex);
+			reloadedShaders.push_back(path);
+		}
+	}
+	if (!changed.empty() && Jobs::threadCount() == 1) reloadJobs->wait(); //No worker would pick the decodes up
+}
+
+//Render thread, before drawing a frame: nothing changes while a frame is drawn
+void applyReloads() {
+	std::vector<TextureReload> textures;
+	std::vector<std::string> shaders;
+	{
+		std::lock_guard<std::mutex> lock(reloadMutex);
+		textures.swap(reloadedTextures);
+		shaders.swap(reloadedShaders);
+	}
+	uploadRing.retire(false);
+	for (const TextureReload& reload : textures) {
+		double start = glfwGetTime();
+		GLuint tex = galleryTextures[reload.texture];
+		fillTexture(tex, reload.staged);
+		if (useGalleryBatch) galleryBatch.refreshTexture(tex);
+		printf("Reloaded %s in %.1f ms\n", galleryTexturePaths[reload.texture].c_str(), (glfwGetTime() - start) * 1000.0);
+	}
+	if (!shaders.empty()) reloadShaders(shaders);
+}
+
+//Scatters extra visitors around the ones placed by loadGallery()
+void addCrowd(int count) {
+	int placed = crowd.size();
+	if (placed == 0) return;
+	for (int i = 0; i < count; i++) {
+		int k = rand() % placed;
+		glm::vec3 position(crowd.x[k] + (rand() % 200 - 100) * 0.004f, crowd.y[k], crowd.z[k] + (rand() % 200 - 100) * 0.004f);
+		glm::vec3 color(rand() % 256 / 255.0f, rand() % 256 / 255.0f, rand() % 256 / 255.0f);
+		crowd.add(position, rand() % 628 * 0.01f, color, (float)(rand() % 1000));
+	}
+	printf("Visitors: %d\n", crowd.size());
+}
+
+void initGallery();
+
 //Initialization code procedure
 void initOpenGLProgram(GLFWwindow* window) {
 	initShaders();
 	//************Place any code here that needs to be executed once, at the program start************
 	glClearColor(0, 0, 0, 1); //Set color buffer clear color
 	glEnable(GL_DEPTH_TEST); //Turn on pixel depth test based on depth buffer
-	wall = readTexture("bluu.png");
-	floor10 = readTexture("carpet.png");
-	ceiling = readTexture("sufit.png");
-  populateTextures();
+	uploadRing.setup(uploadRingBytes);
+	initGallery();
+	if (Models::teapot.load("teapot.mesh")) Models::teapot.upload();
+	reloadJobs = new Jobs::TaskGroup();
+	watchAssets();
+
+	Models::sphere.printStats("Sphere");
+	Models::torus.printStats("Torus");
+	Models::teapot.printStats("Teapot");
+	Models::cube.printPackedStats("Cube");
+	Models::sphere.printPackedStats("Sphere");
+	Models::torus.printPackedStats("Torus");
+	Models::teapot.printPackedStats("Teapot");
+	Models::sphereLod.printStats("Sphere");
+	Models::torusLod.printStats("Torus");
+	Models::teapotLod.printStats("Teapot");
 }
 
 //Release resources allocated by the program
 void freeOpenGLProgram(GLFWwindow* window) {
+	galleryBatch.release();
+	hiz.release();
+	crowd.printStats();
+	nav.printStats();
+	framePacer.printStats();
+	framePacer.release();
+	delete reloadJobs; //Waits for decodes in flight
+	reloadJobs = NULL;
+	textureCache.save(); //Remembers entries of reloaded textures
+	uploadRing.printStats();
+	uploadRing.release();
+	frameCapture.release(); //Writes out what is still being read back
+	frameCapture.printStats();
+	Jobs::printStats();
+	crowd.release();
+	Models::teapot.release();
+	Models::teapotSurface.release();
 	freeShaders();
-	glDeleteTextures(1, &wall);
-	glDeleteTextures(1, &floor10);
-	for (const auto& [k, v] : tex) {
-		glDeleteTextures(1, &v);
-	}
+	if (!galleryTextures.empty()) glDeleteTextures((GLsizei)galleryTextures.size(), galleryTextures.data());
 	//************Place any code here that needs to be executed once, after the main loop ends************
 }
 
-void room1exit(glm::mat4 Ms, glm::mat4 P, glm::mat4 V) {
-
-	glm::mat4 Mf1 = glm::scale(Ms, glm::vec3(2.0f, 0.025f, 2.0f));
-	/*Mp = glm::translate(Mp, glm::vec3(0.0f, -0.0f, 0.0f));*/
-	texCube(P, V, Mf1, ceiling);
-
-	glm::mat4 Mf2 = glm::scale(Ms, glm::vec3(2.0f, 0.025f, 2.0f));
-	Mf2 = glm::translate(Mf2, glm::vec3(0.0f, 30.0f, 0.0f));
-	texCube(P, V, Mf2, floor10);
-
-
-	glm::mat4 Mw1 = glm::scale(Ms, glm::vec3(2.0f, 0.375f, 0.025f));
-	Mw1 = glm::translate(Mw1, glm::vec3(0.0f, 1.0f, 80.0f));
-	texCube(P, V, Mw1, wall);
-
-
-	glm::mat4 Mw2 = glm::scale(Ms, glm::vec3(2.0f, 0.375f, 0.025f));
-	Mw2 = glm::translate(Mw2, glm::vec3(0.0f, 1.0f, -80.0f));
-	texCube(P, V, Mw2, wall);
-
-
-	glm::mat4 Mw3 = glm::scale(Ms, glm::vec3(0.025f, 0.375f, 2.0f));
-	Mw3 = glm::translate(Mw3, glm::vec3(80.0f, 1.0f, 0.0f));
-	texCube(P, V, Mw3, wall);
-
-
-	glm::mat4 Mw4 = glm::scale(Ms, glm::vec3(0.025f, 0.375f, 2.0f));
-	Mw4 = glm::translate(Mw4, glm::vec3(-80.0f, 1.0f, 0.0f));
-
-	
-	glm::mat4 Mk1 = glm::scale(Mw4, glm::vec3(1.0f, 1.0f, 0.4f));
-	Mk1 = glm::translate(Mk1, glm::vec3(0.0f, 0.0f, 1.5f));
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Mk1));
-	Models::cube.drawSolid();
-
-	glm::mat4 Mk2 = glm::scale(Mw4, glm::vec3(1.0f, 1.0f, 0.4f));
-	Mk2 = glm::translate(Mk2, glm::vec3(0.0f, 0.0f, -1.5f));
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Mk2));
-	Models::cube.drawSolid();
+void drawModel(Models::Model& model, bool smooth, bool packed) {
+	if (packed) model.drawPacked(smooth);
+	else model.drawSolid(smooth);
 }
 
-void room2exit(glm::mat4 Ms, glm::mat4 P, glm::mat4 V) {
-
-	glm::mat4 Mf1 = glm::scale(Ms, glm::vec3(2.0f, 0.025f, 2.0f));
-	texCube(P, V, Mf1, ceiling);
-
-	glm::mat4 Mf2 = glm::scale(Ms, glm::vec3(2.0f, 0.025f, 2.0f));
-	Mf2 = glm::translate(Mf2, glm::vec3(0.0f, 30.0f, 0.0f));
-	texCube(P, V, Mf2, floor10);
-
-	glm::mat4 Mw1 = glm::scale(Ms, glm::vec3(2.0f, 0.375f, 0.025f));
-	Mw1 = glm::translate(Mw1, glm::vec3(0.0f, 1.0f, 80.0f));
-	texCube(P, V, Mw1, wall);
-
-	glm::mat4 Mw2 = glm::scale(Ms, glm::vec3(2.0f, 0.375f, 0.025f));
-	Mw2 = glm::translate(Mw2, glm::vec3(0.0f, 1.0f, -80.0f));
-	texCube(P, V, Mw2, wall);
-
-
-	glm::mat4 Mw4 = glm::scale(Ms, glm::vec3(0.025f, 0.375f, 2.0f));
-	Mw4 = glm::translate(Mw4, glm::vec3(-80.0f, 1.0f, 0.0f));
-
-	glm::mat4 Mk1 = glm::scale(Mw4, glm::vec3(1.0f, 1.0f, 0.4f));
-	Mk1 = glm::translate(Mk1, glm::vec3(0.0f, 0.0f, 1.5f));
-	texCube(P, V, Mk1, wall);
-
-
-	glm::mat4 Mk2 = glm::scale(Mw4, glm::vec3(1.0f, 1.0f, 0.4f));
-	Mk2 = glm::translate(Mk2, glm::vec3(0.0f, 0.0f, -1.5f));
-	texCube(P, V, Mk2, wall);
-
-
-	glm::mat4 Mw5 = glm::scale(Ms, glm::vec3(0.025f, 0.375f, 2.0f));
-	Mw5 = glm::translate(Mw5, glm::vec3(80.0f, 1.0f, 0.0f));
-
-	glm::mat4 Mk4 = glm::scale(Mw5, glm::vec3(1.0f, 1.0f, 0.4f));
-	Mk4 = glm::translate(Mk4, glm::vec3(0.0f, 0.0f, 1.5f));
-	texCube(P, V, Mk4, wall);
-
+//One pass over the compiled layout: static draws with their bounds, collision boxes, visitors and the exhibit
+void loadGallery(const LayoutFile& layout) {
+	double start = glfwGetTime();
+	staticDraws.clear();
+	crowd.clear();
+	walls.clear();
+
+	const LayoutBox* boxes = layout.boxes();
+	staticDraws.reserve(layout.boxCount());
+	for (int i = 0; i < layout.boxCount(); i++) {
+		const LayoutBox& b = boxes[i];
+		StaticDraw d;
+		d.M = glm::make_mat4(b.M);
+		d.tex = galleryTextures[b.texture];
+		d.bmin = glm::make_vec3(b.boundsMin);
+		d.bmax = glm::make_vec3(b.boundsMax);
+		d.kind = b.kind;
+		staticDraws.push_back(d);
+		walls.addBox(d.bmin, d.bmax);
+	}
+	walls.build(1.0f);
 
-	glm::mat4 Mk5 = glm::scale(Mw5, glm::vec3(1.0f, 1.0f, 0.4f));
-	Mk5 = glm::translate(Mk5, glm::vec3(0.0f, 0.0f, -1.5f));
-	texCube(P, V, Mk5, wall);
+	const LayoutVisitor* visitors = layout.visitors();
+	for (int i = 0; i < layout.visitorCount(); i++)
+		crowd.add(glm::make_vec3(visitors[i].position), visitors[i].heading, glm::make_vec3(visitors[i].color), visitors[i].phase);
 
+	hasTeapotExhibit = layout.exhibitCount() > 0;
+	if (hasTeapotExhibit) {
+		const LayoutExhibit& e = layout.exhibits()[0];
+		teapotExhibit = glm::scale(glm::translate(glm::mat4(1.0f), glm::make_vec3(e.position)), glm::vec3(e.scale));
+	}
+	printf("Gallery: %d boxes, %d visitors loaded in %.2f ms\n", layout.boxCount(), layout.visitorCount(), (glfwGetTime() - start) * 1000.0);
 }
 
-void corridor(glm::mat4 Ms, glm::mat4 P, glm::mat4 V)
-{
-	glm::mat4 Mf1 = glm::scale(Ms, glm::vec3(1.0f, 0.025f, 0.45f));
-	texCube(P, V, Mf1, ceiling);
-
-	glm::mat4 Mf2 = glm::scale(Ms, glm::vec3(1.0f, 0.025f, 0.45f));
-	Mf2 = glm::translate(Mf2, glm::vec3(0.0f, 30.0f, 0.0f));
-	texCube(P, V, Mf2, floor10);
-
-	glm::mat4 Mf3 = glm::scale(Ms, glm::vec3(1.0f, 0.375f, 0.025f));
-	Mf3 = glm::translate(Mf3, glm::vec3(0.0f, 1.0f, 17.0f));
-	texCube(P, V, Mf3, wall);
-
-	glm::mat4 Mf4 = glm::scale(Ms, glm::vec3(1.0f, 0.375f, 0.025f));
-	Mf4 = glm::translate(Mf4, glm::vec3(0.0f, 1.0f, -17.0f));
-	texCube(P, V, Mf4, wall);
+//Floors and walls of staticDraws become the navigation grid, paintings its goals
+void buildNavigation() {
+	nav.clear();
+	std::vector<std::pair<glm::vec3, glm::vec3>> paintings;
+	for (const StaticDraw& d : staticDraws) {
+		glm::vec3 center = (d.bmin + d.bmax) * 0.5f, extent = (d.bmax - d.bmin) * 0.5f;
+		if (d.kind == layoutFloor) nav.addFloor(d.bmin, d.bmax);
+		else if (d.kind == layoutCeiling || extent.y < 0.05f) continue;
+		else {
+			nav.addObstacle(d.bmin, d.bmax);
+			if (d.kind == layoutPainting) paintings.push_back({ center, extent });
+		}
+	}
+	nav.build(0.05f, crowd.radius);
+	for (const auto& [center, extent] : paintings) {
+		glm::vec3 normal = extent.x < extent.z ? glm::vec3(1, 0, 0) : glm::vec3(0, 0, 1); //Across the thin side
+		nav.addGoal(center, normal, 0.5f);
+	}
+	//A flow field over a grid this large takes longer than a frame to plan, stress scenes start with walking off (key N)
+	crowd.walking = nav.goalCount() > 0 && (size_t)nav.width * nav.depth <= (1 << 20);
+	nav.printStats();
 }
 
-void paintings(glm::mat4 Ms, glm::mat4 P, glm::mat4 V, int start)
-{
-	/*spTextured->use();*/
-	glm::mat4 Mp1 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp1 = glm::translate(Mp1, glm::vec3(-8.0f, 2.0f, -99.0f));
-	texCube(P, V, Mp1, tex.at(files[start]));
-
-
-	glm::mat4 Mp2 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp2 = glm::translate(Mp2, glm::vec3(-4.0f, 2.0f, -99.0f));
-	texCube(P, V, Mp2, tex.at(files[start+1]));
-
-
-	glm::mat4 Mp3 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp3 = glm::translate(Mp3, glm::vec3(4.0f, 2.0f, -99.0f));
-	texCube(P, V, Mp3, tex.at(files[start+2]));
-
-
-	glm::mat4 Mp4 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp4 = glm::translate(Mp4, glm::vec3(8.0f, 2.0f, -99.0f));
-	texCube(P, V, Mp4, tex.at(files[start+3]));
-
-
-	glm::mat4 Mp0 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp0 = glm::translate(Mp0, glm::vec3(0.0f, 2.0f, -99.0f));
-	texCube(P, V, Mp0, tex.at(files[start+4]));
-
-
-	glm::mat4 Mp5 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp5 = glm::translate(Mp5, glm::vec3(-8.0f, 2.0f, 99.0f));
-	texCube(P, V, Mp5, tex.at(files[start+5]));
-
-
-	glm::mat4 Mp6 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp6 = glm::translate(Mp6, glm::vec3(-4.0f, 2.0f, 99.0f));
-	texCube(P, V, Mp6, tex.at(files[start+6]));
-
-
-	glm::mat4 Mp7 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp7 = glm::translate(Mp7, glm::vec3(4.0f, 2.0f, 99.0f));
-	texCube(P, V, Mp7, tex.at(files[start+7]));
-
+//path names a text layout, compiled next to it with the .layout extension, or a compiled one
+void selectLayout(const std::string& path) {
+	size_t dot = path.find_last_of('.'), slash = path.find_last_of("/\\");
+	std::string base = dot == std::string::npos || (slash != std::string::npos && dot < slash) ? path : path.substr(0, dot);
+	bool compiled = path.compare(base.size(), std::string::npos, ".layout") == 0;
+	galleryText = compiled ? "" : path;
+	galleryLayout = compiled ? path : base + ".layout";
+}
 
-	glm::mat4 Mp8 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp8 = glm::translate(Mp8, glm::vec3(8.0f, 2.0f, 99.0f));
-	texCube(P, V, Mp8, tex.at(files[start+8]));
+//True if the compiled layout is missing or older than its text
+bool layoutStale() {
+	struct stat text, compiled;
+	if (galleryText.empty() || stat(galleryText.c_str(), &text) != 0) return false; //Nothing to compile from
+	return stat(galleryLayout.c_str(), &compiled) != 0 || compiled.st_mtime < text.st_mtime;
+}
 
+//Loads the gallery layout and, if the context allows it, uploads it for multi-draw-indirect submission
+void initGallery() {
+	if (layoutStale()) {
+		printf("Compiling %s\n", galleryText.c_str());
+		compileLayout(galleryText.c_str(), galleryLayout.c_str());
+	}
+	LayoutFile layout;
+	if (!layout.open(galleryLayout.c_str())) exit(EXIT_FAILURE);
+	populateTextures(layout);
+	loadGallery(layout);
+	layout.close();
+
+	if (spGallery != NULL) {
+		int cubeMesh = galleryBatch.addMesh(myCubeVertices, myCubeTexCoords, myCubeVertexCount);
+		for (const StaticDraw& d : staticDraws) galleryBatch.addDraw(cubeMesh, d.M, d.tex);
+		galleryBatch.upload();
+		useGalleryBatch = true;
+		useOcclusionCulling = (spCull != NULL);
+	}
 
-	glm::mat4 Mp9 = glm::scale(Ms, glm::vec3(0.18f, 0.18f, 0.02f));
-	Mp9 = glm::translate(Mp9, glm::vec3(0.0f, 2.0f, 99.0f));
-	texCube(P, V, Mp9, tex.at(files[start+9]));
+	buildNavigation();
 
+	//Segments of about 8 pixels: a patch covers roughly a quarter of the teapot's diameter
+	double start = glfwGetTime();
+	const int divisions[] = { 32, 16, 8, 4, 2 };
+	bezierTeapotLod.clear();
+	for (int d : divisions) bezierTeapotLod.add(&Models::teapotSurface.tessellate(d), d > 2 ? 32.0f * d : 0.0f);
+	printf("Bezier teapot: %d patches tessellated at 5 levels in %.1f ms\n", Models::teapotSurface.patchCount(), (glfwGetTime() - start) * 1000.0);
+	bezierTeapotLod.printStats("Bezier teapot");
 }
 
-void endPaintings(glm::mat4 Ms, glm::mat4 P, glm::mat4 V, int start)
-{
-
-	glm::mat4 Mp2 = glm::scale(Ms, glm::vec3(0.02f, 0.18f, 0.18f));
-	Mp2 = glm::translate(Mp2, glm::vec3(-99.0f, 2.0f, 6.5f));
-	texCube(P, V, Mp2, tex.at(files[start]));
-
-	glm::mat4 Mp3 = glm::scale(Ms, glm::vec3(0.02f, 0.18f, 0.18f));
-	Mp3 = glm::translate(Mp3, glm::vec3(-99.0f, 2.0f, -6.5f));
-	texCube(P, V, Mp3, tex.at(files[start+1]));
+//Everything the render thread needs for one frame, built by the simulation thread
+struct FramePacket {
+	glm::mat4 P;
+	glm::mat4 V;
+	int width, height; //Framebuffer size
+	double inputTime; //When the input this frame shows was sampled
+	CrowdFrame crowd;
+	int teapotLevel; //Level of bezierTeapotLod, -1 tessellates on the GPU
+	float teapotTessLevel;
+	std::vector<int> visibleStatic; //staticDraws inside the view frustum, for the path without galleryBatch
+	bool occlusionCulling;
+	bool showCulled;
+	bool packedVertices;
+	bool lowLatency;
+	int framesInFlight;
+	int screenshots; //screenshotRequests, a screenshot is due when it grows
+	bool recording;
+};
 
-	glm::mat4 Mp4 = glm::scale(Ms, glm::vec3(0.02f, 0.18f, 0.18f));
-	Mp4 = glm::translate(Mp4, glm::vec3(99.0f, 2.0f, 6.5f));
-	texCube(P, V, Mp4, tex.at(files[start+2]));
+TripleBuffer<FramePacket> framePackets;
+std::atomic<bool> renderWaiting(false); //The render thread wants the next packet (low latency mode)
+std::atomic<bool> quitRendering(false);
 
-	glm::mat4 Mp5 = glm::scale(Ms, glm::vec3(0.02f, 0.18f, 0.18f));
-	Mp5 = glm::translate(Mp5, glm::vec3(99.0f, 2.0f, -6.5f));
-	texCube(P, V, Mp5, tex.at(files[start+3]));
+//Yields, then sleeps, until done() holds or rendering stops
+template <class Condition> void waitUntil(Condition done) {
+	for (int spins = 0; !done() && !quitRendering.load(); spins++) {
+		if (spins < 64) std::this_thread::yield();
+		else std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
 }
 
-void midPainting(glm::mat4 Ms, glm::mat4 P, glm::mat4 V, int start)
-{
-	glm::mat4 Mp1 = glm::scale(Ms, glm::vec3(0.02f, 0.18f, 0.18f));
-	Mp1 = glm::translate(Mp1, glm::vec3(-99.0f, -2.0f, 0.0f));
-	texCube(P, V, Mp1, tex.at(files[start]));
+//Static draws whose bounds intersect the frustum of PV (planes from the rows of PV)
+void cullStatic(const glm::mat4& PV, std::vector<int>& visible) {
+	glm::vec4 planes[6];
+	for (int i = 0; i < 3; i++) {
+		glm::vec4 row(PV[0][i], PV[1][i], PV[2][i], PV[3][i]), w(PV[0][3], PV[1][3], PV[2][3], PV[3][3]);
+		planes[2 * i] = w + row;
+		planes[2 * i + 1] = w - row;
+	}
+	visible.clear();
+	for (int d = 0; d < (int)staticDraws.size(); d++) {
+		const glm::vec3& bmin = staticDraws[d].bmin;
+		const glm::vec3& bmax = staticDraws[d].bmax;
+		bool inside = true;
+		for (int p = 0; p < 6 && inside; p++) {
+			glm::vec3 n(planes[p]);
+			glm::vec3 farthest(n.x > 0 ? bmax.x : bmin.x, n.y > 0 ? bmax.y : bmin.y, n.z > 0 ? bmax.z : bmin.z);
+			inside = glm::dot(n, farthest) + planes[p].w >= 0;
+		}
+		if (inside) visible.push_back(d);
+	}
 }
 
-void character(glm::mat4 Ms, float r, float g, float b) {
-  Ms = glm::rotate(Ms, mov * 0.05f, glm::vec3(0.0f, 1.0f, 0.0f));
-	Ms = glm::translate(Ms, glm::vec3(mov * 0.007f, -0.68f, 0.0f));
-	spLambert->use();
-
-	// Corpus
-	glm::mat4 Mp = glm::scale(Ms, 0.1f * glm::vec3(0.125f, 0.5f, 0.5f));
-	Mp = glm::translate(Mp, glm::vec3(0.0f, 2.0f, 0.0f));
-	glUniform4f(spLambert->u("color"), r,g,b, 1);
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Mp));
-	Models::cube.drawSolid();
-
-	/* // Legs*/
-	glm::mat4 Ml = glm::scale(Ms, 0.1f * glm::vec3(0.125f, 0.5f, 0.20f));
-	Ml = glm::translate(Ml, glm::vec3(0.0f, 0.0f, -1.5f));
-	glUniform4f(spLambert->u("color"), 0, 0, 0, 1);
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Ml));
-	Models::cube.drawSolid();
-	glm::mat4 Ml2 = glm::scale(Ms, 0.1f * glm::vec3(0.125f, 0.5f, 0.20f));
-	Ml2 = glm::translate(Ml2, glm::vec3(0.0f, 0.0f, 1.5));
-	glUniform4f(spLambert->u("color"), 0, 0, 0, 1);
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Ml2));
-	Models::cube.drawSolid();
-
-  // Hands
-	glm::mat4 Mr = glm::scale(Ms, 0.1f * glm::vec3(0.125f, 0.5f, 0.20f));
-	Mr = glm::translate(Mr, glm::vec3(0.0f, 2.0f, 3.5f));
-	glUniform4f(spLambert->u("color"), r, g, b, 1);
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Mr));
-	Models::cube.drawSolid();
-	glm::mat4 Mr2 = glm::scale(Ms, 0.1f * glm::vec3(0.125f, 0.5f, 0.20f));
-	Mr2 = glm::translate(Mr2, glm::vec3(0.0f, 2.0f, -3.5f));
-	glUniform4f(spLambert->u("color"), r, g, b, 1);
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Mr2));
-	Models::cube.drawSolid();
-
-  // Head
-  glm::mat4 Mh = glm::scale(Ms, 0.1f * glm::vec3(0.5, 0.5, 0.5));
-  Mh = glm::translate(Mh, glm::vec3(0.0f, 4.0f, 0.0f));
-	glUniform4f(spLambert->u("color"), 1.0f, 0.89f, 0.8f, 1);
-	glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(Mh));
-  Models::sphere.drawSolid();
+//Simulation thread: camera, LOD choices, crowd placements and culling for the frame, alpha - how far past the last simulation step it is (in steps)
+void buildFramePacket(GLFWwindow* window, float alpha, FramePacket& packet) {
+	glfwGetFramebufferSize(window, &packet.width, &packet.height);
+	if (packet.height > 0) viewportHeight = (float)packet.height;
+
+	eyePos = glm::mix(previousCameraPos, cameraPos, alpha);
+	packet.P = glm::perspective(glm::radians(fov), 1920.0f/1080.0f, 0.1f, 100.0f);
+	packet.V = glm::lookAt(eyePos, eyePos + cameraFront, cameraUp);
+
+	crowd.update(glm::mix(previousMov, mov, alpha), alpha);
+	crowd.prepare(eyePos, glm::radians(fov), viewportHeight, useLod, packet.crowd);
+
+	float size = Models::projectedSize(teapotExhibit, bezierTeapotLod.radius, eyePos, glm::radians(fov), viewportHeight);
+	if (useTessellationShader) packet.teapotLevel = -1;
+	else packet.teapotLevel = teapotExhibitLod = bezierTeapotLod.select(size, teapotExhibitLod);
+	packet.teapotTessLevel = glm::clamp(size / 32.0f, 1.0f, 64.0f);
+
+	if (useGalleryBatch) packet.visibleStatic.clear();
+	else cullStatic(packet.P * packet.V, packet.visibleStatic);
+
+	packet.occlusionCulling = useOcclusionCulling;
+	packet.showCulled = showCulled;
+	packet.packedVertices = usePackedVertices;
+	packet.lowLatency = lowLatency;
+	packet.framesInFlight = framesInFlight;
+	packet.screenshots = screenshotRequests;
+	packet.recording = recording;
+	packet.inputTime = glfwGetTime();
 }
 
+void drawTeapotExhibit(const FramePacket& packet) {
+	if (packet.teapotLevel < 0) {
+		spBezier->use();
+		glUniformMatrix4fv(spBezier->u("P"), 1, false, glm::value_ptr(packet.P));
+		glUniformMatrix4fv(spBezier->u("V"), 1, false, glm::value_ptr(packet.V));
+		glUniformMatrix4fv(spBezier->u("M"), 1, false, glm::value_ptr(teapotExhibit));
+		glUniform4f(spBezier->u("color"), 0.9f, 0.9f, 0.95f, 1);
+		Models::teapotSurface.drawTessellated(packet.teapotTessLevel);
+	}
+	else {
+		spLambert->use();
+		glUniformMatrix4fv(spLambert->u("M"), 1, false, glm::value_ptr(teapotExhibit));
+		glUniform4f(spLambert->u("color"), 0.9f, 0.9f, 0.95f, 1);
+		drawModel(bezierTeapotLod.level(packet.teapotLevel), true, packet.packedVertices);
+	}
+}
 
-
-
-//Drawing procedure
-void drawScene(GLFWwindow* window) {
+//Drawing procedure, render thread: GL calls for one packet
+void drawScene(GLFWwindow* window, const FramePacket& packet) {
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); //Clear color and depth buffers
 
-	glm::mat4 Ms = glm::mat4(1.0f);
-
-	glm::mat4 P = glm::perspective(glm::radians(fov), 1920.0f/1080.0f, 0.1f, 100.0f);
-	glm::mat4 V = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
-
+	const glm::mat4& P = packet.P;
+	const glm::mat4& V = packet.V;
 	spLambert->use();//Aktywacja programu cieniującego
-    character(glm::translate(Ms, glm::vec3(-1.3f, 0.0f, 0.0f)),0.3f,0.8f, 0.34f);
 	glUniformMatrix4fv(spLambert->u("P"), 1, false, glm::value_ptr(P));
 	glUniformMatrix4fv(spLambert->u("V"), 1, false, glm::value_ptr(V));
 
+	crowd.draw(P, V, packet.crowd, packet.packedVertices);
+	if (hasTeapotExhibit) drawTeapotExhibit(packet);
 
+	if (useGalleryBatch) {
+		if (packet.occlusionCulling) galleryBatch.cull(P, V, hiz);
+		galleryBatch.draw(P, V);
+		if (packet.occlusionCulling && packet.showCulled) galleryBatch.drawCulled(P, V);
+	}
+	else {
+		for (int d : packet.visibleStatic) texCube(P, V, staticDraws[d].M, staticDraws[d].tex);
+	}
 
-	spTextured->use();
-	//glBindTexture(GL_TEXTURE_2D, tex1);
-
-	// pokoj 1 + korytarz
-	midPainting(Ms,P,V,14);
-	Ms = glm::rotate(Ms, PI, glm::vec3(0.0f, 0.0f, 1.0f));
-	room1exit(Ms,P,V);
-	paintings(Ms,P,V,0);
-	endPaintings(Ms, P, V, 10);
-
-	Ms = glm::rotate(Ms, PI, glm::vec3(0.0f, 1.0f, 0.0f));
-	Ms = glm::translate(Ms, glm::vec3(3.0f, 0.0f, 0.0f));
-	corridor(Ms,P,V);
-	Ms = glm::translate(Ms, glm::vec3(3.0f, 0.0f, 0.0f));
-
-
-	//pokoj 2 + korytarz
-	room2exit(Ms, P, V);
-	endPaintings(Ms, P, V,15);
-	paintings(Ms,P,V,19);
-	Ms = glm::translate(Ms, glm::vec3(3.0f, 0.0f, 0.0f));
-
-	glm::mat4 Mludz = glm::translate(Ms, glm::vec3(-3.0f, 0.0f, 1.5f));
-	Mludz = glm::rotate(Mludz, PI, glm::vec3(0.0f, 0.0f, 1.0f));
-	Mludz = glm::rotate(Mludz, PI/2, glm::vec3(0.0f, 1.0f, 0.0f));
-
-	
-	character(Mludz, 0.136f, 0.38f, 0.834f);
-
-	corridor(Ms, P, V);
-	Ms = glm::translate(Ms, glm::vec3(3.0f, 0.0f, 0.0f));
-
-	//pokoj 3 + korytarz
-	room2exit(Ms, P, V);
-	paintings(Ms, P, V,29);
-	endPaintings(Ms, P, V,39);
-	Ms = glm::translate(Ms, glm::vec3(3.0f, 0.0f, 0.0f));
-
-	glm::mat4 Mludz2 = glm::translate(Ms, glm::vec3(-3.9f, 0.0f, -1.5f));
-	Mludz2 = glm::rotate(Mludz2, PI, glm::vec3(0.0f, 0.0f, 1.0f));
-	Mludz2 = glm::rotate(Mludz2, PI / 2, glm::vec3(0.0f, 1.0f, 0.0f));
-	character(Mludz2, 0.836f, 0.08f, 0.234f);
-
-	corridor(Ms, P, V);
-	Ms = glm::translate(Ms, glm::vec3(3.0f, 0.0f, 0.0f));
-	
-	//pokoj 4
-	room1exit(Ms, P, V);
-	paintings(Ms, P, V, 43);
-	endPaintings(Ms, P, V,53);
-	Ms = glm::rotate(Ms, PI, glm::vec3(0.0f, 1.0f, 0.0f));
-	Ms = glm::translate(Ms, glm::vec3(0.0f, 0.72f, 0.0f));
-	midPainting(Ms, P, V,57);
-
-	glm::mat4 Mludz3 = glm::translate(Ms, glm::vec3(-3.9f, 0.0f, -1.5f));
-	Mludz3 = glm::rotate(Mludz3, PI, glm::vec3(0.0f, 0.0f, 1.0f));
-	Mludz3 = glm::rotate(Mludz3, PI / 2, glm::vec3(0.0f, 1.0f, 0.0f));
-	Mludz3 = glm::translate(Mludz3,  glm::vec3(-3.0f, 0.7f, -3.0f));
-
-	character(Mludz3, 0.536f, 0.38f, 0.534f);
-
-
-	Ms = glm::rotate(Ms, PI, glm::vec3(0.0f, 1.0f, 0.0f));
+	if (packet.occlusionCulling) hiz.build(packet.width, packet.height); //Occluders for the next frame
 
+	frameCapture.capture(packet.width, packet.height, packet.screenshots != capturedScreenshots, packet.recording);
+	capturedScreenshots = packet.screenshots;
 	glfwSwapBuffers(window); //Copy back buffer to the front buffer
+	framePacer.frameSubmitted(packet.inputTime);
+}
+
+//Render thread: owns the GL context, draws the newest frame packet while the main thread simulates the next one
+void renderLoop(GLFWwindow* window) {
+	glfwMakeContextCurrent(window);
+	bool occlusionCulling = false;
+	while (!quitRendering.load()) {
+		framePacer.waitForFrames();
+		renderWaiting.store(true);
+		waitUntil([] { return !framePackets.consumed(); });
+		renderWaiting.store(false);
+		if (!framePackets.acquire()) continue;
+
+		const FramePacket& packet = framePackets.readBuffer();
+		if (packet.lowLatency != framePacer.lowLatency()) {
+			framePacer.printStats();
+			framePacer.setLowLatency(packet.lowLatency);
+		}
+		if (packet.framesInFlight != framePacer.framesInFlight()) {
+			framePacer.printStats();
+			framePacer.setFramesInFlight(packet.framesInFlight);
+		}
+		if (occlusionCulling && !packet.occlusionCulling) hiz.release(); //The pyramid goes stale while culling is off
+		occlusionCulling = packet.occlusionCulling;
+		applyReloads();
+		drawScene(window, packet);
+	}
+	glfwMakeContextCurrent(NULL);
 }
 
-int main(void)
+//Usage: main_file [layout], layout - text or compiled gallery layout, gallery.txt by default (gallerygen writes stress scenes)
+int main(int argc, char** argv)
 {
 	GLFWwindow* window; //Pointer to object that represents the application window
 
+	if (argc > 1) selectLayout(argv[1]);
+
 	glfwSetErrorCallback(error_callback);//Register error processing callback procedure
 
 	if (!glfwInit()) { //Initialize GLFW library
@@ -607,20 +784,41 @@ int main(void)
 
   glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
   glfwSetScrollCallback(window, scroll_callback);
+  glfwSetKeyCallback(window, key_callback);
   glfwSetCursorPosCallback(window, mouse_callback);
+	framePacer.setup(window);
+
+	//The render thread takes the context over, the main thread polls events and simulates
+	glfwMakeContextCurrent(NULL);
+	std::thread renderer(renderLoop, window);
 
 	//Main application loop
 	glfwSetTime(0); //clear internal timer
+	double lastFrame = 0.0;
 	while (!glfwWindowShouldClose(window)) //As long as the window shouldnt be closed yet...
 	{
-    float currentFrame = static_cast<float>(glfwGetTime());
-    mov += 0.007f * currentFrame;
-    deltaTime = currentFrame - lastFrame;
+		//Low latency: sample input just in time for the render thread; otherwise stay one packet ahead of it
+		if (lowLatency) waitUntil([] { return renderWaiting.load() && framePackets.consumed(); });
+		else waitUntil([] { return framePackets.consumed(); });
+		glfwPollEvents(); //Process callback procedures corresponding to the events that took place up to now
+		pollAssets();
+
+    double currentFrame = glfwGetTime();
+    simulationTime += std::min(currentFrame - lastFrame, maxFrameTime);
     lastFrame = currentFrame;
     processInput(window);
-		drawScene(window); //Execute drawing procedure
-		glfwPollEvents(); //Process callback procedures corresponding to the events that took place up to now
+    double step = 1.0 / simulationRate;
+    while (simulationTime >= step) {
+      simulate((float)step);
+      simulationTime -= step;
+    }
+		buildFramePacket(window, (float)(simulationTime / step), framePackets.writeBuffer());
+		framePackets.publish();
 	}
+	quitRendering.store(true);
+	renderer.join();
+
+	glfwMakeContextCurrent(window);
 	freeOpenGLProgram(window);
 
 	glfwDestroyWindow(window); //Delete OpenGL context and the window.
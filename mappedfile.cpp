@@ -0,0 +1,117 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include "mappedfile.h"
+#include <stdio.h>
+#include <utility>
+
+MappedFile::MappedFile() {
+	bytes = NULL;
+	length = 0;
+#ifdef _WIN32
+	fileHandle = NULL;
+	mappingHandle = NULL;
+#endif
+}
+
+MappedFile::~MappedFile() {
+	close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) : MappedFile() {
+	swap(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+	close();
+	swap(other);
+	return *this;
+}
+
+void MappedFile::swap(MappedFile& other) {
+	std::swap(bytes, other.bytes);
+	std::swap(length, other.length);
+#ifdef _WIN32
+	std::swap(fileHandle, other.fileHandle);
+	std::swap(mappingHandle, other.mappingHandle);
+#endif
+}
+
+bool MappedFile::open(const char* path) {
+	close();
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	HANDLE mapping = NULL;
+	if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping != NULL) bytes = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (bytes == NULL) {
+		if (mapping != NULL) CloseHandle(mapping);
+		CloseHandle(file);
+		fprintf(stderr, "%s: cannot map\n", path);
+		return false;
+	}
+	fileHandle = file;
+	mappingHandle = mapping;
+	length = (size_t)fileSize.QuadPart;
+#else
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return false;
+	}
+	struct stat st;
+	void* p = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size > 0) p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); //The mapping keeps the file alive
+	if (p == MAP_FAILED) {
+		fprintf(stderr, "%s: cannot map\n", path);
+		return false;
+	}
+	bytes = (const unsigned char*)p;
+	length = (size_t)st.st_size;
+#endif
+	return true;
+}
+
+void MappedFile::close() {
+	if (bytes == NULL) return;
+#ifdef _WIN32
+	UnmapViewOfFile(bytes);
+	CloseHandle((HANDLE)mappingHandle);
+	CloseHandle((HANDLE)fileHandle);
+	fileHandle = NULL;
+	mappingHandle = NULL;
+#else
+	munmap((void*)bytes, length);
+#endif
+	bytes = NULL;
+	length = 0;
+}
@@ -0,0 +1,50 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+//Read-only memory mapping of a whole file (mmap, MapViewOfFile on Windows).
+//Binary assets (.mesh, .layout) are used in place through it.
+
+#include <stddef.h>
+
+class MappedFile {
+public:
+	MappedFile();
+	~MappedFile();
+	MappedFile(MappedFile&& other); //Takes the mapping over, other ends up closed
+	MappedFile& operator=(MappedFile&& other);
+
+	bool open(const char* path); //Prints the reason and returns false on failure, empty files cannot be mapped
+	void close();
+	bool isOpen() const { return bytes != NULL; }
+
+	const unsigned char* data() const { return bytes; }
+	size_t size() const { return length; }
+
+private:
+	const unsigned char* bytes;
+	size_t length;
+#ifdef _WIN32
+	void* fileHandle;
+	void* mappingHandle;
+#endif
+
+	void swap(MappedFile& other);
+};
+
+#endif
@@ -0,0 +1,502 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "mesh.h"
+#include "jobs.h"
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <map>
+#include <queue>
+#include <algorithm>
+#include <chrono>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace Models {
+
+	Mesh::Mesh() {
+		acmrBefore = 0;
+		acmrAfter = 0;
+		finalizeSeconds = 0;
+	}
+
+	Mesh::~Mesh() {
+	}
+
+	void Mesh::finalize() {
+		auto start = std::chrono::steady_clock::now();
+		acmrBefore = computeACMR(internalIndices, internalVertices.size());
+		vector<unsigned int> optimized = internalIndices;
+		optimizeVertexCache(optimized, internalVertices.size());
+		acmrAfter = computeACMR(optimized, internalVertices.size());
+		if (acmrAfter < acmrBefore) internalIndices.swap(optimized); //Small grids can already fit the cache in build order
+		else acmrAfter = acmrBefore;
+		reorderVertices();
+
+		vertices = (float*)internalVertices.data();
+		vertexNormals = (float*)internalVertexNormals.data();
+		normals = vertexNormals; //Face normals only exist in the flat copy
+		texCoords = internalTexCoords.empty() ? vertexNormals : (float*)internalTexCoords.data();
+		colors = NULL;
+		vertexCount = internalVertices.size();
+		indexCount = internalIndices.size();
+
+		internalIndices16.clear();
+		if (internalVertices.size() <= 65536) {
+			internalIndices16.assign(internalIndices.begin(), internalIndices.end());
+			indices = internalIndices16.data();
+			indexType = GL_UNSIGNED_SHORT;
+		}
+		else {
+			indices = internalIndices.data();
+			indexType = GL_UNSIGNED_INT;
+		}
+
+		clearCaches();
+		finalizeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void Mesh::clearCaches() {
+		flatVertices.clear();
+		flatNormals.clear();
+		flatTexCoords.clear();
+		packedVertices.clear();
+		packedFaceNormals.clear();
+	}
+
+	void Mesh::build(const vector<vec4> &vertices, const vector<vec4> &vertexNormals, const vector<vec4> &texCoords, const vector<unsigned int> &indices) {
+		internalVertices = vertices;
+		internalVertexNormals = vertexNormals;
+		internalTexCoords = texCoords;
+		internalIndices = indices;
+		finalize();
+	}
+
+	//Renumbers vertices in the order of their first use, so fetches walk memory forward
+	void Mesh::reorderVertices() {
+		vector<int> remap(internalVertices.size(), -1);
+		vector<vec4> newVertices, newNormals, newTexCoords;
+		newVertices.reserve(internalVertices.size());
+		newNormals.reserve(internalVertices.size());
+		newTexCoords.reserve(internalTexCoords.size());
+
+		for (size_t i = 0; i < internalIndices.size(); i++) {
+			unsigned int v = internalIndices[i];
+			if (remap[v] < 0) {
+				remap[v] = (int)newVertices.size();
+				newVertices.push_back(internalVertices[v]);
+				newNormals.push_back(internalVertexNormals[v]);
+				if (!internalTexCoords.empty()) newTexCoords.push_back(internalTexCoords[v]);
+			}
+			internalIndices[i] = remap[v];
+		}
+
+		internalVertices.swap(newVertices);
+		internalVertexNormals.swap(newNormals);
+		internalTexCoords.swap(newTexCoords);
+	}
+
+	void Mesh::buildFlat() {
+		const vec4* v = (const vec4*)vertices;
+		const vec4* tc = (const vec4*)texCoords;
+
+		flatVertices.reserve(indexCount);
+		flatNormals.reserve(indexCount);
+		flatTexCoords.reserve(indexCount);
+
+		for (int t = 0; t + 2 < indexCount; t += 3) {
+			unsigned int i[3];
+			for (int k = 0; k < 3; k++) i[k] = indexType == GL_UNSIGNED_SHORT ? ((const unsigned short*)indices)[t + k] : ((const unsigned int*)indices)[t + k];
+			vec3 a = vec3(v[i[1]] - v[i[0]]);
+			vec3 b = vec3(v[i[2]] - v[i[0]]);
+			vec4 normal = normalize(vec4(cross(b, a), 0.0f));
+
+			for (int k = 0; k < 3; k++) {
+				flatVertices.push_back(v[i[k]]);
+				flatNormals.push_back(normal);
+				flatTexCoords.push_back(tc[i[k]]);
+			}
+		}
+	}
+
+	void Mesh::drawSolid(bool smooth) {
+		if (!smooth && flatVertices.empty()) buildFlat();
+
+		glEnableVertexAttribArray(0);
+		glEnableVertexAttribArray(1);
+		glEnableVertexAttribArray(2);
+
+		if (smooth) {
+			glVertexAttribPointer(0, 4, GL_FLOAT, false, 0, vertices);
+			glVertexAttribPointer(1, 4, GL_FLOAT, false, 0, vertexNormals);
+			glVertexAttribPointer(2, 4, GL_FLOAT, false, 0, texCoords);
+			glDrawElements(GL_TRIANGLES, indexCount, indexType, indices);
+		}
+		else {
+			glVertexAttribPointer(0, 4, GL_FLOAT, false, 0, flatVertices.data());
+			glVertexAttribPointer(1, 4, GL_FLOAT, false, 0, flatNormals.data());
+			glVertexAttribPointer(2, 4, GL_FLOAT, false, 0, flatTexCoords.data());
+			glDrawArrays(GL_TRIANGLES, 0, (GLsizei)flatVertices.size());
+		}
+
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(1);
+		glDisableVertexAttribArray(2);
+	}
+
+	void Mesh::printStats(const char* name) {
+		//Unindexed drawing runs the vertex shader 3 times per triangle, ACMR is the indexed equivalent
+		printf("%s: %d vertices, %d triangles, %d-bit indices, ACMR %.3f -> %.3f (%.1fx fewer vertex shader runs than unindexed)\n",
+			name, vertexCount, indexCount / 3, indexType == GL_UNSIGNED_SHORT ? 16 : 32,
+			acmrBefore, acmrAfter, acmrAfter > 0 ? 3.0f / acmrAfter : 0.0f);
+	}
+
+
+	//Forsyth's scoring: recently used vertices and vertices with few remaining
+	//triangles are preferred, the three most recent ones get a fixed score so
+	//that strips are not forced
+	static const int forsythCacheSize = 32;
+
+	static float forsythVertexScore(int cachePosition, int remainingTriangles) {
+		if (remainingTriangles == 0) return -1.0f;
+
+		float score = 0.0f;
+		if (cachePosition >= 0) {
+			if (cachePosition < 3) score = 0.75f;
+			else score = powf(1.0f - (cachePosition - 3) / (float)(forsythCacheSize - 3), 1.5f);
+		}
+		return score + 2.0f / sqrtf((float)remainingTriangles);
+	}
+
+	void optimizeVertexCache(vector<unsigned int> &indices, size_t vertexCount) {
+		size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0) return;
+
+		//Triangles adjacent to every vertex; the first remaining[v] entries are the not yet emitted ones
+		vector<unsigned int> adjacencyStart(vertexCount + 1, 0);
+		for (size_t i = 0; i < triangleCount * 3; i++) adjacencyStart[indices[i] + 1]++;
+		for (size_t v = 0; v < vertexCount; v++) adjacencyStart[v + 1] += adjacencyStart[v];
+
+		vector<unsigned int> adjacency(triangleCount * 3);
+		vector<int> remaining(vertexCount, 0);
+		for (size_t t = 0; t < triangleCount; t++) {
+			for (int i = 0; i < 3; i++) {
+				unsigned int v = indices[t * 3 + i];
+				adjacency[adjacencyStart[v] + remaining[v]++] = (unsigned int)t;
+			}
+		}
+
+		vector<int> cachePosition(vertexCount, -1);
+		vector<float> vertexScore(vertexCount);
+		for (size_t v = 0; v < vertexCount; v++) vertexScore[v] = forsythVertexScore(-1, remaining[v]);
+
+		vector<float> triangleScore(triangleCount);
+		vector<char> emitted(triangleCount, 0);
+		for (size_t t = 0; t < triangleCount; t++) {
+			triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+		}
+
+		vector<unsigned int> cache, newCache;
+		cache.reserve(forsythCacheSize + 3);
+		newCache.reserve(forsythCacheSize + 3);
+
+		vector<unsigned int> result;
+		result.reserve(triangleCount * 3);
+
+		long best = 0;
+		for (size_t t = 1; t < triangleCount; t++) if (triangleScore[t] > triangleScore[best]) best = (long)t;
+
+		size_t scan = 0; //Fallback cursor when nothing in the cache has triangles left
+		for (size_t n = 0; n < triangleCount; n++) {
+			if (best < 0) {
+				while (emitted[scan]) scan++;
+				best = (long)scan;
+			}
+
+			const unsigned int* tri = &indices[best * 3];
+			emitted[best] = 1;
+			result.push_back(tri[0]);
+			result.push_back(tri[1]);
+			result.push_back(tri[2]);
+
+			//Drop the triangle from the active adjacency of its vertices
+			for (int i = 0; i < 3; i++) {
+				unsigned int v = tri[i];
+				unsigned int* adj = &adjacency[adjacencyStart[v]];
+				for (int j = 0; j < remaining[v]; j++) {
+					if (adj[j] == (unsigned int)best) {
+						adj[j] = adj[remaining[v] - 1];
+						adj[remaining[v] - 1] = (unsigned int)best;
+						remaining[v]--;
+						break;
+					}
+				}
+			}
+
+			//LRU update: the triangle's vertices move to the front
+			newCache.clear();
+			newCache.push_back(tri[0]);
+			newCache.push_back(tri[1]);
+			newCache.push_back(tri[2]);
+			for (size_t i = 0; i < cache.size(); i++) {
+				unsigned int v = cache[i];
+				if (v != tri[0] && v != tri[1] && v != tri[2]) newCache.push_back(v);
+			}
+
+			for (size_t i = 0; i < newCache.size(); i++) {
+				unsigned int v = newCache[i];
+				cachePosition[v] = i < (size_t)forsythCacheSize ? (int)i : -1;
+				vertexScore[v] = forsythVertexScore(cachePosition[v], remaining[v]);
+			}
+
+			//Rescore the triangles touched by the cache and pick the best one
+			best = -1;
+			float bestScore = -1.0f;
+			for (size_t i = 0; i < newCache.size(); i++) {
+				unsigned int v = newCache[i];
+				const unsigned int* adj = &adjacency[adjacencyStart[v]];
+				for (int j = 0; j < remaining[v]; j++) {
+					unsigned int t = adj[j];
+					float score = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+					triangleScore[t] = score;
+					if (score > bestScore) {
+						bestScore = score;
+						best = (long)t;
+					}
+				}
+			}
+
+			if (newCache.size() > (size_t)forsythCacheSize) newCache.resize(forsythCacheSize);
+			cache.swap(newCache);
+		}
+
+		indices.swap(result);
+	}
+
+	float computeACMR(const vector<unsigned int> &indices, size_t vertexCount, int cacheSize) {
+		if (indices.size() < 3) return 0.0f;
+
+		//A vertex is in the FIFO while fewer than cacheSize misses happened after it was loaded
+		vector<long> loadedAt(vertexCount, -1);
+		long misses = 0;
+		for (size_t i = 0; i < indices.size(); i++) {
+			long stamp = loadedAt[indices[i]];
+			if (stamp < 0 || misses - stamp > cacheSize) {
+				loadedAt[indices[i]] = misses;
+				misses++;
+			}
+		}
+		return (float)misses / (float)(indices.size() / 3);
+	}
+
+	void sinCosTable(double first, double step, int count, vector<float> &sines, vector<float> &cosines) {
+		sines.resize(count + 1);
+		cosines.resize(count + 1);
+		for (int i = 0; i <= count; i++) {
+			sines[i] = (float)sin(first + i * step);
+			cosines[i] = (float)cos(first + i * step);
+		}
+	}
+
+	void parallelRanges(int count, int minPerThread, const function<void(int, int)> &body) {
+		Jobs::parallelFor(0, count, minPerThread, body);
+	}
+
+
+	SimplifiedMesh::SimplifiedMesh(const float *vertices, const float *vertexNormals, const float *texCoords, int vertexCount, float fraction) {
+		vector<vec4> v, n, tc;
+		vector<unsigned int> indices;
+		weldVertices(vertices, vertexNormals, texCoords, vertexCount, v, n, tc, indices);
+		simplifyMesh(v, indices, (size_t)(indices.size() / 3 * fraction));
+		build(v, n, tc, indices);
+	}
+
+	SimplifiedMesh::~SimplifiedMesh() {
+	}
+
+
+	void weldVertices(const float *vertices, const float *vertexNormals, const float *texCoords, int vertexCount,
+		vector<vec4> &outVertices, vector<vec4> &outNormals, vector<vec4> &outTexCoords, vector<unsigned int> &outIndices, bool weldTexCoords) {
+		map<vector<float>, unsigned int> unique;
+		vector<float> key(weldTexCoords ? 12 : 8);
+
+		outIndices.resize(vertexCount);
+		for (int i = 0; i < vertexCount; i++) {
+			memcpy(&key[0], vertices + 4 * i, 4 * sizeof(float));
+			memcpy(&key[4], vertexNormals + 4 * i, 4 * sizeof(float));
+			if (weldTexCoords) memcpy(&key[8], texCoords + 4 * i, 4 * sizeof(float));
+
+			map<vector<float>, unsigned int>::iterator it = unique.find(key);
+			if (it == unique.end()) {
+				it = unique.insert(make_pair(key, (unsigned int)outVertices.size())).first;
+				outVertices.push_back(make_vec4(vertices + 4 * i));
+				outNormals.push_back(make_vec4(vertexNormals + 4 * i));
+				outTexCoords.push_back(make_vec4(texCoords + 4 * i));
+			}
+			outIndices[i] = it->second;
+		}
+	}
+
+
+	//Symmetric 4x4 quadric stored as its 10 unique coefficients
+	struct Quadric {
+		double a[10];
+
+		Quadric() { for (int i = 0; i < 10; i++) a[i] = 0; }
+
+		void addPlane(const dvec3 &n, double d, double weight) {
+			a[0] += weight * n.x * n.x; a[1] += weight * n.x * n.y; a[2] += weight * n.x * n.z; a[3] += weight * n.x * d;
+			a[4] += weight * n.y * n.y; a[5] += weight * n.y * n.z; a[6] += weight * n.y * d;
+			a[7] += weight * n.z * n.z; a[8] += weight * n.z * d;
+			a[9] += weight * d * d;
+		}
+
+		void add(const Quadric &q) { for (int i = 0; i < 10; i++) a[i] += q.a[i]; }
+
+		double error(const dvec3 &p) const {
+			return a[0] * p.x * p.x + 2 * a[1] * p.x * p.y + 2 * a[2] * p.x * p.z + 2 * a[3] * p.x
+				+ a[4] * p.y * p.y + 2 * a[5] * p.y * p.z + 2 * a[6] * p.y
+				+ a[7] * p.z * p.z + 2 * a[8] * p.z
+				+ a[9];
+		}
+	};
+
+	struct Collapse {
+		double cost;
+		unsigned int from, to;
+		unsigned int fromVersion, toVersion;
+
+		bool operator<(const Collapse &c) const { return cost > c.cost; } //Cheapest on top of the queue
+	};
+
+	void simplifyMesh(const vector<vec4> &vertices, vector<unsigned int> &indices, size_t targetTriangles) {
+		size_t triangleCount = indices.size() / 3;
+		size_t vertexCount = vertices.size();
+		if (triangleCount <= targetTriangles) return;
+
+		vector<dvec3> p(vertexCount);
+		for (size_t v = 0; v < vertexCount; v++) p[v] = dvec3(vertices[v]);
+
+		vector<vector<unsigned int> > triangles(vertexCount); //Live triangles around every vertex
+		vector<Quadric> quadrics(vertexCount);
+		map<pair<unsigned int, unsigned int>, int> edgeUse; //Boundary edges are used by one triangle only
+
+		for (size_t t = 0; t < triangleCount; t++) {
+			unsigned int *tri = &indices[t * 3];
+			dvec3 n = cross(p[tri[1]] - p[tri[0]], p[tri[2]] - p[tri[0]]);
+			double area = length(n);
+			if (area > 0) n /= area;
+			for (int i = 0; i < 3; i++) {
+				quadrics[tri[i]].addPlane(n, -dot(n, p[tri[0]]), area);
+				triangles[tri[i]].push_back((unsigned int)t);
+				unsigned int a = tri[i], b = tri[(i + 1) % 3];
+				edgeUse[make_pair(std::min(a, b), std::max(a, b))]++;
+			}
+		}
+
+		//Planes perpendicular to open borders keep the outline in place
+		for (size_t t = 0; t < triangleCount; t++) {
+			unsigned int *tri = &indices[t * 3];
+			dvec3 n = normalize(cross(p[tri[1]] - p[tri[0]], p[tri[2]] - p[tri[0]]));
+			for (int i = 0; i < 3; i++) {
+				unsigned int a = tri[i], b = tri[(i + 1) % 3];
+				if (edgeUse[make_pair(std::min(a, b), std::max(a, b))] != 1) continue;
+				dvec3 edge = p[b] - p[a];
+				double len = length(edge);
+				if (len == 0) continue;
+				dvec3 side = normalize(cross(edge, n));
+				if (side.x != side.x) continue;
+				quadrics[a].addPlane(side, -dot(side, p[a]), 100.0 * len * len);
+				quadrics[b].addPlane(side, -dot(side, p[a]), 100.0 * len * len);
+			}
+		}
+
+		vector<unsigned int> version(vertexCount, 0);
+		vector<char> removed(triangleCount, 0);
+		priority_queue<Collapse> queue;
+
+		//Both directions of every edge of vertex v
+		auto pushEdges = [&](unsigned int v) {
+			for (size_t k = 0; k < triangles[v].size(); k++) {
+				const unsigned int *tri = &indices[triangles[v][k] * 3];
+				for (int i = 0; i < 3; i++) {
+					unsigned int u = tri[i];
+					if (u == v) continue;
+					Quadric q = quadrics[u];
+					q.add(quadrics[v]);
+					Collapse c;
+					c.from = u; c.to = v; c.cost = q.error(p[v]);
+					c.fromVersion = version[u]; c.toVersion = version[v];
+					queue.push(c);
+					c.from = v; c.to = u; c.cost = q.error(p[u]);
+					c.fromVersion = version[v]; c.toVersion = version[u];
+					queue.push(c);
+				}
+			}
+		};
+		for (size_t v = 0; v < vertexCount; v++) pushEdges((unsigned int)v);
+
+		size_t liveTriangles = triangleCount;
+		while (liveTriangles > targetTriangles && !queue.empty()) {
+			Collapse c = queue.top();
+			queue.pop();
+			if (c.fromVersion != version[c.from] || c.toVersion != version[c.to]) continue; //Stale entry
+
+			//Moving 'from' onto 'to' must not flip any of the triangles that survive
+			bool flips = false;
+			for (size_t k = 0; k < triangles[c.from].size() && !flips; k++) {
+				const unsigned int *tri = &indices[triangles[c.from][k] * 3];
+				if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to) continue;
+				dvec3 q[3];
+				for (int i = 0; i < 3; i++) q[i] = tri[i] == c.from ? p[c.to] : p[tri[i]];
+				dvec3 before = cross(p[tri[1]] - p[tri[0]], p[tri[2]] - p[tri[0]]);
+				dvec3 after = cross(q[1] - q[0], q[2] - q[0]);
+				if (dot(before, after) <= 0.2 * length(before) * length(after)) flips = true;
+			}
+			if (flips) continue;
+
+			for (size_t k = 0; k < triangles[c.from].size(); k++) {
+				unsigned int t = triangles[c.from][k];
+				unsigned int *tri = &indices[t * 3];
+				if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to) {
+					removed[t] = 1;
+					liveTriangles--;
+					for (int i = 0; i < 3; i++) {
+						vector<unsigned int> &around = triangles[tri[i]];
+						if (tri[i] != c.from) around.erase(std::remove(around.begin(), around.end(), t), around.end());
+					}
+				}
+				else {
+					for (int i = 0; i < 3; i++) if (tri[i] == c.from) tri[i] = c.to;
+					triangles[c.to].push_back(t);
+				}
+			}
+			triangles[c.from].clear();
+			quadrics[c.to].add(quadrics[c.from]);
+			version[c.from]++;
+			version[c.to]++;
+			pushEdges(c.to);
+		}
+
+		vector<unsigned int> result;
+		result.reserve(liveTriangles * 3);
+		for (size_t t = 0; t < triangleCount; t++) {
+			if (removed[t]) continue;
+			result.insert(result.end(), &indices[t * 3], &indices[t * 3] + 3);
+		}
+		indices.swap(result);
+	}
+
+}
@@ -0,0 +1,99 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MESH_H
+#define MESH_H
+
+//Indexed triangle mesh made out of shared vertices
+//Contains arrays:
+//vertices - vertex positions in homogenous coordinates
+//vertexNormals - vertex normals in homogenous coordinates (smooth shading)
+//texCoords - texturing coordinates
+//indices - 16 or 32 bit triangle list, ordered for the post-transform vertex cache
+//Flat shading (drawSolid(false)) uses an unindexed copy with face normals,
+//built on first use.
+
+#include <functional>
+#include "model.h"
+
+namespace Models {
+
+	using namespace std;
+	using namespace glm;
+
+	class Mesh: public Model {
+		public:
+			Mesh();
+			virtual ~Mesh();
+			virtual void drawSolid(bool smooth=true);
+
+			void build(const vector<vec4> &vertices, const vector<vec4> &vertexNormals, const vector<vec4> &texCoords, const vector<unsigned int> &indices);
+
+			float acmrBefore; //Average cache miss ratio of the triangle order before optimization
+			float acmrAfter; //... and after
+			double finalizeSeconds; //Time the last finalize() took, most of it the vertex cache optimization
+			void printStats(const char* name);
+
+		protected:
+			vector<vec4> internalVertices;
+			vector<vec4> internalVertexNormals;
+			vector<vec4> internalTexCoords; //May stay empty, texCoords then alias vertexNormals
+			vector<unsigned int> internalIndices;
+
+			void finalize(); //Call after filling the arrays above: optimizes and sets up the Model pointers
+			void clearCaches(); //Drops the flat and packed copies after the Model pointers changed
+
+		private:
+			vector<unsigned short> internalIndices16;
+			vector<vec4> flatVertices;
+			vector<vec4> flatNormals;
+			vector<vec4> flatTexCoords;
+
+			void buildFlat();
+			void reorderVertices();
+	};
+
+	//Indexed mesh built from an unindexed triangle list, simplified to a fraction of its triangles
+	class SimplifiedMesh: public Mesh {
+		public:
+			SimplifiedMesh(const float *vertices, const float *vertexNormals, const float *texCoords, int vertexCount, float fraction);
+			virtual ~SimplifiedMesh();
+	};
+
+	//Reorders triangles for a post-transform vertex cache (Tom Forsyth's linear-speed algorithm)
+	void optimizeVertexCache(vector<unsigned int> &indices, size_t vertexCount);
+
+	//Transformed vertices per triangle for a FIFO cache of the given size
+	float computeACMR(const vector<unsigned int> &indices, size_t vertexCount, int cacheSize=16);
+
+	//sin and cos of first + i * step for i in [0, count], so grid generators need no trigonometry per vertex
+	void sinCosTable(double first, double step, int count, vector<float> &sines, vector<float> &cosines);
+
+	//Runs body(begin, end) on slices of [0, count) on the job system (Jobs::parallelFor), at least minPerThread items per slice
+	void parallelRanges(int count, int minPerThread, const function<void(int, int)> &body);
+
+	//Merges the corners of an unindexed triangle list that share position and normal (and texture
+	//coordinates if weldTexCoords is set). Otherwise a welded vertex keeps the texture coordinates of its first corner.
+	void weldVertices(const float *vertices, const float *vertexNormals, const float *texCoords, int vertexCount,
+		vector<vec4> &outVertices, vector<vec4> &outNormals, vector<vec4> &outTexCoords, vector<unsigned int> &outIndices,
+		bool weldTexCoords=false);
+
+	//Quadric error edge collapse down to roughly targetTriangles triangles.
+	//Vertices are only merged into existing ones, so attribute arrays stay valid.
+	void simplifyMesh(const vector<vec4> &vertices, vector<unsigned int> &indices, size_t targetTriangles);
+
+}
+
+#endif
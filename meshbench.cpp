@@ -0,0 +1,79 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//Benchmark of sphere and torus generation.
+//Usage: meshbench [divisions] [runs]
+//Builds a divisions x divisions sphere and torus (1024 by default) and splits the constructor
+//time into generation and Mesh::finalize (vertex cache optimization). Next to the generation
+//it prints the time to allocate and zero the same output (vertices, normals, indices) in
+//fresh vectors: when the two are close, generation is bound by writing memory, not by the
+//math. Every figure is the best of the runs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include "sphere.h"
+#include "torus.h"
+#include "jobs.h"
+
+using namespace Models;
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//Fresh vectors of the model's output size, written once by their constructors
+static double fill(int vertexCount, int indexCount) {
+	auto start = std::chrono::steady_clock::now();
+	std::vector<glm::vec4> vertices(vertexCount), normals(vertexCount);
+	std::vector<unsigned int> indices(indexCount);
+	double time = seconds(start);
+	if (vertices[vertexCount / 2].x != 0 || normals[vertexCount / 3].y != 0 || indices[indexCount / 2] != 0) printf("?\n");
+	return time;
+}
+
+template <class Shape, class Build> static void measure(const char *name, int runs, Build build) {
+	double finalize = 1e30, generate = 1e30, zero = 1e30;
+	int vertexCount = 0, indexCount = 0;
+	for (int run = 0; run < runs; run++) {
+		auto start = std::chrono::steady_clock::now();
+		Shape *shape = build();
+		double time = seconds(start);
+		finalize = std::min(finalize, shape->finalizeSeconds);
+		generate = std::min(generate, time - shape->finalizeSeconds);
+		vertexCount = shape->vertexCount;
+		indexCount = shape->indexCount;
+		delete shape;
+		zero = std::min(zero, fill(vertexCount, indexCount));
+	}
+	double megabytes = (2.0 * vertexCount * sizeof(glm::vec4) + (double)indexCount * sizeof(unsigned int)) / 1048576.0;
+	printf("%-6s %9d %9d %8.1f %10.1f %9.1f %10.1f %8.2f %10.1f\n", name, vertexCount, indexCount / 3, megabytes,
+		generate * 1e3, zero * 1e3, megabytes / 1024.0 / generate, generate / zero, finalize * 1e3);
+}
+
+int main(int argc, char **argv) {
+	int divisions = argc > 1 ? std::max(3, atoi(argv[1])) : 1024;
+	int runs = argc > 2 ? std::max(1, atoi(argv[2])) : 3;
+	float d = (float)divisions;
+	printf("%d x %d divisions, %d threads\n", divisions, divisions, Jobs::threadCount());
+	printf("%-6s %9s %9s %8s %10s %9s %10s %8s %10s\n", "shape", "vertices", "triangles", "MB", "generate", "zero", "GB/s", "ratio", "finalize");
+	measure<Sphere>("sphere", runs, [d] { return new Sphere(1, d, d); });
+	measure<Torus>("torus", runs, [d] { return new Torus(0.75f, 0.25f, d, d); });
+	printf("generate, zero and finalize in ms; ratio is generate / zero\n");
+	return 0;
+}
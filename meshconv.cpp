@@ -0,0 +1,151 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//Converts a Wavefront OBJ file into a .mesh file (see meshfile.h).
+//Usage: meshconv input.obj output.mesh [-l fraction:minScreenSize]...
+//Every -l adds a level with the given fraction of the triangles, used from the
+//given on-screen diameter in pixels up. Level 1:... keeps the full mesh, coarser
+//ones are simplified with quadric edge collapse. Faces keep the winding of the file.
+
+#include "meshfile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace Models;
+
+struct ObjCorners { //Unindexed triangle list in the float4 layout of Model
+	vector<float> vertices;
+	vector<float> vertexNormals;
+	vector<float> texCoords;
+	int count() const { return (int)vertices.size() / 4; }
+};
+
+//OBJ indices are 1-based, negative ones count back from the end
+static int objIndex(int i, size_t size) {
+	return i < 0 ? (int)size + i : i - 1;
+}
+
+static bool readObj(const char* path, ObjCorners& out) {
+	FILE* f = fopen(path, "r");
+	if (f == NULL) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return false;
+	}
+
+	vector<vec4> v, vt, vn;
+	char line[1024];
+	int lineNumber = 0;
+	bool ok = true;
+	while (ok && fgets(line, sizeof(line), f)) {
+		lineNumber++;
+		float x = 0, y = 0, z = 0, w = 1;
+		if (strncmp(line, "v ", 2) == 0) {
+			sscanf(line + 2, "%f %f %f %f", &x, &y, &z, &w);
+			v.push_back(vec4(x, y, z, w));
+		}
+		else if (strncmp(line, "vt ", 3) == 0) {
+			sscanf(line + 3, "%f %f %f", &x, &y, &z);
+			vt.push_back(vec4(x, y, z, 0));
+		}
+		else if (strncmp(line, "vn ", 3) == 0) {
+			sscanf(line + 3, "%f %f %f", &x, &y, &z);
+			vn.push_back(vec4(x, y, z, 0));
+		}
+		else if (strncmp(line, "f ", 2) == 0) {
+			vector<int> corner[3]; //Position, texture and normal index of every polygon corner
+			for (char* token = strtok(line + 2, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+				int p = 0, t = 0, n = 0;
+				if (sscanf(token, "%d/%d/%d", &p, &t, &n) != 3 && sscanf(token, "%d//%d", &p, &n) != 2 && sscanf(token, "%d/%d", &p, &t) != 2)
+					sscanf(token, "%d", &p);
+				corner[0].push_back(objIndex(p, v.size()));
+				corner[1].push_back(t == 0 ? -1 : objIndex(t, vt.size()));
+				corner[2].push_back(n == 0 ? -1 : objIndex(n, vn.size()));
+			}
+
+			for (size_t c = 2; c < corner[0].size() && ok; c++) { //Triangle fan
+				size_t triangle[3] = { 0, c - 1, c };
+				for (int k = 0; k < 3 && ok; k++) {
+					int p = corner[0][triangle[k]], t = corner[1][triangle[k]], n = corner[2][triangle[k]];
+					if (p < 0 || p >= (int)v.size() || t >= (int)vt.size() || n < 0 || n >= (int)vn.size()) {
+						fprintf(stderr, "%s:%d: missing vertex, texture coordinate or normal\n", path, lineNumber);
+						ok = false;
+						break;
+					}
+					vec4 tc = t < 0 ? vec4(0.0f) : vt[t];
+					out.vertices.insert(out.vertices.end(), &v[p][0], &v[p][0] + 4);
+					out.vertexNormals.insert(out.vertexNormals.end(), &vn[n][0], &vn[n][0] + 4);
+					out.texCoords.insert(out.texCoords.end(), &tc[0], &tc[0] + 4);
+				}
+			}
+		}
+	}
+	fclose(f);
+
+	if (ok && out.count() == 0) {
+		fprintf(stderr, "%s: no faces\n", path);
+		ok = false;
+	}
+	return ok;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		fprintf(stderr, "usage: meshconv input.obj output.mesh [-l fraction:minScreenSize]...\n");
+		return 1;
+	}
+
+	vector<float> fractions, minScreenSizes;
+	for (int i = 3; i < argc; i++) {
+		float fraction, size;
+		if (strcmp(argv[i], "-l") == 0 && i + 1 < argc && sscanf(argv[i + 1], "%f:%f", &fraction, &size) == 2 && fraction > 0 && fraction <= 1) {
+			fractions.push_back(fraction);
+			minScreenSizes.push_back(size);
+			i++;
+		}
+		else {
+			fprintf(stderr, "meshconv: bad argument %s\n", argv[i]);
+			return 1;
+		}
+	}
+	if (fractions.empty()) {
+		fractions.push_back(1);
+		minScreenSizes.push_back(0);
+	}
+
+	ObjCorners obj;
+	if (!readObj(argv[1], obj)) return 1;
+
+	vector<Mesh*> lods;
+	for (size_t i = 0; i < fractions.size(); i++) {
+		if (fractions[i] < 1) {
+			lods.push_back(new SimplifiedMesh(obj.vertices.data(), obj.vertexNormals.data(), obj.texCoords.data(), obj.count(), fractions[i]));
+		}
+		else { //Full detail keeps texture seams
+			vector<vec4> v, n, tc;
+			vector<unsigned int> indices;
+			weldVertices(obj.vertices.data(), obj.vertexNormals.data(), obj.texCoords.data(), obj.count(), v, n, tc, indices, true);
+			Mesh* mesh = new Mesh();
+			mesh->build(v, n, tc, indices);
+			lods.push_back(mesh);
+		}
+		printf("level %d: %d vertices, %d triangles, ACMR %.3f, from %.0f px\n",
+			(int)i, lods[i]->vertexCount, lods[i]->indexCount / 3, lods[i]->acmrAfter, minScreenSizes[i]);
+	}
+
+	bool ok = writeMeshFile(argv[2], lods, minScreenSizes);
+	for (size_t i = 0; i < lods.size(); i++) delete lods[i];
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,232 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "meshfile.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+namespace Models {
+
+	static_assert(sizeof(MeshFileHeader) == 64, "MeshFileHeader is part of the file format");
+	static_assert(sizeof(MeshFileLod) == 48, "MeshFileLod is part of the file format");
+
+	MeshFile::MeshFile() {
+		data = NULL;
+		size = 0;
+	}
+
+	MeshFile::~MeshFile() {
+		close();
+	}
+
+	bool MeshFile::open(const char* path) {
+		close();
+		if (!mapping.open(path)) return false;
+		data = mapping.data();
+		size = mapping.size();
+		if (!validate(path)) {
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	void MeshFile::close() {
+		mapping.close();
+		data = NULL;
+		size = 0;
+	}
+
+	//Everything the loader and GL will read has to lie inside the file
+	bool MeshFile::validate(const char* path) const {
+		if (size < sizeof(MeshFileHeader) || memcmp(header().magic, meshFileMagic, 4) != 0) {
+			fprintf(stderr, "%s: not a mesh file\n", path);
+			return false;
+		}
+		if (header().version != meshFileVersion) {
+			fprintf(stderr, "%s: mesh file version %u, expected %u\n", path, header().version, meshFileVersion);
+			return false;
+		}
+		uint64_t tableEnd = sizeof(MeshFileHeader) + (uint64_t)header().lodCount * sizeof(MeshFileLod);
+		if (header().lodCount == 0 || tableEnd > size) {
+			fprintf(stderr, "%s: bad level table\n", path);
+			return false;
+		}
+
+		for (int i = 0; i < lodCount(); i++) {
+			const MeshFileLod& l = lod(i);
+			uint64_t streamBytes = (uint64_t)l.vertexCount * 4 * sizeof(float);
+			uint64_t blocks[4][2] = {
+				{ l.positions, streamBytes }, { l.normals, streamBytes }, { l.texCoords, streamBytes },
+				{ l.indices, (uint64_t)l.indexCount * l.indexSize }
+			};
+			bool ok = l.vertexCount > 0 && l.indexCount > 0 && l.indexCount % 3 == 0 && (l.indexSize == 2 || l.indexSize == 4);
+			for (int b = 0; b < 4 && ok; b++) {
+				ok = blocks[b][0] % meshFileAlignment == 0 && blocks[b][0] >= tableEnd && blocks[b][0] <= size && blocks[b][1] <= size - blocks[b][0];
+			}
+			for (uint32_t k = 0; k < l.indexCount && ok; k++) {
+				uint32_t index = l.indexSize == 2 ? ((const uint16_t*)at(l.indices))[k] : ((const uint32_t*)at(l.indices))[k];
+				ok = index < l.vertexCount;
+			}
+			if (!ok) {
+				fprintf(stderr, "%s: level %d is corrupt\n", path, i);
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+	MeshAsset::MeshAsset() {
+		for (int i = 0; i < 4; i++) buffers[i] = 0;
+	}
+
+	MeshAsset::~MeshAsset() {
+	}
+
+	void MeshAsset::attach(const MeshFile& file, int lod) {
+		const MeshFileLod& l = file.lod(lod);
+		//Model pointers are not const, nothing writes through them
+		vertices = (float*)file.at(l.positions);
+		vertexNormals = (float*)file.at(l.normals);
+		normals = vertexNormals; //Face normals only exist in the flat copy
+		texCoords = (float*)file.at(l.texCoords);
+		colors = NULL;
+		vertexCount = (int)l.vertexCount;
+		indices = file.at(l.indices);
+		indexCount = (int)l.indexCount;
+		indexType = l.indexSize == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+		vector<unsigned int> list(indexCount);
+		for (int i = 0; i < indexCount; i++)
+			list[i] = indexType == GL_UNSIGNED_SHORT ? ((const unsigned short*)indices)[i] : ((const unsigned int*)indices)[i];
+		acmrBefore = acmrAfter = computeACMR(list, vertexCount); //Optimized by meshconv
+		clearCaches();
+	}
+
+	void MeshAsset::upload() {
+		release();
+		size_t streamBytes = (size_t)vertexCount * 4 * sizeof(float);
+		const float* streams[3] = { vertices, vertexNormals, texCoords };
+
+		glGenBuffers(4, buffers);
+		for (int i = 0; i < 3; i++) {
+			glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+			glBufferData(GL_ARRAY_BUFFER, streamBytes, streams[i], GL_STATIC_DRAW);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[3]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, (size_t)indexCount * (indexType == GL_UNSIGNED_SHORT ? 2 : 4), indices, GL_STATIC_DRAW);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	}
+
+	void MeshAsset::release() {
+		if (buffers[0] != 0) glDeleteBuffers(4, buffers);
+		for (int i = 0; i < 4; i++) buffers[i] = 0;
+	}
+
+	void MeshAsset::drawSolid(bool smooth) {
+		if (!smooth || buffers[0] == 0) { //The flat copy is built on the CPU
+			Mesh::drawSolid(smooth);
+			return;
+		}
+
+		glEnableVertexAttribArray(0);
+		glEnableVertexAttribArray(1);
+		glEnableVertexAttribArray(2);
+
+		for (int i = 0; i < 3; i++) {
+			glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+			glVertexAttribPointer(i, 4, GL_FLOAT, false, 0, NULL);
+		}
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[3]);
+		glDrawElements(GL_TRIANGLES, indexCount, indexType, NULL);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(1);
+		glDisableVertexAttribArray(2);
+	}
+
+
+	static uint64_t alignOffset(uint64_t offset) {
+		return (offset + meshFileAlignment - 1) / meshFileAlignment * meshFileAlignment;
+	}
+
+	bool writeMeshFile(const char* path, const vector<Mesh*>& lods, const vector<float>& minScreenSizes) {
+		MeshFileHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, meshFileMagic, 4);
+		header.version = meshFileVersion;
+		header.lodCount = (uint32_t)lods.size();
+		for (int k = 0; k < 3; k++) {
+			header.boundsMin[k] = lods[0]->vertices[k];
+			header.boundsMax[k] = lods[0]->vertices[k];
+		}
+		for (int i = 0; i < lods[0]->vertexCount; i++) {
+			const float* v = lods[0]->vertices + 4 * i;
+			for (int k = 0; k < 3; k++) {
+				header.boundsMin[k] = std::min(header.boundsMin[k], v[k]);
+				header.boundsMax[k] = std::max(header.boundsMax[k], v[k]);
+			}
+			header.radius = std::max(header.radius, sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]));
+		}
+
+		vector<MeshFileLod> table(lods.size());
+		vector<pair<uint64_t, pair<const void*, size_t> > > blocks;
+		uint64_t offset = sizeof(MeshFileHeader) + table.size() * sizeof(MeshFileLod);
+		for (size_t i = 0; i < lods.size(); i++) {
+			const Mesh* m = lods[i];
+			MeshFileLod& l = table[i];
+			l.vertexCount = (uint32_t)m->vertexCount;
+			l.indexCount = (uint32_t)m->indexCount;
+			l.indexSize = m->indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+			l.minScreenSize = minScreenSizes[i];
+
+			size_t streamBytes = (size_t)m->vertexCount * 4 * sizeof(float);
+			uint64_t* fields[4] = { &l.positions, &l.normals, &l.texCoords, &l.indices };
+			const void* sources[4] = { m->vertices, m->vertexNormals, m->texCoords, m->indices };
+			size_t sizes[4] = { streamBytes, streamBytes, streamBytes, (size_t)m->indexCount * l.indexSize };
+			for (int b = 0; b < 4; b++) {
+				offset = alignOffset(offset);
+				*fields[b] = offset;
+				blocks.push_back(make_pair(offset, make_pair(sources[b], sizes[b])));
+				offset += sizes[b];
+			}
+		}
+
+		FILE* f = fopen(path, "wb");
+		if (f == NULL) {
+			fprintf(stderr, "%s: cannot create\n", path);
+			return false;
+		}
+		fwrite(&header, sizeof(header), 1, f);
+		fwrite(table.data(), sizeof(MeshFileLod), table.size(), f);
+		static const char zeros[meshFileAlignment] = { 0 };
+		uint64_t written = sizeof(MeshFileHeader) + table.size() * sizeof(MeshFileLod);
+		for (size_t b = 0; b < blocks.size(); b++) {
+			fwrite(zeros, 1, (size_t)(blocks[b].first - written), f);
+			fwrite(blocks[b].second.first, 1, blocks[b].second.second, f);
+			written = blocks[b].first + blocks[b].second.second;
+		}
+		bool ok = ferror(f) == 0;
+		if (fclose(f) != 0) ok = false;
+		if (!ok) fprintf(stderr, "%s: write failed\n", path);
+		return ok;
+	}
+}
@@ -0,0 +1,103 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MESHFILE_H
+#define MESHFILE_H
+
+//Binary mesh container (.mesh), written by meshconv and memory mapped at load time.
+//Layout, little endian:
+//MeshFileHeader
+//MeshFileLod[lodCount] - finest level first
+//data blocks, each starting at a multiple of meshFileAlignment:
+//  positions, normals and texture coordinates as float4 arrays (SoA, the layout of Model),
+//  16 or 32 bit triangle list ordered for the vertex cache
+//Offsets count from the start of the file, so a mapped file is used in place:
+//Model pointers point into the mapping and upload() hands them to glBufferData.
+
+#include <stdint.h>
+#include "mesh.h"
+#include "mappedfile.h"
+
+namespace Models {
+
+	const char meshFileMagic[4] = { 'G', 'M', 'S', 'H' };
+	const uint32_t meshFileVersion = 1;
+	const uint32_t meshFileAlignment = 64;
+
+	struct MeshFileHeader {
+		char magic[4];
+		uint32_t version;
+		uint32_t lodCount;
+		uint32_t flags; //Reserved, 0
+		float boundsMin[4]; //Model space bounding box of level 0, w unused
+		float boundsMax[4];
+		float radius; //Bounding sphere radius around the origin
+		uint32_t reserved[3];
+	};
+
+	struct MeshFileLod {
+		uint32_t vertexCount;
+		uint32_t indexCount;
+		uint32_t indexSize; //2 or 4 bytes
+		float minScreenSize; //Smallest on-screen diameter in pixels this level is used for (see LodChain)
+		uint64_t positions; //Offsets of the blocks
+		uint64_t normals;
+		uint64_t texCoords;
+		uint64_t indices;
+	};
+
+	//Read-only memory mapping of a .mesh file, validated on open
+	class MeshFile {
+		public:
+			MeshFile();
+			~MeshFile();
+
+			bool open(const char* path); //Prints the reason and returns false on failure
+			void close();
+			bool isOpen() const { return data != NULL; }
+
+			const MeshFileHeader& header() const { return *(const MeshFileHeader*)data; }
+			const MeshFileLod& lod(int i) const { return ((const MeshFileLod*)(data + sizeof(MeshFileHeader)))[i]; }
+			int lodCount() const { return (int)header().lodCount; }
+			const void* at(uint64_t offset) const { return data + offset; }
+
+		private:
+			MappedFile mapping;
+			const unsigned char* data; //Start of the mapping, NULL while closed
+			size_t size;
+
+			bool validate(const char* path) const;
+	};
+
+	//Mesh whose arrays live in a mapped MeshFile; the file has to stay open while the model is used
+	class MeshAsset: public Mesh {
+		public:
+			MeshAsset();
+			virtual ~MeshAsset();
+			virtual void drawSolid(bool smooth=true);
+
+			void attach(const MeshFile& file, int lod);
+			void upload(); //Copies the mapped arrays into GL buffers, call with a current context
+			void release();
+
+		private:
+			GLuint buffers[4]; //positions, normals, texture coordinates, indices
+	};
+
+	//Writes the given indexed meshes as the levels of a .mesh file
+	bool writeMeshFile(const char* path, const vector<Mesh*>& lods, const vector<float>& minScreenSizes);
+}
+
+#endif
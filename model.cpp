@@ -14,8 +14,103 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "model.h"
+#include <stdio.h>
+#include <glm/gtc/packing.hpp>
 
 namespace Models {
+	Model::Model() {
+		vertexCount=0;
+		vertices=NULL;
+		normals=NULL;
+		vertexNormals=NULL;
+		texCoords=NULL;
+		colors=NULL;
+		indexCount=0;
+		indices=NULL;
+		indexType=GL_UNSIGNED_SHORT;
+	}
+
+	Model::~Model() {
+	}
+
+	unsigned int packNormal(const glm::vec4 &n) {
+		return glm::packSnorm3x10_1x2(glm::vec4(glm::vec3(n), 0.0f));
+	}
+
+	glm::vec4 unpackNormal(unsigned int p) {
+		return glm::vec4(glm::vec3(glm::unpackSnorm3x10_1x2(p)), 0.0f);
+	}
+
+	PackedVertex packVertex(const float *position, const float *normal, const float *texCoord) {
+		PackedVertex v;
+		for (int i = 0; i < 4; i++) v.position[i] = glm::packHalf1x16(position[i]);
+		v.normal = packNormal(glm::vec4(normal[0], normal[1], normal[2], 0.0f));
+		v.texCoord[0] = glm::packHalf1x16(texCoord[0]);
+		v.texCoord[1] = glm::packHalf1x16(texCoord[1]);
+		return v;
+	}
+
+	void unpackVertex(const PackedVertex &v, glm::vec4 &position, glm::vec4 &normal, glm::vec2 &texCoord) {
+		for (int i = 0; i < 4; i++) position[i] = glm::unpackHalf1x16(v.position[i]);
+		normal = unpackNormal(v.normal);
+		texCoord = glm::vec2(glm::unpackHalf1x16(v.texCoord[0]), glm::unpackHalf1x16(v.texCoord[1]));
+	}
+
+	void Model::pack() {
+		packedVertices.resize(vertexCount);
+		for (int i = 0; i < vertexCount; i++) {
+			packedVertices[i] = packVertex(vertices + 4 * i, vertexNormals + 4 * i, texCoords + 4 * i);
+		}
+
+		packedFaceNormals.clear();
+		if (indexCount == 0 && normals != NULL && normals != vertexNormals) {
+			packedFaceNormals.resize(vertexCount);
+			for (int i = 0; i < vertexCount; i++) {
+				packedFaceNormals[i] = packNormal(glm::vec4(normals[4 * i], normals[4 * i + 1], normals[4 * i + 2], 0.0f));
+			}
+		}
+	}
+
+	bool Model::bindPacked(bool smooth) {
+		if (packedVertices.empty()) pack();
+		if (!smooth && packedFaceNormals.empty()) return false; //Indexed meshes build their flat copy themselves
+
+		const PackedVertex *v = packedVertices.data();
+		glVertexAttribPointer(0, 4, GL_HALF_FLOAT, false, sizeof(PackedVertex), v->position);
+		if (!smooth) glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, true, 0, packedFaceNormals.data());
+		else glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, true, sizeof(PackedVertex), &v->normal);
+		glVertexAttribPointer(2, 2, GL_HALF_FLOAT, false, sizeof(PackedVertex), v->texCoord);
+		return true;
+	}
+
+	void Model::drawPacked(bool smooth) {
+		if (!bindPacked(smooth)) {
+			drawSolid(false);
+			return;
+		}
+
+		glEnableVertexAttribArray(0);
+		glEnableVertexAttribArray(1);
+		glEnableVertexAttribArray(2);
+
+		if (indexCount > 0) glDrawElements(GL_TRIANGLES, indexCount, indexType, indices);
+		else glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+
+		glDisableVertexAttribArray(0);
+		glDisableVertexAttribArray(1);
+		glDisableVertexAttribArray(2);
+	}
+
+	//Bytes fetched per draw with the float4 arrays versus the packed ones
+	void Model::printPackedStats(const char* name) {
+		if (packedVertices.empty()) pack();
+		size_t floatBytes = (size_t)vertexCount * 3 * 4 * sizeof(float);
+		size_t packedBytes = packedVertices.size() * sizeof(PackedVertex);
+		printf("%s: %d vertices, float4 layout %.1f KiB (%d B/vertex), packed %.1f KiB (%d B/vertex), %.1fx less vertex data\n",
+			name, vertexCount, floatBytes / 1024.0f, (int)(3 * 4 * sizeof(float)), packedBytes / 1024.0f, (int)sizeof(PackedVertex),
+			packedBytes > 0 ? (float)floatBytes / packedBytes : 0.0f);
+	}
+
 	void Model::drawWire(bool smooth) {
 		glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
 
@@ -24,6 +24,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 namespace Models {
 
+	using namespace std;
+
+	//Compact vertex: 16 bytes instead of 48 for the three float4 streams
+	struct PackedVertex {
+		unsigned short position[4]; //half floats (w stays 1)
+		unsigned int normal; //snorm 10:10:10:2, GL_INT_2_10_10_10_REV (w stays 0)
+		unsigned short texCoord[2]; //half floats, first two texture coordinates
+	};
+
+	unsigned int packNormal(const glm::vec4 &n);
+	glm::vec4 unpackNormal(unsigned int p);
+	PackedVertex packVertex(const float *position, const float *normal, const float *texCoord);
+	void unpackVertex(const PackedVertex &v, glm::vec4 &position, glm::vec4 &normal, glm::vec2 &texCoord);
+
 	class Model {
 		public:
 			int vertexCount;
@@ -32,9 +46,24 @@ namespace Models {
 			float *vertexNormals;
 			float *texCoords;
 			float *colors;
-					
+
+			int indexCount; //0 for models drawn with glDrawArrays
+			const void *indices;
+			GLenum indexType; //GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+
+			Model();
+			virtual ~Model();
 			virtual void drawSolid(bool smooth)=0;
 			virtual void drawWire(bool smooth=false);
+
+			void pack(); //Builds the packed copy of the float arrays, done by drawPacked on first use
+			void drawPacked(bool smooth=true); //Same as drawSolid but fetches PackedVertex data
+			bool bindPacked(bool smooth=true); //Points attributes 0-2 at the packed copy without drawing, false if there is no flat one (indexed meshes)
+			void printPackedStats(const char* name);
+
+		protected:
+			vector<PackedVertex> packedVertices; //Smooth normals
+			vector<unsigned int> packedFaceNormals; //Flat normals of unindexed models
 	};
 }
 
@@ -0,0 +1,230 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "navgrid.h"
+#include "jobs.h"
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+
+const unsigned char NavGrid::noDirection;
+
+//Orthogonal directions first, diagonals after them
+const int NavGrid::dx[8] = { 1, 0, -1, 0, 1, -1, -1, 1 };
+const int NavGrid::dz[8] = { 0, 1, 0, -1, 1, 1, -1, -1 };
+static const unsigned int stepCost[8] = { 5, 5, 5, 5, 7, 7, 7, 7 }; //7/5 is close enough to sqrt(2)
+
+NavGrid::NavGrid() {
+	width = depth = 0;
+	cellSize = 1.0f;
+	origin = glm::vec2(0.0f);
+	cacheCapacity = 64;
+	useCounter = 0;
+	fieldsPlanned = 0;
+	planningMs = 0;
+}
+
+void NavGrid::clear() {
+	floors.clear();
+	obstacles.clear();
+	blocked.clear();
+	goals.clear();
+	fields.clear();
+	requested.clear();
+	width = depth = 0;
+}
+
+void NavGrid::addFloor(const glm::vec3& bmin, const glm::vec3& bmax) {
+	floors.push_back(glm::vec4(bmin.x, bmin.z, bmax.x, bmax.z));
+}
+
+void NavGrid::addObstacle(const glm::vec3& bmin, const glm::vec3& bmax) {
+	obstacles.push_back(glm::vec4(bmin.x, bmin.z, bmax.x, bmax.z));
+}
+
+void NavGrid::build(float cellSize, float agentRadius) {
+	this->cellSize = cellSize;
+	fields.clear();
+	requested.clear();
+	if (floors.empty()) {
+		width = depth = 0;
+		blocked.clear();
+		return;
+	}
+
+	glm::vec2 bmin(floors[0].x, floors[0].y), bmax(floors[0].z, floors[0].w);
+	for (const glm::vec4& f : floors) {
+		bmin = glm::min(bmin, glm::vec2(f.x, f.y));
+		bmax = glm::max(bmax, glm::vec2(f.z, f.w));
+	}
+	origin = bmin;
+	glm::vec2 size = bmax - bmin;
+	if (size.x * size.y > cellSize * cellSize * maxCells) this->cellSize = cellSize = sqrtf(size.x * size.y / maxCells); //Large galleries get coarser cells
+	width = (int)ceilf(size.x / cellSize);
+	depth = (int)ceilf(size.y / cellSize);
+	cacheCapacity = std::max((size_t)8, std::min((size_t)64, maxFieldBytes / std::max((size_t)1, (size_t)width * depth)));
+	blocked.assign((size_t)width * depth, 1);
+
+	//Cells are tested at their centres, so a cell belongs to a rectangle if its centre does
+	auto rasterize = [&](const glm::vec4& r, float grow, unsigned char value) {
+		int x0 = std::max(0, (int)ceilf((r.x - grow - origin.x) / cellSize - 0.5f));
+		int z0 = std::max(0, (int)ceilf((r.y - grow - origin.y) / cellSize - 0.5f));
+		int x1 = std::min(width - 1, (int)floorf((r.z + grow - origin.x) / cellSize - 0.5f));
+		int z1 = std::min(depth - 1, (int)floorf((r.w + grow - origin.y) / cellSize - 0.5f));
+		for (int z = z0; z <= z1; z++)
+			for (int x = x0; x <= x1; x++) blocked[(size_t)z * width + x] = value;
+	};
+	for (const glm::vec4& f : floors) rasterize(f, 0.0f, 0);
+	for (const glm::vec4& o : obstacles) rasterize(o, agentRadius, 1);
+
+	int free = 0;
+	for (unsigned char b : blocked) free += !b;
+	printf("Navigation grid: %dx%d cells of %.3f, %d walkable, %d obstacles\n", width, depth, cellSize, free, (int)obstacles.size());
+}
+
+int NavGrid::addGoal(const glm::vec3& lookAt, const glm::vec3& normal, float distance) {
+	glm::vec2 target(lookAt.x, lookAt.z);
+	glm::vec2 n = glm::vec2(normal.x, normal.z);
+	if (glm::length(n) < 1e-6f) return -1;
+	n = glm::normalize(n);
+	for (float side : { 1.0f, -1.0f }) {
+		glm::vec2 p = target + n * (side * distance);
+		if (!walkable(p.x, p.y)) continue;
+		Goal g;
+		g.position = p;
+		g.lookAt = target;
+		g.cell = cellOf(p.x, p.y);
+		goals.push_back(g);
+		return (int)goals.size() - 1;
+	}
+	return -1;
+}
+
+int NavGrid::cellOf(float x, float z) const {
+	int cx = (int)floorf((x - origin.x) / cellSize);
+	int cz = (int)floorf((z - origin.y) / cellSize);
+	if (cx < 0 || cz < 0 || cx >= width || cz >= depth) return -1;
+	return cz * width + cx;
+}
+
+bool NavGrid::walkable(float x, float z) const {
+	int cell = cellOf(x, z);
+	return cell >= 0 && !blocked[cell];
+}
+
+glm::vec2 NavGrid::cellCenter(int cell) const {
+	return origin + (glm::vec2((float)(cell % width), (float)(cell / width)) + 0.5f) * cellSize;
+}
+
+//Diagonal steps may not cut the corner of a blocked cell
+bool NavGrid::canStep(int cell, int direction) const {
+	int x = cell % width + dx[direction], z = cell / width + dz[direction];
+	if (x < 0 || z < 0 || x >= width || z >= depth) return false;
+	if (blocked[(size_t)z * width + x]) return false;
+	if (direction < 4) return true;
+	return !blocked[cell + dx[direction]] && !blocked[cell + dz[direction] * width];
+}
+
+//Dijkstra with a bucket queue (Dial's algorithm): costs are small integers,
+//so eight circular buckets hold every distance that can still be pending
+void NavGrid::computeField(int goalCell, std::vector<unsigned char>& directions) const {
+	size_t cells = (size_t)width * depth;
+	std::vector<unsigned int> distance(cells, 0xffffffffu);
+	std::vector<int> buckets[8];
+	distance[goalCell] = 0;
+	buckets[0].push_back(goalCell);
+	size_t pending = 1;
+	for (unsigned int d = 0; pending > 0; d++) {
+		std::vector<int>& bucket = buckets[d & 7];
+		while (!bucket.empty()) {
+			int cell = bucket.back();
+			bucket.pop_back();
+			pending--;
+			if (distance[cell] != d) continue; //Stale entry
+			for (int k = 0; k < 8; k++) {
+				if (!canStep(cell, k)) continue;
+				int next = step(cell, (unsigned char)k);
+				unsigned int nd = d + stepCost[k];
+				if (nd < distance[next]) {
+					distance[next] = nd;
+					buckets[nd & 7].push_back(next);
+					pending++;
+				}
+			}
+		}
+	}
+
+	directions.assign(cells, noDirection);
+	for (size_t cell = 0; cell < cells; cell++) {
+		if (distance[cell] == 0xffffffffu || cell == (size_t)goalCell) continue;
+		unsigned int best = distance[cell];
+		for (int k = 0; k < 8; k++) {
+			if (!canStep((int)cell, k)) continue;
+			unsigned int nd = distance[step((int)cell, (unsigned char)k)];
+			if (nd < best) {
+				best = nd;
+				directions[cell] = (unsigned char)k;
+			}
+		}
+	}
+}
+
+const unsigned char* NavGrid::flowField(int goal) {
+	int cell = goals[goal].cell;
+	auto found = fields.find(cell);
+	if (found != fields.end()) {
+		found->second.lastUse = ++useCounter;
+		return found->second.directions.data();
+	}
+	if (std::find(requested.begin(), requested.end(), cell) == requested.end()) requested.push_back(cell);
+	return NULL;
+}
+
+void NavGrid::plan(float budgetMs) {
+	auto start = std::chrono::steady_clock::now();
+	int threads = Jobs::threadCount();
+	while (!requested.empty()) {
+		//One field per thread and batch
+		int batch = std::min(threads, (int)requested.size());
+		std::vector<std::vector<unsigned char>> results(batch);
+		Jobs::parallelFor(0, batch, 1, [&](int begin, int end) {
+			for (int i = begin; i < end; i++) computeField(requested[i], results[i]);
+		});
+		for (int i = 0; i < batch; i++) {
+			Field& f = fields[requested[i]];
+			f.directions.swap(results[i]);
+			f.lastUse = ++useCounter;
+		}
+		requested.erase(requested.begin(), requested.begin() + batch);
+		fieldsPlanned += batch;
+
+		while (fields.size() > cacheCapacity) {
+			auto oldest = fields.begin();
+			for (auto i = fields.begin(); i != fields.end(); ++i)
+				if (i->second.lastUse < oldest->second.lastUse) oldest = i;
+			fields.erase(oldest);
+		}
+
+		double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		if (elapsed >= budgetMs) break;
+	}
+	planningMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void NavGrid::printStats() {
+	printf("Navigation: %d goals, %d fields planned in %.1f ms, %d cached\n", (int)goals.size(), fieldsPlanned, planningMs, (int)fields.size());
+}
@@ -0,0 +1,94 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef NAVGRID_H
+#define NAVGRID_H
+
+//Walkable area of the gallery rasterized into a uniform grid on the xz plane.
+//Floors mark cells as walkable, walls and other upright boxes block them,
+//grown by the radius of an agent so that agents can be treated as points.
+//Paths are flow fields: for every goal (a spot in front of a painting) a
+//Dijkstra pass from the goal stores, per cell, the direction of the next
+//cell on the shortest path. Any number of agents share one field.
+//Fields are computed on request by plan() on the job system within a time
+//budget and kept in a least recently used cache.
+
+#include <vector>
+#include <unordered_map>
+#include <glm/glm.hpp>
+
+class NavGrid {
+public:
+	NavGrid();
+
+	struct Goal {
+		glm::vec2 position; //xz, on a walkable cell
+		glm::vec2 lookAt; //xz of what the agent looks at when it arrives
+		int cell;
+	};
+
+	void clear();
+	void addFloor(const glm::vec3& bmin, const glm::vec3& bmax); //World space boxes
+	void addObstacle(const glm::vec3& bmin, const glm::vec3& bmax);
+	void build(float cellSize, float agentRadius); //Call after all floors and obstacles were added; cellSize grows if the grid would exceed maxCells
+	int addGoal(const glm::vec3& lookAt, const glm::vec3& normal, float distance); //Stands distance away along +normal or -normal; -1 if neither is walkable
+
+	int goalCount() const { return (int)goals.size(); }
+	const Goal& goal(int i) const { return goals[i]; }
+
+	int cellOf(float x, float z) const; //-1 outside of the grid
+	bool walkable(float x, float z) const;
+	glm::vec2 cellCenter(int cell) const;
+	int step(int cell, unsigned char direction) const { return cell + dx[direction] + dz[direction] * width; }
+
+	const unsigned char* flowField(int goal); //Direction per cell towards the goal, NULL until plan() computed it
+	void plan(float budgetMs); //Computes requested fields, at least one batch per call
+	void printStats();
+
+	static const unsigned char noDirection = 255; //Goal cell, blocked or unreachable
+	static const int dx[8];
+	static const int dz[8];
+
+	int width, depth;
+	float cellSize;
+	glm::vec2 origin; //xz of the corner of cell 0
+	size_t cacheCapacity; //Flow fields kept in memory, set by build() from maxFieldBytes
+
+	static const size_t maxCells = 1 << 22; //build() grows cellSize beyond this
+	static const size_t maxFieldBytes = 64 << 20; //Cache budget, one byte per cell and field
+
+private:
+	struct Field {
+		std::vector<unsigned char> directions;
+		unsigned int lastUse;
+	};
+
+	std::vector<glm::vec4> floors; //xz rectangles: min x, min z, max x, max z
+	std::vector<glm::vec4> obstacles;
+	std::vector<unsigned char> blocked;
+	std::vector<Goal> goals;
+
+	std::unordered_map<int, Field> fields; //Goal cell -> field
+	std::vector<int> requested; //Goal cells waiting for plan()
+	unsigned int useCounter;
+	int fieldsPlanned;
+	double planningMs;
+
+	void computeField(int goalCell, std::vector<unsigned char>& directions) const;
+	bool canStep(int cell, int direction) const;
+};
+
+#endif
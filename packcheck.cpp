@@ -0,0 +1,68 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//Round trip of every model through the packed vertex layout (model.h).
+//Usage: packcheck [teapot.mesh]
+//Packs the positions, smooth and flat normals and texture coordinates of the cube, sphere,
+//torus and teapot, unpacks them again and checks the largest error against the bounds the
+//layout promises for models of unit size. Exits with 1 when a bound is exceeded or the
+//teapot can't be loaded.
+
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include "allmodels.h"
+
+using namespace Models;
+
+const float maxPositionError = 2.5e-4f; //Half float, components below 1
+const float maxNormalError = 1.6e-3f; //Length of the difference, 10 bit snorm components
+const float maxTexCoordError = 4.9e-4f; //Half float, coordinates below 1
+
+static float normalError(const float *normal) {
+	glm::vec4 n(normal[0], normal[1], normal[2], normal[3]);
+	glm::vec4 unpacked = unpackNormal(packNormal(n));
+	return glm::length(glm::vec3(unpacked) - glm::vec3(n));
+}
+
+static bool check(const char *name, Model &m) {
+	float position = 0, normal = 0, texCoord = 0;
+	for (int i = 0; i < m.vertexCount; i++) {
+		PackedVertex v = packVertex(m.vertices + 4 * i, m.vertexNormals + 4 * i, m.texCoords + 4 * i);
+		glm::vec4 p, n;
+		glm::vec2 t;
+		unpackVertex(v, p, n, t);
+		for (int c = 0; c < 4; c++) position = std::max(position, fabsf(p[c] - m.vertices[4 * i + c]));
+		normal = std::max(normal, glm::length(glm::vec3(n) - glm::vec3(m.vertexNormals[4 * i], m.vertexNormals[4 * i + 1], m.vertexNormals[4 * i + 2])));
+		for (int c = 0; c < 2; c++) texCoord = std::max(texCoord, fabsf(t[c] - m.texCoords[4 * i + c]));
+		if (m.normals != m.vertexNormals) normal = std::max(normal, normalError(m.normals + 4 * i));
+	}
+	bool ok = m.vertexCount > 0 && position <= maxPositionError && normal <= maxNormalError && texCoord <= maxTexCoordError;
+	printf("%-7s %8d %12g %12g %12g %s\n", name, m.vertexCount, position, normal, texCoord, ok ? "ok" : "FAIL");
+	return ok;
+}
+
+int main(int argc, char **argv) {
+	const char *teapotPath = argc > 1 ? argv[1] : "teapot.mesh";
+	if (!teapot.load(teapotPath)) fprintf(stderr, "Can't load %s\n", teapotPath);
+	printf("%-7s %8s %12s %12s %12s\n", "model", "vertices", "position", "normal", "texcoord");
+	bool ok = check("cube", cube);
+	ok = check("sphere", sphere) && ok;
+	ok = check("torus", torus) && ok;
+	ok = check("teapot", teapot) && ok;
+	printf("bounds %21g %12g %12g\n", maxPositionError, maxNormalError, maxTexCoordError);
+	return ok ? 0 : 1;
+}
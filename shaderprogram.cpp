@@ -14,6 +14,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "shaderprogram.h"
+#include "staticbatch.h"
+#include "bezier.h"
+#include <algorithm>
 
 
 
@@ -22,6 +25,11 @@ ShaderProgram* spConstant;
 ShaderProgram* spTextured;
 ShaderProgram* spColored;
 ShaderProgram* spLambertTextured;
+ShaderProgram* spCrowd;
+ShaderProgram* spGallery = NULL;
+ShaderProgram* spHiZ = NULL;
+ShaderProgram* spCull = NULL;
+ShaderProgram* spBezier = NULL;
 
 void initShaders() {
 	spLambert = new ShaderProgram("v_lambert.glsl", NULL, "f_lambert.glsl");
@@ -29,6 +37,44 @@ void initShaders() {
 	spTextured = new ShaderProgram("v_textured.glsl", NULL, "f_textured.glsl");
 	spColored = new ShaderProgram("v_colored.glsl", NULL, "f_colored.glsl");
 	spLambertTextured = new ShaderProgram("v_lamberttextured.glsl", NULL, "f_lamberttextured.glsl");
+	spCrowd = new ShaderProgram("v_crowd.glsl", NULL, "f_lambert.glsl");
+	if (StaticBatch::supported()) spGallery = new ShaderProgram("v_gallery.glsl", NULL, "f_gallery.glsl");
+	if (StaticBatch::cullingSupported()) {
+		spHiZ = new ShaderProgram("c_hiz.glsl");
+		spCull = new ShaderProgram("c_cull.glsl");
+	}
+	if (Models::BezierSurface::tessellationSupported()) spBezier = new ShaderProgram("v_bezier.glsl", NULL, "te_bezier.glsl", NULL, "f_lambert.glsl");
+}
+
+//All programs that exist in this context
+static int programs(ShaderProgram** out) {
+	ShaderProgram* all[] = { spLambert, spConstant, spTextured, spColored, spLambertTextured, spCrowd, spGallery, spHiZ, spCull, spBezier };
+	int count = 0;
+	for (ShaderProgram* p : all) if (p != NULL) out[count++] = p;
+	return count;
+}
+
+void shaderFiles(std::vector<std::string>& out) {
+	ShaderProgram* all[16];
+	int count = programs(all);
+	for (int i = 0; i < count; i++) {
+		std::vector<std::string> files;
+		all[i]->sources(files);
+		for (const std::string& f : files)
+			if (std::find(out.begin(), out.end(), f) == out.end()) out.push_back(f);
+	}
+}
+
+void reloadShaders(const std::vector<std::string>& changed) {
+	ShaderProgram* all[16];
+	int count = programs(all);
+	for (int i = 0; i < count; i++) {
+		for (const std::string& f : changed) {
+			if (!all[i]->uses(f)) continue;
+			all[i]->reload();
+			break;
+		}
+	}
 }
 
 void freeShaders() {
@@ -37,6 +83,15 @@ void freeShaders() {
 	delete spTextured;
 	delete spColored;
 	delete spLambertTextured;
+	delete spCrowd;
+	delete spGallery;
+	delete spHiZ;
+	delete spCull;
+	delete spBezier;
+	spGallery = NULL;
+	spHiZ = NULL;
+	spCull = NULL;
+	spBezier = NULL;
 }
 
 //Procedure reads a file into an array of chars
@@ -96,11 +151,32 @@ GLuint ShaderProgram::loadShader(GLenum shaderType,const char* fileName) {
 	return shader;
 }
 
-ShaderProgram::ShaderProgram(const char* vertexShaderFile,const char* geometryShaderFile,const char* fragmentShaderFile) {
+ShaderProgram::ShaderProgram(const char* vertexShaderFile,const char* geometryShaderFile,const char* fragmentShaderFile)
+	: ShaderProgram(vertexShaderFile,NULL,NULL,geometryShaderFile,fragmentShaderFile) {
+}
+
+ShaderProgram::ShaderProgram(const char* vertexShaderFile,const char* tessControlShaderFile,const char* tessEvaluationShaderFile,const char* geometryShaderFile,const char* fragmentShaderFile) {
+	const char* names[6] = { vertexShaderFile, tessControlShaderFile, tessEvaluationShaderFile, geometryShaderFile, fragmentShaderFile, NULL };
+	for (int i = 0; i < 6; i++) files[i] = names[i] != NULL ? names[i] : "";
+
 	//Load vertex shader
 	printf("Loading vertex shader...\n");
 	vertexShader=loadShader(GL_VERTEX_SHADER,vertexShaderFile);
 
+	//Load tessellation shaders
+	if (tessControlShaderFile!=NULL) {
+		printf("Loading tessellation control shader...\n");
+		tessControlShader=loadShader(GL_TESS_CONTROL_SHADER,tessControlShaderFile);
+	} else {
+		tessControlShader=0;
+	}
+	if (tessEvaluationShaderFile!=NULL) {
+		printf("Loading tessellation evaluation shader...\n");
+		tessEvaluationShader=loadShader(GL_TESS_EVALUATION_SHADER,tessEvaluationShaderFile);
+	} else {
+		tessEvaluationShader=0;
+	}
+
 	//Load geometry shader
 	if (geometryShaderFile!=NULL) {
 		printf("Loading geometry shader...\n");
@@ -112,6 +188,7 @@ ShaderProgram::ShaderProgram(const char* vertexShaderFile,const char* geometrySh
 	//Load fragment shader
 	printf("Loading fragment shader...\n");
 	fragmentShader=loadShader(GL_FRAGMENT_SHADER,fragmentShaderFile);
+	computeShader=0;
 
 	//Generate shader program handle
 	shaderProgram=glCreateProgram();
@@ -119,6 +196,8 @@ ShaderProgram::ShaderProgram(const char* vertexShaderFile,const char* geometrySh
 	//Attach shaders and link shader program
 	glAttachShader(shaderProgram,vertexShader);
 	glAttachShader(shaderProgram,fragmentShader);
+	if (tessControlShader!=0) glAttachShader(shaderProgram,tessControlShader);
+	if (tessEvaluationShader!=0) glAttachShader(shaderProgram,tessEvaluationShader);
 	if (geometryShaderFile!=NULL) glAttachShader(shaderProgram,geometryShader);
 	glLinkProgram(shaderProgram);
 
@@ -140,16 +219,57 @@ ShaderProgram::ShaderProgram(const char* vertexShaderFile,const char* geometrySh
 	printf("Shader program created \n");
 }
 
+ShaderProgram::ShaderProgram(const char* computeShaderFile) {
+	files[5] = computeShaderFile;
+
+	//Load compute shader
+	printf("Loading compute shader...\n");
+	computeShader=loadShader(GL_COMPUTE_SHADER,computeShaderFile);
+	vertexShader=0;
+	tessControlShader=0;
+	tessEvaluationShader=0;
+	geometryShader=0;
+	fragmentShader=0;
+
+	//Generate shader program handle, attach the shader and link
+	shaderProgram=glCreateProgram();
+	glAttachShader(shaderProgram,computeShader);
+	glLinkProgram(shaderProgram);
+
+	//Download an error log and display it
+	int infologLength = 0;
+	int charsWritten  = 0;
+	char *infoLog;
+
+	glGetProgramiv(shaderProgram, GL_INFO_LOG_LENGTH,&infologLength);
+
+	if (infologLength > 1)
+	{
+		infoLog = new char[infologLength];
+		glGetProgramInfoLog(shaderProgram, infologLength, &charsWritten, infoLog);
+		printf("%s\n",infoLog);
+		delete []infoLog;
+	}
+
+	printf("Shader program created \n");
+}
+
 ShaderProgram::~ShaderProgram() {
 	//Detach shaders from program
-	glDetachShader(shaderProgram, vertexShader);
+	if (vertexShader!=0) glDetachShader(shaderProgram, vertexShader);
+	if (tessControlShader!=0) glDetachShader(shaderProgram, tessControlShader);
+	if (tessEvaluationShader!=0) glDetachShader(shaderProgram, tessEvaluationShader);
 	if (geometryShader!=0) glDetachShader(shaderProgram, geometryShader);
-	glDetachShader(shaderProgram, fragmentShader);
+	if (fragmentShader!=0) glDetachShader(shaderProgram, fragmentShader);
+	if (computeShader!=0) glDetachShader(shaderProgram, computeShader);
 
 	//Delete shaders
-	glDeleteShader(vertexShader);
+	if (vertexShader!=0) glDeleteShader(vertexShader);
+	if (tessControlShader!=0) glDeleteShader(tessControlShader);
+	if (tessEvaluationShader!=0) glDeleteShader(tessEvaluationShader);
 	if (geometryShader!=0) glDeleteShader(geometryShader);
-	glDeleteShader(fragmentShader);
+	if (fragmentShader!=0) glDeleteShader(fragmentShader);
+	if (computeShader!=0) glDeleteShader(computeShader);
 
 	//Delete program
 	glDeleteProgram(shaderProgram);
@@ -170,3 +290,39 @@ GLuint ShaderProgram::u(const char* variableName) {
 GLuint ShaderProgram::a(const char* variableName) {
 	return glGetAttribLocation(shaderProgram,variableName);
 }
+
+//Check the link status (a stage that failed to compile fails the link as well)
+bool ShaderProgram::linked() {
+	GLint status = GL_FALSE;
+	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &status);
+	return status == GL_TRUE;
+}
+
+bool ShaderProgram::uses(const std::string& fileName) const {
+	for (int i = 0; i < 6; i++) if (!files[i].empty() && files[i] == fileName) return true;
+	return false;
+}
+
+void ShaderProgram::sources(std::vector<std::string>& out) const {
+	for (int i = 0; i < 6; i++) if (!files[i].empty()) out.push_back(files[i]);
+}
+
+//Build a second program from the same files; on success the two objects trade handles and the old ones are deleted with it.
+//Uniform and attribute slots are looked up on every use, so callers keep working with the new program.
+bool ShaderProgram::reload() {
+	auto name = [this](int stage) { return files[stage].empty() ? (const char*)NULL : files[stage].c_str(); };
+	ShaderProgram* fresh = files[5].empty() ? new ShaderProgram(name(0), name(1), name(2), name(3), name(4)) : new ShaderProgram(name(5));
+	bool ok = fresh->linked();
+	if (ok) {
+		std::swap(shaderProgram, fresh->shaderProgram);
+		std::swap(vertexShader, fresh->vertexShader);
+		std::swap(tessControlShader, fresh->tessControlShader);
+		std::swap(tessEvaluationShader, fresh->tessEvaluationShader);
+		std::swap(geometryShader, fresh->geometryShader);
+		std::swap(fragmentShader, fresh->fragmentShader);
+		std::swap(computeShader, fresh->computeShader);
+	}
+	printf("%s %s\n", ok ? "Reloaded" : "Kept the old program, reload failed:", files[5].empty() ? files[0].c_str() : files[5].c_str());
+	delete fresh;
+	return ok;
+}
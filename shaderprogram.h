@@ -19,21 +19,33 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "GL/glew.h"
 #include "stdio.h"
+#include <string>
+#include <vector>
 
 class ShaderProgram {
 private:
 	GLuint shaderProgram; //Shader program handle
 	GLuint vertexShader; //Vertex shader handle
+	GLuint tessControlShader; //Tessellation control shader handle
+	GLuint tessEvaluationShader; //Tessellation evaluation shader handle
 	GLuint geometryShader; //Geometry shader handle
 	GLuint fragmentShader; //Fragment shader handle
+	GLuint computeShader; //Compute shader handle
+	std::string files[6]; //Source of every stage in the order of the constructor arguments, compute last; empty if unused
 	char* readFile(const char* fileName); //File reading method
 	GLuint loadShader(GLenum shaderType,const char* fileName); //Method reads shader source file, compiles it and returns the corresponding handle
 public:
 	ShaderProgram(const char* vertexShaderFile,const char* geometryShaderFile,const char* fragmentShaderFile);
+	ShaderProgram(const char* vertexShaderFile,const char* tessControlShaderFile,const char* tessEvaluationShaderFile,const char* geometryShaderFile,const char* fragmentShaderFile); //Unused stages can be NULL
+	ShaderProgram(const char* computeShaderFile); //Compute-only program
 	~ShaderProgram();
 	void use(); //Turns on the shader program
 	GLuint u(const char* variableName); //Returns the slot number corresponding to the uniform variableName
 	GLuint a(const char* variableName); //Returns the slot number corresponding to the attribute variableName
+	bool linked(); //Returns true if all stages compiled and the program linked
+	bool uses(const std::string& fileName) const; //Returns true if a stage is read from fileName
+	void sources(std::vector<std::string>& out) const; //Appends the files of all stages
+	bool reload(); //Compiles the files again and swaps the new program in if it links, otherwise keeps the old one
 };
 
 extern ShaderProgram *spConstant;
@@ -41,8 +53,15 @@ extern ShaderProgram *spLambert;
 extern ShaderProgram* spTextured;
 extern ShaderProgram* spColored;
 extern ShaderProgram* spLambertTextured;
+extern ShaderProgram* spCrowd;
+extern ShaderProgram* spGallery; //NULL if the multi-draw-indirect path is not supported
+extern ShaderProgram* spHiZ; //NULL if GPU occlusion culling is not supported
+extern ShaderProgram* spCull;
+extern ShaderProgram* spBezier; //NULL if tessellation shaders are not supported
 
 void initShaders();
 void freeShaders();
+void shaderFiles(std::vector<std::string>& out); //Source files of all programs, each once
+void reloadShaders(const std::vector<std::string>& changed); //Recompiles the programs that use one of the files
 
 #endif
@@ -14,6 +14,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "sphere.h"
+#include <algorithm>
 
 
 namespace Models {
@@ -31,115 +32,72 @@ namespace Models {
 	Sphere::~Sphere() {		
 	}
 	
-	inline float Sphere::d2r(float deg) {
-		return PI*deg/180.0f;
-	}
-
-	vec4 Sphere::generateSpherePoint(float r,float alpha,float beta) {
-		alpha=d2r(alpha);
-		beta=d2r(beta);
-		return vec4(r*cos(alpha)*cos(beta),r*cos(alpha)*sin(beta),r*sin(alpha),1.0f);
-	}
-
-	vec4 Sphere::computeVertexNormal(float alpha,float beta) {
-		alpha=d2r(alpha);
-		beta=d2r(beta);
-		return vec4(cos(alpha)*cos(beta),cos(alpha)*sin(beta),sin(alpha),0.0f);
-	}
-
-	vec4 Sphere::computeFaceNormal(vector<vec4> &face) {
-		vec3 a=vec3(face[1]-face[0]);
-		vec3 b=vec3(face[2]-face[0]);
-		
-		return normalize(vec4(cross(b,a),0.0f));
-	}
-
-	void Sphere::generateSphereFace(vector<vec4> &vertices, vector<vec4> &vertexNormals, vec4 &faceNormal,float r,float alpha,float beta,float step_alpha,float step_beta) {
-		vertices.clear();
-		vertexNormals.clear();	
-		
-		vertices.push_back(generateSpherePoint(r,alpha,beta));
-		vertices.push_back(generateSpherePoint(r,alpha+step_alpha,beta));
-		vertices.push_back(generateSpherePoint(r,alpha+step_alpha,beta+step_beta));
-		vertices.push_back(generateSpherePoint(r,alpha,beta+step_beta));
-		
-		faceNormal=computeFaceNormal(vertices);
-		
-		vertexNormals.push_back(computeVertexNormal(alpha,beta));
-		vertexNormals.push_back(computeVertexNormal(alpha+step_alpha,beta));
-		vertexNormals.push_back(computeVertexNormal(alpha+step_alpha,beta+step_beta));
-		vertexNormals.push_back(computeVertexNormal(alpha,beta+step_beta));
-	}
-
-
-
+	//Grid of (tubeDivs+1) rings by mainDivs meridians, the poles collapse to single vertices.
+	//Ring and meridian angles come from tables; rings are filled in parallel, every ring
+	//writes a fixed slice of the vertex and index arrays.
 	void Sphere::buildSphere(float r,float mainDivs,float tubeDivs) {
-		vector<vec4> face;
-		vector<vec4> faceVertexNormals;
-		vec4 normal;
-
-		internalVertices.clear();
-		internalFaceNormals.clear();
-		internalVertexNormals.clear();
-			
-		float mult_alpha=180.0f/tubeDivs;
-		float mult_beta=360.0f/mainDivs;
-		
-		for (int alpha=0;alpha<round(tubeDivs);alpha++) {			
-			for (int beta=0;beta<round(mainDivs);beta++) {
-				
-				generateSphereFace(face,faceVertexNormals,normal,r,alpha*mult_alpha-90.0f,beta*mult_beta,mult_alpha, mult_beta);			
-				
-				internalVertices.push_back(face[0]);
-				internalVertices.push_back(face[1]);
-				internalVertices.push_back(face[2]);
-				
-				internalVertices.push_back(face[0]);
-				internalVertices.push_back(face[2]);
-				internalVertices.push_back(face[3]);
-				
-				internalVertexNormals.push_back(faceVertexNormals[0]);
-				internalVertexNormals.push_back(faceVertexNormals[1]);
-				internalVertexNormals.push_back(faceVertexNormals[2]);
-				
-				internalVertexNormals.push_back(faceVertexNormals[0]);
-				internalVertexNormals.push_back(faceVertexNormals[2]);
-				internalVertexNormals.push_back(faceVertexNormals[3]);
-							
-				for (int i=0;i<6;i++) internalFaceNormals.push_back(normal);
-				
-				
+		int rings=std::max((int)round(tubeDivs),2);
+		int sectors=std::max((int)round(mainDivs),3);
+
+		vector<float> ringSin,ringCos,sectorSin,sectorCos;
+		sinCosTable(-PI/2,PI/rings,rings,ringSin,ringCos);
+		sinCosTable(0,2*PI/sectors,sectors,sectorSin,sectorCos);
+
+		//Pole, rings 1..rings-1, pole
+		internalVertices.resize(2+(rings-1)*sectors);
+		internalVertexNormals.resize(internalVertices.size());
+		internalTexCoords.clear();
+		//Rings next to a pole have one triangle per sector, the others two
+		internalIndices.resize(3*(size_t)sectors*(2*rings-2));
+
+		unsigned int lastPole=(unsigned int)internalVertices.size()-1;
+		auto vertexIndex=[&](int alpha,int beta) -> unsigned int {
+			if (alpha==0) return 0;
+			if (alpha==rings) return lastPole;
+			return 1+(alpha-1)*sectors+beta;
+		};
+
+		parallelRanges(rings+1,64,[&](int begin,int end) {
+			for (int alpha=begin;alpha<end;alpha++) {
+				int count=(alpha==0 || alpha==rings) ? 1 : sectors;
+				vec4 *v=&internalVertices[vertexIndex(alpha,0)];
+				vec4 *n=&internalVertexNormals[vertexIndex(alpha,0)];
+				for (int beta=0;beta<count;beta++) {
+					vec4 normal(ringCos[alpha]*sectorCos[beta],ringCos[alpha]*sectorSin[beta],ringSin[alpha],0.0f);
+					n[beta]=normal;
+					v[beta]=vec4(r*vec3(normal),1.0f);
+				}
 			}
-		}
-		
-		vertices=(float*)internalVertices.data();
-		normals=(float*)internalFaceNormals.data();
-		vertexNormals=(float*)internalVertexNormals.data();
-		texCoords=vertexNormals;
-		vertexCount=internalVertices.size();
-	}
-
-	void Sphere::drawSolid(bool smooth) {
-
-		glEnableVertexAttribArray(0);
-        glEnableVertexAttribArray(1);
-        glEnableVertexAttribArray(2);
-        //glEnableVertexAttribArray(3);
-
-
-        glVertexAttribPointer(0,4,GL_FLOAT,false,0,vertices);
-        if (!smooth) glVertexAttribPointer(1,4,GL_FLOAT,false,0,normals);
-        else glVertexAttribPointer(1,4,GL_FLOAT,false,0,vertexNormals);
-        glVertexAttribPointer(2,4,GL_FLOAT,false,0,texCoords);
-        //glVertexAttribPointer(3,4,GL_FLOAT,false,0,Models::CubeInternal::colors);
-
-        glDrawArrays(GL_TRIANGLES,0,vertexCount);
+		});
+
+		parallelRanges(rings,64,[&](int begin,int end) {
+			for (int alpha=begin;alpha<end;alpha++) {
+				unsigned int *index=&internalIndices[3*(size_t)sectors*(alpha==0 ? 0 : 2*alpha-1)];
+				for (int beta=0;beta<sectors;beta++) {
+					int next=(beta+1)%sectors;
+					unsigned int face[4]={
+						vertexIndex(alpha,beta),
+						vertexIndex(alpha+1,beta),
+						vertexIndex(alpha+1,next),
+						vertexIndex(alpha,next)
+					};
+
+					//Triangles touching a pole are degenerate, skip them
+					if (alpha+1<rings) {
+						*index++=face[0];
+						*index++=face[1];
+						*index++=face[2];
+					}
+					if (alpha>0) {
+						*index++=face[0];
+						*index++=face[2];
+						*index++=face[3];
+					}
+				}
+			}
+		});
 
-        glDisableVertexAttribArray(0);
-        glDisableVertexAttribArray(1);
-        glDisableVertexAttribArray(2);
-        //glDisableVertexAttribArray(3);
+		finalize();
 	}
 
-
 }
@@ -0,0 +1,316 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "staticbatch.h"
+#include "shaderprogram.h"
+#include <glm/gtc/type_ptr.hpp>
+
+StaticBatch::StaticBatch() {
+	vao = 0;
+	vertexBuffer = 0;
+	texCoordBuffer = 0;
+	drawBuffer = 0;
+	commandBuffer = 0;
+	textureArray = 0;
+	boundsBuffer = 0;
+	identityIdBuffer = 0;
+	visibleCommandBuffer = 0;
+	visibleIdBuffer = 0;
+	parameterBuffer = 0;
+	flagBuffer = 0;
+	culled = false;
+}
+
+StaticBatch::~StaticBatch() {
+	//GL objects are freed by release(), the context is already gone here
+}
+
+bool StaticBatch::supported() {
+	return GLEW_VERSION_4_3 && GLEW_ARB_shader_draw_parameters;
+}
+
+bool StaticBatch::cullingSupported() {
+	return supported() && GLEW_ARB_indirect_parameters;
+}
+
+int StaticBatch::addMesh(const float* vertices, const float* texCoords, int vertexCount) {
+	MeshRange range;
+	range.first = (GLuint)(vertexData.size() / 4);
+	range.count = (GLuint)vertexCount;
+	range.bmin = glm::vec3(vertices[0], vertices[1], vertices[2]);
+	range.bmax = range.bmin;
+	for (int i = 1; i < vertexCount; i++) {
+		glm::vec3 v(vertices[4 * i], vertices[4 * i + 1], vertices[4 * i + 2]);
+		range.bmin = glm::min(range.bmin, v);
+		range.bmax = glm::max(range.bmax, v);
+	}
+	vertexData.insert(vertexData.end(), vertices, vertices + 4 * vertexCount);
+	texCoordData.insert(texCoordData.end(), texCoords, texCoords + 2 * vertexCount);
+	meshes.push_back(range);
+	return (int)meshes.size() - 1;
+}
+
+int StaticBatch::layerFor(GLuint texture) {
+	std::map<GLuint, int>::iterator it = layers.find(texture);
+	if (it != layers.end()) return it->second;
+
+	int layer = (int)layerSources.size();
+	layers[texture] = layer;
+	layerSources.push_back(texture);
+	return layer;
+}
+
+void StaticBatch::addDraw(int mesh, const glm::mat4& M, GLuint texture) {
+	DrawData data;
+	data.M = M;
+	data.params = glm::ivec4(layerFor(texture), 0, 0, 0);
+	draws.push_back(data);
+
+	DrawArraysIndirectCommand cmd;
+	cmd.count = meshes[mesh].count;
+	cmd.instanceCount = 1;
+	cmd.first = meshes[mesh].first;
+	cmd.baseInstance = 0;
+	commands.push_back(cmd);
+
+	//World space box around the transformed model space box
+	const MeshRange& range = meshes[mesh];
+	Bounds b;
+	b.bmin = glm::vec4(1e30f);
+	b.bmax = glm::vec4(-1e30f);
+	for (int c = 0; c < 8; c++) {
+		glm::vec3 corner((c & 1) ? range.bmax.x : range.bmin.x, (c & 2) ? range.bmax.y : range.bmin.y, (c & 4) ? range.bmax.z : range.bmin.z);
+		glm::vec4 p = M * glm::vec4(corner, 1.0f);
+		b.bmin = glm::min(b.bmin, p);
+		b.bmax = glm::max(b.bmax, p);
+	}
+	bounds.push_back(b);
+}
+
+//Every source texture is blitted (and rescaled) into its own layer of the array
+void StaticBatch::buildTextureArray() {
+	glGenTextures(1, &textureArray);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, textureArray);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, layerSize, layerSize, (GLsizei)layerSources.size(), 0,
+		GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	GLuint fbo[2];
+	glGenFramebuffers(2, fbo);
+	for (size_t i = 0; i < layerSources.size(); i++) copyLayer((int)i, fbo);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(2, fbo);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
+
+//fbo - two framebuffers to read from and draw into
+void StaticBatch::copyLayer(int layer, const GLuint* fbo) {
+	GLint width = 0, height = 0;
+	glBindTexture(GL_TEXTURE_2D, layerSources[layer]);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+	if (width == 0 || height == 0) return; //Image failed to load, leave the layer black
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo[0]);
+	glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, layerSources[layer], 0);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbo[1]);
+	glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, textureArray, 0, layer);
+	glBlitFramebuffer(0, 0, width, height, 0, 0, layerSize, layerSize, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+}
+
+void StaticBatch::refreshTexture(GLuint texture) {
+	std::map<GLuint, int>::const_iterator layer = layers.find(texture);
+	if (layer == layers.end() || textureArray == 0) return;
+	GLuint fbo[2];
+	glGenFramebuffers(2, fbo);
+	copyLayer(layer->second, fbo);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(2, fbo);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void StaticBatch::upload() {
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+
+	glGenBuffers(1, &vertexBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, vertexData.size() * sizeof(float), vertexData.data(), GL_STATIC_DRAW);
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 4, GL_FLOAT, false, 0, NULL);
+
+	glGenBuffers(1, &texCoordBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, texCoordBuffer);
+	glBufferData(GL_ARRAY_BUFFER, texCoordData.size() * sizeof(float), texCoordData.data(), GL_STATIC_DRAW);
+	glEnableVertexAttribArray(2);
+	glVertexAttribPointer(2, 2, GL_FLOAT, false, 0, NULL);
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0); //The rest of the program draws from client memory
+
+	glGenBuffers(1, &drawBuffer);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, drawBuffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, draws.size() * sizeof(DrawData), draws.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	glGenBuffers(1, &commandBuffer);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+	glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawArraysIndirectCommand), commands.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+	std::vector<GLuint> ids(draws.size());
+	for (size_t i = 0; i < ids.size(); i++) ids[i] = (GLuint)i;
+	glGenBuffers(1, &identityIdBuffer);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, identityIdBuffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, ids.size() * sizeof(GLuint), ids.data(), GL_STATIC_DRAW);
+
+	std::vector<GLuint> flags(draws.size(), 1);
+	glGenBuffers(1, &flagBuffer);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, flagBuffer);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, flags.size() * sizeof(GLuint), flags.data(), GL_DYNAMIC_COPY);
+
+	if (cullingSupported()) {
+		glGenBuffers(1, &boundsBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, boundsBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, bounds.size() * sizeof(Bounds), bounds.data(), GL_STATIC_DRAW);
+
+		glGenBuffers(1, &visibleCommandBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, visibleCommandBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, commands.size() * sizeof(DrawArraysIndirectCommand), NULL, GL_DYNAMIC_COPY);
+
+		glGenBuffers(1, &visibleIdBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, visibleIdBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, draws.size() * sizeof(GLuint), NULL, GL_DYNAMIC_COPY);
+
+		glGenBuffers(1, &parameterBuffer);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, parameterBuffer);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(GLuint), NULL, GL_DYNAMIC_COPY);
+	}
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	buildTextureArray();
+}
+
+void StaticBatch::cull(const glm::mat4& P, const glm::mat4& V, const HiZBuffer& hiz) {
+	if (commands.empty() || spCull == NULL) return;
+
+	GLuint zero = 0;
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, parameterBuffer);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(GLuint), &zero);
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	spCull->use();
+	glm::mat4 PV = P * V;
+	glUniformMatrix4fv(spCull->u("PV"), 1, false, glm::value_ptr(PV));
+	glUniform1i(spCull->u("objectCount"), (GLint)commands.size());
+	glUniform1i(spCull->u("useHiZ"), hiz.valid() ? 1 : 0);
+	glUniform2f(spCull->u("hizSize"), (float)hiz.width(), (float)hiz.height());
+	glUniform1i(spCull->u("hizLevels"), hiz.levels());
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, hiz.texture());
+	glUniform1i(spCull->u("hiz"), 0);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, boundsBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, commandBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, visibleCommandBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, visibleIdBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, parameterBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, flagBuffer);
+
+	glDispatchCompute(((GLuint)commands.size() + 63) / 64, 1, 1);
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	culled = true;
+}
+
+void StaticBatch::bindDraws(const glm::mat4& P, const glm::mat4& V, GLuint drawIds) {
+	spGallery->use();
+	glUniformMatrix4fv(spGallery->u("P"), 1, false, glm::value_ptr(P));
+	glUniformMatrix4fv(spGallery->u("V"), 1, false, glm::value_ptr(V));
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, textureArray);
+	glUniform1i(spGallery->u("tex"), 0);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, drawBuffer);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, drawIds);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, flagBuffer);
+	glBindVertexArray(vao);
+}
+
+void StaticBatch::draw(const glm::mat4& P, const glm::mat4& V) {
+	if (commands.empty()) return;
+
+	if (culled) {
+		bindDraws(P, V, visibleIdBuffer);
+		glUniform1i(spGallery->u("cullDebug"), 0);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, visibleCommandBuffer);
+		glBindBuffer(GL_PARAMETER_BUFFER_ARB, parameterBuffer);
+		glMultiDrawArraysIndirectCountARB(GL_TRIANGLES, NULL, 0, (GLsizei)commands.size(), 0);
+		glBindBuffer(GL_PARAMETER_BUFFER_ARB, 0);
+		culled = false;
+	}
+	else {
+		bindDraws(P, V, identityIdBuffer);
+		glUniform1i(spGallery->u("cullDebug"), 0);
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+		glMultiDrawArraysIndirect(GL_TRIANGLES, NULL, (GLsizei)commands.size(), 0);
+	}
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
+
+//All objects are submitted, the vertex shader collapses the visible ones
+void StaticBatch::drawCulled(const glm::mat4& P, const glm::mat4& V) {
+	if (commands.empty()) return;
+
+	bindDraws(P, V, identityIdBuffer);
+	glUniform1i(spGallery->u("cullDebug"), 1);
+	glDisable(GL_DEPTH_TEST);
+	glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+	glMultiDrawArraysIndirect(GL_TRIANGLES, NULL, (GLsizei)commands.size(), 0);
+
+	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+	glEnable(GL_DEPTH_TEST);
+	glUniform1i(spGallery->u("cullDebug"), 0);
+	glBindVertexArray(0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+}
+
+void StaticBatch::release() {
+	glDeleteVertexArrays(1, &vao);
+	glDeleteBuffers(1, &vertexBuffer);
+	glDeleteBuffers(1, &texCoordBuffer);
+	glDeleteBuffers(1, &drawBuffer);
+	glDeleteBuffers(1, &commandBuffer);
+	glDeleteTextures(1, &textureArray);
+	glDeleteBuffers(1, &boundsBuffer);
+	glDeleteBuffers(1, &identityIdBuffer);
+	glDeleteBuffers(1, &visibleCommandBuffer);
+	glDeleteBuffers(1, &visibleIdBuffer);
+	glDeleteBuffers(1, &parameterBuffer);
+	glDeleteBuffers(1, &flagBuffer);
+	vao = vertexBuffer = texCoordBuffer = drawBuffer = commandBuffer = textureArray = 0;
+	boundsBuffer = identityIdBuffer = visibleCommandBuffer = visibleIdBuffer = parameterBuffer = flagBuffer = 0;
+	culled = false;
+}
@@ -0,0 +1,110 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATICBATCH_H
+#define STATICBATCH_H
+
+//Static geometry submitted with a single glMultiDrawArraysIndirect call.
+//Meshes are packed into shared vertex buffers, every draw gets a
+//DrawArraysIndirectCommand and a per-draw record (model matrix, texture layer)
+//that the vertex shader fetches with gl_DrawID.
+//Textures are resampled into layers of one GL_TEXTURE_2D_ARRAY so that the
+//whole batch can be drawn without rebinding anything.
+//With cull() a compute shader tests every object against the frustum and the
+//previous frame's Hi-Z pyramid and the next draw() submits only the survivors.
+
+#include <GL/glew.h>
+#include <vector>
+#include <map>
+#include <glm/glm.hpp>
+#include "hizbuffer.h"
+
+class StaticBatch {
+public:
+	StaticBatch();
+	~StaticBatch();
+
+	static bool supported(); //True if the context can run the multi-draw-indirect path
+	static bool cullingSupported(); //True if GPU occlusion culling can be used as well
+
+	int addMesh(const float* vertices, const float* texCoords, int vertexCount); //vertices - vec4 per vertex, texCoords - vec2 per vertex; returns mesh id
+	void addDraw(int mesh, const glm::mat4& M, GLuint texture); //texture is a regular GL_TEXTURE_2D handle
+	void upload(); //Creates GL buffers and the texture array, call once after all draws were added
+	void refreshTexture(GLuint texture); //Copies a texture given to addDraw() into its layer again, after its image changed
+	void cull(const glm::mat4& P, const glm::mat4& V, const HiZBuffer& hiz); //Compacts the draw list for the next draw()
+	void draw(const glm::mat4& P, const glm::mat4& V);
+	void drawCulled(const glm::mat4& P, const glm::mat4& V); //Debug view: culled objects as red wireframe, through walls
+	void release();
+
+	int drawCount() const { return (int)draws.size(); }
+
+	static const int layerSize = 512; //Resolution of a single texture array layer
+
+private:
+	struct MeshRange {
+		GLuint first;
+		GLuint count;
+		glm::vec3 bmin; //Model space bounding box
+		glm::vec3 bmax;
+	};
+
+	struct Bounds { //World space bounding box, matches c_cull.glsl
+		glm::vec4 bmin;
+		glm::vec4 bmax;
+	};
+
+	struct DrawData { //Matches the std430 layout of the Draws block in v_gallery.glsl
+		glm::mat4 M;
+		glm::ivec4 params; //x - texture layer
+	};
+
+	struct DrawArraysIndirectCommand {
+		GLuint count;
+		GLuint instanceCount;
+		GLuint first;
+		GLuint baseInstance;
+	};
+
+	std::vector<float> vertexData;
+	std::vector<float> texCoordData;
+	std::vector<MeshRange> meshes;
+	std::vector<DrawData> draws;
+	std::vector<DrawArraysIndirectCommand> commands;
+	std::vector<Bounds> bounds;
+	std::map<GLuint, int> layers; //GL_TEXTURE_2D handle -> texture array layer
+	std::vector<GLuint> layerSources;
+
+	GLuint vao;
+	GLuint vertexBuffer;
+	GLuint texCoordBuffer;
+	GLuint drawBuffer;
+	GLuint commandBuffer;
+	GLuint textureArray;
+
+	GLuint boundsBuffer;
+	GLuint identityIdBuffer; //drawIds when the full command list is drawn
+	GLuint visibleCommandBuffer; //Compacted commands written by c_cull.glsl
+	GLuint visibleIdBuffer;
+	GLuint parameterBuffer; //Number of compacted commands
+	GLuint flagBuffer; //Per-object visibility, for the debug view
+	bool culled; //cull() ran since the last draw()
+
+	int layerFor(GLuint texture);
+	void bindDraws(const glm::mat4& P, const glm::mat4& V, GLuint drawIds);
+	void buildTextureArray();
+	void copyLayer(int layer, const GLuint* fbo);
+};
+
+#endif
@@ -0,0 +1,54 @@
+#version 400
+
+//Bicubic Bezier patch, 16 control points in rows along u. Tessellation levels come
+//from glPatchParameterfv; fractional spacing lets the detail change without popping.
+layout (quads, fractional_even_spacing, cw) in;
+
+//Uniform variables
+uniform mat4 P;
+uniform mat4 V;
+uniform mat4 M;
+
+uniform vec4 color=vec4(1,1,1,1);
+uniform vec4 lightDir=vec4(0,0,1,0);
+
+//varying variables
+out vec4 i_color;
+
+//Cubic Bernstein polynomials (b) and their derivatives (d)
+void bernstein(float t, out vec4 b, out vec4 d) {
+    float s=1.0-t;
+    b=vec4(s*s*s, 3.0*t*s*s, 3.0*t*t*s, t*t*t);
+    d=vec4(-3.0*s*s, 3.0*s*s-6.0*t*s, 6.0*t*s-3.0*t*t, 3.0*t*t);
+}
+
+void main(void) {
+    vec4 bu, du, bv, dv;
+    bernstein(gl_TessCoord.x, bu, du);
+    bernstein(gl_TessCoord.y, bv, dv);
+
+    //Derivatives are taken just inside the patch so that collapsed edges still get a normal
+    vec2 inner=clamp(gl_TessCoord.xy, 0.001, 0.999);
+    vec4 iu, idu, iv, idv;
+    bernstein(inner.x, iu, idu);
+    bernstein(inner.y, iv, idv);
+
+    vec3 p=vec3(0), pu=vec3(0), pv=vec3(0);
+    for (int j=0; j<4; j++) {
+        for (int k=0; k<4; k++) {
+            vec3 c=gl_in[j*4+k].gl_Position.xyz;
+            p+=bu[j]*bv[k]*c;
+            pu+=idu[j]*iv[k]*c;
+            pv+=iu[j]*idv[k]*c;
+        }
+    }
+
+    gl_Position=P*V*M*vec4(p,1);
+
+    mat4 G=mat4(inverse(transpose(mat3(M))));
+    vec4 n=normalize(V*G*vec4(cross(pu,pv),0));
+
+    float nl=clamp(dot(n,lightDir),0,1);
+
+    i_color=vec4(color.rgb*nl,color.a);
+}
@@ -14,14940 +14,228 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "teapot.h"
+#include "lod.h"
+#include "bezier.h"
 
 namespace Models {
-	
+
 	Teapot teapot;
-	
+
 	Teapot::Teapot() {
-		vertices=TeapotInternal::vertices;
-		normals=TeapotInternal::normals;
-		vertexNormals=TeapotInternal::vertexNormals;
-		texCoords=TeapotInternal::texCoords;
-		colors=TeapotInternal::colors;
-		vertexCount=TeapotInternal::vertexCount;
 	}
-	
+
 	Teapot::~Teapot() {
+		for (size_t i = 0; i < coarser.size(); i++) delete coarser[i];
 	}
-	
-	void Teapot::drawSolid(bool smooth) {
-		glEnableVertexAttribArray(0);
-        glEnableVertexAttribArray(1);
-        glEnableVertexAttribArray(2);
-        //glEnableVertexAttribArray(3);
 
+	bool Teapot::load(const char* path) {
+		release();
+		for (size_t i = 0; i < coarser.size(); i++) delete coarser[i];
+		coarser.clear();
+		teapotLod.clear();
+		if (!file.open(path)) return false;
 
-        glVertexAttribPointer(0,4,GL_FLOAT,false,0,vertices);
-        if (!smooth) glVertexAttribPointer(1,4,GL_FLOAT,false,0,normals);
-        else glVertexAttribPointer(1,4,GL_FLOAT,false,0,vertexNormals);
-        glVertexAttribPointer(2,4,GL_FLOAT,false,0,texCoords);
-        //glVertexAttribPointer(3,4,GL_FLOAT,false,0,Models::CubeInternal::colors);
+		attach(file, 0);
+		teapotLod.radius = file.header().radius;
+		teapotLod.add(this, file.lod(0).minScreenSize);
+		for (int i = 1; i < file.lodCount(); i++) {
+			MeshAsset* level = new MeshAsset();
+			level->attach(file, i);
+			coarser.push_back(level);
+			teapotLod.add(level, file.lod(i).minScreenSize);
+		}
+		return true;
+	}
 
-        glDrawArrays(GL_TRIANGLES,0,vertexCount);
+	void Teapot::upload() {
+		if (!file.isOpen()) return;
+		MeshAsset::upload();
+		for (size_t i = 0; i < coarser.size(); i++) coarser[i]->upload();
+	}
 
-        glDisableVertexAttribArray(0);
-        glDisableVertexAttribArray(1);
-        glDisableVertexAttribArray(2);
-        //glDisableVertexAttribArray(3);
+	void Teapot::release() {
+		MeshAsset::release();
+		for (size_t i = 0; i < coarser.size(); i++) coarser[i]->release();
 	}
-	
-	
-	namespace TeapotInternal {
-		
-		unsigned int vertexCount=2976;
 
-		float vertices[]={
-			0.375425f,0.283457f,0.145117f,1.0f,
-			0.406266f,0.283457f,-0.011080f,1.0f,
-			0.370303f,0.304443f,0.142938f,1.0f,
-			0.406266f,0.283457f,-0.011080f,1.0f,
-			0.400714f,0.304443f,-0.011080f,1.0f,
-			0.370303f,0.304443f,0.142938f,1.0f,
-			0.376244f,0.311438f,0.145466f,1.0f,
-			0.370303f,0.304443f,0.142938f,1.0f,
-			0.400714f,0.304443f,-0.011080f,1.0f,
-			0.400714f,0.304443f,-0.011080f,1.0f,
-			0.407155f,0.311438f,-0.011080f,1.0f,
-			0.376244f,0.311438f,0.145466f,1.0f,
-			0.388331f,0.304443f,0.150609f,1.0f,
-			0.376244f,0.311438f,0.145466f,1.0f,
-			0.407155f,0.311438f,-0.011080f,1.0f,
-			0.407155f,0.311438f,-0.011080f,1.0f,
-			0.420257f,0.304443f,-0.011080f,1.0f,
-			0.388331f,0.304443f,0.150609f,1.0f,
-			0.401647f,0.283457f,0.156274f,1.0f,
-			0.388331f,0.304443f,0.150609f,1.0f,
-			0.420257f,0.304443f,-0.011080f,1.0f,
-			0.420257f,0.304443f,-0.011080f,1.0f,
-			0.434692f,0.283457f,-0.011080f,1.0f,
-			0.401647f,0.283457f,0.156274f,1.0f,
-			0.286917f,0.304443f,0.267527f,1.0f,
-			0.290859f,0.283457f,0.271468f,1.0f,
-			0.375425f,0.283457f,0.145117f,1.0f,
-			0.375425f,0.283457f,0.145117f,1.0f,
-			0.370303f,0.304443f,0.142938f,1.0f,
-			0.286917f,0.304443f,0.267527f,1.0f,
-			0.291490f,0.311438f,0.272099f,1.0f,
-			0.286917f,0.304443f,0.267527f,1.0f,
-			0.370303f,0.304443f,0.142938f,1.0f,
-			0.370303f,0.304443f,0.142938f,1.0f,
-			0.376244f,0.311438f,0.145466f,1.0f,
-			0.291490f,0.311438f,0.272099f,1.0f,
-			0.300792f,0.304443f,0.281402f,1.0f,
-			0.291490f,0.311438f,0.272099f,1.0f,
-			0.376244f,0.311438f,0.145466f,1.0f,
-			0.376244f,0.311438f,0.145466f,1.0f,
-			0.388331f,0.304443f,0.150609f,1.0f,
-			0.300792f,0.304443f,0.281402f,1.0f,
-			0.311041f,0.283457f,0.291650f,1.0f,
-			0.300792f,0.304443f,0.281402f,1.0f,
-			0.388331f,0.304443f,0.150609f,1.0f,
-			0.388331f,0.304443f,0.150609f,1.0f,
-			0.401647f,0.283457f,0.156274f,1.0f,
-			0.311041f,0.283457f,0.291650f,1.0f,
-			0.162329f,0.304443f,0.350912f,1.0f,
-			0.164508f,0.283457f,0.356034f,1.0f,
-			0.290859f,0.283457f,0.271468f,1.0f,
-			0.290859f,0.283457f,0.271468f,1.0f,
-			0.286917f,0.304443f,0.267527f,1.0f,
-			0.162329f,0.304443f,0.350912f,1.0f,
-			0.164857f,0.311438f,0.356853f,1.0f,
-			0.162329f,0.304443f,0.350912f,1.0f,
-			0.286917f,0.304443f,0.267527f,1.0f,
-			0.286917f,0.304443f,0.267527f,1.0f,
-			0.291490f,0.311438f,0.272099f,1.0f,
-			0.164857f,0.311438f,0.356853f,1.0f,
-			0.169999f,0.304443f,0.368940f,1.0f,
-			0.164857f,0.311438f,0.356853f,1.0f,
-			0.291490f,0.311438f,0.272099f,1.0f,
-			0.291490f,0.311438f,0.272099f,1.0f,
-			0.300792f,0.304443f,0.281402f,1.0f,
-			0.169999f,0.304443f,0.368940f,1.0f,
-			0.175665f,0.283457f,0.382256f,1.0f,
-			0.169999f,0.304443f,0.368940f,1.0f,
-			0.300792f,0.304443f,0.281402f,1.0f,
-			0.300792f,0.304443f,0.281402f,1.0f,
-			0.311041f,0.283457f,0.291650f,1.0f,
-			0.175665f,0.283457f,0.382256f,1.0f,
-			0.008310f,0.304443f,0.381324f,1.0f,
-			0.008310f,0.283457f,0.386876f,1.0f,
-			0.164508f,0.283457f,0.356034f,1.0f,
-			0.164508f,0.283457f,0.356034f,1.0f,
-			0.162329f,0.304443f,0.350912f,1.0f,
-			0.008310f,0.304443f,0.381324f,1.0f,
-			0.008310f,0.311438f,0.387764f,1.0f,
-			0.008310f,0.304443f,0.381324f,1.0f,
-			0.162329f,0.304443f,0.350912f,1.0f,
-			0.162329f,0.304443f,0.350912f,1.0f,
-			0.164857f,0.311438f,0.356853f,1.0f,
-			0.008310f,0.311438f,0.387764f,1.0f,
-			0.008310f,0.304443f,0.400866f,1.0f,
-			0.008310f,0.311438f,0.387764f,1.0f,
-			0.164857f,0.311438f,0.356853f,1.0f,
-			0.164857f,0.311438f,0.356853f,1.0f,
-			0.169999f,0.304443f,0.368940f,1.0f,
-			0.008310f,0.304443f,0.400866f,1.0f,
-			0.008310f,0.283457f,0.415301f,1.0f,
-			0.008310f,0.304443f,0.400866f,1.0f,
-			0.169999f,0.304443f,0.368940f,1.0f,
-			0.169999f,0.304443f,0.368940f,1.0f,
-			0.175665f,0.283457f,0.382256f,1.0f,
-			0.008310f,0.283457f,0.415301f,1.0f,
-			-0.150262f,0.304443f,0.350912f,1.0f,
-			-0.158680f,0.283457f,0.356034f,1.0f,
-			0.008310f,0.283457f,0.386876f,1.0f,
-			0.008310f,0.283457f,0.386876f,1.0f,
-			0.008310f,0.304443f,0.381324f,1.0f,
-			-0.150262f,0.304443f,0.350912f,1.0f,
-			-0.149585f,0.311438f,0.356853f,1.0f,
-			-0.150262f,0.304443f,0.350912f,1.0f,
-			0.008310f,0.304443f,0.381324f,1.0f,
-			0.008310f,0.304443f,0.381324f,1.0f,
-			0.008310f,0.311438f,0.387764f,1.0f,
-			-0.149585f,0.311438f,0.356853f,1.0f,
-			-0.153547f,0.304443f,0.368940f,1.0f,
-			-0.149585f,0.311438f,0.356853f,1.0f,
-			0.008310f,0.311438f,0.387764f,1.0f,
-			0.008310f,0.311438f,0.387764f,1.0f,
-			0.008310f,0.304443f,0.400866f,1.0f,
-			-0.153547f,0.304443f,0.368940f,1.0f,
-			-0.159044f,0.283457f,0.382256f,1.0f,
-			-0.153547f,0.304443f,0.368940f,1.0f,
-			0.008310f,0.304443f,0.400866f,1.0f,
-			0.008310f,0.304443f,0.400866f,1.0f,
-			0.008310f,0.283457f,0.415301f,1.0f,
-			-0.159044f,0.283457f,0.382256f,1.0f,
-			-0.274344f,0.304443f,0.267527f,1.0f,
-			-0.283832f,0.283457f,0.271468f,1.0f,
-			-0.158680f,0.283457f,0.356034f,1.0f,
-			-0.158680f,0.283457f,0.356034f,1.0f,
-			-0.150262f,0.304443f,0.350912f,1.0f,
-			-0.274344f,0.304443f,0.267527f,1.0f,
-			-0.276068f,0.311438f,0.272099f,1.0f,
-			-0.274344f,0.304443f,0.267527f,1.0f,
-			-0.150262f,0.304443f,0.350912f,1.0f,
-			-0.150262f,0.304443f,0.350912f,1.0f,
-			-0.149585f,0.311438f,0.356853f,1.0f,
-			-0.276068f,0.311438f,0.272099f,1.0f,
-			-0.284322f,0.304443f,0.281402f,1.0f,
-			-0.276068f,0.311438f,0.272099f,1.0f,
-			-0.149585f,0.311438f,0.356853f,1.0f,
-			-0.149585f,0.311438f,0.356853f,1.0f,
-			-0.153547f,0.304443f,0.368940f,1.0f,
-			-0.284322f,0.304443f,0.281402f,1.0f,
-			-0.294421f,0.283457f,0.291650f,1.0f,
-			-0.284322f,0.304443f,0.281402f,1.0f,
-			-0.153547f,0.304443f,0.368940f,1.0f,
-			-0.153547f,0.304443f,0.368940f,1.0f,
-			-0.159044f,0.283457f,0.382256f,1.0f,
-			-0.294421f,0.283457f,0.291650f,1.0f,
-			-0.355200f,0.304443f,0.142938f,1.0f,
-			-0.362402f,0.283457f,0.145117f,1.0f,
-			-0.283832f,0.283457f,0.271468f,1.0f,
-			-0.283832f,0.283457f,0.271468f,1.0f,
-			-0.274344f,0.304443f,0.267527f,1.0f,
-			-0.355200f,0.304443f,0.142938f,1.0f,
-			-0.360073f,0.311438f,0.145466f,1.0f,
-			-0.355200f,0.304443f,0.142938f,1.0f,
-			-0.274344f,0.304443f,0.267527f,1.0f,
-			-0.274344f,0.304443f,0.267527f,1.0f,
-			-0.276068f,0.311438f,0.272099f,1.0f,
-			-0.360073f,0.311438f,0.145466f,1.0f,
-			-0.371767f,0.304443f,0.150609f,1.0f,
-			-0.360073f,0.311438f,0.145466f,1.0f,
-			-0.276068f,0.311438f,0.272099f,1.0f,
-			-0.276068f,0.311438f,0.272099f,1.0f,
-			-0.284322f,0.304443f,0.281402f,1.0f,
-			-0.371767f,0.304443f,0.150609f,1.0f,
-			-0.385027f,0.283457f,0.156274f,1.0f,
-			-0.371767f,0.304443f,0.150609f,1.0f,
-			-0.284322f,0.304443f,0.281402f,1.0f,
-			-0.284322f,0.304443f,0.281402f,1.0f,
-			-0.294421f,0.283457f,0.291650f,1.0f,
-			-0.385027f,0.283457f,0.156274f,1.0f,
-			-0.384094f,0.304443f,-0.011080f,1.0f,
-			-0.389646f,0.283457f,-0.011080f,1.0f,
-			-0.362402f,0.283457f,0.145117f,1.0f,
-			-0.362402f,0.283457f,0.145117f,1.0f,
-			-0.355200f,0.304443f,0.142938f,1.0f,
-			-0.384094f,0.304443f,-0.011080f,1.0f,
-			-0.390534f,0.311438f,-0.011080f,1.0f,
-			-0.384094f,0.304443f,-0.011080f,1.0f,
-			-0.355200f,0.304443f,0.142938f,1.0f,
-			-0.355200f,0.304443f,0.142938f,1.0f,
-			-0.360073f,0.311438f,0.145466f,1.0f,
-			-0.390534f,0.311438f,-0.011080f,1.0f,
-			-0.403636f,0.304443f,-0.011080f,1.0f,
-			-0.390534f,0.311438f,-0.011080f,1.0f,
-			-0.360073f,0.311438f,0.145466f,1.0f,
-			-0.360073f,0.311438f,0.145466f,1.0f,
-			-0.371767f,0.304443f,0.150609f,1.0f,
-			-0.403636f,0.304443f,-0.011080f,1.0f,
-			-0.418071f,0.283457f,-0.011080f,1.0f,
-			-0.403636f,0.304443f,-0.011080f,1.0f,
-			-0.371767f,0.304443f,0.150609f,1.0f,
-			-0.371767f,0.304443f,0.150609f,1.0f,
-			-0.385027f,0.283457f,0.156274f,1.0f,
-			-0.418071f,0.283457f,-0.011080f,1.0f,
-			-0.353683f,0.304443f,-0.165099f,1.0f,
-			-0.358804f,0.283457f,-0.167278f,1.0f,
-			-0.389646f,0.283457f,-0.011080f,1.0f,
-			-0.389646f,0.283457f,-0.011080f,1.0f,
-			-0.384094f,0.304443f,-0.011080f,1.0f,
-			-0.353683f,0.304443f,-0.165099f,1.0f,
-			-0.359624f,0.311438f,-0.167627f,1.0f,
-			-0.353683f,0.304443f,-0.165099f,1.0f,
-			-0.384094f,0.304443f,-0.011080f,1.0f,
-			-0.384094f,0.304443f,-0.011080f,1.0f,
-			-0.390534f,0.311438f,-0.011080f,1.0f,
-			-0.359624f,0.311438f,-0.167627f,1.0f,
-			-0.371711f,0.304443f,-0.172769f,1.0f,
-			-0.359624f,0.311438f,-0.167627f,1.0f,
-			-0.390534f,0.311438f,-0.011080f,1.0f,
-			-0.390534f,0.311438f,-0.011080f,1.0f,
-			-0.403636f,0.304443f,-0.011080f,1.0f,
-			-0.371711f,0.304443f,-0.172769f,1.0f,
-			-0.385027f,0.283457f,-0.178435f,1.0f,
-			-0.371711f,0.304443f,-0.172769f,1.0f,
-			-0.403636f,0.304443f,-0.011080f,1.0f,
-			-0.403636f,0.304443f,-0.011080f,1.0f,
-			-0.418071f,0.283457f,-0.011080f,1.0f,
-			-0.385027f,0.283457f,-0.178435f,1.0f,
-			-0.270297f,0.304443f,-0.289687f,1.0f,
-			-0.274238f,0.283457f,-0.293629f,1.0f,
-			-0.358804f,0.283457f,-0.167278f,1.0f,
-			-0.358804f,0.283457f,-0.167278f,1.0f,
-			-0.353683f,0.304443f,-0.165099f,1.0f,
-			-0.270297f,0.304443f,-0.289687f,1.0f,
-			-0.274869f,0.311438f,-0.294260f,1.0f,
-			-0.270297f,0.304443f,-0.289687f,1.0f,
-			-0.353683f,0.304443f,-0.165099f,1.0f,
-			-0.353683f,0.304443f,-0.165099f,1.0f,
-			-0.359624f,0.311438f,-0.167627f,1.0f,
-			-0.274869f,0.311438f,-0.294260f,1.0f,
-			-0.284172f,0.304443f,-0.303562f,1.0f,
-			-0.274869f,0.311438f,-0.294260f,1.0f,
-			-0.359624f,0.311438f,-0.167627f,1.0f,
-			-0.359624f,0.311438f,-0.167627f,1.0f,
-			-0.371711f,0.304443f,-0.172769f,1.0f,
-			-0.284172f,0.304443f,-0.303562f,1.0f,
-			-0.294421f,0.283457f,-0.313811f,1.0f,
-			-0.284172f,0.304443f,-0.303562f,1.0f,
-			-0.371711f,0.304443f,-0.172769f,1.0f,
-			-0.371711f,0.304443f,-0.172769f,1.0f,
-			-0.385027f,0.283457f,-0.178435f,1.0f,
-			-0.294421f,0.283457f,-0.313811f,1.0f,
-			-0.145708f,0.304443f,-0.373073f,1.0f,
-			-0.147887f,0.283457f,-0.378195f,1.0f,
-			-0.274238f,0.283457f,-0.293629f,1.0f,
-			-0.274238f,0.283457f,-0.293629f,1.0f,
-			-0.270297f,0.304443f,-0.289687f,1.0f,
-			-0.145708f,0.304443f,-0.373073f,1.0f,
-			-0.148236f,0.311438f,-0.379014f,1.0f,
-			-0.145708f,0.304443f,-0.373073f,1.0f,
-			-0.270297f,0.304443f,-0.289687f,1.0f,
-			-0.270297f,0.304443f,-0.289687f,1.0f,
-			-0.274869f,0.311438f,-0.294260f,1.0f,
-			-0.148236f,0.311438f,-0.379014f,1.0f,
-			-0.153379f,0.304443f,-0.391101f,1.0f,
-			-0.148236f,0.311438f,-0.379014f,1.0f,
-			-0.274869f,0.311438f,-0.294260f,1.0f,
-			-0.274869f,0.311438f,-0.294260f,1.0f,
-			-0.284172f,0.304443f,-0.303562f,1.0f,
-			-0.153379f,0.304443f,-0.391101f,1.0f,
-			-0.159044f,0.283457f,-0.404417f,1.0f,
-			-0.153379f,0.304443f,-0.391101f,1.0f,
-			-0.284172f,0.304443f,-0.303562f,1.0f,
-			-0.284172f,0.304443f,-0.303562f,1.0f,
-			-0.294421f,0.283457f,-0.313811f,1.0f,
-			-0.159044f,0.283457f,-0.404417f,1.0f,
-			0.008310f,0.304443f,-0.403484f,1.0f,
-			0.008310f,0.283457f,-0.409036f,1.0f,
-			-0.147887f,0.283457f,-0.378195f,1.0f,
-			-0.147887f,0.283457f,-0.378195f,1.0f,
-			-0.145708f,0.304443f,-0.373073f,1.0f,
-			0.008310f,0.304443f,-0.403484f,1.0f,
-			0.008310f,0.311438f,-0.409925f,1.0f,
-			0.008310f,0.304443f,-0.403484f,1.0f,
-			-0.145708f,0.304443f,-0.373073f,1.0f,
-			-0.145708f,0.304443f,-0.373073f,1.0f,
-			-0.148236f,0.311438f,-0.379014f,1.0f,
-			0.008310f,0.311438f,-0.409925f,1.0f,
-			0.008310f,0.304443f,-0.423027f,1.0f,
-			0.008310f,0.311438f,-0.409925f,1.0f,
-			-0.148236f,0.311438f,-0.379014f,1.0f,
-			-0.148236f,0.311438f,-0.379014f,1.0f,
-			-0.153379f,0.304443f,-0.391101f,1.0f,
-			0.008310f,0.304443f,-0.423027f,1.0f,
-			0.008310f,0.283457f,-0.437462f,1.0f,
-			0.008310f,0.304443f,-0.423027f,1.0f,
-			-0.153379f,0.304443f,-0.391101f,1.0f,
-			-0.153379f,0.304443f,-0.391101f,1.0f,
-			-0.159044f,0.283457f,-0.404417f,1.0f,
-			0.008310f,0.283457f,-0.437462f,1.0f,
-			0.162329f,0.304443f,-0.373073f,1.0f,
-			0.164508f,0.283457f,-0.378195f,1.0f,
-			0.008310f,0.283457f,-0.409036f,1.0f,
-			0.008310f,0.283457f,-0.409036f,1.0f,
-			0.008310f,0.304443f,-0.403484f,1.0f,
-			0.162329f,0.304443f,-0.373073f,1.0f,
-			0.164857f,0.311438f,-0.379014f,1.0f,
-			0.162329f,0.304443f,-0.373073f,1.0f,
-			0.008310f,0.304443f,-0.403484f,1.0f,
-			0.008310f,0.304443f,-0.403484f,1.0f,
-			0.008310f,0.311438f,-0.409925f,1.0f,
-			0.164857f,0.311438f,-0.379014f,1.0f,
-			0.169999f,0.304443f,-0.391101f,1.0f,
-			0.164857f,0.311438f,-0.379014f,1.0f,
-			0.008310f,0.311438f,-0.409925f,1.0f,
-			0.008310f,0.311438f,-0.409925f,1.0f,
-			0.008310f,0.304443f,-0.423027f,1.0f,
-			0.169999f,0.304443f,-0.391101f,1.0f,
-			0.175665f,0.283457f,-0.404417f,1.0f,
-			0.169999f,0.304443f,-0.391101f,1.0f,
-			0.008310f,0.304443f,-0.423027f,1.0f,
-			0.008310f,0.304443f,-0.423027f,1.0f,
-			0.008310f,0.283457f,-0.437462f,1.0f,
-			0.175665f,0.283457f,-0.404417f,1.0f,
-			0.286917f,0.304443f,-0.289687f,1.0f,
-			0.290859f,0.283457f,-0.293629f,1.0f,
-			0.164508f,0.283457f,-0.378195f,1.0f,
-			0.164508f,0.283457f,-0.378195f,1.0f,
-			0.162329f,0.304443f,-0.373073f,1.0f,
-			0.286917f,0.304443f,-0.289687f,1.0f,
-			0.291490f,0.311438f,-0.294260f,1.0f,
-			0.286917f,0.304443f,-0.289687f,1.0f,
-			0.162329f,0.304443f,-0.373073f,1.0f,
-			0.162329f,0.304443f,-0.373073f,1.0f,
-			0.164857f,0.311438f,-0.379014f,1.0f,
-			0.291490f,0.311438f,-0.294260f,1.0f,
-			0.300792f,0.304443f,-0.303562f,1.0f,
-			0.291490f,0.311438f,-0.294260f,1.0f,
-			0.164857f,0.311438f,-0.379014f,1.0f,
-			0.164857f,0.311438f,-0.379014f,1.0f,
-			0.169999f,0.304443f,-0.391101f,1.0f,
-			0.300792f,0.304443f,-0.303562f,1.0f,
-			0.311041f,0.283457f,-0.313811f,1.0f,
-			0.300792f,0.304443f,-0.303562f,1.0f,
-			0.169999f,0.304443f,-0.391101f,1.0f,
-			0.169999f,0.304443f,-0.391101f,1.0f,
-			0.175665f,0.283457f,-0.404417f,1.0f,
-			0.311041f,0.283457f,-0.313811f,1.0f,
-			0.370303f,0.304443f,-0.165099f,1.0f,
-			0.375425f,0.283457f,-0.167278f,1.0f,
-			0.290859f,0.283457f,-0.293629f,1.0f,
-			0.290859f,0.283457f,-0.293629f,1.0f,
-			0.286917f,0.304443f,-0.289687f,1.0f,
-			0.370303f,0.304443f,-0.165099f,1.0f,
-			0.376244f,0.311438f,-0.167627f,1.0f,
-			0.370303f,0.304443f,-0.165099f,1.0f,
-			0.286917f,0.304443f,-0.289687f,1.0f,
-			0.286917f,0.304443f,-0.289687f,1.0f,
-			0.291490f,0.311438f,-0.294260f,1.0f,
-			0.376244f,0.311438f,-0.167627f,1.0f,
-			0.388331f,0.304443f,-0.172769f,1.0f,
-			0.376244f,0.311438f,-0.167627f,1.0f,
-			0.291490f,0.311438f,-0.294260f,1.0f,
-			0.291490f,0.311438f,-0.294260f,1.0f,
-			0.300792f,0.304443f,-0.303562f,1.0f,
-			0.388331f,0.304443f,-0.172769f,1.0f,
-			0.401647f,0.283457f,-0.178435f,1.0f,
-			0.388331f,0.304443f,-0.172769f,1.0f,
-			0.300792f,0.304443f,-0.303562f,1.0f,
-			0.300792f,0.304443f,-0.303562f,1.0f,
-			0.311041f,0.283457f,-0.313811f,1.0f,
-			0.401647f,0.283457f,-0.178435f,1.0f,
-			0.400714f,0.304443f,-0.011080f,1.0f,
-			0.406266f,0.283457f,-0.011080f,1.0f,
-			0.375425f,0.283457f,-0.167278f,1.0f,
-			0.375425f,0.283457f,-0.167278f,1.0f,
-			0.370303f,0.304443f,-0.165099f,1.0f,
-			0.400714f,0.304443f,-0.011080f,1.0f,
-			0.407155f,0.311438f,-0.011080f,1.0f,
-			0.400714f,0.304443f,-0.011080f,1.0f,
-			0.370303f,0.304443f,-0.165099f,1.0f,
-			0.370303f,0.304443f,-0.165099f,1.0f,
-			0.376244f,0.311438f,-0.167627f,1.0f,
-			0.407155f,0.311438f,-0.011080f,1.0f,
-			0.420257f,0.304443f,-0.011080f,1.0f,
-			0.407155f,0.311438f,-0.011080f,1.0f,
-			0.376244f,0.311438f,-0.167627f,1.0f,
-			0.376244f,0.311438f,-0.167627f,1.0f,
-			0.388331f,0.304443f,-0.172769f,1.0f,
-			0.420257f,0.304443f,-0.011080f,1.0f,
-			0.434692f,0.283457f,-0.011080f,1.0f,
-			0.420257f,0.304443f,-0.011080f,1.0f,
-			0.388331f,0.304443f,-0.172769f,1.0f,
-			0.388331f,0.304443f,-0.172769f,1.0f,
-			0.401647f,0.283457f,-0.178435f,1.0f,
-			0.434692f,0.283457f,-0.011080f,1.0f,
-			0.449790f,0.171865f,0.176758f,1.0f,
-			0.401647f,0.283457f,0.156274f,1.0f,
-			0.434692f,0.283457f,-0.011080f,1.0f,
-			0.434692f,0.283457f,-0.011080f,1.0f,
-			0.486879f,0.171865f,-0.011080f,1.0f,
-			0.449790f,0.171865f,0.176758f,1.0f,
-			0.491787f,0.062271f,0.194626f,1.0f,
-			0.449790f,0.171865f,0.176758f,1.0f,
-			0.486879f,0.171865f,-0.011080f,1.0f,
-			0.486879f,0.171865f,-0.011080f,1.0f,
-			0.532404f,0.062271f,-0.011080f,1.0f,
-			0.491787f,0.062271f,0.194626f,1.0f,
-			0.521492f,-0.043325f,0.207265f,1.0f,
-			0.491787f,0.062271f,0.194626f,1.0f,
-			0.532404f,0.062271f,-0.011080f,1.0f,
-			0.532404f,0.062271f,-0.011080f,1.0f,
-			0.564605f,-0.043325f,-0.011080f,1.0f,
-			0.521492f,-0.043325f,0.207265f,1.0f,
-			0.532759f,-0.142925f,0.212059f,1.0f,
-			0.521492f,-0.043325f,0.207265f,1.0f,
-			0.564605f,-0.043325f,-0.011080f,1.0f,
-			0.564605f,-0.043325f,-0.011080f,1.0f,
-			0.576819f,-0.142925f,-0.011080f,1.0f,
-			0.532759f,-0.142925f,0.212059f,1.0f,
-			0.348094f,0.171865f,0.328703f,1.0f,
-			0.311041f,0.283457f,0.291650f,1.0f,
-			0.401647f,0.283457f,0.156274f,1.0f,
-			0.401647f,0.283457f,0.156274f,1.0f,
-			0.449790f,0.171865f,0.176758f,1.0f,
-			0.348094f,0.171865f,0.328703f,1.0f,
-			0.380417f,0.062271f,0.361026f,1.0f,
-			0.348094f,0.171865f,0.328703f,1.0f,
-			0.449790f,0.171865f,0.176758f,1.0f,
-			0.449790f,0.171865f,0.176758f,1.0f,
-			0.491787f,0.062271f,0.194626f,1.0f,
-			0.380417f,0.062271f,0.361026f,1.0f,
-			0.403279f,-0.043325f,0.383889f,1.0f,
-			0.380417f,0.062271f,0.361026f,1.0f,
-			0.491787f,0.062271f,0.194626f,1.0f,
-			0.491787f,0.062271f,0.194626f,1.0f,
-			0.521492f,-0.043325f,0.207265f,1.0f,
-			0.403279f,-0.043325f,0.383889f,1.0f,
-			0.411951f,-0.142925f,0.392561f,1.0f,
-			0.403279f,-0.043325f,0.383889f,1.0f,
-			0.521492f,-0.043325f,0.207265f,1.0f,
-			0.521492f,-0.043325f,0.207265f,1.0f,
-			0.532759f,-0.142925f,0.212059f,1.0f,
-			0.411951f,-0.142925f,0.392561f,1.0f,
-			0.196148f,0.171865f,0.430399f,1.0f,
-			0.175665f,0.283457f,0.382256f,1.0f,
-			0.311041f,0.283457f,0.291650f,1.0f,
-			0.311041f,0.283457f,0.291650f,1.0f,
-			0.348094f,0.171865f,0.328703f,1.0f,
-			0.196148f,0.171865f,0.430399f,1.0f,
-			0.214017f,0.062271f,0.472396f,1.0f,
-			0.196148f,0.171865f,0.430399f,1.0f,
-			0.348094f,0.171865f,0.328703f,1.0f,
-			0.348094f,0.171865f,0.328703f,1.0f,
-			0.380417f,0.062271f,0.361026f,1.0f,
-			0.214017f,0.062271f,0.472396f,1.0f,
-			0.226656f,-0.043325f,0.502101f,1.0f,
-			0.214017f,0.062271f,0.472396f,1.0f,
-			0.380417f,0.062271f,0.361026f,1.0f,
-			0.380417f,0.062271f,0.361026f,1.0f,
-			0.403279f,-0.043325f,0.383889f,1.0f,
-			0.226656f,-0.043325f,0.502101f,1.0f,
-			0.231450f,-0.142925f,0.513369f,1.0f,
-			0.226656f,-0.043325f,0.502101f,1.0f,
-			0.403279f,-0.043325f,0.383889f,1.0f,
-			0.403279f,-0.043325f,0.383889f,1.0f,
-			0.411951f,-0.142925f,0.392561f,1.0f,
-			0.231450f,-0.142925f,0.513369f,1.0f,
-			0.008310f,0.171865f,0.467488f,1.0f,
-			0.008310f,0.283457f,0.415301f,1.0f,
-			0.175665f,0.283457f,0.382256f,1.0f,
-			0.175665f,0.283457f,0.382256f,1.0f,
-			0.196148f,0.171865f,0.430399f,1.0f,
-			0.008310f,0.171865f,0.467488f,1.0f,
-			0.008310f,0.062271f,0.513013f,1.0f,
-			0.008310f,0.171865f,0.467488f,1.0f,
-			0.196148f,0.171865f,0.430399f,1.0f,
-			0.196148f,0.171865f,0.430399f,1.0f,
-			0.214017f,0.062271f,0.472396f,1.0f,
-			0.008310f,0.062271f,0.513013f,1.0f,
-			0.008310f,-0.043325f,0.545214f,1.0f,
-			0.008310f,0.062271f,0.513013f,1.0f,
-			0.214017f,0.062271f,0.472396f,1.0f,
-			0.214017f,0.062271f,0.472396f,1.0f,
-			0.226656f,-0.043325f,0.502101f,1.0f,
-			0.008310f,-0.043325f,0.545214f,1.0f,
-			0.008310f,-0.142925f,0.557428f,1.0f,
-			0.008310f,-0.043325f,0.545214f,1.0f,
-			0.226656f,-0.043325f,0.502101f,1.0f,
-			0.226656f,-0.043325f,0.502101f,1.0f,
-			0.231450f,-0.142925f,0.513369f,1.0f,
-			0.008310f,-0.142925f,0.557428f,1.0f,
-			-0.179528f,0.171865f,0.430399f,1.0f,
-			-0.159044f,0.283457f,0.382256f,1.0f,
-			0.008310f,0.283457f,0.415301f,1.0f,
-			0.008310f,0.283457f,0.415301f,1.0f,
-			0.008310f,0.171865f,0.467488f,1.0f,
-			-0.179528f,0.171865f,0.430399f,1.0f,
-			-0.197397f,0.062271f,0.472396f,1.0f,
-			-0.179528f,0.171865f,0.430399f,1.0f,
-			0.008310f,0.171865f,0.467488f,1.0f,
-			0.008310f,0.171865f,0.467488f,1.0f,
-			0.008310f,0.062271f,0.513013f,1.0f,
-			-0.197397f,0.062271f,0.472396f,1.0f,
-			-0.210035f,-0.043325f,0.502101f,1.0f,
-			-0.197397f,0.062271f,0.472396f,1.0f,
-			0.008310f,0.062271f,0.513013f,1.0f,
-			0.008310f,0.062271f,0.513013f,1.0f,
-			0.008310f,-0.043325f,0.545214f,1.0f,
-			-0.210035f,-0.043325f,0.502101f,1.0f,
-			-0.214829f,-0.142925f,0.513369f,1.0f,
-			-0.210035f,-0.043325f,0.502101f,1.0f,
-			0.008310f,-0.043325f,0.545214f,1.0f,
-			0.008310f,-0.043325f,0.545214f,1.0f,
-			0.008310f,-0.142925f,0.557428f,1.0f,
-			-0.214829f,-0.142925f,0.513369f,1.0f,
-			-0.331474f,0.171865f,0.328703f,1.0f,
-			-0.294421f,0.283457f,0.291650f,1.0f,
-			-0.159044f,0.283457f,0.382256f,1.0f,
-			-0.159044f,0.283457f,0.382256f,1.0f,
-			-0.179528f,0.171865f,0.430399f,1.0f,
-			-0.331474f,0.171865f,0.328703f,1.0f,
-			-0.363796f,0.062271f,0.361026f,1.0f,
-			-0.331474f,0.171865f,0.328703f,1.0f,
-			-0.179528f,0.171865f,0.430399f,1.0f,
-			-0.179528f,0.171865f,0.430399f,1.0f,
-			-0.197397f,0.062271f,0.472396f,1.0f,
-			-0.363796f,0.062271f,0.361026f,1.0f,
-			-0.386659f,-0.043325f,0.383889f,1.0f,
-			-0.363796f,0.062271f,0.361026f,1.0f,
-			-0.197397f,0.062271f,0.472396f,1.0f,
-			-0.197397f,0.062271f,0.472396f,1.0f,
-			-0.210035f,-0.043325f,0.502101f,1.0f,
-			-0.386659f,-0.043325f,0.383889f,1.0f,
-			-0.395331f,-0.142925f,0.392561f,1.0f,
-			-0.386659f,-0.043325f,0.383889f,1.0f,
-			-0.210035f,-0.043325f,0.502101f,1.0f,
-			-0.210035f,-0.043325f,0.502101f,1.0f,
-			-0.214829f,-0.142925f,0.513369f,1.0f,
-			-0.395331f,-0.142925f,0.392561f,1.0f,
-			-0.433169f,0.171865f,0.176758f,1.0f,
-			-0.385027f,0.283457f,0.156274f,1.0f,
-			-0.294421f,0.283457f,0.291650f,1.0f,
-			-0.294421f,0.283457f,0.291650f,1.0f,
-			-0.331474f,0.171865f,0.328703f,1.0f,
-			-0.433169f,0.171865f,0.176758f,1.0f,
-			-0.475166f,0.062271f,0.194626f,1.0f,
-			-0.433169f,0.171865f,0.176758f,1.0f,
-			-0.331474f,0.171865f,0.328703f,1.0f,
-			-0.331474f,0.171865f,0.328703f,1.0f,
-			-0.363796f,0.062271f,0.361026f,1.0f,
-			-0.475166f,0.062271f,0.194626f,1.0f,
-			-0.504871f,-0.043325f,0.207265f,1.0f,
-			-0.475166f,0.062271f,0.194626f,1.0f,
-			-0.363796f,0.062271f,0.361026f,1.0f,
-			-0.363796f,0.062271f,0.361026f,1.0f,
-			-0.386659f,-0.043325f,0.383889f,1.0f,
-			-0.504871f,-0.043325f,0.207265f,1.0f,
-			-0.516139f,-0.142925f,0.212059f,1.0f,
-			-0.504871f,-0.043325f,0.207265f,1.0f,
-			-0.386659f,-0.043325f,0.383889f,1.0f,
-			-0.386659f,-0.043325f,0.383889f,1.0f,
-			-0.395331f,-0.142925f,0.392561f,1.0f,
-			-0.516139f,-0.142925f,0.212059f,1.0f,
-			-0.470258f,0.171865f,-0.011080f,1.0f,
-			-0.418071f,0.283457f,-0.011080f,1.0f,
-			-0.385027f,0.283457f,0.156274f,1.0f,
-			-0.385027f,0.283457f,0.156274f,1.0f,
-			-0.433169f,0.171865f,0.176758f,1.0f,
-			-0.470258f,0.171865f,-0.011080f,1.0f,
-			-0.515784f,0.062271f,-0.011080f,1.0f,
-			-0.470258f,0.171865f,-0.011080f,1.0f,
-			-0.433169f,0.171865f,0.176758f,1.0f,
-			-0.433169f,0.171865f,0.176758f,1.0f,
-			-0.475166f,0.062271f,0.194626f,1.0f,
-			-0.515784f,0.062271f,-0.011080f,1.0f,
-			-0.547984f,-0.043325f,-0.011080f,1.0f,
-			-0.515784f,0.062271f,-0.011080f,1.0f,
-			-0.475166f,0.062271f,0.194626f,1.0f,
-			-0.475166f,0.062271f,0.194626f,1.0f,
-			-0.504871f,-0.043325f,0.207265f,1.0f,
-			-0.547984f,-0.043325f,-0.011080f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.547984f,-0.043325f,-0.011080f,1.0f,
-			-0.504871f,-0.043325f,0.207265f,1.0f,
-			-0.504871f,-0.043325f,0.207265f,1.0f,
-			-0.516139f,-0.142925f,0.212059f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.433169f,0.171865f,-0.198919f,1.0f,
-			-0.385027f,0.283457f,-0.178435f,1.0f,
-			-0.418071f,0.283457f,-0.011080f,1.0f,
-			-0.418071f,0.283457f,-0.011080f,1.0f,
-			-0.470258f,0.171865f,-0.011080f,1.0f,
-			-0.433169f,0.171865f,-0.198919f,1.0f,
-			-0.475166f,0.062271f,-0.216787f,1.0f,
-			-0.433169f,0.171865f,-0.198919f,1.0f,
-			-0.470258f,0.171865f,-0.011080f,1.0f,
-			-0.470258f,0.171865f,-0.011080f,1.0f,
-			-0.515784f,0.062271f,-0.011080f,1.0f,
-			-0.475166f,0.062271f,-0.216787f,1.0f,
-			-0.504871f,-0.043325f,-0.229426f,1.0f,
-			-0.475166f,0.062271f,-0.216787f,1.0f,
-			-0.515784f,0.062271f,-0.011080f,1.0f,
-			-0.515784f,0.062271f,-0.011080f,1.0f,
-			-0.547984f,-0.043325f,-0.011080f,1.0f,
-			-0.504871f,-0.043325f,-0.229426f,1.0f,
-			-0.516139f,-0.142925f,-0.234220f,1.0f,
-			-0.504871f,-0.043325f,-0.229426f,1.0f,
-			-0.547984f,-0.043325f,-0.011080f,1.0f,
-			-0.547984f,-0.043325f,-0.011080f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.516139f,-0.142925f,-0.234220f,1.0f,
-			-0.331474f,0.171865f,-0.350864f,1.0f,
-			-0.294421f,0.283457f,-0.313811f,1.0f,
-			-0.385027f,0.283457f,-0.178435f,1.0f,
-			-0.385027f,0.283457f,-0.178435f,1.0f,
-			-0.433169f,0.171865f,-0.198919f,1.0f,
-			-0.331474f,0.171865f,-0.350864f,1.0f,
-			-0.363796f,0.062271f,-0.383187f,1.0f,
-			-0.331474f,0.171865f,-0.350864f,1.0f,
-			-0.433169f,0.171865f,-0.198919f,1.0f,
-			-0.433169f,0.171865f,-0.198919f,1.0f,
-			-0.475166f,0.062271f,-0.216787f,1.0f,
-			-0.363796f,0.062271f,-0.383187f,1.0f,
-			-0.386659f,-0.043325f,-0.406049f,1.0f,
-			-0.363796f,0.062271f,-0.383187f,1.0f,
-			-0.475166f,0.062271f,-0.216787f,1.0f,
-			-0.475166f,0.062271f,-0.216787f,1.0f,
-			-0.504871f,-0.043325f,-0.229426f,1.0f,
-			-0.386659f,-0.043325f,-0.406049f,1.0f,
-			-0.395331f,-0.142925f,-0.414721f,1.0f,
-			-0.386659f,-0.043325f,-0.406049f,1.0f,
-			-0.504871f,-0.043325f,-0.229426f,1.0f,
-			-0.504871f,-0.043325f,-0.229426f,1.0f,
-			-0.516139f,-0.142925f,-0.234220f,1.0f,
-			-0.395331f,-0.142925f,-0.414721f,1.0f,
-			-0.179528f,0.171865f,-0.452560f,1.0f,
-			-0.159044f,0.283457f,-0.404417f,1.0f,
-			-0.294421f,0.283457f,-0.313811f,1.0f,
-			-0.294421f,0.283457f,-0.313811f,1.0f,
-			-0.331474f,0.171865f,-0.350864f,1.0f,
-			-0.179528f,0.171865f,-0.452560f,1.0f,
-			-0.197397f,0.062271f,-0.494557f,1.0f,
-			-0.179528f,0.171865f,-0.452560f,1.0f,
-			-0.331474f,0.171865f,-0.350864f,1.0f,
-			-0.331474f,0.171865f,-0.350864f,1.0f,
-			-0.363796f,0.062271f,-0.383187f,1.0f,
-			-0.197397f,0.062271f,-0.494557f,1.0f,
-			-0.210035f,-0.043325f,-0.524262f,1.0f,
-			-0.197397f,0.062271f,-0.494557f,1.0f,
-			-0.363796f,0.062271f,-0.383187f,1.0f,
-			-0.363796f,0.062271f,-0.383187f,1.0f,
-			-0.386659f,-0.043325f,-0.406049f,1.0f,
-			-0.210035f,-0.043325f,-0.524262f,1.0f,
-			-0.214829f,-0.142925f,-0.535529f,1.0f,
-			-0.210035f,-0.043325f,-0.524262f,1.0f,
-			-0.386659f,-0.043325f,-0.406049f,1.0f,
-			-0.386659f,-0.043325f,-0.406049f,1.0f,
-			-0.395331f,-0.142925f,-0.414721f,1.0f,
-			-0.214829f,-0.142925f,-0.535529f,1.0f,
-			0.008310f,0.171865f,-0.489649f,1.0f,
-			0.008310f,0.283457f,-0.437462f,1.0f,
-			-0.159044f,0.283457f,-0.404417f,1.0f,
-			-0.159044f,0.283457f,-0.404417f,1.0f,
-			-0.179528f,0.171865f,-0.452560f,1.0f,
-			0.008310f,0.171865f,-0.489649f,1.0f,
-			0.008310f,0.062271f,-0.535174f,1.0f,
-			0.008310f,0.171865f,-0.489649f,1.0f,
-			-0.179528f,0.171865f,-0.452560f,1.0f,
-			-0.179528f,0.171865f,-0.452560f,1.0f,
-			-0.197397f,0.062271f,-0.494557f,1.0f,
-			0.008310f,0.062271f,-0.535174f,1.0f,
-			0.008310f,-0.043325f,-0.567375f,1.0f,
-			0.008310f,0.062271f,-0.535174f,1.0f,
-			-0.197397f,0.062271f,-0.494557f,1.0f,
-			-0.197397f,0.062271f,-0.494557f,1.0f,
-			-0.210035f,-0.043325f,-0.524262f,1.0f,
-			0.008310f,-0.043325f,-0.567375f,1.0f,
-			0.008310f,-0.142925f,-0.579589f,1.0f,
-			0.008310f,-0.043325f,-0.567375f,1.0f,
-			-0.210035f,-0.043325f,-0.524262f,1.0f,
-			-0.210035f,-0.043325f,-0.524262f,1.0f,
-			-0.214829f,-0.142925f,-0.535529f,1.0f,
-			0.008310f,-0.142925f,-0.579589f,1.0f,
-			0.196148f,0.171865f,-0.452560f,1.0f,
-			0.175665f,0.283457f,-0.404417f,1.0f,
-			0.008310f,0.283457f,-0.437462f,1.0f,
-			0.008310f,0.283457f,-0.437462f,1.0f,
-			0.008310f,0.171865f,-0.489649f,1.0f,
-			0.196148f,0.171865f,-0.452560f,1.0f,
-			0.214017f,0.062271f,-0.494557f,1.0f,
-			0.196148f,0.171865f,-0.452560f,1.0f,
-			0.008310f,0.171865f,-0.489649f,1.0f,
-			0.008310f,0.171865f,-0.489649f,1.0f,
-			0.008310f,0.062271f,-0.535174f,1.0f,
-			0.214017f,0.062271f,-0.494557f,1.0f,
-			0.226656f,-0.043325f,-0.524262f,1.0f,
-			0.214017f,0.062271f,-0.494557f,1.0f,
-			0.008310f,0.062271f,-0.535174f,1.0f,
-			0.008310f,0.062271f,-0.535174f,1.0f,
-			0.008310f,-0.043325f,-0.567375f,1.0f,
-			0.226656f,-0.043325f,-0.524262f,1.0f,
-			0.231450f,-0.142925f,-0.535529f,1.0f,
-			0.226656f,-0.043325f,-0.524262f,1.0f,
-			0.008310f,-0.043325f,-0.567375f,1.0f,
-			0.008310f,-0.043325f,-0.567375f,1.0f,
-			0.008310f,-0.142925f,-0.579589f,1.0f,
-			0.231450f,-0.142925f,-0.535529f,1.0f,
-			0.348094f,0.171865f,-0.350864f,1.0f,
-			0.311041f,0.283457f,-0.313811f,1.0f,
-			0.175665f,0.283457f,-0.404417f,1.0f,
-			0.175665f,0.283457f,-0.404417f,1.0f,
-			0.196148f,0.171865f,-0.452560f,1.0f,
-			0.348094f,0.171865f,-0.350864f,1.0f,
-			0.380417f,0.062271f,-0.383187f,1.0f,
-			0.348094f,0.171865f,-0.350864f,1.0f,
-			0.196148f,0.171865f,-0.452560f,1.0f,
-			0.196148f,0.171865f,-0.452560f,1.0f,
-			0.214017f,0.062271f,-0.494557f,1.0f,
-			0.380417f,0.062271f,-0.383187f,1.0f,
-			0.403279f,-0.043325f,-0.406049f,1.0f,
-			0.380417f,0.062271f,-0.383187f,1.0f,
-			0.214017f,0.062271f,-0.494557f,1.0f,
-			0.214017f,0.062271f,-0.494557f,1.0f,
-			0.226656f,-0.043325f,-0.524262f,1.0f,
-			0.403279f,-0.043325f,-0.406049f,1.0f,
-			0.411951f,-0.142925f,-0.414721f,1.0f,
-			0.403279f,-0.043325f,-0.406049f,1.0f,
-			0.226656f,-0.043325f,-0.524262f,1.0f,
-			0.226656f,-0.043325f,-0.524262f,1.0f,
-			0.231450f,-0.142925f,-0.535529f,1.0f,
-			0.411951f,-0.142925f,-0.414721f,1.0f,
-			0.449790f,0.171865f,-0.198919f,1.0f,
-			0.401647f,0.283457f,-0.178435f,1.0f,
-			0.311041f,0.283457f,-0.313811f,1.0f,
-			0.311041f,0.283457f,-0.313811f,1.0f,
-			0.348094f,0.171865f,-0.350864f,1.0f,
-			0.449790f,0.171865f,-0.198919f,1.0f,
-			0.491787f,0.062271f,-0.216787f,1.0f,
-			0.449790f,0.171865f,-0.198919f,1.0f,
-			0.348094f,0.171865f,-0.350864f,1.0f,
-			0.348094f,0.171865f,-0.350864f,1.0f,
-			0.380417f,0.062271f,-0.383187f,1.0f,
-			0.491787f,0.062271f,-0.216787f,1.0f,
-			0.521492f,-0.043325f,-0.229426f,1.0f,
-			0.491787f,0.062271f,-0.216787f,1.0f,
-			0.380417f,0.062271f,-0.383187f,1.0f,
-			0.380417f,0.062271f,-0.383187f,1.0f,
-			0.403279f,-0.043325f,-0.406049f,1.0f,
-			0.521492f,-0.043325f,-0.229426f,1.0f,
-			0.532759f,-0.142925f,-0.234220f,1.0f,
-			0.521492f,-0.043325f,-0.229426f,1.0f,
-			0.403279f,-0.043325f,-0.406049f,1.0f,
-			0.403279f,-0.043325f,-0.406049f,1.0f,
-			0.411951f,-0.142925f,-0.414721f,1.0f,
-			0.532759f,-0.142925f,-0.234220f,1.0f,
-			0.486879f,0.171865f,-0.011080f,1.0f,
-			0.434692f,0.283457f,-0.011080f,1.0f,
-			0.401647f,0.283457f,-0.178435f,1.0f,
-			0.401647f,0.283457f,-0.178435f,1.0f,
-			0.449790f,0.171865f,-0.198919f,1.0f,
-			0.486879f,0.171865f,-0.011080f,1.0f,
-			0.532404f,0.062271f,-0.011080f,1.0f,
-			0.486879f,0.171865f,-0.011080f,1.0f,
-			0.449790f,0.171865f,-0.198919f,1.0f,
-			0.449790f,0.171865f,-0.198919f,1.0f,
-			0.491787f,0.062271f,-0.216787f,1.0f,
-			0.532404f,0.062271f,-0.011080f,1.0f,
-			0.564605f,-0.043325f,-0.011080f,1.0f,
-			0.532404f,0.062271f,-0.011080f,1.0f,
-			0.491787f,0.062271f,-0.216787f,1.0f,
-			0.491787f,0.062271f,-0.216787f,1.0f,
-			0.521492f,-0.043325f,-0.229426f,1.0f,
-			0.564605f,-0.043325f,-0.011080f,1.0f,
-			0.576819f,-0.142925f,-0.011080f,1.0f,
-			0.564605f,-0.043325f,-0.011080f,1.0f,
-			0.521492f,-0.043325f,-0.229426f,1.0f,
-			0.521492f,-0.043325f,-0.229426f,1.0f,
-			0.532759f,-0.142925f,-0.234220f,1.0f,
-			0.576819f,-0.142925f,-0.011080f,1.0f,
-			0.512273f,-0.227202f,0.203343f,1.0f,
-			0.532759f,-0.142925f,0.212059f,1.0f,
-			0.576819f,-0.142925f,-0.011080f,1.0f,
-			0.576819f,-0.142925f,-0.011080f,1.0f,
-			0.554611f,-0.227202f,-0.011080f,1.0f,
-			0.512273f,-0.227202f,0.203343f,1.0f,
-			0.467203f,-0.289493f,0.184167f,1.0f,
-			0.512273f,-0.227202f,0.203343f,1.0f,
-			0.554611f,-0.227202f,-0.011080f,1.0f,
-			0.554611f,-0.227202f,-0.011080f,1.0f,
-			0.505755f,-0.289493f,-0.011080f,1.0f,
-			0.467203f,-0.289493f,0.184167f,1.0f,
-			0.422133f,-0.331798f,0.164991f,1.0f,
-			0.467203f,-0.289493f,0.184167f,1.0f,
-			0.505755f,-0.289493f,-0.011080f,1.0f,
-			0.505755f,-0.289493f,-0.011080f,1.0f,
-			0.456899f,-0.331798f,-0.011080f,1.0f,
-			0.422133f,-0.331798f,0.164991f,1.0f,
-			0.401647f,-0.356115f,0.156274f,1.0f,
-			0.422133f,-0.331798f,0.164991f,1.0f,
-			0.456899f,-0.331798f,-0.011080f,1.0f,
-			0.456899f,-0.331798f,-0.011080f,1.0f,
-			0.434692f,-0.356115f,-0.011080f,1.0f,
-			0.401647f,-0.356115f,0.156274f,1.0f,
-			0.396184f,-0.227202f,0.376793f,1.0f,
-			0.411951f,-0.142925f,0.392561f,1.0f,
-			0.532759f,-0.142925f,0.212059f,1.0f,
-			0.532759f,-0.142925f,0.212059f,1.0f,
-			0.512273f,-0.227202f,0.203343f,1.0f,
-			0.396184f,-0.227202f,0.376793f,1.0f,
-			0.361496f,-0.289493f,0.342106f,1.0f,
-			0.396184f,-0.227202f,0.376793f,1.0f,
-			0.512273f,-0.227202f,0.203343f,1.0f,
-			0.512273f,-0.227202f,0.203343f,1.0f,
-			0.467203f,-0.289493f,0.184167f,1.0f,
-			0.361496f,-0.289493f,0.342106f,1.0f,
-			0.326808f,-0.331798f,0.307418f,1.0f,
-			0.361496f,-0.289493f,0.342106f,1.0f,
-			0.467203f,-0.289493f,0.184167f,1.0f,
-			0.467203f,-0.289493f,0.184167f,1.0f,
-			0.422133f,-0.331798f,0.164991f,1.0f,
-			0.326808f,-0.331798f,0.307418f,1.0f,
-			0.311041f,-0.356115f,0.291650f,1.0f,
-			0.326808f,-0.331798f,0.307418f,1.0f,
-			0.422133f,-0.331798f,0.164991f,1.0f,
-			0.422133f,-0.331798f,0.164991f,1.0f,
-			0.401647f,-0.356115f,0.156274f,1.0f,
-			0.311041f,-0.356115f,0.291650f,1.0f,
-			0.222733f,-0.227202f,0.492882f,1.0f,
-			0.231450f,-0.142925f,0.513369f,1.0f,
-			0.411951f,-0.142925f,0.392561f,1.0f,
-			0.411951f,-0.142925f,0.392561f,1.0f,
-			0.396184f,-0.227202f,0.376793f,1.0f,
-			0.222733f,-0.227202f,0.492882f,1.0f,
-			0.203557f,-0.289493f,0.447813f,1.0f,
-			0.222733f,-0.227202f,0.492882f,1.0f,
-			0.396184f,-0.227202f,0.376793f,1.0f,
-			0.396184f,-0.227202f,0.376793f,1.0f,
-			0.361496f,-0.289493f,0.342106f,1.0f,
-			0.203557f,-0.289493f,0.447813f,1.0f,
-			0.184381f,-0.331798f,0.402743f,1.0f,
-			0.203557f,-0.289493f,0.447813f,1.0f,
-			0.361496f,-0.289493f,0.342106f,1.0f,
-			0.361496f,-0.289493f,0.342106f,1.0f,
-			0.326808f,-0.331798f,0.307418f,1.0f,
-			0.184381f,-0.331798f,0.402743f,1.0f,
-			0.175665f,-0.356115f,0.382256f,1.0f,
-			0.184381f,-0.331798f,0.402743f,1.0f,
-			0.326808f,-0.331798f,0.307418f,1.0f,
-			0.326808f,-0.331798f,0.307418f,1.0f,
-			0.311041f,-0.356115f,0.291650f,1.0f,
-			0.175665f,-0.356115f,0.382256f,1.0f,
-			0.008310f,-0.227202f,0.535221f,1.0f,
-			0.008310f,-0.142925f,0.557428f,1.0f,
-			0.231450f,-0.142925f,0.513369f,1.0f,
-			0.231450f,-0.142925f,0.513369f,1.0f,
-			0.222733f,-0.227202f,0.492882f,1.0f,
-			0.008310f,-0.227202f,0.535221f,1.0f,
-			0.008310f,-0.289493f,0.486365f,1.0f,
-			0.008310f,-0.227202f,0.535221f,1.0f,
-			0.222733f,-0.227202f,0.492882f,1.0f,
-			0.222733f,-0.227202f,0.492882f,1.0f,
-			0.203557f,-0.289493f,0.447813f,1.0f,
-			0.008310f,-0.289493f,0.486365f,1.0f,
-			0.008310f,-0.331798f,0.437508f,1.0f,
-			0.008310f,-0.289493f,0.486365f,1.0f,
-			0.203557f,-0.289493f,0.447813f,1.0f,
-			0.203557f,-0.289493f,0.447813f,1.0f,
-			0.184381f,-0.331798f,0.402743f,1.0f,
-			0.008310f,-0.331798f,0.437508f,1.0f,
-			0.008310f,-0.356115f,0.415301f,1.0f,
-			0.008310f,-0.331798f,0.437508f,1.0f,
-			0.184381f,-0.331798f,0.402743f,1.0f,
-			0.184381f,-0.331798f,0.402743f,1.0f,
-			0.175665f,-0.356115f,0.382256f,1.0f,
-			0.008310f,-0.356115f,0.415301f,1.0f,
-			-0.206113f,-0.227202f,0.492882f,1.0f,
-			-0.214829f,-0.142925f,0.513369f,1.0f,
-			0.008310f,-0.142925f,0.557428f,1.0f,
-			0.008310f,-0.142925f,0.557428f,1.0f,
-			0.008310f,-0.227202f,0.535221f,1.0f,
-			-0.206113f,-0.227202f,0.492882f,1.0f,
-			-0.186937f,-0.289493f,0.447813f,1.0f,
-			-0.206113f,-0.227202f,0.492882f,1.0f,
-			0.008310f,-0.227202f,0.535221f,1.0f,
-			0.008310f,-0.227202f,0.535221f,1.0f,
-			0.008310f,-0.289493f,0.486365f,1.0f,
-			-0.186937f,-0.289493f,0.447813f,1.0f,
-			-0.167761f,-0.331798f,0.402743f,1.0f,
-			-0.186937f,-0.289493f,0.447813f,1.0f,
-			0.008310f,-0.289493f,0.486365f,1.0f,
-			0.008310f,-0.289493f,0.486365f,1.0f,
-			0.008310f,-0.331798f,0.437508f,1.0f,
-			-0.167761f,-0.331798f,0.402743f,1.0f,
-			-0.159044f,-0.356115f,0.382256f,1.0f,
-			-0.167761f,-0.331798f,0.402743f,1.0f,
-			0.008310f,-0.331798f,0.437508f,1.0f,
-			0.008310f,-0.331798f,0.437508f,1.0f,
-			0.008310f,-0.356115f,0.415301f,1.0f,
-			-0.159044f,-0.356115f,0.382256f,1.0f,
-			-0.379564f,-0.227202f,0.376793f,1.0f,
-			-0.395331f,-0.142925f,0.392561f,1.0f,
-			-0.214829f,-0.142925f,0.513369f,1.0f,
-			-0.214829f,-0.142925f,0.513369f,1.0f,
-			-0.206113f,-0.227202f,0.492882f,1.0f,
-			-0.379564f,-0.227202f,0.376793f,1.0f,
-			-0.344876f,-0.289493f,0.342106f,1.0f,
-			-0.379564f,-0.227202f,0.376793f,1.0f,
-			-0.206113f,-0.227202f,0.492882f,1.0f,
-			-0.206113f,-0.227202f,0.492882f,1.0f,
-			-0.186937f,-0.289493f,0.447813f,1.0f,
-			-0.344876f,-0.289493f,0.342106f,1.0f,
-			-0.310188f,-0.331798f,0.307418f,1.0f,
-			-0.344876f,-0.289493f,0.342106f,1.0f,
-			-0.186937f,-0.289493f,0.447813f,1.0f,
-			-0.186937f,-0.289493f,0.447813f,1.0f,
-			-0.167761f,-0.331798f,0.402743f,1.0f,
-			-0.310188f,-0.331798f,0.307418f,1.0f,
-			-0.294421f,-0.356115f,0.291650f,1.0f,
-			-0.310188f,-0.331798f,0.307418f,1.0f,
-			-0.167761f,-0.331798f,0.402743f,1.0f,
-			-0.167761f,-0.331798f,0.402743f,1.0f,
-			-0.159044f,-0.356115f,0.382256f,1.0f,
-			-0.294421f,-0.356115f,0.291650f,1.0f,
-			-0.495653f,-0.227202f,0.203343f,1.0f,
-			-0.516139f,-0.142925f,0.212059f,1.0f,
-			-0.395331f,-0.142925f,0.392561f,1.0f,
-			-0.395331f,-0.142925f,0.392561f,1.0f,
-			-0.379564f,-0.227202f,0.376793f,1.0f,
-			-0.495653f,-0.227202f,0.203343f,1.0f,
-			-0.450583f,-0.289493f,0.184167f,1.0f,
-			-0.495653f,-0.227202f,0.203343f,1.0f,
-			-0.379564f,-0.227202f,0.376793f,1.0f,
-			-0.379564f,-0.227202f,0.376793f,1.0f,
-			-0.344876f,-0.289493f,0.342106f,1.0f,
-			-0.450583f,-0.289493f,0.184167f,1.0f,
-			-0.405513f,-0.331798f,0.164991f,1.0f,
-			-0.450583f,-0.289493f,0.184167f,1.0f,
-			-0.344876f,-0.289493f,0.342106f,1.0f,
-			-0.344876f,-0.289493f,0.342106f,1.0f,
-			-0.310188f,-0.331798f,0.307418f,1.0f,
-			-0.405513f,-0.331798f,0.164991f,1.0f,
-			-0.385027f,-0.356115f,0.156274f,1.0f,
-			-0.405513f,-0.331798f,0.164991f,1.0f,
-			-0.310188f,-0.331798f,0.307418f,1.0f,
-			-0.310188f,-0.331798f,0.307418f,1.0f,
-			-0.294421f,-0.356115f,0.291650f,1.0f,
-			-0.385027f,-0.356115f,0.156274f,1.0f,
-			-0.537991f,-0.227202f,-0.011080f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.516139f,-0.142925f,0.212059f,1.0f,
-			-0.516139f,-0.142925f,0.212059f,1.0f,
-			-0.495653f,-0.227202f,0.203343f,1.0f,
-			-0.537991f,-0.227202f,-0.011080f,1.0f,
-			-0.489135f,-0.289493f,-0.011080f,1.0f,
-			-0.537991f,-0.227202f,-0.011080f,1.0f,
-			-0.495653f,-0.227202f,0.203343f,1.0f,
-			-0.495653f,-0.227202f,0.203343f,1.0f,
-			-0.450583f,-0.289493f,0.184167f,1.0f,
-			-0.489135f,-0.289493f,-0.011080f,1.0f,
-			-0.440279f,-0.331798f,-0.011080f,1.0f,
-			-0.489135f,-0.289493f,-0.011080f,1.0f,
-			-0.450583f,-0.289493f,0.184167f,1.0f,
-			-0.450583f,-0.289493f,0.184167f,1.0f,
-			-0.405513f,-0.331798f,0.164991f,1.0f,
-			-0.440279f,-0.331798f,-0.011080f,1.0f,
-			-0.418071f,-0.356115f,-0.011080f,1.0f,
-			-0.440279f,-0.331798f,-0.011080f,1.0f,
-			-0.405513f,-0.331798f,0.164991f,1.0f,
-			-0.405513f,-0.331798f,0.164991f,1.0f,
-			-0.385027f,-0.356115f,0.156274f,1.0f,
-			-0.418071f,-0.356115f,-0.011080f,1.0f,
-			-0.495653f,-0.227202f,-0.225504f,1.0f,
-			-0.516139f,-0.142925f,-0.234220f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.537991f,-0.227202f,-0.011080f,1.0f,
-			-0.495653f,-0.227202f,-0.225504f,1.0f,
-			-0.450583f,-0.289493f,-0.206327f,1.0f,
-			-0.495653f,-0.227202f,-0.225504f,1.0f,
-			-0.537991f,-0.227202f,-0.011080f,1.0f,
-			-0.537991f,-0.227202f,-0.011080f,1.0f,
-			-0.489135f,-0.289493f,-0.011080f,1.0f,
-			-0.450583f,-0.289493f,-0.206327f,1.0f,
-			-0.405513f,-0.331798f,-0.187151f,1.0f,
-			-0.450583f,-0.289493f,-0.206327f,1.0f,
-			-0.489135f,-0.289493f,-0.011080f,1.0f,
-			-0.489135f,-0.289493f,-0.011080f,1.0f,
-			-0.440279f,-0.331798f,-0.011080f,1.0f,
-			-0.405513f,-0.331798f,-0.187151f,1.0f,
-			-0.385027f,-0.356115f,-0.178435f,1.0f,
-			-0.405513f,-0.331798f,-0.187151f,1.0f,
-			-0.440279f,-0.331798f,-0.011080f,1.0f,
-			-0.440279f,-0.331798f,-0.011080f,1.0f,
-			-0.418071f,-0.356115f,-0.011080f,1.0f,
-			-0.385027f,-0.356115f,-0.178435f,1.0f,
-			-0.379564f,-0.227202f,-0.398954f,1.0f,
-			-0.395331f,-0.142925f,-0.414721f,1.0f,
-			-0.516139f,-0.142925f,-0.234220f,1.0f,
-			-0.516139f,-0.142925f,-0.234220f,1.0f,
-			-0.495653f,-0.227202f,-0.225504f,1.0f,
-			-0.379564f,-0.227202f,-0.398954f,1.0f,
-			-0.344876f,-0.289493f,-0.364266f,1.0f,
-			-0.379564f,-0.227202f,-0.398954f,1.0f,
-			-0.495653f,-0.227202f,-0.225504f,1.0f,
-			-0.495653f,-0.227202f,-0.225504f,1.0f,
-			-0.450583f,-0.289493f,-0.206327f,1.0f,
-			-0.344876f,-0.289493f,-0.364266f,1.0f,
-			-0.310188f,-0.331798f,-0.329578f,1.0f,
-			-0.344876f,-0.289493f,-0.364266f,1.0f,
-			-0.450583f,-0.289493f,-0.206327f,1.0f,
-			-0.450583f,-0.289493f,-0.206327f,1.0f,
-			-0.405513f,-0.331798f,-0.187151f,1.0f,
-			-0.310188f,-0.331798f,-0.329578f,1.0f,
-			-0.294421f,-0.356115f,-0.313811f,1.0f,
-			-0.310188f,-0.331798f,-0.329578f,1.0f,
-			-0.405513f,-0.331798f,-0.187151f,1.0f,
-			-0.405513f,-0.331798f,-0.187151f,1.0f,
-			-0.385027f,-0.356115f,-0.178435f,1.0f,
-			-0.294421f,-0.356115f,-0.313811f,1.0f,
-			-0.206113f,-0.227202f,-0.515043f,1.0f,
-			-0.214829f,-0.142925f,-0.535529f,1.0f,
-			-0.395331f,-0.142925f,-0.414721f,1.0f,
-			-0.395331f,-0.142925f,-0.414721f,1.0f,
-			-0.379564f,-0.227202f,-0.398954f,1.0f,
-			-0.206113f,-0.227202f,-0.515043f,1.0f,
-			-0.186937f,-0.289493f,-0.469973f,1.0f,
-			-0.206113f,-0.227202f,-0.515043f,1.0f,
-			-0.379564f,-0.227202f,-0.398954f,1.0f,
-			-0.379564f,-0.227202f,-0.398954f,1.0f,
-			-0.344876f,-0.289493f,-0.364266f,1.0f,
-			-0.186937f,-0.289493f,-0.469973f,1.0f,
-			-0.167761f,-0.331798f,-0.424903f,1.0f,
-			-0.186937f,-0.289493f,-0.469973f,1.0f,
-			-0.344876f,-0.289493f,-0.364266f,1.0f,
-			-0.344876f,-0.289493f,-0.364266f,1.0f,
-			-0.310188f,-0.331798f,-0.329578f,1.0f,
-			-0.167761f,-0.331798f,-0.424903f,1.0f,
-			-0.159044f,-0.356115f,-0.404417f,1.0f,
-			-0.167761f,-0.331798f,-0.424903f,1.0f,
-			-0.310188f,-0.331798f,-0.329578f,1.0f,
-			-0.310188f,-0.331798f,-0.329578f,1.0f,
-			-0.294421f,-0.356115f,-0.313811f,1.0f,
-			-0.159044f,-0.356115f,-0.404417f,1.0f,
-			0.008310f,-0.227202f,-0.557382f,1.0f,
-			0.008310f,-0.142925f,-0.579589f,1.0f,
-			-0.214829f,-0.142925f,-0.535529f,1.0f,
-			-0.214829f,-0.142925f,-0.535529f,1.0f,
-			-0.206113f,-0.227202f,-0.515043f,1.0f,
-			0.008310f,-0.227202f,-0.557382f,1.0f,
-			0.008310f,-0.289493f,-0.508525f,1.0f,
-			0.008310f,-0.227202f,-0.557382f,1.0f,
-			-0.206113f,-0.227202f,-0.515043f,1.0f,
-			-0.206113f,-0.227202f,-0.515043f,1.0f,
-			-0.186937f,-0.289493f,-0.469973f,1.0f,
-			0.008310f,-0.289493f,-0.508525f,1.0f,
-			0.008310f,-0.331798f,-0.459669f,1.0f,
-			0.008310f,-0.289493f,-0.508525f,1.0f,
-			-0.186937f,-0.289493f,-0.469973f,1.0f,
-			-0.186937f,-0.289493f,-0.469973f,1.0f,
-			-0.167761f,-0.331798f,-0.424903f,1.0f,
-			0.008310f,-0.331798f,-0.459669f,1.0f,
-			0.008310f,-0.356115f,-0.437462f,1.0f,
-			0.008310f,-0.331798f,-0.459669f,1.0f,
-			-0.167761f,-0.331798f,-0.424903f,1.0f,
-			-0.167761f,-0.331798f,-0.424903f,1.0f,
-			-0.159044f,-0.356115f,-0.404417f,1.0f,
-			0.008310f,-0.356115f,-0.437462f,1.0f,
-			0.222733f,-0.227202f,-0.515043f,1.0f,
-			0.231450f,-0.142925f,-0.535529f,1.0f,
-			0.008310f,-0.142925f,-0.579589f,1.0f,
-			0.008310f,-0.142925f,-0.579589f,1.0f,
-			0.008310f,-0.227202f,-0.557382f,1.0f,
-			0.222733f,-0.227202f,-0.515043f,1.0f,
-			0.203557f,-0.289493f,-0.469973f,1.0f,
-			0.222733f,-0.227202f,-0.515043f,1.0f,
-			0.008310f,-0.227202f,-0.557382f,1.0f,
-			0.008310f,-0.227202f,-0.557382f,1.0f,
-			0.008310f,-0.289493f,-0.508525f,1.0f,
-			0.203557f,-0.289493f,-0.469973f,1.0f,
-			0.184381f,-0.331798f,-0.424903f,1.0f,
-			0.203557f,-0.289493f,-0.469973f,1.0f,
-			0.008310f,-0.289493f,-0.508525f,1.0f,
-			0.008310f,-0.289493f,-0.508525f,1.0f,
-			0.008310f,-0.331798f,-0.459669f,1.0f,
-			0.184381f,-0.331798f,-0.424903f,1.0f,
-			0.175665f,-0.356115f,-0.404417f,1.0f,
-			0.184381f,-0.331798f,-0.424903f,1.0f,
-			0.008310f,-0.331798f,-0.459669f,1.0f,
-			0.008310f,-0.331798f,-0.459669f,1.0f,
-			0.008310f,-0.356115f,-0.437462f,1.0f,
-			0.175665f,-0.356115f,-0.404417f,1.0f,
-			0.396184f,-0.227202f,-0.398954f,1.0f,
-			0.411951f,-0.142925f,-0.414721f,1.0f,
-			0.231450f,-0.142925f,-0.535529f,1.0f,
-			0.231450f,-0.142925f,-0.535529f,1.0f,
-			0.222733f,-0.227202f,-0.515043f,1.0f,
-			0.396184f,-0.227202f,-0.398954f,1.0f,
-			0.361496f,-0.289493f,-0.364266f,1.0f,
-			0.396184f,-0.227202f,-0.398954f,1.0f,
-			0.222733f,-0.227202f,-0.515043f,1.0f,
-			0.222733f,-0.227202f,-0.515043f,1.0f,
-			0.203557f,-0.289493f,-0.469973f,1.0f,
-			0.361496f,-0.289493f,-0.364266f,1.0f,
-			0.326808f,-0.331798f,-0.329578f,1.0f,
-			0.361496f,-0.289493f,-0.364266f,1.0f,
-			0.203557f,-0.289493f,-0.469973f,1.0f,
-			0.203557f,-0.289493f,-0.469973f,1.0f,
-			0.184381f,-0.331798f,-0.424903f,1.0f,
-			0.326808f,-0.331798f,-0.329578f,1.0f,
-			0.311041f,-0.356115f,-0.313811f,1.0f,
-			0.326808f,-0.331798f,-0.329578f,1.0f,
-			0.184381f,-0.331798f,-0.424903f,1.0f,
-			0.184381f,-0.331798f,-0.424903f,1.0f,
-			0.175665f,-0.356115f,-0.404417f,1.0f,
-			0.311041f,-0.356115f,-0.313811f,1.0f,
-			0.512273f,-0.227202f,-0.225504f,1.0f,
-			0.532759f,-0.142925f,-0.234220f,1.0f,
-			0.411951f,-0.142925f,-0.414721f,1.0f,
-			0.411951f,-0.142925f,-0.414721f,1.0f,
-			0.396184f,-0.227202f,-0.398954f,1.0f,
-			0.512273f,-0.227202f,-0.225504f,1.0f,
-			0.467203f,-0.289493f,-0.206327f,1.0f,
-			0.512273f,-0.227202f,-0.225504f,1.0f,
-			0.396184f,-0.227202f,-0.398954f,1.0f,
-			0.396184f,-0.227202f,-0.398954f,1.0f,
-			0.361496f,-0.289493f,-0.364266f,1.0f,
-			0.467203f,-0.289493f,-0.206327f,1.0f,
-			0.422133f,-0.331798f,-0.187151f,1.0f,
-			0.467203f,-0.289493f,-0.206327f,1.0f,
-			0.361496f,-0.289493f,-0.364266f,1.0f,
-			0.361496f,-0.289493f,-0.364266f,1.0f,
-			0.326808f,-0.331798f,-0.329578f,1.0f,
-			0.422133f,-0.331798f,-0.187151f,1.0f,
-			0.401647f,-0.356115f,-0.178435f,1.0f,
-			0.422133f,-0.331798f,-0.187151f,1.0f,
-			0.326808f,-0.331798f,-0.329578f,1.0f,
-			0.326808f,-0.331798f,-0.329578f,1.0f,
-			0.311041f,-0.356115f,-0.313811f,1.0f,
-			0.401647f,-0.356115f,-0.178435f,1.0f,
-			0.554611f,-0.227202f,-0.011080f,1.0f,
-			0.576819f,-0.142925f,-0.011080f,1.0f,
-			0.532759f,-0.142925f,-0.234220f,1.0f,
-			0.532759f,-0.142925f,-0.234220f,1.0f,
-			0.512273f,-0.227202f,-0.225504f,1.0f,
-			0.554611f,-0.227202f,-0.011080f,1.0f,
-			0.505755f,-0.289493f,-0.011080f,1.0f,
-			0.554611f,-0.227202f,-0.011080f,1.0f,
-			0.512273f,-0.227202f,-0.225504f,1.0f,
-			0.512273f,-0.227202f,-0.225504f,1.0f,
-			0.467203f,-0.289493f,-0.206327f,1.0f,
-			0.505755f,-0.289493f,-0.011080f,1.0f,
-			0.456899f,-0.331798f,-0.011080f,1.0f,
-			0.505755f,-0.289493f,-0.011080f,1.0f,
-			0.467203f,-0.289493f,-0.206327f,1.0f,
-			0.467203f,-0.289493f,-0.206327f,1.0f,
-			0.422133f,-0.331798f,-0.187151f,1.0f,
-			0.456899f,-0.331798f,-0.011080f,1.0f,
-			0.434692f,-0.356115f,-0.011080f,1.0f,
-			0.456899f,-0.331798f,-0.011080f,1.0f,
-			0.422133f,-0.331798f,-0.187151f,1.0f,
-			0.422133f,-0.331798f,-0.187151f,1.0f,
-			0.401647f,-0.356115f,-0.178435f,1.0f,
-			0.434692f,-0.356115f,-0.011080f,1.0f,
-			0.392736f,-0.371772f,0.152483f,1.0f,
-			0.401647f,-0.356115f,0.156274f,1.0f,
-			0.434692f,-0.356115f,-0.011080f,1.0f,
-			0.434692f,-0.356115f,-0.011080f,1.0f,
-			0.425031f,-0.371772f,-0.011080f,1.0f,
-			0.392736f,-0.371772f,0.152483f,1.0f,
-			0.345105f,-0.385429f,0.132217f,1.0f,
-			0.392736f,-0.371772f,0.152483f,1.0f,
-			0.425031f,-0.371772f,-0.011080f,1.0f,
-			0.425031f,-0.371772f,-0.011080f,1.0f,
-			0.373399f,-0.385429f,-0.011080f,1.0f,
-			0.345105f,-0.385429f,0.132217f,1.0f,
-			0.227411f,-0.395089f,0.082141f,1.0f,
-			0.345105f,-0.385429f,0.132217f,1.0f,
-			0.373399f,-0.385429f,-0.011080f,1.0f,
-			0.373399f,-0.385429f,-0.011080f,1.0f,
-			0.245818f,-0.395089f,-0.011080f,1.0f,
-			0.227411f,-0.395089f,0.082141f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.227411f,-0.395089f,0.082141f,1.0f,
-			0.245818f,-0.395089f,-0.011080f,1.0f,
-			0.304182f,-0.371772f,0.284792f,1.0f,
-			0.311041f,-0.356115f,0.291650f,1.0f,
-			0.401647f,-0.356115f,0.156274f,1.0f,
-			0.401647f,-0.356115f,0.156274f,1.0f,
-			0.392736f,-0.371772f,0.152483f,1.0f,
-			0.304182f,-0.371772f,0.284792f,1.0f,
-			0.267523f,-0.385429f,0.248133f,1.0f,
-			0.304182f,-0.371772f,0.284792f,1.0f,
-			0.392736f,-0.371772f,0.152483f,1.0f,
-			0.392736f,-0.371772f,0.152483f,1.0f,
-			0.345105f,-0.385429f,0.132217f,1.0f,
-			0.267523f,-0.385429f,0.248133f,1.0f,
-			0.176941f,-0.395089f,0.157550f,1.0f,
-			0.267523f,-0.385429f,0.248133f,1.0f,
-			0.345105f,-0.385429f,0.132217f,1.0f,
-			0.345105f,-0.385429f,0.132217f,1.0f,
-			0.227411f,-0.395089f,0.082141f,1.0f,
-			0.176941f,-0.395089f,0.157550f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.176941f,-0.395089f,0.157550f,1.0f,
-			0.227411f,-0.395089f,0.082141f,1.0f,
-			0.171873f,-0.371772f,0.373345f,1.0f,
-			0.175665f,-0.356115f,0.382256f,1.0f,
-			0.311041f,-0.356115f,0.291650f,1.0f,
-			0.311041f,-0.356115f,0.291650f,1.0f,
-			0.304182f,-0.371772f,0.284792f,1.0f,
-			0.171873f,-0.371772f,0.373345f,1.0f,
-			0.151608f,-0.385429f,0.325714f,1.0f,
-			0.171873f,-0.371772f,0.373345f,1.0f,
-			0.304182f,-0.371772f,0.284792f,1.0f,
-			0.304182f,-0.371772f,0.284792f,1.0f,
-			0.267523f,-0.385429f,0.248133f,1.0f,
-			0.151608f,-0.385429f,0.325714f,1.0f,
-			0.101532f,-0.395089f,0.208021f,1.0f,
-			0.151608f,-0.385429f,0.325714f,1.0f,
-			0.267523f,-0.385429f,0.248133f,1.0f,
-			0.267523f,-0.385429f,0.248133f,1.0f,
-			0.176941f,-0.395089f,0.157550f,1.0f,
-			0.101532f,-0.395089f,0.208021f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.101532f,-0.395089f,0.208021f,1.0f,
-			0.176941f,-0.395089f,0.157550f,1.0f,
-			0.008310f,-0.371772f,0.405641f,1.0f,
-			0.008310f,-0.356115f,0.415301f,1.0f,
-			0.175665f,-0.356115f,0.382256f,1.0f,
-			0.175665f,-0.356115f,0.382256f,1.0f,
-			0.171873f,-0.371772f,0.373345f,1.0f,
-			0.008310f,-0.371772f,0.405641f,1.0f,
-			0.008310f,-0.385429f,0.354009f,1.0f,
-			0.008310f,-0.371772f,0.405641f,1.0f,
-			0.171873f,-0.371772f,0.373345f,1.0f,
-			0.171873f,-0.371772f,0.373345f,1.0f,
-			0.151608f,-0.385429f,0.325714f,1.0f,
-			0.008310f,-0.385429f,0.354009f,1.0f,
-			0.008310f,-0.395089f,0.226427f,1.0f,
-			0.008310f,-0.385429f,0.354009f,1.0f,
-			0.151608f,-0.385429f,0.325714f,1.0f,
-			0.151608f,-0.385429f,0.325714f,1.0f,
-			0.101532f,-0.395089f,0.208021f,1.0f,
-			0.008310f,-0.395089f,0.226427f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.008310f,-0.395089f,0.226427f,1.0f,
-			0.101532f,-0.395089f,0.208021f,1.0f,
-			-0.155253f,-0.371772f,0.373345f,1.0f,
-			-0.159044f,-0.356115f,0.382256f,1.0f,
-			0.008310f,-0.356115f,0.415301f,1.0f,
-			0.008310f,-0.356115f,0.415301f,1.0f,
-			0.008310f,-0.371772f,0.405641f,1.0f,
-			-0.155253f,-0.371772f,0.373345f,1.0f,
-			-0.134987f,-0.385429f,0.325714f,1.0f,
-			-0.155253f,-0.371772f,0.373345f,1.0f,
-			0.008310f,-0.371772f,0.405641f,1.0f,
-			0.008310f,-0.371772f,0.405641f,1.0f,
-			0.008310f,-0.385429f,0.354009f,1.0f,
-			-0.134987f,-0.385429f,0.325714f,1.0f,
-			-0.084911f,-0.395089f,0.208021f,1.0f,
-			-0.134987f,-0.385429f,0.325714f,1.0f,
-			0.008310f,-0.385429f,0.354009f,1.0f,
-			0.008310f,-0.385429f,0.354009f,1.0f,
-			0.008310f,-0.395089f,0.226427f,1.0f,
-			-0.084911f,-0.395089f,0.208021f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			-0.084911f,-0.395089f,0.208021f,1.0f,
-			0.008310f,-0.395089f,0.226427f,1.0f,
-			-0.287562f,-0.371772f,0.284792f,1.0f,
-			-0.294421f,-0.356115f,0.291650f,1.0f,
-			-0.159044f,-0.356115f,0.382256f,1.0f,
-			-0.159044f,-0.356115f,0.382256f,1.0f,
-			-0.155253f,-0.371772f,0.373345f,1.0f,
-			-0.287562f,-0.371772f,0.284792f,1.0f,
-			-0.250903f,-0.385429f,0.248133f,1.0f,
-			-0.287562f,-0.371772f,0.284792f,1.0f,
-			-0.155253f,-0.371772f,0.373345f,1.0f,
-			-0.155253f,-0.371772f,0.373345f,1.0f,
-			-0.134987f,-0.385429f,0.325714f,1.0f,
-			-0.250903f,-0.385429f,0.248133f,1.0f,
-			-0.160320f,-0.395089f,0.157550f,1.0f,
-			-0.250903f,-0.385429f,0.248133f,1.0f,
-			-0.134987f,-0.385429f,0.325714f,1.0f,
-			-0.134987f,-0.385429f,0.325714f,1.0f,
-			-0.084911f,-0.395089f,0.208021f,1.0f,
-			-0.160320f,-0.395089f,0.157550f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			-0.160320f,-0.395089f,0.157550f,1.0f,
-			-0.084911f,-0.395089f,0.208021f,1.0f,
-			-0.376115f,-0.371772f,0.152483f,1.0f,
-			-0.385027f,-0.356115f,0.156274f,1.0f,
-			-0.294421f,-0.356115f,0.291650f,1.0f,
-			-0.294421f,-0.356115f,0.291650f,1.0f,
-			-0.287562f,-0.371772f,0.284792f,1.0f,
-			-0.376115f,-0.371772f,0.152483f,1.0f,
-			-0.328484f,-0.385429f,0.132217f,1.0f,
-			-0.376115f,-0.371772f,0.152483f,1.0f,
-			-0.287562f,-0.371772f,0.284792f,1.0f,
-			-0.287562f,-0.371772f,0.284792f,1.0f,
-			-0.250903f,-0.385429f,0.248133f,1.0f,
-			-0.328484f,-0.385429f,0.132217f,1.0f,
-			-0.210791f,-0.395089f,0.082141f,1.0f,
-			-0.328484f,-0.385429f,0.132217f,1.0f,
-			-0.250903f,-0.385429f,0.248133f,1.0f,
-			-0.250903f,-0.385429f,0.248133f,1.0f,
-			-0.160320f,-0.395089f,0.157550f,1.0f,
-			-0.210791f,-0.395089f,0.082141f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			-0.210791f,-0.395089f,0.082141f,1.0f,
-			-0.160320f,-0.395089f,0.157550f,1.0f,
-			-0.408411f,-0.371772f,-0.011080f,1.0f,
-			-0.418071f,-0.356115f,-0.011080f,1.0f,
-			-0.385027f,-0.356115f,0.156274f,1.0f,
-			-0.385027f,-0.356115f,0.156274f,1.0f,
-			-0.376115f,-0.371772f,0.152483f,1.0f,
-			-0.408411f,-0.371772f,-0.011080f,1.0f,
-			-0.356779f,-0.385429f,-0.011080f,1.0f,
-			-0.408411f,-0.371772f,-0.011080f,1.0f,
-			-0.376115f,-0.371772f,0.152483f,1.0f,
-			-0.376115f,-0.371772f,0.152483f,1.0f,
-			-0.328484f,-0.385429f,0.132217f,1.0f,
-			-0.356779f,-0.385429f,-0.011080f,1.0f,
-			-0.229198f,-0.395089f,-0.011080f,1.0f,
-			-0.356779f,-0.385429f,-0.011080f,1.0f,
-			-0.328484f,-0.385429f,0.132217f,1.0f,
-			-0.328484f,-0.385429f,0.132217f,1.0f,
-			-0.210791f,-0.395089f,0.082141f,1.0f,
-			-0.229198f,-0.395089f,-0.011080f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			-0.229198f,-0.395089f,-0.011080f,1.0f,
-			-0.210791f,-0.395089f,0.082141f,1.0f,
-			-0.376115f,-0.371772f,-0.174643f,1.0f,
-			-0.385027f,-0.356115f,-0.178435f,1.0f,
-			-0.418071f,-0.356115f,-0.011080f,1.0f,
-			-0.418071f,-0.356115f,-0.011080f,1.0f,
-			-0.408411f,-0.371772f,-0.011080f,1.0f,
-			-0.376115f,-0.371772f,-0.174643f,1.0f,
-			-0.328484f,-0.385429f,-0.154378f,1.0f,
-			-0.376115f,-0.371772f,-0.174643f,1.0f,
-			-0.408411f,-0.371772f,-0.011080f,1.0f,
-			-0.408411f,-0.371772f,-0.011080f,1.0f,
-			-0.356779f,-0.385429f,-0.011080f,1.0f,
-			-0.328484f,-0.385429f,-0.154378f,1.0f,
-			-0.210791f,-0.395089f,-0.104302f,1.0f,
-			-0.328484f,-0.385429f,-0.154378f,1.0f,
-			-0.356779f,-0.385429f,-0.011080f,1.0f,
-			-0.356779f,-0.385429f,-0.011080f,1.0f,
-			-0.229198f,-0.395089f,-0.011080f,1.0f,
-			-0.210791f,-0.395089f,-0.104302f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			-0.210791f,-0.395089f,-0.104302f,1.0f,
-			-0.229198f,-0.395089f,-0.011080f,1.0f,
-			-0.287562f,-0.371772f,-0.306952f,1.0f,
-			-0.294421f,-0.356115f,-0.313811f,1.0f,
-			-0.385027f,-0.356115f,-0.178435f,1.0f,
-			-0.385027f,-0.356115f,-0.178435f,1.0f,
-			-0.376115f,-0.371772f,-0.174643f,1.0f,
-			-0.287562f,-0.371772f,-0.306952f,1.0f,
-			-0.250903f,-0.385429f,-0.270294f,1.0f,
-			-0.287562f,-0.371772f,-0.306952f,1.0f,
-			-0.376115f,-0.371772f,-0.174643f,1.0f,
-			-0.376115f,-0.371772f,-0.174643f,1.0f,
-			-0.328484f,-0.385429f,-0.154378f,1.0f,
-			-0.250903f,-0.385429f,-0.270294f,1.0f,
-			-0.160320f,-0.395089f,-0.179711f,1.0f,
-			-0.250903f,-0.385429f,-0.270294f,1.0f,
-			-0.328484f,-0.385429f,-0.154378f,1.0f,
-			-0.328484f,-0.385429f,-0.154378f,1.0f,
-			-0.210791f,-0.395089f,-0.104302f,1.0f,
-			-0.160320f,-0.395089f,-0.179711f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			-0.160320f,-0.395089f,-0.179711f,1.0f,
-			-0.210791f,-0.395089f,-0.104302f,1.0f,
-			-0.155253f,-0.371772f,-0.395506f,1.0f,
-			-0.159044f,-0.356115f,-0.404417f,1.0f,
-			-0.294421f,-0.356115f,-0.313811f,1.0f,
-			-0.294421f,-0.356115f,-0.313811f,1.0f,
-			-0.287562f,-0.371772f,-0.306952f,1.0f,
-			-0.155253f,-0.371772f,-0.395506f,1.0f,
-			-0.134987f,-0.385429f,-0.347875f,1.0f,
-			-0.155253f,-0.371772f,-0.395506f,1.0f,
-			-0.287562f,-0.371772f,-0.306952f,1.0f,
-			-0.287562f,-0.371772f,-0.306952f,1.0f,
-			-0.250903f,-0.385429f,-0.270294f,1.0f,
-			-0.134987f,-0.385429f,-0.347875f,1.0f,
-			-0.084911f,-0.395089f,-0.230181f,1.0f,
-			-0.134987f,-0.385429f,-0.347875f,1.0f,
-			-0.250903f,-0.385429f,-0.270294f,1.0f,
-			-0.250903f,-0.385429f,-0.270294f,1.0f,
-			-0.160320f,-0.395089f,-0.179711f,1.0f,
-			-0.084911f,-0.395089f,-0.230181f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			-0.084911f,-0.395089f,-0.230181f,1.0f,
-			-0.160320f,-0.395089f,-0.179711f,1.0f,
-			0.008310f,-0.371772f,-0.427802f,1.0f,
-			0.008310f,-0.356115f,-0.437462f,1.0f,
-			-0.159044f,-0.356115f,-0.404417f,1.0f,
-			-0.159044f,-0.356115f,-0.404417f,1.0f,
-			-0.155253f,-0.371772f,-0.395506f,1.0f,
-			0.008310f,-0.371772f,-0.427802f,1.0f,
-			0.008310f,-0.385429f,-0.376169f,1.0f,
-			0.008310f,-0.371772f,-0.427802f,1.0f,
-			-0.155253f,-0.371772f,-0.395506f,1.0f,
-			-0.155253f,-0.371772f,-0.395506f,1.0f,
-			-0.134987f,-0.385429f,-0.347875f,1.0f,
-			0.008310f,-0.385429f,-0.376169f,1.0f,
-			0.008310f,-0.395089f,-0.248588f,1.0f,
-			0.008310f,-0.385429f,-0.376169f,1.0f,
-			-0.134987f,-0.385429f,-0.347875f,1.0f,
-			-0.134987f,-0.385429f,-0.347875f,1.0f,
-			-0.084911f,-0.395089f,-0.230181f,1.0f,
-			0.008310f,-0.395089f,-0.248588f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.008310f,-0.395089f,-0.248588f,1.0f,
-			-0.084911f,-0.395089f,-0.230181f,1.0f,
-			0.171873f,-0.371772f,-0.395506f,1.0f,
-			0.175665f,-0.356115f,-0.404417f,1.0f,
-			0.008310f,-0.356115f,-0.437462f,1.0f,
-			0.008310f,-0.356115f,-0.437462f,1.0f,
-			0.008310f,-0.371772f,-0.427802f,1.0f,
-			0.171873f,-0.371772f,-0.395506f,1.0f,
-			0.151608f,-0.385429f,-0.347875f,1.0f,
-			0.171873f,-0.371772f,-0.395506f,1.0f,
-			0.008310f,-0.371772f,-0.427802f,1.0f,
-			0.008310f,-0.371772f,-0.427802f,1.0f,
-			0.008310f,-0.385429f,-0.376169f,1.0f,
-			0.151608f,-0.385429f,-0.347875f,1.0f,
-			0.101532f,-0.395089f,-0.230181f,1.0f,
-			0.151608f,-0.385429f,-0.347875f,1.0f,
-			0.008310f,-0.385429f,-0.376169f,1.0f,
-			0.008310f,-0.385429f,-0.376169f,1.0f,
-			0.008310f,-0.395089f,-0.248588f,1.0f,
-			0.101532f,-0.395089f,-0.230181f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.101532f,-0.395089f,-0.230181f,1.0f,
-			0.008310f,-0.395089f,-0.248588f,1.0f,
-			0.304182f,-0.371772f,-0.306952f,1.0f,
-			0.311041f,-0.356115f,-0.313811f,1.0f,
-			0.175665f,-0.356115f,-0.404417f,1.0f,
-			0.175665f,-0.356115f,-0.404417f,1.0f,
-			0.171873f,-0.371772f,-0.395506f,1.0f,
-			0.304182f,-0.371772f,-0.306952f,1.0f,
-			0.267523f,-0.385429f,-0.270294f,1.0f,
-			0.304182f,-0.371772f,-0.306952f,1.0f,
-			0.171873f,-0.371772f,-0.395506f,1.0f,
-			0.171873f,-0.371772f,-0.395506f,1.0f,
-			0.151608f,-0.385429f,-0.347875f,1.0f,
-			0.267523f,-0.385429f,-0.270294f,1.0f,
-			0.176941f,-0.395089f,-0.179711f,1.0f,
-			0.267523f,-0.385429f,-0.270294f,1.0f,
-			0.151608f,-0.385429f,-0.347875f,1.0f,
-			0.151608f,-0.385429f,-0.347875f,1.0f,
-			0.101532f,-0.395089f,-0.230181f,1.0f,
-			0.176941f,-0.395089f,-0.179711f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.176941f,-0.395089f,-0.179711f,1.0f,
-			0.101532f,-0.395089f,-0.230181f,1.0f,
-			0.392736f,-0.371772f,-0.174643f,1.0f,
-			0.401647f,-0.356115f,-0.178435f,1.0f,
-			0.311041f,-0.356115f,-0.313811f,1.0f,
-			0.311041f,-0.356115f,-0.313811f,1.0f,
-			0.304182f,-0.371772f,-0.306952f,1.0f,
-			0.392736f,-0.371772f,-0.174643f,1.0f,
-			0.345105f,-0.385429f,-0.154378f,1.0f,
-			0.392736f,-0.371772f,-0.174643f,1.0f,
-			0.304182f,-0.371772f,-0.306952f,1.0f,
-			0.304182f,-0.371772f,-0.306952f,1.0f,
-			0.267523f,-0.385429f,-0.270294f,1.0f,
-			0.345105f,-0.385429f,-0.154378f,1.0f,
-			0.227411f,-0.395089f,-0.104302f,1.0f,
-			0.345105f,-0.385429f,-0.154378f,1.0f,
-			0.267523f,-0.385429f,-0.270294f,1.0f,
-			0.267523f,-0.385429f,-0.270294f,1.0f,
-			0.176941f,-0.395089f,-0.179711f,1.0f,
-			0.227411f,-0.395089f,-0.104302f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.227411f,-0.395089f,-0.104302f,1.0f,
-			0.176941f,-0.395089f,-0.179711f,1.0f,
-			0.425031f,-0.371772f,-0.011080f,1.0f,
-			0.434692f,-0.356115f,-0.011080f,1.0f,
-			0.401647f,-0.356115f,-0.178435f,1.0f,
-			0.401647f,-0.356115f,-0.178435f,1.0f,
-			0.392736f,-0.371772f,-0.174643f,1.0f,
-			0.425031f,-0.371772f,-0.011080f,1.0f,
-			0.373399f,-0.385429f,-0.011080f,1.0f,
-			0.425031f,-0.371772f,-0.011080f,1.0f,
-			0.392736f,-0.371772f,-0.174643f,1.0f,
-			0.392736f,-0.371772f,-0.174643f,1.0f,
-			0.345105f,-0.385429f,-0.154378f,1.0f,
-			0.373399f,-0.385429f,-0.011080f,1.0f,
-			0.245818f,-0.395089f,-0.011080f,1.0f,
-			0.373399f,-0.385429f,-0.011080f,1.0f,
-			0.345105f,-0.385429f,-0.154378f,1.0f,
-			0.345105f,-0.385429f,-0.154378f,1.0f,
-			0.227411f,-0.395089f,-0.104302f,1.0f,
-			0.245818f,-0.395089f,-0.011080f,1.0f,
-			0.008310f,-0.398754f,-0.011080f,1.0f,
-			0.245818f,-0.395089f,-0.011080f,1.0f,
-			0.227411f,-0.395089f,-0.104302f,1.0f,
-			-0.583252f,0.185699f,0.036888f,1.0f,
-			-0.442055f,0.186855f,0.036888f,1.0f,
-			-0.446497f,0.176861f,-0.011080f,1.0f,
-			-0.446497f,0.176861f,-0.011080f,1.0f,
-			-0.579297f,0.175862f,-0.011080f,1.0f,
-			-0.583252f,0.185699f,0.036888f,1.0f,
-			-0.686891f,0.177611f,0.036888f,1.0f,
-			-0.583252f,0.185699f,0.036888f,1.0f,
-			-0.579297f,0.175862f,-0.011080f,1.0f,
-			-0.579297f,0.175862f,-0.011080f,1.0f,
-			-0.677453f,0.168867f,-0.011080f,1.0f,
-			-0.686891f,0.177611f,0.036888f,1.0f,
-			-0.750724f,0.155657f,0.036888f,1.0f,
-			-0.686891f,0.177611f,0.036888f,1.0f,
-			-0.677453f,0.168867f,-0.011080f,1.0f,
-			-0.677453f,0.168867f,-0.011080f,1.0f,
-			-0.738301f,0.149879f,-0.011080f,1.0f,
-			-0.750724f,0.155657f,0.036888f,1.0f,
-			-0.772501f,0.112904f,0.036888f,1.0f,
-			-0.750724f,0.155657f,0.036888f,1.0f,
-			-0.738301f,0.149879f,-0.011080f,1.0f,
-			-0.738301f,0.149879f,-0.011080f,1.0f,
-			-0.759176f,0.112904f,-0.011080f,1.0f,
-			-0.772501f,0.112904f,0.036888f,1.0f,
-			-0.591955f,0.207341f,0.052877f,1.0f,
-			-0.432284f,0.208840f,0.052877f,1.0f,
-			-0.442055f,0.186855f,0.036888f,1.0f,
-			-0.442055f,0.186855f,0.036888f,1.0f,
-			-0.583252f,0.185699f,0.036888f,1.0f,
-			-0.591955f,0.207341f,0.052877f,1.0f,
-			-0.707655f,0.196848f,0.052877f,1.0f,
-			-0.591955f,0.207341f,0.052877f,1.0f,
-			-0.583252f,0.185699f,0.036888f,1.0f,
-			-0.583252f,0.185699f,0.036888f,1.0f,
-			-0.686891f,0.177611f,0.036888f,1.0f,
-			-0.707655f,0.196848f,0.052877f,1.0f,
-			-0.778053f,0.168367f,0.052877f,1.0f,
-			-0.707655f,0.196848f,0.052877f,1.0f,
-			-0.686891f,0.177611f,0.036888f,1.0f,
-			-0.686891f,0.177611f,0.036888f,1.0f,
-			-0.750724f,0.155657f,0.036888f,1.0f,
-			-0.778053f,0.168367f,0.052877f,1.0f,
-			-0.801814f,0.112904f,0.052877f,1.0f,
-			-0.778053f,0.168367f,0.052877f,1.0f,
-			-0.750724f,0.155657f,0.036888f,1.0f,
-			-0.750724f,0.155657f,0.036888f,1.0f,
-			-0.772501f,0.112904f,0.036888f,1.0f,
-			-0.801814f,0.112904f,0.052877f,1.0f,
-			-0.600657f,0.228983f,0.036888f,1.0f,
-			-0.422513f,0.230825f,0.036888f,1.0f,
-			-0.432284f,0.208840f,0.052877f,1.0f,
-			-0.432284f,0.208840f,0.052877f,1.0f,
-			-0.591955f,0.207341f,0.052877f,1.0f,
-			-0.600657f,0.228983f,0.036888f,1.0f,
-			-0.728419f,0.216085f,0.036888f,1.0f,
-			-0.600657f,0.228983f,0.036888f,1.0f,
-			-0.591955f,0.207341f,0.052877f,1.0f,
-			-0.591955f,0.207341f,0.052877f,1.0f,
-			-0.707655f,0.196848f,0.052877f,1.0f,
-			-0.728419f,0.216085f,0.036888f,1.0f,
-			-0.805381f,0.181077f,0.036888f,1.0f,
-			-0.728419f,0.216085f,0.036888f,1.0f,
-			-0.707655f,0.196848f,0.052877f,1.0f,
-			-0.707655f,0.196848f,0.052877f,1.0f,
-			-0.778053f,0.168367f,0.052877f,1.0f,
-			-0.805381f,0.181077f,0.036888f,1.0f,
-			-0.831128f,0.112904f,0.036888f,1.0f,
-			-0.805381f,0.181077f,0.036888f,1.0f,
-			-0.778053f,0.168367f,0.052877f,1.0f,
-			-0.778053f,0.168367f,0.052877f,1.0f,
-			-0.801814f,0.112904f,0.052877f,1.0f,
-			-0.831128f,0.112904f,0.036888f,1.0f,
-			-0.604613f,0.238820f,-0.011080f,1.0f,
-			-0.418071f,0.240819f,-0.011080f,1.0f,
-			-0.422513f,0.230825f,0.036888f,1.0f,
-			-0.422513f,0.230825f,0.036888f,1.0f,
-			-0.600657f,0.228983f,0.036888f,1.0f,
-			-0.604613f,0.238820f,-0.011080f,1.0f,
-			-0.737857f,0.224829f,-0.011080f,1.0f,
-			-0.604613f,0.238820f,-0.011080f,1.0f,
-			-0.600657f,0.228983f,0.036888f,1.0f,
-			-0.600657f,0.228983f,0.036888f,1.0f,
-			-0.728419f,0.216085f,0.036888f,1.0f,
-			-0.737857f,0.224829f,-0.011080f,1.0f,
-			-0.817804f,0.186855f,-0.011080f,1.0f,
-			-0.737857f,0.224829f,-0.011080f,1.0f,
-			-0.728419f,0.216085f,0.036888f,1.0f,
-			-0.728419f,0.216085f,0.036888f,1.0f,
-			-0.805381f,0.181077f,0.036888f,1.0f,
-			-0.817804f,0.186855f,-0.011080f,1.0f,
-			-0.844453f,0.112904f,-0.011080f,1.0f,
-			-0.817804f,0.186855f,-0.011080f,1.0f,
-			-0.805381f,0.181077f,0.036888f,1.0f,
-			-0.805381f,0.181077f,0.036888f,1.0f,
-			-0.831128f,0.112904f,0.036888f,1.0f,
-			-0.844453f,0.112904f,-0.011080f,1.0f,
-			-0.600657f,0.228983f,-0.059048f,1.0f,
-			-0.422513f,0.230825f,-0.059048f,1.0f,
-			-0.418071f,0.240819f,-0.011080f,1.0f,
-			-0.418071f,0.240819f,-0.011080f,1.0f,
-			-0.604613f,0.238820f,-0.011080f,1.0f,
-			-0.600657f,0.228983f,-0.059048f,1.0f,
-			-0.728419f,0.216085f,-0.059048f,1.0f,
-			-0.600657f,0.228983f,-0.059048f,1.0f,
-			-0.604613f,0.238820f,-0.011080f,1.0f,
-			-0.604613f,0.238820f,-0.011080f,1.0f,
-			-0.737857f,0.224829f,-0.011080f,1.0f,
-			-0.728419f,0.216085f,-0.059048f,1.0f,
-			-0.805381f,0.181077f,-0.059048f,1.0f,
-			-0.728419f,0.216085f,-0.059048f,1.0f,
-			-0.737857f,0.224829f,-0.011080f,1.0f,
-			-0.737857f,0.224829f,-0.011080f,1.0f,
-			-0.817804f,0.186855f,-0.011080f,1.0f,
-			-0.805381f,0.181077f,-0.059048f,1.0f,
-			-0.831128f,0.112904f,-0.059048f,1.0f,
-			-0.805381f,0.181077f,-0.059048f,1.0f,
-			-0.817804f,0.186855f,-0.011080f,1.0f,
-			-0.817804f,0.186855f,-0.011080f,1.0f,
-			-0.844453f,0.112904f,-0.011080f,1.0f,
-			-0.831128f,0.112904f,-0.059048f,1.0f,
-			-0.591955f,0.207341f,-0.075038f,1.0f,
-			-0.432284f,0.208840f,-0.075038f,1.0f,
-			-0.422513f,0.230825f,-0.059048f,1.0f,
-			-0.422513f,0.230825f,-0.059048f,1.0f,
-			-0.600657f,0.228983f,-0.059048f,1.0f,
-			-0.591955f,0.207341f,-0.075038f,1.0f,
-			-0.707655f,0.196848f,-0.075038f,1.0f,
-			-0.591955f,0.207341f,-0.075038f,1.0f,
-			-0.600657f,0.228983f,-0.059048f,1.0f,
-			-0.600657f,0.228983f,-0.059048f,1.0f,
-			-0.728419f,0.216085f,-0.059048f,1.0f,
-			-0.707655f,0.196848f,-0.075038f,1.0f,
-			-0.778053f,0.168367f,-0.075038f,1.0f,
-			-0.707655f,0.196848f,-0.075038f,1.0f,
-			-0.728419f,0.216085f,-0.059048f,1.0f,
-			-0.728419f,0.216085f,-0.059048f,1.0f,
-			-0.805381f,0.181077f,-0.059048f,1.0f,
-			-0.778053f,0.168367f,-0.075038f,1.0f,
-			-0.801814f,0.112904f,-0.075038f,1.0f,
-			-0.778053f,0.168367f,-0.075038f,1.0f,
-			-0.805381f,0.181077f,-0.059048f,1.0f,
-			-0.805381f,0.181077f,-0.059048f,1.0f,
-			-0.831128f,0.112904f,-0.059048f,1.0f,
-			-0.801814f,0.112904f,-0.075038f,1.0f,
-			-0.583252f,0.185699f,-0.059048f,1.0f,
-			-0.442055f,0.186855f,-0.059048f,1.0f,
-			-0.432284f,0.208840f,-0.075038f,1.0f,
-			-0.432284f,0.208840f,-0.075038f,1.0f,
-			-0.591955f,0.207341f,-0.075038f,1.0f,
-			-0.583252f,0.185699f,-0.059048f,1.0f,
-			-0.686891f,0.177611f,-0.059048f,1.0f,
-			-0.583252f,0.185699f,-0.059048f,1.0f,
-			-0.591955f,0.207341f,-0.075038f,1.0f,
-			-0.591955f,0.207341f,-0.075038f,1.0f,
-			-0.707655f,0.196848f,-0.075038f,1.0f,
-			-0.686891f,0.177611f,-0.059048f,1.0f,
-			-0.750724f,0.155657f,-0.059048f,1.0f,
-			-0.686891f,0.177611f,-0.059048f,1.0f,
-			-0.707655f,0.196848f,-0.075038f,1.0f,
-			-0.707655f,0.196848f,-0.075038f,1.0f,
-			-0.778053f,0.168367f,-0.075038f,1.0f,
-			-0.750724f,0.155657f,-0.059048f,1.0f,
-			-0.772501f,0.112904f,-0.059048f,1.0f,
-			-0.750724f,0.155657f,-0.059048f,1.0f,
-			-0.778053f,0.168367f,-0.075038f,1.0f,
-			-0.778053f,0.168367f,-0.075038f,1.0f,
-			-0.801814f,0.112904f,-0.075038f,1.0f,
-			-0.772501f,0.112904f,-0.059048f,1.0f,
-			-0.579297f,0.175862f,-0.011080f,1.0f,
-			-0.446497f,0.176861f,-0.011080f,1.0f,
-			-0.442055f,0.186855f,-0.059048f,1.0f,
-			-0.442055f,0.186855f,-0.059048f,1.0f,
-			-0.583252f,0.185699f,-0.059048f,1.0f,
-			-0.579297f,0.175862f,-0.011080f,1.0f,
-			-0.677453f,0.168867f,-0.011080f,1.0f,
-			-0.579297f,0.175862f,-0.011080f,1.0f,
-			-0.583252f,0.185699f,-0.059048f,1.0f,
-			-0.583252f,0.185699f,-0.059048f,1.0f,
-			-0.686891f,0.177611f,-0.059048f,1.0f,
-			-0.677453f,0.168867f,-0.011080f,1.0f,
-			-0.738301f,0.149879f,-0.011080f,1.0f,
-			-0.677453f,0.168867f,-0.011080f,1.0f,
-			-0.686891f,0.177611f,-0.059048f,1.0f,
-			-0.686891f,0.177611f,-0.059048f,1.0f,
-			-0.750724f,0.155657f,-0.059048f,1.0f,
-			-0.738301f,0.149879f,-0.011080f,1.0f,
-			-0.759176f,0.112904f,-0.011080f,1.0f,
-			-0.738301f,0.149879f,-0.011080f,1.0f,
-			-0.750724f,0.155657f,-0.059048f,1.0f,
-			-0.750724f,0.155657f,-0.059048f,1.0f,
-			-0.772501f,0.112904f,-0.059048f,1.0f,
-			-0.759176f,0.112904f,-0.011080f,1.0f,
-			-0.760183f,0.049348f,0.036888f,1.0f,
-			-0.772501f,0.112904f,0.036888f,1.0f,
-			-0.759176f,0.112904f,-0.011080f,1.0f,
-			-0.759176f,0.112904f,-0.011080f,1.0f,
-			-0.748073f,0.054943f,-0.011080f,1.0f,
-			-0.760183f,0.049348f,0.036888f,1.0f,
-			-0.721590f,-0.023546f,0.036888f,1.0f,
-			-0.760183f,0.049348f,0.036888f,1.0f,
-			-0.748073f,0.054943f,-0.011080f,1.0f,
-			-0.748073f,0.054943f,-0.011080f,1.0f,
-			-0.712985f,-0.015010f,-0.011080f,1.0f,
-			-0.721590f,-0.023546f,0.036888f,1.0f,
-			-0.654267f,-0.095503f,0.036888f,1.0f,
-			-0.721590f,-0.023546f,0.036888f,1.0f,
-			-0.712985f,-0.015010f,-0.011080f,1.0f,
-			-0.712985f,-0.015010f,-0.011080f,1.0f,
-			-0.651248f,-0.084963f,-0.011080f,1.0f,
-			-0.654267f,-0.095503f,0.036888f,1.0f,
-			-0.555757f,-0.156249f,0.036888f,1.0f,
-			-0.654267f,-0.095503f,0.036888f,1.0f,
-			-0.651248f,-0.084963f,-0.011080f,1.0f,
-			-0.651248f,-0.084963f,-0.011080f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.555757f,-0.156249f,0.036888f,1.0f,
-			-0.786824f,0.037038f,0.052877f,1.0f,
-			-0.801814f,0.112904f,0.052877f,1.0f,
-			-0.772501f,0.112904f,0.036888f,1.0f,
-			-0.772501f,0.112904f,0.036888f,1.0f,
-			-0.760183f,0.049348f,0.036888f,1.0f,
-			-0.786824f,0.037038f,0.052877f,1.0f,
-			-0.740522f,-0.042325f,0.052877f,1.0f,
-			-0.786824f,0.037038f,0.052877f,1.0f,
-			-0.760183f,0.049348f,0.036888f,1.0f,
-			-0.760183f,0.049348f,0.036888f,1.0f,
-			-0.721590f,-0.023546f,0.036888f,1.0f,
-			-0.740522f,-0.042325f,0.052877f,1.0f,
-			-0.660909f,-0.118691f,0.052877f,1.0f,
-			-0.740522f,-0.042325f,0.052877f,1.0f,
-			-0.721590f,-0.023546f,0.036888f,1.0f,
-			-0.721590f,-0.023546f,0.036888f,1.0f,
-			-0.654267f,-0.095503f,0.036888f,1.0f,
-			-0.660909f,-0.118691f,0.052877f,1.0f,
-			-0.545986f,-0.185563f,0.052877f,1.0f,
-			-0.660909f,-0.118691f,0.052877f,1.0f,
-			-0.654267f,-0.095503f,0.036888f,1.0f,
-			-0.654267f,-0.095503f,0.036888f,1.0f,
-			-0.555757f,-0.156249f,0.036888f,1.0f,
-			-0.545986f,-0.185563f,0.052877f,1.0f,
-			-0.813466f,0.024729f,0.036888f,1.0f,
-			-0.831128f,0.112904f,0.036888f,1.0f,
-			-0.801814f,0.112904f,0.052877f,1.0f,
-			-0.801814f,0.112904f,0.052877f,1.0f,
-			-0.786824f,0.037038f,0.052877f,1.0f,
-			-0.813466f,0.024729f,0.036888f,1.0f,
-			-0.759454f,-0.061104f,0.036888f,1.0f,
-			-0.813466f,0.024729f,0.036888f,1.0f,
-			-0.786824f,0.037038f,0.052877f,1.0f,
-			-0.786824f,0.037038f,0.052877f,1.0f,
-			-0.740522f,-0.042325f,0.052877f,1.0f,
-			-0.759454f,-0.061104f,0.036888f,1.0f,
-			-0.667550f,-0.141878f,0.036888f,1.0f,
-			-0.759454f,-0.061104f,0.036888f,1.0f,
-			-0.740522f,-0.042325f,0.052877f,1.0f,
-			-0.740522f,-0.042325f,0.052877f,1.0f,
-			-0.660909f,-0.118691f,0.052877f,1.0f,
-			-0.667550f,-0.141878f,0.036888f,1.0f,
-			-0.536214f,-0.214877f,0.036888f,1.0f,
-			-0.667550f,-0.141878f,0.036888f,1.0f,
-			-0.660909f,-0.118691f,0.052877f,1.0f,
-			-0.660909f,-0.118691f,0.052877f,1.0f,
-			-0.545986f,-0.185563f,0.052877f,1.0f,
-			-0.536214f,-0.214877f,0.036888f,1.0f,
-			-0.825576f,0.019134f,-0.011080f,1.0f,
-			-0.844453f,0.112904f,-0.011080f,1.0f,
-			-0.831128f,0.112904f,0.036888f,1.0f,
-			-0.831128f,0.112904f,0.036888f,1.0f,
-			-0.813466f,0.024729f,0.036888f,1.0f,
-			-0.825576f,0.019134f,-0.011080f,1.0f,
-			-0.768059f,-0.069640f,-0.011080f,1.0f,
-			-0.825576f,0.019134f,-0.011080f,1.0f,
-			-0.813466f,0.024729f,0.036888f,1.0f,
-			-0.813466f,0.024729f,0.036888f,1.0f,
-			-0.759454f,-0.061104f,0.036888f,1.0f,
-			-0.768059f,-0.069640f,-0.011080f,1.0f,
-			-0.670569f,-0.152418f,-0.011080f,1.0f,
-			-0.768059f,-0.069640f,-0.011080f,1.0f,
-			-0.759454f,-0.061104f,0.036888f,1.0f,
-			-0.759454f,-0.061104f,0.036888f,1.0f,
-			-0.667550f,-0.141878f,0.036888f,1.0f,
-			-0.670569f,-0.152418f,-0.011080f,1.0f,
-			-0.531773f,-0.228201f,-0.011080f,1.0f,
-			-0.670569f,-0.152418f,-0.011080f,1.0f,
-			-0.667550f,-0.141878f,0.036888f,1.0f,
-			-0.667550f,-0.141878f,0.036888f,1.0f,
-			-0.536214f,-0.214877f,0.036888f,1.0f,
-			-0.531773f,-0.228201f,-0.011080f,1.0f,
-			-0.813466f,0.024729f,-0.059048f,1.0f,
-			-0.831128f,0.112904f,-0.059048f,1.0f,
-			-0.844453f,0.112904f,-0.011080f,1.0f,
-			-0.844453f,0.112904f,-0.011080f,1.0f,
-			-0.825576f,0.019134f,-0.011080f,1.0f,
-			-0.813466f,0.024729f,-0.059048f,1.0f,
-			-0.759454f,-0.061104f,-0.059048f,1.0f,
-			-0.813466f,0.024729f,-0.059048f,1.0f,
-			-0.825576f,0.019134f,-0.011080f,1.0f,
-			-0.825576f,0.019134f,-0.011080f,1.0f,
-			-0.768059f,-0.069640f,-0.011080f,1.0f,
-			-0.759454f,-0.061104f,-0.059048f,1.0f,
-			-0.667550f,-0.141878f,-0.059048f,1.0f,
-			-0.759454f,-0.061104f,-0.059048f,1.0f,
-			-0.768059f,-0.069640f,-0.011080f,1.0f,
-			-0.768059f,-0.069640f,-0.011080f,1.0f,
-			-0.670569f,-0.152418f,-0.011080f,1.0f,
-			-0.667550f,-0.141878f,-0.059048f,1.0f,
-			-0.536214f,-0.214877f,-0.059048f,1.0f,
-			-0.667550f,-0.141878f,-0.059048f,1.0f,
-			-0.670569f,-0.152418f,-0.011080f,1.0f,
-			-0.670569f,-0.152418f,-0.011080f,1.0f,
-			-0.531773f,-0.228201f,-0.011080f,1.0f,
-			-0.536214f,-0.214877f,-0.059048f,1.0f,
-			-0.786824f,0.037038f,-0.075038f,1.0f,
-			-0.801814f,0.112904f,-0.075038f,1.0f,
-			-0.831128f,0.112904f,-0.059048f,1.0f,
-			-0.831128f,0.112904f,-0.059048f,1.0f,
-			-0.813466f,0.024729f,-0.059048f,1.0f,
-			-0.786824f,0.037038f,-0.075038f,1.0f,
-			-0.740522f,-0.042325f,-0.075038f,1.0f,
-			-0.786824f,0.037038f,-0.075038f,1.0f,
-			-0.813466f,0.024729f,-0.059048f,1.0f,
-			-0.813466f,0.024729f,-0.059048f,1.0f,
-			-0.759454f,-0.061104f,-0.059048f,1.0f,
-			-0.740522f,-0.042325f,-0.075038f,1.0f,
-			-0.660909f,-0.118691f,-0.075038f,1.0f,
-			-0.740522f,-0.042325f,-0.075038f,1.0f,
-			-0.759454f,-0.061104f,-0.059048f,1.0f,
-			-0.759454f,-0.061104f,-0.059048f,1.0f,
-			-0.667550f,-0.141878f,-0.059048f,1.0f,
-			-0.660909f,-0.118691f,-0.075038f,1.0f,
-			-0.545986f,-0.185563f,-0.075038f,1.0f,
-			-0.660909f,-0.118691f,-0.075038f,1.0f,
-			-0.667550f,-0.141878f,-0.059048f,1.0f,
-			-0.667550f,-0.141878f,-0.059048f,1.0f,
-			-0.536214f,-0.214877f,-0.059048f,1.0f,
-			-0.545986f,-0.185563f,-0.075038f,1.0f,
-			-0.760183f,0.049348f,-0.059048f,1.0f,
-			-0.772501f,0.112904f,-0.059048f,1.0f,
-			-0.801814f,0.112904f,-0.075038f,1.0f,
-			-0.801814f,0.112904f,-0.075038f,1.0f,
-			-0.786824f,0.037038f,-0.075038f,1.0f,
-			-0.760183f,0.049348f,-0.059048f,1.0f,
-			-0.721590f,-0.023546f,-0.059048f,1.0f,
-			-0.760183f,0.049348f,-0.059048f,1.0f,
-			-0.786824f,0.037038f,-0.075038f,1.0f,
-			-0.786824f,0.037038f,-0.075038f,1.0f,
-			-0.740522f,-0.042325f,-0.075038f,1.0f,
-			-0.721590f,-0.023546f,-0.059048f,1.0f,
-			-0.654267f,-0.095503f,-0.059048f,1.0f,
-			-0.721590f,-0.023546f,-0.059048f,1.0f,
-			-0.740522f,-0.042325f,-0.075038f,1.0f,
-			-0.740522f,-0.042325f,-0.075038f,1.0f,
-			-0.660909f,-0.118691f,-0.075038f,1.0f,
-			-0.654267f,-0.095503f,-0.059048f,1.0f,
-			-0.555757f,-0.156249f,-0.059048f,1.0f,
-			-0.654267f,-0.095503f,-0.059048f,1.0f,
-			-0.660909f,-0.118691f,-0.075038f,1.0f,
-			-0.660909f,-0.118691f,-0.075038f,1.0f,
-			-0.545986f,-0.185563f,-0.075038f,1.0f,
-			-0.555757f,-0.156249f,-0.059048f,1.0f,
-			-0.748073f,0.054943f,-0.011080f,1.0f,
-			-0.759176f,0.112904f,-0.011080f,1.0f,
-			-0.772501f,0.112904f,-0.059048f,1.0f,
-			-0.772501f,0.112904f,-0.059048f,1.0f,
-			-0.760183f,0.049348f,-0.059048f,1.0f,
-			-0.748073f,0.054943f,-0.011080f,1.0f,
-			-0.712985f,-0.015010f,-0.011080f,1.0f,
-			-0.748073f,0.054943f,-0.011080f,1.0f,
-			-0.760183f,0.049348f,-0.059048f,1.0f,
-			-0.760183f,0.049348f,-0.059048f,1.0f,
-			-0.721590f,-0.023546f,-0.059048f,1.0f,
-			-0.712985f,-0.015010f,-0.011080f,1.0f,
-			-0.651248f,-0.084963f,-0.011080f,1.0f,
-			-0.712985f,-0.015010f,-0.011080f,1.0f,
-			-0.721590f,-0.023546f,-0.059048f,1.0f,
-			-0.721590f,-0.023546f,-0.059048f,1.0f,
-			-0.654267f,-0.095503f,-0.059048f,1.0f,
-			-0.651248f,-0.084963f,-0.011080f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			-0.651248f,-0.084963f,-0.011080f,1.0f,
-			-0.654267f,-0.095503f,-0.059048f,1.0f,
-			-0.654267f,-0.095503f,-0.059048f,1.0f,
-			-0.555757f,-0.156249f,-0.059048f,1.0f,
-			-0.560198f,-0.142925f,-0.011080f,1.0f,
-			0.638305f,0.010452f,0.084206f,1.0f,
-			0.491543f,-0.030333f,0.094449f,1.0f,
-			0.491543f,0.006309f,-0.011080f,1.0f,
-			0.491543f,0.006309f,-0.011080f,1.0f,
-			0.627896f,0.037621f,-0.011080f,1.0f,
-			0.638305f,0.010452f,0.084206f,1.0f,
-			0.700292f,0.097081f,0.061671f,1.0f,
-			0.638305f,0.010452f,0.084206f,1.0f,
-			0.627896f,0.037621f,-0.011080f,1.0f,
-			0.627896f,0.037621f,-0.011080f,1.0f,
-			0.686967f,0.112904f,-0.011080f,1.0f,
-			0.700292f,0.097081f,0.061671f,1.0f,
-			0.735629f,0.198451f,0.039136f,1.0f,
-			0.700292f,0.097081f,0.061671f,1.0f,
-			0.686967f,0.112904f,-0.011080f,1.0f,
-			0.686967f,0.112904f,-0.011080f,1.0f,
-			0.719390f,0.204176f,-0.011080f,1.0f,
-			0.735629f,0.198451f,0.039136f,1.0f,
-			0.802446f,0.283457f,0.028893f,1.0f,
-			0.735629f,0.198451f,0.039136f,1.0f,
-			0.719390f,0.204176f,-0.011080f,1.0f,
-			0.719390f,0.204176f,-0.011080f,1.0f,
-			0.775797f,0.283457f,-0.011080f,1.0f,
-			0.802446f,0.283457f,0.028893f,1.0f,
-			0.661207f,-0.049321f,0.115968f,1.0f,
-			0.491543f,-0.110946f,0.129626f,1.0f,
-			0.491543f,-0.030333f,0.094449f,1.0f,
-			0.491543f,-0.030333f,0.094449f,1.0f,
-			0.638305f,0.010452f,0.084206f,1.0f,
-			0.661207f,-0.049321f,0.115968f,1.0f,
-			0.729605f,0.062271f,0.085921f,1.0f,
-			0.661207f,-0.049321f,0.115968f,1.0f,
-			0.638305f,0.010452f,0.084206f,1.0f,
-			0.638305f,0.010452f,0.084206f,1.0f,
-			0.700292f,0.097081f,0.061671f,1.0f,
-			0.729605f,0.062271f,0.085921f,1.0f,
-			0.771355f,0.185855f,0.055875f,1.0f,
-			0.729605f,0.062271f,0.085921f,1.0f,
-			0.700292f,0.097081f,0.061671f,1.0f,
-			0.700292f,0.097081f,0.061671f,1.0f,
-			0.735629f,0.198451f,0.039136f,1.0f,
-			0.771355f,0.185855f,0.055875f,1.0f,
-			0.861073f,0.283457f,0.042217f,1.0f,
-			0.771355f,0.185855f,0.055875f,1.0f,
-			0.735629f,0.198451f,0.039136f,1.0f,
-			0.735629f,0.198451f,0.039136f,1.0f,
-			0.802446f,0.283457f,0.028893f,1.0f,
-			0.861073f,0.283457f,0.042217f,1.0f,
-			0.684108f,-0.109093f,0.084206f,1.0f,
-			0.491543f,-0.191559f,0.094449f,1.0f,
-			0.491543f,-0.110946f,0.129626f,1.0f,
-			0.491543f,-0.110946f,0.129626f,1.0f,
-			0.661207f,-0.049321f,0.115968f,1.0f,
-			0.684108f,-0.109093f,0.084206f,1.0f,
-			0.758919f,0.027461f,0.061671f,1.0f,
-			0.684108f,-0.109093f,0.084206f,1.0f,
-			0.661207f,-0.049321f,0.115968f,1.0f,
-			0.661207f,-0.049321f,0.115968f,1.0f,
-			0.729605f,0.062271f,0.085921f,1.0f,
-			0.758919f,0.027461f,0.061671f,1.0f,
-			0.807081f,0.173260f,0.039136f,1.0f,
-			0.758919f,0.027461f,0.061671f,1.0f,
-			0.729605f,0.062271f,0.085921f,1.0f,
-			0.729605f,0.062271f,0.085921f,1.0f,
-			0.771355f,0.185855f,0.055875f,1.0f,
-			0.807081f,0.173260f,0.039136f,1.0f,
-			0.919700f,0.283457f,0.028893f,1.0f,
-			0.807081f,0.173260f,0.039136f,1.0f,
-			0.771355f,0.185855f,0.055875f,1.0f,
-			0.771355f,0.185855f,0.055875f,1.0f,
-			0.861073f,0.283457f,0.042217f,1.0f,
-			0.919700f,0.283457f,0.028893f,1.0f,
-			0.694518f,-0.136262f,-0.011080f,1.0f,
-			0.491543f,-0.228201f,-0.011080f,1.0f,
-			0.491543f,-0.191559f,0.094449f,1.0f,
-			0.491543f,-0.191559f,0.094449f,1.0f,
-			0.684108f,-0.109093f,0.084206f,1.0f,
-			0.694518f,-0.136262f,-0.011080f,1.0f,
-			0.772244f,0.011639f,-0.011080f,1.0f,
-			0.694518f,-0.136262f,-0.011080f,1.0f,
-			0.684108f,-0.109093f,0.084206f,1.0f,
-			0.684108f,-0.109093f,0.084206f,1.0f,
-			0.758919f,0.027461f,0.061671f,1.0f,
-			0.772244f,0.011639f,-0.011080f,1.0f,
-			0.823321f,0.167534f,-0.011080f,1.0f,
-			0.772244f,0.011639f,-0.011080f,1.0f,
-			0.758919f,0.027461f,0.061671f,1.0f,
-			0.758919f,0.027461f,0.061671f,1.0f,
-			0.807081f,0.173260f,0.039136f,1.0f,
-			0.823321f,0.167534f,-0.011080f,1.0f,
-			0.946349f,0.283457f,-0.011080f,1.0f,
-			0.823321f,0.167534f,-0.011080f,1.0f,
-			0.807081f,0.173260f,0.039136f,1.0f,
-			0.807081f,0.173260f,0.039136f,1.0f,
-			0.919700f,0.283457f,0.028893f,1.0f,
-			0.946349f,0.283457f,-0.011080f,1.0f,
-			0.684108f,-0.109093f,-0.106367f,1.0f,
-			0.491543f,-0.191559f,-0.116610f,1.0f,
-			0.491543f,-0.228201f,-0.011080f,1.0f,
-			0.491543f,-0.228201f,-0.011080f,1.0f,
-			0.694518f,-0.136262f,-0.011080f,1.0f,
-			0.684108f,-0.109093f,-0.106367f,1.0f,
-			0.758919f,0.027461f,-0.083832f,1.0f,
-			0.684108f,-0.109093f,-0.106367f,1.0f,
-			0.694518f,-0.136262f,-0.011080f,1.0f,
-			0.694518f,-0.136262f,-0.011080f,1.0f,
-			0.772244f,0.011639f,-0.011080f,1.0f,
-			0.758919f,0.027461f,-0.083832f,1.0f,
-			0.807081f,0.173260f,-0.061297f,1.0f,
-			0.758919f,0.027461f,-0.083832f,1.0f,
-			0.772244f,0.011639f,-0.011080f,1.0f,
-			0.772244f,0.011639f,-0.011080f,1.0f,
-			0.823321f,0.167534f,-0.011080f,1.0f,
-			0.807081f,0.173260f,-0.061297f,1.0f,
-			0.919700f,0.283457f,-0.051054f,1.0f,
-			0.807081f,0.173260f,-0.061297f,1.0f,
-			0.823321f,0.167534f,-0.011080f,1.0f,
-			0.823321f,0.167534f,-0.011080f,1.0f,
-			0.946349f,0.283457f,-0.011080f,1.0f,
-			0.919700f,0.283457f,-0.051054f,1.0f,
-			0.661207f,-0.049321f,-0.138129f,1.0f,
-			0.491543f,-0.110946f,-0.151786f,1.0f,
-			0.491543f,-0.191559f,-0.116610f,1.0f,
-			0.491543f,-0.191559f,-0.116610f,1.0f,
-			0.684108f,-0.109093f,-0.106367f,1.0f,
-			0.661207f,-0.049321f,-0.138129f,1.0f,
-			0.729605f,0.062271f,-0.108082f,1.0f,
-			0.661207f,-0.049321f,-0.138129f,1.0f,
-			0.684108f,-0.109093f,-0.106367f,1.0f,
-			0.684108f,-0.109093f,-0.106367f,1.0f,
-			0.758919f,0.027461f,-0.083832f,1.0f,
-			0.729605f,0.062271f,-0.108082f,1.0f,
-			0.771355f,0.185855f,-0.078036f,1.0f,
-			0.729605f,0.062271f,-0.108082f,1.0f,
-			0.758919f,0.027461f,-0.083832f,1.0f,
-			0.758919f,0.027461f,-0.083832f,1.0f,
-			0.807081f,0.173260f,-0.061297f,1.0f,
-			0.771355f,0.185855f,-0.078036f,1.0f,
-			0.861073f,0.283457f,-0.064378f,1.0f,
-			0.771355f,0.185855f,-0.078036f,1.0f,
-			0.807081f,0.173260f,-0.061297f,1.0f,
-			0.807081f,0.173260f,-0.061297f,1.0f,
-			0.919700f,0.283457f,-0.051054f,1.0f,
-			0.861073f,0.283457f,-0.064378f,1.0f,
-			0.638305f,0.010452f,-0.106367f,1.0f,
-			0.491543f,-0.030333f,-0.116610f,1.0f,
-			0.491543f,-0.110946f,-0.151786f,1.0f,
-			0.491543f,-0.110946f,-0.151786f,1.0f,
-			0.661207f,-0.049321f,-0.138129f,1.0f,
-			0.638305f,0.010452f,-0.106367f,1.0f,
-			0.700292f,0.097081f,-0.083832f,1.0f,
-			0.638305f,0.010452f,-0.106367f,1.0f,
-			0.661207f,-0.049321f,-0.138129f,1.0f,
-			0.661207f,-0.049321f,-0.138129f,1.0f,
-			0.729605f,0.062271f,-0.108082f,1.0f,
-			0.700292f,0.097081f,-0.083832f,1.0f,
-			0.735629f,0.198451f,-0.061297f,1.0f,
-			0.700292f,0.097081f,-0.083832f,1.0f,
-			0.729605f,0.062271f,-0.108082f,1.0f,
-			0.729605f,0.062271f,-0.108082f,1.0f,
-			0.771355f,0.185855f,-0.078036f,1.0f,
-			0.735629f,0.198451f,-0.061297f,1.0f,
-			0.802446f,0.283457f,-0.051054f,1.0f,
-			0.735629f,0.198451f,-0.061297f,1.0f,
-			0.771355f,0.185855f,-0.078036f,1.0f,
-			0.771355f,0.185855f,-0.078036f,1.0f,
-			0.861073f,0.283457f,-0.064378f,1.0f,
-			0.802446f,0.283457f,-0.051054f,1.0f,
-			0.627896f,0.037621f,-0.011080f,1.0f,
-			0.491543f,0.006309f,-0.011080f,1.0f,
-			0.491543f,-0.030333f,-0.116610f,1.0f,
-			0.491543f,-0.030333f,-0.116610f,1.0f,
-			0.638305f,0.010452f,-0.106367f,1.0f,
-			0.627896f,0.037621f,-0.011080f,1.0f,
-			0.686967f,0.112904f,-0.011080f,1.0f,
-			0.627896f,0.037621f,-0.011080f,1.0f,
-			0.638305f,0.010452f,-0.106367f,1.0f,
-			0.638305f,0.010452f,-0.106367f,1.0f,
-			0.700292f,0.097081f,-0.083832f,1.0f,
-			0.686967f,0.112904f,-0.011080f,1.0f,
-			0.719390f,0.204176f,-0.011080f,1.0f,
-			0.686967f,0.112904f,-0.011080f,1.0f,
-			0.700292f,0.097081f,-0.083832f,1.0f,
-			0.700292f,0.097081f,-0.083832f,1.0f,
-			0.735629f,0.198451f,-0.061297f,1.0f,
-			0.719390f,0.204176f,-0.011080f,1.0f,
-			0.775797f,0.283457f,-0.011080f,1.0f,
-			0.719390f,0.204176f,-0.011080f,1.0f,
-			0.735629f,0.198451f,-0.061297f,1.0f,
-			0.735629f,0.198451f,-0.061297f,1.0f,
-			0.802446f,0.283457f,-0.051054f,1.0f,
-			0.775797f,0.283457f,-0.011080f,1.0f,
-			0.824767f,0.296034f,0.026395f,1.0f,
-			0.802446f,0.283457f,0.028893f,1.0f,
-			0.775797f,0.283457f,-0.011080f,1.0f,
-			0.775797f,0.283457f,-0.011080f,1.0f,
-			0.796227f,0.295449f,-0.011080f,1.0f,
-			0.824767f,0.296034f,0.026395f,1.0f,
-			0.838116f,0.300383f,0.020898f,1.0f,
-			0.824767f,0.296034f,0.026395f,1.0f,
-			0.796227f,0.295449f,-0.011080f,1.0f,
-			0.796227f,0.295449f,-0.011080f,1.0f,
-			0.811329f,0.299446f,-0.011080f,1.0f,
-			0.838116f,0.300383f,0.020898f,1.0f,
-			0.838515f,0.296268f,0.015402f,1.0f,
-			0.838116f,0.300383f,0.020898f,1.0f,
-			0.811329f,0.299446f,-0.011080f,1.0f,
-			0.811329f,0.299446f,-0.011080f,1.0f,
-			0.815770f,0.295449f,-0.011080f,1.0f,
-			0.838515f,0.296268f,0.015402f,1.0f,
-			0.821988f,0.283457f,0.012904f,1.0f,
-			0.838515f,0.296268f,0.015402f,1.0f,
-			0.815770f,0.295449f,-0.011080f,1.0f,
-			0.815770f,0.295449f,-0.011080f,1.0f,
-			0.804222f,0.283457f,-0.011080f,1.0f,
-			0.821988f,0.283457f,0.012904f,1.0f,
-			0.887555f,0.297322f,0.038886f,1.0f,
-			0.861073f,0.283457f,0.042217f,1.0f,
-			0.802446f,0.283457f,0.028893f,1.0f,
-			0.802446f,0.283457f,0.028893f,1.0f,
-			0.824767f,0.296034f,0.026395f,1.0f,
-			0.887555f,0.297322f,0.038886f,1.0f,
-			0.897049f,0.302444f,0.031558f,1.0f,
-			0.887555f,0.297322f,0.038886f,1.0f,
-			0.824767f,0.296034f,0.026395f,1.0f,
-			0.824767f,0.296034f,0.026395f,1.0f,
-			0.838116f,0.300383f,0.020898f,1.0f,
-			0.897049f,0.302444f,0.031558f,1.0f,
-			0.888555f,0.298072f,0.024229f,1.0f,
-			0.897049f,0.302444f,0.031558f,1.0f,
-			0.838116f,0.300383f,0.020898f,1.0f,
-			0.838116f,0.300383f,0.020898f,1.0f,
-			0.838515f,0.296268f,0.015402f,1.0f,
-			0.888555f,0.298072f,0.024229f,1.0f,
-			0.861073f,0.283457f,0.020898f,1.0f,
-			0.888555f,0.298072f,0.024229f,1.0f,
-			0.838515f,0.296268f,0.015402f,1.0f,
-			0.838515f,0.296268f,0.015402f,1.0f,
-			0.821988f,0.283457f,0.012904f,1.0f,
-			0.861073f,0.283457f,0.020898f,1.0f,
-			0.950343f,0.298611f,0.026395f,1.0f,
-			0.919700f,0.283457f,0.028893f,1.0f,
-			0.861073f,0.283457f,0.042217f,1.0f,
-			0.861073f,0.283457f,0.042217f,1.0f,
-			0.887555f,0.297322f,0.038886f,1.0f,
-			0.950343f,0.298611f,0.026395f,1.0f,
-			0.955982f,0.304505f,0.020898f,1.0f,
-			0.950343f,0.298611f,0.026395f,1.0f,
-			0.887555f,0.297322f,0.038886f,1.0f,
-			0.887555f,0.297322f,0.038886f,1.0f,
-			0.897049f,0.302444f,0.031558f,1.0f,
-			0.955982f,0.304505f,0.020898f,1.0f,
-			0.938594f,0.299875f,0.015402f,1.0f,
-			0.955982f,0.304505f,0.020898f,1.0f,
-			0.897049f,0.302444f,0.031558f,1.0f,
-			0.897049f,0.302444f,0.031558f,1.0f,
-			0.888555f,0.298072f,0.024229f,1.0f,
-			0.938594f,0.299875f,0.015402f,1.0f,
-			0.900158f,0.283457f,0.012904f,1.0f,
-			0.938594f,0.299875f,0.015402f,1.0f,
-			0.888555f,0.298072f,0.024229f,1.0f,
-			0.888555f,0.298072f,0.024229f,1.0f,
-			0.861073f,0.283457f,0.020898f,1.0f,
-			0.900158f,0.283457f,0.012904f,1.0f,
-			0.978883f,0.299196f,-0.011080f,1.0f,
-			0.946349f,0.283457f,-0.011080f,1.0f,
-			0.919700f,0.283457f,0.028893f,1.0f,
-			0.919700f,0.283457f,0.028893f,1.0f,
-			0.950343f,0.298611f,0.026395f,1.0f,
-			0.978883f,0.299196f,-0.011080f,1.0f,
-			0.982769f,0.305442f,-0.011080f,1.0f,
-			0.978883f,0.299196f,-0.011080f,1.0f,
-			0.950343f,0.298611f,0.026395f,1.0f,
-			0.950343f,0.298611f,0.026395f,1.0f,
-			0.955982f,0.304505f,0.020898f,1.0f,
-			0.982769f,0.305442f,-0.011080f,1.0f,
-			0.961339f,0.300695f,-0.011080f,1.0f,
-			0.982769f,0.305442f,-0.011080f,1.0f,
-			0.955982f,0.304505f,0.020898f,1.0f,
-			0.955982f,0.304505f,0.020898f,1.0f,
-			0.938594f,0.299875f,0.015402f,1.0f,
-			0.961339f,0.300695f,-0.011080f,1.0f,
-			0.917924f,0.283457f,-0.011080f,1.0f,
-			0.961339f,0.300695f,-0.011080f,1.0f,
-			0.938594f,0.299875f,0.015402f,1.0f,
-			0.938594f,0.299875f,0.015402f,1.0f,
-			0.900158f,0.283457f,0.012904f,1.0f,
-			0.917924f,0.283457f,-0.011080f,1.0f,
-			0.950343f,0.298611f,-0.048555f,1.0f,
-			0.919700f,0.283457f,-0.051054f,1.0f,
-			0.946349f,0.283457f,-0.011080f,1.0f,
-			0.946349f,0.283457f,-0.011080f,1.0f,
-			0.978883f,0.299196f,-0.011080f,1.0f,
-			0.950343f,0.298611f,-0.048555f,1.0f,
-			0.955982f,0.304505f,-0.043059f,1.0f,
-			0.950343f,0.298611f,-0.048555f,1.0f,
-			0.978883f,0.299196f,-0.011080f,1.0f,
-			0.978883f,0.299196f,-0.011080f,1.0f,
-			0.982769f,0.305442f,-0.011080f,1.0f,
-			0.955982f,0.304505f,-0.043059f,1.0f,
-			0.938594f,0.299875f,-0.037563f,1.0f,
-			0.955982f,0.304505f,-0.043059f,1.0f,
-			0.982769f,0.305442f,-0.011080f,1.0f,
-			0.982769f,0.305442f,-0.011080f,1.0f,
-			0.961339f,0.300695f,-0.011080f,1.0f,
-			0.938594f,0.299875f,-0.037563f,1.0f,
-			0.900158f,0.283457f,-0.035064f,1.0f,
-			0.938594f,0.299875f,-0.037563f,1.0f,
-			0.961339f,0.300695f,-0.011080f,1.0f,
-			0.961339f,0.300695f,-0.011080f,1.0f,
-			0.917924f,0.283457f,-0.011080f,1.0f,
-			0.900158f,0.283457f,-0.035064f,1.0f,
-			0.887555f,0.297322f,-0.061047f,1.0f,
-			0.861073f,0.283457f,-0.064378f,1.0f,
-			0.919700f,0.283457f,-0.051054f,1.0f,
-			0.919700f,0.283457f,-0.051054f,1.0f,
-			0.950343f,0.298611f,-0.048555f,1.0f,
-			0.887555f,0.297322f,-0.061047f,1.0f,
-			0.897049f,0.302444f,-0.053718f,1.0f,
-			0.887555f,0.297322f,-0.061047f,1.0f,
-			0.950343f,0.298611f,-0.048555f,1.0f,
-			0.950343f,0.298611f,-0.048555f,1.0f,
-			0.955982f,0.304505f,-0.043059f,1.0f,
-			0.897049f,0.302444f,-0.053718f,1.0f,
-			0.888555f,0.298072f,-0.046390f,1.0f,
-			0.897049f,0.302444f,-0.053718f,1.0f,
-			0.955982f,0.304505f,-0.043059f,1.0f,
-			0.955982f,0.304505f,-0.043059f,1.0f,
-			0.938594f,0.299875f,-0.037563f,1.0f,
-			0.888555f,0.298072f,-0.046390f,1.0f,
-			0.861073f,0.283457f,-0.043059f,1.0f,
-			0.888555f,0.298072f,-0.046390f,1.0f,
-			0.938594f,0.299875f,-0.037563f,1.0f,
-			0.938594f,0.299875f,-0.037563f,1.0f,
-			0.900158f,0.283457f,-0.035064f,1.0f,
-			0.861073f,0.283457f,-0.043059f,1.0f,
-			0.824767f,0.296034f,-0.048555f,1.0f,
-			0.802446f,0.283457f,-0.051054f,1.0f,
-			0.861073f,0.283457f,-0.064378f,1.0f,
-			0.861073f,0.283457f,-0.064378f,1.0f,
-			0.887555f,0.297322f,-0.061047f,1.0f,
-			0.824767f,0.296034f,-0.048555f,1.0f,
-			0.838116f,0.300383f,-0.043059f,1.0f,
-			0.824767f,0.296034f,-0.048555f,1.0f,
-			0.887555f,0.297322f,-0.061047f,1.0f,
-			0.887555f,0.297322f,-0.061047f,1.0f,
-			0.897049f,0.302444f,-0.053718f,1.0f,
-			0.838116f,0.300383f,-0.043059f,1.0f,
-			0.838515f,0.296268f,-0.037563f,1.0f,
-			0.838116f,0.300383f,-0.043059f,1.0f,
-			0.897049f,0.302444f,-0.053718f,1.0f,
-			0.897049f,0.302444f,-0.053718f,1.0f,
-			0.888555f,0.298072f,-0.046390f,1.0f,
-			0.838515f,0.296268f,-0.037563f,1.0f,
-			0.821988f,0.283457f,-0.035064f,1.0f,
-			0.838515f,0.296268f,-0.037563f,1.0f,
-			0.888555f,0.298072f,-0.046390f,1.0f,
-			0.888555f,0.298072f,-0.046390f,1.0f,
-			0.861073f,0.283457f,-0.043059f,1.0f,
-			0.821988f,0.283457f,-0.035064f,1.0f,
-			0.796227f,0.295449f,-0.011080f,1.0f,
-			0.775797f,0.283457f,-0.011080f,1.0f,
-			0.802446f,0.283457f,-0.051054f,1.0f,
-			0.802446f,0.283457f,-0.051054f,1.0f,
-			0.824767f,0.296034f,-0.048555f,1.0f,
-			0.796227f,0.295449f,-0.011080f,1.0f,
-			0.811329f,0.299446f,-0.011080f,1.0f,
-			0.796227f,0.295449f,-0.011080f,1.0f,
-			0.824767f,0.296034f,-0.048555f,1.0f,
-			0.824767f,0.296034f,-0.048555f,1.0f,
-			0.838116f,0.300383f,-0.043059f,1.0f,
-			0.811329f,0.299446f,-0.011080f,1.0f,
-			0.815770f,0.295449f,-0.011080f,1.0f,
-			0.811329f,0.299446f,-0.011080f,1.0f,
-			0.838116f,0.300383f,-0.043059f,1.0f,
-			0.838116f,0.300383f,-0.043059f,1.0f,
-			0.838515f,0.296268f,-0.037563f,1.0f,
-			0.815770f,0.295449f,-0.011080f,1.0f,
-			0.804222f,0.283457f,-0.011080f,1.0f,
-			0.815770f,0.295449f,-0.011080f,1.0f,
-			0.838515f,0.296268f,-0.037563f,1.0f,
-			0.838515f,0.296268f,-0.037563f,1.0f,
-			0.821988f,0.283457f,-0.035064f,1.0f,
-			0.804222f,0.283457f,-0.011080f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.105134f,0.482657f,-0.011080f,1.0f,
-			0.097664f,0.482657f,0.027024f,1.0f,
-			0.093563f,0.448680f,0.025270f,1.0f,
-			0.097664f,0.482657f,0.027024f,1.0f,
-			0.105134f,0.482657f,-0.011080f,1.0f,
-			0.105134f,0.482657f,-0.011080f,1.0f,
-			0.100693f,0.448680f,-0.011080f,1.0f,
-			0.093563f,0.448680f,0.025270f,1.0f,
-			0.059947f,0.406708f,0.010919f,1.0f,
-			0.093563f,0.448680f,0.025270f,1.0f,
-			0.100693f,0.448680f,-0.011080f,1.0f,
-			0.100693f,0.448680f,-0.011080f,1.0f,
-			0.064273f,0.406708f,-0.011080f,1.0f,
-			0.059947f,0.406708f,0.010919f,1.0f,
-			0.060755f,0.368733f,0.011234f,1.0f,
-			0.059947f,0.406708f,0.010919f,1.0f,
-			0.064273f,0.406708f,-0.011080f,1.0f,
-			0.064273f,0.406708f,-0.011080f,1.0f,
-			0.065161f,0.368733f,-0.011080f,1.0f,
-			0.060755f,0.368733f,0.011234f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.097664f,0.482657f,0.027024f,1.0f,
-			0.077145f,0.482657f,0.057755f,1.0f,
-			0.073982f,0.448680f,0.054591f,1.0f,
-			0.077145f,0.482657f,0.057755f,1.0f,
-			0.097664f,0.482657f,0.027024f,1.0f,
-			0.097664f,0.482657f,0.027024f,1.0f,
-			0.093563f,0.448680f,0.025270f,1.0f,
-			0.073982f,0.448680f,0.054591f,1.0f,
-			0.048074f,0.406708f,0.028683f,1.0f,
-			0.073982f,0.448680f,0.054591f,1.0f,
-			0.093563f,0.448680f,0.025270f,1.0f,
-			0.093563f,0.448680f,0.025270f,1.0f,
-			0.059947f,0.406708f,0.010919f,1.0f,
-			0.048074f,0.406708f,0.028683f,1.0f,
-			0.048674f,0.368733f,0.029284f,1.0f,
-			0.048074f,0.406708f,0.028683f,1.0f,
-			0.059947f,0.406708f,0.010919f,1.0f,
-			0.059947f,0.406708f,0.010919f,1.0f,
-			0.060755f,0.368733f,0.011234f,1.0f,
-			0.048674f,0.368733f,0.029284f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.077145f,0.482657f,0.057755f,1.0f,
-			0.046415f,0.482657f,0.078274f,1.0f,
-			0.044660f,0.448680f,0.074173f,1.0f,
-			0.046415f,0.482657f,0.078274f,1.0f,
-			0.077145f,0.482657f,0.057755f,1.0f,
-			0.077145f,0.482657f,0.057755f,1.0f,
-			0.073982f,0.448680f,0.054591f,1.0f,
-			0.044660f,0.448680f,0.074173f,1.0f,
-			0.030309f,0.406708f,0.040556f,1.0f,
-			0.044660f,0.448680f,0.074173f,1.0f,
-			0.073982f,0.448680f,0.054591f,1.0f,
-			0.073982f,0.448680f,0.054591f,1.0f,
-			0.048074f,0.406708f,0.028683f,1.0f,
-			0.030309f,0.406708f,0.040556f,1.0f,
-			0.030624f,0.368733f,0.041365f,1.0f,
-			0.030309f,0.406708f,0.040556f,1.0f,
-			0.048074f,0.406708f,0.028683f,1.0f,
-			0.048074f,0.406708f,0.028683f,1.0f,
-			0.048674f,0.368733f,0.029284f,1.0f,
-			0.030624f,0.368733f,0.041365f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.046415f,0.482657f,0.078274f,1.0f,
-			0.008310f,0.482657f,0.085744f,1.0f,
-			0.008310f,0.448680f,0.081302f,1.0f,
-			0.008310f,0.482657f,0.085744f,1.0f,
-			0.046415f,0.482657f,0.078274f,1.0f,
-			0.046415f,0.482657f,0.078274f,1.0f,
-			0.044660f,0.448680f,0.074173f,1.0f,
-			0.008310f,0.448680f,0.081302f,1.0f,
-			0.008310f,0.406708f,0.044882f,1.0f,
-			0.008310f,0.448680f,0.081302f,1.0f,
-			0.044660f,0.448680f,0.074173f,1.0f,
-			0.044660f,0.448680f,0.074173f,1.0f,
-			0.030309f,0.406708f,0.040556f,1.0f,
-			0.008310f,0.406708f,0.044882f,1.0f,
-			0.008310f,0.368733f,0.045770f,1.0f,
-			0.008310f,0.406708f,0.044882f,1.0f,
-			0.030309f,0.406708f,0.040556f,1.0f,
-			0.030309f,0.406708f,0.040556f,1.0f,
-			0.030624f,0.368733f,0.041365f,1.0f,
-			0.008310f,0.368733f,0.045770f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.008310f,0.482657f,0.085744f,1.0f,
-			-0.029794f,0.482657f,0.078274f,1.0f,
-			-0.028040f,0.448680f,0.074173f,1.0f,
-			-0.029794f,0.482657f,0.078274f,1.0f,
-			0.008310f,0.482657f,0.085744f,1.0f,
-			0.008310f,0.482657f,0.085744f,1.0f,
-			0.008310f,0.448680f,0.081302f,1.0f,
-			-0.028040f,0.448680f,0.074173f,1.0f,
-			-0.013689f,0.406708f,0.040556f,1.0f,
-			-0.028040f,0.448680f,0.074173f,1.0f,
-			0.008310f,0.448680f,0.081302f,1.0f,
-			0.008310f,0.448680f,0.081302f,1.0f,
-			0.008310f,0.406708f,0.044882f,1.0f,
-			-0.013689f,0.406708f,0.040556f,1.0f,
-			-0.014004f,0.368733f,0.041365f,1.0f,
-			-0.013689f,0.406708f,0.040556f,1.0f,
-			0.008310f,0.406708f,0.044882f,1.0f,
-			0.008310f,0.406708f,0.044882f,1.0f,
-			0.008310f,0.368733f,0.045770f,1.0f,
-			-0.014004f,0.368733f,0.041365f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			-0.029794f,0.482657f,0.078274f,1.0f,
-			-0.060525f,0.482657f,0.057755f,1.0f,
-			-0.057361f,0.448680f,0.054591f,1.0f,
-			-0.060525f,0.482657f,0.057755f,1.0f,
-			-0.029794f,0.482657f,0.078274f,1.0f,
-			-0.029794f,0.482657f,0.078274f,1.0f,
-			-0.028040f,0.448680f,0.074173f,1.0f,
-			-0.057361f,0.448680f,0.054591f,1.0f,
-			-0.031453f,0.406708f,0.028683f,1.0f,
-			-0.057361f,0.448680f,0.054591f,1.0f,
-			-0.028040f,0.448680f,0.074173f,1.0f,
-			-0.028040f,0.448680f,0.074173f,1.0f,
-			-0.013689f,0.406708f,0.040556f,1.0f,
-			-0.031453f,0.406708f,0.028683f,1.0f,
-			-0.032054f,0.368733f,0.029284f,1.0f,
-			-0.031453f,0.406708f,0.028683f,1.0f,
-			-0.013689f,0.406708f,0.040556f,1.0f,
-			-0.013689f,0.406708f,0.040556f,1.0f,
-			-0.014004f,0.368733f,0.041365f,1.0f,
-			-0.032054f,0.368733f,0.029284f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			-0.060525f,0.482657f,0.057755f,1.0f,
-			-0.081044f,0.482657f,0.027024f,1.0f,
-			-0.076943f,0.448680f,0.025270f,1.0f,
-			-0.081044f,0.482657f,0.027024f,1.0f,
-			-0.060525f,0.482657f,0.057755f,1.0f,
-			-0.060525f,0.482657f,0.057755f,1.0f,
-			-0.057361f,0.448680f,0.054591f,1.0f,
-			-0.076943f,0.448680f,0.025270f,1.0f,
-			-0.043327f,0.406708f,0.010919f,1.0f,
-			-0.076943f,0.448680f,0.025270f,1.0f,
-			-0.057361f,0.448680f,0.054591f,1.0f,
-			-0.057361f,0.448680f,0.054591f,1.0f,
-			-0.031453f,0.406708f,0.028683f,1.0f,
-			-0.043327f,0.406708f,0.010919f,1.0f,
-			-0.044135f,0.368733f,0.011234f,1.0f,
-			-0.043327f,0.406708f,0.010919f,1.0f,
-			-0.031453f,0.406708f,0.028683f,1.0f,
-			-0.031453f,0.406708f,0.028683f,1.0f,
-			-0.032054f,0.368733f,0.029284f,1.0f,
-			-0.044135f,0.368733f,0.011234f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			-0.081044f,0.482657f,0.027024f,1.0f,
-			-0.088514f,0.482657f,-0.011080f,1.0f,
-			-0.084072f,0.448680f,-0.011080f,1.0f,
-			-0.088514f,0.482657f,-0.011080f,1.0f,
-			-0.081044f,0.482657f,0.027024f,1.0f,
-			-0.081044f,0.482657f,0.027024f,1.0f,
-			-0.076943f,0.448680f,0.025270f,1.0f,
-			-0.084072f,0.448680f,-0.011080f,1.0f,
-			-0.047652f,0.406708f,-0.011080f,1.0f,
-			-0.084072f,0.448680f,-0.011080f,1.0f,
-			-0.076943f,0.448680f,0.025270f,1.0f,
-			-0.076943f,0.448680f,0.025270f,1.0f,
-			-0.043327f,0.406708f,0.010919f,1.0f,
-			-0.047652f,0.406708f,-0.011080f,1.0f,
-			-0.048541f,0.368733f,-0.011080f,1.0f,
-			-0.047652f,0.406708f,-0.011080f,1.0f,
-			-0.043327f,0.406708f,0.010919f,1.0f,
-			-0.043327f,0.406708f,0.010919f,1.0f,
-			-0.044135f,0.368733f,0.011234f,1.0f,
-			-0.048541f,0.368733f,-0.011080f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			-0.088514f,0.482657f,-0.011080f,1.0f,
-			-0.081044f,0.482657f,-0.049185f,1.0f,
-			-0.076943f,0.448680f,-0.047431f,1.0f,
-			-0.081044f,0.482657f,-0.049185f,1.0f,
-			-0.088514f,0.482657f,-0.011080f,1.0f,
-			-0.088514f,0.482657f,-0.011080f,1.0f,
-			-0.084072f,0.448680f,-0.011080f,1.0f,
-			-0.076943f,0.448680f,-0.047431f,1.0f,
-			-0.043327f,0.406708f,-0.033079f,1.0f,
-			-0.076943f,0.448680f,-0.047431f,1.0f,
-			-0.084072f,0.448680f,-0.011080f,1.0f,
-			-0.084072f,0.448680f,-0.011080f,1.0f,
-			-0.047652f,0.406708f,-0.011080f,1.0f,
-			-0.043327f,0.406708f,-0.033079f,1.0f,
-			-0.044135f,0.368733f,-0.033394f,1.0f,
-			-0.043327f,0.406708f,-0.033079f,1.0f,
-			-0.047652f,0.406708f,-0.011080f,1.0f,
-			-0.047652f,0.406708f,-0.011080f,1.0f,
-			-0.048541f,0.368733f,-0.011080f,1.0f,
-			-0.044135f,0.368733f,-0.033394f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			-0.081044f,0.482657f,-0.049185f,1.0f,
-			-0.060525f,0.482657f,-0.079915f,1.0f,
-			-0.057361f,0.448680f,-0.076752f,1.0f,
-			-0.060525f,0.482657f,-0.079915f,1.0f,
-			-0.081044f,0.482657f,-0.049185f,1.0f,
-			-0.081044f,0.482657f,-0.049185f,1.0f,
-			-0.076943f,0.448680f,-0.047431f,1.0f,
-			-0.057361f,0.448680f,-0.076752f,1.0f,
-			-0.031453f,0.406708f,-0.050844f,1.0f,
-			-0.057361f,0.448680f,-0.076752f,1.0f,
-			-0.076943f,0.448680f,-0.047431f,1.0f,
-			-0.076943f,0.448680f,-0.047431f,1.0f,
-			-0.043327f,0.406708f,-0.033079f,1.0f,
-			-0.031453f,0.406708f,-0.050844f,1.0f,
-			-0.032054f,0.368733f,-0.051445f,1.0f,
-			-0.031453f,0.406708f,-0.050844f,1.0f,
-			-0.043327f,0.406708f,-0.033079f,1.0f,
-			-0.043327f,0.406708f,-0.033079f,1.0f,
-			-0.044135f,0.368733f,-0.033394f,1.0f,
-			-0.032054f,0.368733f,-0.051445f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			-0.060525f,0.482657f,-0.079915f,1.0f,
-			-0.029794f,0.482657f,-0.100434f,1.0f,
-			-0.028040f,0.448680f,-0.096333f,1.0f,
-			-0.029794f,0.482657f,-0.100434f,1.0f,
-			-0.060525f,0.482657f,-0.079915f,1.0f,
-			-0.060525f,0.482657f,-0.079915f,1.0f,
-			-0.057361f,0.448680f,-0.076752f,1.0f,
-			-0.028040f,0.448680f,-0.096333f,1.0f,
-			-0.013689f,0.406708f,-0.062717f,1.0f,
-			-0.028040f,0.448680f,-0.096333f,1.0f,
-			-0.057361f,0.448680f,-0.076752f,1.0f,
-			-0.057361f,0.448680f,-0.076752f,1.0f,
-			-0.031453f,0.406708f,-0.050844f,1.0f,
-			-0.013689f,0.406708f,-0.062717f,1.0f,
-			-0.014004f,0.368733f,-0.063525f,1.0f,
-			-0.013689f,0.406708f,-0.062717f,1.0f,
-			-0.031453f,0.406708f,-0.050844f,1.0f,
-			-0.031453f,0.406708f,-0.050844f,1.0f,
-			-0.032054f,0.368733f,-0.051445f,1.0f,
-			-0.014004f,0.368733f,-0.063525f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			-0.029794f,0.482657f,-0.100434f,1.0f,
-			0.008310f,0.482657f,-0.107904f,1.0f,
-			0.008310f,0.448680f,-0.103463f,1.0f,
-			0.008310f,0.482657f,-0.107904f,1.0f,
-			-0.029794f,0.482657f,-0.100434f,1.0f,
-			-0.029794f,0.482657f,-0.100434f,1.0f,
-			-0.028040f,0.448680f,-0.096333f,1.0f,
-			0.008310f,0.448680f,-0.103463f,1.0f,
-			0.008310f,0.406708f,-0.067043f,1.0f,
-			0.008310f,0.448680f,-0.103463f,1.0f,
-			-0.028040f,0.448680f,-0.096333f,1.0f,
-			-0.028040f,0.448680f,-0.096333f,1.0f,
-			-0.013689f,0.406708f,-0.062717f,1.0f,
-			0.008310f,0.406708f,-0.067043f,1.0f,
-			0.008310f,0.368733f,-0.067931f,1.0f,
-			0.008310f,0.406708f,-0.067043f,1.0f,
-			-0.013689f,0.406708f,-0.062717f,1.0f,
-			-0.013689f,0.406708f,-0.062717f,1.0f,
-			-0.014004f,0.368733f,-0.063525f,1.0f,
-			0.008310f,0.368733f,-0.067931f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.008310f,0.482657f,-0.107904f,1.0f,
-			0.046415f,0.482657f,-0.100434f,1.0f,
-			0.044660f,0.448680f,-0.096333f,1.0f,
-			0.046415f,0.482657f,-0.100434f,1.0f,
-			0.008310f,0.482657f,-0.107904f,1.0f,
-			0.008310f,0.482657f,-0.107904f,1.0f,
-			0.008310f,0.448680f,-0.103463f,1.0f,
-			0.044660f,0.448680f,-0.096333f,1.0f,
-			0.030309f,0.406708f,-0.062717f,1.0f,
-			0.044660f,0.448680f,-0.096333f,1.0f,
-			0.008310f,0.448680f,-0.103463f,1.0f,
-			0.008310f,0.448680f,-0.103463f,1.0f,
-			0.008310f,0.406708f,-0.067043f,1.0f,
-			0.030309f,0.406708f,-0.062717f,1.0f,
-			0.030624f,0.368733f,-0.063525f,1.0f,
-			0.030309f,0.406708f,-0.062717f,1.0f,
-			0.008310f,0.406708f,-0.067043f,1.0f,
-			0.008310f,0.406708f,-0.067043f,1.0f,
-			0.008310f,0.368733f,-0.067931f,1.0f,
-			0.030624f,0.368733f,-0.063525f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.046415f,0.482657f,-0.100434f,1.0f,
-			0.077145f,0.482657f,-0.079915f,1.0f,
-			0.073982f,0.448680f,-0.076752f,1.0f,
-			0.077145f,0.482657f,-0.079915f,1.0f,
-			0.046415f,0.482657f,-0.100434f,1.0f,
-			0.046415f,0.482657f,-0.100434f,1.0f,
-			0.044660f,0.448680f,-0.096333f,1.0f,
-			0.073982f,0.448680f,-0.076752f,1.0f,
-			0.048074f,0.406708f,-0.050844f,1.0f,
-			0.073982f,0.448680f,-0.076752f,1.0f,
-			0.044660f,0.448680f,-0.096333f,1.0f,
-			0.044660f,0.448680f,-0.096333f,1.0f,
-			0.030309f,0.406708f,-0.062717f,1.0f,
-			0.048074f,0.406708f,-0.050844f,1.0f,
-			0.048674f,0.368733f,-0.051445f,1.0f,
-			0.048074f,0.406708f,-0.050844f,1.0f,
-			0.030309f,0.406708f,-0.062717f,1.0f,
-			0.030309f,0.406708f,-0.062717f,1.0f,
-			0.030624f,0.368733f,-0.063525f,1.0f,
-			0.048674f,0.368733f,-0.051445f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.077145f,0.482657f,-0.079915f,1.0f,
-			0.097664f,0.482657f,-0.049185f,1.0f,
-			0.093563f,0.448680f,-0.047431f,1.0f,
-			0.097664f,0.482657f,-0.049185f,1.0f,
-			0.077145f,0.482657f,-0.079915f,1.0f,
-			0.077145f,0.482657f,-0.079915f,1.0f,
-			0.073982f,0.448680f,-0.076752f,1.0f,
-			0.093563f,0.448680f,-0.047431f,1.0f,
-			0.059947f,0.406708f,-0.033079f,1.0f,
-			0.093563f,0.448680f,-0.047431f,1.0f,
-			0.073982f,0.448680f,-0.076752f,1.0f,
-			0.073982f,0.448680f,-0.076752f,1.0f,
-			0.048074f,0.406708f,-0.050844f,1.0f,
-			0.059947f,0.406708f,-0.033079f,1.0f,
-			0.060755f,0.368733f,-0.033394f,1.0f,
-			0.059947f,0.406708f,-0.033079f,1.0f,
-			0.048074f,0.406708f,-0.050844f,1.0f,
-			0.048074f,0.406708f,-0.050844f,1.0f,
-			0.048674f,0.368733f,-0.051445f,1.0f,
-			0.060755f,0.368733f,-0.033394f,1.0f,
-			0.008310f,0.496647f,-0.011080f,1.0f,
-			0.097664f,0.482657f,-0.049185f,1.0f,
-			0.105134f,0.482657f,-0.011080f,1.0f,
-			0.100693f,0.448680f,-0.011080f,1.0f,
-			0.105134f,0.482657f,-0.011080f,1.0f,
-			0.097664f,0.482657f,-0.049185f,1.0f,
-			0.097664f,0.482657f,-0.049185f,1.0f,
-			0.093563f,0.448680f,-0.047431f,1.0f,
-			0.100693f,0.448680f,-0.011080f,1.0f,
-			0.064273f,0.406708f,-0.011080f,1.0f,
-			0.100693f,0.448680f,-0.011080f,1.0f,
-			0.093563f,0.448680f,-0.047431f,1.0f,
-			0.093563f,0.448680f,-0.047431f,1.0f,
-			0.059947f,0.406708f,-0.033079f,1.0f,
-			0.064273f,0.406708f,-0.011080f,1.0f,
-			0.065161f,0.368733f,-0.011080f,1.0f,
-			0.064273f,0.406708f,-0.011080f,1.0f,
-			0.059947f,0.406708f,-0.033079f,1.0f,
-			0.059947f,0.406708f,-0.033079f,1.0f,
-			0.060755f,0.368733f,-0.033394f,1.0f,
-			0.065161f,0.368733f,-0.011080f,1.0f,
-			0.127950f,0.343417f,0.039823f,1.0f,
-			0.060755f,0.368733f,0.011234f,1.0f,
-			0.065161f,0.368733f,-0.011080f,1.0f,
-			0.065161f,0.368733f,-0.011080f,1.0f,
-			0.138001f,0.343417f,-0.011080f,1.0f,
-			0.127950f,0.343417f,0.039823f,1.0f,
-			0.224646f,0.326095f,0.080965f,1.0f,
-			0.127950f,0.343417f,0.039823f,1.0f,
-			0.138001f,0.343417f,-0.011080f,1.0f,
-			0.138001f,0.343417f,-0.011080f,1.0f,
-			0.242820f,0.326095f,-0.011080f,1.0f,
-			0.224646f,0.326095f,0.080965f,1.0f,
-			0.311507f,0.308773f,0.117922f,1.0f,
-			0.224646f,0.326095f,0.080965f,1.0f,
-			0.242820f,0.326095f,-0.011080f,1.0f,
-			0.242820f,0.326095f,-0.011080f,1.0f,
-			0.336979f,0.308773f,-0.011080f,1.0f,
-			0.311507f,0.308773f,0.117922f,1.0f,
-			0.349202f,0.283457f,0.133960f,1.0f,
-			0.311507f,0.308773f,0.117922f,1.0f,
-			0.336979f,0.308773f,-0.011080f,1.0f,
-			0.336979f,0.308773f,-0.011080f,1.0f,
-			0.377841f,0.283457f,-0.011080f,1.0f,
-			0.349202f,0.283457f,0.133960f,1.0f,
-			0.100391f,0.343417f,0.081000f,1.0f,
-			0.048674f,0.368733f,0.029284f,1.0f,
-			0.060755f,0.368733f,0.011234f,1.0f,
-			0.060755f,0.368733f,0.011234f,1.0f,
-			0.127950f,0.343417f,0.039823f,1.0f,
-			0.100391f,0.343417f,0.081000f,1.0f,
-			0.174812f,0.326095f,0.155422f,1.0f,
-			0.100391f,0.343417f,0.081000f,1.0f,
-			0.127950f,0.343417f,0.039823f,1.0f,
-			0.127950f,0.343417f,0.039823f,1.0f,
-			0.224646f,0.326095f,0.080965f,1.0f,
-			0.174812f,0.326095f,0.155422f,1.0f,
-			0.241665f,0.308773f,0.222275f,1.0f,
-			0.174812f,0.326095f,0.155422f,1.0f,
-			0.224646f,0.326095f,0.080965f,1.0f,
-			0.224646f,0.326095f,0.080965f,1.0f,
-			0.311507f,0.308773f,0.117922f,1.0f,
-			0.241665f,0.308773f,0.222275f,1.0f,
-			0.270677f,0.283457f,0.251286f,1.0f,
-			0.241665f,0.308773f,0.222275f,1.0f,
-			0.311507f,0.308773f,0.117922f,1.0f,
-			0.311507f,0.308773f,0.117922f,1.0f,
-			0.349202f,0.283457f,0.133960f,1.0f,
-			0.270677f,0.283457f,0.251286f,1.0f,
-			0.059214f,0.343417f,0.108560f,1.0f,
-			0.030624f,0.368733f,0.041365f,1.0f,
-			0.048674f,0.368733f,0.029284f,1.0f,
-			0.048674f,0.368733f,0.029284f,1.0f,
-			0.100391f,0.343417f,0.081000f,1.0f,
-			0.059214f,0.343417f,0.108560f,1.0f,
-			0.100355f,0.326095f,0.205255f,1.0f,
-			0.059214f,0.343417f,0.108560f,1.0f,
-			0.100391f,0.343417f,0.081000f,1.0f,
-			0.100391f,0.343417f,0.081000f,1.0f,
-			0.174812f,0.326095f,0.155422f,1.0f,
-			0.100355f,0.326095f,0.205255f,1.0f,
-			0.137313f,0.308773f,0.292117f,1.0f,
-			0.100355f,0.326095f,0.205255f,1.0f,
-			0.174812f,0.326095f,0.155422f,1.0f,
-			0.174812f,0.326095f,0.155422f,1.0f,
-			0.241665f,0.308773f,0.222275f,1.0f,
-			0.137313f,0.308773f,0.292117f,1.0f,
-			0.153351f,0.283457f,0.329812f,1.0f,
-			0.137313f,0.308773f,0.292117f,1.0f,
-			0.241665f,0.308773f,0.222275f,1.0f,
-			0.241665f,0.308773f,0.222275f,1.0f,
-			0.270677f,0.283457f,0.251286f,1.0f,
-			0.153351f,0.283457f,0.329812f,1.0f,
-			0.008310f,0.343417f,0.118611f,1.0f,
-			0.008310f,0.368733f,0.045770f,1.0f,
-			0.030624f,0.368733f,0.041365f,1.0f,
-			0.030624f,0.368733f,0.041365f,1.0f,
-			0.059214f,0.343417f,0.108560f,1.0f,
-			0.008310f,0.343417f,0.118611f,1.0f,
-			0.008310f,0.326095f,0.223429f,1.0f,
-			0.008310f,0.343417f,0.118611f,1.0f,
-			0.059214f,0.343417f,0.108560f,1.0f,
-			0.059214f,0.343417f,0.108560f,1.0f,
-			0.100355f,0.326095f,0.205255f,1.0f,
-			0.008310f,0.326095f,0.223429f,1.0f,
-			0.008310f,0.308773f,0.317589f,1.0f,
-			0.008310f,0.326095f,0.223429f,1.0f,
-			0.100355f,0.326095f,0.205255f,1.0f,
-			0.100355f,0.326095f,0.205255f,1.0f,
-			0.137313f,0.308773f,0.292117f,1.0f,
-			0.008310f,0.308773f,0.317589f,1.0f,
-			0.008310f,0.283457f,0.358450f,1.0f,
-			0.008310f,0.308773f,0.317589f,1.0f,
-			0.137313f,0.308773f,0.292117f,1.0f,
-			0.137313f,0.308773f,0.292117f,1.0f,
-			0.153351f,0.283457f,0.329812f,1.0f,
-			0.008310f,0.283457f,0.358450f,1.0f,
-			-0.042593f,0.343417f,0.108560f,1.0f,
-			-0.014004f,0.368733f,0.041365f,1.0f,
-			0.008310f,0.368733f,0.045770f,1.0f,
-			0.008310f,0.368733f,0.045770f,1.0f,
-			0.008310f,0.343417f,0.118611f,1.0f,
-			-0.042593f,0.343417f,0.108560f,1.0f,
-			-0.083735f,0.326095f,0.205255f,1.0f,
-			-0.042593f,0.343417f,0.108560f,1.0f,
-			0.008310f,0.343417f,0.118611f,1.0f,
-			0.008310f,0.343417f,0.118611f,1.0f,
-			0.008310f,0.326095f,0.223429f,1.0f,
-			-0.083735f,0.326095f,0.205255f,1.0f,
-			-0.120692f,0.308773f,0.292117f,1.0f,
-			-0.083735f,0.326095f,0.205255f,1.0f,
-			0.008310f,0.326095f,0.223429f,1.0f,
-			0.008310f,0.326095f,0.223429f,1.0f,
-			0.008310f,0.308773f,0.317589f,1.0f,
-			-0.120692f,0.308773f,0.292117f,1.0f,
-			-0.136730f,0.283457f,0.329812f,1.0f,
-			-0.120692f,0.308773f,0.292117f,1.0f,
-			0.008310f,0.308773f,0.317589f,1.0f,
-			0.008310f,0.308773f,0.317589f,1.0f,
-			0.008310f,0.283457f,0.358450f,1.0f,
-			-0.136730f,0.283457f,0.329812f,1.0f,
-			-0.083770f,0.343417f,0.081000f,1.0f,
-			-0.032054f,0.368733f,0.029284f,1.0f,
-			-0.014004f,0.368733f,0.041365f,1.0f,
-			-0.014004f,0.368733f,0.041365f,1.0f,
-			-0.042593f,0.343417f,0.108560f,1.0f,
-			-0.083770f,0.343417f,0.081000f,1.0f,
-			-0.158192f,0.326095f,0.155422f,1.0f,
-			-0.083770f,0.343417f,0.081000f,1.0f,
-			-0.042593f,0.343417f,0.108560f,1.0f,
-			-0.042593f,0.343417f,0.108560f,1.0f,
-			-0.083735f,0.326095f,0.205255f,1.0f,
-			-0.158192f,0.326095f,0.155422f,1.0f,
-			-0.225045f,0.308773f,0.222275f,1.0f,
-			-0.158192f,0.326095f,0.155422f,1.0f,
-			-0.083735f,0.326095f,0.205255f,1.0f,
-			-0.083735f,0.326095f,0.205255f,1.0f,
-			-0.120692f,0.308773f,0.292117f,1.0f,
-			-0.225045f,0.308773f,0.222275f,1.0f,
-			-0.254056f,0.283457f,0.251286f,1.0f,
-			-0.225045f,0.308773f,0.222275f,1.0f,
-			-0.120692f,0.308773f,0.292117f,1.0f,
-			-0.120692f,0.308773f,0.292117f,1.0f,
-			-0.136730f,0.283457f,0.329812f,1.0f,
-			-0.254056f,0.283457f,0.251286f,1.0f,
-			-0.111330f,0.343417f,0.039823f,1.0f,
-			-0.044135f,0.368733f,0.011234f,1.0f,
-			-0.032054f,0.368733f,0.029284f,1.0f,
-			-0.032054f,0.368733f,0.029284f,1.0f,
-			-0.083770f,0.343417f,0.081000f,1.0f,
-			-0.111330f,0.343417f,0.039823f,1.0f,
-			-0.208025f,0.326095f,0.080965f,1.0f,
-			-0.111330f,0.343417f,0.039823f,1.0f,
-			-0.083770f,0.343417f,0.081000f,1.0f,
-			-0.083770f,0.343417f,0.081000f,1.0f,
-			-0.158192f,0.326095f,0.155422f,1.0f,
-			-0.208025f,0.326095f,0.080965f,1.0f,
-			-0.294887f,0.308773f,0.117922f,1.0f,
-			-0.208025f,0.326095f,0.080965f,1.0f,
-			-0.158192f,0.326095f,0.155422f,1.0f,
-			-0.158192f,0.326095f,0.155422f,1.0f,
-			-0.225045f,0.308773f,0.222275f,1.0f,
-			-0.294887f,0.308773f,0.117922f,1.0f,
-			-0.332582f,0.283457f,0.133960f,1.0f,
-			-0.294887f,0.308773f,0.117922f,1.0f,
-			-0.225045f,0.308773f,0.222275f,1.0f,
-			-0.225045f,0.308773f,0.222275f,1.0f,
-			-0.254056f,0.283457f,0.251286f,1.0f,
-			-0.332582f,0.283457f,0.133960f,1.0f,
-			-0.121381f,0.343417f,-0.011080f,1.0f,
-			-0.048541f,0.368733f,-0.011080f,1.0f,
-			-0.044135f,0.368733f,0.011234f,1.0f,
-			-0.044135f,0.368733f,0.011234f,1.0f,
-			-0.111330f,0.343417f,0.039823f,1.0f,
-			-0.121381f,0.343417f,-0.011080f,1.0f,
-			-0.226200f,0.326095f,-0.011080f,1.0f,
-			-0.121381f,0.343417f,-0.011080f,1.0f,
-			-0.111330f,0.343417f,0.039823f,1.0f,
-			-0.111330f,0.343417f,0.039823f,1.0f,
-			-0.208025f,0.326095f,0.080965f,1.0f,
-			-0.226200f,0.326095f,-0.011080f,1.0f,
-			-0.320359f,0.308773f,-0.011080f,1.0f,
-			-0.226200f,0.326095f,-0.011080f,1.0f,
-			-0.208025f,0.326095f,0.080965f,1.0f,
-			-0.208025f,0.326095f,0.080965f,1.0f,
-			-0.294887f,0.308773f,0.117922f,1.0f,
-			-0.320359f,0.308773f,-0.011080f,1.0f,
-			-0.361220f,0.283457f,-0.011080f,1.0f,
-			-0.320359f,0.308773f,-0.011080f,1.0f,
-			-0.294887f,0.308773f,0.117922f,1.0f,
-			-0.294887f,0.308773f,0.117922f,1.0f,
-			-0.332582f,0.283457f,0.133960f,1.0f,
-			-0.361220f,0.283457f,-0.011080f,1.0f,
-			-0.111330f,0.343417f,-0.061984f,1.0f,
-			-0.044135f,0.368733f,-0.033394f,1.0f,
-			-0.048541f,0.368733f,-0.011080f,1.0f,
-			-0.048541f,0.368733f,-0.011080f,1.0f,
-			-0.121381f,0.343417f,-0.011080f,1.0f,
-			-0.111330f,0.343417f,-0.061984f,1.0f,
-			-0.208025f,0.326095f,-0.103125f,1.0f,
-			-0.111330f,0.343417f,-0.061984f,1.0f,
-			-0.121381f,0.343417f,-0.011080f,1.0f,
-			-0.121381f,0.343417f,-0.011080f,1.0f,
-			-0.226200f,0.326095f,-0.011080f,1.0f,
-			-0.208025f,0.326095f,-0.103125f,1.0f,
-			-0.294887f,0.308773f,-0.140083f,1.0f,
-			-0.208025f,0.326095f,-0.103125f,1.0f,
-			-0.226200f,0.326095f,-0.011080f,1.0f,
-			-0.226200f,0.326095f,-0.011080f,1.0f,
-			-0.320359f,0.308773f,-0.011080f,1.0f,
-			-0.294887f,0.308773f,-0.140083f,1.0f,
-			-0.332582f,0.283457f,-0.156121f,1.0f,
-			-0.294887f,0.308773f,-0.140083f,1.0f,
-			-0.320359f,0.308773f,-0.011080f,1.0f,
-			-0.320359f,0.308773f,-0.011080f,1.0f,
-			-0.361220f,0.283457f,-0.011080f,1.0f,
-			-0.332582f,0.283457f,-0.156121f,1.0f,
-			-0.083770f,0.343417f,-0.103161f,1.0f,
-			-0.032054f,0.368733f,-0.051445f,1.0f,
-			-0.044135f,0.368733f,-0.033394f,1.0f,
-			-0.044135f,0.368733f,-0.033394f,1.0f,
-			-0.111330f,0.343417f,-0.061984f,1.0f,
-			-0.083770f,0.343417f,-0.103161f,1.0f,
-			-0.158192f,0.326095f,-0.177582f,1.0f,
-			-0.083770f,0.343417f,-0.103161f,1.0f,
-			-0.111330f,0.343417f,-0.061984f,1.0f,
-			-0.111330f,0.343417f,-0.061984f,1.0f,
-			-0.208025f,0.326095f,-0.103125f,1.0f,
-			-0.158192f,0.326095f,-0.177582f,1.0f,
-			-0.225045f,0.308773f,-0.244435f,1.0f,
-			-0.158192f,0.326095f,-0.177582f,1.0f,
-			-0.208025f,0.326095f,-0.103125f,1.0f,
-			-0.208025f,0.326095f,-0.103125f,1.0f,
-			-0.294887f,0.308773f,-0.140083f,1.0f,
-			-0.225045f,0.308773f,-0.244435f,1.0f,
-			-0.254056f,0.283457f,-0.273447f,1.0f,
-			-0.225045f,0.308773f,-0.244435f,1.0f,
-			-0.294887f,0.308773f,-0.140083f,1.0f,
-			-0.294887f,0.308773f,-0.140083f,1.0f,
-			-0.332582f,0.283457f,-0.156121f,1.0f,
-			-0.254056f,0.283457f,-0.273447f,1.0f,
-			-0.042593f,0.343417f,-0.130720f,1.0f,
-			-0.014004f,0.368733f,-0.063525f,1.0f,
-			-0.032054f,0.368733f,-0.051445f,1.0f,
-			-0.032054f,0.368733f,-0.051445f,1.0f,
-			-0.083770f,0.343417f,-0.103161f,1.0f,
-			-0.042593f,0.343417f,-0.130720f,1.0f,
-			-0.083735f,0.326095f,-0.227416f,1.0f,
-			-0.042593f,0.343417f,-0.130720f,1.0f,
-			-0.083770f,0.343417f,-0.103161f,1.0f,
-			-0.083770f,0.343417f,-0.103161f,1.0f,
-			-0.158192f,0.326095f,-0.177582f,1.0f,
-			-0.083735f,0.326095f,-0.227416f,1.0f,
-			-0.120692f,0.308773f,-0.314277f,1.0f,
-			-0.083735f,0.326095f,-0.227416f,1.0f,
-			-0.158192f,0.326095f,-0.177582f,1.0f,
-			-0.158192f,0.326095f,-0.177582f,1.0f,
-			-0.225045f,0.308773f,-0.244435f,1.0f,
-			-0.120692f,0.308773f,-0.314277f,1.0f,
-			-0.136730f,0.283457f,-0.351972f,1.0f,
-			-0.120692f,0.308773f,-0.314277f,1.0f,
-			-0.225045f,0.308773f,-0.244435f,1.0f,
-			-0.225045f,0.308773f,-0.244435f,1.0f,
-			-0.254056f,0.283457f,-0.273447f,1.0f,
-			-0.136730f,0.283457f,-0.351972f,1.0f,
-			0.008310f,0.343417f,-0.140771f,1.0f,
-			0.008310f,0.368733f,-0.067931f,1.0f,
-			-0.014004f,0.368733f,-0.063525f,1.0f,
-			-0.014004f,0.368733f,-0.063525f,1.0f,
-			-0.042593f,0.343417f,-0.130720f,1.0f,
-			0.008310f,0.343417f,-0.140771f,1.0f,
-			0.008310f,0.326095f,-0.245590f,1.0f,
-			0.008310f,0.343417f,-0.140771f,1.0f,
-			-0.042593f,0.343417f,-0.130720f,1.0f,
-			-0.042593f,0.343417f,-0.130720f,1.0f,
-			-0.083735f,0.326095f,-0.227416f,1.0f,
-			0.008310f,0.326095f,-0.245590f,1.0f,
-			0.008310f,0.308773f,-0.339749f,1.0f,
-			0.008310f,0.326095f,-0.245590f,1.0f,
-			-0.083735f,0.326095f,-0.227416f,1.0f,
-			-0.083735f,0.326095f,-0.227416f,1.0f,
-			-0.120692f,0.308773f,-0.314277f,1.0f,
-			0.008310f,0.308773f,-0.339749f,1.0f,
-			0.008310f,0.283457f,-0.380611f,1.0f,
-			0.008310f,0.308773f,-0.339749f,1.0f,
-			-0.120692f,0.308773f,-0.314277f,1.0f,
-			-0.120692f,0.308773f,-0.314277f,1.0f,
-			-0.136730f,0.283457f,-0.351972f,1.0f,
-			0.008310f,0.283457f,-0.380611f,1.0f,
-			0.059214f,0.343417f,-0.130720f,1.0f,
-			0.030624f,0.368733f,-0.063525f,1.0f,
-			0.008310f,0.368733f,-0.067931f,1.0f,
-			0.008310f,0.368733f,-0.067931f,1.0f,
-			0.008310f,0.343417f,-0.140771f,1.0f,
-			0.059214f,0.343417f,-0.130720f,1.0f,
-			0.100355f,0.326095f,-0.227416f,1.0f,
-			0.059214f,0.343417f,-0.130720f,1.0f,
-			0.008310f,0.343417f,-0.140771f,1.0f,
-			0.008310f,0.343417f,-0.140771f,1.0f,
-			0.008310f,0.326095f,-0.245590f,1.0f,
-			0.100355f,0.326095f,-0.227416f,1.0f,
-			0.137313f,0.308773f,-0.314277f,1.0f,
-			0.100355f,0.326095f,-0.227416f,1.0f,
-			0.008310f,0.326095f,-0.245590f,1.0f,
-			0.008310f,0.326095f,-0.245590f,1.0f,
-			0.008310f,0.308773f,-0.339749f,1.0f,
-			0.137313f,0.308773f,-0.314277f,1.0f,
-			0.153351f,0.283457f,-0.351972f,1.0f,
-			0.137313f,0.308773f,-0.314277f,1.0f,
-			0.008310f,0.308773f,-0.339749f,1.0f,
-			0.008310f,0.308773f,-0.339749f,1.0f,
-			0.008310f,0.283457f,-0.380611f,1.0f,
-			0.153351f,0.283457f,-0.351972f,1.0f,
-			0.100391f,0.343417f,-0.103161f,1.0f,
-			0.048674f,0.368733f,-0.051445f,1.0f,
-			0.030624f,0.368733f,-0.063525f,1.0f,
-			0.030624f,0.368733f,-0.063525f,1.0f,
-			0.059214f,0.343417f,-0.130720f,1.0f,
-			0.100391f,0.343417f,-0.103161f,1.0f,
-			0.174812f,0.326095f,-0.177582f,1.0f,
-			0.100391f,0.343417f,-0.103161f,1.0f,
-			0.059214f,0.343417f,-0.130720f,1.0f,
-			0.059214f,0.343417f,-0.130720f,1.0f,
-			0.100355f,0.326095f,-0.227416f,1.0f,
-			0.174812f,0.326095f,-0.177582f,1.0f,
-			0.241665f,0.308773f,-0.244435f,1.0f,
-			0.174812f,0.326095f,-0.177582f,1.0f,
-			0.100355f,0.326095f,-0.227416f,1.0f,
-			0.100355f,0.326095f,-0.227416f,1.0f,
-			0.137313f,0.308773f,-0.314277f,1.0f,
-			0.241665f,0.308773f,-0.244435f,1.0f,
-			0.270677f,0.283457f,-0.273447f,1.0f,
-			0.241665f,0.308773f,-0.244435f,1.0f,
-			0.137313f,0.308773f,-0.314277f,1.0f,
-			0.137313f,0.308773f,-0.314277f,1.0f,
-			0.153351f,0.283457f,-0.351972f,1.0f,
-			0.270677f,0.283457f,-0.273447f,1.0f,
-			0.127950f,0.343417f,-0.061984f,1.0f,
-			0.060755f,0.368733f,-0.033394f,1.0f,
-			0.048674f,0.368733f,-0.051445f,1.0f,
-			0.048674f,0.368733f,-0.051445f,1.0f,
-			0.100391f,0.343417f,-0.103161f,1.0f,
-			0.127950f,0.343417f,-0.061984f,1.0f,
-			0.224646f,0.326095f,-0.103125f,1.0f,
-			0.127950f,0.343417f,-0.061984f,1.0f,
-			0.100391f,0.343417f,-0.103161f,1.0f,
-			0.100391f,0.343417f,-0.103161f,1.0f,
-			0.174812f,0.326095f,-0.177582f,1.0f,
-			0.224646f,0.326095f,-0.103125f,1.0f,
-			0.311507f,0.308773f,-0.140083f,1.0f,
-			0.224646f,0.326095f,-0.103125f,1.0f,
-			0.174812f,0.326095f,-0.177582f,1.0f,
-			0.174812f,0.326095f,-0.177582f,1.0f,
-			0.241665f,0.308773f,-0.244435f,1.0f,
-			0.311507f,0.308773f,-0.140083f,1.0f,
-			0.349202f,0.283457f,-0.156121f,1.0f,
-			0.311507f,0.308773f,-0.140083f,1.0f,
-			0.241665f,0.308773f,-0.244435f,1.0f,
-			0.241665f,0.308773f,-0.244435f,1.0f,
-			0.270677f,0.283457f,-0.273447f,1.0f,
-			0.349202f,0.283457f,-0.156121f,1.0f,
-			0.138001f,0.343417f,-0.011080f,1.0f,
-			0.065161f,0.368733f,-0.011080f,1.0f,
-			0.060755f,0.368733f,-0.033394f,1.0f,
-			0.060755f,0.368733f,-0.033394f,1.0f,
-			0.127950f,0.343417f,-0.061984f,1.0f,
-			0.138001f,0.343417f,-0.011080f,1.0f,
-			0.242820f,0.326095f,-0.011080f,1.0f,
-			0.138001f,0.343417f,-0.011080f,1.0f,
-			0.127950f,0.343417f,-0.061984f,1.0f,
-			0.127950f,0.343417f,-0.061984f,1.0f,
-			0.224646f,0.326095f,-0.103125f,1.0f,
-			0.242820f,0.326095f,-0.011080f,1.0f,
-			0.336979f,0.308773f,-0.011080f,1.0f,
-			0.242820f,0.326095f,-0.011080f,1.0f,
-			0.224646f,0.326095f,-0.103125f,1.0f,
-			0.224646f,0.326095f,-0.103125f,1.0f,
-			0.311507f,0.308773f,-0.140083f,1.0f,
-			0.336979f,0.308773f,-0.011080f,1.0f,
-			0.377841f,0.283457f,-0.011080f,1.0f,
-			0.336979f,0.308773f,-0.011080f,1.0f,
-			0.311507f,0.308773f,-0.140083f,1.0f,
-			0.311507f,0.308773f,-0.140083f,1.0f,
-			0.349202f,0.283457f,-0.156121f,1.0f,
-			0.377841f,0.283457f,-0.011080f,1.0f,
-		};
-		float normals[]={
-			-0.949594f,-0.251232f,-0.187496f,0.0f,
-			-0.949594f,-0.251232f,-0.187496f,0.0f,
-			-0.949594f,-0.251232f,-0.187496f,0.0f,
-			-0.949596f,-0.251222f,-0.187498f,0.0f,
-			-0.949596f,-0.251222f,-0.187498f,0.0f,
-			-0.949596f,-0.251222f,-0.187498f,0.0f,
-			-0.728040f,0.670293f,-0.143752f,0.0f,
-			-0.728040f,0.670293f,-0.143752f,0.0f,
-			-0.728040f,0.670293f,-0.143752f,0.0f,
-			-0.727997f,0.670341f,-0.143747f,0.0f,
-			-0.727997f,0.670341f,-0.143747f,0.0f,
-			-0.727997f,0.670341f,-0.143747f,0.0f,
-			0.468932f,0.878368f,0.092593f,0.0f,
-			0.468932f,0.878368f,0.092593f,0.0f,
-			0.468932f,0.878368f,0.092593f,0.0f,
-			0.468946f,0.878360f,0.092594f,0.0f,
-			0.468946f,0.878360f,0.092594f,0.0f,
-			0.468946f,0.878360f,0.092594f,0.0f,
-			0.813229f,0.559353f,0.160574f,0.0f,
-			0.813229f,0.559353f,0.160574f,0.0f,
-			0.813229f,0.559353f,0.160574f,0.0f,
-			0.813220f,0.559365f,0.160575f,0.0f,
-			0.813220f,0.559365f,0.160575f,0.0f,
-			0.813220f,0.559365f,0.160575f,0.0f,
-			-0.804192f,-0.252135f,-0.538241f,0.0f,
-			-0.804192f,-0.252135f,-0.538241f,0.0f,
-			-0.804192f,-0.252135f,-0.538241f,0.0f,
-			-0.804188f,-0.252160f,-0.538234f,0.0f,
-			-0.804188f,-0.252160f,-0.538234f,0.0f,
-			-0.804188f,-0.252160f,-0.538234f,0.0f,
-			-0.615612f,0.671758f,-0.412022f,0.0f,
-			-0.615612f,0.671758f,-0.412022f,0.0f,
-			-0.615612f,0.671758f,-0.412022f,0.0f,
-			-0.615612f,0.671758f,-0.412022f,0.0f,
-			-0.615612f,0.671758f,-0.412022f,0.0f,
-			-0.615612f,0.671758f,-0.412022f,0.0f,
-			0.396026f,0.879152f,0.265056f,0.0f,
-			0.396026f,0.879152f,0.265056f,0.0f,
-			0.396026f,0.879152f,0.265056f,0.0f,
-			0.396012f,0.879161f,0.265048f,0.0f,
-			0.396012f,0.879161f,0.265048f,0.0f,
-			0.396012f,0.879161f,0.265048f,0.0f,
-			0.688019f,0.560876f,0.460487f,0.0f,
-			0.688019f,0.560876f,0.460487f,0.0f,
-			0.688019f,0.560876f,0.460487f,0.0f,
-			0.688024f,0.560868f,0.460489f,0.0f,
-			0.688024f,0.560868f,0.460489f,0.0f,
-			0.688024f,0.560868f,0.460489f,0.0f,
-			-0.538237f,-0.252161f,-0.804186f,0.0f,
-			-0.538237f,-0.252161f,-0.804186f,0.0f,
-			-0.538237f,-0.252161f,-0.804186f,0.0f,
-			-0.538238f,-0.252122f,-0.804198f,0.0f,
-			-0.538238f,-0.252122f,-0.804198f,0.0f,
-			-0.538238f,-0.252122f,-0.804198f,0.0f,
-			-0.412022f,0.671757f,-0.615614f,0.0f,
-			-0.412022f,0.671757f,-0.615614f,0.0f,
-			-0.412022f,0.671757f,-0.615614f,0.0f,
-			-0.412030f,0.671742f,-0.615625f,0.0f,
-			-0.412030f,0.671742f,-0.615625f,0.0f,
-			-0.412030f,0.671742f,-0.615625f,0.0f,
-			0.265055f,0.879153f,0.396025f,0.0f,
-			0.265055f,0.879153f,0.396025f,0.0f,
-			0.265055f,0.879153f,0.396025f,0.0f,
-			0.265051f,0.879156f,0.396021f,0.0f,
-			0.265051f,0.879156f,0.396021f,0.0f,
-			0.265051f,0.879156f,0.396021f,0.0f,
-			0.460481f,0.560884f,0.688017f,0.0f,
-			0.460481f,0.560884f,0.688017f,0.0f,
-			0.460481f,0.560884f,0.688017f,0.0f,
-			0.460488f,0.560869f,0.688024f,0.0f,
-			0.460488f,0.560869f,0.688024f,0.0f,
-			0.460488f,0.560869f,0.688024f,0.0f,
-			-0.187502f,-0.251222f,-0.949595f,0.0f,
-			-0.187502f,-0.251222f,-0.949595f,0.0f,
-			-0.187502f,-0.251222f,-0.949595f,0.0f,
-			-0.187503f,-0.251233f,-0.949592f,0.0f,
-			-0.187503f,-0.251233f,-0.949592f,0.0f,
-			-0.187503f,-0.251233f,-0.949592f,0.0f,
-			-0.143758f,0.670284f,-0.728047f,0.0f,
-			-0.143758f,0.670284f,-0.728047f,0.0f,
-			-0.143758f,0.670284f,-0.728047f,0.0f,
-			-0.143756f,0.670292f,-0.728041f,0.0f,
-			-0.143756f,0.670292f,-0.728041f,0.0f,
-			-0.143756f,0.670292f,-0.728041f,0.0f,
-			0.092596f,0.878360f,0.468945f,0.0f,
-			0.092596f,0.878360f,0.468945f,0.0f,
-			0.092596f,0.878360f,0.468945f,0.0f,
-			0.092593f,0.878365f,0.468936f,0.0f,
-			0.092593f,0.878365f,0.468936f,0.0f,
-			0.092593f,0.878365f,0.468936f,0.0f,
-			0.160573f,0.559364f,0.813221f,0.0f,
-			0.160573f,0.559364f,0.813221f,0.0f,
-			0.160573f,0.559364f,0.813221f,0.0f,
-			0.160575f,0.559359f,0.813224f,0.0f,
-			0.160575f,0.559359f,0.813224f,0.0f,
-			0.160575f,0.559359f,0.813224f,0.0f,
-			0.173336f,-0.298589f,-0.938509f,0.0f,
-			0.173336f,-0.298589f,-0.938509f,0.0f,
-			0.173336f,-0.298589f,-0.938509f,0.0f,
-			0.182301f,-0.251472f,-0.950541f,0.0f,
-			0.182301f,-0.251472f,-0.950541f,0.0f,
-			0.182301f,-0.251472f,-0.950541f,0.0f,
-			0.145942f,0.632172f,-0.760960f,0.0f,
-			0.145942f,0.632172f,-0.760960f,0.0f,
-			0.145942f,0.632172f,-0.760960f,0.0f,
-			0.142554f,0.670402f,-0.728175f,0.0f,
-			0.142554f,0.670402f,-0.728175f,0.0f,
-			0.142554f,0.670402f,-0.728175f,0.0f,
-			-0.093122f,0.874681f,0.475670f,0.0f,
-			-0.093122f,0.874681f,0.475670f,0.0f,
-			-0.093122f,0.874681f,0.475670f,0.0f,
-			-0.092499f,0.878368f,0.468950f,0.0f,
-			-0.092499f,0.878368f,0.468950f,0.0f,
-			-0.092499f,0.878368f,0.468950f,0.0f,
-			-0.160531f,0.558454f,0.813854f,0.0f,
-			-0.160531f,0.558454f,0.813854f,0.0f,
-			-0.160531f,0.558454f,0.813854f,0.0f,
-			-0.160575f,0.559364f,0.813220f,0.0f,
-			-0.160575f,0.559364f,0.813220f,0.0f,
-			-0.160575f,0.559364f,0.813220f,0.0f,
-			0.518257f,-0.378342f,-0.766986f,0.0f,
-			0.518257f,-0.378342f,-0.766986f,0.0f,
-			0.518257f,-0.378342f,-0.766986f,0.0f,
-			0.513090f,-0.392161f,-0.763510f,0.0f,
-			0.513090f,-0.392161f,-0.763510f,0.0f,
-			0.513090f,-0.392161f,-0.763510f,0.0f,
-			0.461243f,0.562288f,-0.686358f,0.0f,
-			0.461243f,0.562288f,-0.686358f,0.0f,
-			0.461243f,0.562288f,-0.686358f,0.0f,
-			0.466371f,0.545980f,-0.695991f,0.0f,
-			0.466371f,0.545980f,-0.695991f,0.0f,
-			0.466371f,0.545980f,-0.695991f,0.0f,
-			-0.274796f,0.869661f,0.410094f,0.0f,
-			-0.274796f,0.869661f,0.410094f,0.0f,
-			-0.274796f,0.869661f,0.410094f,0.0f,
-			-0.275862f,0.868367f,0.412116f,0.0f,
-			-0.275862f,0.868367f,0.412116f,0.0f,
-			-0.275862f,0.868367f,0.412116f,0.0f,
-			-0.461378f,0.558611f,0.689263f,0.0f,
-			-0.461378f,0.558611f,0.689263f,0.0f,
-			-0.461378f,0.558611f,0.689263f,0.0f,
-			-0.461438f,0.558334f,0.689448f,0.0f,
-			-0.461438f,0.558334f,0.689448f,0.0f,
-			-0.461438f,0.558334f,0.689448f,0.0f,
-			0.802458f,-0.327200f,-0.499000f,0.0f,
-			0.802458f,-0.327200f,-0.499000f,0.0f,
-			0.802458f,-0.327200f,-0.499000f,0.0f,
-			0.755792f,-0.433811f,-0.490495f,0.0f,
-			0.755792f,-0.433811f,-0.490495f,0.0f,
-			0.755792f,-0.433811f,-0.490495f,0.0f,
-			0.661067f,0.615575f,-0.429020f,0.0f,
-			0.661067f,0.615575f,-0.429020f,0.0f,
-			0.661067f,0.615575f,-0.429020f,0.0f,
-			0.724994f,0.493031f,-0.480942f,0.0f,
-			0.724994f,0.493031f,-0.480942f,0.0f,
-			0.724994f,0.493031f,-0.480942f,0.0f,
-			-0.404771f,0.874105f,0.268515f,0.0f,
-			-0.404771f,0.874105f,0.268515f,0.0f,
-			-0.404771f,0.874105f,0.268515f,0.0f,
-			-0.417814f,0.864523f,0.279340f,0.0f,
-			-0.417814f,0.864523f,0.279340f,0.0f,
-			-0.417814f,0.864523f,0.279340f,0.0f,
-			-0.688940f,0.559644f,0.460608f,0.0f,
-			-0.688940f,0.559644f,0.460608f,0.0f,
-			-0.688940f,0.559644f,0.460608f,0.0f,
-			-0.689917f,0.557492f,0.461755f,0.0f,
-			-0.689917f,0.557492f,0.461755f,0.0f,
-			-0.689917f,0.557492f,0.461755f,0.0f,
-			0.953284f,-0.252198f,-0.166272f,0.0f,
-			0.953284f,-0.252198f,-0.166272f,0.0f,
-			0.953284f,-0.252198f,-0.166272f,0.0f,
-			0.925801f,-0.335750f,-0.173681f,0.0f,
-			0.925801f,-0.335750f,-0.173681f,0.0f,
-			0.925801f,-0.335750f,-0.173681f,0.0f,
-			0.728782f,0.670958f,-0.136720f,0.0f,
-			0.728782f,0.670958f,-0.136720f,0.0f,
-			0.728782f,0.670958f,-0.136720f,0.0f,
-			0.784200f,0.601453f,-0.152591f,0.0f,
-			0.784200f,0.601453f,-0.152591f,0.0f,
-			0.784200f,0.601453f,-0.152591f,0.0f,
-			-0.469003f,0.878469f,0.091259f,0.0f,
-			-0.469003f,0.878469f,0.091259f,0.0f,
-			-0.469003f,0.878469f,0.091259f,0.0f,
-			-0.480061f,0.872117f,0.094620f,0.0f,
-			-0.480061f,0.872117f,0.094620f,0.0f,
-			-0.480061f,0.872117f,0.094620f,0.0f,
-			-0.813259f,0.559389f,0.160294f,0.0f,
-			-0.813259f,0.559389f,0.160294f,0.0f,
-			-0.813259f,0.559389f,0.160294f,0.0f,
-			-0.814216f,0.557859f,0.160766f,0.0f,
-			-0.814216f,0.557859f,0.160766f,0.0f,
-			-0.814216f,0.557859f,0.160766f,0.0f,
-			0.949603f,-0.251191f,0.187504f,0.0f,
-			0.949603f,-0.251191f,0.187504f,0.0f,
-			0.949603f,-0.251191f,0.187504f,0.0f,
-			0.949596f,-0.251222f,0.187498f,0.0f,
-			0.949596f,-0.251222f,0.187498f,0.0f,
-			0.949596f,-0.251222f,0.187498f,0.0f,
-			0.728042f,0.670291f,0.143752f,0.0f,
-			0.728042f,0.670291f,0.143752f,0.0f,
-			0.728042f,0.670291f,0.143752f,0.0f,
-			0.728049f,0.670283f,0.143753f,0.0f,
-			0.728049f,0.670283f,0.143753f,0.0f,
-			0.728049f,0.670283f,0.143753f,0.0f,
-			-0.468937f,0.878365f,-0.092591f,0.0f,
-			-0.468937f,0.878365f,-0.092591f,0.0f,
-			-0.468937f,0.878365f,-0.092591f,0.0f,
-			-0.468945f,0.878361f,-0.092592f,0.0f,
-			-0.468945f,0.878361f,-0.092592f,0.0f,
-			-0.468945f,0.878361f,-0.092592f,0.0f,
-			-0.813226f,0.559358f,-0.160569f,0.0f,
-			-0.813226f,0.559358f,-0.160569f,0.0f,
-			-0.813226f,0.559358f,-0.160569f,0.0f,
-			-0.813222f,0.559364f,-0.160570f,0.0f,
-			-0.813222f,0.559364f,-0.160570f,0.0f,
-			-0.813222f,0.559364f,-0.160570f,0.0f,
-			0.804194f,-0.252124f,0.538243f,0.0f,
-			0.804194f,-0.252124f,0.538243f,0.0f,
-			0.804194f,-0.252124f,0.538243f,0.0f,
-			0.804194f,-0.252126f,0.538242f,0.0f,
-			0.804194f,-0.252126f,0.538242f,0.0f,
-			0.804194f,-0.252126f,0.538242f,0.0f,
-			0.615622f,0.671744f,0.412032f,0.0f,
-			0.615622f,0.671744f,0.412032f,0.0f,
-			0.615622f,0.671744f,0.412032f,0.0f,
-			0.615611f,0.671757f,0.412026f,0.0f,
-			0.615611f,0.671757f,0.412026f,0.0f,
-			0.615611f,0.671757f,0.412026f,0.0f,
-			-0.396019f,0.879156f,-0.265054f,0.0f,
-			-0.396019f,0.879156f,-0.265054f,0.0f,
-			-0.396019f,0.879156f,-0.265054f,0.0f,
-			-0.396024f,0.879153f,-0.265057f,0.0f,
-			-0.396024f,0.879153f,-0.265057f,0.0f,
-			-0.396024f,0.879153f,-0.265057f,0.0f,
-			-0.688010f,0.560892f,-0.460481f,0.0f,
-			-0.688010f,0.560892f,-0.460481f,0.0f,
-			-0.688010f,0.560892f,-0.460481f,0.0f,
-			-0.688015f,0.560884f,-0.460483f,0.0f,
-			-0.688015f,0.560884f,-0.460483f,0.0f,
-			-0.688015f,0.560884f,-0.460483f,0.0f,
-			0.538237f,-0.252160f,0.804186f,0.0f,
-			0.538237f,-0.252160f,0.804186f,0.0f,
-			0.538237f,-0.252160f,0.804186f,0.0f,
-			0.538238f,-0.252135f,0.804194f,0.0f,
-			0.538238f,-0.252135f,0.804194f,0.0f,
-			0.538238f,-0.252135f,0.804194f,0.0f,
-			0.412022f,0.671758f,0.615612f,0.0f,
-			0.412022f,0.671758f,0.615612f,0.0f,
-			0.412022f,0.671758f,0.615612f,0.0f,
-			0.412022f,0.671759f,0.615612f,0.0f,
-			0.412022f,0.671759f,0.615612f,0.0f,
-			0.412022f,0.671759f,0.615612f,0.0f,
-			-0.265046f,0.879161f,-0.396012f,0.0f,
-			-0.265046f,0.879161f,-0.396012f,0.0f,
-			-0.265046f,0.879161f,-0.396012f,0.0f,
-			-0.265058f,0.879152f,-0.396026f,0.0f,
-			-0.265058f,0.879152f,-0.396026f,0.0f,
-			-0.265058f,0.879152f,-0.396026f,0.0f,
-			-0.460490f,0.560868f,-0.688023f,0.0f,
-			-0.460490f,0.560868f,-0.688023f,0.0f,
-			-0.460490f,0.560868f,-0.688023f,0.0f,
-			-0.460477f,0.560892f,-0.688013f,0.0f,
-			-0.460477f,0.560892f,-0.688013f,0.0f,
-			-0.460477f,0.560892f,-0.688013f,0.0f,
-			0.187497f,-0.251222f,0.949596f,0.0f,
-			0.187497f,-0.251222f,0.949596f,0.0f,
-			0.187497f,-0.251222f,0.949596f,0.0f,
-			0.187498f,-0.251232f,0.949593f,0.0f,
-			0.187498f,-0.251232f,0.949593f,0.0f,
-			0.187498f,-0.251232f,0.949593f,0.0f,
-			0.143743f,0.670341f,0.727998f,0.0f,
-			0.143743f,0.670341f,0.727998f,0.0f,
-			0.143743f,0.670341f,0.727998f,0.0f,
-			0.143756f,0.670293f,0.728039f,0.0f,
-			0.143756f,0.670293f,0.728039f,0.0f,
-			0.143756f,0.670293f,0.728039f,0.0f,
-			-0.092596f,0.878360f,-0.468945f,0.0f,
-			-0.092596f,0.878360f,-0.468945f,0.0f,
-			-0.092596f,0.878360f,-0.468945f,0.0f,
-			-0.092592f,0.878368f,-0.468932f,0.0f,
-			-0.092592f,0.878368f,-0.468932f,0.0f,
-			-0.092592f,0.878368f,-0.468932f,0.0f,
-			-0.160573f,0.559365f,-0.813220f,0.0f,
-			-0.160573f,0.559365f,-0.813220f,0.0f,
-			-0.160573f,0.559365f,-0.813220f,0.0f,
-			-0.160576f,0.559353f,-0.813228f,0.0f,
-			-0.160576f,0.559353f,-0.813228f,0.0f,
-			-0.160576f,0.559353f,-0.813228f,0.0f,
-			-0.187496f,-0.251231f,0.949594f,0.0f,
-			-0.187496f,-0.251231f,0.949594f,0.0f,
-			-0.187496f,-0.251231f,0.949594f,0.0f,
-			-0.187497f,-0.251222f,0.949596f,0.0f,
-			-0.187497f,-0.251222f,0.949596f,0.0f,
-			-0.187497f,-0.251222f,0.949596f,0.0f,
-			-0.143751f,0.670293f,0.728040f,0.0f,
-			-0.143751f,0.670293f,0.728040f,0.0f,
-			-0.143751f,0.670293f,0.728040f,0.0f,
-			-0.143747f,0.670341f,0.727997f,0.0f,
-			-0.143747f,0.670341f,0.727997f,0.0f,
-			-0.143747f,0.670341f,0.727997f,0.0f,
-			0.092594f,0.878365f,-0.468937f,0.0f,
-			0.092594f,0.878365f,-0.468937f,0.0f,
-			0.092594f,0.878365f,-0.468937f,0.0f,
-			0.092595f,0.878360f,-0.468946f,0.0f,
-			0.092595f,0.878360f,-0.468946f,0.0f,
-			0.092595f,0.878360f,-0.468946f,0.0f,
-			0.160574f,0.559358f,-0.813225f,0.0f,
-			0.160574f,0.559358f,-0.813225f,0.0f,
-			0.160574f,0.559358f,-0.813225f,0.0f,
-			0.160574f,0.559365f,-0.813220f,0.0f,
-			0.160574f,0.559365f,-0.813220f,0.0f,
-			0.160574f,0.559365f,-0.813220f,0.0f,
-			-0.538238f,-0.252159f,0.804187f,0.0f,
-			-0.538238f,-0.252159f,0.804187f,0.0f,
-			-0.538238f,-0.252159f,0.804187f,0.0f,
-			-0.538237f,-0.252160f,0.804186f,0.0f,
-			-0.538237f,-0.252160f,0.804186f,0.0f,
-			-0.538237f,-0.252160f,0.804186f,0.0f,
-			-0.412008f,0.671791f,0.615586f,0.0f,
-			-0.412008f,0.671791f,0.615586f,0.0f,
-			-0.412008f,0.671791f,0.615586f,0.0f,
-			-0.412022f,0.671758f,0.615612f,0.0f,
-			-0.412022f,0.671758f,0.615612f,0.0f,
-			-0.412022f,0.671758f,0.615612f,0.0f,
-			0.265065f,0.879143f,-0.396040f,0.0f,
-			0.265065f,0.879143f,-0.396040f,0.0f,
-			0.265065f,0.879143f,-0.396040f,0.0f,
-			0.265057f,0.879153f,-0.396024f,0.0f,
-			0.265057f,0.879153f,-0.396024f,0.0f,
-			0.265057f,0.879153f,-0.396024f,0.0f,
-			0.460481f,0.560892f,-0.688010f,0.0f,
-			0.460481f,0.560892f,-0.688010f,0.0f,
-			0.460481f,0.560892f,-0.688010f,0.0f,
-			0.460483f,0.560883f,-0.688016f,0.0f,
-			0.460483f,0.560883f,-0.688016f,0.0f,
-			0.460483f,0.560883f,-0.688016f,0.0f,
-			-0.804186f,-0.252161f,0.538237f,0.0f,
-			-0.804186f,-0.252161f,0.538237f,0.0f,
-			-0.804186f,-0.252161f,0.538237f,0.0f,
-			-0.804187f,-0.252159f,0.538237f,0.0f,
-			-0.804187f,-0.252159f,0.538237f,0.0f,
-			-0.804187f,-0.252159f,0.538237f,0.0f,
-			-0.615611f,0.671758f,0.412025f,0.0f,
-			-0.615611f,0.671758f,0.412025f,0.0f,
-			-0.615611f,0.671758f,0.412025f,0.0f,
-			-0.615588f,0.671791f,0.412006f,0.0f,
-			-0.615588f,0.671791f,0.412006f,0.0f,
-			-0.615588f,0.671791f,0.412006f,0.0f,
-			0.396025f,0.879153f,-0.265055f,0.0f,
-			0.396025f,0.879153f,-0.265055f,0.0f,
-			0.396025f,0.879153f,-0.265055f,0.0f,
-			0.396039f,0.879144f,-0.265066f,0.0f,
-			0.396039f,0.879144f,-0.265066f,0.0f,
-			0.396039f,0.879144f,-0.265066f,0.0f,
-			0.688015f,0.560883f,-0.460484f,0.0f,
-			0.688015f,0.560883f,-0.460484f,0.0f,
-			0.688015f,0.560883f,-0.460484f,0.0f,
-			0.688011f,0.560892f,-0.460480f,0.0f,
-			0.688011f,0.560892f,-0.460480f,0.0f,
-			0.688011f,0.560892f,-0.460480f,0.0f,
-			-0.949596f,-0.251222f,0.187496f,0.0f,
-			-0.949596f,-0.251222f,0.187496f,0.0f,
-			-0.949596f,-0.251222f,0.187496f,0.0f,
-			-0.949593f,-0.251232f,0.187497f,0.0f,
-			-0.949593f,-0.251232f,0.187497f,0.0f,
-			-0.949593f,-0.251232f,0.187497f,0.0f,
-			-0.727998f,0.670341f,0.143743f,0.0f,
-			-0.727998f,0.670341f,0.143743f,0.0f,
-			-0.727998f,0.670341f,0.143743f,0.0f,
-			-0.728039f,0.670293f,0.143755f,0.0f,
-			-0.728039f,0.670293f,0.143755f,0.0f,
-			-0.728039f,0.670293f,0.143755f,0.0f,
-			0.468945f,0.878360f,-0.092596f,0.0f,
-			0.468945f,0.878360f,-0.092596f,0.0f,
-			0.468945f,0.878360f,-0.092596f,0.0f,
-			0.468937f,0.878365f,-0.092593f,0.0f,
-			0.468937f,0.878365f,-0.092593f,0.0f,
-			0.468937f,0.878365f,-0.092593f,0.0f,
-			0.813220f,0.559365f,-0.160573f,0.0f,
-			0.813220f,0.559365f,-0.160573f,0.0f,
-			0.813220f,0.559365f,-0.160573f,0.0f,
-			0.813225f,0.559358f,-0.160575f,0.0f,
-			0.813225f,0.559358f,-0.160575f,0.0f,
-			0.813225f,0.559358f,-0.160575f,0.0f,
-			0.891685f,0.417010f,0.176068f,0.0f,
-			0.891685f,0.417010f,0.176068f,0.0f,
-			0.891685f,0.417010f,0.176068f,0.0f,
-			0.891688f,0.417006f,0.176065f,0.0f,
-			0.891688f,0.417006f,0.176065f,0.0f,
-			0.891688f,0.417006f,0.176065f,0.0f,
-			0.908512f,0.377395f,0.179387f,0.0f,
-			0.908512f,0.377395f,0.179387f,0.0f,
-			0.908512f,0.377395f,0.179387f,0.0f,
-			0.908512f,0.377394f,0.179387f,0.0f,
-			0.908512f,0.377394f,0.179387f,0.0f,
-			0.908512f,0.377394f,0.179387f,0.0f,
-			0.939899f,0.286614f,0.185584f,0.0f,
-			0.939899f,0.286614f,0.185584f,0.0f,
-			0.939899f,0.286614f,0.185584f,0.0f,
-			0.939898f,0.286618f,0.185586f,0.0f,
-			0.939898f,0.286618f,0.185586f,0.0f,
-			0.939898f,0.286618f,0.185586f,0.0f,
-			0.974035f,0.119442f,0.192326f,0.0f,
-			0.974035f,0.119442f,0.192326f,0.0f,
-			0.974035f,0.119442f,0.192326f,0.0f,
-			0.974034f,0.119446f,0.192328f,0.0f,
-			0.974034f,0.119446f,0.192328f,0.0f,
-			0.974034f,0.119446f,0.192328f,0.0f,
-			0.754815f,0.418372f,0.505191f,0.0f,
-			0.754815f,0.418372f,0.505191f,0.0f,
-			0.754815f,0.418372f,0.505191f,0.0f,
-			0.754813f,0.418375f,0.505193f,0.0f,
-			0.754813f,0.418375f,0.505193f,0.0f,
-			0.754813f,0.418375f,0.505193f,0.0f,
-			0.769152f,0.378679f,0.514789f,0.0f,
-			0.769152f,0.378679f,0.514789f,0.0f,
-			0.769152f,0.378679f,0.514789f,0.0f,
-			0.769154f,0.378675f,0.514788f,0.0f,
-			0.769154f,0.378675f,0.514788f,0.0f,
-			0.769154f,0.378675f,0.514788f,0.0f,
-			0.795917f,0.287657f,0.532700f,0.0f,
-			0.795917f,0.287657f,0.532700f,0.0f,
-			0.795917f,0.287657f,0.532700f,0.0f,
-			0.795917f,0.287658f,0.532701f,0.0f,
-			0.795917f,0.287658f,0.532701f,0.0f,
-			0.795917f,0.287658f,0.532701f,0.0f,
-			0.825045f,0.119914f,0.552196f,0.0f,
-			0.825045f,0.119914f,0.552196f,0.0f,
-			0.825045f,0.119914f,0.552196f,0.0f,
-			0.825047f,0.119909f,0.552195f,0.0f,
-			0.825047f,0.119909f,0.552195f,0.0f,
-			0.825047f,0.119909f,0.552195f,0.0f,
-			0.505192f,0.418372f,0.754816f,0.0f,
-			0.505192f,0.418372f,0.754816f,0.0f,
-			0.505192f,0.418372f,0.754816f,0.0f,
-			0.505191f,0.418372f,0.754816f,0.0f,
-			0.505191f,0.418372f,0.754816f,0.0f,
-			0.505191f,0.418372f,0.754816f,0.0f,
-			0.514787f,0.378679f,0.769153f,0.0f,
-			0.514787f,0.378679f,0.769153f,0.0f,
-			0.514787f,0.378679f,0.769153f,0.0f,
-			0.514787f,0.378679f,0.769153f,0.0f,
-			0.514787f,0.378679f,0.769153f,0.0f,
-			0.514787f,0.378679f,0.769153f,0.0f,
-			0.532700f,0.287657f,0.795917f,0.0f,
-			0.532700f,0.287657f,0.795917f,0.0f,
-			0.532700f,0.287657f,0.795917f,0.0f,
-			0.532699f,0.287659f,0.795917f,0.0f,
-			0.532699f,0.287659f,0.795917f,0.0f,
-			0.532699f,0.287659f,0.795917f,0.0f,
-			0.552195f,0.119918f,0.825046f,0.0f,
-			0.552195f,0.119918f,0.825046f,0.0f,
-			0.552195f,0.119918f,0.825046f,0.0f,
-			0.552197f,0.119914f,0.825045f,0.0f,
-			0.552197f,0.119914f,0.825045f,0.0f,
-			0.552197f,0.119914f,0.825045f,0.0f,
-			0.176068f,0.417005f,0.891688f,0.0f,
-			0.176068f,0.417005f,0.891688f,0.0f,
-			0.176068f,0.417005f,0.891688f,0.0f,
-			0.176065f,0.417009f,0.891687f,0.0f,
-			0.176065f,0.417009f,0.891687f,0.0f,
-			0.176065f,0.417009f,0.891687f,0.0f,
-			0.179388f,0.377395f,0.908512f,0.0f,
-			0.179388f,0.377395f,0.908512f,0.0f,
-			0.179388f,0.377395f,0.908512f,0.0f,
-			0.179387f,0.377396f,0.908511f,0.0f,
-			0.179387f,0.377396f,0.908511f,0.0f,
-			0.179387f,0.377396f,0.908511f,0.0f,
-			0.185584f,0.286618f,0.939898f,0.0f,
-			0.185584f,0.286618f,0.939898f,0.0f,
-			0.185584f,0.286618f,0.939898f,0.0f,
-			0.185586f,0.286614f,0.939899f,0.0f,
-			0.185586f,0.286614f,0.939899f,0.0f,
-			0.185586f,0.286614f,0.939899f,0.0f,
-			0.192326f,0.119446f,0.974035f,0.0f,
-			0.192326f,0.119446f,0.974035f,0.0f,
-			0.192326f,0.119446f,0.974035f,0.0f,
-			0.192324f,0.119452f,0.974034f,0.0f,
-			0.192324f,0.119452f,0.974034f,0.0f,
-			0.192324f,0.119452f,0.974034f,0.0f,
-			-0.176068f,0.417010f,0.891685f,0.0f,
-			-0.176068f,0.417010f,0.891685f,0.0f,
-			-0.176068f,0.417010f,0.891685f,0.0f,
-			-0.176065f,0.417006f,0.891688f,0.0f,
-			-0.176065f,0.417006f,0.891688f,0.0f,
-			-0.176065f,0.417006f,0.891688f,0.0f,
-			-0.179387f,0.377396f,0.908511f,0.0f,
-			-0.179387f,0.377396f,0.908511f,0.0f,
-			-0.179387f,0.377396f,0.908511f,0.0f,
-			-0.179386f,0.377395f,0.908512f,0.0f,
-			-0.179386f,0.377395f,0.908512f,0.0f,
-			-0.179386f,0.377395f,0.908512f,0.0f,
-			-0.185584f,0.286612f,0.939900f,0.0f,
-			-0.185584f,0.286612f,0.939900f,0.0f,
-			-0.185584f,0.286612f,0.939900f,0.0f,
-			-0.185586f,0.286617f,0.939898f,0.0f,
-			-0.185586f,0.286617f,0.939898f,0.0f,
-			-0.185586f,0.286617f,0.939898f,0.0f,
-			-0.192326f,0.119452f,0.974034f,0.0f,
-			-0.192326f,0.119452f,0.974034f,0.0f,
-			-0.192326f,0.119452f,0.974034f,0.0f,
-			-0.192324f,0.119446f,0.974035f,0.0f,
-			-0.192324f,0.119446f,0.974035f,0.0f,
-			-0.192324f,0.119446f,0.974035f,0.0f,
-			-0.505189f,0.418372f,0.754817f,0.0f,
-			-0.505189f,0.418372f,0.754817f,0.0f,
-			-0.505189f,0.418372f,0.754817f,0.0f,
-			-0.505190f,0.418375f,0.754815f,0.0f,
-			-0.505190f,0.418375f,0.754815f,0.0f,
-			-0.505190f,0.418375f,0.754815f,0.0f,
-			-0.514788f,0.378675f,0.769155f,0.0f,
-			-0.514788f,0.378675f,0.769155f,0.0f,
-			-0.514788f,0.378675f,0.769155f,0.0f,
-			-0.514789f,0.378679f,0.769152f,0.0f,
-			-0.514789f,0.378679f,0.769152f,0.0f,
-			-0.514789f,0.378679f,0.769152f,0.0f,
-			-0.532701f,0.287664f,0.795914f,0.0f,
-			-0.532701f,0.287664f,0.795914f,0.0f,
-			-0.532701f,0.287664f,0.795914f,0.0f,
-			-0.532698f,0.287653f,0.795920f,0.0f,
-			-0.532698f,0.287653f,0.795920f,0.0f,
-			-0.532698f,0.287653f,0.795920f,0.0f,
-			-0.552193f,0.119913f,0.825048f,0.0f,
-			-0.552193f,0.119913f,0.825048f,0.0f,
-			-0.552193f,0.119913f,0.825048f,0.0f,
-			-0.552194f,0.119918f,0.825046f,0.0f,
-			-0.552194f,0.119918f,0.825046f,0.0f,
-			-0.552194f,0.119918f,0.825046f,0.0f,
-			-0.754816f,0.418370f,0.505192f,0.0f,
-			-0.754816f,0.418370f,0.505192f,0.0f,
-			-0.754816f,0.418370f,0.505192f,0.0f,
-			-0.754816f,0.418372f,0.505190f,0.0f,
-			-0.754816f,0.418372f,0.505190f,0.0f,
-			-0.754816f,0.418372f,0.505190f,0.0f,
-			-0.769155f,0.378676f,0.514786f,0.0f,
-			-0.769155f,0.378676f,0.514786f,0.0f,
-			-0.769155f,0.378676f,0.514786f,0.0f,
-			-0.769155f,0.378673f,0.514789f,0.0f,
-			-0.769155f,0.378673f,0.514789f,0.0f,
-			-0.769155f,0.378673f,0.514789f,0.0f,
-			-0.795917f,0.287657f,0.532700f,0.0f,
-			-0.795917f,0.287657f,0.532700f,0.0f,
-			-0.795917f,0.287657f,0.532700f,0.0f,
-			-0.795917f,0.287663f,0.532696f,0.0f,
-			-0.795917f,0.287663f,0.532696f,0.0f,
-			-0.795917f,0.287663f,0.532696f,0.0f,
-			-0.825047f,0.119918f,0.552193f,0.0f,
-			-0.825047f,0.119918f,0.552193f,0.0f,
-			-0.825047f,0.119918f,0.552193f,0.0f,
-			-0.825047f,0.119914f,0.552195f,0.0f,
-			-0.825047f,0.119914f,0.552195f,0.0f,
-			-0.825047f,0.119914f,0.552195f,0.0f,
-			-0.891688f,0.417006f,0.176063f,0.0f,
-			-0.891688f,0.417006f,0.176063f,0.0f,
-			-0.891688f,0.417006f,0.176063f,0.0f,
-			-0.891689f,0.417003f,0.176065f,0.0f,
-			-0.891689f,0.417003f,0.176065f,0.0f,
-			-0.891689f,0.417003f,0.176065f,0.0f,
-			-0.908509f,0.377401f,0.179387f,0.0f,
-			-0.908509f,0.377401f,0.179387f,0.0f,
-			-0.908509f,0.377401f,0.179387f,0.0f,
-			-0.908511f,0.377395f,0.179391f,0.0f,
-			-0.908511f,0.377395f,0.179391f,0.0f,
-			-0.908511f,0.377395f,0.179391f,0.0f,
-			-0.939900f,0.286610f,0.185589f,0.0f,
-			-0.939900f,0.286610f,0.185589f,0.0f,
-			-0.939900f,0.286610f,0.185589f,0.0f,
-			-0.939899f,0.286614f,0.185586f,0.0f,
-			-0.939899f,0.286614f,0.185586f,0.0f,
-			-0.939899f,0.286614f,0.185586f,0.0f,
-			-0.974035f,0.119445f,0.192327f,0.0f,
-			-0.974035f,0.119445f,0.192327f,0.0f,
-			-0.974035f,0.119445f,0.192327f,0.0f,
-			-0.974034f,0.119452f,0.192324f,0.0f,
-			-0.974034f,0.119452f,0.192324f,0.0f,
-			-0.974034f,0.119452f,0.192324f,0.0f,
-			-0.891690f,0.417003f,-0.176063f,0.0f,
-			-0.891690f,0.417003f,-0.176063f,0.0f,
-			-0.891690f,0.417003f,-0.176063f,0.0f,
-			-0.891688f,0.417006f,-0.176065f,0.0f,
-			-0.891688f,0.417006f,-0.176065f,0.0f,
-			-0.891688f,0.417006f,-0.176065f,0.0f,
-			-0.908512f,0.377395f,-0.179387f,0.0f,
-			-0.908512f,0.377395f,-0.179387f,0.0f,
-			-0.908512f,0.377395f,-0.179387f,0.0f,
-			-0.908508f,0.377401f,-0.179390f,0.0f,
-			-0.908508f,0.377401f,-0.179390f,0.0f,
-			-0.908508f,0.377401f,-0.179390f,0.0f,
-			-0.939899f,0.286614f,-0.185588f,0.0f,
-			-0.939899f,0.286614f,-0.185588f,0.0f,
-			-0.939899f,0.286614f,-0.185588f,0.0f,
-			-0.939900f,0.286610f,-0.185586f,0.0f,
-			-0.939900f,0.286610f,-0.185586f,0.0f,
-			-0.939900f,0.286610f,-0.185586f,0.0f,
-			-0.974034f,0.119452f,-0.192326f,0.0f,
-			-0.974034f,0.119452f,-0.192326f,0.0f,
-			-0.974034f,0.119452f,-0.192326f,0.0f,
-			-0.974035f,0.119445f,-0.192324f,0.0f,
-			-0.974035f,0.119445f,-0.192324f,0.0f,
-			-0.974035f,0.119445f,-0.192324f,0.0f,
-			-0.754815f,0.418373f,-0.505191f,0.0f,
-			-0.754815f,0.418373f,-0.505191f,0.0f,
-			-0.754815f,0.418373f,-0.505191f,0.0f,
-			-0.754818f,0.418370f,-0.505190f,0.0f,
-			-0.754818f,0.418370f,-0.505190f,0.0f,
-			-0.754818f,0.418370f,-0.505190f,0.0f,
-			-0.769156f,0.378673f,-0.514787f,0.0f,
-			-0.769156f,0.378673f,-0.514787f,0.0f,
-			-0.769156f,0.378673f,-0.514787f,0.0f,
-			-0.769154f,0.378676f,-0.514788f,0.0f,
-			-0.769154f,0.378676f,-0.514788f,0.0f,
-			-0.769154f,0.378676f,-0.514788f,0.0f,
-			-0.795917f,0.287659f,-0.532700f,0.0f,
-			-0.795917f,0.287659f,-0.532700f,0.0f,
-			-0.795917f,0.287659f,-0.532700f,0.0f,
-			-0.795917f,0.287658f,-0.532699f,0.0f,
-			-0.795917f,0.287658f,-0.532699f,0.0f,
-			-0.795917f,0.287658f,-0.532699f,0.0f,
-			-0.825046f,0.119914f,-0.552195f,0.0f,
-			-0.825046f,0.119914f,-0.552195f,0.0f,
-			-0.825046f,0.119914f,-0.552195f,0.0f,
-			-0.825045f,0.119918f,-0.552196f,0.0f,
-			-0.825045f,0.119918f,-0.552196f,0.0f,
-			-0.825045f,0.119918f,-0.552196f,0.0f,
-			-0.505188f,0.418376f,-0.754816f,0.0f,
-			-0.505188f,0.418376f,-0.754816f,0.0f,
-			-0.505188f,0.418376f,-0.754816f,0.0f,
-			-0.505191f,0.418373f,-0.754816f,0.0f,
-			-0.505191f,0.418373f,-0.754816f,0.0f,
-			-0.505191f,0.418373f,-0.754816f,0.0f,
-			-0.514787f,0.378679f,-0.769153f,0.0f,
-			-0.514787f,0.378679f,-0.769153f,0.0f,
-			-0.514787f,0.378679f,-0.769153f,0.0f,
-			-0.514790f,0.378675f,-0.769153f,0.0f,
-			-0.514790f,0.378675f,-0.769153f,0.0f,
-			-0.514790f,0.378675f,-0.769153f,0.0f,
-			-0.532703f,0.287653f,-0.795917f,0.0f,
-			-0.532703f,0.287653f,-0.795917f,0.0f,
-			-0.532703f,0.287653f,-0.795917f,0.0f,
-			-0.532701f,0.287657f,-0.795917f,0.0f,
-			-0.532701f,0.287657f,-0.795917f,0.0f,
-			-0.532701f,0.287657f,-0.795917f,0.0f,
-			-0.552197f,0.119909f,-0.825046f,0.0f,
-			-0.552197f,0.119909f,-0.825046f,0.0f,
-			-0.552197f,0.119909f,-0.825046f,0.0f,
-			-0.552195f,0.119914f,-0.825047f,0.0f,
-			-0.552195f,0.119914f,-0.825047f,0.0f,
-			-0.552195f,0.119914f,-0.825047f,0.0f,
-			-0.176069f,0.417006f,-0.891687f,0.0f,
-			-0.176069f,0.417006f,-0.891687f,0.0f,
-			-0.176069f,0.417006f,-0.891687f,0.0f,
-			-0.176065f,0.417010f,-0.891686f,0.0f,
-			-0.176065f,0.417010f,-0.891686f,0.0f,
-			-0.176065f,0.417010f,-0.891686f,0.0f,
-			-0.179387f,0.377394f,-0.908512f,0.0f,
-			-0.179387f,0.377394f,-0.908512f,0.0f,
-			-0.179387f,0.377394f,-0.908512f,0.0f,
-			-0.179386f,0.377396f,-0.908511f,0.0f,
-			-0.179386f,0.377396f,-0.908511f,0.0f,
-			-0.179386f,0.377396f,-0.908511f,0.0f,
-			-0.185583f,0.286618f,-0.939898f,0.0f,
-			-0.185583f,0.286618f,-0.939898f,0.0f,
-			-0.185583f,0.286618f,-0.939898f,0.0f,
-			-0.185586f,0.286613f,-0.939899f,0.0f,
-			-0.185586f,0.286613f,-0.939899f,0.0f,
-			-0.185586f,0.286613f,-0.939899f,0.0f,
-			-0.192326f,0.119446f,-0.974034f,0.0f,
-			-0.192326f,0.119446f,-0.974034f,0.0f,
-			-0.192326f,0.119446f,-0.974034f,0.0f,
-			-0.192328f,0.119441f,-0.974035f,0.0f,
-			-0.192328f,0.119441f,-0.974035f,0.0f,
-			-0.192328f,0.119441f,-0.974035f,0.0f,
-			0.176068f,0.417009f,-0.891686f,0.0f,
-			0.176068f,0.417009f,-0.891686f,0.0f,
-			0.176068f,0.417009f,-0.891686f,0.0f,
-			0.176066f,0.417006f,-0.891688f,0.0f,
-			0.176066f,0.417006f,-0.891688f,0.0f,
-			0.176066f,0.417006f,-0.891688f,0.0f,
-			0.179388f,0.377396f,-0.908511f,0.0f,
-			0.179388f,0.377396f,-0.908511f,0.0f,
-			0.179388f,0.377396f,-0.908511f,0.0f,
-			0.179386f,0.377394f,-0.908512f,0.0f,
-			0.179386f,0.377394f,-0.908512f,0.0f,
-			0.179386f,0.377394f,-0.908512f,0.0f,
-			0.185584f,0.286614f,-0.939899f,0.0f,
-			0.185584f,0.286614f,-0.939899f,0.0f,
-			0.185584f,0.286614f,-0.939899f,0.0f,
-			0.185586f,0.286618f,-0.939898f,0.0f,
-			0.185586f,0.286618f,-0.939898f,0.0f,
-			0.185586f,0.286618f,-0.939898f,0.0f,
-			0.192326f,0.119441f,-0.974035f,0.0f,
-			0.192326f,0.119441f,-0.974035f,0.0f,
-			0.192326f,0.119441f,-0.974035f,0.0f,
-			0.192328f,0.119446f,-0.974034f,0.0f,
-			0.192328f,0.119446f,-0.974034f,0.0f,
-			0.192328f,0.119446f,-0.974034f,0.0f,
-			0.505191f,0.418372f,-0.754815f,0.0f,
-			0.505191f,0.418372f,-0.754815f,0.0f,
-			0.505191f,0.418372f,-0.754815f,0.0f,
-			0.505191f,0.418372f,-0.754816f,0.0f,
-			0.505191f,0.418372f,-0.754816f,0.0f,
-			0.505191f,0.418372f,-0.754816f,0.0f,
-			0.514787f,0.378679f,-0.769153f,0.0f,
-			0.514787f,0.378679f,-0.769153f,0.0f,
-			0.514787f,0.378679f,-0.769153f,0.0f,
-			0.514787f,0.378679f,-0.769153f,0.0f,
-			0.514787f,0.378679f,-0.769153f,0.0f,
-			0.514787f,0.378679f,-0.769153f,0.0f,
-			0.532701f,0.287652f,-0.795918f,0.0f,
-			0.532701f,0.287652f,-0.795918f,0.0f,
-			0.532701f,0.287652f,-0.795918f,0.0f,
-			0.532703f,0.287658f,-0.795915f,0.0f,
-			0.532703f,0.287658f,-0.795915f,0.0f,
-			0.532703f,0.287658f,-0.795915f,0.0f,
-			0.552198f,0.119914f,-0.825044f,0.0f,
-			0.552198f,0.119914f,-0.825044f,0.0f,
-			0.552198f,0.119914f,-0.825044f,0.0f,
-			0.552197f,0.119909f,-0.825046f,0.0f,
-			0.552197f,0.119909f,-0.825046f,0.0f,
-			0.552197f,0.119909f,-0.825046f,0.0f,
-			0.754814f,0.418376f,-0.505190f,0.0f,
-			0.754814f,0.418376f,-0.505190f,0.0f,
-			0.754814f,0.418376f,-0.505190f,0.0f,
-			0.754814f,0.418373f,-0.505193f,0.0f,
-			0.754814f,0.418373f,-0.505193f,0.0f,
-			0.754814f,0.418373f,-0.505193f,0.0f,
-			0.769153f,0.378675f,-0.514790f,0.0f,
-			0.769153f,0.378675f,-0.514790f,0.0f,
-			0.769153f,0.378675f,-0.514790f,0.0f,
-			0.769153f,0.378679f,-0.514787f,0.0f,
-			0.769153f,0.378679f,-0.514787f,0.0f,
-			0.769153f,0.378679f,-0.514787f,0.0f,
-			0.795917f,0.287658f,-0.532700f,0.0f,
-			0.795917f,0.287658f,-0.532700f,0.0f,
-			0.795917f,0.287658f,-0.532700f,0.0f,
-			0.795916f,0.287652f,-0.532704f,0.0f,
-			0.795916f,0.287652f,-0.532704f,0.0f,
-			0.795916f,0.287652f,-0.532704f,0.0f,
-			0.825044f,0.119909f,-0.552199f,0.0f,
-			0.825044f,0.119909f,-0.552199f,0.0f,
-			0.825044f,0.119909f,-0.552199f,0.0f,
-			0.825045f,0.119914f,-0.552197f,0.0f,
-			0.825045f,0.119914f,-0.552197f,0.0f,
-			0.825045f,0.119914f,-0.552197f,0.0f,
-			0.891687f,0.417006f,-0.176068f,0.0f,
-			0.891687f,0.417006f,-0.176068f,0.0f,
-			0.891687f,0.417006f,-0.176068f,0.0f,
-			0.891686f,0.417010f,-0.176065f,0.0f,
-			0.891686f,0.417010f,-0.176065f,0.0f,
-			0.891686f,0.417010f,-0.176065f,0.0f,
-			0.908512f,0.377394f,-0.179387f,0.0f,
-			0.908512f,0.377394f,-0.179387f,0.0f,
-			0.908512f,0.377394f,-0.179387f,0.0f,
-			0.908512f,0.377395f,-0.179386f,0.0f,
-			0.908512f,0.377395f,-0.179386f,0.0f,
-			0.908512f,0.377395f,-0.179386f,0.0f,
-			0.939898f,0.286618f,-0.185584f,0.0f,
-			0.939898f,0.286618f,-0.185584f,0.0f,
-			0.939898f,0.286618f,-0.185584f,0.0f,
-			0.939899f,0.286614f,-0.185586f,0.0f,
-			0.939899f,0.286614f,-0.185586f,0.0f,
-			0.939899f,0.286614f,-0.185586f,0.0f,
-			0.974035f,0.119446f,-0.192326f,0.0f,
-			0.974035f,0.119446f,-0.192326f,0.0f,
-			0.974035f,0.119446f,-0.192326f,0.0f,
-			0.974035f,0.119442f,-0.192328f,0.0f,
-			0.974035f,0.119442f,-0.192328f,0.0f,
-			0.974035f,0.119442f,-0.192328f,0.0f,
-			0.949834f,-0.250282f,0.187549f,0.0f,
-			0.949834f,-0.250282f,0.187549f,0.0f,
-			0.949834f,-0.250282f,0.187549f,0.0f,
-			0.949832f,-0.250292f,0.187545f,0.0f,
-			0.949832f,-0.250292f,0.187545f,0.0f,
-			0.949832f,-0.250292f,0.187545f,0.0f,
-			0.777522f,-0.609828f,0.153522f,0.0f,
-			0.777522f,-0.609828f,0.153522f,0.0f,
-			0.777522f,-0.609828f,0.153522f,0.0f,
-			0.777523f,-0.609826f,0.153524f,0.0f,
-			0.777523f,-0.609826f,0.153524f,0.0f,
-			0.777523f,-0.609826f,0.153524f,0.0f,
-			0.649201f,-0.749737f,0.128186f,0.0f,
-			0.649201f,-0.749737f,0.128186f,0.0f,
-			0.649201f,-0.749737f,0.128186f,0.0f,
-			0.649204f,-0.749735f,0.128188f,0.0f,
-			0.649204f,-0.749735f,0.128188f,0.0f,
-			0.649204f,-0.749735f,0.128188f,0.0f,
-			0.730688f,-0.667292f,0.144277f,0.0f,
-			0.730688f,-0.667292f,0.144277f,0.0f,
-			0.730688f,-0.667292f,0.144277f,0.0f,
-			0.730691f,-0.667289f,0.144279f,0.0f,
-			0.730691f,-0.667289f,0.144279f,0.0f,
-			0.730691f,-0.667289f,0.144279f,0.0f,
-			0.804392f,-0.251218f,0.538371f,0.0f,
-			0.804392f,-0.251218f,0.538371f,0.0f,
-			0.804392f,-0.251218f,0.538371f,0.0f,
-			0.804392f,-0.251211f,0.538374f,0.0f,
-			0.804392f,-0.251211f,0.538374f,0.0f,
-			0.804392f,-0.251211f,0.538374f,0.0f,
-			0.657660f,-0.611340f,0.440167f,0.0f,
-			0.657660f,-0.611340f,0.440167f,0.0f,
-			0.657660f,-0.611340f,0.440167f,0.0f,
-			0.657658f,-0.611344f,0.440164f,0.0f,
-			0.657658f,-0.611344f,0.440164f,0.0f,
-			0.657658f,-0.611344f,0.440164f,0.0f,
-			0.548707f,-0.751034f,0.367244f,0.0f,
-			0.548707f,-0.751034f,0.367244f,0.0f,
-			0.548707f,-0.751034f,0.367244f,0.0f,
-			0.548707f,-0.751034f,0.367244f,0.0f,
-			0.548707f,-0.751034f,0.367244f,0.0f,
-			0.548707f,-0.751034f,0.367244f,0.0f,
-			0.617860f,-0.668763f,0.413528f,0.0f,
-			0.617860f,-0.668763f,0.413528f,0.0f,
-			0.617860f,-0.668763f,0.413528f,0.0f,
-			0.617862f,-0.668760f,0.413529f,0.0f,
-			0.617862f,-0.668760f,0.413529f,0.0f,
-			0.617862f,-0.668760f,0.413529f,0.0f,
-			0.538372f,-0.251225f,0.804389f,0.0f,
-			0.538372f,-0.251225f,0.804389f,0.0f,
-			0.538372f,-0.251225f,0.804389f,0.0f,
-			0.538371f,-0.251221f,0.804391f,0.0f,
-			0.538371f,-0.251221f,0.804391f,0.0f,
-			0.538371f,-0.251221f,0.804391f,0.0f,
-			0.440167f,-0.611337f,0.657662f,0.0f,
-			0.440167f,-0.611337f,0.657662f,0.0f,
-			0.440167f,-0.611337f,0.657662f,0.0f,
-			0.440167f,-0.611337f,0.657663f,0.0f,
-			0.440167f,-0.611337f,0.657663f,0.0f,
-			0.440167f,-0.611337f,0.657663f,0.0f,
-			0.367244f,-0.751034f,0.548707f,0.0f,
-			0.367244f,-0.751034f,0.548707f,0.0f,
-			0.367244f,-0.751034f,0.548707f,0.0f,
-			0.367244f,-0.751035f,0.548707f,0.0f,
-			0.367244f,-0.751035f,0.548707f,0.0f,
-			0.367244f,-0.751035f,0.548707f,0.0f,
-			0.413527f,-0.668765f,0.617858f,0.0f,
-			0.413527f,-0.668765f,0.617858f,0.0f,
-			0.413527f,-0.668765f,0.617858f,0.0f,
-			0.413526f,-0.668768f,0.617856f,0.0f,
-			0.413526f,-0.668768f,0.617856f,0.0f,
-			0.413526f,-0.668768f,0.617856f,0.0f,
-			0.187545f,-0.250282f,0.949835f,0.0f,
-			0.187545f,-0.250282f,0.949835f,0.0f,
-			0.187545f,-0.250282f,0.949835f,0.0f,
-			0.187549f,-0.250294f,0.949831f,0.0f,
-			0.187549f,-0.250294f,0.949831f,0.0f,
-			0.187549f,-0.250294f,0.949831f,0.0f,
-			0.153526f,-0.609826f,0.777523f,0.0f,
-			0.153526f,-0.609826f,0.777523f,0.0f,
-			0.153526f,-0.609826f,0.777523f,0.0f,
-			0.153525f,-0.609821f,0.777527f,0.0f,
-			0.153525f,-0.609821f,0.777527f,0.0f,
-			0.153525f,-0.609821f,0.777527f,0.0f,
-			0.128186f,-0.749741f,0.649197f,0.0f,
-			0.128186f,-0.749741f,0.649197f,0.0f,
-			0.128186f,-0.749741f,0.649197f,0.0f,
-			0.128184f,-0.749737f,0.649202f,0.0f,
-			0.128184f,-0.749737f,0.649202f,0.0f,
-			0.128184f,-0.749737f,0.649202f,0.0f,
-			0.144274f,-0.667289f,0.730692f,0.0f,
-			0.144274f,-0.667289f,0.730692f,0.0f,
-			0.144274f,-0.667289f,0.730692f,0.0f,
-			0.144276f,-0.667305f,0.730676f,0.0f,
-			0.144276f,-0.667305f,0.730676f,0.0f,
-			0.144276f,-0.667305f,0.730676f,0.0f,
-			-0.187545f,-0.250292f,0.949832f,0.0f,
-			-0.187545f,-0.250292f,0.949832f,0.0f,
-			-0.187545f,-0.250292f,0.949832f,0.0f,
-			-0.187550f,-0.250282f,0.949834f,0.0f,
-			-0.187550f,-0.250282f,0.949834f,0.0f,
-			-0.187550f,-0.250282f,0.949834f,0.0f,
-			-0.153527f,-0.609821f,0.777527f,0.0f,
-			-0.153527f,-0.609821f,0.777527f,0.0f,
-			-0.153527f,-0.609821f,0.777527f,0.0f,
-			-0.153524f,-0.609826f,0.777524f,0.0f,
-			-0.153524f,-0.609826f,0.777524f,0.0f,
-			-0.153524f,-0.609826f,0.777524f,0.0f,
-			-0.128186f,-0.749737f,0.649202f,0.0f,
-			-0.128186f,-0.749737f,0.649202f,0.0f,
-			-0.128186f,-0.749737f,0.649202f,0.0f,
-			-0.128183f,-0.749742f,0.649197f,0.0f,
-			-0.128183f,-0.749742f,0.649197f,0.0f,
-			-0.128183f,-0.749742f,0.649197f,0.0f,
-			-0.144271f,-0.667308f,0.730675f,0.0f,
-			-0.144271f,-0.667308f,0.730675f,0.0f,
-			-0.144271f,-0.667308f,0.730675f,0.0f,
-			-0.144279f,-0.667289f,0.730691f,0.0f,
-			-0.144279f,-0.667289f,0.730691f,0.0f,
-			-0.144279f,-0.667289f,0.730691f,0.0f,
-			-0.538370f,-0.251221f,0.804392f,0.0f,
-			-0.538370f,-0.251221f,0.804392f,0.0f,
-			-0.538370f,-0.251221f,0.804392f,0.0f,
-			-0.538371f,-0.251219f,0.804391f,0.0f,
-			-0.538371f,-0.251219f,0.804391f,0.0f,
-			-0.538371f,-0.251219f,0.804391f,0.0f,
-			-0.440167f,-0.611337f,0.657662f,0.0f,
-			-0.440167f,-0.611337f,0.657662f,0.0f,
-			-0.440167f,-0.611337f,0.657662f,0.0f,
-			-0.440167f,-0.611337f,0.657662f,0.0f,
-			-0.440167f,-0.611337f,0.657662f,0.0f,
-			-0.440167f,-0.611337f,0.657662f,0.0f,
-			-0.367244f,-0.751034f,0.548707f,0.0f,
-			-0.367244f,-0.751034f,0.548707f,0.0f,
-			-0.367244f,-0.751034f,0.548707f,0.0f,
-			-0.367244f,-0.751034f,0.548707f,0.0f,
-			-0.367244f,-0.751034f,0.548707f,0.0f,
-			-0.367244f,-0.751034f,0.548707f,0.0f,
-			-0.413525f,-0.668768f,0.617857f,0.0f,
-			-0.413525f,-0.668768f,0.617857f,0.0f,
-			-0.413525f,-0.668768f,0.617857f,0.0f,
-			-0.413520f,-0.668775f,0.617852f,0.0f,
-			-0.413520f,-0.668775f,0.617852f,0.0f,
-			-0.413520f,-0.668775f,0.617852f,0.0f,
-			-0.804394f,-0.251210f,0.538372f,0.0f,
-			-0.804394f,-0.251210f,0.538372f,0.0f,
-			-0.804394f,-0.251210f,0.538372f,0.0f,
-			-0.804390f,-0.251218f,0.538373f,0.0f,
-			-0.804390f,-0.251218f,0.538373f,0.0f,
-			-0.804390f,-0.251218f,0.538373f,0.0f,
-			-0.657657f,-0.611344f,0.440166f,0.0f,
-			-0.657657f,-0.611344f,0.440166f,0.0f,
-			-0.657657f,-0.611344f,0.440166f,0.0f,
-			-0.657661f,-0.611340f,0.440166f,0.0f,
-			-0.657661f,-0.611340f,0.440166f,0.0f,
-			-0.657661f,-0.611340f,0.440166f,0.0f,
-			-0.548707f,-0.751034f,0.367244f,0.0f,
-			-0.548707f,-0.751034f,0.367244f,0.0f,
-			-0.548707f,-0.751034f,0.367244f,0.0f,
-			-0.548707f,-0.751034f,0.367244f,0.0f,
-			-0.548707f,-0.751034f,0.367244f,0.0f,
-			-0.548707f,-0.751034f,0.367244f,0.0f,
-			-0.617862f,-0.668760f,0.413529f,0.0f,
-			-0.617862f,-0.668760f,0.413529f,0.0f,
-			-0.617862f,-0.668760f,0.413529f,0.0f,
-			-0.617860f,-0.668763f,0.413528f,0.0f,
-			-0.617860f,-0.668763f,0.413528f,0.0f,
-			-0.617860f,-0.668763f,0.413528f,0.0f,
-			-0.949835f,-0.250281f,0.187545f,0.0f,
-			-0.949835f,-0.250281f,0.187545f,0.0f,
-			-0.949835f,-0.250281f,0.187545f,0.0f,
-			-0.949835f,-0.250281f,0.187545f,0.0f,
-			-0.949835f,-0.250281f,0.187545f,0.0f,
-			-0.949835f,-0.250281f,0.187545f,0.0f,
-			-0.777524f,-0.609826f,0.153522f,0.0f,
-			-0.777524f,-0.609826f,0.153522f,0.0f,
-			-0.777524f,-0.609826f,0.153522f,0.0f,
-			-0.777521f,-0.609829f,0.153523f,0.0f,
-			-0.777521f,-0.609829f,0.153523f,0.0f,
-			-0.777521f,-0.609829f,0.153523f,0.0f,
-			-0.649204f,-0.749735f,0.128187f,0.0f,
-			-0.649204f,-0.749735f,0.128187f,0.0f,
-			-0.649204f,-0.749735f,0.128187f,0.0f,
-			-0.649201f,-0.749737f,0.128187f,0.0f,
-			-0.649201f,-0.749737f,0.128187f,0.0f,
-			-0.649201f,-0.749737f,0.128187f,0.0f,
-			-0.730676f,-0.667306f,0.144275f,0.0f,
-			-0.730676f,-0.667306f,0.144275f,0.0f,
-			-0.730676f,-0.667306f,0.144275f,0.0f,
-			-0.730689f,-0.667292f,0.144274f,0.0f,
-			-0.730689f,-0.667292f,0.144274f,0.0f,
-			-0.730689f,-0.667292f,0.144274f,0.0f,
-			-0.949835f,-0.250281f,-0.187545f,0.0f,
-			-0.949835f,-0.250281f,-0.187545f,0.0f,
-			-0.949835f,-0.250281f,-0.187545f,0.0f,
-			-0.949835f,-0.250281f,-0.187545f,0.0f,
-			-0.949835f,-0.250281f,-0.187545f,0.0f,
-			-0.949835f,-0.250281f,-0.187545f,0.0f,
-			-0.777520f,-0.609830f,-0.153522f,0.0f,
-			-0.777520f,-0.609830f,-0.153522f,0.0f,
-			-0.777520f,-0.609830f,-0.153522f,0.0f,
-			-0.777523f,-0.609826f,-0.153524f,0.0f,
-			-0.777523f,-0.609826f,-0.153524f,0.0f,
-			-0.777523f,-0.609826f,-0.153524f,0.0f,
-			-0.649202f,-0.749737f,-0.128187f,0.0f,
-			-0.649202f,-0.749737f,-0.128187f,0.0f,
-			-0.649202f,-0.749737f,-0.128187f,0.0f,
-			-0.649204f,-0.749734f,-0.128189f,0.0f,
-			-0.649204f,-0.749734f,-0.128189f,0.0f,
-			-0.649204f,-0.749734f,-0.128189f,0.0f,
-			-0.730691f,-0.667289f,-0.144279f,0.0f,
-			-0.730691f,-0.667289f,-0.144279f,0.0f,
-			-0.730691f,-0.667289f,-0.144279f,0.0f,
-			-0.730676f,-0.667306f,-0.144271f,0.0f,
-			-0.730676f,-0.667306f,-0.144271f,0.0f,
-			-0.730676f,-0.667306f,-0.144271f,0.0f,
-			-0.804392f,-0.251212f,-0.538374f,0.0f,
-			-0.804392f,-0.251212f,-0.538374f,0.0f,
-			-0.804392f,-0.251212f,-0.538374f,0.0f,
-			-0.804392f,-0.251210f,-0.538374f,0.0f,
-			-0.804392f,-0.251210f,-0.538374f,0.0f,
-			-0.804392f,-0.251210f,-0.538374f,0.0f,
-			-0.657657f,-0.611345f,-0.440165f,0.0f,
-			-0.657657f,-0.611345f,-0.440165f,0.0f,
-			-0.657657f,-0.611345f,-0.440165f,0.0f,
-			-0.657655f,-0.611349f,-0.440162f,0.0f,
-			-0.657655f,-0.611349f,-0.440162f,0.0f,
-			-0.657655f,-0.611349f,-0.440162f,0.0f,
-			-0.548707f,-0.751034f,-0.367244f,0.0f,
-			-0.548707f,-0.751034f,-0.367244f,0.0f,
-			-0.548707f,-0.751034f,-0.367244f,0.0f,
-			-0.548707f,-0.751034f,-0.367244f,0.0f,
-			-0.548707f,-0.751034f,-0.367244f,0.0f,
-			-0.548707f,-0.751034f,-0.367244f,0.0f,
-			-0.617867f,-0.668754f,-0.413532f,0.0f,
-			-0.617867f,-0.668754f,-0.413532f,0.0f,
-			-0.617867f,-0.668754f,-0.413532f,0.0f,
-			-0.617869f,-0.668751f,-0.413534f,0.0f,
-			-0.617869f,-0.668751f,-0.413534f,0.0f,
-			-0.617869f,-0.668751f,-0.413534f,0.0f,
-			-0.538372f,-0.251210f,-0.804394f,0.0f,
-			-0.538372f,-0.251210f,-0.804394f,0.0f,
-			-0.538372f,-0.251210f,-0.804394f,0.0f,
-			-0.538372f,-0.251211f,-0.804393f,0.0f,
-			-0.538372f,-0.251211f,-0.804393f,0.0f,
-			-0.538372f,-0.251211f,-0.804393f,0.0f,
-			-0.440164f,-0.611344f,-0.657658f,0.0f,
-			-0.440164f,-0.611344f,-0.657658f,0.0f,
-			-0.440164f,-0.611344f,-0.657658f,0.0f,
-			-0.440164f,-0.611344f,-0.657658f,0.0f,
-			-0.440164f,-0.611344f,-0.657658f,0.0f,
-			-0.440164f,-0.611344f,-0.657658f,0.0f,
-			-0.367244f,-0.751034f,-0.548707f,0.0f,
-			-0.367244f,-0.751034f,-0.548707f,0.0f,
-			-0.367244f,-0.751034f,-0.548707f,0.0f,
-			-0.367244f,-0.751034f,-0.548707f,0.0f,
-			-0.367244f,-0.751034f,-0.548707f,0.0f,
-			-0.367244f,-0.751034f,-0.548707f,0.0f,
-			-0.413529f,-0.668761f,-0.617862f,0.0f,
-			-0.413529f,-0.668761f,-0.617862f,0.0f,
-			-0.413529f,-0.668761f,-0.617862f,0.0f,
-			-0.413531f,-0.668754f,-0.617868f,0.0f,
-			-0.413531f,-0.668754f,-0.617868f,0.0f,
-			-0.413531f,-0.668754f,-0.617868f,0.0f,
-			-0.187550f,-0.250282f,-0.949834f,0.0f,
-			-0.187550f,-0.250282f,-0.949834f,0.0f,
-			-0.187550f,-0.250282f,-0.949834f,0.0f,
-			-0.187550f,-0.250282f,-0.949834f,0.0f,
-			-0.187550f,-0.250282f,-0.949834f,0.0f,
-			-0.187550f,-0.250282f,-0.949834f,0.0f,
-			-0.153525f,-0.609834f,-0.777517f,0.0f,
-			-0.153525f,-0.609834f,-0.777517f,0.0f,
-			-0.153525f,-0.609834f,-0.777517f,0.0f,
-			-0.153523f,-0.609829f,-0.777521f,0.0f,
-			-0.153523f,-0.609829f,-0.777521f,0.0f,
-			-0.153523f,-0.609829f,-0.777521f,0.0f,
-			-0.128187f,-0.749735f,-0.649204f,0.0f,
-			-0.128187f,-0.749735f,-0.649204f,0.0f,
-			-0.128187f,-0.749735f,-0.649204f,0.0f,
-			-0.128188f,-0.749737f,-0.649201f,0.0f,
-			-0.128188f,-0.749737f,-0.649201f,0.0f,
-			-0.128188f,-0.749737f,-0.649201f,0.0f,
-			-0.144278f,-0.667289f,-0.730691f,0.0f,
-			-0.144278f,-0.667289f,-0.730691f,0.0f,
-			-0.144278f,-0.667289f,-0.730691f,0.0f,
-			-0.144278f,-0.667292f,-0.730688f,0.0f,
-			-0.144278f,-0.667292f,-0.730688f,0.0f,
-			-0.144278f,-0.667292f,-0.730688f,0.0f,
-			0.187549f,-0.250284f,-0.949833f,0.0f,
-			0.187549f,-0.250284f,-0.949833f,0.0f,
-			0.187549f,-0.250284f,-0.949833f,0.0f,
-			0.187550f,-0.250282f,-0.949834f,0.0f,
-			0.187550f,-0.250282f,-0.949834f,0.0f,
-			0.187550f,-0.250282f,-0.949834f,0.0f,
-			0.153526f,-0.609829f,-0.777521f,0.0f,
-			0.153526f,-0.609829f,-0.777521f,0.0f,
-			0.153526f,-0.609829f,-0.777521f,0.0f,
-			0.153523f,-0.609834f,-0.777518f,0.0f,
-			0.153523f,-0.609834f,-0.777518f,0.0f,
-			0.153523f,-0.609834f,-0.777518f,0.0f,
-			0.128187f,-0.749737f,-0.649202f,0.0f,
-			0.128187f,-0.749737f,-0.649202f,0.0f,
-			0.128187f,-0.749737f,-0.649202f,0.0f,
-			0.128188f,-0.749735f,-0.649204f,0.0f,
-			0.128188f,-0.749735f,-0.649204f,0.0f,
-			0.128188f,-0.749735f,-0.649204f,0.0f,
-			0.144278f,-0.667289f,-0.730691f,0.0f,
-			0.144278f,-0.667289f,-0.730691f,0.0f,
-			0.144278f,-0.667289f,-0.730691f,0.0f,
-			0.144279f,-0.667289f,-0.730691f,0.0f,
-			0.144279f,-0.667289f,-0.730691f,0.0f,
-			0.144279f,-0.667289f,-0.730691f,0.0f,
-			0.538374f,-0.251212f,-0.804392f,0.0f,
-			0.538374f,-0.251212f,-0.804392f,0.0f,
-			0.538374f,-0.251212f,-0.804392f,0.0f,
-			0.538371f,-0.251216f,-0.804392f,0.0f,
-			0.538371f,-0.251216f,-0.804392f,0.0f,
-			0.538371f,-0.251216f,-0.804392f,0.0f,
-			0.440164f,-0.611344f,-0.657658f,0.0f,
-			0.440164f,-0.611344f,-0.657658f,0.0f,
-			0.440164f,-0.611344f,-0.657658f,0.0f,
-			0.440164f,-0.611344f,-0.657658f,0.0f,
-			0.440164f,-0.611344f,-0.657658f,0.0f,
-			0.440164f,-0.611344f,-0.657658f,0.0f,
-			0.367244f,-0.751034f,-0.548707f,0.0f,
-			0.367244f,-0.751034f,-0.548707f,0.0f,
-			0.367244f,-0.751034f,-0.548707f,0.0f,
-			0.367244f,-0.751034f,-0.548707f,0.0f,
-			0.367244f,-0.751034f,-0.548707f,0.0f,
-			0.367244f,-0.751034f,-0.548707f,0.0f,
-			0.413532f,-0.668754f,-0.617867f,0.0f,
-			0.413532f,-0.668754f,-0.617867f,0.0f,
-			0.413532f,-0.668754f,-0.617867f,0.0f,
-			0.413534f,-0.668751f,-0.617868f,0.0f,
-			0.413534f,-0.668751f,-0.617868f,0.0f,
-			0.413534f,-0.668751f,-0.617868f,0.0f,
-			0.804392f,-0.251211f,-0.538374f,0.0f,
-			0.804392f,-0.251211f,-0.538374f,0.0f,
-			0.804392f,-0.251211f,-0.538374f,0.0f,
-			0.804392f,-0.251212f,-0.538374f,0.0f,
-			0.804392f,-0.251212f,-0.538374f,0.0f,
-			0.804392f,-0.251212f,-0.538374f,0.0f,
-			0.657655f,-0.611348f,-0.440164f,0.0f,
-			0.657655f,-0.611348f,-0.440164f,0.0f,
-			0.657655f,-0.611348f,-0.440164f,0.0f,
-			0.657658f,-0.611344f,-0.440164f,0.0f,
-			0.657658f,-0.611344f,-0.440164f,0.0f,
-			0.657658f,-0.611344f,-0.440164f,0.0f,
-			0.548707f,-0.751034f,-0.367244f,0.0f,
-			0.548707f,-0.751034f,-0.367244f,0.0f,
-			0.548707f,-0.751034f,-0.367244f,0.0f,
-			0.548707f,-0.751034f,-0.367244f,0.0f,
-			0.548707f,-0.751034f,-0.367244f,0.0f,
-			0.548707f,-0.751034f,-0.367244f,0.0f,
-			0.617869f,-0.668751f,-0.413533f,0.0f,
-			0.617869f,-0.668751f,-0.413533f,0.0f,
-			0.617869f,-0.668751f,-0.413533f,0.0f,
-			0.617867f,-0.668754f,-0.413533f,0.0f,
-			0.617867f,-0.668754f,-0.413533f,0.0f,
-			0.617867f,-0.668754f,-0.413533f,0.0f,
-			0.949831f,-0.250292f,-0.187549f,0.0f,
-			0.949831f,-0.250292f,-0.187549f,0.0f,
-			0.949831f,-0.250292f,-0.187549f,0.0f,
-			0.949835f,-0.250282f,-0.187545f,0.0f,
-			0.949835f,-0.250282f,-0.187545f,0.0f,
-			0.949835f,-0.250282f,-0.187545f,0.0f,
-			0.777523f,-0.609826f,-0.153522f,0.0f,
-			0.777523f,-0.609826f,-0.153522f,0.0f,
-			0.777523f,-0.609826f,-0.153522f,0.0f,
-			0.777520f,-0.609830f,-0.153524f,0.0f,
-			0.777520f,-0.609830f,-0.153524f,0.0f,
-			0.777520f,-0.609830f,-0.153524f,0.0f,
-			0.649204f,-0.749735f,-0.128187f,0.0f,
-			0.649204f,-0.749735f,-0.128187f,0.0f,
-			0.649204f,-0.749735f,-0.128187f,0.0f,
-			0.649201f,-0.749737f,-0.128188f,0.0f,
-			0.649201f,-0.749737f,-0.128188f,0.0f,
-			0.649201f,-0.749737f,-0.128188f,0.0f,
-			0.730691f,-0.667289f,-0.144279f,0.0f,
-			0.730691f,-0.667289f,-0.144279f,0.0f,
-			0.730691f,-0.667289f,-0.144279f,0.0f,
-			0.730691f,-0.667289f,-0.144279f,0.0f,
-			0.730691f,-0.667289f,-0.144279f,0.0f,
-			0.730691f,-0.667289f,-0.144279f,0.0f,
-			0.839297f,-0.517800f,0.165724f,0.0f,
-			0.839297f,-0.517800f,0.165724f,0.0f,
-			0.839297f,-0.517800f,0.165724f,0.0f,
-			0.839263f,-0.517859f,0.165709f,0.0f,
-			0.839263f,-0.517859f,0.165709f,0.0f,
-			0.839263f,-0.517859f,0.165709f,0.0f,
-			0.255385f,-0.965524f,0.050425f,0.0f,
-			0.255385f,-0.965524f,0.050425f,0.0f,
-			0.255385f,-0.965524f,0.050425f,0.0f,
-			0.255387f,-0.965523f,0.050426f,0.0f,
-			0.255387f,-0.965523f,0.050426f,0.0f,
-			0.255387f,-0.965523f,0.050426f,0.0f,
-			0.075492f,-0.997035f,0.014906f,0.0f,
-			0.075492f,-0.997035f,0.014906f,0.0f,
-			0.075492f,-0.997035f,0.014906f,0.0f,
-			0.075492f,-0.997035f,0.014906f,0.0f,
-			0.075492f,-0.997035f,0.014906f,0.0f,
-			0.075492f,-0.997035f,0.014906f,0.0f,
-			0.015429f,-0.999876f,0.003047f,0.0f,
-			0.015429f,-0.999876f,0.003047f,0.0f,
-			0.015429f,-0.999876f,0.003047f,0.0f,
-			0.710192f,-0.519320f,0.475325f,0.0f,
-			0.710192f,-0.519320f,0.475325f,0.0f,
-			0.710192f,-0.519320f,0.475325f,0.0f,
-			0.710203f,-0.519294f,0.475337f,0.0f,
-			0.710203f,-0.519294f,0.475337f,0.0f,
-			0.710203f,-0.519294f,0.475337f,0.0f,
-			0.215536f,-0.965782f,0.144258f,0.0f,
-			0.215536f,-0.965782f,0.144258f,0.0f,
-			0.215536f,-0.965782f,0.144258f,0.0f,
-			0.215536f,-0.965782f,0.144257f,0.0f,
-			0.215536f,-0.965782f,0.144257f,0.0f,
-			0.215536f,-0.965782f,0.144257f,0.0f,
-			0.063697f,-0.997058f,0.042632f,0.0f,
-			0.063697f,-0.997058f,0.042632f,0.0f,
-			0.063697f,-0.997058f,0.042632f,0.0f,
-			0.063697f,-0.997058f,0.042632f,0.0f,
-			0.063697f,-0.997058f,0.042632f,0.0f,
-			0.063697f,-0.997058f,0.042632f,0.0f,
-			0.013018f,-0.999877f,0.008713f,0.0f,
-			0.013018f,-0.999877f,0.008713f,0.0f,
-			0.013018f,-0.999877f,0.008713f,0.0f,
-			0.475326f,-0.519319f,0.710193f,0.0f,
-			0.475326f,-0.519319f,0.710193f,0.0f,
-			0.475326f,-0.519319f,0.710193f,0.0f,
-			0.475328f,-0.519308f,0.710199f,0.0f,
-			0.475328f,-0.519308f,0.710199f,0.0f,
-			0.475328f,-0.519308f,0.710199f,0.0f,
-			0.144257f,-0.965781f,0.215538f,0.0f,
-			0.144257f,-0.965781f,0.215538f,0.0f,
-			0.144257f,-0.965781f,0.215538f,0.0f,
-			0.144257f,-0.965781f,0.215537f,0.0f,
-			0.144257f,-0.965781f,0.215537f,0.0f,
-			0.144257f,-0.965781f,0.215537f,0.0f,
-			0.042632f,-0.997058f,0.063697f,0.0f,
-			0.042632f,-0.997058f,0.063697f,0.0f,
-			0.042632f,-0.997058f,0.063697f,0.0f,
-			0.042632f,-0.997058f,0.063697f,0.0f,
-			0.042632f,-0.997058f,0.063697f,0.0f,
-			0.042632f,-0.997058f,0.063697f,0.0f,
-			0.008713f,-0.999877f,0.013018f,0.0f,
-			0.008713f,-0.999877f,0.013018f,0.0f,
-			0.008713f,-0.999877f,0.013018f,0.0f,
-			0.165721f,-0.517820f,0.839285f,0.0f,
-			0.165721f,-0.517820f,0.839285f,0.0f,
-			0.165721f,-0.517820f,0.839285f,0.0f,
-			0.165721f,-0.517810f,0.839291f,0.0f,
-			0.165721f,-0.517810f,0.839291f,0.0f,
-			0.165721f,-0.517810f,0.839291f,0.0f,
-			0.050427f,-0.965523f,0.255387f,0.0f,
-			0.050427f,-0.965523f,0.255387f,0.0f,
-			0.050427f,-0.965523f,0.255387f,0.0f,
-			0.050427f,-0.965523f,0.255385f,0.0f,
-			0.050427f,-0.965523f,0.255385f,0.0f,
-			0.050427f,-0.965523f,0.255385f,0.0f,
-			0.014906f,-0.997035f,0.075492f,0.0f,
-			0.014906f,-0.997035f,0.075492f,0.0f,
-			0.014906f,-0.997035f,0.075492f,0.0f,
-			0.014906f,-0.997035f,0.075493f,0.0f,
-			0.014906f,-0.997035f,0.075493f,0.0f,
-			0.014906f,-0.997035f,0.075493f,0.0f,
-			0.003046f,-0.999876f,0.015429f,0.0f,
-			0.003046f,-0.999876f,0.015429f,0.0f,
-			0.003046f,-0.999876f,0.015429f,0.0f,
-			-0.165723f,-0.517802f,0.839295f,0.0f,
-			-0.165723f,-0.517802f,0.839295f,0.0f,
-			-0.165723f,-0.517802f,0.839295f,0.0f,
-			-0.165719f,-0.517821f,0.839285f,0.0f,
-			-0.165719f,-0.517821f,0.839285f,0.0f,
-			-0.165719f,-0.517821f,0.839285f,0.0f,
-			-0.050426f,-0.965524f,0.255385f,0.0f,
-			-0.050426f,-0.965524f,0.255385f,0.0f,
-			-0.050426f,-0.965524f,0.255385f,0.0f,
-			-0.050428f,-0.965523f,0.255387f,0.0f,
-			-0.050428f,-0.965523f,0.255387f,0.0f,
-			-0.050428f,-0.965523f,0.255387f,0.0f,
-			-0.014906f,-0.997035f,0.075492f,0.0f,
-			-0.014906f,-0.997035f,0.075492f,0.0f,
-			-0.014906f,-0.997035f,0.075492f,0.0f,
-			-0.014905f,-0.997035f,0.075492f,0.0f,
-			-0.014905f,-0.997035f,0.075492f,0.0f,
-			-0.014905f,-0.997035f,0.075492f,0.0f,
-			-0.003046f,-0.999876f,0.015429f,0.0f,
-			-0.003046f,-0.999876f,0.015429f,0.0f,
-			-0.003046f,-0.999876f,0.015429f,0.0f,
-			-0.475327f,-0.519307f,0.710200f,0.0f,
-			-0.475327f,-0.519307f,0.710200f,0.0f,
-			-0.475327f,-0.519307f,0.710200f,0.0f,
-			-0.475332f,-0.519296f,0.710205f,0.0f,
-			-0.475332f,-0.519296f,0.710205f,0.0f,
-			-0.475332f,-0.519296f,0.710205f,0.0f,
-			-0.144257f,-0.965781f,0.215537f,0.0f,
-			-0.144257f,-0.965781f,0.215537f,0.0f,
-			-0.144257f,-0.965781f,0.215537f,0.0f,
-			-0.144255f,-0.965782f,0.215536f,0.0f,
-			-0.144255f,-0.965782f,0.215536f,0.0f,
-			-0.144255f,-0.965782f,0.215536f,0.0f,
-			-0.042632f,-0.997058f,0.063697f,0.0f,
-			-0.042632f,-0.997058f,0.063697f,0.0f,
-			-0.042632f,-0.997058f,0.063697f,0.0f,
-			-0.042633f,-0.997058f,0.063697f,0.0f,
-			-0.042633f,-0.997058f,0.063697f,0.0f,
-			-0.042633f,-0.997058f,0.063697f,0.0f,
-			-0.008713f,-0.999877f,0.013018f,0.0f,
-			-0.008713f,-0.999877f,0.013018f,0.0f,
-			-0.008713f,-0.999877f,0.013018f,0.0f,
-			-0.710187f,-0.519329f,0.475322f,0.0f,
-			-0.710187f,-0.519329f,0.475322f,0.0f,
-			-0.710187f,-0.519329f,0.475322f,0.0f,
-			-0.710194f,-0.519318f,0.475325f,0.0f,
-			-0.710194f,-0.519318f,0.475325f,0.0f,
-			-0.710194f,-0.519318f,0.475325f,0.0f,
-			-0.215536f,-0.965782f,0.144256f,0.0f,
-			-0.215536f,-0.965782f,0.144256f,0.0f,
-			-0.215536f,-0.965782f,0.144256f,0.0f,
-			-0.215537f,-0.965781f,0.144256f,0.0f,
-			-0.215537f,-0.965781f,0.144256f,0.0f,
-			-0.215537f,-0.965781f,0.144256f,0.0f,
-			-0.063698f,-0.997058f,0.042632f,0.0f,
-			-0.063698f,-0.997058f,0.042632f,0.0f,
-			-0.063698f,-0.997058f,0.042632f,0.0f,
-			-0.063697f,-0.997058f,0.042632f,0.0f,
-			-0.063697f,-0.997058f,0.042632f,0.0f,
-			-0.063697f,-0.997058f,0.042632f,0.0f,
-			-0.013018f,-0.999877f,0.008713f,0.0f,
-			-0.013018f,-0.999877f,0.008713f,0.0f,
-			-0.013018f,-0.999877f,0.008713f,0.0f,
-			-0.839286f,-0.517820f,0.165716f,0.0f,
-			-0.839286f,-0.517820f,0.165716f,0.0f,
-			-0.839286f,-0.517820f,0.165716f,0.0f,
-			-0.839273f,-0.517841f,0.165716f,0.0f,
-			-0.839273f,-0.517841f,0.165716f,0.0f,
-			-0.839273f,-0.517841f,0.165716f,0.0f,
-			-0.255387f,-0.965523f,0.050427f,0.0f,
-			-0.255387f,-0.965523f,0.050427f,0.0f,
-			-0.255387f,-0.965523f,0.050427f,0.0f,
-			-0.255384f,-0.965524f,0.050427f,0.0f,
-			-0.255384f,-0.965524f,0.050427f,0.0f,
-			-0.255384f,-0.965524f,0.050427f,0.0f,
-			-0.075492f,-0.997035f,0.014906f,0.0f,
-			-0.075492f,-0.997035f,0.014906f,0.0f,
-			-0.075492f,-0.997035f,0.014906f,0.0f,
-			-0.075492f,-0.997035f,0.014906f,0.0f,
-			-0.075492f,-0.997035f,0.014906f,0.0f,
-			-0.075492f,-0.997035f,0.014906f,0.0f,
-			-0.015429f,-0.999876f,0.003047f,0.0f,
-			-0.015429f,-0.999876f,0.003047f,0.0f,
-			-0.015429f,-0.999876f,0.003047f,0.0f,
-			-0.839269f,-0.517848f,-0.165713f,0.0f,
-			-0.839269f,-0.517848f,-0.165713f,0.0f,
-			-0.839269f,-0.517848f,-0.165713f,0.0f,
-			-0.839285f,-0.517819f,-0.165720f,0.0f,
-			-0.839285f,-0.517819f,-0.165720f,0.0f,
-			-0.839285f,-0.517819f,-0.165720f,0.0f,
-			-0.255385f,-0.965523f,-0.050427f,0.0f,
-			-0.255385f,-0.965523f,-0.050427f,0.0f,
-			-0.255385f,-0.965523f,-0.050427f,0.0f,
-			-0.255387f,-0.965523f,-0.050428f,0.0f,
-			-0.255387f,-0.965523f,-0.050428f,0.0f,
-			-0.255387f,-0.965523f,-0.050428f,0.0f,
-			-0.075492f,-0.997035f,-0.014906f,0.0f,
-			-0.075492f,-0.997035f,-0.014906f,0.0f,
-			-0.075492f,-0.997035f,-0.014906f,0.0f,
-			-0.075492f,-0.997035f,-0.014906f,0.0f,
-			-0.075492f,-0.997035f,-0.014906f,0.0f,
-			-0.075492f,-0.997035f,-0.014906f,0.0f,
-			-0.015429f,-0.999876f,-0.003047f,0.0f,
-			-0.015429f,-0.999876f,-0.003047f,0.0f,
-			-0.015429f,-0.999876f,-0.003047f,0.0f,
-			-0.710181f,-0.519341f,-0.475318f,0.0f,
-			-0.710181f,-0.519341f,-0.475318f,0.0f,
-			-0.710181f,-0.519341f,-0.475318f,0.0f,
-			-0.710177f,-0.519351f,-0.475314f,0.0f,
-			-0.710177f,-0.519351f,-0.475314f,0.0f,
-			-0.710177f,-0.519351f,-0.475314f,0.0f,
-			-0.215539f,-0.965781f,-0.144258f,0.0f,
-			-0.215539f,-0.965781f,-0.144258f,0.0f,
-			-0.215539f,-0.965781f,-0.144258f,0.0f,
-			-0.215538f,-0.965781f,-0.144257f,0.0f,
-			-0.215538f,-0.965781f,-0.144257f,0.0f,
-			-0.215538f,-0.965781f,-0.144257f,0.0f,
-			-0.063697f,-0.997058f,-0.042632f,0.0f,
-			-0.063697f,-0.997058f,-0.042632f,0.0f,
-			-0.063697f,-0.997058f,-0.042632f,0.0f,
-			-0.063697f,-0.997058f,-0.042632f,0.0f,
-			-0.063697f,-0.997058f,-0.042632f,0.0f,
-			-0.063697f,-0.997058f,-0.042632f,0.0f,
-			-0.013018f,-0.999877f,-0.008713f,0.0f,
-			-0.013018f,-0.999877f,-0.008713f,0.0f,
-			-0.013018f,-0.999877f,-0.008713f,0.0f,
-			-0.475331f,-0.519297f,-0.710205f,0.0f,
-			-0.475331f,-0.519297f,-0.710205f,0.0f,
-			-0.475331f,-0.519297f,-0.710205f,0.0f,
-			-0.475321f,-0.519342f,-0.710179f,0.0f,
-			-0.475321f,-0.519342f,-0.710179f,0.0f,
-			-0.475321f,-0.519342f,-0.710179f,0.0f,
-			-0.144257f,-0.965782f,-0.215535f,0.0f,
-			-0.144257f,-0.965782f,-0.215535f,0.0f,
-			-0.144257f,-0.965782f,-0.215535f,0.0f,
-			-0.144258f,-0.965780f,-0.215541f,0.0f,
-			-0.144258f,-0.965780f,-0.215541f,0.0f,
-			-0.144258f,-0.965780f,-0.215541f,0.0f,
-			-0.042632f,-0.997058f,-0.063697f,0.0f,
-			-0.042632f,-0.997058f,-0.063697f,0.0f,
-			-0.042632f,-0.997058f,-0.063697f,0.0f,
-			-0.042632f,-0.997058f,-0.063697f,0.0f,
-			-0.042632f,-0.997058f,-0.063697f,0.0f,
-			-0.042632f,-0.997058f,-0.063697f,0.0f,
-			-0.008713f,-0.999877f,-0.013018f,0.0f,
-			-0.008713f,-0.999877f,-0.013018f,0.0f,
-			-0.008713f,-0.999877f,-0.013018f,0.0f,
-			-0.165722f,-0.517819f,-0.839285f,0.0f,
-			-0.165722f,-0.517819f,-0.839285f,0.0f,
-			-0.165722f,-0.517819f,-0.839285f,0.0f,
-			-0.165721f,-0.517802f,-0.839296f,0.0f,
-			-0.165721f,-0.517802f,-0.839296f,0.0f,
-			-0.165721f,-0.517802f,-0.839296f,0.0f,
-			-0.050426f,-0.965524f,-0.255383f,0.0f,
-			-0.050426f,-0.965524f,-0.255383f,0.0f,
-			-0.050426f,-0.965524f,-0.255383f,0.0f,
-			-0.050426f,-0.965524f,-0.255385f,0.0f,
-			-0.050426f,-0.965524f,-0.255385f,0.0f,
-			-0.050426f,-0.965524f,-0.255385f,0.0f,
-			-0.014906f,-0.997035f,-0.075492f,0.0f,
-			-0.014906f,-0.997035f,-0.075492f,0.0f,
-			-0.014906f,-0.997035f,-0.075492f,0.0f,
-			-0.014906f,-0.997035f,-0.075492f,0.0f,
-			-0.014906f,-0.997035f,-0.075492f,0.0f,
-			-0.014906f,-0.997035f,-0.075492f,0.0f,
-			-0.003047f,-0.999876f,-0.015429f,0.0f,
-			-0.003047f,-0.999876f,-0.015429f,0.0f,
-			-0.003047f,-0.999876f,-0.015429f,0.0f,
-			0.165722f,-0.517810f,-0.839291f,0.0f,
-			0.165722f,-0.517810f,-0.839291f,0.0f,
-			0.165722f,-0.517810f,-0.839291f,0.0f,
-			0.165720f,-0.517819f,-0.839285f,0.0f,
-			0.165720f,-0.517819f,-0.839285f,0.0f,
-			0.165720f,-0.517819f,-0.839285f,0.0f,
-			0.050427f,-0.965523f,-0.255385f,0.0f,
-			0.050427f,-0.965523f,-0.255385f,0.0f,
-			0.050427f,-0.965523f,-0.255385f,0.0f,
-			0.050425f,-0.965524f,-0.255383f,0.0f,
-			0.050425f,-0.965524f,-0.255383f,0.0f,
-			0.050425f,-0.965524f,-0.255383f,0.0f,
-			0.014906f,-0.997035f,-0.075492f,0.0f,
-			0.014906f,-0.997035f,-0.075492f,0.0f,
-			0.014906f,-0.997035f,-0.075492f,0.0f,
-			0.014906f,-0.997035f,-0.075492f,0.0f,
-			0.014906f,-0.997035f,-0.075492f,0.0f,
-			0.014906f,-0.997035f,-0.075492f,0.0f,
-			0.003047f,-0.999876f,-0.015429f,0.0f,
-			0.003047f,-0.999876f,-0.015429f,0.0f,
-			0.003047f,-0.999876f,-0.015429f,0.0f,
-			0.475318f,-0.519342f,-0.710181f,0.0f,
-			0.475318f,-0.519342f,-0.710181f,0.0f,
-			0.475318f,-0.519342f,-0.710181f,0.0f,
-			0.475328f,-0.519318f,-0.710191f,0.0f,
-			0.475328f,-0.519318f,-0.710191f,0.0f,
-			0.475328f,-0.519318f,-0.710191f,0.0f,
-			0.144260f,-0.965780f,-0.215539f,0.0f,
-			0.144260f,-0.965780f,-0.215539f,0.0f,
-			0.144260f,-0.965780f,-0.215539f,0.0f,
-			0.144258f,-0.965781f,-0.215538f,0.0f,
-			0.144258f,-0.965781f,-0.215538f,0.0f,
-			0.144258f,-0.965781f,-0.215538f,0.0f,
-			0.042632f,-0.997058f,-0.063697f,0.0f,
-			0.042632f,-0.997058f,-0.063697f,0.0f,
-			0.042632f,-0.997058f,-0.063697f,0.0f,
-			0.042631f,-0.997058f,-0.063697f,0.0f,
-			0.042631f,-0.997058f,-0.063697f,0.0f,
-			0.042631f,-0.997058f,-0.063697f,0.0f,
-			0.008713f,-0.999877f,-0.013018f,0.0f,
-			0.008713f,-0.999877f,-0.013018f,0.0f,
-			0.008713f,-0.999877f,-0.013018f,0.0f,
-			0.710194f,-0.519317f,-0.475326f,0.0f,
-			0.710194f,-0.519317f,-0.475326f,0.0f,
-			0.710194f,-0.519317f,-0.475326f,0.0f,
-			0.710179f,-0.519342f,-0.475321f,0.0f,
-			0.710179f,-0.519342f,-0.475321f,0.0f,
-			0.710179f,-0.519342f,-0.475321f,0.0f,
-			0.215538f,-0.965781f,-0.144259f,0.0f,
-			0.215538f,-0.965781f,-0.144259f,0.0f,
-			0.215538f,-0.965781f,-0.144259f,0.0f,
-			0.215539f,-0.965781f,-0.144259f,0.0f,
-			0.215539f,-0.965781f,-0.144259f,0.0f,
-			0.215539f,-0.965781f,-0.144259f,0.0f,
-			0.063697f,-0.997058f,-0.042632f,0.0f,
-			0.063697f,-0.997058f,-0.042632f,0.0f,
-			0.063697f,-0.997058f,-0.042632f,0.0f,
-			0.063698f,-0.997058f,-0.042632f,0.0f,
-			0.063698f,-0.997058f,-0.042632f,0.0f,
-			0.063698f,-0.997058f,-0.042632f,0.0f,
-			0.013018f,-0.999877f,-0.008713f,0.0f,
-			0.013018f,-0.999877f,-0.008713f,0.0f,
-			0.013018f,-0.999877f,-0.008713f,0.0f,
-			0.839262f,-0.517858f,-0.165717f,0.0f,
-			0.839262f,-0.517858f,-0.165717f,0.0f,
-			0.839262f,-0.517858f,-0.165717f,0.0f,
-			0.839294f,-0.517807f,-0.165716f,0.0f,
-			0.839294f,-0.517807f,-0.165716f,0.0f,
-			0.839294f,-0.517807f,-0.165716f,0.0f,
-			0.255387f,-0.965523f,-0.050425f,0.0f,
-			0.255387f,-0.965523f,-0.050425f,0.0f,
-			0.255387f,-0.965523f,-0.050425f,0.0f,
-			0.255386f,-0.965523f,-0.050426f,0.0f,
-			0.255386f,-0.965523f,-0.050426f,0.0f,
-			0.255386f,-0.965523f,-0.050426f,0.0f,
-			0.075492f,-0.997035f,-0.014906f,0.0f,
-			0.075492f,-0.997035f,-0.014906f,0.0f,
-			0.075492f,-0.997035f,-0.014906f,0.0f,
-			0.075492f,-0.997035f,-0.014906f,0.0f,
-			0.075492f,-0.997035f,-0.014906f,0.0f,
-			0.075492f,-0.997035f,-0.014906f,0.0f,
-			0.015429f,-0.999876f,-0.003047f,0.0f,
-			0.015429f,-0.999876f,-0.003047f,0.0f,
-			0.015429f,-0.999876f,-0.003047f,0.0f,
-			0.008016f,-0.979094f,0.203249f,0.0f,
-			0.008016f,-0.979094f,0.203249f,0.0f,
-			0.008016f,-0.979094f,0.203249f,0.0f,
-			0.007368f,-0.979467f,0.201471f,0.0f,
-			0.007368f,-0.979467f,0.201471f,0.0f,
-			0.007368f,-0.979467f,0.201471f,0.0f,
-			0.076129f,-0.975516f,0.206330f,0.0f,
-			0.076129f,-0.975516f,0.206330f,0.0f,
-			0.076129f,-0.975516f,0.206330f,0.0f,
-			0.069759f,-0.978880f,0.192164f,0.0f,
-			0.069759f,-0.978880f,0.192164f,0.0f,
-			0.069759f,-0.978880f,0.192164f,0.0f,
-			0.316509f,-0.920276f,0.230031f,0.0f,
-			0.316509f,-0.920276f,0.230031f,0.0f,
-			0.316509f,-0.920276f,0.230031f,0.0f,
-			0.292538f,-0.937454f,0.188685f,0.0f,
-			0.292538f,-0.937454f,0.188685f,0.0f,
-			0.292538f,-0.937454f,0.188685f,0.0f,
-			0.856840f,-0.436446f,0.274482f,0.0f,
-			0.856840f,-0.436446f,0.274482f,0.0f,
-			0.856840f,-0.436446f,0.274482f,0.0f,
-			0.846392f,-0.477849f,0.235118f,0.0f,
-			0.846392f,-0.477849f,0.235118f,0.0f,
-			0.846392f,-0.477849f,0.235118f,0.0f,
-			0.005537f,-0.589776f,0.807548f,0.0f,
-			0.005537f,-0.589776f,0.807548f,0.0f,
-			0.005537f,-0.589776f,0.807548f,0.0f,
-			0.004855f,-0.592953f,0.805222f,0.0f,
-			0.004855f,-0.592953f,0.805222f,0.0f,
-			0.004855f,-0.592953f,0.805222f,0.0f,
-			0.052569f,-0.579641f,0.813175f,0.0f,
-			0.052569f,-0.579641f,0.813175f,0.0f,
-			0.052569f,-0.579641f,0.813175f,0.0f,
-			0.047426f,-0.607714f,0.792739f,0.0f,
-			0.047426f,-0.607714f,0.792739f,0.0f,
-			0.047426f,-0.607714f,0.792739f,0.0f,
-			0.198563f,-0.490799f,0.848345f,0.0f,
-			0.198563f,-0.490799f,0.848345f,0.0f,
-			0.198563f,-0.490799f,0.848345f,0.0f,
-			0.197573f,-0.574458f,0.794332f,0.0f,
-			0.197573f,-0.574458f,0.794332f,0.0f,
-			0.197573f,-0.574458f,0.794332f,0.0f,
-			0.430930f,-0.184615f,0.883299f,0.0f,
-			0.430930f,-0.184615f,0.883299f,0.0f,
-			0.430930f,-0.184615f,0.883299f,0.0f,
-			0.465222f,-0.236969f,0.852886f,0.0f,
-			0.465222f,-0.236969f,0.852886f,0.0f,
-			0.465222f,-0.236969f,0.852886f,0.0f,
-			-0.006100f,0.589938f,0.807426f,0.0f,
-			-0.006100f,0.589938f,0.807426f,0.0f,
-			-0.006100f,0.589938f,0.807426f,0.0f,
-			-0.005565f,0.592766f,0.805355f,0.0f,
-			-0.005565f,0.592766f,0.805355f,0.0f,
-			-0.005565f,0.592766f,0.805355f,0.0f,
-			-0.058344f,0.577930f,0.813998f,0.0f,
-			-0.058344f,0.577930f,0.813998f,0.0f,
-			-0.058344f,0.577930f,0.813998f,0.0f,
-			-0.054659f,0.602697f,0.796096f,0.0f,
-			-0.054659f,0.602697f,0.796096f,0.0f,
-			-0.054659f,0.602697f,0.796096f,0.0f,
-			-0.216246f,0.475398f,0.852780f,0.0f,
-			-0.216246f,0.475398f,0.852780f,0.0f,
-			-0.216246f,0.475398f,0.852780f,0.0f,
-			-0.220286f,0.544493f,0.809322f,0.0f,
-			-0.220286f,0.544493f,0.809322f,0.0f,
-			-0.220286f,0.544493f,0.809322f,0.0f,
-			-0.439368f,0.165937f,0.882848f,0.0f,
-			-0.439368f,0.165937f,0.882848f,0.0f,
-			-0.439368f,0.165937f,0.882848f,0.0f,
-			-0.469079f,0.200959f,0.859988f,0.0f,
-			-0.469079f,0.200959f,0.859988f,0.0f,
-			-0.469079f,0.200959f,0.859988f,0.0f,
-			-0.010492f,0.979117f,0.203025f,0.0f,
-			-0.010492f,0.979117f,0.203025f,0.0f,
-			-0.010492f,0.979117f,0.203025f,0.0f,
-			-0.010127f,0.979398f,0.201685f,0.0f,
-			-0.010127f,0.979398f,0.201685f,0.0f,
-			-0.010127f,0.979398f,0.201685f,0.0f,
-			-0.102147f,0.972798f,0.207920f,0.0f,
-			-0.102147f,0.972798f,0.207920f,0.0f,
-			-0.102147f,0.972798f,0.207920f,0.0f,
-			-0.098471f,0.975409f,0.197181f,0.0f,
-			-0.098471f,0.975409f,0.197181f,0.0f,
-			-0.098471f,0.975409f,0.197181f,0.0f,
-			-0.416329f,0.876502f,0.241691f,0.0f,
-			-0.416329f,0.876502f,0.241691f,0.0f,
-			-0.416329f,0.876502f,0.241691f,0.0f,
-			-0.404643f,0.889573f,0.211951f,0.0f,
-			-0.404643f,0.889573f,0.211951f,0.0f,
-			-0.404643f,0.889573f,0.211951f,0.0f,
-			-0.904875f,0.326080f,0.273628f,0.0f,
-			-0.904875f,0.326080f,0.273628f,0.0f,
-			-0.904875f,0.326080f,0.273628f,0.0f,
-			-0.905431f,0.341955f,0.251519f,0.0f,
-			-0.905431f,0.341955f,0.251519f,0.0f,
-			-0.905431f,0.341955f,0.251519f,0.0f,
-			-0.010124f,0.979114f,-0.203059f,0.0f,
-			-0.010124f,0.979114f,-0.203059f,0.0f,
-			-0.010124f,0.979114f,-0.203059f,0.0f,
-			-0.010495f,0.979388f,-0.201713f,0.0f,
-			-0.010495f,0.979388f,-0.201713f,0.0f,
-			-0.010495f,0.979388f,-0.201713f,0.0f,
-			-0.098253f,0.973247f,-0.207692f,0.0f,
-			-0.098253f,0.973247f,-0.207692f,0.0f,
-			-0.098253f,0.973247f,-0.207692f,0.0f,
-			-0.102364f,0.974873f,-0.197849f,0.0f,
-			-0.102364f,0.974873f,-0.197849f,0.0f,
-			-0.102364f,0.974873f,-0.197849f,0.0f,
-			-0.401933f,0.883615f,-0.240156f,0.0f,
-			-0.401933f,0.883615f,-0.240156f,0.0f,
-			-0.401933f,0.883615f,-0.240156f,0.0f,
-			-0.419035f,0.882199f,-0.214790f,0.0f,
-			-0.419035f,0.882199f,-0.214790f,0.0f,
-			-0.419035f,0.882199f,-0.214790f,0.0f,
-			-0.899718f,0.339798f,-0.273945f,0.0f,
-			-0.899718f,0.339798f,-0.273945f,0.0f,
-			-0.899718f,0.339798f,-0.273945f,0.0f,
-			-0.910210f,0.328003f,-0.252847f,0.0f,
-			-0.910210f,0.328003f,-0.252847f,0.0f,
-			-0.910210f,0.328003f,-0.252847f,0.0f,
-			-0.005537f,0.589776f,-0.807548f,0.0f,
-			-0.005537f,0.589776f,-0.807548f,0.0f,
-			-0.005537f,0.589776f,-0.807548f,0.0f,
-			-0.006128f,0.592618f,-0.805461f,0.0f,
-			-0.006128f,0.592618f,-0.805461f,0.0f,
-			-0.006128f,0.592618f,-0.805461f,0.0f,
-			-0.052569f,0.579643f,-0.813173f,0.0f,
-			-0.052569f,0.579643f,-0.813173f,0.0f,
-			-0.052569f,0.579643f,-0.813173f,0.0f,
-			-0.060436f,0.598649f,-0.798728f,0.0f,
-			-0.060436f,0.598649f,-0.798728f,0.0f,
-			-0.060436f,0.598649f,-0.798728f,0.0f,
-			-0.198563f,0.490798f,-0.848345f,0.0f,
-			-0.198563f,0.490798f,-0.848345f,0.0f,
-			-0.198563f,0.490798f,-0.848345f,0.0f,
-			-0.237145f,0.521343f,-0.819734f,0.0f,
-			-0.237145f,0.521343f,-0.819734f,0.0f,
-			-0.237145f,0.521343f,-0.819734f,0.0f,
-			-0.430940f,0.184619f,-0.883293f,0.0f,
-			-0.430940f,0.184619f,-0.883293f,0.0f,
-			-0.430940f,0.184619f,-0.883293f,0.0f,
-			-0.471204f,0.177960f,-0.863885f,0.0f,
-			-0.471204f,0.177960f,-0.863885f,0.0f,
-			-0.471204f,0.177960f,-0.863885f,0.0f,
-			0.004827f,-0.589572f,-0.807701f,0.0f,
-			0.004827f,-0.589572f,-0.807701f,0.0f,
-			0.004827f,-0.589572f,-0.807701f,0.0f,
-			0.005565f,-0.592766f,-0.805356f,0.0f,
-			0.005565f,-0.592766f,-0.805356f,0.0f,
-			0.005565f,-0.592766f,-0.805356f,0.0f,
-			0.045399f,-0.581737f,-0.812109f,0.0f,
-			0.045399f,-0.581737f,-0.812109f,0.0f,
-			0.045399f,-0.581737f,-0.812109f,0.0f,
-			0.054659f,-0.602697f,-0.796096f,0.0f,
-			0.054659f,-0.602697f,-0.796096f,0.0f,
-			0.054659f,-0.602697f,-0.796096f,0.0f,
-			0.175512f,-0.510313f,-0.841888f,0.0f,
-			0.175512f,-0.510313f,-0.841888f,0.0f,
-			0.175512f,-0.510313f,-0.841888f,0.0f,
-			0.220284f,-0.544487f,-0.809326f,0.0f,
-			0.220284f,-0.544487f,-0.809326f,0.0f,
-			0.220284f,-0.544487f,-0.809326f,0.0f,
-			0.417797f,-0.212812f,-0.883265f,0.0f,
-			0.417797f,-0.212812f,-0.883265f,0.0f,
-			0.417797f,-0.212812f,-0.883265f,0.0f,
-			0.469092f,-0.200964f,-0.859980f,0.0f,
-			0.469092f,-0.200964f,-0.859980f,0.0f,
-			0.469092f,-0.200964f,-0.859980f,0.0f,
-			0.007365f,-0.979087f,-0.203308f,0.0f,
-			0.007365f,-0.979087f,-0.203308f,0.0f,
-			0.007365f,-0.979087f,-0.203308f,0.0f,
-			0.008019f,-0.979451f,-0.201522f,0.0f,
-			0.008019f,-0.979451f,-0.201522f,0.0f,
-			0.008019f,-0.979451f,-0.201522f,0.0f,
-			0.069561f,-0.976096f,-0.205908f,0.0f,
-			0.069561f,-0.976096f,-0.205908f,0.0f,
-			0.069561f,-0.976096f,-0.205908f,0.0f,
-			0.076336f,-0.978160f,-0.193327f,0.0f,
-			0.076336f,-0.978160f,-0.193327f,0.0f,
-			0.076336f,-0.978160f,-0.193327f,0.0f,
-			0.290142f,-0.929775f,-0.226575f,0.0f,
-			0.290142f,-0.929775f,-0.226575f,0.0f,
-			0.290142f,-0.929775f,-0.226575f,0.0f,
-			0.319029f,-0.927602f,-0.194359f,0.0f,
-			0.319029f,-0.927602f,-0.194359f,0.0f,
-			0.319029f,-0.927602f,-0.194359f,0.0f,
-			0.837512f,-0.472836f,-0.273860f,0.0f,
-			0.837512f,-0.472836f,-0.273860f,0.0f,
-			0.837512f,-0.472836f,-0.273860f,0.0f,
-			0.864959f,-0.440582f,-0.240277f,0.0f,
-			0.864959f,-0.440582f,-0.240277f,0.0f,
-			0.864959f,-0.440582f,-0.240277f,0.0f,
-			0.947142f,0.183567f,0.263106f,0.0f,
-			0.947142f,0.183567f,0.263106f,0.0f,
-			0.947142f,0.183567f,0.263106f,0.0f,
-			0.948212f,0.181641f,0.260576f,0.0f,
-			0.948212f,0.181641f,0.260576f,0.0f,
-			0.948212f,0.181641f,0.260576f,0.0f,
-			0.851552f,0.450848f,0.267575f,0.0f,
-			0.851552f,0.450848f,0.267575f,0.0f,
-			0.851552f,0.450848f,0.267575f,0.0f,
-			0.869150f,0.435958f,0.233495f,0.0f,
-			0.869150f,0.435958f,0.233495f,0.0f,
-			0.869150f,0.435958f,0.233495f,0.0f,
-			0.707996f,0.662400f,0.244881f,0.0f,
-			0.707996f,0.662400f,0.244881f,0.0f,
-			0.707996f,0.662400f,0.244881f,0.0f,
-			0.736237f,0.649764f,0.189108f,0.0f,
-			0.736237f,0.649764f,0.189108f,0.0f,
-			0.736237f,0.649764f,0.189108f,0.0f,
-			0.512610f,0.831288f,0.214919f,0.0f,
-			0.512610f,0.831288f,0.214919f,0.0f,
-			0.512610f,0.831288f,0.214919f,0.0f,
-			0.528089f,0.829558f,0.181534f,0.0f,
-			0.528089f,0.829558f,0.181534f,0.0f,
-			0.528089f,0.829558f,0.181534f,0.0f,
-			0.476732f,0.094195f,0.873987f,0.0f,
-			0.476732f,0.094195f,0.873987f,0.0f,
-			0.476732f,0.094195f,0.873987f,0.0f,
-			0.480393f,0.093106f,0.872097f,0.0f,
-			0.480393f,0.093106f,0.872097f,0.0f,
-			0.480393f,0.093106f,0.872097f,0.0f,
-			0.414693f,0.241939f,0.877209f,0.0f,
-			0.414693f,0.241939f,0.877209f,0.0f,
-			0.414693f,0.241939f,0.877209f,0.0f,
-			0.469248f,0.248440f,0.847398f,0.0f,
-			0.469248f,0.248440f,0.847398f,0.0f,
-			0.469248f,0.248440f,0.847398f,0.0f,
-			0.356064f,0.371205f,0.857569f,0.0f,
-			0.356064f,0.371205f,0.857569f,0.0f,
-			0.356064f,0.371205f,0.857569f,0.0f,
-			0.446497f,0.417742f,0.791285f,0.0f,
-			0.446497f,0.417742f,0.791285f,0.0f,
-			0.446497f,0.417742f,0.791285f,0.0f,
-			0.283891f,0.487882f,0.825456f,0.0f,
-			0.283891f,0.487882f,0.825456f,0.0f,
-			0.283891f,0.487882f,0.825456f,0.0f,
-			0.329531f,0.534392f,0.778354f,0.0f,
-			0.329531f,0.534392f,0.778354f,0.0f,
-			0.329531f,0.534392f,0.778354f,0.0f,
-			-0.476660f,-0.095478f,0.873887f,0.0f,
-			-0.476660f,-0.095478f,0.873887f,0.0f,
-			-0.476660f,-0.095478f,0.873887f,0.0f,
-			-0.479715f,-0.094784f,0.872290f,0.0f,
-			-0.479715f,-0.094784f,0.872290f,0.0f,
-			-0.479715f,-0.094784f,0.872290f,0.0f,
-			-0.407521f,-0.256440f,0.876450f,0.0f,
-			-0.407521f,-0.256440f,0.876450f,0.0f,
-			-0.407521f,-0.256440f,0.876450f,0.0f,
-			-0.454805f,-0.265341f,0.850145f,0.0f,
-			-0.454805f,-0.265341f,0.850145f,0.0f,
-			-0.454805f,-0.265341f,0.850145f,0.0f,
-			-0.340073f,-0.386934f,0.857107f,0.0f,
-			-0.340073f,-0.386934f,0.857107f,0.0f,
-			-0.340073f,-0.386934f,0.857107f,0.0f,
-			-0.415198f,-0.432854f,0.800155f,0.0f,
-			-0.415198f,-0.432854f,0.800155f,0.0f,
-			-0.415198f,-0.432854f,0.800155f,0.0f,
-			-0.273344f,-0.491786f,0.826698f,0.0f,
-			-0.273344f,-0.491786f,0.826698f,0.0f,
-			-0.273344f,-0.491786f,0.826698f,0.0f,
-			-0.310046f,-0.532830f,0.787378f,0.0f,
-			-0.310046f,-0.532830f,0.787378f,0.0f,
-			-0.310046f,-0.532830f,0.787378f,0.0f,
-			-0.945886f,-0.190417f,0.262757f,0.0f,
-			-0.945886f,-0.190417f,0.262757f,0.0f,
-			-0.945886f,-0.190417f,0.262757f,0.0f,
-			-0.946518f,-0.189593f,0.261073f,0.0f,
-			-0.946518f,-0.189593f,0.261073f,0.0f,
-			-0.946518f,-0.189593f,0.261073f,0.0f,
-			-0.809144f,-0.524247f,0.265427f,0.0f,
-			-0.809144f,-0.524247f,0.265427f,0.0f,
-			-0.809144f,-0.524247f,0.265427f,0.0f,
-			-0.821752f,-0.517102f,0.239435f,0.0f,
-			-0.821752f,-0.517102f,0.239435f,0.0f,
-			-0.821752f,-0.517102f,0.239435f,0.0f,
-			-0.627659f,-0.739215f,0.244142f,0.0f,
-			-0.627659f,-0.739215f,0.244142f,0.0f,
-			-0.627659f,-0.739215f,0.244142f,0.0f,
-			-0.646506f,-0.735592f,0.202322f,0.0f,
-			-0.646506f,-0.735592f,0.202322f,0.0f,
-			-0.646506f,-0.735592f,0.202322f,0.0f,
-			-0.467732f,-0.856648f,0.217670f,0.0f,
-			-0.467732f,-0.856648f,0.217670f,0.0f,
-			-0.467732f,-0.856648f,0.217670f,0.0f,
-			-0.476584f,-0.857446f,0.194048f,0.0f,
-			-0.476584f,-0.857446f,0.194048f,0.0f,
-			-0.476584f,-0.857446f,0.194048f,0.0f,
-			-0.946057f,-0.189501f,-0.262805f,0.0f,
-			-0.946057f,-0.189501f,-0.262805f,0.0f,
-			-0.946057f,-0.189501f,-0.262805f,0.0f,
-			-0.946319f,-0.190504f,-0.261129f,0.0f,
-			-0.946319f,-0.190504f,-0.261129f,0.0f,
-			-0.946319f,-0.190504f,-0.261129f,0.0f,
-			-0.815908f,-0.513425f,-0.265873f,0.0f,
-			-0.815908f,-0.513425f,-0.265873f,0.0f,
-			-0.815908f,-0.513425f,-0.265873f,0.0f,
-			-0.814701f,-0.527848f,-0.240083f,0.0f,
-			-0.814701f,-0.527848f,-0.240083f,0.0f,
-			-0.814701f,-0.527848f,-0.240083f,0.0f,
-			-0.640131f,-0.728340f,-0.244444f,0.0f,
-			-0.640131f,-0.728340f,-0.244444f,0.0f,
-			-0.640131f,-0.728340f,-0.244444f,0.0f,
-			-0.633653f,-0.746274f,-0.203860f,0.0f,
-			-0.633653f,-0.746274f,-0.203860f,0.0f,
-			-0.633653f,-0.746274f,-0.203860f,0.0f,
-			-0.474209f,-0.853171f,-0.217314f,0.0f,
-			-0.474209f,-0.853171f,-0.217314f,0.0f,
-			-0.474209f,-0.853171f,-0.217314f,0.0f,
-			-0.469968f,-0.860744f,-0.195577f,0.0f,
-			-0.469968f,-0.860744f,-0.195577f,0.0f,
-			-0.469968f,-0.860744f,-0.195577f,0.0f,
-			-0.476719f,-0.094192f,-0.873995f,0.0f,
-			-0.476719f,-0.094192f,-0.873995f,0.0f,
-			-0.476719f,-0.094192f,-0.873995f,0.0f,
-			-0.479235f,-0.095994f,-0.872421f,0.0f,
-			-0.479235f,-0.095994f,-0.872421f,0.0f,
-			-0.479235f,-0.095994f,-0.872421f,0.0f,
-			-0.414683f,-0.241933f,-0.877215f,0.0f,
-			-0.414683f,-0.241933f,-0.877215f,0.0f,
-			-0.414683f,-0.241933f,-0.877215f,0.0f,
-			-0.443055f,-0.278800f,-0.852040f,0.0f,
-			-0.443055f,-0.278800f,-0.852040f,0.0f,
-			-0.443055f,-0.278800f,-0.852040f,0.0f,
-			-0.356065f,-0.371206f,-0.857569f,0.0f,
-			-0.356065f,-0.371206f,-0.857569f,0.0f,
-			-0.356065f,-0.371206f,-0.857569f,0.0f,
-			-0.390430f,-0.444230f,-0.806365f,0.0f,
-			-0.390430f,-0.444230f,-0.806365f,0.0f,
-			-0.390430f,-0.444230f,-0.806365f,0.0f,
-			-0.283900f,-0.487897f,-0.825444f,0.0f,
-			-0.283900f,-0.487897f,-0.825444f,0.0f,
-			-0.283900f,-0.487897f,-0.825444f,0.0f,
-			-0.295416f,-0.531498f,-0.793876f,0.0f,
-			-0.295416f,-0.531498f,-0.793876f,0.0f,
-			-0.295416f,-0.531498f,-0.793876f,0.0f,
-			0.476812f,0.092412f,-0.874134f,0.0f,
-			0.476812f,0.092412f,-0.874134f,0.0f,
-			0.476812f,0.092412f,-0.874134f,0.0f,
-			0.479727f,0.094787f,-0.872283f,0.0f,
-			0.479727f,0.094787f,-0.872283f,0.0f,
-			0.479727f,0.094787f,-0.872283f,0.0f,
-			0.423302f,0.224114f,-0.877831f,0.0f,
-			0.423302f,0.224114f,-0.877831f,0.0f,
-			0.423302f,0.224114f,-0.877831f,0.0f,
-			0.454804f,0.265341f,-0.850146f,0.0f,
-			0.454804f,0.265341f,-0.850146f,0.0f,
-			0.454804f,0.265341f,-0.850146f,0.0f,
-			0.375640f,0.351448f,-0.857542f,0.0f,
-			0.375640f,0.351448f,-0.857542f,0.0f,
-			0.375640f,0.351448f,-0.857542f,0.0f,
-			0.415184f,0.432839f,-0.800171f,0.0f,
-			0.415184f,0.432839f,-0.800171f,0.0f,
-			0.415184f,0.432839f,-0.800171f,0.0f,
-			0.297653f,0.482698f,-0.823654f,0.0f,
-			0.297653f,0.482698f,-0.823654f,0.0f,
-			0.297653f,0.482698f,-0.823654f,0.0f,
-			0.310042f,0.532822f,-0.787385f,0.0f,
-			0.310042f,0.532822f,-0.787385f,0.0f,
-			0.310042f,0.532822f,-0.787385f,0.0f,
-			0.947511f,0.181507f,-0.263208f,0.0f,
-			0.947511f,0.181507f,-0.263208f,0.0f,
-			0.947511f,0.181507f,-0.263208f,0.0f,
-			0.947781f,0.183691f,-0.260707f,0.0f,
-			0.947781f,0.183691f,-0.260707f,0.0f,
-			0.947781f,0.183691f,-0.260707f,0.0f,
-			0.861206f,0.431973f,-0.267811f,0.0f,
-			0.861206f,0.431973f,-0.267811f,0.0f,
-			0.861206f,0.431973f,-0.267811f,0.0f,
-			0.859020f,0.454802f,-0.235031f,0.0f,
-			0.859020f,0.454802f,-0.235031f,0.0f,
-			0.859020f,0.454802f,-0.235031f,0.0f,
-			0.726992f,0.641606f,-0.244589f,0.0f,
-			0.726992f,0.641606f,-0.244589f,0.0f,
-			0.726992f,0.641606f,-0.244589f,0.0f,
-			0.716585f,0.670435f,-0.192414f,0.0f,
-			0.716585f,0.670435f,-0.192414f,0.0f,
-			0.716585f,0.670435f,-0.192414f,0.0f,
-			0.524562f,0.824018f,-0.214075f,0.0f,
-			0.524562f,0.824018f,-0.214075f,0.0f,
-			0.524562f,0.824018f,-0.214075f,0.0f,
-			0.515854f,0.836549f,-0.184609f,0.0f,
-			0.515854f,0.836549f,-0.184609f,0.0f,
-			0.515854f,0.836549f,-0.184609f,0.0f,
-			-0.233034f,0.918665f,0.318981f,0.0f,
-			-0.233034f,0.918665f,0.318981f,0.0f,
-			-0.233034f,0.918665f,0.318981f,0.0f,
-			-0.214238f,0.932922f,0.289410f,0.0f,
-			-0.214238f,0.932922f,0.289410f,0.0f,
-			-0.214238f,0.932922f,0.289410f,0.0f,
-			-0.753737f,0.605671f,0.255035f,0.0f,
-			-0.753737f,0.605671f,0.255035f,0.0f,
-			-0.753737f,0.605671f,0.255035f,0.0f,
-			-0.757910f,0.594698f,0.268156f,0.0f,
-			-0.757910f,0.594698f,0.268156f,0.0f,
-			-0.757910f,0.594698f,0.268156f,0.0f,
-			-0.897516f,0.367166f,0.244241f,0.0f,
-			-0.897516f,0.367166f,0.244241f,0.0f,
-			-0.897516f,0.367166f,0.244241f,0.0f,
-			-0.891367f,0.316645f,0.324348f,0.0f,
-			-0.891367f,0.316645f,0.324348f,0.0f,
-			-0.891367f,0.316645f,0.324348f,0.0f,
-			-0.730286f,0.610874f,0.305802f,0.0f,
-			-0.730286f,0.610874f,0.305802f,0.0f,
-			-0.730286f,0.610874f,0.305802f,0.0f,
-			-0.715995f,0.509417f,0.477332f,0.0f,
-			-0.715995f,0.509417f,0.477332f,0.0f,
-			-0.715995f,0.509417f,0.477332f,0.0f,
-			-0.071306f,0.398932f,0.914204f,0.0f,
-			-0.071306f,0.398932f,0.914204f,0.0f,
-			-0.071306f,0.398932f,0.914204f,0.0f,
-			-0.062718f,0.449478f,0.891087f,0.0f,
-			-0.062718f,0.449478f,0.891087f,0.0f,
-			-0.062718f,0.449478f,0.891087f,0.0f,
-			-0.234943f,0.384387f,0.892776f,0.0f,
-			-0.234943f,0.384387f,0.892776f,0.0f,
-			-0.234943f,0.384387f,0.892776f,0.0f,
-			-0.246673f,0.405470f,0.880197f,0.0f,
-			-0.246673f,0.405470f,0.880197f,0.0f,
-			-0.246673f,0.405470f,0.880197f,0.0f,
-			-0.338832f,0.328790f,0.881527f,0.0f,
-			-0.338832f,0.328790f,0.881527f,0.0f,
-			-0.338832f,0.328790f,0.881527f,0.0f,
-			-0.312188f,0.308571f,0.898511f,0.0f,
-			-0.312188f,0.308571f,0.898511f,0.0f,
-			-0.312188f,0.308571f,0.898511f,0.0f,
-			-0.279182f,0.380028f,0.881837f,0.0f,
-			-0.279182f,0.380028f,0.881837f,0.0f,
-			-0.279182f,0.380028f,0.881837f,0.0f,
-			-0.212755f,0.280033f,0.936118f,0.0f,
-			-0.212755f,0.280033f,0.936118f,0.0f,
-			-0.212755f,0.280033f,0.936118f,0.0f,
-			0.214891f,-0.390605f,0.895125f,0.0f,
-			0.214891f,-0.390605f,0.895125f,0.0f,
-			0.214891f,-0.390605f,0.895125f,0.0f,
-			0.214688f,-0.392894f,0.894172f,0.0f,
-			0.214688f,-0.392894f,0.894172f,0.0f,
-			0.214688f,-0.392894f,0.894172f,0.0f,
-			0.587807f,-0.192352f,0.785801f,0.0f,
-			0.587807f,-0.192352f,0.785801f,0.0f,
-			0.587807f,-0.192352f,0.785801f,0.0f,
-			0.549464f,-0.113917f,0.827715f,0.0f,
-			0.549464f,-0.113917f,0.827715f,0.0f,
-			0.549464f,-0.113917f,0.827715f,0.0f,
-			0.586112f,-0.068834f,0.807301f,0.0f,
-			0.586112f,-0.068834f,0.807301f,0.0f,
-			0.586112f,-0.068834f,0.807301f,0.0f,
-			0.442792f,0.067782f,0.894059f,0.0f,
-			0.442792f,0.067782f,0.894059f,0.0f,
-			0.442792f,0.067782f,0.894059f,0.0f,
-			0.334157f,-0.257217f,0.906741f,0.0f,
-			0.334157f,-0.257217f,0.906741f,0.0f,
-			0.334157f,-0.257217f,0.906741f,0.0f,
-			0.221123f,-0.067117f,0.972934f,0.0f,
-			0.221123f,-0.067117f,0.972934f,0.0f,
-			0.221123f,-0.067117f,0.972934f,0.0f,
-			0.393395f,-0.868504f,0.301563f,0.0f,
-			0.393395f,-0.868504f,0.301563f,0.0f,
-			0.393395f,-0.868504f,0.301563f,0.0f,
-			0.389623f,-0.873576f,0.291649f,0.0f,
-			0.389623f,-0.873576f,0.291649f,0.0f,
-			0.389623f,-0.873576f,0.291649f,0.0f,
-			0.862803f,-0.453428f,0.223547f,0.0f,
-			0.862803f,-0.453428f,0.223547f,0.0f,
-			0.862803f,-0.453428f,0.223547f,0.0f,
-			0.865531f,-0.432495f,0.252593f,0.0f,
-			0.865531f,-0.432495f,0.252593f,0.0f,
-			0.865531f,-0.432495f,0.252593f,0.0f,
-			0.923682f,-0.302632f,0.235000f,0.0f,
-			0.923682f,-0.302632f,0.235000f,0.0f,
-			0.923682f,-0.302632f,0.235000f,0.0f,
-			0.912192f,-0.251301f,0.323657f,0.0f,
-			0.912192f,-0.251301f,0.323657f,0.0f,
-			0.912192f,-0.251301f,0.323657f,0.0f,
-			0.655989f,-0.696195f,0.291531f,0.0f,
-			0.655989f,-0.696195f,0.291531f,0.0f,
-			0.655989f,-0.696195f,0.291531f,0.0f,
-			0.650109f,-0.624111f,0.433409f,0.0f,
-			0.650109f,-0.624111f,0.433409f,0.0f,
-			0.650109f,-0.624111f,0.433409f,0.0f,
-			0.388802f,-0.870349f,-0.302203f,0.0f,
-			0.388802f,-0.870349f,-0.302203f,0.0f,
-			0.388802f,-0.870349f,-0.302203f,0.0f,
-			0.394677f,-0.871334f,-0.291561f,0.0f,
-			0.394677f,-0.871334f,-0.291561f,0.0f,
-			0.394677f,-0.871334f,-0.291561f,0.0f,
-			0.870282f,-0.440371f,-0.220640f,0.0f,
-			0.870282f,-0.440371f,-0.220640f,0.0f,
-			0.870282f,-0.440371f,-0.220640f,0.0f,
-			0.856027f,-0.449867f,-0.254631f,0.0f,
-			0.856027f,-0.449867f,-0.254631f,0.0f,
-			0.856027f,-0.449867f,-0.254631f,0.0f,
-			0.934030f,-0.272924f,-0.230434f,0.0f,
-			0.934030f,-0.272924f,-0.230434f,0.0f,
-			0.934030f,-0.272924f,-0.230434f,0.0f,
-			0.898936f,-0.294524f,-0.324300f,0.0f,
-			0.898936f,-0.294524f,-0.324300f,0.0f,
-			0.898936f,-0.294524f,-0.324300f,0.0f,
-			0.681539f,-0.668940f,-0.296687f,0.0f,
-			0.681539f,-0.668940f,-0.296687f,0.0f,
-			0.681539f,-0.668940f,-0.296687f,0.0f,
-			0.623687f,-0.661913f,-0.415795f,0.0f,
-			0.623687f,-0.661913f,-0.415795f,0.0f,
-			0.623687f,-0.661913f,-0.415795f,0.0f,
-			0.213969f,-0.390676f,-0.895315f,0.0f,
-			0.213969f,-0.390676f,-0.895315f,0.0f,
-			0.213969f,-0.390676f,-0.895315f,0.0f,
-			0.215647f,-0.392496f,-0.894116f,0.0f,
-			0.215647f,-0.392496f,-0.894116f,0.0f,
-			0.215647f,-0.392496f,-0.894116f,0.0f,
-			0.617212f,-0.171554f,-0.767866f,0.0f,
-			0.617212f,-0.171554f,-0.767866f,0.0f,
-			0.617212f,-0.171554f,-0.767866f,0.0f,
-			0.521188f,-0.146789f,-0.840724f,0.0f,
-			0.521188f,-0.146789f,-0.840724f,0.0f,
-			0.521188f,-0.146789f,-0.840724f,0.0f,
-			0.622876f,-0.020286f,-0.782058f,0.0f,
-			0.622876f,-0.020286f,-0.782058f,0.0f,
-			0.622876f,-0.020286f,-0.782058f,0.0f,
-			0.424223f,-0.000170f,-0.905558f,0.0f,
-			0.424223f,-0.000170f,-0.905558f,0.0f,
-			0.424223f,-0.000170f,-0.905558f,0.0f,
-			0.356862f,-0.200359f,-0.912418f,0.0f,
-			0.356862f,-0.200359f,-0.912418f,0.0f,
-			0.356862f,-0.200359f,-0.912418f,0.0f,
-			0.219605f,-0.134615f,-0.966257f,0.0f,
-			0.219605f,-0.134615f,-0.966257f,0.0f,
-			0.219605f,-0.134615f,-0.966257f,0.0f,
-			-0.047123f,0.399496f,-0.915523f,0.0f,
-			-0.047123f,0.399496f,-0.915523f,0.0f,
-			-0.047123f,0.399496f,-0.915523f,0.0f,
-			-0.088224f,0.440846f,-0.893236f,0.0f,
-			-0.088224f,0.440846f,-0.893236f,0.0f,
-			-0.088224f,0.440846f,-0.893236f,0.0f,
-			-0.220665f,0.390404f,-0.893807f,0.0f,
-			-0.220665f,0.390404f,-0.893807f,0.0f,
-			-0.220665f,0.390404f,-0.893807f,0.0f,
-			-0.258805f,0.395868f,-0.881084f,0.0f,
-			-0.258805f,0.395868f,-0.881084f,0.0f,
-			-0.258805f,0.395868f,-0.881084f,0.0f,
-			-0.350868f,0.318103f,-0.880740f,0.0f,
-			-0.350868f,0.318103f,-0.880740f,0.0f,
-			-0.350868f,0.318103f,-0.880740f,0.0f,
-			-0.306488f,0.321376f,-0.895981f,0.0f,
-			-0.306488f,0.321376f,-0.895981f,0.0f,
-			-0.306488f,0.321376f,-0.895981f,0.0f,
-			-0.297457f,0.341254f,-0.891664f,0.0f,
-			-0.297457f,0.341254f,-0.891664f,0.0f,
-			-0.297457f,0.341254f,-0.891664f,0.0f,
-			-0.209815f,0.322049f,-0.923181f,0.0f,
-			-0.209815f,0.322049f,-0.923181f,0.0f,
-			-0.209815f,0.322049f,-0.923181f,0.0f,
-			-0.212005f,0.923200f,-0.320555f,0.0f,
-			-0.212005f,0.923200f,-0.320555f,0.0f,
-			-0.212005f,0.923200f,-0.320555f,0.0f,
-			-0.237367f,0.927042f,-0.290259f,0.0f,
-			-0.237367f,0.927042f,-0.290259f,0.0f,
-			-0.237367f,0.927042f,-0.290259f,0.0f,
-			-0.761045f,0.597157f,-0.253405f,0.0f,
-			-0.761045f,0.597157f,-0.253405f,0.0f,
-			-0.761045f,0.597157f,-0.253405f,0.0f,
-			-0.748826f,0.605766f,-0.268900f,0.0f,
-			-0.748826f,0.605766f,-0.268900f,0.0f,
-			-0.748826f,0.605766f,-0.268900f,0.0f,
-			-0.915158f,0.325096f,-0.238323f,0.0f,
-			-0.915158f,0.325096f,-0.238323f,0.0f,
-			-0.915158f,0.325096f,-0.238323f,0.0f,
-			-0.868769f,0.374803f,-0.323672f,0.0f,
-			-0.868769f,0.374803f,-0.323672f,0.0f,
-			-0.868769f,0.374803f,-0.323672f,0.0f,
-			-0.773865f,0.550590f,-0.313023f,0.0f,
-			-0.773865f,0.550590f,-0.313023f,0.0f,
-			-0.773865f,0.550590f,-0.313023f,0.0f,
-			-0.674962f,0.584761f,-0.449978f,0.0f,
-			-0.674962f,0.584761f,-0.449978f,0.0f,
-			-0.674962f,0.584761f,-0.449978f,0.0f,
-			-0.443600f,0.846026f,0.295735f,0.0f,
-			-0.443600f,0.846026f,0.295735f,0.0f,
-			-0.443600f,0.846026f,0.295735f,0.0f,
-			-0.474441f,0.808277f,0.348704f,0.0f,
-			-0.474441f,0.808277f,0.348704f,0.0f,
-			-0.474441f,0.808277f,0.348704f,0.0f,
-			-0.241662f,0.955508f,0.169128f,0.0f,
-			-0.241662f,0.955508f,0.169128f,0.0f,
-			-0.241662f,0.955508f,0.169128f,0.0f,
-			-0.251545f,0.950415f,0.182859f,0.0f,
-			-0.251545f,0.950415f,0.182859f,0.0f,
-			-0.251545f,0.950415f,0.182859f,0.0f,
-			0.545041f,0.689657f,-0.476763f,0.0f,
-			0.545041f,0.689657f,-0.476763f,0.0f,
-			0.545041f,0.689657f,-0.476763f,0.0f,
-			0.574255f,0.638058f,-0.512946f,0.0f,
-			0.574255f,0.638058f,-0.512946f,0.0f,
-			0.574255f,0.638058f,-0.512946f,0.0f,
-			0.581789f,-0.657063f,-0.479363f,0.0f,
-			0.581789f,-0.657063f,-0.479363f,0.0f,
-			0.581789f,-0.657063f,-0.479363f,0.0f,
-			0.635510f,-0.611982f,-0.470750f,0.0f,
-			0.635510f,-0.611982f,-0.470750f,0.0f,
-			0.635510f,-0.611982f,-0.470750f,0.0f,
-			-0.185174f,0.549430f,0.814762f,0.0f,
-			-0.185174f,0.549430f,0.814762f,0.0f,
-			-0.185174f,0.549430f,0.814762f,0.0f,
-			-0.179862f,0.488783f,0.853663f,0.0f,
-			-0.179862f,0.488783f,0.853663f,0.0f,
-			-0.179862f,0.488783f,0.853663f,0.0f,
-			-0.111189f,0.876433f,0.468512f,0.0f,
-			-0.111189f,0.876433f,0.468512f,0.0f,
-			-0.111189f,0.876433f,0.468512f,0.0f,
-			-0.110401f,0.892238f,0.437862f,0.0f,
-			-0.110401f,0.892238f,0.437862f,0.0f,
-			-0.110401f,0.892238f,0.437862f,0.0f,
-			0.075260f,0.815549f,-0.573774f,0.0f,
-			0.075260f,0.815549f,-0.573774f,0.0f,
-			0.075260f,0.815549f,-0.573774f,0.0f,
-			0.075925f,0.800835f,-0.594053f,0.0f,
-			0.075925f,0.800835f,-0.594053f,0.0f,
-			0.075925f,0.800835f,-0.594053f,0.0f,
-			0.176500f,-0.108923f,-0.978255f,0.0f,
-			0.176500f,-0.108923f,-0.978255f,0.0f,
-			0.176500f,-0.108923f,-0.978255f,0.0f,
-			0.199943f,-0.067316f,-0.977492f,0.0f,
-			0.199943f,-0.067316f,-0.977492f,0.0f,
-			0.199943f,-0.067316f,-0.977492f,0.0f,
-			0.213001f,-0.276204f,0.937199f,0.0f,
-			0.213001f,-0.276204f,0.937199f,0.0f,
-			0.213001f,-0.276204f,0.937199f,0.0f,
-			0.195958f,-0.141136f,0.970403f,0.0f,
-			0.195958f,-0.141136f,0.970403f,0.0f,
-			0.195958f,-0.141136f,0.970403f,0.0f,
-			0.144690f,0.597241f,0.788903f,0.0f,
-			0.144690f,0.597241f,0.788903f,0.0f,
-			0.144690f,0.597241f,0.788903f,0.0f,
-			0.090463f,0.757451f,0.646595f,0.0f,
-			0.090463f,0.757451f,0.646595f,0.0f,
-			0.090463f,0.757451f,0.646595f,0.0f,
-			-0.107403f,0.901372f,-0.419516f,0.0f,
-			-0.107403f,0.901372f,-0.419516f,0.0f,
-			-0.107403f,0.901372f,-0.419516f,0.0f,
-			-0.105935f,0.903161f,-0.416026f,0.0f,
-			-0.105935f,0.903161f,-0.416026f,0.0f,
-			-0.105935f,0.903161f,-0.416026f,0.0f,
-			-0.166680f,0.517889f,-0.839052f,0.0f,
-			-0.166680f,0.517889f,-0.839052f,0.0f,
-			-0.166680f,0.517889f,-0.839052f,0.0f,
-			-0.171829f,0.514575f,-0.840052f,0.0f,
-			-0.171829f,0.514575f,-0.840052f,0.0f,
-			-0.171829f,0.514575f,-0.840052f,0.0f,
-			0.418219f,-0.864497f,0.278815f,0.0f,
-			0.418219f,-0.864497f,0.278815f,0.0f,
-			0.418219f,-0.864497f,0.278815f,0.0f,
-			0.440603f,-0.837783f,0.322473f,0.0f,
-			0.440603f,-0.837783f,0.322473f,0.0f,
-			0.440603f,-0.837783f,0.322473f,0.0f,
-			0.715678f,-0.445268f,0.538091f,0.0f,
-			0.715678f,-0.445268f,0.538091f,0.0f,
-			0.715678f,-0.445268f,0.538091f,0.0f,
-			0.761295f,-0.137436f,0.633673f,0.0f,
-			0.761295f,-0.137436f,0.633673f,0.0f,
-			0.761295f,-0.137436f,0.633673f,0.0f,
-			-0.213796f,0.965168f,-0.150806f,0.0f,
-			-0.213796f,0.965168f,-0.150806f,0.0f,
-			-0.213796f,0.965168f,-0.150806f,0.0f,
-			-0.209766f,0.966139f,-0.150247f,0.0f,
-			-0.209766f,0.966139f,-0.150247f,0.0f,
-			-0.209766f,0.966139f,-0.150247f,0.0f,
-			-0.354598f,0.893077f,-0.276902f,0.0f,
-			-0.354598f,0.893077f,-0.276902f,0.0f,
-			-0.354598f,0.893077f,-0.276902f,0.0f,
-			-0.363460f,0.891859f,-0.269230f,0.0f,
-			-0.363460f,0.891859f,-0.269230f,0.0f,
-			-0.363460f,0.891859f,-0.269230f,0.0f,
-			0.442766f,-0.846657f,-0.295180f,0.0f,
-			0.442766f,-0.846657f,-0.295180f,0.0f,
-			0.442766f,-0.846657f,-0.295180f,0.0f,
-			0.415057f,-0.857961f,-0.302704f,0.0f,
-			0.415057f,-0.857961f,-0.302704f,0.0f,
-			0.415057f,-0.857961f,-0.302704f,0.0f,
-			0.781666f,-0.195559f,-0.592245f,0.0f,
-			0.781666f,-0.195559f,-0.592245f,0.0f,
-			0.781666f,-0.195559f,-0.592245f,0.0f,
-			0.696979f,-0.433634f,-0.571122f,0.0f,
-			0.696979f,-0.433634f,-0.571122f,0.0f,
-			0.696979f,-0.433634f,-0.571122f,0.0f,
-			-0.210516f,0.966319f,0.148025f,0.0f,
-			-0.210516f,0.966319f,0.148025f,0.0f,
-			-0.210516f,0.966319f,0.148025f,0.0f,
-			-0.213701f,0.964737f,0.153670f,0.0f,
-			-0.213701f,0.964737f,0.153670f,0.0f,
-			-0.213701f,0.964737f,0.153670f,0.0f,
-			-0.361193f,0.888604f,0.282706f,0.0f,
-			-0.361193f,0.888604f,0.282706f,0.0f,
-			-0.361193f,0.888604f,0.282706f,0.0f,
-			-0.355967f,0.896527f,0.263681f,0.0f,
-			-0.355967f,0.896527f,0.263681f,0.0f,
-			-0.355967f,0.896527f,0.263681f,0.0f,
-			0.217766f,-0.185730f,-0.958166f,0.0f,
-			0.217766f,-0.185730f,-0.958166f,0.0f,
-			0.217766f,-0.185730f,-0.958166f,0.0f,
-			0.194275f,-0.235870f,-0.952167f,0.0f,
-			0.194275f,-0.235870f,-0.952167f,0.0f,
-			0.194275f,-0.235870f,-0.952167f,0.0f,
-			0.117525f,0.736023f,-0.666677f,0.0f,
-			0.117525f,0.736023f,-0.666677f,0.0f,
-			0.117525f,0.736023f,-0.666677f,0.0f,
-			0.119746f,0.613401f,-0.780641f,0.0f,
-			0.119746f,0.613401f,-0.780641f,0.0f,
-			0.119746f,0.613401f,-0.780641f,0.0f,
-			-0.106708f,0.903413f,0.415280f,0.0f,
-			-0.106708f,0.903413f,0.415280f,0.0f,
-			-0.106708f,0.903413f,0.415280f,0.0f,
-			-0.106738f,0.900724f,0.421075f,0.0f,
-			-0.106738f,0.900724f,0.421075f,0.0f,
-			-0.106738f,0.900724f,0.421075f,0.0f,
-			-0.167401f,0.507437f,0.845272f,0.0f,
-			-0.167401f,0.507437f,0.845272f,0.0f,
-			-0.167401f,0.507437f,0.845272f,0.0f,
-			-0.170453f,0.525851f,0.833323f,0.0f,
-			-0.170453f,0.525851f,0.833323f,0.0f,
-			-0.170453f,0.525851f,0.833323f,0.0f,
-			-0.191125f,0.506245f,-0.840944f,0.0f,
-			-0.191125f,0.506245f,-0.840944f,0.0f,
-			-0.191125f,0.506245f,-0.840944f,0.0f,
-			-0.175506f,0.533931f,-0.827113f,0.0f,
-			-0.175506f,0.533931f,-0.827113f,0.0f,
-			-0.175506f,0.533931f,-0.827113f,0.0f,
-			-0.106694f,0.889359f,-0.444587f,0.0f,
-			-0.106694f,0.889359f,-0.444587f,0.0f,
-			-0.106694f,0.889359f,-0.444587f,0.0f,
-			-0.114786f,0.877902f,-0.464878f,0.0f,
-			-0.114786f,0.877902f,-0.464878f,0.0f,
-			-0.114786f,0.877902f,-0.464878f,0.0f,
-			0.079388f,0.800739f,0.593730f,0.0f,
-			0.079388f,0.800739f,0.593730f,0.0f,
-			0.079388f,0.800739f,0.593730f,0.0f,
-			0.071159f,0.818156f,0.570576f,0.0f,
-			0.071159f,0.818156f,0.570576f,0.0f,
-			0.071159f,0.818156f,0.570576f,0.0f,
-			0.174803f,-0.033610f,0.984030f,0.0f,
-			0.174803f,-0.033610f,0.984030f,0.0f,
-			0.174803f,-0.033610f,0.984030f,0.0f,
-			0.198077f,-0.151749f,0.968369f,0.0f,
-			0.198077f,-0.151749f,0.968369f,0.0f,
-			0.198077f,-0.151749f,0.968369f,0.0f,
-			-0.479637f,0.817130f,-0.319760f,0.0f,
-			-0.479637f,0.817130f,-0.319760f,0.0f,
-			-0.479637f,0.817130f,-0.319760f,0.0f,
-			-0.437607f,0.840239f,-0.320154f,0.0f,
-			-0.437607f,0.840239f,-0.320154f,0.0f,
-			-0.437607f,0.840239f,-0.320154f,0.0f,
-			-0.251822f,0.951463f,-0.176929f,0.0f,
-			-0.251822f,0.951463f,-0.176929f,0.0f,
-			-0.251822f,0.951463f,-0.176929f,0.0f,
-			-0.239970f,0.955237f,-0.173023f,0.0f,
-			-0.239970f,0.955237f,-0.173023f,0.0f,
-			-0.239970f,0.955237f,-0.173023f,0.0f,
-			0.578139f,0.642373f,0.503103f,0.0f,
-			0.578139f,0.642373f,0.503103f,0.0f,
-			0.578139f,0.642373f,0.503103f,0.0f,
-			0.535102f,0.694437f,0.481064f,0.0f,
-			0.535102f,0.694437f,0.481064f,0.0f,
-			0.535102f,0.694437f,0.481064f,0.0f,
-			0.618425f,-0.595530f,0.512733f,0.0f,
-			0.618425f,-0.595530f,0.512733f,0.0f,
-			0.618425f,-0.595530f,0.512733f,0.0f,
-			0.591196f,-0.677279f,0.437927f,0.0f,
-			0.591196f,-0.677279f,0.437927f,0.0f,
-			0.591196f,-0.677279f,0.437927f,0.0f,
-			0.142948f,0.989333f,0.028023f,0.0f,
-			0.142948f,0.989333f,0.028023f,0.0f,
-			0.142948f,0.989333f,0.028023f,0.0f,
-			0.973334f,-0.127333f,0.190806f,0.0f,
-			0.973334f,-0.127333f,0.190806f,0.0f,
-			0.973334f,-0.127333f,0.190806f,0.0f,
-			0.973328f,-0.127220f,0.190910f,0.0f,
-			0.973328f,-0.127220f,0.190910f,0.0f,
-			0.973328f,-0.127220f,0.190910f,0.0f,
-			0.747045f,-0.648424f,0.146527f,0.0f,
-			0.747045f,-0.648424f,0.146527f,0.0f,
-			0.747045f,-0.648424f,0.146527f,0.0f,
-			0.747098f,-0.648277f,0.146906f,0.0f,
-			0.747098f,-0.648277f,0.146906f,0.0f,
-			0.747098f,-0.648277f,0.146906f,0.0f,
-			0.980963f,0.022477f,0.192892f,0.0f,
-			0.980963f,0.022477f,0.192892f,0.0f,
-			0.980963f,0.022477f,0.192892f,0.0f,
-			0.980801f,0.022943f,0.193659f,0.0f,
-			0.980801f,0.022943f,0.193659f,0.0f,
-			0.980801f,0.022943f,0.193659f,0.0f,
-			0.120579f,0.989433f,0.080512f,0.0f,
-			0.120579f,0.989433f,0.080512f,0.0f,
-			0.120579f,0.989433f,0.080512f,0.0f,
-			0.824802f,-0.128067f,0.550726f,0.0f,
-			0.824802f,-0.128067f,0.550726f,0.0f,
-			0.824802f,-0.128067f,0.550726f,0.0f,
-			0.824770f,-0.127991f,0.550793f,0.0f,
-			0.824770f,-0.127991f,0.550793f,0.0f,
-			0.824770f,-0.127991f,0.550793f,0.0f,
-			0.631717f,-0.650353f,0.421870f,0.0f,
-			0.631717f,-0.650353f,0.421870f,0.0f,
-			0.631717f,-0.650353f,0.421870f,0.0f,
-			0.631633f,-0.650237f,0.422174f,0.0f,
-			0.631633f,-0.650237f,0.422174f,0.0f,
-			0.631633f,-0.650237f,0.422174f,0.0f,
-			0.831190f,0.021940f,0.555555f,0.0f,
-			0.831190f,0.021940f,0.555555f,0.0f,
-			0.831190f,0.021940f,0.555555f,0.0f,
-			0.830837f,0.022293f,0.556070f,0.0f,
-			0.830837f,0.022293f,0.556070f,0.0f,
-			0.830837f,0.022293f,0.556070f,0.0f,
-			0.080512f,0.989433f,0.120579f,0.0f,
-			0.080512f,0.989433f,0.120579f,0.0f,
-			0.080512f,0.989433f,0.120579f,0.0f,
-			0.550732f,-0.127993f,0.824810f,0.0f,
-			0.550732f,-0.127993f,0.824810f,0.0f,
-			0.550732f,-0.127993f,0.824810f,0.0f,
-			0.550787f,-0.128069f,0.824762f,0.0f,
-			0.550787f,-0.128069f,0.824762f,0.0f,
-			0.550787f,-0.128069f,0.824762f,0.0f,
-			0.421912f,-0.650265f,0.631780f,0.0f,
-			0.421912f,-0.650265f,0.631780f,0.0f,
-			0.421912f,-0.650265f,0.631780f,0.0f,
-			0.422105f,-0.650383f,0.631529f,0.0f,
-			0.422105f,-0.650383f,0.631529f,0.0f,
-			0.422105f,-0.650383f,0.631529f,0.0f,
-			0.555551f,0.022296f,0.831183f,0.0f,
-			0.555551f,0.022296f,0.831183f,0.0f,
-			0.555551f,0.022296f,0.831183f,0.0f,
-			0.556074f,0.021942f,0.830843f,0.0f,
-			0.556074f,0.021942f,0.830843f,0.0f,
-			0.556074f,0.021942f,0.830843f,0.0f,
-			0.028024f,0.989334f,0.142947f,0.0f,
-			0.028024f,0.989334f,0.142947f,0.0f,
-			0.028024f,0.989334f,0.142947f,0.0f,
-			0.190819f,-0.127236f,0.973344f,0.0f,
-			0.190819f,-0.127236f,0.973344f,0.0f,
-			0.190819f,-0.127236f,0.973344f,0.0f,
-			0.190905f,-0.127336f,0.973314f,0.0f,
-			0.190905f,-0.127336f,0.973314f,0.0f,
-			0.190905f,-0.127336f,0.973314f,0.0f,
-			0.146544f,-0.648311f,0.747140f,0.0f,
-			0.146544f,-0.648311f,0.747140f,0.0f,
-			0.146544f,-0.648311f,0.747140f,0.0f,
-			0.146876f,-0.648462f,0.746944f,0.0f,
-			0.146876f,-0.648462f,0.746944f,0.0f,
-			0.146876f,-0.648462f,0.746944f,0.0f,
-			0.192890f,0.022946f,0.980952f,0.0f,
-			0.192890f,0.022946f,0.980952f,0.0f,
-			0.192890f,0.022946f,0.980952f,0.0f,
-			0.193662f,0.022480f,0.980811f,0.0f,
-			0.193662f,0.022480f,0.980811f,0.0f,
-			0.193662f,0.022480f,0.980811f,0.0f,
-			-0.028024f,0.989334f,0.142947f,0.0f,
-			-0.028024f,0.989334f,0.142947f,0.0f,
-			-0.028024f,0.989334f,0.142947f,0.0f,
-			-0.190816f,-0.127334f,0.973332f,0.0f,
-			-0.190816f,-0.127334f,0.973332f,0.0f,
-			-0.190816f,-0.127334f,0.973332f,0.0f,
-			-0.190908f,-0.127234f,0.973327f,0.0f,
-			-0.190908f,-0.127234f,0.973327f,0.0f,
-			-0.190908f,-0.127234f,0.973327f,0.0f,
-			-0.146525f,-0.648423f,0.747046f,0.0f,
-			-0.146525f,-0.648423f,0.747046f,0.0f,
-			-0.146525f,-0.648423f,0.747046f,0.0f,
-			-0.146906f,-0.648276f,0.747099f,0.0f,
-			-0.146906f,-0.648276f,0.747099f,0.0f,
-			-0.146906f,-0.648276f,0.747099f,0.0f,
-			-0.192892f,0.022477f,0.980962f,0.0f,
-			-0.192892f,0.022477f,0.980962f,0.0f,
-			-0.192892f,0.022477f,0.980962f,0.0f,
-			-0.193660f,0.022943f,0.980800f,0.0f,
-			-0.193660f,0.022943f,0.980800f,0.0f,
-			-0.193660f,0.022943f,0.980800f,0.0f,
-			-0.080512f,0.989433f,0.120579f,0.0f,
-			-0.080512f,0.989433f,0.120579f,0.0f,
-			-0.080512f,0.989433f,0.120579f,0.0f,
-			-0.550726f,-0.128067f,0.824802f,0.0f,
-			-0.550726f,-0.128067f,0.824802f,0.0f,
-			-0.550726f,-0.128067f,0.824802f,0.0f,
-			-0.550793f,-0.127991f,0.824770f,0.0f,
-			-0.550793f,-0.127991f,0.824770f,0.0f,
-			-0.550793f,-0.127991f,0.824770f,0.0f,
-			-0.421869f,-0.650353f,0.631717f,0.0f,
-			-0.421869f,-0.650353f,0.631717f,0.0f,
-			-0.421869f,-0.650353f,0.631717f,0.0f,
-			-0.422174f,-0.650237f,0.631633f,0.0f,
-			-0.422174f,-0.650237f,0.631633f,0.0f,
-			-0.422174f,-0.650237f,0.631633f,0.0f,
-			-0.555555f,0.021940f,0.831190f,0.0f,
-			-0.555555f,0.021940f,0.831190f,0.0f,
-			-0.555555f,0.021940f,0.831190f,0.0f,
-			-0.556070f,0.022293f,0.830837f,0.0f,
-			-0.556070f,0.022293f,0.830837f,0.0f,
-			-0.556070f,0.022293f,0.830837f,0.0f,
-			-0.120579f,0.989433f,0.080512f,0.0f,
-			-0.120579f,0.989433f,0.080512f,0.0f,
-			-0.120579f,0.989433f,0.080512f,0.0f,
-			-0.824811f,-0.127993f,0.550732f,0.0f,
-			-0.824811f,-0.127993f,0.550732f,0.0f,
-			-0.824811f,-0.127993f,0.550732f,0.0f,
-			-0.824762f,-0.128069f,0.550787f,0.0f,
-			-0.824762f,-0.128069f,0.550787f,0.0f,
-			-0.824762f,-0.128069f,0.550787f,0.0f,
-			-0.631780f,-0.650265f,0.421911f,0.0f,
-			-0.631780f,-0.650265f,0.421911f,0.0f,
-			-0.631780f,-0.650265f,0.421911f,0.0f,
-			-0.631529f,-0.650383f,0.422105f,0.0f,
-			-0.631529f,-0.650383f,0.422105f,0.0f,
-			-0.631529f,-0.650383f,0.422105f,0.0f,
-			-0.831183f,0.022296f,0.555551f,0.0f,
-			-0.831183f,0.022296f,0.555551f,0.0f,
-			-0.831183f,0.022296f,0.555551f,0.0f,
-			-0.830843f,0.021942f,0.556074f,0.0f,
-			-0.830843f,0.021942f,0.556074f,0.0f,
-			-0.830843f,0.021942f,0.556074f,0.0f,
-			-0.142947f,0.989334f,0.028024f,0.0f,
-			-0.142947f,0.989334f,0.028024f,0.0f,
-			-0.142947f,0.989334f,0.028024f,0.0f,
-			-0.973344f,-0.127236f,0.190818f,0.0f,
-			-0.973344f,-0.127236f,0.190818f,0.0f,
-			-0.973344f,-0.127236f,0.190818f,0.0f,
-			-0.973314f,-0.127336f,0.190905f,0.0f,
-			-0.973314f,-0.127336f,0.190905f,0.0f,
-			-0.973314f,-0.127336f,0.190905f,0.0f,
-			-0.747140f,-0.648311f,0.146543f,0.0f,
-			-0.747140f,-0.648311f,0.146543f,0.0f,
-			-0.747140f,-0.648311f,0.146543f,0.0f,
-			-0.746944f,-0.648462f,0.146876f,0.0f,
-			-0.746944f,-0.648462f,0.146876f,0.0f,
-			-0.746944f,-0.648462f,0.146876f,0.0f,
-			-0.980952f,0.022946f,0.192890f,0.0f,
-			-0.980952f,0.022946f,0.192890f,0.0f,
-			-0.980952f,0.022946f,0.192890f,0.0f,
-			-0.980811f,0.022480f,0.193661f,0.0f,
-			-0.980811f,0.022480f,0.193661f,0.0f,
-			-0.980811f,0.022480f,0.193661f,0.0f,
-			-0.142947f,0.989334f,-0.028024f,0.0f,
-			-0.142947f,0.989334f,-0.028024f,0.0f,
-			-0.142947f,0.989334f,-0.028024f,0.0f,
-			-0.973332f,-0.127334f,-0.190816f,0.0f,
-			-0.973332f,-0.127334f,-0.190816f,0.0f,
-			-0.973332f,-0.127334f,-0.190816f,0.0f,
-			-0.973327f,-0.127234f,-0.190908f,0.0f,
-			-0.973327f,-0.127234f,-0.190908f,0.0f,
-			-0.973327f,-0.127234f,-0.190908f,0.0f,
-			-0.747046f,-0.648423f,-0.146525f,0.0f,
-			-0.747046f,-0.648423f,-0.146525f,0.0f,
-			-0.747046f,-0.648423f,-0.146525f,0.0f,
-			-0.747099f,-0.648275f,-0.146907f,0.0f,
-			-0.747099f,-0.648275f,-0.146907f,0.0f,
-			-0.747099f,-0.648275f,-0.146907f,0.0f,
-			-0.980962f,0.022477f,-0.192893f,0.0f,
-			-0.980962f,0.022477f,-0.192893f,0.0f,
-			-0.980962f,0.022477f,-0.192893f,0.0f,
-			-0.980800f,0.022943f,-0.193660f,0.0f,
-			-0.980800f,0.022943f,-0.193660f,0.0f,
-			-0.980800f,0.022943f,-0.193660f,0.0f,
-			-0.120580f,0.989433f,-0.080512f,0.0f,
-			-0.120580f,0.989433f,-0.080512f,0.0f,
-			-0.120580f,0.989433f,-0.080512f,0.0f,
-			-0.824803f,-0.128067f,-0.550726f,0.0f,
-			-0.824803f,-0.128067f,-0.550726f,0.0f,
-			-0.824803f,-0.128067f,-0.550726f,0.0f,
-			-0.824770f,-0.127991f,-0.550793f,0.0f,
-			-0.824770f,-0.127991f,-0.550793f,0.0f,
-			-0.824770f,-0.127991f,-0.550793f,0.0f,
-			-0.631717f,-0.650353f,-0.421869f,0.0f,
-			-0.631717f,-0.650353f,-0.421869f,0.0f,
-			-0.631717f,-0.650353f,-0.421869f,0.0f,
-			-0.631633f,-0.650237f,-0.422174f,0.0f,
-			-0.631633f,-0.650237f,-0.422174f,0.0f,
-			-0.631633f,-0.650237f,-0.422174f,0.0f,
-			-0.831190f,0.021940f,-0.555555f,0.0f,
-			-0.831190f,0.021940f,-0.555555f,0.0f,
-			-0.831190f,0.021940f,-0.555555f,0.0f,
-			-0.830837f,0.022293f,-0.556070f,0.0f,
-			-0.830837f,0.022293f,-0.556070f,0.0f,
-			-0.830837f,0.022293f,-0.556070f,0.0f,
-			-0.080511f,0.989433f,-0.120580f,0.0f,
-			-0.080511f,0.989433f,-0.120580f,0.0f,
-			-0.080511f,0.989433f,-0.120580f,0.0f,
-			-0.550727f,-0.127985f,-0.824815f,0.0f,
-			-0.550727f,-0.127985f,-0.824815f,0.0f,
-			-0.550727f,-0.127985f,-0.824815f,0.0f,
-			-0.550787f,-0.128069f,-0.824762f,0.0f,
-			-0.550787f,-0.128069f,-0.824762f,0.0f,
-			-0.550787f,-0.128069f,-0.824762f,0.0f,
-			-0.421911f,-0.650265f,-0.631780f,0.0f,
-			-0.421911f,-0.650265f,-0.631780f,0.0f,
-			-0.421911f,-0.650265f,-0.631780f,0.0f,
-			-0.422105f,-0.650383f,-0.631530f,0.0f,
-			-0.422105f,-0.650383f,-0.631530f,0.0f,
-			-0.422105f,-0.650383f,-0.631530f,0.0f,
-			-0.555551f,0.022296f,-0.831184f,0.0f,
-			-0.555551f,0.022296f,-0.831184f,0.0f,
-			-0.555551f,0.022296f,-0.831184f,0.0f,
-			-0.556074f,0.021942f,-0.830843f,0.0f,
-			-0.556074f,0.021942f,-0.830843f,0.0f,
-			-0.556074f,0.021942f,-0.830843f,0.0f,
-			-0.028023f,0.989333f,-0.142948f,0.0f,
-			-0.028023f,0.989333f,-0.142948f,0.0f,
-			-0.028023f,0.989333f,-0.142948f,0.0f,
-			-0.190814f,-0.127222f,-0.973347f,0.0f,
-			-0.190814f,-0.127222f,-0.973347f,0.0f,
-			-0.190814f,-0.127222f,-0.973347f,0.0f,
-			-0.190906f,-0.127328f,-0.973315f,0.0f,
-			-0.190906f,-0.127328f,-0.973315f,0.0f,
-			-0.190906f,-0.127328f,-0.973315f,0.0f,
-			-0.146544f,-0.648311f,-0.747140f,0.0f,
-			-0.146544f,-0.648311f,-0.747140f,0.0f,
-			-0.146544f,-0.648311f,-0.747140f,0.0f,
-			-0.146876f,-0.648462f,-0.746944f,0.0f,
-			-0.146876f,-0.648462f,-0.746944f,0.0f,
-			-0.146876f,-0.648462f,-0.746944f,0.0f,
-			-0.192890f,0.022946f,-0.980952f,0.0f,
-			-0.192890f,0.022946f,-0.980952f,0.0f,
-			-0.192890f,0.022946f,-0.980952f,0.0f,
-			-0.193662f,0.022480f,-0.980811f,0.0f,
-			-0.193662f,0.022480f,-0.980811f,0.0f,
-			-0.193662f,0.022480f,-0.980811f,0.0f,
-			0.028023f,0.989333f,-0.142948f,0.0f,
-			0.028023f,0.989333f,-0.142948f,0.0f,
-			0.028023f,0.989333f,-0.142948f,0.0f,
-			0.190811f,-0.127325f,-0.973334f,0.0f,
-			0.190811f,-0.127325f,-0.973334f,0.0f,
-			0.190811f,-0.127325f,-0.973334f,0.0f,
-			0.190908f,-0.127220f,-0.973329f,0.0f,
-			0.190908f,-0.127220f,-0.973329f,0.0f,
-			0.190908f,-0.127220f,-0.973329f,0.0f,
-			0.146525f,-0.648424f,-0.747046f,0.0f,
-			0.146525f,-0.648424f,-0.747046f,0.0f,
-			0.146525f,-0.648424f,-0.747046f,0.0f,
-			0.146906f,-0.648276f,-0.747099f,0.0f,
-			0.146906f,-0.648276f,-0.747099f,0.0f,
-			0.146906f,-0.648276f,-0.747099f,0.0f,
-			0.192892f,0.022477f,-0.980962f,0.0f,
-			0.192892f,0.022477f,-0.980962f,0.0f,
-			0.192892f,0.022477f,-0.980962f,0.0f,
-			0.193660f,0.022943f,-0.980800f,0.0f,
-			0.193660f,0.022943f,-0.980800f,0.0f,
-			0.193660f,0.022943f,-0.980800f,0.0f,
-			0.080511f,0.989433f,-0.120580f,0.0f,
-			0.080511f,0.989433f,-0.120580f,0.0f,
-			0.080511f,0.989433f,-0.120580f,0.0f,
-			0.550721f,-0.128067f,-0.824806f,0.0f,
-			0.550721f,-0.128067f,-0.824806f,0.0f,
-			0.550721f,-0.128067f,-0.824806f,0.0f,
-			0.550793f,-0.127984f,-0.824771f,0.0f,
-			0.550793f,-0.127984f,-0.824771f,0.0f,
-			0.550793f,-0.127984f,-0.824771f,0.0f,
-			0.421870f,-0.650353f,-0.631717f,0.0f,
-			0.421870f,-0.650353f,-0.631717f,0.0f,
-			0.421870f,-0.650353f,-0.631717f,0.0f,
-			0.422174f,-0.650237f,-0.631633f,0.0f,
-			0.422174f,-0.650237f,-0.631633f,0.0f,
-			0.422174f,-0.650237f,-0.631633f,0.0f,
-			0.555555f,0.021940f,-0.831190f,0.0f,
-			0.555555f,0.021940f,-0.831190f,0.0f,
-			0.555555f,0.021940f,-0.831190f,0.0f,
-			0.556070f,0.022293f,-0.830837f,0.0f,
-			0.556070f,0.022293f,-0.830837f,0.0f,
-			0.556070f,0.022293f,-0.830837f,0.0f,
-			0.120580f,0.989433f,-0.080512f,0.0f,
-			0.120580f,0.989433f,-0.080512f,0.0f,
-			0.120580f,0.989433f,-0.080512f,0.0f,
-			0.824811f,-0.127993f,-0.550732f,0.0f,
-			0.824811f,-0.127993f,-0.550732f,0.0f,
-			0.824811f,-0.127993f,-0.550732f,0.0f,
-			0.824762f,-0.128069f,-0.550787f,0.0f,
-			0.824762f,-0.128069f,-0.550787f,0.0f,
-			0.824762f,-0.128069f,-0.550787f,0.0f,
-			0.631780f,-0.650265f,-0.421911f,0.0f,
-			0.631780f,-0.650265f,-0.421911f,0.0f,
-			0.631780f,-0.650265f,-0.421911f,0.0f,
-			0.631529f,-0.650383f,-0.422105f,0.0f,
-			0.631529f,-0.650383f,-0.422105f,0.0f,
-			0.631529f,-0.650383f,-0.422105f,0.0f,
-			0.831184f,0.022296f,-0.555551f,0.0f,
-			0.831184f,0.022296f,-0.555551f,0.0f,
-			0.831184f,0.022296f,-0.555551f,0.0f,
-			0.830843f,0.021942f,-0.556074f,0.0f,
-			0.830843f,0.021942f,-0.556074f,0.0f,
-			0.830843f,0.021942f,-0.556074f,0.0f,
-			0.142948f,0.989333f,-0.028023f,0.0f,
-			0.142948f,0.989333f,-0.028023f,0.0f,
-			0.142948f,0.989333f,-0.028023f,0.0f,
-			0.973348f,-0.127222f,-0.190809f,0.0f,
-			0.973348f,-0.127222f,-0.190809f,0.0f,
-			0.973348f,-0.127222f,-0.190809f,0.0f,
-			0.973314f,-0.127336f,-0.190908f,0.0f,
-			0.973314f,-0.127336f,-0.190908f,0.0f,
-			0.973314f,-0.127336f,-0.190908f,0.0f,
-			0.747139f,-0.648312f,-0.146546f,0.0f,
-			0.747139f,-0.648312f,-0.146546f,0.0f,
-			0.747139f,-0.648312f,-0.146546f,0.0f,
-			0.746944f,-0.648462f,-0.146876f,0.0f,
-			0.746944f,-0.648462f,-0.146876f,0.0f,
-			0.746944f,-0.648462f,-0.146876f,0.0f,
-			0.980952f,0.022946f,-0.192891f,0.0f,
-			0.980952f,0.022946f,-0.192891f,0.0f,
-			0.980952f,0.022946f,-0.192891f,0.0f,
-			0.980811f,0.022480f,-0.193662f,0.0f,
-			0.980811f,0.022480f,-0.193662f,0.0f,
-			0.980811f,0.022480f,-0.193662f,0.0f,
-			0.327606f,0.942598f,0.064686f,0.0f,
-			0.327606f,0.942598f,0.064686f,0.0f,
-			0.327606f,0.942598f,0.064686f,0.0f,
-			0.327606f,0.942598f,0.064686f,0.0f,
-			0.327606f,0.942598f,0.064686f,0.0f,
-			0.327606f,0.942598f,0.064686f,0.0f,
-			0.162960f,0.986108f,0.032177f,0.0f,
-			0.162960f,0.986108f,0.032177f,0.0f,
-			0.162960f,0.986108f,0.032177f,0.0f,
-			0.162961f,0.986108f,0.032176f,0.0f,
-			0.162961f,0.986108f,0.032176f,0.0f,
-			0.162961f,0.986108f,0.032176f,0.0f,
-			0.180816f,0.982869f,0.035702f,0.0f,
-			0.180816f,0.982869f,0.035702f,0.0f,
-			0.180816f,0.982869f,0.035702f,0.0f,
-			0.180814f,0.982869f,0.035702f,0.0f,
-			0.180814f,0.982869f,0.035702f,0.0f,
-			0.180814f,0.982869f,0.035702f,0.0f,
-			0.523840f,0.845514f,0.103434f,0.0f,
-			0.523840f,0.845514f,0.103434f,0.0f,
-			0.523840f,0.845514f,0.103434f,0.0f,
-			0.523837f,0.845515f,0.103434f,0.0f,
-			0.523837f,0.845515f,0.103434f,0.0f,
-			0.523837f,0.845515f,0.103434f,0.0f,
-			0.276536f,0.943013f,0.185082f,0.0f,
-			0.276536f,0.943013f,0.185082f,0.0f,
-			0.276536f,0.943013f,0.185082f,0.0f,
-			0.276537f,0.943012f,0.185081f,0.0f,
-			0.276537f,0.943012f,0.185081f,0.0f,
-			0.276537f,0.943012f,0.185081f,0.0f,
-			0.137513f,0.986215f,0.092035f,0.0f,
-			0.137513f,0.986215f,0.092035f,0.0f,
-			0.137513f,0.986215f,0.092035f,0.0f,
-			0.137511f,0.986215f,0.092036f,0.0f,
-			0.137511f,0.986215f,0.092036f,0.0f,
-			0.137511f,0.986215f,0.092036f,0.0f,
-			0.152580f,0.983001f,0.102121f,0.0f,
-			0.152580f,0.983001f,0.102121f,0.0f,
-			0.152580f,0.983001f,0.102121f,0.0f,
-			0.152582f,0.983001f,0.102121f,0.0f,
-			0.152582f,0.983001f,0.102121f,0.0f,
-			0.152582f,0.983001f,0.102121f,0.0f,
-			0.442487f,0.846463f,0.296150f,0.0f,
-			0.442487f,0.846463f,0.296150f,0.0f,
-			0.442487f,0.846463f,0.296150f,0.0f,
-			0.442484f,0.846465f,0.296150f,0.0f,
-			0.442484f,0.846465f,0.296150f,0.0f,
-			0.442484f,0.846465f,0.296150f,0.0f,
-			0.185081f,0.943013f,0.276534f,0.0f,
-			0.185081f,0.943013f,0.276534f,0.0f,
-			0.185081f,0.943013f,0.276534f,0.0f,
-			0.185084f,0.943013f,0.276534f,0.0f,
-			0.185084f,0.943013f,0.276534f,0.0f,
-			0.185084f,0.943013f,0.276534f,0.0f,
-			0.092037f,0.986215f,0.137512f,0.0f,
-			0.092037f,0.986215f,0.137512f,0.0f,
-			0.092037f,0.986215f,0.137512f,0.0f,
-			0.092035f,0.986215f,0.137512f,0.0f,
-			0.092035f,0.986215f,0.137512f,0.0f,
-			0.092035f,0.986215f,0.137512f,0.0f,
-			0.102120f,0.983001f,0.152580f,0.0f,
-			0.102120f,0.983001f,0.152580f,0.0f,
-			0.102120f,0.983001f,0.152580f,0.0f,
-			0.102121f,0.983001f,0.152581f,0.0f,
-			0.102121f,0.983001f,0.152581f,0.0f,
-			0.102121f,0.983001f,0.152581f,0.0f,
-			0.296151f,0.846465f,0.442484f,0.0f,
-			0.296151f,0.846465f,0.442484f,0.0f,
-			0.296151f,0.846465f,0.442484f,0.0f,
-			0.296155f,0.846462f,0.442487f,0.0f,
-			0.296155f,0.846462f,0.442487f,0.0f,
-			0.296155f,0.846462f,0.442487f,0.0f,
-			0.064685f,0.942598f,0.327603f,0.0f,
-			0.064685f,0.942598f,0.327603f,0.0f,
-			0.064685f,0.942598f,0.327603f,0.0f,
-			0.064686f,0.942598f,0.327603f,0.0f,
-			0.064686f,0.942598f,0.327603f,0.0f,
-			0.064686f,0.942598f,0.327603f,0.0f,
-			0.032177f,0.986108f,0.162962f,0.0f,
-			0.032177f,0.986108f,0.162962f,0.0f,
-			0.032177f,0.986108f,0.162962f,0.0f,
-			0.032176f,0.986108f,0.162962f,0.0f,
-			0.032176f,0.986108f,0.162962f,0.0f,
-			0.032176f,0.986108f,0.162962f,0.0f,
-			0.035701f,0.982869f,0.180812f,0.0f,
-			0.035701f,0.982869f,0.180812f,0.0f,
-			0.035701f,0.982869f,0.180812f,0.0f,
-			0.035702f,0.982869f,0.180813f,0.0f,
-			0.035702f,0.982869f,0.180813f,0.0f,
-			0.035702f,0.982869f,0.180813f,0.0f,
-			0.103435f,0.845509f,0.523847f,0.0f,
-			0.103435f,0.845509f,0.523847f,0.0f,
-			0.103435f,0.845509f,0.523847f,0.0f,
-			0.103431f,0.845513f,0.523841f,0.0f,
-			0.103431f,0.845513f,0.523841f,0.0f,
-			0.103431f,0.845513f,0.523841f,0.0f,
-			-0.064685f,0.942598f,0.327603f,0.0f,
-			-0.064685f,0.942598f,0.327603f,0.0f,
-			-0.064685f,0.942598f,0.327603f,0.0f,
-			-0.064686f,0.942598f,0.327603f,0.0f,
-			-0.064686f,0.942598f,0.327603f,0.0f,
-			-0.064686f,0.942598f,0.327603f,0.0f,
-			-0.032177f,0.986108f,0.162961f,0.0f,
-			-0.032177f,0.986108f,0.162961f,0.0f,
-			-0.032177f,0.986108f,0.162961f,0.0f,
-			-0.032176f,0.986108f,0.162962f,0.0f,
-			-0.032176f,0.986108f,0.162962f,0.0f,
-			-0.032176f,0.986108f,0.162962f,0.0f,
-			-0.035701f,0.982869f,0.180814f,0.0f,
-			-0.035701f,0.982869f,0.180814f,0.0f,
-			-0.035701f,0.982869f,0.180814f,0.0f,
-			-0.035702f,0.982869f,0.180812f,0.0f,
-			-0.035702f,0.982869f,0.180812f,0.0f,
-			-0.035702f,0.982869f,0.180812f,0.0f,
-			-0.103434f,0.845514f,0.523840f,0.0f,
-			-0.103434f,0.845514f,0.523840f,0.0f,
-			-0.103434f,0.845514f,0.523840f,0.0f,
-			-0.103433f,0.845509f,0.523847f,0.0f,
-			-0.103433f,0.845509f,0.523847f,0.0f,
-			-0.103433f,0.845509f,0.523847f,0.0f,
-			-0.185082f,0.943012f,0.276536f,0.0f,
-			-0.185082f,0.943012f,0.276536f,0.0f,
-			-0.185082f,0.943012f,0.276536f,0.0f,
-			-0.185084f,0.943013f,0.276533f,0.0f,
-			-0.185084f,0.943013f,0.276533f,0.0f,
-			-0.185084f,0.943013f,0.276533f,0.0f,
-			-0.092036f,0.986215f,0.137511f,0.0f,
-			-0.092036f,0.986215f,0.137511f,0.0f,
-			-0.092036f,0.986215f,0.137511f,0.0f,
-			-0.092035f,0.986215f,0.137513f,0.0f,
-			-0.092035f,0.986215f,0.137513f,0.0f,
-			-0.092035f,0.986215f,0.137513f,0.0f,
-			-0.102120f,0.983001f,0.152581f,0.0f,
-			-0.102120f,0.983001f,0.152581f,0.0f,
-			-0.102120f,0.983001f,0.152581f,0.0f,
-			-0.102120f,0.983001f,0.152581f,0.0f,
-			-0.102120f,0.983001f,0.152581f,0.0f,
-			-0.102120f,0.983001f,0.152581f,0.0f,
-			-0.296155f,0.846458f,0.442494f,0.0f,
-			-0.296155f,0.846458f,0.442494f,0.0f,
-			-0.296155f,0.846458f,0.442494f,0.0f,
-			-0.296153f,0.846465f,0.442483f,0.0f,
-			-0.296153f,0.846465f,0.442483f,0.0f,
-			-0.296153f,0.846465f,0.442483f,0.0f,
-			-0.276535f,0.943013f,0.185082f,0.0f,
-			-0.276535f,0.943013f,0.185082f,0.0f,
-			-0.276535f,0.943013f,0.185082f,0.0f,
-			-0.276534f,0.943013f,0.185084f,0.0f,
-			-0.276534f,0.943013f,0.185084f,0.0f,
-			-0.276534f,0.943013f,0.185084f,0.0f,
-			-0.137512f,0.986215f,0.092036f,0.0f,
-			-0.137512f,0.986215f,0.092036f,0.0f,
-			-0.137512f,0.986215f,0.092036f,0.0f,
-			-0.137512f,0.986215f,0.092034f,0.0f,
-			-0.137512f,0.986215f,0.092034f,0.0f,
-			-0.137512f,0.986215f,0.092034f,0.0f,
-			-0.152581f,0.983001f,0.102120f,0.0f,
-			-0.152581f,0.983001f,0.102120f,0.0f,
-			-0.152581f,0.983001f,0.102120f,0.0f,
-			-0.152581f,0.983001f,0.102120f,0.0f,
-			-0.152581f,0.983001f,0.102120f,0.0f,
-			-0.152581f,0.983001f,0.102120f,0.0f,
-			-0.442485f,0.846465f,0.296149f,0.0f,
-			-0.442485f,0.846465f,0.296149f,0.0f,
-			-0.442485f,0.846465f,0.296149f,0.0f,
-			-0.442491f,0.846458f,0.296158f,0.0f,
-			-0.442491f,0.846458f,0.296158f,0.0f,
-			-0.442491f,0.846458f,0.296158f,0.0f,
-			-0.327604f,0.942598f,0.064685f,0.0f,
-			-0.327604f,0.942598f,0.064685f,0.0f,
-			-0.327604f,0.942598f,0.064685f,0.0f,
-			-0.327604f,0.942598f,0.064686f,0.0f,
-			-0.327604f,0.942598f,0.064686f,0.0f,
-			-0.327604f,0.942598f,0.064686f,0.0f,
-			-0.162961f,0.986108f,0.032177f,0.0f,
-			-0.162961f,0.986108f,0.032177f,0.0f,
-			-0.162961f,0.986108f,0.032177f,0.0f,
-			-0.162961f,0.986108f,0.032178f,0.0f,
-			-0.162961f,0.986108f,0.032178f,0.0f,
-			-0.162961f,0.986108f,0.032178f,0.0f,
-			-0.180814f,0.982869f,0.035703f,0.0f,
-			-0.180814f,0.982869f,0.035703f,0.0f,
-			-0.180814f,0.982869f,0.035703f,0.0f,
-			-0.180814f,0.982869f,0.035702f,0.0f,
-			-0.180814f,0.982869f,0.035702f,0.0f,
-			-0.180814f,0.982869f,0.035702f,0.0f,
-			-0.523847f,0.845509f,0.103435f,0.0f,
-			-0.523847f,0.845509f,0.103435f,0.0f,
-			-0.523847f,0.845509f,0.103435f,0.0f,
-			-0.523841f,0.845513f,0.103432f,0.0f,
-			-0.523841f,0.845513f,0.103432f,0.0f,
-			-0.523841f,0.845513f,0.103432f,0.0f,
-			-0.327604f,0.942598f,-0.064686f,0.0f,
-			-0.327604f,0.942598f,-0.064686f,0.0f,
-			-0.327604f,0.942598f,-0.064686f,0.0f,
-			-0.327604f,0.942598f,-0.064686f,0.0f,
-			-0.327604f,0.942598f,-0.064686f,0.0f,
-			-0.327604f,0.942598f,-0.064686f,0.0f,
-			-0.162962f,0.986108f,-0.032177f,0.0f,
-			-0.162962f,0.986108f,-0.032177f,0.0f,
-			-0.162962f,0.986108f,-0.032177f,0.0f,
-			-0.162961f,0.986108f,-0.032178f,0.0f,
-			-0.162961f,0.986108f,-0.032178f,0.0f,
-			-0.162961f,0.986108f,-0.032178f,0.0f,
-			-0.180813f,0.982869f,-0.035703f,0.0f,
-			-0.180813f,0.982869f,-0.035703f,0.0f,
-			-0.180813f,0.982869f,-0.035703f,0.0f,
-			-0.180814f,0.982869f,-0.035702f,0.0f,
-			-0.180814f,0.982869f,-0.035702f,0.0f,
-			-0.180814f,0.982869f,-0.035702f,0.0f,
-			-0.523840f,0.845513f,-0.103434f,0.0f,
-			-0.523840f,0.845513f,-0.103434f,0.0f,
-			-0.523840f,0.845513f,-0.103434f,0.0f,
-			-0.523847f,0.845509f,-0.103433f,0.0f,
-			-0.523847f,0.845509f,-0.103433f,0.0f,
-			-0.523847f,0.845509f,-0.103433f,0.0f,
-			-0.276536f,0.943012f,-0.185082f,0.0f,
-			-0.276536f,0.943012f,-0.185082f,0.0f,
-			-0.276536f,0.943012f,-0.185082f,0.0f,
-			-0.276534f,0.943013f,-0.185084f,0.0f,
-			-0.276534f,0.943013f,-0.185084f,0.0f,
-			-0.276534f,0.943013f,-0.185084f,0.0f,
-			-0.137511f,0.986215f,-0.092036f,0.0f,
-			-0.137511f,0.986215f,-0.092036f,0.0f,
-			-0.137511f,0.986215f,-0.092036f,0.0f,
-			-0.137513f,0.986215f,-0.092035f,0.0f,
-			-0.137513f,0.986215f,-0.092035f,0.0f,
-			-0.137513f,0.986215f,-0.092035f,0.0f,
-			-0.152581f,0.983001f,-0.102120f,0.0f,
-			-0.152581f,0.983001f,-0.102120f,0.0f,
-			-0.152581f,0.983001f,-0.102120f,0.0f,
-			-0.152580f,0.983001f,-0.102121f,0.0f,
-			-0.152580f,0.983001f,-0.102121f,0.0f,
-			-0.152580f,0.983001f,-0.102121f,0.0f,
-			-0.442488f,0.846462f,-0.296154f,0.0f,
-			-0.442488f,0.846462f,-0.296154f,0.0f,
-			-0.442488f,0.846462f,-0.296154f,0.0f,
-			-0.442483f,0.846464f,-0.296153f,0.0f,
-			-0.442483f,0.846464f,-0.296153f,0.0f,
-			-0.442483f,0.846464f,-0.296153f,0.0f,
-			-0.185083f,0.943012f,-0.276537f,0.0f,
-			-0.185083f,0.943012f,-0.276537f,0.0f,
-			-0.185083f,0.943012f,-0.276537f,0.0f,
-			-0.185081f,0.943012f,-0.276537f,0.0f,
-			-0.185081f,0.943012f,-0.276537f,0.0f,
-			-0.185081f,0.943012f,-0.276537f,0.0f,
-			-0.092034f,0.986215f,-0.137512f,0.0f,
-			-0.092034f,0.986215f,-0.137512f,0.0f,
-			-0.092034f,0.986215f,-0.137512f,0.0f,
-			-0.092036f,0.986215f,-0.137512f,0.0f,
-			-0.092036f,0.986215f,-0.137512f,0.0f,
-			-0.092036f,0.986215f,-0.137512f,0.0f,
-			-0.102123f,0.983000f,-0.152582f,0.0f,
-			-0.102123f,0.983000f,-0.152582f,0.0f,
-			-0.102123f,0.983000f,-0.152582f,0.0f,
-			-0.102120f,0.983001f,-0.152581f,0.0f,
-			-0.102120f,0.983001f,-0.152581f,0.0f,
-			-0.102120f,0.983001f,-0.152581f,0.0f,
-			-0.296149f,0.846465f,-0.442485f,0.0f,
-			-0.296149f,0.846465f,-0.442485f,0.0f,
-			-0.296149f,0.846465f,-0.442485f,0.0f,
-			-0.296151f,0.846463f,-0.442486f,0.0f,
-			-0.296151f,0.846463f,-0.442486f,0.0f,
-			-0.296151f,0.846463f,-0.442486f,0.0f,
-			-0.064686f,0.942597f,-0.327606f,0.0f,
-			-0.064686f,0.942597f,-0.327606f,0.0f,
-			-0.064686f,0.942597f,-0.327606f,0.0f,
-			-0.064686f,0.942597f,-0.327606f,0.0f,
-			-0.064686f,0.942597f,-0.327606f,0.0f,
-			-0.064686f,0.942597f,-0.327606f,0.0f,
-			-0.032177f,0.986108f,-0.162961f,0.0f,
-			-0.032177f,0.986108f,-0.162961f,0.0f,
-			-0.032177f,0.986108f,-0.162961f,0.0f,
-			-0.032176f,0.986108f,-0.162960f,0.0f,
-			-0.032176f,0.986108f,-0.162960f,0.0f,
-			-0.032176f,0.986108f,-0.162960f,0.0f,
-			-0.035701f,0.982869f,-0.180814f,0.0f,
-			-0.035701f,0.982869f,-0.180814f,0.0f,
-			-0.035701f,0.982869f,-0.180814f,0.0f,
-			-0.035703f,0.982869f,-0.180815f,0.0f,
-			-0.035703f,0.982869f,-0.180815f,0.0f,
-			-0.035703f,0.982869f,-0.180815f,0.0f,
-			-0.103434f,0.845515f,-0.523838f,0.0f,
-			-0.103434f,0.845515f,-0.523838f,0.0f,
-			-0.103434f,0.845515f,-0.523838f,0.0f,
-			-0.103435f,0.845514f,-0.523839f,0.0f,
-			-0.103435f,0.845514f,-0.523839f,0.0f,
-			-0.103435f,0.845514f,-0.523839f,0.0f,
-			0.064686f,0.942597f,-0.327606f,0.0f,
-			0.064686f,0.942597f,-0.327606f,0.0f,
-			0.064686f,0.942597f,-0.327606f,0.0f,
-			0.064686f,0.942597f,-0.327606f,0.0f,
-			0.064686f,0.942597f,-0.327606f,0.0f,
-			0.064686f,0.942597f,-0.327606f,0.0f,
-			0.032177f,0.986108f,-0.162960f,0.0f,
-			0.032177f,0.986108f,-0.162960f,0.0f,
-			0.032177f,0.986108f,-0.162960f,0.0f,
-			0.032176f,0.986108f,-0.162961f,0.0f,
-			0.032176f,0.986108f,-0.162961f,0.0f,
-			0.032176f,0.986108f,-0.162961f,0.0f,
-			0.035702f,0.982869f,-0.180816f,0.0f,
-			0.035702f,0.982869f,-0.180816f,0.0f,
-			0.035702f,0.982869f,-0.180816f,0.0f,
-			0.035702f,0.982869f,-0.180814f,0.0f,
-			0.035702f,0.982869f,-0.180814f,0.0f,
-			0.035702f,0.982869f,-0.180814f,0.0f,
-			0.103434f,0.845514f,-0.523840f,0.0f,
-			0.103434f,0.845514f,-0.523840f,0.0f,
-			0.103434f,0.845514f,-0.523840f,0.0f,
-			0.103434f,0.845515f,-0.523837f,0.0f,
-			0.103434f,0.845515f,-0.523837f,0.0f,
-			0.103434f,0.845515f,-0.523837f,0.0f,
-			0.185082f,0.943013f,-0.276536f,0.0f,
-			0.185082f,0.943013f,-0.276536f,0.0f,
-			0.185082f,0.943013f,-0.276536f,0.0f,
-			0.185081f,0.943012f,-0.276537f,0.0f,
-			0.185081f,0.943012f,-0.276537f,0.0f,
-			0.185081f,0.943012f,-0.276537f,0.0f,
-			0.092035f,0.986215f,-0.137513f,0.0f,
-			0.092035f,0.986215f,-0.137513f,0.0f,
-			0.092035f,0.986215f,-0.137513f,0.0f,
-			0.092036f,0.986215f,-0.137511f,0.0f,
-			0.092036f,0.986215f,-0.137511f,0.0f,
-			0.092036f,0.986215f,-0.137511f,0.0f,
-			0.102122f,0.983001f,-0.152580f,0.0f,
-			0.102122f,0.983001f,-0.152580f,0.0f,
-			0.102122f,0.983001f,-0.152580f,0.0f,
-			0.102121f,0.983001f,-0.152581f,0.0f,
-			0.102121f,0.983001f,-0.152581f,0.0f,
-			0.102121f,0.983001f,-0.152581f,0.0f,
-			0.296149f,0.846467f,-0.442481f,0.0f,
-			0.296149f,0.846467f,-0.442481f,0.0f,
-			0.296149f,0.846467f,-0.442481f,0.0f,
-			0.296150f,0.846465f,-0.442484f,0.0f,
-			0.296150f,0.846465f,-0.442484f,0.0f,
-			0.296150f,0.846465f,-0.442484f,0.0f,
-			0.276536f,0.943012f,-0.185083f,0.0f,
-			0.276536f,0.943012f,-0.185083f,0.0f,
-			0.276536f,0.943012f,-0.185083f,0.0f,
-			0.276536f,0.943012f,-0.185081f,0.0f,
-			0.276536f,0.943012f,-0.185081f,0.0f,
-			0.276536f,0.943012f,-0.185081f,0.0f,
-			0.137512f,0.986215f,-0.092034f,0.0f,
-			0.137512f,0.986215f,-0.092034f,0.0f,
-			0.137512f,0.986215f,-0.092034f,0.0f,
-			0.137512f,0.986215f,-0.092037f,0.0f,
-			0.137512f,0.986215f,-0.092037f,0.0f,
-			0.137512f,0.986215f,-0.092037f,0.0f,
-			0.152581f,0.983001f,-0.102122f,0.0f,
-			0.152581f,0.983001f,-0.102122f,0.0f,
-			0.152581f,0.983001f,-0.102122f,0.0f,
-			0.152581f,0.983001f,-0.102121f,0.0f,
-			0.152581f,0.983001f,-0.102121f,0.0f,
-			0.152581f,0.983001f,-0.102121f,0.0f,
-			0.442484f,0.846465f,-0.296151f,0.0f,
-			0.442484f,0.846465f,-0.296151f,0.0f,
-			0.442484f,0.846465f,-0.296151f,0.0f,
-			0.442482f,0.846467f,-0.296148f,0.0f,
-			0.442482f,0.846467f,-0.296148f,0.0f,
-			0.442482f,0.846467f,-0.296148f,0.0f,
-			0.327606f,0.942598f,-0.064686f,0.0f,
-			0.327606f,0.942598f,-0.064686f,0.0f,
-			0.327606f,0.942598f,-0.064686f,0.0f,
-			0.327606f,0.942598f,-0.064686f,0.0f,
-			0.327606f,0.942598f,-0.064686f,0.0f,
-			0.327606f,0.942598f,-0.064686f,0.0f,
-			0.162961f,0.986108f,-0.032177f,0.0f,
-			0.162961f,0.986108f,-0.032177f,0.0f,
-			0.162961f,0.986108f,-0.032177f,0.0f,
-			0.162960f,0.986108f,-0.032176f,0.0f,
-			0.162960f,0.986108f,-0.032176f,0.0f,
-			0.162960f,0.986108f,-0.032176f,0.0f,
-			0.180814f,0.982869f,-0.035701f,0.0f,
-			0.180814f,0.982869f,-0.035701f,0.0f,
-			0.180814f,0.982869f,-0.035701f,0.0f,
-			0.180815f,0.982869f,-0.035703f,0.0f,
-			0.180815f,0.982869f,-0.035703f,0.0f,
-			0.180815f,0.982869f,-0.035703f,0.0f,
-			0.523838f,0.845515f,-0.103433f,0.0f,
-			0.523838f,0.845515f,-0.103433f,0.0f,
-			0.523838f,0.845515f,-0.103433f,0.0f,
-			0.523840f,0.845514f,-0.103435f,0.0f,
-			0.523840f,0.845514f,-0.103435f,0.0f,
-			0.523840f,0.845514f,-0.103435f,0.0f,
-		};
-		float vertexNormals[]={
-			-0.852658f,-0.251842f,-0.421324f,0.0f,
-			-0.949595f,-0.251225f,-0.062499f,0.0f,
-			-0.777107f,0.209866f,-0.313504f,0.0f,
-			-0.949595f,-0.251225f,-0.062499f,0.0f,
-			-0.838803f,0.209550f,0.007290f,0.0f,
-			-0.777107f,0.209866f,-0.313504f,0.0f,
-			-0.135113f,0.774846f,-0.012804f,0.0f,
-			-0.777107f,0.209866f,-0.313504f,0.0f,
-			-0.838803f,0.209550f,0.007290f,0.0f,
-			-0.838803f,0.209550f,0.007290f,0.0f,
-			-0.129535f,0.774344f,0.039390f,0.0f,
-			-0.135113f,0.774846f,-0.012804f,0.0f,
-			0.587194f,0.719498f,0.255297f,0.0f,
-			-0.135113f,0.774846f,-0.012804f,0.0f,
-			-0.129535f,0.774344f,0.039390f,0.0f,
-			-0.129535f,0.774344f,0.039390f,0.0f,
-			0.641083f,0.718861f,0.011330f,0.0f,
-			0.587194f,0.719498f,0.255297f,0.0f,
-			0.785964f,0.488890f,0.328015f,0.0f,
-			0.587194f,0.719498f,0.255297f,0.0f,
-			0.641083f,0.718861f,0.011330f,0.0f,
-			0.641083f,0.718861f,0.011330f,0.0f,
-			0.852454f,0.488185f,0.002582f,0.0f,
-			0.785964f,0.488890f,0.328015f,0.0f,
-			-0.597714f,0.209807f,-0.587322f,0.0f,
-			-0.626889f,-0.252139f,-0.715542f,0.0f,
-			-0.852658f,-0.251842f,-0.421324f,0.0f,
-			-0.852658f,-0.251842f,-0.421324f,0.0f,
-			-0.777107f,0.209866f,-0.313504f,0.0f,
-			-0.597714f,0.209807f,-0.587322f,0.0f,
-			-0.119520f,0.775453f,-0.063761f,0.0f,
-			-0.597714f,0.209807f,-0.587322f,0.0f,
-			-0.777107f,0.209866f,-0.313504f,0.0f,
-			-0.777107f,0.209866f,-0.313504f,0.0f,
-			-0.135113f,0.774846f,-0.012804f,0.0f,
-			-0.119520f,0.775453f,-0.063761f,0.0f,
-			0.444346f,0.720016f,0.460442f,0.0f,
-			-0.119520f,0.775453f,-0.063761f,0.0f,
-			-0.135113f,0.774846f,-0.012804f,0.0f,
-			-0.135113f,0.774846f,-0.012804f,0.0f,
-			0.587194f,0.719498f,0.255297f,0.0f,
-			0.444346f,0.720016f,0.460442f,0.0f,
-			0.600288f,0.489622f,0.603971f,0.0f,
-			0.444346f,0.720016f,0.460442f,0.0f,
-			0.587194f,0.719498f,0.255297f,0.0f,
-			0.587194f,0.719498f,0.255297f,0.0f,
-			0.785964f,0.488890f,0.328015f,0.0f,
-			0.600288f,0.489622f,0.603971f,0.0f,
-			-0.327252f,0.209469f,-0.771613f,0.0f,
-			-0.304414f,-0.251539f,-0.901124f,0.0f,
-			-0.626889f,-0.252139f,-0.715542f,0.0f,
-			-0.626889f,-0.252139f,-0.715542f,0.0f,
-			-0.597714f,0.209807f,-0.587322f,0.0f,
-			-0.327252f,0.209469f,-0.771613f,0.0f,
-			-0.086261f,0.774945f,-0.104229f,0.0f,
-			-0.327252f,0.209469f,-0.771613f,0.0f,
-			-0.597714f,0.209807f,-0.587322f,0.0f,
-			-0.597714f,0.209807f,-0.587322f,0.0f,
-			-0.119520f,0.775453f,-0.063761f,0.0f,
-			-0.086261f,0.774945f,-0.104229f,0.0f,
-			0.234055f,0.719380f,0.595907f,0.0f,
-			-0.086261f,0.774945f,-0.104229f,0.0f,
-			-0.119520f,0.775453f,-0.063761f,0.0f,
-			-0.119520f,0.775453f,-0.063761f,0.0f,
-			0.444346f,0.720016f,0.460442f,0.0f,
-			0.234055f,0.719380f,0.595907f,0.0f,
-			0.323145f,0.488916f,0.787909f,0.0f,
-			0.234055f,0.719380f,0.595907f,0.0f,
-			0.444346f,0.720016f,0.460442f,0.0f,
-			0.444346f,0.720016f,0.460442f,0.0f,
-			0.600288f,0.489622f,0.603971f,0.0f,
-			0.323145f,0.488916f,0.787909f,0.0f,
-			-0.007994f,0.203155f,-0.844485f,0.0f,
-			0.056045f,-0.267094f,-0.946215f,0.0f,
-			-0.304414f,-0.251539f,-0.901124f,0.0f,
-			-0.304414f,-0.251539f,-0.901124f,0.0f,
-			-0.327252f,0.209469f,-0.771613f,0.0f,
-			-0.007994f,0.203155f,-0.844485f,0.0f,
-			-0.039664f,0.773731f,-0.128450f,0.0f,
-			-0.007994f,0.203155f,-0.844485f,0.0f,
-			-0.327252f,0.209469f,-0.771613f,0.0f,
-			-0.327252f,0.209469f,-0.771613f,0.0f,
-			-0.086261f,0.774945f,-0.104229f,0.0f,
-			-0.039664f,0.773731f,-0.128450f,0.0f,
-			-0.011307f,0.718713f,0.641188f,0.0f,
-			-0.039664f,0.773731f,-0.128450f,0.0f,
-			-0.086261f,0.774945f,-0.104229f,0.0f,
-			-0.086261f,0.774945f,-0.104229f,0.0f,
-			0.234055f,0.719380f,0.595907f,0.0f,
-			-0.011307f,0.718713f,0.641188f,0.0f,
-			-0.002582f,0.488185f,0.852454f,0.0f,
-			-0.011307f,0.718713f,0.641188f,0.0f,
-			0.234055f,0.719380f,0.595907f,0.0f,
-			0.234055f,0.719380f,0.595907f,0.0f,
-			0.323145f,0.488916f,0.787909f,0.0f,
-			-0.002582f,0.488185f,0.852454f,0.0f,
-			0.323714f,0.133036f,-0.799312f,0.0f,
-			0.401561f,-0.356364f,-0.823002f,0.0f,
-			0.056045f,-0.267094f,-0.946215f,0.0f,
-			0.056045f,-0.267094f,-0.946215f,0.0f,
-			-0.007994f,0.203155f,-0.844485f,0.0f,
-			0.323714f,0.133036f,-0.799312f,0.0f,
-			0.018514f,0.743544f,-0.147874f,0.0f,
-			0.323714f,0.133036f,-0.799312f,0.0f,
-			-0.007994f,0.203155f,-0.844485f,0.0f,
-			-0.007994f,0.203155f,-0.844485f,0.0f,
-			-0.039664f,0.773731f,-0.128450f,0.0f,
-			0.018514f,0.743544f,-0.147874f,0.0f,
-			-0.257472f,0.716136f,0.591550f,0.0f,
-			0.018514f,0.743544f,-0.147874f,0.0f,
-			-0.039664f,0.773731f,-0.128450f,0.0f,
-			-0.039664f,0.773731f,-0.128450f,0.0f,
-			-0.011307f,0.718713f,0.641188f,0.0f,
-			-0.257472f,0.716136f,0.591550f,0.0f,
-			-0.328165f,0.488318f,0.786307f,0.0f,
-			-0.257472f,0.716136f,0.591550f,0.0f,
-			-0.011307f,0.718713f,0.641188f,0.0f,
-			-0.011307f,0.718713f,0.641188f,0.0f,
-			-0.002582f,0.488185f,0.852454f,0.0f,
-			-0.328165f,0.488318f,0.786307f,0.0f,
-			0.605740f,0.077763f,-0.602885f,0.0f,
-			0.692169f,-0.379784f,-0.585494f,0.0f,
-			0.401561f,-0.356364f,-0.823002f,0.0f,
-			0.401561f,-0.356364f,-0.823002f,0.0f,
-			0.323714f,0.133036f,-0.799312f,0.0f,
-			0.605740f,0.077763f,-0.602885f,0.0f,
-			0.092538f,0.701598f,-0.150890f,0.0f,
-			0.605740f,0.077763f,-0.602885f,0.0f,
-			0.323714f,0.133036f,-0.799312f,0.0f,
-			0.323714f,0.133036f,-0.799312f,0.0f,
-			0.018514f,0.743544f,-0.147874f,0.0f,
-			0.092538f,0.701598f,-0.150890f,0.0f,
-			-0.468118f,0.713050f,0.452196f,0.0f,
-			0.092538f,0.701598f,-0.150890f,0.0f,
-			0.018514f,0.743544f,-0.147874f,0.0f,
-			0.018514f,0.743544f,-0.147874f,0.0f,
-			-0.257472f,0.716136f,0.591550f,0.0f,
-			-0.468118f,0.713050f,0.452196f,0.0f,
-			-0.604592f,0.488259f,0.600944f,0.0f,
-			-0.468118f,0.713050f,0.452196f,0.0f,
-			-0.257472f,0.716136f,0.591550f,0.0f,
-			-0.257472f,0.716136f,0.591550f,0.0f,
-			-0.328165f,0.488318f,0.786307f,0.0f,
-			-0.604592f,0.488259f,0.600944f,0.0f,
-			0.776350f,0.131871f,-0.313584f,0.0f,
-			0.893848f,-0.305049f,-0.279651f,0.0f,
-			0.692169f,-0.379784f,-0.585494f,0.0f,
-			0.692169f,-0.379784f,-0.585494f,0.0f,
-			0.605740f,0.077763f,-0.602885f,0.0f,
-			0.776350f,0.131871f,-0.313584f,0.0f,
-			0.136071f,0.722458f,-0.101360f,0.0f,
-			0.776350f,0.131871f,-0.313584f,0.0f,
-			0.605740f,0.077763f,-0.602885f,0.0f,
-			0.605740f,0.077763f,-0.602885f,0.0f,
-			0.092538f,0.701598f,-0.150890f,0.0f,
-			0.136071f,0.722458f,-0.101360f,0.0f,
-			-0.603177f,0.714606f,0.237357f,0.0f,
-			0.136071f,0.722458f,-0.101360f,0.0f,
-			0.092538f,0.701598f,-0.150890f,0.0f,
-			0.092538f,0.701598f,-0.150890f,0.0f,
-			-0.468118f,0.713050f,0.452196f,0.0f,
-			-0.603177f,0.714606f,0.237357f,0.0f,
-			-0.788544f,0.487896f,0.323408f,0.0f,
-			-0.603177f,0.714606f,0.237357f,0.0f,
-			-0.468118f,0.713050f,0.452196f,0.0f,
-			-0.468118f,0.713050f,0.452196f,0.0f,
-			-0.604592f,0.488259f,0.600944f,0.0f,
-			-0.788544f,0.487896f,0.323408f,0.0f,
-			0.835592f,0.195394f,-0.000278f,0.0f,
-			0.950828f,-0.251537f,0.069577f,0.0f,
-			0.893848f,-0.305049f,-0.279651f,0.0f,
-			0.893848f,-0.305049f,-0.279651f,0.0f,
-			0.776350f,0.131871f,-0.313584f,0.0f,
-			0.835592f,0.195394f,-0.000278f,0.0f,
-			0.139024f,0.762981f,-0.039914f,0.0f,
-			0.835592f,0.195394f,-0.000278f,0.0f,
-			0.776350f,0.131871f,-0.313584f,0.0f,
-			0.776350f,0.131871f,-0.313584f,0.0f,
-			0.136071f,0.722458f,-0.101360f,0.0f,
-			0.139024f,0.762981f,-0.039914f,0.0f,
-			-0.642953f,0.717843f,-0.011260f,0.0f,
-			0.139024f,0.762981f,-0.039914f,0.0f,
-			0.136071f,0.722458f,-0.101360f,0.0f,
-			0.136071f,0.722458f,-0.101360f,0.0f,
-			-0.603177f,0.714606f,0.237357f,0.0f,
-			-0.642953f,0.717843f,-0.011260f,0.0f,
-			-0.852627f,0.487938f,-0.002596f,0.0f,
-			-0.642953f,0.717843f,-0.011260f,0.0f,
-			-0.603177f,0.714606f,0.237357f,0.0f,
-			-0.603177f,0.714606f,0.237357f,0.0f,
-			-0.788544f,0.487896f,0.323408f,0.0f,
-			-0.852627f,0.487938f,-0.002596f,0.0f,
-			0.777111f,0.209875f,0.313509f,0.0f,
-			0.852664f,-0.251814f,0.421330f,0.0f,
-			0.950828f,-0.251537f,0.069577f,0.0f,
-			0.950828f,-0.251537f,0.069577f,0.0f,
-			0.835592f,0.195394f,-0.000278f,0.0f,
-			0.777111f,0.209875f,0.313509f,0.0f,
-			0.135120f,0.774834f,0.012805f,0.0f,
-			0.777111f,0.209875f,0.313509f,0.0f,
-			0.835592f,0.195394f,-0.000278f,0.0f,
-			0.835592f,0.195394f,-0.000278f,0.0f,
-			0.139024f,0.762981f,-0.039914f,0.0f,
-			0.135120f,0.774834f,0.012805f,0.0f,
-			-0.587193f,0.719502f,-0.255296f,0.0f,
-			0.135120f,0.774834f,0.012805f,0.0f,
-			0.139024f,0.762981f,-0.039914f,0.0f,
-			0.139024f,0.762981f,-0.039914f,0.0f,
-			-0.642953f,0.717843f,-0.011260f,0.0f,
-			-0.587193f,0.719502f,-0.255296f,0.0f,
-			-0.785964f,0.488892f,-0.328011f,0.0f,
-			-0.587193f,0.719502f,-0.255296f,0.0f,
-			-0.642953f,0.717843f,-0.011260f,0.0f,
-			-0.642953f,0.717843f,-0.011260f,0.0f,
-			-0.852627f,0.487938f,-0.002596f,0.0f,
-			-0.785964f,0.488892f,-0.328011f,0.0f,
-			0.597715f,0.209813f,0.587322f,0.0f,
-			0.626890f,-0.252140f,0.715541f,0.0f,
-			0.852664f,-0.251814f,0.421330f,0.0f,
-			0.852664f,-0.251814f,0.421330f,0.0f,
-			0.777111f,0.209875f,0.313509f,0.0f,
-			0.597715f,0.209813f,0.587322f,0.0f,
-			0.119522f,0.775455f,0.063763f,0.0f,
-			0.597715f,0.209813f,0.587322f,0.0f,
-			0.777111f,0.209875f,0.313509f,0.0f,
-			0.777111f,0.209875f,0.313509f,0.0f,
-			0.135120f,0.774834f,0.012805f,0.0f,
-			0.119522f,0.775455f,0.063763f,0.0f,
-			-0.444346f,0.720019f,-0.460442f,0.0f,
-			0.119522f,0.775455f,0.063763f,0.0f,
-			0.135120f,0.774834f,0.012805f,0.0f,
-			0.135120f,0.774834f,0.012805f,0.0f,
-			-0.587193f,0.719502f,-0.255296f,0.0f,
-			-0.444346f,0.720019f,-0.460442f,0.0f,
-			-0.600283f,0.489632f,-0.603967f,0.0f,
-			-0.444346f,0.720019f,-0.460442f,0.0f,
-			-0.587193f,0.719502f,-0.255296f,0.0f,
-			-0.587193f,0.719502f,-0.255296f,0.0f,
-			-0.785964f,0.488892f,-0.328011f,0.0f,
-			-0.600283f,0.489632f,-0.603967f,0.0f,
-			0.327249f,0.209478f,0.771604f,0.0f,
-			0.304411f,-0.251538f,0.901125f,0.0f,
-			0.626890f,-0.252140f,0.715541f,0.0f,
-			0.626890f,-0.252140f,0.715541f,0.0f,
-			0.597715f,0.209813f,0.587322f,0.0f,
-			0.327249f,0.209478f,0.771604f,0.0f,
-			0.086261f,0.774950f,0.104229f,0.0f,
-			0.327249f,0.209478f,0.771604f,0.0f,
-			0.597715f,0.209813f,0.587322f,0.0f,
-			0.597715f,0.209813f,0.587322f,0.0f,
-			0.119522f,0.775455f,0.063763f,0.0f,
-			0.086261f,0.774950f,0.104229f,0.0f,
-			-0.234056f,0.719378f,-0.595907f,0.0f,
-			0.086261f,0.774950f,0.104229f,0.0f,
-			0.119522f,0.775455f,0.063763f,0.0f,
-			0.119522f,0.775455f,0.063763f,0.0f,
-			-0.444346f,0.720019f,-0.460442f,0.0f,
-			-0.234056f,0.719378f,-0.595907f,0.0f,
-			-0.323144f,0.488917f,-0.787909f,0.0f,
-			-0.234056f,0.719378f,-0.595907f,0.0f,
-			-0.444346f,0.720019f,-0.460442f,0.0f,
-			-0.444346f,0.720019f,-0.460442f,0.0f,
-			-0.600283f,0.489632f,-0.603967f,0.0f,
-			-0.323144f,0.488917f,-0.787909f,0.0f,
-			0.007290f,0.209550f,0.838803f,0.0f,
-			-0.062499f,-0.251225f,0.949595f,0.0f,
-			0.304411f,-0.251538f,0.901125f,0.0f,
-			0.304411f,-0.251538f,0.901125f,0.0f,
-			0.327249f,0.209478f,0.771604f,0.0f,
-			0.007290f,0.209550f,0.838803f,0.0f,
-			0.039391f,0.774343f,0.129534f,0.0f,
-			0.007290f,0.209550f,0.838803f,0.0f,
-			0.327249f,0.209478f,0.771604f,0.0f,
-			0.327249f,0.209478f,0.771604f,0.0f,
-			0.086261f,0.774950f,0.104229f,0.0f,
-			0.039391f,0.774343f,0.129534f,0.0f,
-			0.011330f,0.718863f,-0.641081f,0.0f,
-			0.039391f,0.774343f,0.129534f,0.0f,
-			0.086261f,0.774950f,0.104229f,0.0f,
-			0.086261f,0.774950f,0.104229f,0.0f,
-			-0.234056f,0.719378f,-0.595907f,0.0f,
-			0.011330f,0.718863f,-0.641081f,0.0f,
-			0.002582f,0.488184f,-0.852455f,0.0f,
-			0.011330f,0.718863f,-0.641081f,0.0f,
-			-0.234056f,0.719378f,-0.595907f,0.0f,
-			-0.234056f,0.719378f,-0.595907f,0.0f,
-			-0.323144f,0.488917f,-0.787909f,0.0f,
-			0.002582f,0.488184f,-0.852455f,0.0f,
-			-0.313502f,0.209872f,0.777102f,0.0f,
-			-0.421324f,-0.251850f,0.852656f,0.0f,
-			-0.062499f,-0.251225f,0.949595f,0.0f,
-			-0.062499f,-0.251225f,0.949595f,0.0f,
-			0.007290f,0.209550f,0.838803f,0.0f,
-			-0.313502f,0.209872f,0.777102f,0.0f,
-			-0.012801f,0.774842f,0.135108f,0.0f,
-			-0.313502f,0.209872f,0.777102f,0.0f,
-			0.007290f,0.209550f,0.838803f,0.0f,
-			0.007290f,0.209550f,0.838803f,0.0f,
-			0.039391f,0.774343f,0.129534f,0.0f,
-			-0.012801f,0.774842f,0.135108f,0.0f,
-			0.255297f,0.719502f,-0.587193f,0.0f,
-			-0.012801f,0.774842f,0.135108f,0.0f,
-			0.039391f,0.774343f,0.129534f,0.0f,
-			0.039391f,0.774343f,0.129534f,0.0f,
-			0.011330f,0.718863f,-0.641081f,0.0f,
-			0.255297f,0.719502f,-0.587193f,0.0f,
-			0.328013f,0.488893f,-0.785963f,0.0f,
-			0.255297f,0.719502f,-0.587193f,0.0f,
-			0.011330f,0.718863f,-0.641081f,0.0f,
-			0.011330f,0.718863f,-0.641081f,0.0f,
-			0.002582f,0.488184f,-0.852455f,0.0f,
-			0.328013f,0.488893f,-0.785963f,0.0f,
-			-0.587311f,0.209810f,0.597704f,0.0f,
-			-0.715537f,-0.252160f,0.626887f,0.0f,
-			-0.421324f,-0.251850f,0.852656f,0.0f,
-			-0.421324f,-0.251850f,0.852656f,0.0f,
-			-0.313502f,0.209872f,0.777102f,0.0f,
-			-0.587311f,0.209810f,0.597704f,0.0f,
-			-0.063748f,0.775463f,0.119507f,0.0f,
-			-0.587311f,0.209810f,0.597704f,0.0f,
-			-0.313502f,0.209872f,0.777102f,0.0f,
-			-0.313502f,0.209872f,0.777102f,0.0f,
-			-0.012801f,0.774842f,0.135108f,0.0f,
-			-0.063748f,0.775463f,0.119507f,0.0f,
-			0.460445f,0.720018f,-0.444351f,0.0f,
-			-0.063748f,0.775463f,0.119507f,0.0f,
-			-0.012801f,0.774842f,0.135108f,0.0f,
-			-0.012801f,0.774842f,0.135108f,0.0f,
-			0.255297f,0.719502f,-0.587193f,0.0f,
-			0.460445f,0.720018f,-0.444351f,0.0f,
-			0.603966f,0.489631f,-0.600284f,0.0f,
-			0.460445f,0.720018f,-0.444351f,0.0f,
-			0.255297f,0.719502f,-0.587193f,0.0f,
-			0.255297f,0.719502f,-0.587193f,0.0f,
-			0.328013f,0.488893f,-0.785963f,0.0f,
-			0.603966f,0.489631f,-0.600284f,0.0f,
-			-0.771602f,0.209473f,0.327249f,0.0f,
-			-0.901125f,-0.251538f,0.304410f,0.0f,
-			-0.715537f,-0.252160f,0.626887f,0.0f,
-			-0.715537f,-0.252160f,0.626887f,0.0f,
-			-0.587311f,0.209810f,0.597704f,0.0f,
-			-0.771602f,0.209473f,0.327249f,0.0f,
-			-0.104222f,0.774953f,0.086257f,0.0f,
-			-0.771602f,0.209473f,0.327249f,0.0f,
-			-0.587311f,0.209810f,0.597704f,0.0f,
-			-0.587311f,0.209810f,0.597704f,0.0f,
-			-0.063748f,0.775463f,0.119507f,0.0f,
-			-0.104222f,0.774953f,0.086257f,0.0f,
-			0.595910f,0.719378f,-0.234058f,0.0f,
-			-0.104222f,0.774953f,0.086257f,0.0f,
-			-0.063748f,0.775463f,0.119507f,0.0f,
-			-0.063748f,0.775463f,0.119507f,0.0f,
-			0.460445f,0.720018f,-0.444351f,0.0f,
-			0.595910f,0.719378f,-0.234058f,0.0f,
-			0.787906f,0.488921f,-0.323144f,0.0f,
-			0.595910f,0.719378f,-0.234058f,0.0f,
-			0.460445f,0.720018f,-0.444351f,0.0f,
-			0.460445f,0.720018f,-0.444351f,0.0f,
-			0.603966f,0.489631f,-0.600284f,0.0f,
-			0.787906f,0.488921f,-0.323144f,0.0f,
-			-0.838803f,0.209550f,0.007290f,0.0f,
-			-0.949595f,-0.251225f,-0.062499f,0.0f,
-			-0.901125f,-0.251538f,0.304410f,0.0f,
-			-0.901125f,-0.251538f,0.304410f,0.0f,
-			-0.771602f,0.209473f,0.327249f,0.0f,
-			-0.838803f,0.209550f,0.007290f,0.0f,
-			-0.129535f,0.774344f,0.039390f,0.0f,
-			-0.838803f,0.209550f,0.007290f,0.0f,
-			-0.771602f,0.209473f,0.327249f,0.0f,
-			-0.771602f,0.209473f,0.327249f,0.0f,
-			-0.104222f,0.774953f,0.086257f,0.0f,
-			-0.129535f,0.774344f,0.039390f,0.0f,
-			0.641083f,0.718861f,0.011330f,0.0f,
-			-0.129535f,0.774344f,0.039390f,0.0f,
-			-0.104222f,0.774953f,0.086257f,0.0f,
-			-0.104222f,0.774953f,0.086257f,0.0f,
-			0.595910f,0.719378f,-0.234058f,0.0f,
-			0.641083f,0.718861f,0.011330f,0.0f,
-			0.852454f,0.488185f,0.002582f,0.0f,
-			0.641083f,0.718861f,0.011330f,0.0f,
-			0.595910f,0.719378f,-0.234058f,0.0f,
-			0.595910f,0.719378f,-0.234058f,0.0f,
-			0.787906f,0.488921f,-0.323144f,0.0f,
-			0.852454f,0.488185f,0.002582f,0.0f,
-			0.830834f,0.397857f,0.344382f,0.0f,
-			0.785964f,0.488890f,0.328015f,0.0f,
-			0.852454f,0.488185f,0.002582f,0.0f,
-			0.852454f,0.488185f,0.002582f,0.0f,
-			0.900099f,0.397201f,0.000553f,0.0f,
-			0.830834f,0.397857f,0.344382f,0.0f,
-			0.852985f,0.332566f,0.354091f,0.0f,
-			0.830834f,0.397857f,0.344382f,0.0f,
-			0.900099f,0.397201f,0.000553f,0.0f,
-			0.900099f,0.397201f,0.000553f,0.0f,
-			0.924205f,0.332006f,0.001033f,0.0f,
-			0.852985f,0.332566f,0.354091f,0.0f,
-			0.883307f,0.203359f,0.366765f,0.0f,
-			0.852985f,0.332566f,0.354091f,0.0f,
-			0.924205f,0.332006f,0.001033f,0.0f,
-			0.924205f,0.332006f,0.001033f,0.0f,
-			0.956967f,0.203031f,0.001124f,0.0f,
-			0.883307f,0.203359f,0.366765f,0.0f,
-			0.888622f,-0.065652f,0.366857f,0.0f,
-			0.883307f,0.203359f,0.366765f,0.0f,
-			0.956967f,0.203031f,0.001124f,0.0f,
-			0.956967f,0.203031f,0.001124f,0.0f,
-			0.961933f,-0.065422f,-0.000797f,0.0f,
-			0.888622f,-0.065652f,0.366857f,0.0f,
-			0.635591f,0.398526f,0.636383f,0.0f,
-			0.600288f,0.489622f,0.603971f,0.0f,
-			0.785964f,0.488890f,0.328015f,0.0f,
-			0.785964f,0.488890f,0.328015f,0.0f,
-			0.830834f,0.397857f,0.344382f,0.0f,
-			0.635591f,0.398526f,0.636383f,0.0f,
-			0.652401f,0.333168f,0.653877f,0.0f,
-			0.635591f,0.398526f,0.636383f,0.0f,
-			0.830834f,0.397857f,0.344382f,0.0f,
-			0.830834f,0.397857f,0.344382f,0.0f,
-			0.852985f,0.332566f,0.354091f,0.0f,
-			0.652401f,0.333168f,0.653877f,0.0f,
-			0.675662f,0.203787f,0.677268f,0.0f,
-			0.652401f,0.333168f,0.653877f,0.0f,
-			0.852985f,0.332566f,0.354091f,0.0f,
-			0.852985f,0.332566f,0.354091f,0.0f,
-			0.883307f,0.203359f,0.366765f,0.0f,
-			0.675662f,0.203787f,0.677268f,0.0f,
-			0.680571f,-0.065654f,0.679431f,0.0f,
-			0.675662f,0.203787f,0.677268f,0.0f,
-			0.883307f,0.203359f,0.366765f,0.0f,
-			0.883307f,0.203359f,0.366765f,0.0f,
-			0.888622f,-0.065652f,0.366857f,0.0f,
-			0.680571f,-0.065654f,0.679431f,0.0f,
-			0.343335f,0.397870f,0.831249f,0.0f,
-			0.323145f,0.488916f,0.787909f,0.0f,
-			0.600288f,0.489622f,0.603971f,0.0f,
-			0.600288f,0.489622f,0.603971f,0.0f,
-			0.635591f,0.398526f,0.636383f,0.0f,
-			0.343335f,0.397870f,0.831249f,0.0f,
-			0.352138f,0.332607f,0.853755f,0.0f,
-			0.343335f,0.397870f,0.831249f,0.0f,
-			0.635591f,0.398526f,0.636383f,0.0f,
-			0.635591f,0.398526f,0.636383f,0.0f,
-			0.652401f,0.333168f,0.653877f,0.0f,
-			0.352138f,0.332607f,0.853755f,0.0f,
-			0.364638f,0.203458f,0.884141f,0.0f,
-			0.352138f,0.332607f,0.853755f,0.0f,
-			0.652401f,0.333168f,0.653877f,0.0f,
-			0.652401f,0.333168f,0.653877f,0.0f,
-			0.675662f,0.203787f,0.677268f,0.0f,
-			0.364638f,0.203458f,0.884141f,0.0f,
-			0.368364f,-0.065419f,0.888030f,0.0f,
-			0.364638f,0.203458f,0.884141f,0.0f,
-			0.675662f,0.203787f,0.677268f,0.0f,
-			0.675662f,0.203787f,0.677268f,0.0f,
-			0.680571f,-0.065654f,0.679431f,0.0f,
-			0.368364f,-0.065419f,0.888030f,0.0f,
-			-0.000553f,0.397201f,0.900100f,0.0f,
-			-0.002582f,0.488185f,0.852454f,0.0f,
-			0.323145f,0.488916f,0.787909f,0.0f,
-			0.323145f,0.488916f,0.787909f,0.0f,
-			0.343335f,0.397870f,0.831249f,0.0f,
-			-0.000553f,0.397201f,0.900100f,0.0f,
-			-0.001033f,0.332006f,0.924205f,0.0f,
-			-0.000553f,0.397201f,0.900100f,0.0f,
-			0.343335f,0.397870f,0.831249f,0.0f,
-			0.343335f,0.397870f,0.831249f,0.0f,
-			0.352138f,0.332607f,0.853755f,0.0f,
-			-0.001033f,0.332006f,0.924205f,0.0f,
-			-0.001123f,0.203032f,0.956967f,0.0f,
-			-0.001033f,0.332006f,0.924205f,0.0f,
-			0.352138f,0.332607f,0.853755f,0.0f,
-			0.352138f,0.332607f,0.853755f,0.0f,
-			0.364638f,0.203458f,0.884141f,0.0f,
-			-0.001123f,0.203032f,0.956967f,0.0f,
-			0.000796f,-0.065419f,0.961934f,0.0f,
-			-0.001123f,0.203032f,0.956967f,0.0f,
-			0.364638f,0.203458f,0.884141f,0.0f,
-			0.364638f,0.203458f,0.884141f,0.0f,
-			0.368364f,-0.065419f,0.888030f,0.0f,
-			0.000796f,-0.065419f,0.961934f,0.0f,
-			-0.344381f,0.397857f,0.830834f,0.0f,
-			-0.328165f,0.488318f,0.786307f,0.0f,
-			-0.002582f,0.488185f,0.852454f,0.0f,
-			-0.002582f,0.488185f,0.852454f,0.0f,
-			-0.000553f,0.397201f,0.900100f,0.0f,
-			-0.344381f,0.397857f,0.830834f,0.0f,
-			-0.354091f,0.332567f,0.852985f,0.0f,
-			-0.344381f,0.397857f,0.830834f,0.0f,
-			-0.000553f,0.397201f,0.900100f,0.0f,
-			-0.000553f,0.397201f,0.900100f,0.0f,
-			-0.001033f,0.332006f,0.924205f,0.0f,
-			-0.354091f,0.332567f,0.852985f,0.0f,
-			-0.366763f,0.203361f,0.883308f,0.0f,
-			-0.354091f,0.332567f,0.852985f,0.0f,
-			-0.001033f,0.332006f,0.924205f,0.0f,
-			-0.001033f,0.332006f,0.924205f,0.0f,
-			-0.001123f,0.203032f,0.956967f,0.0f,
-			-0.366763f,0.203361f,0.883308f,0.0f,
-			-0.366855f,-0.065653f,0.888622f,0.0f,
-			-0.366763f,0.203361f,0.883308f,0.0f,
-			-0.001123f,0.203032f,0.956967f,0.0f,
-			-0.001123f,0.203032f,0.956967f,0.0f,
-			0.000796f,-0.065419f,0.961934f,0.0f,
-			-0.366855f,-0.065653f,0.888622f,0.0f,
-			-0.636382f,0.398524f,0.635592f,0.0f,
-			-0.604592f,0.488259f,0.600944f,0.0f,
-			-0.328165f,0.488318f,0.786307f,0.0f,
-			-0.328165f,0.488318f,0.786307f,0.0f,
-			-0.344381f,0.397857f,0.830834f,0.0f,
-			-0.636382f,0.398524f,0.635592f,0.0f,
-			-0.653878f,0.333169f,0.652401f,0.0f,
-			-0.636382f,0.398524f,0.635592f,0.0f,
-			-0.344381f,0.397857f,0.830834f,0.0f,
-			-0.344381f,0.397857f,0.830834f,0.0f,
-			-0.354091f,0.332567f,0.852985f,0.0f,
-			-0.653878f,0.333169f,0.652401f,0.0f,
-			-0.677267f,0.203788f,0.675661f,0.0f,
-			-0.653878f,0.333169f,0.652401f,0.0f,
-			-0.354091f,0.332567f,0.852985f,0.0f,
-			-0.354091f,0.332567f,0.852985f,0.0f,
-			-0.366763f,0.203361f,0.883308f,0.0f,
-			-0.677267f,0.203788f,0.675661f,0.0f,
-			-0.679431f,-0.065651f,0.680571f,0.0f,
-			-0.677267f,0.203788f,0.675661f,0.0f,
-			-0.366763f,0.203361f,0.883308f,0.0f,
-			-0.366763f,0.203361f,0.883308f,0.0f,
-			-0.366855f,-0.065653f,0.888622f,0.0f,
-			-0.679431f,-0.065651f,0.680571f,0.0f,
-			-0.831249f,0.397870f,0.343335f,0.0f,
-			-0.788544f,0.487896f,0.323408f,0.0f,
-			-0.604592f,0.488259f,0.600944f,0.0f,
-			-0.604592f,0.488259f,0.600944f,0.0f,
-			-0.636382f,0.398524f,0.635592f,0.0f,
-			-0.831249f,0.397870f,0.343335f,0.0f,
-			-0.853756f,0.332604f,0.352140f,0.0f,
-			-0.831249f,0.397870f,0.343335f,0.0f,
-			-0.636382f,0.398524f,0.635592f,0.0f,
-			-0.636382f,0.398524f,0.635592f,0.0f,
-			-0.653878f,0.333169f,0.652401f,0.0f,
-			-0.853756f,0.332604f,0.352140f,0.0f,
-			-0.884141f,0.203458f,0.364638f,0.0f,
-			-0.853756f,0.332604f,0.352140f,0.0f,
-			-0.653878f,0.333169f,0.652401f,0.0f,
-			-0.653878f,0.333169f,0.652401f,0.0f,
-			-0.677267f,0.203788f,0.675661f,0.0f,
-			-0.884141f,0.203458f,0.364638f,0.0f,
-			-0.888032f,-0.065415f,0.368362f,0.0f,
-			-0.884141f,0.203458f,0.364638f,0.0f,
-			-0.677267f,0.203788f,0.675661f,0.0f,
-			-0.677267f,0.203788f,0.675661f,0.0f,
-			-0.679431f,-0.065651f,0.680571f,0.0f,
-			-0.888032f,-0.065415f,0.368362f,0.0f,
-			-0.900099f,0.397202f,-0.000555f,0.0f,
-			-0.852627f,0.487938f,-0.002596f,0.0f,
-			-0.788544f,0.487896f,0.323408f,0.0f,
-			-0.788544f,0.487896f,0.323408f,0.0f,
-			-0.831249f,0.397870f,0.343335f,0.0f,
-			-0.900099f,0.397202f,-0.000555f,0.0f,
-			-0.924204f,0.332005f,-0.001033f,0.0f,
-			-0.900099f,0.397202f,-0.000555f,0.0f,
-			-0.831249f,0.397870f,0.343335f,0.0f,
-			-0.831249f,0.397870f,0.343335f,0.0f,
-			-0.853756f,0.332604f,0.352140f,0.0f,
-			-0.924204f,0.332005f,-0.001033f,0.0f,
-			-0.956967f,0.203029f,-0.001122f,0.0f,
-			-0.924204f,0.332005f,-0.001033f,0.0f,
-			-0.853756f,0.332604f,0.352140f,0.0f,
-			-0.853756f,0.332604f,0.352140f,0.0f,
-			-0.884141f,0.203458f,0.364638f,0.0f,
-			-0.956967f,0.203029f,-0.001122f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			-0.956967f,0.203029f,-0.001122f,0.0f,
-			-0.884141f,0.203458f,0.364638f,0.0f,
-			-0.884141f,0.203458f,0.364638f,0.0f,
-			-0.888032f,-0.065415f,0.368362f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			-0.830836f,0.397854f,-0.344380f,0.0f,
-			-0.785964f,0.488892f,-0.328011f,0.0f,
-			-0.852627f,0.487938f,-0.002596f,0.0f,
-			-0.852627f,0.487938f,-0.002596f,0.0f,
-			-0.900099f,0.397202f,-0.000555f,0.0f,
-			-0.830836f,0.397854f,-0.344380f,0.0f,
-			-0.852984f,0.332567f,-0.354092f,0.0f,
-			-0.830836f,0.397854f,-0.344380f,0.0f,
-			-0.900099f,0.397202f,-0.000555f,0.0f,
-			-0.900099f,0.397202f,-0.000555f,0.0f,
-			-0.924204f,0.332005f,-0.001033f,0.0f,
-			-0.852984f,0.332567f,-0.354092f,0.0f,
-			-0.883307f,0.203361f,-0.366765f,0.0f,
-			-0.852984f,0.332567f,-0.354092f,0.0f,
-			-0.924204f,0.332005f,-0.001033f,0.0f,
-			-0.924204f,0.332005f,-0.001033f,0.0f,
-			-0.956967f,0.203029f,-0.001122f,0.0f,
-			-0.883307f,0.203361f,-0.366765f,0.0f,
-			-0.888622f,-0.065648f,-0.366856f,0.0f,
-			-0.883307f,0.203361f,-0.366765f,0.0f,
-			-0.956967f,0.203029f,-0.001122f,0.0f,
-			-0.956967f,0.203029f,-0.001122f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			-0.888622f,-0.065648f,-0.366856f,0.0f,
-			-0.635593f,0.398524f,-0.636382f,0.0f,
-			-0.600283f,0.489632f,-0.603967f,0.0f,
-			-0.785964f,0.488892f,-0.328011f,0.0f,
-			-0.785964f,0.488892f,-0.328011f,0.0f,
-			-0.830836f,0.397854f,-0.344380f,0.0f,
-			-0.635593f,0.398524f,-0.636382f,0.0f,
-			-0.652403f,0.333165f,-0.653877f,0.0f,
-			-0.635593f,0.398524f,-0.636382f,0.0f,
-			-0.830836f,0.397854f,-0.344380f,0.0f,
-			-0.830836f,0.397854f,-0.344380f,0.0f,
-			-0.852984f,0.332567f,-0.354092f,0.0f,
-			-0.652403f,0.333165f,-0.653877f,0.0f,
-			-0.675662f,0.203785f,-0.677267f,0.0f,
-			-0.652403f,0.333165f,-0.653877f,0.0f,
-			-0.852984f,0.332567f,-0.354092f,0.0f,
-			-0.852984f,0.332567f,-0.354092f,0.0f,
-			-0.883307f,0.203361f,-0.366765f,0.0f,
-			-0.675662f,0.203785f,-0.677267f,0.0f,
-			-0.680570f,-0.065648f,-0.679433f,0.0f,
-			-0.675662f,0.203785f,-0.677267f,0.0f,
-			-0.883307f,0.203361f,-0.366765f,0.0f,
-			-0.883307f,0.203361f,-0.366765f,0.0f,
-			-0.888622f,-0.065648f,-0.366856f,0.0f,
-			-0.680570f,-0.065648f,-0.679433f,0.0f,
-			-0.343334f,0.397871f,-0.831249f,0.0f,
-			-0.323144f,0.488917f,-0.787909f,0.0f,
-			-0.600283f,0.489632f,-0.603967f,0.0f,
-			-0.600283f,0.489632f,-0.603967f,0.0f,
-			-0.635593f,0.398524f,-0.636382f,0.0f,
-			-0.343334f,0.397871f,-0.831249f,0.0f,
-			-0.352139f,0.332606f,-0.853755f,0.0f,
-			-0.343334f,0.397871f,-0.831249f,0.0f,
-			-0.635593f,0.398524f,-0.636382f,0.0f,
-			-0.635593f,0.398524f,-0.636382f,0.0f,
-			-0.652403f,0.333165f,-0.653877f,0.0f,
-			-0.352139f,0.332606f,-0.853755f,0.0f,
-			-0.364640f,0.203453f,-0.884141f,0.0f,
-			-0.352139f,0.332606f,-0.853755f,0.0f,
-			-0.652403f,0.333165f,-0.653877f,0.0f,
-			-0.652403f,0.333165f,-0.653877f,0.0f,
-			-0.675662f,0.203785f,-0.677267f,0.0f,
-			-0.364640f,0.203453f,-0.884141f,0.0f,
-			-0.368365f,-0.065418f,-0.888032f,0.0f,
-			-0.364640f,0.203453f,-0.884141f,0.0f,
-			-0.675662f,0.203785f,-0.677267f,0.0f,
-			-0.675662f,0.203785f,-0.677267f,0.0f,
-			-0.680570f,-0.065648f,-0.679433f,0.0f,
-			-0.368365f,-0.065418f,-0.888032f,0.0f,
-			0.000553f,0.397201f,-0.900099f,0.0f,
-			0.002582f,0.488184f,-0.852455f,0.0f,
-			-0.323144f,0.488917f,-0.787909f,0.0f,
-			-0.323144f,0.488917f,-0.787909f,0.0f,
-			-0.343334f,0.397871f,-0.831249f,0.0f,
-			0.000553f,0.397201f,-0.900099f,0.0f,
-			0.001033f,0.332006f,-0.924205f,0.0f,
-			0.000553f,0.397201f,-0.900099f,0.0f,
-			-0.343334f,0.397871f,-0.831249f,0.0f,
-			-0.343334f,0.397871f,-0.831249f,0.0f,
-			-0.352139f,0.332606f,-0.853755f,0.0f,
-			0.001033f,0.332006f,-0.924205f,0.0f,
-			0.001124f,0.203030f,-0.956966f,0.0f,
-			0.001033f,0.332006f,-0.924205f,0.0f,
-			-0.352139f,0.332606f,-0.853755f,0.0f,
-			-0.352139f,0.332606f,-0.853755f,0.0f,
-			-0.364640f,0.203453f,-0.884141f,0.0f,
-			0.001124f,0.203030f,-0.956966f,0.0f,
-			-0.000796f,-0.065419f,-0.961934f,0.0f,
-			0.001124f,0.203030f,-0.956966f,0.0f,
-			-0.364640f,0.203453f,-0.884141f,0.0f,
-			-0.364640f,0.203453f,-0.884141f,0.0f,
-			-0.368365f,-0.065418f,-0.888032f,0.0f,
-			-0.000796f,-0.065419f,-0.961934f,0.0f,
-			0.344381f,0.397857f,-0.830835f,0.0f,
-			0.328013f,0.488893f,-0.785963f,0.0f,
-			0.002582f,0.488184f,-0.852455f,0.0f,
-			0.002582f,0.488184f,-0.852455f,0.0f,
-			0.000553f,0.397201f,-0.900099f,0.0f,
-			0.344381f,0.397857f,-0.830835f,0.0f,
-			0.354091f,0.332565f,-0.852985f,0.0f,
-			0.344381f,0.397857f,-0.830835f,0.0f,
-			0.000553f,0.397201f,-0.900099f,0.0f,
-			0.000553f,0.397201f,-0.900099f,0.0f,
-			0.001033f,0.332006f,-0.924205f,0.0f,
-			0.354091f,0.332565f,-0.852985f,0.0f,
-			0.366766f,0.203359f,-0.883306f,0.0f,
-			0.354091f,0.332565f,-0.852985f,0.0f,
-			0.001033f,0.332006f,-0.924205f,0.0f,
-			0.001033f,0.332006f,-0.924205f,0.0f,
-			0.001124f,0.203030f,-0.956966f,0.0f,
-			0.366766f,0.203359f,-0.883306f,0.0f,
-			0.366857f,-0.065653f,-0.888622f,0.0f,
-			0.366766f,0.203359f,-0.883306f,0.0f,
-			0.001124f,0.203030f,-0.956966f,0.0f,
-			0.001124f,0.203030f,-0.956966f,0.0f,
-			-0.000796f,-0.065419f,-0.961934f,0.0f,
-			0.366857f,-0.065653f,-0.888622f,0.0f,
-			0.636382f,0.398525f,-0.635592f,0.0f,
-			0.603966f,0.489631f,-0.600284f,0.0f,
-			0.328013f,0.488893f,-0.785963f,0.0f,
-			0.328013f,0.488893f,-0.785963f,0.0f,
-			0.344381f,0.397857f,-0.830835f,0.0f,
-			0.636382f,0.398525f,-0.635592f,0.0f,
-			0.653877f,0.333166f,-0.652402f,0.0f,
-			0.636382f,0.398525f,-0.635592f,0.0f,
-			0.344381f,0.397857f,-0.830835f,0.0f,
-			0.344381f,0.397857f,-0.830835f,0.0f,
-			0.354091f,0.332565f,-0.852985f,0.0f,
-			0.653877f,0.333166f,-0.652402f,0.0f,
-			0.677268f,0.203783f,-0.675663f,0.0f,
-			0.653877f,0.333166f,-0.652402f,0.0f,
-			0.354091f,0.332565f,-0.852985f,0.0f,
-			0.354091f,0.332565f,-0.852985f,0.0f,
-			0.366766f,0.203359f,-0.883306f,0.0f,
-			0.677268f,0.203783f,-0.675663f,0.0f,
-			0.679433f,-0.065650f,-0.680571f,0.0f,
-			0.677268f,0.203783f,-0.675663f,0.0f,
-			0.366766f,0.203359f,-0.883306f,0.0f,
-			0.366766f,0.203359f,-0.883306f,0.0f,
-			0.366857f,-0.065653f,-0.888622f,0.0f,
-			0.679433f,-0.065650f,-0.680571f,0.0f,
-			0.831248f,0.397870f,-0.343335f,0.0f,
-			0.787906f,0.488921f,-0.323144f,0.0f,
-			0.603966f,0.489631f,-0.600284f,0.0f,
-			0.603966f,0.489631f,-0.600284f,0.0f,
-			0.636382f,0.398525f,-0.635592f,0.0f,
-			0.831248f,0.397870f,-0.343335f,0.0f,
-			0.853755f,0.332606f,-0.352139f,0.0f,
-			0.831248f,0.397870f,-0.343335f,0.0f,
-			0.636382f,0.398525f,-0.635592f,0.0f,
-			0.636382f,0.398525f,-0.635592f,0.0f,
-			0.653877f,0.333166f,-0.652402f,0.0f,
-			0.853755f,0.332606f,-0.352139f,0.0f,
-			0.884141f,0.203453f,-0.364640f,0.0f,
-			0.853755f,0.332606f,-0.352139f,0.0f,
-			0.653877f,0.333166f,-0.652402f,0.0f,
-			0.653877f,0.333166f,-0.652402f,0.0f,
-			0.677268f,0.203783f,-0.675663f,0.0f,
-			0.884141f,0.203453f,-0.364640f,0.0f,
-			0.888030f,-0.065420f,-0.368365f,0.0f,
-			0.884141f,0.203453f,-0.364640f,0.0f,
-			0.677268f,0.203783f,-0.675663f,0.0f,
-			0.677268f,0.203783f,-0.675663f,0.0f,
-			0.679433f,-0.065650f,-0.680571f,0.0f,
-			0.888030f,-0.065420f,-0.368365f,0.0f,
-			0.900099f,0.397201f,0.000553f,0.0f,
-			0.852454f,0.488185f,0.002582f,0.0f,
-			0.787906f,0.488921f,-0.323144f,0.0f,
-			0.787906f,0.488921f,-0.323144f,0.0f,
-			0.831248f,0.397870f,-0.343335f,0.0f,
-			0.900099f,0.397201f,0.000553f,0.0f,
-			0.924205f,0.332006f,0.001033f,0.0f,
-			0.900099f,0.397201f,0.000553f,0.0f,
-			0.831248f,0.397870f,-0.343335f,0.0f,
-			0.831248f,0.397870f,-0.343335f,0.0f,
-			0.853755f,0.332606f,-0.352139f,0.0f,
-			0.924205f,0.332006f,0.001033f,0.0f,
-			0.956967f,0.203031f,0.001124f,0.0f,
-			0.924205f,0.332006f,0.001033f,0.0f,
-			0.853755f,0.332606f,-0.352139f,0.0f,
-			0.853755f,0.332606f,-0.352139f,0.0f,
-			0.884141f,0.203453f,-0.364640f,0.0f,
-			0.956967f,0.203031f,0.001124f,0.0f,
-			0.961933f,-0.065422f,-0.000797f,0.0f,
-			0.956967f,0.203031f,0.001124f,0.0f,
-			0.884141f,0.203453f,-0.364640f,0.0f,
-			0.884141f,0.203453f,-0.364640f,0.0f,
-			0.888030f,-0.065420f,-0.368365f,0.0f,
-			0.961933f,-0.065422f,-0.000797f,0.0f,
-			0.799483f,-0.430716f,0.324554f,0.0f,
-			0.888622f,-0.065652f,0.366857f,0.0f,
-			0.961933f,-0.065422f,-0.000797f,0.0f,
-			0.961933f,-0.065422f,-0.000797f,0.0f,
-			0.863678f,-0.430058f,-0.005671f,0.0f,
-			0.799483f,-0.430716f,0.324554f,0.0f,
-			0.659886f,-0.680467f,0.268314f,0.0f,
-			0.799483f,-0.430716f,0.324554f,0.0f,
-			0.863678f,-0.430058f,-0.005671f,0.0f,
-			0.863678f,-0.430058f,-0.005671f,0.0f,
-			0.713362f,-0.679781f,-0.004222f,0.0f,
-			0.659886f,-0.680467f,0.268314f,0.0f,
-			0.635587f,-0.709220f,0.265825f,0.0f,
-			0.659886f,-0.680467f,0.268314f,0.0f,
-			0.713362f,-0.679781f,-0.004222f,0.0f,
-			0.713362f,-0.679781f,-0.004222f,0.0f,
-			0.689946f,-0.708513f,0.002682f,0.0f,
-			0.635587f,-0.709220f,0.265825f,0.0f,
-			0.723155f,-0.593293f,0.303079f,0.0f,
-			0.635587f,-0.709220f,0.265825f,0.0f,
-			0.689946f,-0.708513f,0.002682f,0.0f,
-			0.689946f,-0.708513f,0.002682f,0.0f,
-			0.784982f,-0.592564f,0.003573f,0.0f,
-			0.723155f,-0.593293f,0.303079f,0.0f,
-			0.614191f,-0.431277f,0.606105f,0.0f,
-			0.680571f,-0.065654f,0.679431f,0.0f,
-			0.888622f,-0.065652f,0.366857f,0.0f,
-			0.888622f,-0.065652f,0.366857f,0.0f,
-			0.799483f,-0.430716f,0.324554f,0.0f,
-			0.614191f,-0.431277f,0.606105f,0.0f,
-			0.506447f,-0.681187f,0.500442f,0.0f,
-			0.614191f,-0.431277f,0.606105f,0.0f,
-			0.799483f,-0.430716f,0.324554f,0.0f,
-			0.799483f,-0.430716f,0.324554f,0.0f,
-			0.659886f,-0.680467f,0.268314f,0.0f,
-			0.506447f,-0.681187f,0.500442f,0.0f,
-			0.484928f,-0.709900f,0.488740f,0.0f,
-			0.506447f,-0.681187f,0.500442f,0.0f,
-			0.659886f,-0.680467f,0.268314f,0.0f,
-			0.659886f,-0.680467f,0.268314f,0.0f,
-			0.635587f,-0.709220f,0.265825f,0.0f,
-			0.484928f,-0.709900f,0.488740f,0.0f,
-			0.551682f,-0.594040f,0.556772f,0.0f,
-			0.484928f,-0.709900f,0.488740f,0.0f,
-			0.635587f,-0.709220f,0.265825f,0.0f,
-			0.635587f,-0.709220f,0.265825f,0.0f,
-			0.723155f,-0.593293f,0.303079f,0.0f,
-			0.551682f,-0.594040f,0.556772f,0.0f,
-			0.335252f,-0.430621f,0.795221f,0.0f,
-			0.368364f,-0.065419f,0.888030f,0.0f,
-			0.680571f,-0.065654f,0.679431f,0.0f,
-			0.680571f,-0.065654f,0.679431f,0.0f,
-			0.614191f,-0.431277f,0.606105f,0.0f,
-			0.335252f,-0.430621f,0.795221f,0.0f,
-			0.276245f,-0.680501f,0.656660f,0.0f,
-			0.335252f,-0.430621f,0.795221f,0.0f,
-			0.614191f,-0.431277f,0.606105f,0.0f,
-			0.614191f,-0.431277f,0.606105f,0.0f,
-			0.506447f,-0.681187f,0.500442f,0.0f,
-			0.276245f,-0.680501f,0.656660f,0.0f,
-			0.260791f,-0.709194f,0.637640f,0.0f,
-			0.276245f,-0.680501f,0.656660f,0.0f,
-			0.506447f,-0.681187f,0.500442f,0.0f,
-			0.506447f,-0.681187f,0.500442f,0.0f,
-			0.484928f,-0.709900f,0.488740f,0.0f,
-			0.260791f,-0.709194f,0.637640f,0.0f,
-			0.296349f,-0.593298f,0.725860f,0.0f,
-			0.260791f,-0.709194f,0.637640f,0.0f,
-			0.484928f,-0.709900f,0.488740f,0.0f,
-			0.484928f,-0.709900f,0.488740f,0.0f,
-			0.551682f,-0.594040f,0.556772f,0.0f,
-			0.296349f,-0.593298f,0.725860f,0.0f,
-			0.005670f,-0.430055f,0.863679f,0.0f,
-			0.000796f,-0.065419f,0.961934f,0.0f,
-			0.368364f,-0.065419f,0.888030f,0.0f,
-			0.368364f,-0.065419f,0.888030f,0.0f,
-			0.335252f,-0.430621f,0.795221f,0.0f,
-			0.005670f,-0.430055f,0.863679f,0.0f,
-			0.004224f,-0.679782f,0.713362f,0.0f,
-			0.005670f,-0.430055f,0.863679f,0.0f,
-			0.335252f,-0.430621f,0.795221f,0.0f,
-			0.335252f,-0.430621f,0.795221f,0.0f,
-			0.276245f,-0.680501f,0.656660f,0.0f,
-			0.004224f,-0.679782f,0.713362f,0.0f,
-			-0.002682f,-0.708518f,0.689942f,0.0f,
-			0.004224f,-0.679782f,0.713362f,0.0f,
-			0.276245f,-0.680501f,0.656660f,0.0f,
-			0.276245f,-0.680501f,0.656660f,0.0f,
-			0.260791f,-0.709194f,0.637640f,0.0f,
-			-0.002682f,-0.708518f,0.689942f,0.0f,
-			-0.003575f,-0.592554f,0.784987f,0.0f,
-			-0.002682f,-0.708518f,0.689942f,0.0f,
-			0.260791f,-0.709194f,0.637640f,0.0f,
-			0.260791f,-0.709194f,0.637640f,0.0f,
-			0.296349f,-0.593298f,0.725860f,0.0f,
-			-0.003575f,-0.592554f,0.784987f,0.0f,
-			-0.324554f,-0.430715f,0.799485f,0.0f,
-			-0.366855f,-0.065653f,0.888622f,0.0f,
-			0.000796f,-0.065419f,0.961934f,0.0f,
-			0.000796f,-0.065419f,0.961934f,0.0f,
-			0.005670f,-0.430055f,0.863679f,0.0f,
-			-0.324554f,-0.430715f,0.799485f,0.0f,
-			-0.268315f,-0.680465f,0.659888f,0.0f,
-			-0.324554f,-0.430715f,0.799485f,0.0f,
-			0.005670f,-0.430055f,0.863679f,0.0f,
-			0.005670f,-0.430055f,0.863679f,0.0f,
-			0.004224f,-0.679782f,0.713362f,0.0f,
-			-0.268315f,-0.680465f,0.659888f,0.0f,
-			-0.265821f,-0.709227f,0.635582f,0.0f,
-			-0.268315f,-0.680465f,0.659888f,0.0f,
-			0.004224f,-0.679782f,0.713362f,0.0f,
-			0.004224f,-0.679782f,0.713362f,0.0f,
-			-0.002682f,-0.708518f,0.689942f,0.0f,
-			-0.265821f,-0.709227f,0.635582f,0.0f,
-			-0.303075f,-0.593296f,0.723153f,0.0f,
-			-0.265821f,-0.709227f,0.635582f,0.0f,
-			-0.002682f,-0.708518f,0.689942f,0.0f,
-			-0.002682f,-0.708518f,0.689942f,0.0f,
-			-0.003575f,-0.592554f,0.784987f,0.0f,
-			-0.303075f,-0.593296f,0.723153f,0.0f,
-			-0.606103f,-0.431280f,0.614192f,0.0f,
-			-0.679431f,-0.065651f,0.680571f,0.0f,
-			-0.366855f,-0.065653f,0.888622f,0.0f,
-			-0.366855f,-0.065653f,0.888622f,0.0f,
-			-0.324554f,-0.430715f,0.799485f,0.0f,
-			-0.606103f,-0.431280f,0.614192f,0.0f,
-			-0.500442f,-0.681186f,0.506447f,0.0f,
-			-0.606103f,-0.431280f,0.614192f,0.0f,
-			-0.324554f,-0.430715f,0.799485f,0.0f,
-			-0.324554f,-0.430715f,0.799485f,0.0f,
-			-0.268315f,-0.680465f,0.659888f,0.0f,
-			-0.500442f,-0.681186f,0.506447f,0.0f,
-			-0.488740f,-0.709899f,0.484929f,0.0f,
-			-0.500442f,-0.681186f,0.506447f,0.0f,
-			-0.268315f,-0.680465f,0.659888f,0.0f,
-			-0.268315f,-0.680465f,0.659888f,0.0f,
-			-0.265821f,-0.709227f,0.635582f,0.0f,
-			-0.488740f,-0.709899f,0.484929f,0.0f,
-			-0.556769f,-0.594043f,0.551681f,0.0f,
-			-0.488740f,-0.709899f,0.484929f,0.0f,
-			-0.265821f,-0.709227f,0.635582f,0.0f,
-			-0.265821f,-0.709227f,0.635582f,0.0f,
-			-0.303075f,-0.593296f,0.723153f,0.0f,
-			-0.556769f,-0.594043f,0.551681f,0.0f,
-			-0.795220f,-0.430618f,0.335250f,0.0f,
-			-0.888032f,-0.065415f,0.368362f,0.0f,
-			-0.679431f,-0.065651f,0.680571f,0.0f,
-			-0.679431f,-0.065651f,0.680571f,0.0f,
-			-0.606103f,-0.431280f,0.614192f,0.0f,
-			-0.795220f,-0.430618f,0.335250f,0.0f,
-			-0.656658f,-0.680503f,0.276246f,0.0f,
-			-0.795220f,-0.430618f,0.335250f,0.0f,
-			-0.606103f,-0.431280f,0.614192f,0.0f,
-			-0.606103f,-0.431280f,0.614192f,0.0f,
-			-0.500442f,-0.681186f,0.506447f,0.0f,
-			-0.656658f,-0.680503f,0.276246f,0.0f,
-			-0.637640f,-0.709194f,0.260792f,0.0f,
-			-0.656658f,-0.680503f,0.276246f,0.0f,
-			-0.500442f,-0.681186f,0.506447f,0.0f,
-			-0.500442f,-0.681186f,0.506447f,0.0f,
-			-0.488740f,-0.709899f,0.484929f,0.0f,
-			-0.637640f,-0.709194f,0.260792f,0.0f,
-			-0.725859f,-0.593301f,0.296348f,0.0f,
-			-0.637640f,-0.709194f,0.260792f,0.0f,
-			-0.488740f,-0.709899f,0.484929f,0.0f,
-			-0.488740f,-0.709899f,0.484929f,0.0f,
-			-0.556769f,-0.594043f,0.551681f,0.0f,
-			-0.725859f,-0.593301f,0.296348f,0.0f,
-			-0.863679f,-0.430054f,0.005670f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			-0.888032f,-0.065415f,0.368362f,0.0f,
-			-0.888032f,-0.065415f,0.368362f,0.0f,
-			-0.795220f,-0.430618f,0.335250f,0.0f,
-			-0.863679f,-0.430054f,0.005670f,0.0f,
-			-0.713363f,-0.679781f,0.004222f,0.0f,
-			-0.863679f,-0.430054f,0.005670f,0.0f,
-			-0.795220f,-0.430618f,0.335250f,0.0f,
-			-0.795220f,-0.430618f,0.335250f,0.0f,
-			-0.656658f,-0.680503f,0.276246f,0.0f,
-			-0.713363f,-0.679781f,0.004222f,0.0f,
-			-0.689942f,-0.708518f,-0.002682f,0.0f,
-			-0.713363f,-0.679781f,0.004222f,0.0f,
-			-0.656658f,-0.680503f,0.276246f,0.0f,
-			-0.656658f,-0.680503f,0.276246f,0.0f,
-			-0.637640f,-0.709194f,0.260792f,0.0f,
-			-0.689942f,-0.708518f,-0.002682f,0.0f,
-			-0.784980f,-0.592565f,-0.003573f,0.0f,
-			-0.689942f,-0.708518f,-0.002682f,0.0f,
-			-0.637640f,-0.709194f,0.260792f,0.0f,
-			-0.637640f,-0.709194f,0.260792f,0.0f,
-			-0.725859f,-0.593301f,0.296348f,0.0f,
-			-0.784980f,-0.592565f,-0.003573f,0.0f,
-			-0.799482f,-0.430716f,-0.324552f,0.0f,
-			-0.888622f,-0.065648f,-0.366856f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			-0.863679f,-0.430054f,0.005670f,0.0f,
-			-0.799482f,-0.430716f,-0.324552f,0.0f,
-			-0.659886f,-0.680468f,-0.268314f,0.0f,
-			-0.799482f,-0.430716f,-0.324552f,0.0f,
-			-0.863679f,-0.430054f,0.005670f,0.0f,
-			-0.863679f,-0.430054f,0.005670f,0.0f,
-			-0.713363f,-0.679781f,0.004222f,0.0f,
-			-0.659886f,-0.680468f,-0.268314f,0.0f,
-			-0.635590f,-0.709216f,-0.265827f,0.0f,
-			-0.659886f,-0.680468f,-0.268314f,0.0f,
-			-0.713363f,-0.679781f,0.004222f,0.0f,
-			-0.713363f,-0.679781f,0.004222f,0.0f,
-			-0.689942f,-0.708518f,-0.002682f,0.0f,
-			-0.635590f,-0.709216f,-0.265827f,0.0f,
-			-0.723144f,-0.593314f,-0.303071f,0.0f,
-			-0.635590f,-0.709216f,-0.265827f,0.0f,
-			-0.689942f,-0.708518f,-0.002682f,0.0f,
-			-0.689942f,-0.708518f,-0.002682f,0.0f,
-			-0.784980f,-0.592565f,-0.003573f,0.0f,
-			-0.723144f,-0.593314f,-0.303071f,0.0f,
-			-0.614190f,-0.431278f,-0.606104f,0.0f,
-			-0.680570f,-0.065648f,-0.679433f,0.0f,
-			-0.888622f,-0.065648f,-0.366856f,0.0f,
-			-0.888622f,-0.065648f,-0.366856f,0.0f,
-			-0.799482f,-0.430716f,-0.324552f,0.0f,
-			-0.614190f,-0.431278f,-0.606104f,0.0f,
-			-0.506445f,-0.681190f,-0.500441f,0.0f,
-			-0.614190f,-0.431278f,-0.606104f,0.0f,
-			-0.799482f,-0.430716f,-0.324552f,0.0f,
-			-0.799482f,-0.430716f,-0.324552f,0.0f,
-			-0.659886f,-0.680468f,-0.268314f,0.0f,
-			-0.506445f,-0.681190f,-0.500441f,0.0f,
-			-0.484931f,-0.709895f,-0.488743f,0.0f,
-			-0.506445f,-0.681190f,-0.500441f,0.0f,
-			-0.659886f,-0.680468f,-0.268314f,0.0f,
-			-0.659886f,-0.680468f,-0.268314f,0.0f,
-			-0.635590f,-0.709216f,-0.265827f,0.0f,
-			-0.484931f,-0.709895f,-0.488743f,0.0f,
-			-0.551683f,-0.594040f,-0.556773f,0.0f,
-			-0.484931f,-0.709895f,-0.488743f,0.0f,
-			-0.635590f,-0.709216f,-0.265827f,0.0f,
-			-0.635590f,-0.709216f,-0.265827f,0.0f,
-			-0.723144f,-0.593314f,-0.303071f,0.0f,
-			-0.551683f,-0.594040f,-0.556773f,0.0f,
-			-0.335251f,-0.430618f,-0.795219f,0.0f,
-			-0.368365f,-0.065418f,-0.888032f,0.0f,
-			-0.680570f,-0.065648f,-0.679433f,0.0f,
-			-0.680570f,-0.065648f,-0.679433f,0.0f,
-			-0.614190f,-0.431278f,-0.606104f,0.0f,
-			-0.335251f,-0.430618f,-0.795219f,0.0f,
-			-0.276245f,-0.680504f,-0.656658f,0.0f,
-			-0.335251f,-0.430618f,-0.795219f,0.0f,
-			-0.614190f,-0.431278f,-0.606104f,0.0f,
-			-0.614190f,-0.431278f,-0.606104f,0.0f,
-			-0.506445f,-0.681190f,-0.500441f,0.0f,
-			-0.276245f,-0.680504f,-0.656658f,0.0f,
-			-0.260794f,-0.709191f,-0.637643f,0.0f,
-			-0.276245f,-0.680504f,-0.656658f,0.0f,
-			-0.506445f,-0.681190f,-0.500441f,0.0f,
-			-0.506445f,-0.681190f,-0.500441f,0.0f,
-			-0.484931f,-0.709895f,-0.488743f,0.0f,
-			-0.260794f,-0.709191f,-0.637643f,0.0f,
-			-0.296352f,-0.593288f,-0.725867f,0.0f,
-			-0.260794f,-0.709191f,-0.637643f,0.0f,
-			-0.484931f,-0.709895f,-0.488743f,0.0f,
-			-0.484931f,-0.709895f,-0.488743f,0.0f,
-			-0.551683f,-0.594040f,-0.556773f,0.0f,
-			-0.296352f,-0.593288f,-0.725867f,0.0f,
-			-0.005671f,-0.430057f,-0.863676f,0.0f,
-			-0.000796f,-0.065419f,-0.961934f,0.0f,
-			-0.368365f,-0.065418f,-0.888032f,0.0f,
-			-0.368365f,-0.065418f,-0.888032f,0.0f,
-			-0.335251f,-0.430618f,-0.795219f,0.0f,
-			-0.005671f,-0.430057f,-0.863676f,0.0f,
-			-0.004223f,-0.679784f,-0.713361f,0.0f,
-			-0.005671f,-0.430057f,-0.863676f,0.0f,
-			-0.335251f,-0.430618f,-0.795219f,0.0f,
-			-0.335251f,-0.430618f,-0.795219f,0.0f,
-			-0.276245f,-0.680504f,-0.656658f,0.0f,
-			-0.004223f,-0.679784f,-0.713361f,0.0f,
-			0.002682f,-0.708512f,-0.689947f,0.0f,
-			-0.004223f,-0.679784f,-0.713361f,0.0f,
-			-0.276245f,-0.680504f,-0.656658f,0.0f,
-			-0.276245f,-0.680504f,-0.656658f,0.0f,
-			-0.260794f,-0.709191f,-0.637643f,0.0f,
-			0.002682f,-0.708512f,-0.689947f,0.0f,
-			0.003574f,-0.592553f,-0.784988f,0.0f,
-			0.002682f,-0.708512f,-0.689947f,0.0f,
-			-0.260794f,-0.709191f,-0.637643f,0.0f,
-			-0.260794f,-0.709191f,-0.637643f,0.0f,
-			-0.296352f,-0.593288f,-0.725867f,0.0f,
-			0.003574f,-0.592553f,-0.784988f,0.0f,
-			0.324554f,-0.430717f,-0.799483f,0.0f,
-			0.366857f,-0.065653f,-0.888622f,0.0f,
-			-0.000796f,-0.065419f,-0.961934f,0.0f,
-			-0.000796f,-0.065419f,-0.961934f,0.0f,
-			-0.005671f,-0.430057f,-0.863676f,0.0f,
-			0.324554f,-0.430717f,-0.799483f,0.0f,
-			0.268315f,-0.680469f,-0.659885f,0.0f,
-			0.324554f,-0.430717f,-0.799483f,0.0f,
-			-0.005671f,-0.430057f,-0.863676f,0.0f,
-			-0.005671f,-0.430057f,-0.863676f,0.0f,
-			-0.004223f,-0.679784f,-0.713361f,0.0f,
-			0.268315f,-0.680469f,-0.659885f,0.0f,
-			0.265827f,-0.709217f,-0.635590f,0.0f,
-			0.268315f,-0.680469f,-0.659885f,0.0f,
-			-0.004223f,-0.679784f,-0.713361f,0.0f,
-			-0.004223f,-0.679784f,-0.713361f,0.0f,
-			0.002682f,-0.708512f,-0.689947f,0.0f,
-			0.265827f,-0.709217f,-0.635590f,0.0f,
-			0.303076f,-0.593300f,-0.723152f,0.0f,
-			0.265827f,-0.709217f,-0.635590f,0.0f,
-			0.002682f,-0.708512f,-0.689947f,0.0f,
-			0.002682f,-0.708512f,-0.689947f,0.0f,
-			0.003574f,-0.592553f,-0.784988f,0.0f,
-			0.303076f,-0.593300f,-0.723152f,0.0f,
-			0.606102f,-0.431279f,-0.614191f,0.0f,
-			0.679433f,-0.065650f,-0.680571f,0.0f,
-			0.366857f,-0.065653f,-0.888622f,0.0f,
-			0.366857f,-0.065653f,-0.888622f,0.0f,
-			0.324554f,-0.430717f,-0.799483f,0.0f,
-			0.606102f,-0.431279f,-0.614191f,0.0f,
-			0.500441f,-0.681189f,-0.506446f,0.0f,
-			0.606102f,-0.431279f,-0.614191f,0.0f,
-			0.324554f,-0.430717f,-0.799483f,0.0f,
-			0.324554f,-0.430717f,-0.799483f,0.0f,
-			0.268315f,-0.680469f,-0.659885f,0.0f,
-			0.500441f,-0.681189f,-0.506446f,0.0f,
-			0.488744f,-0.709894f,-0.484932f,0.0f,
-			0.500441f,-0.681189f,-0.506446f,0.0f,
-			0.268315f,-0.680469f,-0.659885f,0.0f,
-			0.268315f,-0.680469f,-0.659885f,0.0f,
-			0.265827f,-0.709217f,-0.635590f,0.0f,
-			0.488744f,-0.709894f,-0.484932f,0.0f,
-			0.556771f,-0.594043f,-0.551683f,0.0f,
-			0.488744f,-0.709894f,-0.484932f,0.0f,
-			0.265827f,-0.709217f,-0.635590f,0.0f,
-			0.265827f,-0.709217f,-0.635590f,0.0f,
-			0.303076f,-0.593300f,-0.723152f,0.0f,
-			0.556771f,-0.594043f,-0.551683f,0.0f,
-			0.795219f,-0.430618f,-0.335250f,0.0f,
-			0.888030f,-0.065420f,-0.368365f,0.0f,
-			0.679433f,-0.065650f,-0.680571f,0.0f,
-			0.679433f,-0.065650f,-0.680571f,0.0f,
-			0.606102f,-0.431279f,-0.614191f,0.0f,
-			0.795219f,-0.430618f,-0.335250f,0.0f,
-			0.656657f,-0.680505f,-0.276245f,0.0f,
-			0.795219f,-0.430618f,-0.335250f,0.0f,
-			0.606102f,-0.431279f,-0.614191f,0.0f,
-			0.606102f,-0.431279f,-0.614191f,0.0f,
-			0.500441f,-0.681189f,-0.506446f,0.0f,
-			0.656657f,-0.680505f,-0.276245f,0.0f,
-			0.637644f,-0.709189f,-0.260794f,0.0f,
-			0.656657f,-0.680505f,-0.276245f,0.0f,
-			0.500441f,-0.681189f,-0.506446f,0.0f,
-			0.500441f,-0.681189f,-0.506446f,0.0f,
-			0.488744f,-0.709894f,-0.484932f,0.0f,
-			0.637644f,-0.709189f,-0.260794f,0.0f,
-			0.725863f,-0.593296f,-0.296351f,0.0f,
-			0.637644f,-0.709189f,-0.260794f,0.0f,
-			0.488744f,-0.709894f,-0.484932f,0.0f,
-			0.488744f,-0.709894f,-0.484932f,0.0f,
-			0.556771f,-0.594043f,-0.551683f,0.0f,
-			0.725863f,-0.593296f,-0.296351f,0.0f,
-			0.863678f,-0.430058f,-0.005671f,0.0f,
-			0.961933f,-0.065422f,-0.000797f,0.0f,
-			0.888030f,-0.065420f,-0.368365f,0.0f,
-			0.888030f,-0.065420f,-0.368365f,0.0f,
-			0.795219f,-0.430618f,-0.335250f,0.0f,
-			0.863678f,-0.430058f,-0.005671f,0.0f,
-			0.713362f,-0.679781f,-0.004222f,0.0f,
-			0.863678f,-0.430058f,-0.005671f,0.0f,
-			0.795219f,-0.430618f,-0.335250f,0.0f,
-			0.795219f,-0.430618f,-0.335250f,0.0f,
-			0.656657f,-0.680505f,-0.276245f,0.0f,
-			0.713362f,-0.679781f,-0.004222f,0.0f,
-			0.689946f,-0.708513f,0.002682f,0.0f,
-			0.713362f,-0.679781f,-0.004222f,0.0f,
-			0.656657f,-0.680505f,-0.276245f,0.0f,
-			0.656657f,-0.680505f,-0.276245f,0.0f,
-			0.637644f,-0.709189f,-0.260794f,0.0f,
-			0.689946f,-0.708513f,0.002682f,0.0f,
-			0.784982f,-0.592564f,0.003573f,0.0f,
-			0.689946f,-0.708513f,0.002682f,0.0f,
-			0.637644f,-0.709189f,-0.260794f,0.0f,
-			0.637644f,-0.709189f,-0.260794f,0.0f,
-			0.725863f,-0.593296f,-0.296351f,0.0f,
-			0.784982f,-0.592564f,0.003573f,0.0f,
-			0.512537f,-0.742007f,0.190952f,0.0f,
-			0.723155f,-0.593293f,0.303079f,0.0f,
-			0.784982f,-0.592564f,0.003573f,0.0f,
-			0.784982f,-0.592564f,0.003573f,0.0f,
-			0.547330f,-0.741682f,-0.019216f,0.0f,
-			0.512537f,-0.742007f,0.190952f,0.0f,
-			0.154866f,-0.981330f,0.057546f,0.0f,
-			0.512537f,-0.742007f,0.190952f,0.0f,
-			0.547330f,-0.741682f,-0.019216f,0.0f,
-			0.547330f,-0.741682f,-0.019216f,0.0f,
-			0.165439f,-0.981279f,-0.005920f,0.0f,
-			0.154866f,-0.981330f,0.057546f,0.0f,
-			0.048626f,-0.998176f,0.016841f,0.0f,
-			0.154866f,-0.981330f,0.057546f,0.0f,
-			0.165439f,-0.981279f,-0.005920f,0.0f,
-			0.165439f,-0.981279f,-0.005920f,0.0f,
-			0.051467f,-0.998171f,-0.002981f,0.0f,
-			0.048626f,-0.998176f,0.016841f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.048626f,-0.998176f,0.016841f,0.0f,
-			0.051467f,-0.998171f,-0.002981f,0.0f,
-			0.399962f,-0.742544f,0.372699f,0.0f,
-			0.551682f,-0.594040f,0.556772f,0.0f,
-			0.723155f,-0.593293f,0.303079f,0.0f,
-			0.723155f,-0.593293f,0.303079f,0.0f,
-			0.512537f,-0.742007f,0.190952f,0.0f,
-			0.399962f,-0.742544f,0.372699f,0.0f,
-			0.120715f,-0.981420f,0.112346f,0.0f,
-			0.399962f,-0.742544f,0.372699f,0.0f,
-			0.512537f,-0.742007f,0.190952f,0.0f,
-			0.512537f,-0.742007f,0.190952f,0.0f,
-			0.154866f,-0.981330f,0.057546f,0.0f,
-			0.120715f,-0.981420f,0.112346f,0.0f,
-			0.038351f,-0.998186f,0.034138f,0.0f,
-			0.120715f,-0.981420f,0.112346f,0.0f,
-			0.154866f,-0.981330f,0.057546f,0.0f,
-			0.154866f,-0.981330f,0.057546f,0.0f,
-			0.048626f,-0.998176f,0.016841f,0.0f,
-			0.038351f,-0.998186f,0.034138f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.038351f,-0.998186f,0.034138f,0.0f,
-			0.048626f,-0.998176f,0.016841f,0.0f,
-			0.226914f,-0.742211f,0.497666f,0.0f,
-			0.296349f,-0.593298f,0.725860f,0.0f,
-			0.551682f,-0.594040f,0.556772f,0.0f,
-			0.551682f,-0.594040f,0.556772f,0.0f,
-			0.399962f,-0.742544f,0.372699f,0.0f,
-			0.226914f,-0.742211f,0.497666f,0.0f,
-			0.068564f,-0.981369f,0.150190f,0.0f,
-			0.226914f,-0.742211f,0.497666f,0.0f,
-			0.399962f,-0.742544f,0.372699f,0.0f,
-			0.399962f,-0.742544f,0.372699f,0.0f,
-			0.120715f,-0.981420f,0.112346f,0.0f,
-			0.068564f,-0.981369f,0.150190f,0.0f,
-			0.022386f,-0.998181f,0.046267f,0.0f,
-			0.068564f,-0.981369f,0.150190f,0.0f,
-			0.120715f,-0.981420f,0.112346f,0.0f,
-			0.120715f,-0.981420f,0.112346f,0.0f,
-			0.038351f,-0.998186f,0.034138f,0.0f,
-			0.022386f,-0.998181f,0.046267f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.022386f,-0.998181f,0.046267f,0.0f,
-			0.038351f,-0.998186f,0.034138f,0.0f,
-			0.019216f,-0.741670f,0.547337f,0.0f,
-			-0.003575f,-0.592554f,0.784987f,0.0f,
-			0.296349f,-0.593298f,0.725860f,0.0f,
-			0.296349f,-0.593298f,0.725860f,0.0f,
-			0.226914f,-0.742211f,0.497666f,0.0f,
-			0.019216f,-0.741670f,0.547337f,0.0f,
-			0.005920f,-0.981279f,0.165439f,0.0f,
-			0.019216f,-0.741670f,0.547337f,0.0f,
-			0.226914f,-0.742211f,0.497666f,0.0f,
-			0.226914f,-0.742211f,0.497666f,0.0f,
-			0.068564f,-0.981369f,0.150190f,0.0f,
-			0.005920f,-0.981279f,0.165439f,0.0f,
-			0.002981f,-0.998171f,0.051467f,0.0f,
-			0.005920f,-0.981279f,0.165439f,0.0f,
-			0.068564f,-0.981369f,0.150190f,0.0f,
-			0.068564f,-0.981369f,0.150190f,0.0f,
-			0.022386f,-0.998181f,0.046267f,0.0f,
-			0.002981f,-0.998171f,0.051467f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.002981f,-0.998171f,0.051467f,0.0f,
-			0.022386f,-0.998181f,0.046267f,0.0f,
-			-0.190952f,-0.742001f,0.512541f,0.0f,
-			-0.303075f,-0.593296f,0.723153f,0.0f,
-			-0.003575f,-0.592554f,0.784987f,0.0f,
-			-0.003575f,-0.592554f,0.784987f,0.0f,
-			0.019216f,-0.741670f,0.547337f,0.0f,
-			-0.190952f,-0.742001f,0.512541f,0.0f,
-			-0.057547f,-0.981330f,0.154866f,0.0f,
-			-0.190952f,-0.742001f,0.512541f,0.0f,
-			0.019216f,-0.741670f,0.547337f,0.0f,
-			0.019216f,-0.741670f,0.547337f,0.0f,
-			0.005920f,-0.981279f,0.165439f,0.0f,
-			-0.057547f,-0.981330f,0.154866f,0.0f,
-			-0.016841f,-0.998176f,0.048626f,0.0f,
-			-0.057547f,-0.981330f,0.154866f,0.0f,
-			0.005920f,-0.981279f,0.165439f,0.0f,
-			0.005920f,-0.981279f,0.165439f,0.0f,
-			0.002981f,-0.998171f,0.051467f,0.0f,
-			-0.016841f,-0.998176f,0.048626f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.016841f,-0.998176f,0.048626f,0.0f,
-			0.002981f,-0.998171f,0.051467f,0.0f,
-			-0.372697f,-0.742544f,0.399963f,0.0f,
-			-0.556769f,-0.594043f,0.551681f,0.0f,
-			-0.303075f,-0.593296f,0.723153f,0.0f,
-			-0.303075f,-0.593296f,0.723153f,0.0f,
-			-0.190952f,-0.742001f,0.512541f,0.0f,
-			-0.372697f,-0.742544f,0.399963f,0.0f,
-			-0.112346f,-0.981420f,0.120715f,0.0f,
-			-0.372697f,-0.742544f,0.399963f,0.0f,
-			-0.190952f,-0.742001f,0.512541f,0.0f,
-			-0.190952f,-0.742001f,0.512541f,0.0f,
-			-0.057547f,-0.981330f,0.154866f,0.0f,
-			-0.112346f,-0.981420f,0.120715f,0.0f,
-			-0.034139f,-0.998186f,0.038351f,0.0f,
-			-0.112346f,-0.981420f,0.120715f,0.0f,
-			-0.057547f,-0.981330f,0.154866f,0.0f,
-			-0.057547f,-0.981330f,0.154866f,0.0f,
-			-0.016841f,-0.998176f,0.048626f,0.0f,
-			-0.034139f,-0.998186f,0.038351f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.034139f,-0.998186f,0.038351f,0.0f,
-			-0.016841f,-0.998176f,0.048626f,0.0f,
-			-0.497660f,-0.742219f,0.226912f,0.0f,
-			-0.725859f,-0.593301f,0.296348f,0.0f,
-			-0.556769f,-0.594043f,0.551681f,0.0f,
-			-0.556769f,-0.594043f,0.551681f,0.0f,
-			-0.372697f,-0.742544f,0.399963f,0.0f,
-			-0.497660f,-0.742219f,0.226912f,0.0f,
-			-0.150190f,-0.981369f,0.068564f,0.0f,
-			-0.497660f,-0.742219f,0.226912f,0.0f,
-			-0.372697f,-0.742544f,0.399963f,0.0f,
-			-0.372697f,-0.742544f,0.399963f,0.0f,
-			-0.112346f,-0.981420f,0.120715f,0.0f,
-			-0.150190f,-0.981369f,0.068564f,0.0f,
-			-0.046267f,-0.998181f,0.022386f,0.0f,
-			-0.150190f,-0.981369f,0.068564f,0.0f,
-			-0.112346f,-0.981420f,0.120715f,0.0f,
-			-0.112346f,-0.981420f,0.120715f,0.0f,
-			-0.034139f,-0.998186f,0.038351f,0.0f,
-			-0.046267f,-0.998181f,0.022386f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.046267f,-0.998181f,0.022386f,0.0f,
-			-0.034139f,-0.998186f,0.038351f,0.0f,
-			-0.547334f,-0.741675f,0.019214f,0.0f,
-			-0.784980f,-0.592565f,-0.003573f,0.0f,
-			-0.725859f,-0.593301f,0.296348f,0.0f,
-			-0.725859f,-0.593301f,0.296348f,0.0f,
-			-0.497660f,-0.742219f,0.226912f,0.0f,
-			-0.547334f,-0.741675f,0.019214f,0.0f,
-			-0.165439f,-0.981279f,0.005920f,0.0f,
-			-0.547334f,-0.741675f,0.019214f,0.0f,
-			-0.497660f,-0.742219f,0.226912f,0.0f,
-			-0.497660f,-0.742219f,0.226912f,0.0f,
-			-0.150190f,-0.981369f,0.068564f,0.0f,
-			-0.165439f,-0.981279f,0.005920f,0.0f,
-			-0.051467f,-0.998171f,0.002981f,0.0f,
-			-0.165439f,-0.981279f,0.005920f,0.0f,
-			-0.150190f,-0.981369f,0.068564f,0.0f,
-			-0.150190f,-0.981369f,0.068564f,0.0f,
-			-0.046267f,-0.998181f,0.022386f,0.0f,
-			-0.051467f,-0.998171f,0.002981f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.051467f,-0.998171f,0.002981f,0.0f,
-			-0.046267f,-0.998181f,0.022386f,0.0f,
-			-0.512532f,-0.742017f,-0.190948f,0.0f,
-			-0.723144f,-0.593314f,-0.303071f,0.0f,
-			-0.784980f,-0.592565f,-0.003573f,0.0f,
-			-0.784980f,-0.592565f,-0.003573f,0.0f,
-			-0.547334f,-0.741675f,0.019214f,0.0f,
-			-0.512532f,-0.742017f,-0.190948f,0.0f,
-			-0.154866f,-0.981330f,-0.057547f,0.0f,
-			-0.512532f,-0.742017f,-0.190948f,0.0f,
-			-0.547334f,-0.741675f,0.019214f,0.0f,
-			-0.547334f,-0.741675f,0.019214f,0.0f,
-			-0.165439f,-0.981279f,0.005920f,0.0f,
-			-0.154866f,-0.981330f,-0.057547f,0.0f,
-			-0.048626f,-0.998176f,-0.016841f,0.0f,
-			-0.154866f,-0.981330f,-0.057547f,0.0f,
-			-0.165439f,-0.981279f,0.005920f,0.0f,
-			-0.165439f,-0.981279f,0.005920f,0.0f,
-			-0.051467f,-0.998171f,0.002981f,0.0f,
-			-0.048626f,-0.998176f,-0.016841f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.048626f,-0.998176f,-0.016841f,0.0f,
-			-0.051467f,-0.998171f,0.002981f,0.0f,
-			-0.399955f,-0.742563f,-0.372691f,0.0f,
-			-0.551683f,-0.594040f,-0.556773f,0.0f,
-			-0.723144f,-0.593314f,-0.303071f,0.0f,
-			-0.723144f,-0.593314f,-0.303071f,0.0f,
-			-0.512532f,-0.742017f,-0.190948f,0.0f,
-			-0.399955f,-0.742563f,-0.372691f,0.0f,
-			-0.120716f,-0.981419f,-0.112347f,0.0f,
-			-0.399955f,-0.742563f,-0.372691f,0.0f,
-			-0.512532f,-0.742017f,-0.190948f,0.0f,
-			-0.512532f,-0.742017f,-0.190948f,0.0f,
-			-0.154866f,-0.981330f,-0.057547f,0.0f,
-			-0.120716f,-0.981419f,-0.112347f,0.0f,
-			-0.038351f,-0.998186f,-0.034138f,0.0f,
-			-0.120716f,-0.981419f,-0.112347f,0.0f,
-			-0.154866f,-0.981330f,-0.057547f,0.0f,
-			-0.154866f,-0.981330f,-0.057547f,0.0f,
-			-0.048626f,-0.998176f,-0.016841f,0.0f,
-			-0.038351f,-0.998186f,-0.034138f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.038351f,-0.998186f,-0.034138f,0.0f,
-			-0.048626f,-0.998176f,-0.016841f,0.0f,
-			-0.226914f,-0.742212f,-0.497664f,0.0f,
-			-0.296352f,-0.593288f,-0.725867f,0.0f,
-			-0.551683f,-0.594040f,-0.556773f,0.0f,
-			-0.551683f,-0.594040f,-0.556773f,0.0f,
-			-0.399955f,-0.742563f,-0.372691f,0.0f,
-			-0.226914f,-0.742212f,-0.497664f,0.0f,
-			-0.068564f,-0.981369f,-0.150190f,0.0f,
-			-0.226914f,-0.742212f,-0.497664f,0.0f,
-			-0.399955f,-0.742563f,-0.372691f,0.0f,
-			-0.399955f,-0.742563f,-0.372691f,0.0f,
-			-0.120716f,-0.981419f,-0.112347f,0.0f,
-			-0.068564f,-0.981369f,-0.150190f,0.0f,
-			-0.022386f,-0.998181f,-0.046267f,0.0f,
-			-0.068564f,-0.981369f,-0.150190f,0.0f,
-			-0.120716f,-0.981419f,-0.112347f,0.0f,
-			-0.120716f,-0.981419f,-0.112347f,0.0f,
-			-0.038351f,-0.998186f,-0.034138f,0.0f,
-			-0.022386f,-0.998181f,-0.046267f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.022386f,-0.998181f,-0.046267f,0.0f,
-			-0.038351f,-0.998186f,-0.034138f,0.0f,
-			-0.019216f,-0.741668f,-0.547336f,0.0f,
-			0.003574f,-0.592553f,-0.784988f,0.0f,
-			-0.296352f,-0.593288f,-0.725867f,0.0f,
-			-0.296352f,-0.593288f,-0.725867f,0.0f,
-			-0.226914f,-0.742212f,-0.497664f,0.0f,
-			-0.019216f,-0.741668f,-0.547336f,0.0f,
-			-0.005920f,-0.981280f,-0.165438f,0.0f,
-			-0.019216f,-0.741668f,-0.547336f,0.0f,
-			-0.226914f,-0.742212f,-0.497664f,0.0f,
-			-0.226914f,-0.742212f,-0.497664f,0.0f,
-			-0.068564f,-0.981369f,-0.150190f,0.0f,
-			-0.005920f,-0.981280f,-0.165438f,0.0f,
-			-0.002981f,-0.998171f,-0.051467f,0.0f,
-			-0.005920f,-0.981280f,-0.165438f,0.0f,
-			-0.068564f,-0.981369f,-0.150190f,0.0f,
-			-0.068564f,-0.981369f,-0.150190f,0.0f,
-			-0.022386f,-0.998181f,-0.046267f,0.0f,
-			-0.002981f,-0.998171f,-0.051467f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			-0.002981f,-0.998171f,-0.051467f,0.0f,
-			-0.022386f,-0.998181f,-0.046267f,0.0f,
-			0.190952f,-0.742005f,-0.512538f,0.0f,
-			0.303076f,-0.593300f,-0.723152f,0.0f,
-			0.003574f,-0.592553f,-0.784988f,0.0f,
-			0.003574f,-0.592553f,-0.784988f,0.0f,
-			-0.019216f,-0.741668f,-0.547336f,0.0f,
-			0.190952f,-0.742005f,-0.512538f,0.0f,
-			0.057546f,-0.981330f,-0.154865f,0.0f,
-			0.190952f,-0.742005f,-0.512538f,0.0f,
-			-0.019216f,-0.741668f,-0.547336f,0.0f,
-			-0.019216f,-0.741668f,-0.547336f,0.0f,
-			-0.005920f,-0.981280f,-0.165438f,0.0f,
-			0.057546f,-0.981330f,-0.154865f,0.0f,
-			0.016841f,-0.998176f,-0.048626f,0.0f,
-			0.057546f,-0.981330f,-0.154865f,0.0f,
-			-0.005920f,-0.981280f,-0.165438f,0.0f,
-			-0.005920f,-0.981280f,-0.165438f,0.0f,
-			-0.002981f,-0.998171f,-0.051467f,0.0f,
-			0.016841f,-0.998176f,-0.048626f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.016841f,-0.998176f,-0.048626f,0.0f,
-			-0.002981f,-0.998171f,-0.051467f,0.0f,
-			0.372694f,-0.742557f,-0.399958f,0.0f,
-			0.556771f,-0.594043f,-0.551683f,0.0f,
-			0.303076f,-0.593300f,-0.723152f,0.0f,
-			0.303076f,-0.593300f,-0.723152f,0.0f,
-			0.190952f,-0.742005f,-0.512538f,0.0f,
-			0.372694f,-0.742557f,-0.399958f,0.0f,
-			0.112347f,-0.981419f,-0.120716f,0.0f,
-			0.372694f,-0.742557f,-0.399958f,0.0f,
-			0.190952f,-0.742005f,-0.512538f,0.0f,
-			0.190952f,-0.742005f,-0.512538f,0.0f,
-			0.057546f,-0.981330f,-0.154865f,0.0f,
-			0.112347f,-0.981419f,-0.120716f,0.0f,
-			0.034138f,-0.998186f,-0.038351f,0.0f,
-			0.112347f,-0.981419f,-0.120716f,0.0f,
-			0.057546f,-0.981330f,-0.154865f,0.0f,
-			0.057546f,-0.981330f,-0.154865f,0.0f,
-			0.016841f,-0.998176f,-0.048626f,0.0f,
-			0.034138f,-0.998186f,-0.038351f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.034138f,-0.998186f,-0.038351f,0.0f,
-			0.016841f,-0.998176f,-0.048626f,0.0f,
-			0.497663f,-0.742215f,-0.226912f,0.0f,
-			0.725863f,-0.593296f,-0.296351f,0.0f,
-			0.556771f,-0.594043f,-0.551683f,0.0f,
-			0.556771f,-0.594043f,-0.551683f,0.0f,
-			0.372694f,-0.742557f,-0.399958f,0.0f,
-			0.497663f,-0.742215f,-0.226912f,0.0f,
-			0.150191f,-0.981369f,-0.068565f,0.0f,
-			0.497663f,-0.742215f,-0.226912f,0.0f,
-			0.372694f,-0.742557f,-0.399958f,0.0f,
-			0.372694f,-0.742557f,-0.399958f,0.0f,
-			0.112347f,-0.981419f,-0.120716f,0.0f,
-			0.150191f,-0.981369f,-0.068565f,0.0f,
-			0.046267f,-0.998181f,-0.022386f,0.0f,
-			0.150191f,-0.981369f,-0.068565f,0.0f,
-			0.112347f,-0.981419f,-0.120716f,0.0f,
-			0.112347f,-0.981419f,-0.120716f,0.0f,
-			0.034138f,-0.998186f,-0.038351f,0.0f,
-			0.046267f,-0.998181f,-0.022386f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.046267f,-0.998181f,-0.022386f,0.0f,
-			0.034138f,-0.998186f,-0.038351f,0.0f,
-			0.547330f,-0.741682f,-0.019216f,0.0f,
-			0.784982f,-0.592564f,0.003573f,0.0f,
-			0.725863f,-0.593296f,-0.296351f,0.0f,
-			0.725863f,-0.593296f,-0.296351f,0.0f,
-			0.497663f,-0.742215f,-0.226912f,0.0f,
-			0.547330f,-0.741682f,-0.019216f,0.0f,
-			0.165439f,-0.981279f,-0.005920f,0.0f,
-			0.547330f,-0.741682f,-0.019216f,0.0f,
-			0.497663f,-0.742215f,-0.226912f,0.0f,
-			0.497663f,-0.742215f,-0.226912f,0.0f,
-			0.150191f,-0.981369f,-0.068565f,0.0f,
-			0.165439f,-0.981279f,-0.005920f,0.0f,
-			0.051467f,-0.998171f,-0.002981f,0.0f,
-			0.165439f,-0.981279f,-0.005920f,0.0f,
-			0.150191f,-0.981369f,-0.068565f,0.0f,
-			0.150191f,-0.981369f,-0.068565f,0.0f,
-			0.046267f,-0.998181f,-0.022386f,0.0f,
-			0.051467f,-0.998171f,-0.002981f,0.0f,
-			0.000000f,-0.999876f,0.000000f,0.0f,
-			0.051467f,-0.998171f,-0.002981f,0.0f,
-			0.046267f,-0.998181f,-0.022386f,0.0f,
-			0.032727f,-0.785731f,0.503698f,0.0f,
-			0.006136f,-0.720608f,0.605340f,0.0f,
-			0.007583f,-0.979216f,0.067137f,0.0f,
-			0.007583f,-0.979216f,0.067137f,0.0f,
-			0.039700f,-0.978083f,-0.001795f,0.0f,
-			0.032727f,-0.785731f,0.503698f,0.0f,
-			0.150993f,-0.757940f,0.510657f,0.0f,
-			0.032727f,-0.785731f,0.503698f,0.0f,
-			0.039700f,-0.978083f,-0.001795f,0.0f,
-			0.039700f,-0.978083f,-0.001795f,0.0f,
-			0.185807f,-0.953440f,-0.002488f,0.0f,
-			0.150993f,-0.757940f,0.510657f,0.0f,
-			0.426602f,-0.548370f,0.537286f,0.0f,
-			0.150993f,-0.757940f,0.510657f,0.0f,
-			0.185807f,-0.953440f,-0.002488f,0.0f,
-			0.185807f,-0.953440f,-0.002488f,0.0f,
-			0.573742f,-0.696994f,0.000582f,0.0f,
-			0.426602f,-0.548370f,0.537286f,0.0f,
-			0.678787f,-0.130066f,0.561946f,0.0f,
-			0.426602f,-0.548370f,0.537286f,0.0f,
-			0.573742f,-0.696994f,0.000582f,0.0f,
-			0.573742f,-0.696994f,0.000582f,0.0f,
-			0.898621f,-0.140759f,-0.003091f,0.0f,
-			0.678787f,-0.130066f,0.561946f,0.0f,
-			-0.009268f,0.001837f,0.806899f,0.0f,
-			-0.002043f,0.197643f,0.806776f,0.0f,
-			0.006136f,-0.720608f,0.605340f,0.0f,
-			0.006136f,-0.720608f,0.605340f,0.0f,
-			0.032727f,-0.785731f,0.503698f,0.0f,
-			-0.009268f,0.001837f,0.806899f,0.0f,
-			-0.032105f,-0.009261f,0.818743f,0.0f,
-			-0.009268f,0.001837f,0.806899f,0.0f,
-			0.032727f,-0.785731f,0.503698f,0.0f,
-			0.032727f,-0.785731f,0.503698f,0.0f,
-			0.150993f,-0.757940f,0.510657f,0.0f,
-			-0.032105f,-0.009261f,0.818743f,0.0f,
-			-0.050278f,-0.056414f,0.846356f,0.0f,
-			-0.032105f,-0.009261f,0.818743f,0.0f,
-			0.150993f,-0.757940f,0.510657f,0.0f,
-			0.150993f,-0.757940f,0.510657f,0.0f,
-			0.426602f,-0.548370f,0.537286f,0.0f,
-			-0.050278f,-0.056414f,0.846356f,0.0f,
-			-0.008762f,-0.052782f,0.869390f,0.0f,
-			-0.050278f,-0.056414f,0.846356f,0.0f,
-			0.426602f,-0.548370f,0.537286f,0.0f,
-			0.426602f,-0.548370f,0.537286f,0.0f,
-			0.678787f,-0.130066f,0.561946f,0.0f,
-			-0.008762f,-0.052782f,0.869390f,0.0f,
-			-0.046792f,0.781373f,0.505594f,0.0f,
-			-0.008906f,0.849484f,0.404045f,0.0f,
-			-0.002043f,0.197643f,0.806776f,0.0f,
-			-0.002043f,0.197643f,0.806776f,0.0f,
-			-0.009268f,0.001837f,0.806899f,0.0f,
-			-0.046792f,0.781373f,0.505594f,0.0f,
-			-0.208115f,0.732918f,0.518949f,0.0f,
-			-0.046792f,0.781373f,0.505594f,0.0f,
-			-0.009268f,0.001837f,0.806899f,0.0f,
-			-0.009268f,0.001837f,0.806899f,0.0f,
-			-0.032105f,-0.009261f,0.818743f,0.0f,
-			-0.208115f,0.732918f,0.518949f,0.0f,
-			-0.515141f,0.457239f,0.547008f,0.0f,
-			-0.208115f,0.732918f,0.518949f,0.0f,
-			-0.032105f,-0.009261f,0.818743f,0.0f,
-			-0.032105f,-0.009261f,0.818743f,0.0f,
-			-0.050278f,-0.056414f,0.846356f,0.0f,
-			-0.515141f,0.457239f,0.547008f,0.0f,
-			-0.697157f,0.038894f,0.565345f,0.0f,
-			-0.515141f,0.457239f,0.547008f,0.0f,
-			-0.050278f,-0.056414f,0.846356f,0.0f,
-			-0.050278f,-0.056414f,0.846356f,0.0f,
-			-0.008762f,-0.052782f,0.869390f,0.0f,
-			-0.697157f,0.038894f,0.565345f,0.0f,
-			-0.055646f,0.976470f,0.000896f,0.0f,
-			-0.010370f,0.979206f,-0.067249f,0.0f,
-			-0.008906f,0.849484f,0.404045f,0.0f,
-			-0.008906f,0.849484f,0.404045f,0.0f,
-			-0.046792f,0.781373f,0.505594f,0.0f,
-			-0.055646f,0.976470f,0.000896f,0.0f,
-			-0.256713f,0.927566f,-0.001001f,0.0f,
-			-0.055646f,0.976470f,0.000896f,0.0f,
-			-0.046792f,0.781373f,0.505594f,0.0f,
-			-0.046792f,0.781373f,0.505594f,0.0f,
-			-0.208115f,0.732918f,0.518949f,0.0f,
-			-0.256713f,0.927566f,-0.001001f,0.0f,
-			-0.659135f,0.607026f,-0.002385f,0.0f,
-			-0.256713f,0.927566f,-0.001001f,0.0f,
-			-0.208115f,0.732918f,0.518949f,0.0f,
-			-0.208115f,0.732918f,0.518949f,0.0f,
-			-0.515141f,0.457239f,0.547008f,0.0f,
-			-0.659135f,0.607026f,-0.002385f,0.0f,
-			-0.926463f,0.070936f,0.001854f,0.0f,
-			-0.659135f,0.607026f,-0.002385f,0.0f,
-			-0.515141f,0.457239f,0.547008f,0.0f,
-			-0.515141f,0.457239f,0.547008f,0.0f,
-			-0.697157f,0.038894f,0.565345f,0.0f,
-			-0.926463f,0.070936f,0.001854f,0.0f,
-			-0.039667f,0.783777f,-0.504971f,0.0f,
-			-0.007263f,0.720503f,-0.605356f,0.0f,
-			-0.010370f,0.979206f,-0.067249f,0.0f,
-			-0.010370f,0.979206f,-0.067249f,0.0f,
-			-0.055646f,0.976470f,0.000896f,0.0f,
-			-0.039667f,0.783777f,-0.504971f,0.0f,
-			-0.183116f,0.740421f,-0.518751f,0.0f,
-			-0.039667f,0.783777f,-0.504971f,0.0f,
-			-0.055646f,0.976470f,0.000896f,0.0f,
-			-0.055646f,0.976470f,0.000896f,0.0f,
-			-0.256713f,0.927566f,-0.001001f,0.0f,
-			-0.183116f,0.740421f,-0.518751f,0.0f,
-			-0.476662f,0.498256f,-0.549300f,0.0f,
-			-0.183116f,0.740421f,-0.518751f,0.0f,
-			-0.256713f,0.927566f,-0.001001f,0.0f,
-			-0.256713f,0.927566f,-0.001001f,0.0f,
-			-0.659135f,0.607026f,-0.002385f,0.0f,
-			-0.476662f,0.498256f,-0.549300f,0.0f,
-			-0.697190f,0.077679f,-0.566650f,0.0f,
-			-0.476662f,0.498256f,-0.549300f,0.0f,
-			-0.659135f,0.607026f,-0.002385f,0.0f,
-			-0.659135f,0.607026f,-0.002385f,0.0f,
-			-0.926463f,0.070936f,0.001854f,0.0f,
-			-0.697190f,0.077679f,-0.566650f,0.0f,
-			0.006898f,-0.002527f,-0.806624f,0.0f,
-			0.001618f,-0.197521f,-0.806868f,0.0f,
-			-0.007263f,0.720503f,-0.605356f,0.0f,
-			-0.007263f,0.720503f,-0.605356f,0.0f,
-			-0.039667f,0.783777f,-0.504971f,0.0f,
-			0.006898f,-0.002527f,-0.806624f,0.0f,
-			0.023148f,0.001932f,-0.817926f,0.0f,
-			0.006898f,-0.002527f,-0.806624f,0.0f,
-			-0.039667f,0.783777f,-0.504971f,0.0f,
-			-0.039667f,0.783777f,-0.504971f,0.0f,
-			-0.183116f,0.740421f,-0.518751f,0.0f,
-			0.023148f,0.001932f,-0.817926f,0.0f,
-			0.040088f,0.039749f,-0.850657f,0.0f,
-			0.023148f,0.001932f,-0.817926f,0.0f,
-			-0.183116f,0.740421f,-0.518751f,0.0f,
-			-0.183116f,0.740421f,-0.518751f,0.0f,
-			-0.476662f,0.498256f,-0.549300f,0.0f,
-			0.040088f,0.039749f,-0.850657f,0.0f,
-			0.007795f,0.042437f,-0.871262f,0.0f,
-			0.040088f,0.039749f,-0.850657f,0.0f,
-			-0.476662f,0.498256f,-0.549300f,0.0f,
-			-0.476662f,0.498256f,-0.549300f,0.0f,
-			-0.697190f,0.077679f,-0.566650f,0.0f,
-			0.007795f,0.042437f,-0.871262f,0.0f,
-			0.034951f,-0.782964f,-0.504320f,0.0f,
-			0.006737f,-0.849370f,-0.404177f,0.0f,
-			0.001618f,-0.197521f,-0.806868f,0.0f,
-			0.001618f,-0.197521f,-0.806868f,0.0f,
-			0.006898f,-0.002527f,-0.806624f,0.0f,
-			0.034951f,-0.782964f,-0.504320f,0.0f,
-			0.160179f,-0.755047f,-0.510726f,0.0f,
-			0.034951f,-0.782964f,-0.504320f,0.0f,
-			0.006898f,-0.002527f,-0.806624f,0.0f,
-			0.006898f,-0.002527f,-0.806624f,0.0f,
-			0.023148f,0.001932f,-0.817926f,0.0f,
-			0.160179f,-0.755047f,-0.510726f,0.0f,
-			0.472515f,-0.518105f,-0.540496f,0.0f,
-			0.160179f,-0.755047f,-0.510726f,0.0f,
-			0.023148f,0.001932f,-0.817926f,0.0f,
-			0.023148f,0.001932f,-0.817926f,0.0f,
-			0.040088f,0.039749f,-0.850657f,0.0f,
-			0.472515f,-0.518105f,-0.540496f,0.0f,
-			0.687325f,-0.066125f,-0.563595f,0.0f,
-			0.472515f,-0.518105f,-0.540496f,0.0f,
-			0.040088f,0.039749f,-0.850657f,0.0f,
-			0.040088f,0.039749f,-0.850657f,0.0f,
-			0.007795f,0.042437f,-0.871262f,0.0f,
-			0.687325f,-0.066125f,-0.563595f,0.0f,
-			0.039700f,-0.978083f,-0.001795f,0.0f,
-			0.007583f,-0.979216f,0.067137f,0.0f,
-			0.006737f,-0.849370f,-0.404177f,0.0f,
-			0.006737f,-0.849370f,-0.404177f,0.0f,
-			0.034951f,-0.782964f,-0.504320f,0.0f,
-			0.039700f,-0.978083f,-0.001795f,0.0f,
-			0.185807f,-0.953440f,-0.002488f,0.0f,
-			0.039700f,-0.978083f,-0.001795f,0.0f,
-			0.034951f,-0.782964f,-0.504320f,0.0f,
-			0.034951f,-0.782964f,-0.504320f,0.0f,
-			0.160179f,-0.755047f,-0.510726f,0.0f,
-			0.185807f,-0.953440f,-0.002488f,0.0f,
-			0.573742f,-0.696994f,0.000582f,0.0f,
-			0.185807f,-0.953440f,-0.002488f,0.0f,
-			0.160179f,-0.755047f,-0.510726f,0.0f,
-			0.160179f,-0.755047f,-0.510726f,0.0f,
-			0.472515f,-0.518105f,-0.540496f,0.0f,
-			0.573742f,-0.696994f,0.000582f,0.0f,
-			0.898621f,-0.140759f,-0.003091f,0.0f,
-			0.573742f,-0.696994f,0.000582f,0.0f,
-			0.472515f,-0.518105f,-0.540496f,0.0f,
-			0.472515f,-0.518105f,-0.540496f,0.0f,
-			0.687325f,-0.066125f,-0.563595f,0.0f,
-			0.898621f,-0.140759f,-0.003091f,0.0f,
-			0.685207f,0.233257f,0.564660f,0.0f,
-			0.678787f,-0.130066f,0.561946f,0.0f,
-			0.898621f,-0.140759f,-0.003091f,0.0f,
-			0.898621f,-0.140759f,-0.003091f,0.0f,
-			0.904235f,0.310936f,-0.005013f,0.0f,
-			0.685207f,0.233257f,0.564660f,0.0f,
-			0.616751f,0.431099f,0.540367f,0.0f,
-			0.685207f,0.233257f,0.564660f,0.0f,
-			0.904235f,0.310936f,-0.005013f,0.0f,
-			0.904235f,0.310936f,-0.005013f,0.0f,
-			0.793434f,0.546084f,-0.013325f,0.0f,
-			0.616751f,0.431099f,0.540367f,0.0f,
-			0.502794f,0.597245f,0.507334f,0.0f,
-			0.616751f,0.431099f,0.540367f,0.0f,
-			0.793434f,0.546084f,-0.013325f,0.0f,
-			0.793434f,0.546084f,-0.013325f,0.0f,
-			0.624179f,0.741111f,-0.010920f,0.0f,
-			0.502794f,0.597245f,0.507334f,0.0f,
-			0.456743f,0.731746f,0.391602f,0.0f,
-			0.502794f,0.597245f,0.507334f,0.0f,
-			0.624179f,0.741111f,-0.010920f,0.0f,
-			0.624179f,0.741111f,-0.010920f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			0.456743f,0.731746f,0.391602f,0.0f,
-			0.004963f,-0.031221f,0.870363f,0.0f,
-			-0.008762f,-0.052782f,0.869390f,0.0f,
-			0.678787f,-0.130066f,0.561946f,0.0f,
-			0.678787f,-0.130066f,0.561946f,0.0f,
-			0.685207f,0.233257f,0.564660f,0.0f,
-			0.004963f,-0.031221f,0.870363f,0.0f,
-			0.004988f,-0.037257f,0.848264f,0.0f,
-			0.004963f,-0.031221f,0.870363f,0.0f,
-			0.685207f,0.233257f,0.564660f,0.0f,
-			0.685207f,0.233257f,0.564660f,0.0f,
-			0.616751f,0.431099f,0.540367f,0.0f,
-			0.004988f,-0.037257f,0.848264f,0.0f,
-			0.014644f,-0.030107f,0.814757f,0.0f,
-			0.004988f,-0.037257f,0.848264f,0.0f,
-			0.616751f,0.431099f,0.540367f,0.0f,
-			0.616751f,0.431099f,0.540367f,0.0f,
-			0.502794f,0.597245f,0.507334f,0.0f,
-			0.014644f,-0.030107f,0.814757f,0.0f,
-			0.101125f,0.163148f,0.797063f,0.0f,
-			0.014644f,-0.030107f,0.814757f,0.0f,
-			0.502794f,0.597245f,0.507334f,0.0f,
-			0.502794f,0.597245f,0.507334f,0.0f,
-			0.456743f,0.731746f,0.391602f,0.0f,
-			0.101125f,0.163148f,0.797063f,0.0f,
-			-0.656885f,-0.279607f,0.564760f,0.0f,
-			-0.697157f,0.038894f,0.565345f,0.0f,
-			-0.008762f,-0.052782f,0.869390f,0.0f,
-			-0.008762f,-0.052782f,0.869390f,0.0f,
-			0.004963f,-0.031221f,0.870363f,0.0f,
-			-0.656885f,-0.279607f,0.564760f,0.0f,
-			-0.549719f,-0.483437f,0.544933f,0.0f,
-			-0.656885f,-0.279607f,0.564760f,0.0f,
-			0.004963f,-0.031221f,0.870363f,0.0f,
-			0.004963f,-0.031221f,0.870363f,0.0f,
-			0.004988f,-0.037257f,0.848264f,0.0f,
-			-0.549719f,-0.483437f,0.544933f,0.0f,
-			-0.436573f,-0.626877f,0.516333f,0.0f,
-			-0.549719f,-0.483437f,0.544933f,0.0f,
-			0.004988f,-0.037257f,0.848264f,0.0f,
-			0.004988f,-0.037257f,0.848264f,0.0f,
-			0.014644f,-0.030107f,0.814757f,0.0f,
-			-0.436573f,-0.626877f,0.516333f,0.0f,
-			-0.353325f,-0.627354f,0.602708f,0.0f,
-			-0.436573f,-0.626877f,0.516333f,0.0f,
-			0.014644f,-0.030107f,0.814757f,0.0f,
-			0.014644f,-0.030107f,0.814757f,0.0f,
-			0.101125f,0.163148f,0.797063f,0.0f,
-			-0.353325f,-0.627354f,0.602708f,0.0f,
-			-0.879746f,-0.356006f,0.003695f,0.0f,
-			-0.926463f,0.070936f,0.001854f,0.0f,
-			-0.697157f,0.038894f,0.565345f,0.0f,
-			-0.697157f,0.038894f,0.565345f,0.0f,
-			-0.656885f,-0.279607f,0.564760f,0.0f,
-			-0.879746f,-0.356006f,0.003695f,0.0f,
-			-0.724507f,-0.630504f,0.010103f,0.0f,
-			-0.879746f,-0.356006f,0.003695f,0.0f,
-			-0.656885f,-0.279607f,0.564760f,0.0f,
-			-0.656885f,-0.279607f,0.564760f,0.0f,
-			-0.549719f,-0.483437f,0.544933f,0.0f,
-			-0.724507f,-0.630504f,0.010103f,0.0f,
-			-0.553288f,-0.798607f,0.007897f,0.0f,
-			-0.724507f,-0.630504f,0.010103f,0.0f,
-			-0.549719f,-0.483437f,0.544933f,0.0f,
-			-0.549719f,-0.483437f,0.544933f,0.0f,
-			-0.436573f,-0.626877f,0.516333f,0.0f,
-			-0.553288f,-0.798607f,0.007897f,0.0f,
-			-0.471428f,-0.858279f,0.072047f,0.0f,
-			-0.553288f,-0.798607f,0.007897f,0.0f,
-			-0.436573f,-0.626877f,0.516333f,0.0f,
-			-0.436573f,-0.626877f,0.516333f,0.0f,
-			-0.353325f,-0.627354f,0.602708f,0.0f,
-			-0.471428f,-0.858279f,0.072047f,0.0f,
-			-0.674209f,-0.251693f,-0.565247f,0.0f,
-			-0.697190f,0.077679f,-0.566650f,0.0f,
-			-0.926463f,0.070936f,0.001854f,0.0f,
-			-0.926463f,0.070936f,0.001854f,0.0f,
-			-0.879746f,-0.356006f,0.003695f,0.0f,
-			-0.674209f,-0.251693f,-0.565247f,0.0f,
-			-0.576715f,-0.477308f,-0.544396f,0.0f,
-			-0.674209f,-0.251693f,-0.565247f,0.0f,
-			-0.879746f,-0.356006f,0.003695f,0.0f,
-			-0.879746f,-0.356006f,0.003695f,0.0f,
-			-0.724507f,-0.630504f,0.010103f,0.0f,
-			-0.576715f,-0.477308f,-0.544396f,0.0f,
-			-0.452956f,-0.631902f,-0.515217f,0.0f,
-			-0.576715f,-0.477308f,-0.544396f,0.0f,
-			-0.724507f,-0.630504f,0.010103f,0.0f,
-			-0.724507f,-0.630504f,0.010103f,0.0f,
-			-0.553288f,-0.798607f,0.007897f,0.0f,
-			-0.452956f,-0.631902f,-0.515217f,0.0f,
-			-0.413198f,-0.748471f,-0.402256f,0.0f,
-			-0.452956f,-0.631902f,-0.515217f,0.0f,
-			-0.553288f,-0.798607f,0.007897f,0.0f,
-			-0.553288f,-0.798607f,0.007897f,0.0f,
-			-0.471428f,-0.858279f,0.072047f,0.0f,
-			-0.413198f,-0.748471f,-0.402256f,0.0f,
-			-0.002134f,0.025354f,-0.870648f,0.0f,
-			0.007795f,0.042437f,-0.871262f,0.0f,
-			-0.697190f,0.077679f,-0.566650f,0.0f,
-			-0.697190f,0.077679f,-0.566650f,0.0f,
-			-0.674209f,-0.251693f,-0.565247f,0.0f,
-			-0.002134f,0.025354f,-0.870648f,0.0f,
-			0.005304f,0.026281f,-0.849114f,0.0f,
-			-0.002134f,0.025354f,-0.870648f,0.0f,
-			-0.674209f,-0.251693f,-0.565247f,0.0f,
-			-0.674209f,-0.251693f,-0.565247f,0.0f,
-			-0.576715f,-0.477308f,-0.544396f,0.0f,
-			0.005304f,0.026281f,-0.849114f,0.0f,
-			-0.001253f,0.024171f,-0.816765f,0.0f,
-			0.005304f,0.026281f,-0.849114f,0.0f,
-			-0.576715f,-0.477308f,-0.544396f,0.0f,
-			-0.576715f,-0.477308f,-0.544396f,0.0f,
-			-0.452956f,-0.631902f,-0.515217f,0.0f,
-			-0.001253f,0.024171f,-0.816765f,0.0f,
-			-0.089758f,-0.162191f,-0.802235f,0.0f,
-			-0.001253f,0.024171f,-0.816765f,0.0f,
-			-0.452956f,-0.631902f,-0.515217f,0.0f,
-			-0.452956f,-0.631902f,-0.515217f,0.0f,
-			-0.413198f,-0.748471f,-0.402256f,0.0f,
-			-0.089758f,-0.162191f,-0.802235f,0.0f,
-			0.674641f,0.246963f,-0.564633f,0.0f,
-			0.687325f,-0.066125f,-0.563595f,0.0f,
-			0.007795f,0.042437f,-0.871262f,0.0f,
-			0.007795f,0.042437f,-0.871262f,0.0f,
-			-0.002134f,0.025354f,-0.870648f,0.0f,
-			0.674641f,0.246963f,-0.564633f,0.0f,
-			0.592724f,0.434624f,-0.542926f,0.0f,
-			0.674641f,0.246963f,-0.564633f,0.0f,
-			-0.002134f,0.025354f,-0.870648f,0.0f,
-			-0.002134f,0.025354f,-0.870648f,0.0f,
-			0.005304f,0.026281f,-0.849114f,0.0f,
-			0.592724f,0.434624f,-0.542926f,0.0f,
-			0.474246f,0.599665f,-0.512078f,0.0f,
-			0.592724f,0.434624f,-0.542926f,0.0f,
-			0.005304f,0.026281f,-0.849114f,0.0f,
-			0.005304f,0.026281f,-0.849114f,0.0f,
-			-0.001253f,0.024171f,-0.816765f,0.0f,
-			0.474246f,0.599665f,-0.512078f,0.0f,
-			0.374516f,0.617356f,-0.598549f,0.0f,
-			0.474246f,0.599665f,-0.512078f,0.0f,
-			-0.001253f,0.024171f,-0.816765f,0.0f,
-			-0.001253f,0.024171f,-0.816765f,0.0f,
-			-0.089758f,-0.162191f,-0.802235f,0.0f,
-			0.374516f,0.617356f,-0.598549f,0.0f,
-			0.904235f,0.310936f,-0.005013f,0.0f,
-			0.898621f,-0.140759f,-0.003091f,0.0f,
-			0.687325f,-0.066125f,-0.563595f,0.0f,
-			0.687325f,-0.066125f,-0.563595f,0.0f,
-			0.674641f,0.246963f,-0.564633f,0.0f,
-			0.904235f,0.310936f,-0.005013f,0.0f,
-			0.793434f,0.546084f,-0.013325f,0.0f,
-			0.904235f,0.310936f,-0.005013f,0.0f,
-			0.674641f,0.246963f,-0.564633f,0.0f,
-			0.674641f,0.246963f,-0.564633f,0.0f,
-			0.592724f,0.434624f,-0.542926f,0.0f,
-			0.793434f,0.546084f,-0.013325f,0.0f,
-			0.624179f,0.741111f,-0.010920f,0.0f,
-			0.793434f,0.546084f,-0.013325f,0.0f,
-			0.592724f,0.434624f,-0.542926f,0.0f,
-			0.592724f,0.434624f,-0.542926f,0.0f,
-			0.474246f,0.599665f,-0.512078f,0.0f,
-			0.624179f,0.741111f,-0.010920f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			0.624179f,0.741111f,-0.010920f,0.0f,
-			0.474246f,0.599665f,-0.512078f,0.0f,
-			0.474246f,0.599665f,-0.512078f,0.0f,
-			0.374516f,0.617356f,-0.598549f,0.0f,
-			-0.467012f,0.233069f,-0.023596f,0.0f,
-			-0.290890f,0.616099f,0.587914f,0.0f,
-			-0.122353f,0.589025f,0.708091f,0.0f,
-			-0.219759f,0.924929f,0.095945f,0.0f,
-			-0.219759f,0.924929f,0.095945f,0.0f,
-			-0.489384f,0.763448f,-0.008603f,0.0f,
-			-0.290890f,0.616099f,0.587914f,0.0f,
-			-0.551143f,0.435061f,0.571278f,0.0f,
-			-0.290890f,0.616099f,0.587914f,0.0f,
-			-0.489384f,0.763448f,-0.008603f,0.0f,
-			-0.489384f,0.763448f,-0.008603f,0.0f,
-			-0.828637f,0.467755f,0.012686f,0.0f,
-			-0.551143f,0.435061f,0.571278f,0.0f,
-			-0.553882f,0.377220f,0.598476f,0.0f,
-			-0.551143f,0.435061f,0.571278f,0.0f,
-			-0.828637f,0.467755f,0.012686f,0.0f,
-			-0.828637f,0.467755f,0.012686f,0.0f,
-			-0.815907f,0.447904f,0.038744f,0.0f,
-			-0.553882f,0.377220f,0.598476f,0.0f,
-			-0.411279f,0.547427f,0.613902f,0.0f,
-			-0.553882f,0.377220f,0.598476f,0.0f,
-			-0.815907f,0.447904f,0.038744f,0.0f,
-			-0.815907f,0.447904f,0.038744f,0.0f,
-			-0.593750f,0.686033f,0.006502f,0.0f,
-			-0.411279f,0.547427f,0.613902f,0.0f,
-			0.163832f,0.088939f,0.867626f,0.0f,
-			0.119424f,-0.128189f,0.901167f,0.0f,
-			-0.122353f,0.589025f,0.708091f,0.0f,
-			-0.122353f,0.589025f,0.708091f,0.0f,
-			-0.290890f,0.616099f,0.587914f,0.0f,
-			0.163832f,0.088939f,0.867626f,0.0f,
-			0.126320f,0.167280f,0.863929f,0.0f,
-			0.163832f,0.088939f,0.867626f,0.0f,
-			-0.290890f,0.616099f,0.587914f,0.0f,
-			-0.290890f,0.616099f,0.587914f,0.0f,
-			-0.551143f,0.435061f,0.571278f,0.0f,
-			0.126320f,0.167280f,0.863929f,0.0f,
-			0.011312f,0.126806f,0.905935f,0.0f,
-			0.126320f,0.167280f,0.863929f,0.0f,
-			-0.551143f,0.435061f,0.571278f,0.0f,
-			-0.551143f,0.435061f,0.571278f,0.0f,
-			-0.553882f,0.377220f,0.598476f,0.0f,
-			0.011312f,0.126806f,0.905935f,0.0f,
-			-0.007838f,0.120839f,0.918876f,0.0f,
-			0.011312f,0.126806f,0.905935f,0.0f,
-			-0.553882f,0.377220f,0.598476f,0.0f,
-			-0.553882f,0.377220f,0.598476f,0.0f,
-			-0.411279f,0.547427f,0.613902f,0.0f,
-			-0.007838f,0.120839f,0.918876f,0.0f,
-			0.522557f,-0.455892f,0.557148f,0.0f,
-			0.332636f,-0.710895f,0.496112f,0.0f,
-			0.119424f,-0.128189f,0.901167f,0.0f,
-			0.119424f,-0.128189f,0.901167f,0.0f,
-			0.163832f,0.088939f,0.867626f,0.0f,
-			0.522557f,-0.455892f,0.557148f,0.0f,
-			0.737465f,-0.226922f,0.538678f,0.0f,
-			0.522557f,-0.455892f,0.557148f,0.0f,
-			0.163832f,0.088939f,0.867626f,0.0f,
-			0.163832f,0.088939f,0.867626f,0.0f,
-			0.126320f,0.167280f,0.863929f,0.0f,
-			0.737465f,-0.226922f,0.538678f,0.0f,
-			0.596892f,-0.304979f,0.609450f,0.0f,
-			0.737465f,-0.226922f,0.538678f,0.0f,
-			0.126320f,0.167280f,0.863929f,0.0f,
-			0.126320f,0.167280f,0.863929f,0.0f,
-			0.011312f,0.126806f,0.905935f,0.0f,
-			0.596892f,-0.304979f,0.609450f,0.0f,
-			0.379535f,-0.487821f,0.641929f,0.0f,
-			0.596892f,-0.304979f,0.609450f,0.0f,
-			0.011312f,0.126806f,0.905935f,0.0f,
-			0.011312f,0.126806f,0.905935f,0.0f,
-			-0.007838f,0.120839f,0.918876f,0.0f,
-			0.379535f,-0.487821f,0.641929f,0.0f,
-			0.627801f,-0.659513f,0.008321f,0.0f,
-			0.392291f,-0.870062f,-0.097400f,0.0f,
-			0.332636f,-0.710895f,0.496112f,0.0f,
-			0.332636f,-0.710895f,0.496112f,0.0f,
-			0.522557f,-0.455892f,0.557148f,0.0f,
-			0.627801f,-0.659513f,0.008321f,0.0f,
-			0.890168f,-0.367645f,-0.016371f,0.0f,
-			0.627801f,-0.659513f,0.008321f,0.0f,
-			0.522557f,-0.455892f,0.557148f,0.0f,
-			0.522557f,-0.455892f,0.557148f,0.0f,
-			0.737465f,-0.226922f,0.538678f,0.0f,
-			0.890168f,-0.367645f,-0.016371f,0.0f,
-			0.782671f,-0.479251f,-0.031099f,0.0f,
-			0.890168f,-0.367645f,-0.016371f,0.0f,
-			0.737465f,-0.226922f,0.538678f,0.0f,
-			0.737465f,-0.226922f,0.538678f,0.0f,
-			0.596892f,-0.304979f,0.609450f,0.0f,
-			0.782671f,-0.479251f,-0.031099f,0.0f,
-			0.534304f,-0.758556f,-0.001654f,0.0f,
-			0.782671f,-0.479251f,-0.031099f,0.0f,
-			0.596892f,-0.304979f,0.609450f,0.0f,
-			0.596892f,-0.304979f,0.609450f,0.0f,
-			0.379535f,-0.487821f,0.641929f,0.0f,
-			0.534304f,-0.758556f,-0.001654f,0.0f,
-			0.501301f,-0.482149f,-0.552852f,0.0f,
-			0.272806f,-0.551174f,-0.697211f,0.0f,
-			0.392291f,-0.870062f,-0.097400f,0.0f,
-			0.392291f,-0.870062f,-0.097400f,0.0f,
-			0.627801f,-0.659513f,0.008321f,0.0f,
-			0.501301f,-0.482149f,-0.552852f,0.0f,
-			0.704771f,-0.221735f,-0.539007f,0.0f,
-			0.501301f,-0.482149f,-0.552852f,0.0f,
-			0.627801f,-0.659513f,0.008321f,0.0f,
-			0.627801f,-0.659513f,0.008321f,0.0f,
-			0.890168f,-0.367645f,-0.016371f,0.0f,
-			0.704771f,-0.221735f,-0.539007f,0.0f,
-			0.585866f,-0.261922f,-0.605942f,0.0f,
-			0.704771f,-0.221735f,-0.539007f,0.0f,
-			0.890168f,-0.367645f,-0.016371f,0.0f,
-			0.890168f,-0.367645f,-0.016371f,0.0f,
-			0.782671f,-0.479251f,-0.031099f,0.0f,
-			0.585866f,-0.261922f,-0.605942f,0.0f,
-			0.396606f,-0.455621f,-0.647375f,0.0f,
-			0.585866f,-0.261922f,-0.605942f,0.0f,
-			0.782671f,-0.479251f,-0.031099f,0.0f,
-			0.782671f,-0.479251f,-0.031099f,0.0f,
-			0.534304f,-0.758556f,-0.001654f,0.0f,
-			0.396606f,-0.455621f,-0.647375f,0.0f,
-			0.079856f,0.045399f,-0.870904f,0.0f,
-			0.026207f,0.149889f,-0.901358f,0.0f,
-			0.272806f,-0.551174f,-0.697211f,0.0f,
-			0.272806f,-0.551174f,-0.697211f,0.0f,
-			0.501301f,-0.482149f,-0.552852f,0.0f,
-			0.079856f,0.045399f,-0.870904f,0.0f,
-			0.140852f,0.116120f,-0.841409f,0.0f,
-			0.079856f,0.045399f,-0.870904f,0.0f,
-			0.501301f,-0.482149f,-0.552852f,0.0f,
-			0.501301f,-0.482149f,-0.552852f,0.0f,
-			0.704771f,-0.221735f,-0.539007f,0.0f,
-			0.140852f,0.116120f,-0.841409f,0.0f,
-			0.098367f,0.127311f,-0.885143f,0.0f,
-			0.140852f,0.116120f,-0.841409f,0.0f,
-			0.704771f,-0.221735f,-0.539007f,0.0f,
-			0.704771f,-0.221735f,-0.539007f,0.0f,
-			0.585866f,-0.261922f,-0.605942f,0.0f,
-			0.098367f,0.127311f,-0.885143f,0.0f,
-			0.036298f,0.140253f,-0.904680f,0.0f,
-			0.098367f,0.127311f,-0.885143f,0.0f,
-			0.585866f,-0.261922f,-0.605942f,0.0f,
-			0.585866f,-0.261922f,-0.605942f,0.0f,
-			0.396606f,-0.455621f,-0.647375f,0.0f,
-			0.036298f,0.140253f,-0.904680f,0.0f,
-			-0.350542f,0.560118f,-0.585855f,0.0f,
-			-0.165498f,0.749913f,-0.508779f,0.0f,
-			0.026207f,0.149889f,-0.901358f,0.0f,
-			0.026207f,0.149889f,-0.901358f,0.0f,
-			0.079856f,0.045399f,-0.870904f,0.0f,
-			-0.350542f,0.560118f,-0.585855f,0.0f,
-			-0.560515f,0.401673f,-0.581088f,0.0f,
-			-0.350542f,0.560118f,-0.585855f,0.0f,
-			0.079856f,0.045399f,-0.870904f,0.0f,
-			0.079856f,0.045399f,-0.870904f,0.0f,
-			0.140852f,0.116120f,-0.841409f,0.0f,
-			-0.560515f,0.401673f,-0.581088f,0.0f,
-			-0.545401f,0.415148f,-0.625843f,0.0f,
-			-0.560515f,0.401673f,-0.581088f,0.0f,
-			0.140852f,0.116120f,-0.841409f,0.0f,
-			0.140852f,0.116120f,-0.841409f,0.0f,
-			0.098367f,0.127311f,-0.885143f,0.0f,
-			-0.545401f,0.415148f,-0.625843f,0.0f,
-			-0.381767f,0.568613f,-0.624280f,0.0f,
-			-0.545401f,0.415148f,-0.625843f,0.0f,
-			0.098367f,0.127311f,-0.885143f,0.0f,
-			0.098367f,0.127311f,-0.885143f,0.0f,
-			0.036298f,0.140253f,-0.904680f,0.0f,
-			-0.381767f,0.568613f,-0.624280f,0.0f,
-			-0.489384f,0.763448f,-0.008603f,0.0f,
-			-0.219759f,0.924929f,0.095945f,0.0f,
-			-0.165498f,0.749913f,-0.508779f,0.0f,
-			-0.165498f,0.749913f,-0.508779f,0.0f,
-			-0.350542f,0.560118f,-0.585855f,0.0f,
-			-0.489384f,0.763448f,-0.008603f,0.0f,
-			-0.828637f,0.467755f,0.012686f,0.0f,
-			-0.489384f,0.763448f,-0.008603f,0.0f,
-			-0.350542f,0.560118f,-0.585855f,0.0f,
-			-0.350542f,0.560118f,-0.585855f,0.0f,
-			-0.560515f,0.401673f,-0.581088f,0.0f,
-			-0.828637f,0.467755f,0.012686f,0.0f,
-			-0.815907f,0.447904f,0.038744f,0.0f,
-			-0.828637f,0.467755f,0.012686f,0.0f,
-			-0.560515f,0.401673f,-0.581088f,0.0f,
-			-0.560515f,0.401673f,-0.581088f,0.0f,
-			-0.545401f,0.415148f,-0.625843f,0.0f,
-			-0.815907f,0.447904f,0.038744f,0.0f,
-			-0.593750f,0.686033f,0.006502f,0.0f,
-			-0.815907f,0.447904f,0.038744f,0.0f,
-			-0.545401f,0.415148f,-0.625843f,0.0f,
-			-0.545401f,0.415148f,-0.625843f,0.0f,
-			-0.381767f,0.568613f,-0.624280f,0.0f,
-			-0.593750f,0.686033f,0.006502f,0.0f,
-			-0.260192f,0.811211f,0.428934f,0.0f,
-			-0.411279f,0.547427f,0.613902f,0.0f,
-			-0.593750f,0.686033f,0.006502f,0.0f,
-			-0.593750f,0.686033f,0.006502f,0.0f,
-			-0.356119f,0.887172f,-0.019359f,0.0f,
-			-0.260192f,0.811211f,0.428934f,0.0f,
-			0.015436f,0.850700f,-0.142457f,0.0f,
-			-0.260192f,0.811211f,0.428934f,0.0f,
-			-0.356119f,0.887172f,-0.019359f,0.0f,
-			-0.356119f,0.887172f,-0.019359f,0.0f,
-			0.159016f,0.804534f,-0.108950f,0.0f,
-			0.015436f,0.850700f,-0.142457f,0.0f,
-			0.358909f,0.215875f,-0.669812f,0.0f,
-			0.015436f,0.850700f,-0.142457f,0.0f,
-			0.159016f,0.804534f,-0.108950f,0.0f,
-			0.159016f,0.804534f,-0.108950f,0.0f,
-			0.587203f,0.018382f,0.005640f,0.0f,
-			0.358909f,0.215875f,-0.669812f,0.0f,
-			0.472414f,-0.445454f,-0.642535f,0.0f,
-			0.358909f,0.215875f,-0.669812f,0.0f,
-			0.587203f,0.018382f,0.005640f,0.0f,
-			0.587203f,0.018382f,0.005640f,0.0f,
-			0.615044f,-0.628264f,0.159970f,0.0f,
-			0.472414f,-0.445454f,-0.642535f,0.0f,
-			-0.007519f,0.521367f,0.757140f,0.0f,
-			-0.007838f,0.120839f,0.918876f,0.0f,
-			-0.411279f,0.547427f,0.613902f,0.0f,
-			-0.411279f,0.547427f,0.613902f,0.0f,
-			-0.260192f,0.811211f,0.428934f,0.0f,
-			-0.007519f,0.521367f,0.757140f,0.0f,
-			-0.044867f,0.857701f,0.023942f,0.0f,
-			-0.007519f,0.521367f,0.757140f,0.0f,
-			-0.260192f,0.811211f,0.428934f,0.0f,
-			-0.260192f,0.811211f,0.428934f,0.0f,
-			0.015436f,0.850700f,-0.142457f,0.0f,
-			-0.044867f,0.857701f,0.023942f,0.0f,
-			-0.019460f,0.573848f,-0.706869f,0.0f,
-			-0.044867f,0.857701f,0.023942f,0.0f,
-			0.015436f,0.850700f,-0.142457f,0.0f,
-			0.015436f,0.850700f,-0.142457f,0.0f,
-			0.358909f,0.215875f,-0.669812f,0.0f,
-			-0.019460f,0.573848f,-0.706869f,0.0f,
-			0.068205f,0.112779f,-0.931933f,0.0f,
-			-0.019460f,0.573848f,-0.706869f,0.0f,
-			0.358909f,0.215875f,-0.669812f,0.0f,
-			0.358909f,0.215875f,-0.669812f,0.0f,
-			0.472414f,-0.445454f,-0.642535f,0.0f,
-			0.068205f,0.112779f,-0.931933f,0.0f,
-			0.411871f,-0.206764f,0.698457f,0.0f,
-			0.379535f,-0.487821f,0.641929f,0.0f,
-			-0.007838f,0.120839f,0.918876f,0.0f,
-			-0.007838f,0.120839f,0.918876f,0.0f,
-			-0.007519f,0.521367f,0.757140f,0.0f,
-			0.411871f,-0.206764f,0.698457f,0.0f,
-			0.077580f,0.674989f,0.224767f,0.0f,
-			0.411871f,-0.206764f,0.698457f,0.0f,
-			-0.007519f,0.521367f,0.757140f,0.0f,
-			-0.007519f,0.521367f,0.757140f,0.0f,
-			-0.044867f,0.857701f,0.023942f,0.0f,
-			0.077580f,0.674989f,0.224767f,0.0f,
-			-0.217974f,0.845583f,-0.395162f,0.0f,
-			0.077580f,0.674989f,0.224767f,0.0f,
-			-0.044867f,0.857701f,0.023942f,0.0f,
-			-0.044867f,0.857701f,0.023942f,0.0f,
-			-0.019460f,0.573848f,-0.706869f,0.0f,
-			-0.217974f,0.845583f,-0.395162f,0.0f,
-			-0.233990f,0.641441f,-0.649445f,0.0f,
-			-0.217974f,0.845583f,-0.395162f,0.0f,
-			-0.019460f,0.573848f,-0.706869f,0.0f,
-			-0.019460f,0.573848f,-0.706869f,0.0f,
-			0.068205f,0.112779f,-0.931933f,0.0f,
-			-0.233990f,0.641441f,-0.649445f,0.0f,
-			0.578034f,-0.605784f,-0.054449f,0.0f,
-			0.534304f,-0.758556f,-0.001654f,0.0f,
-			0.379535f,-0.487821f,0.641929f,0.0f,
-			0.379535f,-0.487821f,0.641929f,0.0f,
-			0.411871f,-0.206764f,0.698457f,0.0f,
-			0.578034f,-0.605784f,-0.054449f,0.0f,
-			0.255990f,0.313314f,0.125255f,0.0f,
-			0.578034f,-0.605784f,-0.054449f,0.0f,
-			0.411871f,-0.206764f,0.698457f,0.0f,
-			0.411871f,-0.206764f,0.698457f,0.0f,
-			0.077580f,0.674989f,0.224767f,0.0f,
-			0.255990f,0.313314f,0.125255f,0.0f,
-			-0.284837f,0.929042f,0.020350f,0.0f,
-			0.255990f,0.313314f,0.125255f,0.0f,
-			0.077580f,0.674989f,0.224767f,0.0f,
-			0.077580f,0.674989f,0.224767f,0.0f,
-			-0.217974f,0.845583f,-0.395162f,0.0f,
-			-0.284837f,0.929042f,0.020350f,0.0f,
-			-0.358008f,0.893821f,-0.094150f,0.0f,
-			-0.284837f,0.929042f,0.020350f,0.0f,
-			-0.217974f,0.845583f,-0.395162f,0.0f,
-			-0.217974f,0.845583f,-0.395162f,0.0f,
-			-0.233990f,0.641441f,-0.649445f,0.0f,
-			-0.358008f,0.893821f,-0.094150f,0.0f,
-			0.345172f,-0.131104f,-0.598269f,0.0f,
-			0.396606f,-0.455621f,-0.647375f,0.0f,
-			0.534304f,-0.758556f,-0.001654f,0.0f,
-			0.534304f,-0.758556f,-0.001654f,0.0f,
-			0.578034f,-0.605784f,-0.054449f,0.0f,
-			0.345172f,-0.131104f,-0.598269f,0.0f,
-			0.195738f,0.459111f,-0.159938f,0.0f,
-			0.345172f,-0.131104f,-0.598269f,0.0f,
-			0.578034f,-0.605784f,-0.054449f,0.0f,
-			0.578034f,-0.605784f,-0.054449f,0.0f,
-			0.255990f,0.313314f,0.125255f,0.0f,
-			0.195738f,0.459111f,-0.159938f,0.0f,
-			-0.205000f,0.792279f,0.447345f,0.0f,
-			0.195738f,0.459111f,-0.159938f,0.0f,
-			0.255990f,0.313314f,0.125255f,0.0f,
-			0.255990f,0.313314f,0.125255f,0.0f,
-			-0.284837f,0.929042f,0.020350f,0.0f,
-			-0.205000f,0.792279f,0.447345f,0.0f,
-			-0.295871f,0.770327f,0.459903f,0.0f,
-			-0.205000f,0.792279f,0.447345f,0.0f,
-			-0.284837f,0.929042f,0.020350f,0.0f,
-			-0.284837f,0.929042f,0.020350f,0.0f,
-			-0.358008f,0.893821f,-0.094150f,0.0f,
-			-0.295871f,0.770327f,0.459903f,0.0f,
-			0.022097f,0.435936f,-0.718931f,0.0f,
-			0.036298f,0.140253f,-0.904680f,0.0f,
-			0.396606f,-0.455621f,-0.647375f,0.0f,
-			0.396606f,-0.455621f,-0.647375f,0.0f,
-			0.345172f,-0.131104f,-0.598269f,0.0f,
-			0.022097f,0.435936f,-0.718931f,0.0f,
-			0.027721f,0.791606f,-0.055435f,0.0f,
-			0.022097f,0.435936f,-0.718931f,0.0f,
-			0.345172f,-0.131104f,-0.598269f,0.0f,
-			0.345172f,-0.131104f,-0.598269f,0.0f,
-			0.195738f,0.459111f,-0.159938f,0.0f,
-			0.027721f,0.791606f,-0.055435f,0.0f,
-			0.010532f,0.490729f,0.700767f,0.0f,
-			0.027721f,0.791606f,-0.055435f,0.0f,
-			0.195738f,0.459111f,-0.159938f,0.0f,
-			0.195738f,0.459111f,-0.159938f,0.0f,
-			-0.205000f,0.792279f,0.447345f,0.0f,
-			0.010532f,0.490729f,0.700767f,0.0f,
-			-0.046592f,0.293846f,0.882321f,0.0f,
-			0.010532f,0.490729f,0.700767f,0.0f,
-			-0.205000f,0.792279f,0.447345f,0.0f,
-			-0.205000f,0.792279f,0.447345f,0.0f,
-			-0.295871f,0.770327f,0.459903f,0.0f,
-			-0.046592f,0.293846f,0.882321f,0.0f,
-			-0.233787f,0.779412f,-0.463792f,0.0f,
-			-0.381767f,0.568613f,-0.624280f,0.0f,
-			0.036298f,0.140253f,-0.904680f,0.0f,
-			0.036298f,0.140253f,-0.904680f,0.0f,
-			0.022097f,0.435936f,-0.718931f,0.0f,
-			-0.233787f,0.779412f,-0.463792f,0.0f,
-			0.121863f,0.810008f,0.082568f,0.0f,
-			-0.233787f,0.779412f,-0.463792f,0.0f,
-			0.022097f,0.435936f,-0.718931f,0.0f,
-			0.022097f,0.435936f,-0.718931f,0.0f,
-			0.027721f,0.791606f,-0.055435f,0.0f,
-			0.121863f,0.810008f,0.082568f,0.0f,
-			0.345012f,0.167819f,0.596677f,0.0f,
-			0.121863f,0.810008f,0.082568f,0.0f,
-			0.027721f,0.791606f,-0.055435f,0.0f,
-			0.027721f,0.791606f,-0.055435f,0.0f,
-			0.010532f,0.490729f,0.700767f,0.0f,
-			0.345012f,0.167819f,0.596677f,0.0f,
-			0.321359f,-0.287546f,0.796775f,0.0f,
-			0.345012f,0.167819f,0.596677f,0.0f,
-			0.010532f,0.490729f,0.700767f,0.0f,
-			0.010532f,0.490729f,0.700767f,0.0f,
-			-0.046592f,0.293846f,0.882321f,0.0f,
-			0.321359f,-0.287546f,0.796775f,0.0f,
-			-0.356119f,0.887172f,-0.019359f,0.0f,
-			-0.593750f,0.686033f,0.006502f,0.0f,
-			-0.381767f,0.568613f,-0.624280f,0.0f,
-			-0.381767f,0.568613f,-0.624280f,0.0f,
-			-0.233787f,0.779412f,-0.463792f,0.0f,
-			-0.356119f,0.887172f,-0.019359f,0.0f,
-			0.159016f,0.804534f,-0.108950f,0.0f,
-			-0.356119f,0.887172f,-0.019359f,0.0f,
-			-0.233787f,0.779412f,-0.463792f,0.0f,
-			-0.233787f,0.779412f,-0.463792f,0.0f,
-			0.121863f,0.810008f,0.082568f,0.0f,
-			0.159016f,0.804534f,-0.108950f,0.0f,
-			0.587203f,0.018382f,0.005640f,0.0f,
-			0.159016f,0.804534f,-0.108950f,0.0f,
-			0.121863f,0.810008f,0.082568f,0.0f,
-			0.121863f,0.810008f,0.082568f,0.0f,
-			0.345012f,0.167819f,0.596677f,0.0f,
-			0.587203f,0.018382f,0.005640f,0.0f,
-			0.615044f,-0.628264f,0.159970f,0.0f,
-			0.587203f,0.018382f,0.005640f,0.0f,
-			0.345012f,0.167819f,0.596677f,0.0f,
-			0.345012f,0.167819f,0.596677f,0.0f,
-			0.321359f,-0.287546f,0.796775f,0.0f,
-			0.615044f,-0.628264f,0.159970f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.641181f,0.319378f,0.038181f,0.0f,
-			0.577287f,0.319075f,0.280172f,0.0f,
-			0.796971f,-0.388593f,0.320513f,0.0f,
-			0.577287f,0.319075f,0.280172f,0.0f,
-			0.641181f,0.319378f,0.038181f,0.0f,
-			0.641181f,0.319378f,0.038181f,0.0f,
-			0.860212f,-0.387799f,-0.007320f,0.0f,
-			0.796971f,-0.388593f,0.320513f,0.0f,
-			0.794794f,-0.313371f,0.336687f,0.0f,
-			0.796971f,-0.388593f,0.320513f,0.0f,
-			0.860212f,-0.387799f,-0.007320f,0.0f,
-			0.860212f,-0.387799f,-0.007320f,0.0f,
-			0.863983f,-0.312781f,0.007857f,0.0f,
-			0.794794f,-0.313371f,0.336687f,0.0f,
-			0.612213f,0.482723f,0.229578f,0.0f,
-			0.794794f,-0.313371f,0.336687f,0.0f,
-			0.863983f,-0.312781f,0.007857f,0.0f,
-			0.863983f,-0.312781f,0.007857f,0.0f,
-			0.654230f,0.482694f,-0.021368f,0.0f,
-			0.612213f,0.482723f,0.229578f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.577287f,0.319075f,0.280172f,0.0f,
-			0.425482f,0.318947f,0.480278f,0.0f,
-			0.612682f,-0.389188f,0.601910f,0.0f,
-			0.425482f,0.318947f,0.480278f,0.0f,
-			0.577287f,0.319075f,0.280172f,0.0f,
-			0.577287f,0.319075f,0.280172f,0.0f,
-			0.796971f,-0.388593f,0.320513f,0.0f,
-			0.612682f,-0.389188f,0.601910f,0.0f,
-			0.604712f,-0.314132f,0.615526f,0.0f,
-			0.612682f,-0.389188f,0.601910f,0.0f,
-			0.796971f,-0.388593f,0.320513f,0.0f,
-			0.796971f,-0.388593f,0.320513f,0.0f,
-			0.794794f,-0.313371f,0.336687f,0.0f,
-			0.604712f,-0.314132f,0.615526f,0.0f,
-			0.477467f,0.482536f,0.446770f,0.0f,
-			0.604712f,-0.314132f,0.615526f,0.0f,
-			0.794794f,-0.313371f,0.336687f,0.0f,
-			0.794794f,-0.313371f,0.336687f,0.0f,
-			0.612213f,0.482723f,0.229578f,0.0f,
-			0.477467f,0.482536f,0.446770f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.425482f,0.318947f,0.480278f,0.0f,
-			0.208198f,0.319240f,0.606999f,0.0f,
-			0.334626f,-0.388406f,0.791458f,0.0f,
-			0.208198f,0.319240f,0.606999f,0.0f,
-			0.425482f,0.318947f,0.480278f,0.0f,
-			0.425482f,0.318947f,0.480278f,0.0f,
-			0.612682f,-0.389188f,0.601910f,0.0f,
-			0.334626f,-0.388406f,0.791458f,0.0f,
-			0.322166f,-0.313565f,0.800533f,0.0f,
-			0.334626f,-0.388406f,0.791458f,0.0f,
-			0.612682f,-0.389188f,0.601910f,0.0f,
-			0.612682f,-0.389188f,0.601910f,0.0f,
-			0.604712f,-0.314132f,0.615526f,0.0f,
-			0.322166f,-0.313565f,0.800533f,0.0f,
-			0.269956f,0.482488f,0.595763f,0.0f,
-			0.322166f,-0.313565f,0.800533f,0.0f,
-			0.604712f,-0.314132f,0.615526f,0.0f,
-			0.604712f,-0.314132f,0.615526f,0.0f,
-			0.477467f,0.482536f,0.446770f,0.0f,
-			0.269956f,0.482488f,0.595763f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.208198f,0.319240f,0.606999f,0.0f,
-			-0.038181f,0.319373f,0.641179f,0.0f,
-			0.007321f,-0.387803f,0.860212f,0.0f,
-			-0.038181f,0.319373f,0.641179f,0.0f,
-			0.208198f,0.319240f,0.606999f,0.0f,
-			0.208198f,0.319240f,0.606999f,0.0f,
-			0.334626f,-0.388406f,0.791458f,0.0f,
-			0.007321f,-0.387803f,0.860212f,0.0f,
-			-0.007858f,-0.312780f,0.863983f,0.0f,
-			0.007321f,-0.387803f,0.860212f,0.0f,
-			0.334626f,-0.388406f,0.791458f,0.0f,
-			0.334626f,-0.388406f,0.791458f,0.0f,
-			0.322166f,-0.313565f,0.800533f,0.0f,
-			-0.007858f,-0.312780f,0.863983f,0.0f,
-			0.021368f,0.482694f,0.654229f,0.0f,
-			-0.007858f,-0.312780f,0.863983f,0.0f,
-			0.322166f,-0.313565f,0.800533f,0.0f,
-			0.322166f,-0.313565f,0.800533f,0.0f,
-			0.269956f,0.482488f,0.595763f,0.0f,
-			0.021368f,0.482694f,0.654229f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.038181f,0.319373f,0.641179f,0.0f,
-			-0.280174f,0.319075f,0.577286f,0.0f,
-			-0.320514f,-0.388595f,0.796971f,0.0f,
-			-0.280174f,0.319075f,0.577286f,0.0f,
-			-0.038181f,0.319373f,0.641179f,0.0f,
-			-0.038181f,0.319373f,0.641179f,0.0f,
-			0.007321f,-0.387803f,0.860212f,0.0f,
-			-0.320514f,-0.388595f,0.796971f,0.0f,
-			-0.336687f,-0.313371f,0.794795f,0.0f,
-			-0.320514f,-0.388595f,0.796971f,0.0f,
-			0.007321f,-0.387803f,0.860212f,0.0f,
-			0.007321f,-0.387803f,0.860212f,0.0f,
-			-0.007858f,-0.312780f,0.863983f,0.0f,
-			-0.336687f,-0.313371f,0.794795f,0.0f,
-			-0.229579f,0.482723f,0.612212f,0.0f,
-			-0.336687f,-0.313371f,0.794795f,0.0f,
-			-0.007858f,-0.312780f,0.863983f,0.0f,
-			-0.007858f,-0.312780f,0.863983f,0.0f,
-			0.021368f,0.482694f,0.654229f,0.0f,
-			-0.229579f,0.482723f,0.612212f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.280174f,0.319075f,0.577286f,0.0f,
-			-0.480278f,0.318947f,0.425482f,0.0f,
-			-0.601910f,-0.389188f,0.612682f,0.0f,
-			-0.480278f,0.318947f,0.425482f,0.0f,
-			-0.280174f,0.319075f,0.577286f,0.0f,
-			-0.280174f,0.319075f,0.577286f,0.0f,
-			-0.320514f,-0.388595f,0.796971f,0.0f,
-			-0.601910f,-0.389188f,0.612682f,0.0f,
-			-0.615525f,-0.314132f,0.604712f,0.0f,
-			-0.601910f,-0.389188f,0.612682f,0.0f,
-			-0.320514f,-0.388595f,0.796971f,0.0f,
-			-0.320514f,-0.388595f,0.796971f,0.0f,
-			-0.336687f,-0.313371f,0.794795f,0.0f,
-			-0.615525f,-0.314132f,0.604712f,0.0f,
-			-0.446770f,0.482536f,0.477467f,0.0f,
-			-0.615525f,-0.314132f,0.604712f,0.0f,
-			-0.336687f,-0.313371f,0.794795f,0.0f,
-			-0.336687f,-0.313371f,0.794795f,0.0f,
-			-0.229579f,0.482723f,0.612212f,0.0f,
-			-0.446770f,0.482536f,0.477467f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.480278f,0.318947f,0.425482f,0.0f,
-			-0.606999f,0.319240f,0.208198f,0.0f,
-			-0.791458f,-0.388406f,0.334626f,0.0f,
-			-0.606999f,0.319240f,0.208198f,0.0f,
-			-0.480278f,0.318947f,0.425482f,0.0f,
-			-0.480278f,0.318947f,0.425482f,0.0f,
-			-0.601910f,-0.389188f,0.612682f,0.0f,
-			-0.791458f,-0.388406f,0.334626f,0.0f,
-			-0.800533f,-0.313565f,0.322166f,0.0f,
-			-0.791458f,-0.388406f,0.334626f,0.0f,
-			-0.601910f,-0.389188f,0.612682f,0.0f,
-			-0.601910f,-0.389188f,0.612682f,0.0f,
-			-0.615525f,-0.314132f,0.604712f,0.0f,
-			-0.800533f,-0.313565f,0.322166f,0.0f,
-			-0.595763f,0.482488f,0.269956f,0.0f,
-			-0.800533f,-0.313565f,0.322166f,0.0f,
-			-0.615525f,-0.314132f,0.604712f,0.0f,
-			-0.615525f,-0.314132f,0.604712f,0.0f,
-			-0.446770f,0.482536f,0.477467f,0.0f,
-			-0.595763f,0.482488f,0.269956f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.606999f,0.319240f,0.208198f,0.0f,
-			-0.641179f,0.319373f,-0.038181f,0.0f,
-			-0.860212f,-0.387803f,0.007321f,0.0f,
-			-0.641179f,0.319373f,-0.038181f,0.0f,
-			-0.606999f,0.319240f,0.208198f,0.0f,
-			-0.606999f,0.319240f,0.208198f,0.0f,
-			-0.791458f,-0.388406f,0.334626f,0.0f,
-			-0.860212f,-0.387803f,0.007321f,0.0f,
-			-0.863983f,-0.312780f,-0.007858f,0.0f,
-			-0.860212f,-0.387803f,0.007321f,0.0f,
-			-0.791458f,-0.388406f,0.334626f,0.0f,
-			-0.791458f,-0.388406f,0.334626f,0.0f,
-			-0.800533f,-0.313565f,0.322166f,0.0f,
-			-0.863983f,-0.312780f,-0.007858f,0.0f,
-			-0.654229f,0.482694f,0.021367f,0.0f,
-			-0.863983f,-0.312780f,-0.007858f,0.0f,
-			-0.800533f,-0.313565f,0.322166f,0.0f,
-			-0.800533f,-0.313565f,0.322166f,0.0f,
-			-0.595763f,0.482488f,0.269956f,0.0f,
-			-0.654229f,0.482694f,0.021367f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.641179f,0.319373f,-0.038181f,0.0f,
-			-0.577286f,0.319075f,-0.280174f,0.0f,
-			-0.796971f,-0.388595f,-0.320514f,0.0f,
-			-0.577286f,0.319075f,-0.280174f,0.0f,
-			-0.641179f,0.319373f,-0.038181f,0.0f,
-			-0.641179f,0.319373f,-0.038181f,0.0f,
-			-0.860212f,-0.387803f,0.007321f,0.0f,
-			-0.796971f,-0.388595f,-0.320514f,0.0f,
-			-0.794794f,-0.313371f,-0.336687f,0.0f,
-			-0.796971f,-0.388595f,-0.320514f,0.0f,
-			-0.860212f,-0.387803f,0.007321f,0.0f,
-			-0.860212f,-0.387803f,0.007321f,0.0f,
-			-0.863983f,-0.312780f,-0.007858f,0.0f,
-			-0.794794f,-0.313371f,-0.336687f,0.0f,
-			-0.612212f,0.482723f,-0.229579f,0.0f,
-			-0.794794f,-0.313371f,-0.336687f,0.0f,
-			-0.863983f,-0.312780f,-0.007858f,0.0f,
-			-0.863983f,-0.312780f,-0.007858f,0.0f,
-			-0.654229f,0.482694f,0.021367f,0.0f,
-			-0.612212f,0.482723f,-0.229579f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.577286f,0.319075f,-0.280174f,0.0f,
-			-0.425482f,0.318949f,-0.480279f,0.0f,
-			-0.612682f,-0.389188f,-0.601910f,0.0f,
-			-0.425482f,0.318949f,-0.480279f,0.0f,
-			-0.577286f,0.319075f,-0.280174f,0.0f,
-			-0.577286f,0.319075f,-0.280174f,0.0f,
-			-0.796971f,-0.388595f,-0.320514f,0.0f,
-			-0.612682f,-0.389188f,-0.601910f,0.0f,
-			-0.604712f,-0.314133f,-0.615526f,0.0f,
-			-0.612682f,-0.389188f,-0.601910f,0.0f,
-			-0.796971f,-0.388595f,-0.320514f,0.0f,
-			-0.796971f,-0.388595f,-0.320514f,0.0f,
-			-0.794794f,-0.313371f,-0.336687f,0.0f,
-			-0.604712f,-0.314133f,-0.615526f,0.0f,
-			-0.477467f,0.482535f,-0.446771f,0.0f,
-			-0.604712f,-0.314133f,-0.615526f,0.0f,
-			-0.794794f,-0.313371f,-0.336687f,0.0f,
-			-0.794794f,-0.313371f,-0.336687f,0.0f,
-			-0.612212f,0.482723f,-0.229579f,0.0f,
-			-0.477467f,0.482535f,-0.446771f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.425482f,0.318949f,-0.480279f,0.0f,
-			-0.208196f,0.319246f,-0.607001f,0.0f,
-			-0.334625f,-0.388403f,-0.791459f,0.0f,
-			-0.208196f,0.319246f,-0.607001f,0.0f,
-			-0.425482f,0.318949f,-0.480279f,0.0f,
-			-0.425482f,0.318949f,-0.480279f,0.0f,
-			-0.612682f,-0.389188f,-0.601910f,0.0f,
-			-0.334625f,-0.388403f,-0.791459f,0.0f,
-			-0.322166f,-0.313565f,-0.800533f,0.0f,
-			-0.334625f,-0.388403f,-0.791459f,0.0f,
-			-0.612682f,-0.389188f,-0.601910f,0.0f,
-			-0.612682f,-0.389188f,-0.601910f,0.0f,
-			-0.604712f,-0.314133f,-0.615526f,0.0f,
-			-0.322166f,-0.313565f,-0.800533f,0.0f,
-			-0.269957f,0.482487f,-0.595764f,0.0f,
-			-0.322166f,-0.313565f,-0.800533f,0.0f,
-			-0.604712f,-0.314133f,-0.615526f,0.0f,
-			-0.604712f,-0.314133f,-0.615526f,0.0f,
-			-0.477467f,0.482535f,-0.446771f,0.0f,
-			-0.269957f,0.482487f,-0.595764f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			-0.208196f,0.319246f,-0.607001f,0.0f,
-			0.038181f,0.319380f,-0.641181f,0.0f,
-			-0.007321f,-0.387797f,-0.860213f,0.0f,
-			0.038181f,0.319380f,-0.641181f,0.0f,
-			-0.208196f,0.319246f,-0.607001f,0.0f,
-			-0.208196f,0.319246f,-0.607001f,0.0f,
-			-0.334625f,-0.388403f,-0.791459f,0.0f,
-			-0.007321f,-0.387797f,-0.860213f,0.0f,
-			0.007858f,-0.312780f,-0.863983f,0.0f,
-			-0.007321f,-0.387797f,-0.860213f,0.0f,
-			-0.334625f,-0.388403f,-0.791459f,0.0f,
-			-0.334625f,-0.388403f,-0.791459f,0.0f,
-			-0.322166f,-0.313565f,-0.800533f,0.0f,
-			0.007858f,-0.312780f,-0.863983f,0.0f,
-			-0.021368f,0.482693f,-0.654230f,0.0f,
-			0.007858f,-0.312780f,-0.863983f,0.0f,
-			-0.322166f,-0.313565f,-0.800533f,0.0f,
-			-0.322166f,-0.313565f,-0.800533f,0.0f,
-			-0.269957f,0.482487f,-0.595764f,0.0f,
-			-0.021368f,0.482693f,-0.654230f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.038181f,0.319380f,-0.641181f,0.0f,
-			0.280172f,0.319078f,-0.577288f,0.0f,
-			0.320513f,-0.388591f,-0.796972f,0.0f,
-			0.280172f,0.319078f,-0.577288f,0.0f,
-			0.038181f,0.319380f,-0.641181f,0.0f,
-			0.038181f,0.319380f,-0.641181f,0.0f,
-			-0.007321f,-0.387797f,-0.860213f,0.0f,
-			0.320513f,-0.388591f,-0.796972f,0.0f,
-			0.336687f,-0.313371f,-0.794795f,0.0f,
-			0.320513f,-0.388591f,-0.796972f,0.0f,
-			-0.007321f,-0.387797f,-0.860213f,0.0f,
-			-0.007321f,-0.387797f,-0.860213f,0.0f,
-			0.007858f,-0.312780f,-0.863983f,0.0f,
-			0.336687f,-0.313371f,-0.794795f,0.0f,
-			0.229578f,0.482722f,-0.612213f,0.0f,
-			0.336687f,-0.313371f,-0.794795f,0.0f,
-			0.007858f,-0.312780f,-0.863983f,0.0f,
-			0.007858f,-0.312780f,-0.863983f,0.0f,
-			-0.021368f,0.482693f,-0.654230f,0.0f,
-			0.229578f,0.482722f,-0.612213f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.280172f,0.319078f,-0.577288f,0.0f,
-			0.480277f,0.318947f,-0.425483f,0.0f,
-			0.601909f,-0.389187f,-0.612683f,0.0f,
-			0.480277f,0.318947f,-0.425483f,0.0f,
-			0.280172f,0.319078f,-0.577288f,0.0f,
-			0.280172f,0.319078f,-0.577288f,0.0f,
-			0.320513f,-0.388591f,-0.796972f,0.0f,
-			0.601909f,-0.389187f,-0.612683f,0.0f,
-			0.615526f,-0.314133f,-0.604712f,0.0f,
-			0.601909f,-0.389187f,-0.612683f,0.0f,
-			0.320513f,-0.388591f,-0.796972f,0.0f,
-			0.320513f,-0.388591f,-0.796972f,0.0f,
-			0.336687f,-0.313371f,-0.794795f,0.0f,
-			0.615526f,-0.314133f,-0.604712f,0.0f,
-			0.446770f,0.482535f,-0.477467f,0.0f,
-			0.615526f,-0.314133f,-0.604712f,0.0f,
-			0.336687f,-0.313371f,-0.794795f,0.0f,
-			0.336687f,-0.313371f,-0.794795f,0.0f,
-			0.229578f,0.482722f,-0.612213f,0.0f,
-			0.446770f,0.482535f,-0.477467f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.480277f,0.318947f,-0.425483f,0.0f,
-			0.607000f,0.319243f,-0.208197f,0.0f,
-			0.791458f,-0.388406f,-0.334627f,0.0f,
-			0.607000f,0.319243f,-0.208197f,0.0f,
-			0.480277f,0.318947f,-0.425483f,0.0f,
-			0.480277f,0.318947f,-0.425483f,0.0f,
-			0.601909f,-0.389187f,-0.612683f,0.0f,
-			0.791458f,-0.388406f,-0.334627f,0.0f,
-			0.800533f,-0.313565f,-0.322166f,0.0f,
-			0.791458f,-0.388406f,-0.334627f,0.0f,
-			0.601909f,-0.389187f,-0.612683f,0.0f,
-			0.601909f,-0.389187f,-0.612683f,0.0f,
-			0.615526f,-0.314133f,-0.604712f,0.0f,
-			0.800533f,-0.313565f,-0.322166f,0.0f,
-			0.595764f,0.482488f,-0.269957f,0.0f,
-			0.800533f,-0.313565f,-0.322166f,0.0f,
-			0.615526f,-0.314133f,-0.604712f,0.0f,
-			0.615526f,-0.314133f,-0.604712f,0.0f,
-			0.446770f,0.482535f,-0.477467f,0.0f,
-			0.595764f,0.482488f,-0.269957f,0.0f,
-			0.000000f,0.989383f,-0.000000f,0.0f,
-			0.607000f,0.319243f,-0.208197f,0.0f,
-			0.641181f,0.319378f,0.038181f,0.0f,
-			0.860212f,-0.387799f,-0.007320f,0.0f,
-			0.641181f,0.319378f,0.038181f,0.0f,
-			0.607000f,0.319243f,-0.208197f,0.0f,
-			0.607000f,0.319243f,-0.208197f,0.0f,
-			0.791458f,-0.388406f,-0.334627f,0.0f,
-			0.860212f,-0.387799f,-0.007320f,0.0f,
-			0.863983f,-0.312781f,0.007857f,0.0f,
-			0.860212f,-0.387799f,-0.007320f,0.0f,
-			0.791458f,-0.388406f,-0.334627f,0.0f,
-			0.791458f,-0.388406f,-0.334627f,0.0f,
-			0.800533f,-0.313565f,-0.322166f,0.0f,
-			0.863983f,-0.312781f,0.007857f,0.0f,
-			0.654230f,0.482694f,-0.021368f,0.0f,
-			0.863983f,-0.312781f,0.007857f,0.0f,
-			0.800533f,-0.313565f,-0.322166f,0.0f,
-			0.800533f,-0.313565f,-0.322166f,0.0f,
-			0.595764f,0.482488f,-0.269957f,0.0f,
-			0.654230f,0.482694f,-0.021368f,0.0f,
-			0.228289f,0.964458f,0.088450f,0.0f,
-			0.612213f,0.482723f,0.229578f,0.0f,
-			0.654230f,0.482694f,-0.021368f,0.0f,
-			0.654230f,0.482694f,-0.021368f,0.0f,
-			0.245283f,0.964353f,-0.005418f,0.0f,
-			0.228289f,0.964458f,0.088450f,0.0f,
-			0.158235f,0.984550f,0.066055f,0.0f,
-			0.228289f,0.964458f,0.088450f,0.0f,
-			0.245283f,0.964353f,-0.005418f,0.0f,
-			0.245283f,0.964353f,-0.005418f,0.0f,
-			0.171888f,0.984489f,0.000588f,0.0f,
-			0.158235f,0.984550f,0.066055f,0.0f,
-			0.320504f,0.914530f,0.144876f,0.0f,
-			0.158235f,0.984550f,0.066055f,0.0f,
-			0.171888f,0.984489f,0.000588f,0.0f,
-			0.171888f,0.984489f,0.000588f,0.0f,
-			0.352326f,0.914192f,0.011289f,0.0f,
-			0.320504f,0.914530f,0.144876f,0.0f,
-			0.496720f,0.845831f,0.167673f,0.0f,
-			0.320504f,0.914530f,0.144876f,0.0f,
-			0.352326f,0.914192f,0.011289f,0.0f,
-			0.352326f,0.914192f,0.011289f,0.0f,
-			0.523838f,0.845515f,-0.034478f,0.0f,
-			0.496720f,0.845831f,0.167673f,0.0f,
-			0.176624f,0.964614f,0.168959f,0.0f,
-			0.477467f,0.482536f,0.446770f,0.0f,
-			0.612213f,0.482723f,0.229578f,0.0f,
-			0.612213f,0.482723f,0.229578f,0.0f,
-			0.228289f,0.964458f,0.088450f,0.0f,
-			0.176624f,0.964614f,0.168959f,0.0f,
-			0.120647f,0.984608f,0.121477f,0.0f,
-			0.176624f,0.964614f,0.168959f,0.0f,
-			0.228289f,0.964458f,0.088450f,0.0f,
-			0.228289f,0.964458f,0.088450f,0.0f,
-			0.158235f,0.984550f,0.066055f,0.0f,
-			0.120647f,0.984608f,0.121477f,0.0f,
-			0.240346f,0.914732f,0.256324f,0.0f,
-			0.120647f,0.984608f,0.121477f,0.0f,
-			0.158235f,0.984550f,0.066055f,0.0f,
-			0.158235f,0.984550f,0.066055f,0.0f,
-			0.320504f,0.914530f,0.144876f,0.0f,
-			0.240346f,0.914732f,0.256324f,0.0f,
-			0.393709f,0.846463f,0.344929f,0.0f,
-			0.240346f,0.914732f,0.256324f,0.0f,
-			0.320504f,0.914530f,0.144876f,0.0f,
-			0.320504f,0.914530f,0.144876f,0.0f,
-			0.496720f,0.845831f,0.167673f,0.0f,
-			0.393709f,0.846463f,0.344929f,0.0f,
-			0.098540f,0.964509f,0.224018f,0.0f,
-			0.269956f,0.482488f,0.595763f,0.0f,
-			0.477467f,0.482536f,0.446770f,0.0f,
-			0.477467f,0.482536f,0.446770f,0.0f,
-			0.176624f,0.964614f,0.168959f,0.0f,
-			0.098540f,0.964509f,0.224018f,0.0f,
-			0.064962f,0.984546f,0.158698f,0.0f,
-			0.098540f,0.964509f,0.224018f,0.0f,
-			0.176624f,0.964614f,0.168959f,0.0f,
-			0.176624f,0.964614f,0.168959f,0.0f,
-			0.120647f,0.984608f,0.121477f,0.0f,
-			0.064962f,0.984546f,0.158698f,0.0f,
-			0.123827f,0.914393f,0.329358f,0.0f,
-			0.064962f,0.984546f,0.158698f,0.0f,
-			0.120647f,0.984608f,0.121477f,0.0f,
-			0.120647f,0.984608f,0.121477f,0.0f,
-			0.240346f,0.914732f,0.256324f,0.0f,
-			0.123827f,0.914393f,0.329358f,0.0f,
-			0.231912f,0.846147f,0.469604f,0.0f,
-			0.123827f,0.914393f,0.329358f,0.0f,
-			0.240346f,0.914732f,0.256324f,0.0f,
-			0.240346f,0.914732f,0.256324f,0.0f,
-			0.393709f,0.846463f,0.344929f,0.0f,
-			0.231912f,0.846147f,0.469604f,0.0f,
-			0.005418f,0.964353f,0.245282f,0.0f,
-			0.021368f,0.482694f,0.654229f,0.0f,
-			0.269956f,0.482488f,0.595763f,0.0f,
-			0.269956f,0.482488f,0.595763f,0.0f,
-			0.098540f,0.964509f,0.224018f,0.0f,
-			0.005418f,0.964353f,0.245282f,0.0f,
-			-0.000587f,0.984489f,0.171887f,0.0f,
-			0.005418f,0.964353f,0.245282f,0.0f,
-			0.098540f,0.964509f,0.224018f,0.0f,
-			0.098540f,0.964509f,0.224018f,0.0f,
-			0.064962f,0.984546f,0.158698f,0.0f,
-			-0.000587f,0.984489f,0.171887f,0.0f,
-			-0.011288f,0.914190f,0.352328f,0.0f,
-			-0.000587f,0.984489f,0.171887f,0.0f,
-			0.064962f,0.984546f,0.158698f,0.0f,
-			0.064962f,0.984546f,0.158698f,0.0f,
-			0.123827f,0.914393f,0.329358f,0.0f,
-			-0.011288f,0.914190f,0.352328f,0.0f,
-			0.034478f,0.845510f,0.523845f,0.0f,
-			-0.011288f,0.914190f,0.352328f,0.0f,
-			0.123827f,0.914393f,0.329358f,0.0f,
-			0.123827f,0.914393f,0.329358f,0.0f,
-			0.231912f,0.846147f,0.469604f,0.0f,
-			0.034478f,0.845510f,0.523845f,0.0f,
-			-0.088450f,0.964458f,0.228287f,0.0f,
-			-0.229579f,0.482723f,0.612212f,0.0f,
-			0.021368f,0.482694f,0.654229f,0.0f,
-			0.021368f,0.482694f,0.654229f,0.0f,
-			0.005418f,0.964353f,0.245282f,0.0f,
-			-0.088450f,0.964458f,0.228287f,0.0f,
-			-0.066055f,0.984550f,0.158235f,0.0f,
-			-0.088450f,0.964458f,0.228287f,0.0f,
-			0.005418f,0.964353f,0.245282f,0.0f,
-			0.005418f,0.964353f,0.245282f,0.0f,
-			-0.000587f,0.984489f,0.171887f,0.0f,
-			-0.066055f,0.984550f,0.158235f,0.0f,
-			-0.144877f,0.914529f,0.320504f,0.0f,
-			-0.066055f,0.984550f,0.158235f,0.0f,
-			-0.000587f,0.984489f,0.171887f,0.0f,
-			-0.000587f,0.984489f,0.171887f,0.0f,
-			-0.011288f,0.914190f,0.352328f,0.0f,
-			-0.144877f,0.914529f,0.320504f,0.0f,
-			-0.167673f,0.845829f,0.496723f,0.0f,
-			-0.144877f,0.914529f,0.320504f,0.0f,
-			-0.011288f,0.914190f,0.352328f,0.0f,
-			-0.011288f,0.914190f,0.352328f,0.0f,
-			0.034478f,0.845510f,0.523845f,0.0f,
-			-0.167673f,0.845829f,0.496723f,0.0f,
-			-0.168960f,0.964614f,0.176622f,0.0f,
-			-0.446770f,0.482536f,0.477467f,0.0f,
-			-0.229579f,0.482723f,0.612212f,0.0f,
-			-0.229579f,0.482723f,0.612212f,0.0f,
-			-0.088450f,0.964458f,0.228287f,0.0f,
-			-0.168960f,0.964614f,0.176622f,0.0f,
-			-0.121477f,0.984608f,0.120646f,0.0f,
-			-0.168960f,0.964614f,0.176622f,0.0f,
-			-0.088450f,0.964458f,0.228287f,0.0f,
-			-0.088450f,0.964458f,0.228287f,0.0f,
-			-0.066055f,0.984550f,0.158235f,0.0f,
-			-0.121477f,0.984608f,0.120646f,0.0f,
-			-0.256325f,0.914731f,0.240347f,0.0f,
-			-0.121477f,0.984608f,0.120646f,0.0f,
-			-0.066055f,0.984550f,0.158235f,0.0f,
-			-0.066055f,0.984550f,0.158235f,0.0f,
-			-0.144877f,0.914529f,0.320504f,0.0f,
-			-0.256325f,0.914731f,0.240347f,0.0f,
-			-0.344933f,0.846460f,0.393712f,0.0f,
-			-0.256325f,0.914731f,0.240347f,0.0f,
-			-0.144877f,0.914529f,0.320504f,0.0f,
-			-0.144877f,0.914529f,0.320504f,0.0f,
-			-0.167673f,0.845829f,0.496723f,0.0f,
-			-0.344933f,0.846460f,0.393712f,0.0f,
-			-0.224018f,0.964509f,0.098540f,0.0f,
-			-0.595763f,0.482488f,0.269956f,0.0f,
-			-0.446770f,0.482536f,0.477467f,0.0f,
-			-0.446770f,0.482536f,0.477467f,0.0f,
-			-0.168960f,0.964614f,0.176622f,0.0f,
-			-0.224018f,0.964509f,0.098540f,0.0f,
-			-0.158699f,0.984546f,0.064962f,0.0f,
-			-0.224018f,0.964509f,0.098540f,0.0f,
-			-0.168960f,0.964614f,0.176622f,0.0f,
-			-0.168960f,0.964614f,0.176622f,0.0f,
-			-0.121477f,0.984608f,0.120646f,0.0f,
-			-0.158699f,0.984546f,0.064962f,0.0f,
-			-0.329358f,0.914393f,0.123826f,0.0f,
-			-0.158699f,0.984546f,0.064962f,0.0f,
-			-0.121477f,0.984608f,0.120646f,0.0f,
-			-0.121477f,0.984608f,0.120646f,0.0f,
-			-0.256325f,0.914731f,0.240347f,0.0f,
-			-0.329358f,0.914393f,0.123826f,0.0f,
-			-0.469606f,0.846145f,0.231913f,0.0f,
-			-0.329358f,0.914393f,0.123826f,0.0f,
-			-0.256325f,0.914731f,0.240347f,0.0f,
-			-0.256325f,0.914731f,0.240347f,0.0f,
-			-0.344933f,0.846460f,0.393712f,0.0f,
-			-0.469606f,0.846145f,0.231913f,0.0f,
-			-0.245283f,0.964353f,0.005418f,0.0f,
-			-0.654229f,0.482694f,0.021367f,0.0f,
-			-0.595763f,0.482488f,0.269956f,0.0f,
-			-0.595763f,0.482488f,0.269956f,0.0f,
-			-0.224018f,0.964509f,0.098540f,0.0f,
-			-0.245283f,0.964353f,0.005418f,0.0f,
-			-0.171887f,0.984489f,-0.000588f,0.0f,
-			-0.245283f,0.964353f,0.005418f,0.0f,
-			-0.224018f,0.964509f,0.098540f,0.0f,
-			-0.224018f,0.964509f,0.098540f,0.0f,
-			-0.158699f,0.984546f,0.064962f,0.0f,
-			-0.171887f,0.984489f,-0.000588f,0.0f,
-			-0.352329f,0.914190f,-0.011288f,0.0f,
-			-0.171887f,0.984489f,-0.000588f,0.0f,
-			-0.158699f,0.984546f,0.064962f,0.0f,
-			-0.158699f,0.984546f,0.064962f,0.0f,
-			-0.329358f,0.914393f,0.123826f,0.0f,
-			-0.352329f,0.914190f,-0.011288f,0.0f,
-			-0.523845f,0.845510f,0.034478f,0.0f,
-			-0.352329f,0.914190f,-0.011288f,0.0f,
-			-0.329358f,0.914393f,0.123826f,0.0f,
-			-0.329358f,0.914393f,0.123826f,0.0f,
-			-0.469606f,0.846145f,0.231913f,0.0f,
-			-0.523845f,0.845510f,0.034478f,0.0f,
-			-0.228288f,0.964458f,-0.088451f,0.0f,
-			-0.612212f,0.482723f,-0.229579f,0.0f,
-			-0.654229f,0.482694f,0.021367f,0.0f,
-			-0.654229f,0.482694f,0.021367f,0.0f,
-			-0.245283f,0.964353f,0.005418f,0.0f,
-			-0.228288f,0.964458f,-0.088451f,0.0f,
-			-0.158235f,0.984550f,-0.066056f,0.0f,
-			-0.228288f,0.964458f,-0.088451f,0.0f,
-			-0.245283f,0.964353f,0.005418f,0.0f,
-			-0.245283f,0.964353f,0.005418f,0.0f,
-			-0.171887f,0.984489f,-0.000588f,0.0f,
-			-0.158235f,0.984550f,-0.066056f,0.0f,
-			-0.320503f,0.914530f,-0.144878f,0.0f,
-			-0.158235f,0.984550f,-0.066056f,0.0f,
-			-0.171887f,0.984489f,-0.000588f,0.0f,
-			-0.171887f,0.984489f,-0.000588f,0.0f,
-			-0.352329f,0.914190f,-0.011288f,0.0f,
-			-0.320503f,0.914530f,-0.144878f,0.0f,
-			-0.496723f,0.845829f,-0.167673f,0.0f,
-			-0.320503f,0.914530f,-0.144878f,0.0f,
-			-0.352329f,0.914190f,-0.011288f,0.0f,
-			-0.352329f,0.914190f,-0.011288f,0.0f,
-			-0.523845f,0.845510f,0.034478f,0.0f,
-			-0.496723f,0.845829f,-0.167673f,0.0f,
-			-0.176622f,0.964614f,-0.168961f,0.0f,
-			-0.477467f,0.482535f,-0.446771f,0.0f,
-			-0.612212f,0.482723f,-0.229579f,0.0f,
-			-0.612212f,0.482723f,-0.229579f,0.0f,
-			-0.228288f,0.964458f,-0.088451f,0.0f,
-			-0.176622f,0.964614f,-0.168961f,0.0f,
-			-0.120647f,0.984608f,-0.121478f,0.0f,
-			-0.176622f,0.964614f,-0.168961f,0.0f,
-			-0.228288f,0.964458f,-0.088451f,0.0f,
-			-0.228288f,0.964458f,-0.088451f,0.0f,
-			-0.158235f,0.984550f,-0.066056f,0.0f,
-			-0.120647f,0.984608f,-0.121478f,0.0f,
-			-0.240345f,0.914732f,-0.256325f,0.0f,
-			-0.120647f,0.984608f,-0.121478f,0.0f,
-			-0.158235f,0.984550f,-0.066056f,0.0f,
-			-0.158235f,0.984550f,-0.066056f,0.0f,
-			-0.320503f,0.914530f,-0.144878f,0.0f,
-			-0.240345f,0.914732f,-0.256325f,0.0f,
-			-0.393707f,0.846463f,-0.344931f,0.0f,
-			-0.240345f,0.914732f,-0.256325f,0.0f,
-			-0.320503f,0.914530f,-0.144878f,0.0f,
-			-0.320503f,0.914530f,-0.144878f,0.0f,
-			-0.496723f,0.845829f,-0.167673f,0.0f,
-			-0.393707f,0.846463f,-0.344931f,0.0f,
-			-0.098540f,0.964509f,-0.224019f,0.0f,
-			-0.269957f,0.482487f,-0.595764f,0.0f,
-			-0.477467f,0.482535f,-0.446771f,0.0f,
-			-0.477467f,0.482535f,-0.446771f,0.0f,
-			-0.176622f,0.964614f,-0.168961f,0.0f,
-			-0.098540f,0.964509f,-0.224019f,0.0f,
-			-0.064962f,0.984546f,-0.158699f,0.0f,
-			-0.098540f,0.964509f,-0.224019f,0.0f,
-			-0.176622f,0.964614f,-0.168961f,0.0f,
-			-0.176622f,0.964614f,-0.168961f,0.0f,
-			-0.120647f,0.984608f,-0.121478f,0.0f,
-			-0.064962f,0.984546f,-0.158699f,0.0f,
-			-0.123827f,0.914394f,-0.329357f,0.0f,
-			-0.064962f,0.984546f,-0.158699f,0.0f,
-			-0.120647f,0.984608f,-0.121478f,0.0f,
-			-0.120647f,0.984608f,-0.121478f,0.0f,
-			-0.240345f,0.914732f,-0.256325f,0.0f,
-			-0.123827f,0.914394f,-0.329357f,0.0f,
-			-0.231912f,0.846147f,-0.469603f,0.0f,
-			-0.123827f,0.914394f,-0.329357f,0.0f,
-			-0.240345f,0.914732f,-0.256325f,0.0f,
-			-0.240345f,0.914732f,-0.256325f,0.0f,
-			-0.393707f,0.846463f,-0.344931f,0.0f,
-			-0.231912f,0.846147f,-0.469603f,0.0f,
-			-0.005418f,0.964352f,-0.245283f,0.0f,
-			-0.021368f,0.482693f,-0.654230f,0.0f,
-			-0.269957f,0.482487f,-0.595764f,0.0f,
-			-0.269957f,0.482487f,-0.595764f,0.0f,
-			-0.098540f,0.964509f,-0.224019f,0.0f,
-			-0.005418f,0.964352f,-0.245283f,0.0f,
-			0.000588f,0.984489f,-0.171888f,0.0f,
-			-0.005418f,0.964352f,-0.245283f,0.0f,
-			-0.098540f,0.964509f,-0.224019f,0.0f,
-			-0.098540f,0.964509f,-0.224019f,0.0f,
-			-0.064962f,0.984546f,-0.158699f,0.0f,
-			0.000588f,0.984489f,-0.171888f,0.0f,
-			0.011289f,0.914192f,-0.352326f,0.0f,
-			0.000588f,0.984489f,-0.171888f,0.0f,
-			-0.064962f,0.984546f,-0.158699f,0.0f,
-			-0.064962f,0.984546f,-0.158699f,0.0f,
-			-0.123827f,0.914394f,-0.329357f,0.0f,
-			0.011289f,0.914192f,-0.352326f,0.0f,
-			-0.034478f,0.845515f,-0.523838f,0.0f,
-			0.011289f,0.914192f,-0.352326f,0.0f,
-			-0.123827f,0.914394f,-0.329357f,0.0f,
-			-0.123827f,0.914394f,-0.329357f,0.0f,
-			-0.231912f,0.846147f,-0.469603f,0.0f,
-			-0.034478f,0.845515f,-0.523838f,0.0f,
-			0.088450f,0.964457f,-0.228289f,0.0f,
-			0.229578f,0.482722f,-0.612213f,0.0f,
-			-0.021368f,0.482693f,-0.654230f,0.0f,
-			-0.021368f,0.482693f,-0.654230f,0.0f,
-			-0.005418f,0.964352f,-0.245283f,0.0f,
-			0.088450f,0.964457f,-0.228289f,0.0f,
-			0.066056f,0.984550f,-0.158235f,0.0f,
-			0.088450f,0.964457f,-0.228289f,0.0f,
-			-0.005418f,0.964352f,-0.245283f,0.0f,
-			-0.005418f,0.964352f,-0.245283f,0.0f,
-			0.000588f,0.984489f,-0.171888f,0.0f,
-			0.066056f,0.984550f,-0.158235f,0.0f,
-			0.144876f,0.914531f,-0.320503f,0.0f,
-			0.066056f,0.984550f,-0.158235f,0.0f,
-			0.000588f,0.984489f,-0.171888f,0.0f,
-			0.000588f,0.984489f,-0.171888f,0.0f,
-			0.011289f,0.914192f,-0.352326f,0.0f,
-			0.144876f,0.914531f,-0.320503f,0.0f,
-			0.167673f,0.845831f,-0.496720f,0.0f,
-			0.144876f,0.914531f,-0.320503f,0.0f,
-			0.011289f,0.914192f,-0.352326f,0.0f,
-			0.011289f,0.914192f,-0.352326f,0.0f,
-			-0.034478f,0.845515f,-0.523838f,0.0f,
-			0.167673f,0.845831f,-0.496720f,0.0f,
-			0.168960f,0.964614f,-0.176623f,0.0f,
-			0.446770f,0.482535f,-0.477467f,0.0f,
-			0.229578f,0.482722f,-0.612213f,0.0f,
-			0.229578f,0.482722f,-0.612213f,0.0f,
-			0.088450f,0.964457f,-0.228289f,0.0f,
-			0.168960f,0.964614f,-0.176623f,0.0f,
-			0.121478f,0.984608f,-0.120647f,0.0f,
-			0.168960f,0.964614f,-0.176623f,0.0f,
-			0.088450f,0.964457f,-0.228289f,0.0f,
-			0.088450f,0.964457f,-0.228289f,0.0f,
-			0.066056f,0.984550f,-0.158235f,0.0f,
-			0.121478f,0.984608f,-0.120647f,0.0f,
-			0.256323f,0.914734f,-0.240344f,0.0f,
-			0.121478f,0.984608f,-0.120647f,0.0f,
-			0.066056f,0.984550f,-0.158235f,0.0f,
-			0.066056f,0.984550f,-0.158235f,0.0f,
-			0.144876f,0.914531f,-0.320503f,0.0f,
-			0.256323f,0.914734f,-0.240344f,0.0f,
-			0.344927f,0.846466f,-0.393704f,0.0f,
-			0.256323f,0.914734f,-0.240344f,0.0f,
-			0.144876f,0.914531f,-0.320503f,0.0f,
-			0.144876f,0.914531f,-0.320503f,0.0f,
-			0.167673f,0.845831f,-0.496720f,0.0f,
-			0.344927f,0.846466f,-0.393704f,0.0f,
-			0.224018f,0.964509f,-0.098540f,0.0f,
-			0.595764f,0.482488f,-0.269957f,0.0f,
-			0.446770f,0.482535f,-0.477467f,0.0f,
-			0.446770f,0.482535f,-0.477467f,0.0f,
-			0.168960f,0.964614f,-0.176623f,0.0f,
-			0.224018f,0.964509f,-0.098540f,0.0f,
-			0.158699f,0.984546f,-0.064962f,0.0f,
-			0.224018f,0.964509f,-0.098540f,0.0f,
-			0.168960f,0.964614f,-0.176623f,0.0f,
-			0.168960f,0.964614f,-0.176623f,0.0f,
-			0.121478f,0.984608f,-0.120647f,0.0f,
-			0.158699f,0.984546f,-0.064962f,0.0f,
-			0.329356f,0.914394f,-0.123828f,0.0f,
-			0.158699f,0.984546f,-0.064962f,0.0f,
-			0.121478f,0.984608f,-0.120647f,0.0f,
-			0.121478f,0.984608f,-0.120647f,0.0f,
-			0.256323f,0.914734f,-0.240344f,0.0f,
-			0.329356f,0.914394f,-0.123828f,0.0f,
-			0.469602f,0.846149f,-0.231911f,0.0f,
-			0.329356f,0.914394f,-0.123828f,0.0f,
-			0.256323f,0.914734f,-0.240344f,0.0f,
-			0.256323f,0.914734f,-0.240344f,0.0f,
-			0.344927f,0.846466f,-0.393704f,0.0f,
-			0.469602f,0.846149f,-0.231911f,0.0f,
-			0.245283f,0.964353f,-0.005418f,0.0f,
-			0.654230f,0.482694f,-0.021368f,0.0f,
-			0.595764f,0.482488f,-0.269957f,0.0f,
-			0.595764f,0.482488f,-0.269957f,0.0f,
-			0.224018f,0.964509f,-0.098540f,0.0f,
-			0.245283f,0.964353f,-0.005418f,0.0f,
-			0.171888f,0.984489f,0.000588f,0.0f,
-			0.245283f,0.964353f,-0.005418f,0.0f,
-			0.224018f,0.964509f,-0.098540f,0.0f,
-			0.224018f,0.964509f,-0.098540f,0.0f,
-			0.158699f,0.984546f,-0.064962f,0.0f,
-			0.171888f,0.984489f,0.000588f,0.0f,
-			0.352326f,0.914192f,0.011289f,0.0f,
-			0.171888f,0.984489f,0.000588f,0.0f,
-			0.158699f,0.984546f,-0.064962f,0.0f,
-			0.158699f,0.984546f,-0.064962f,0.0f,
-			0.329356f,0.914394f,-0.123828f,0.0f,
-			0.352326f,0.914192f,0.011289f,0.0f,
-			0.523838f,0.845515f,-0.034478f,0.0f,
-			0.352326f,0.914192f,0.011289f,0.0f,
-			0.329356f,0.914394f,-0.123828f,0.0f,
-			0.329356f,0.914394f,-0.123828f,0.0f,
-			0.469602f,0.846149f,-0.231911f,0.0f,
-			0.523838f,0.845515f,-0.034478f,0.0f,
-		};
-		float texCoords[]={
-			1.617722f,0.304849f,
-			1.491570f,0.306300f,
-			1.617573f,0.291882f,
-			1.491570f,0.306300f,
-			1.491450f,0.293397f,
-			1.617573f,0.291882f,
-			1.617746f,0.290868f,
-			1.617573f,0.291882f,
-			1.491450f,0.293397f,
-			1.491450f,0.293397f,
-			1.491589f,0.292356f,
-			1.617746f,0.290868f,
-			1.618081f,0.299239f,
-			1.617746f,0.290868f,
-			1.491589f,0.292356f,
-			1.491589f,0.292356f,
-			1.491859f,0.300647f,
-			1.618081f,0.299239f,
-			1.618425f,0.314975f,
-			1.618081f,0.299239f,
-			1.491859f,0.300647f,
-			1.491859f,0.300647f,
-			1.492138f,0.316275f,
-			1.618425f,0.314975f,
-			1.739247f,0.290071f,
-			1.739403f,0.303109f,
-			1.617722f,0.304849f,
-			1.617722f,0.304849f,
-			1.617573f,0.291882f,
-			1.739247f,0.290071f,
-			1.739427f,0.289086f,
-			1.739247f,0.290071f,
-			1.617573f,0.291882f,
-			1.617573f,0.291882f,
-			1.617746f,0.290868f,
-			1.739427f,0.289086f,
-			1.739778f,0.297547f,
-			1.739427f,0.289086f,
-			1.617746f,0.290868f,
-			1.617746f,0.290868f,
-			1.618081f,0.299239f,
-			1.739778f,0.297547f,
-			1.740137f,0.313406f,
-			1.739778f,0.297547f,
-			1.618081f,0.299239f,
-			1.618081f,0.299239f,
-			1.618425f,0.314975f,
-			1.740137f,0.313406f,
-			1.862521f,0.287828f,
-			1.862662f,0.300948f,
-			1.739403f,0.303109f,
-			1.739403f,0.303109f,
-			1.739247f,0.290071f,
-			1.862521f,0.287828f,
-			1.862683f,0.286874f,
-			1.862521f,0.287828f,
-			1.739247f,0.290071f,
-			1.739247f,0.290071f,
-			1.739427f,0.289086f,
-			1.862683f,0.286874f,
-			1.862998f,0.295429f,
-			1.862683f,0.286874f,
-			1.739427f,0.289086f,
-			1.739427f,0.289086f,
-			1.739778f,0.297547f,
-			1.862998f,0.295429f,
-			1.863321f,0.311425f,
-			1.862998f,0.295429f,
-			1.739778f,0.297547f,
-			1.739778f,0.297547f,
-			1.740137f,0.313406f,
-			1.863321f,0.311425f,
-			1.993568f,0.285719f,
-			1.993668f,0.298911f,
-			1.862662f,0.300948f,
-			1.862662f,0.300948f,
-			1.862521f,0.287828f,
-			1.993568f,0.285719f,
-			1.993683f,0.284790f,
-			1.993568f,0.285719f,
-			1.862521f,0.287828f,
-			1.862521f,0.287828f,
-			1.862683f,0.286874f,
-			1.993683f,0.284790f,
-			1.993906f,0.293430f,
-			1.993683f,0.284790f,
-			1.862683f,0.286874f,
-			1.862683f,0.286874f,
-			1.862998f,0.295429f,
-			1.993906f,0.293430f,
-			1.994136f,0.309548f,
-			1.993906f,0.293430f,
-			1.862998f,0.295429f,
-			1.862998f,0.295429f,
-			1.863321f,0.311425f,
-			1.994136f,0.309548f,
-			0.128340f,0.285847f,
-			0.133016f,0.300016f,
-			-0.006332f,0.298911f,
-			-0.006332f,0.298911f,
-			-0.006432f,0.285719f,
-			0.128340f,0.285847f,
-			0.125903f,0.284422f,
-			0.128340f,0.285847f,
-			-0.006432f,0.285719f,
-			-0.006432f,0.285719f,
-			-0.006317f,0.284790f,
-			0.125903f,0.284422f,
-			0.125092f,0.292918f,
-			0.125903f,0.284422f,
-			-0.006317f,0.284790f,
-			-0.006317f,0.284790f,
-			-0.006094f,0.293430f,
-			0.125092f,0.292918f,
-			0.125060f,0.309061f,
-			0.125092f,0.292918f,
-			-0.006094f,0.293430f,
-			-0.006094f,0.293430f,
-			-0.005864f,0.309548f,
-			0.125060f,0.309061f,
-			0.253626f,0.286440f,
-			0.256709f,0.301160f,
-			0.133016f,0.300016f,
-			0.133016f,0.300016f,
-			0.128340f,0.285847f,
-			0.253626f,0.286440f,
-			0.251925f,0.284698f,
-			0.253626f,0.286440f,
-			0.128340f,0.285847f,
-			0.128340f,0.285847f,
-			0.125903f,0.284422f,
-			0.251925f,0.284698f,
-			0.251263f,0.293078f,
-			0.251925f,0.284698f,
-			0.125903f,0.284422f,
-			0.125903f,0.284422f,
-			0.125092f,0.292918f,
-			0.251263f,0.293078f,
-			0.251125f,0.309204f,
-			0.251263f,0.293078f,
-			0.125092f,0.292918f,
-			0.125092f,0.292918f,
-			0.125060f,0.309061f,
-			0.251125f,0.309204f,
-			0.377903f,0.286315f,
-			0.378448f,0.300242f,
-			0.256709f,0.301160f,
-			0.256709f,0.301160f,
-			0.253626f,0.286440f,
-			0.377903f,0.286315f,
-			0.377472f,0.284988f,
-			0.377903f,0.286315f,
-			0.253626f,0.286440f,
-			0.253626f,0.286440f,
-			0.251925f,0.284698f,
-			0.377472f,0.284988f,
-			0.377164f,0.293492f,
-			0.377472f,0.284988f,
-			0.251925f,0.284698f,
-			0.251925f,0.284698f,
-			0.251263f,0.293078f,
-			0.377164f,0.293492f,
-			0.376956f,0.309601f,
-			0.377164f,0.293492f,
-			0.251263f,0.293078f,
-			0.251263f,0.293078f,
-			0.251125f,0.309204f,
-			0.376956f,0.309601f,
-			0.508931f,0.286869f,
-			0.508800f,0.300019f,
-			0.378448f,0.300242f,
-			0.378448f,0.300242f,
-			0.377903f,0.286315f,
-			0.508931f,0.286869f,
-			0.508779f,0.285923f,
-			0.508931f,0.286869f,
-			0.377903f,0.286315f,
-			0.377903f,0.286315f,
-			0.377472f,0.284988f,
-			0.508779f,0.285923f,
-			0.508486f,0.294510f,
-			0.508779f,0.285923f,
-			0.377472f,0.284988f,
-			0.377472f,0.284988f,
-			0.377164f,0.293492f,
-			0.508486f,0.294510f,
-			0.508185f,0.310555f,
-			0.508486f,0.294510f,
-			0.377164f,0.293492f,
-			0.377164f,0.293492f,
-			0.376956f,0.309601f,
-			0.508185f,0.310555f,
-			0.638834f,0.289293f,
-			0.638680f,0.302358f,
-			0.508800f,0.300019f,
-			0.508800f,0.300019f,
-			0.508931f,0.286869f,
-			0.638834f,0.289293f,
-			0.638656f,0.288316f,
-			0.638834f,0.289293f,
-			0.508931f,0.286869f,
-			0.508931f,0.286869f,
-			0.508779f,0.285923f,
-			0.638656f,0.288316f,
-			0.638310f,0.296805f,
-			0.638656f,0.288316f,
-			0.508779f,0.285923f,
-			0.508779f,0.285923f,
-			0.508486f,0.294510f,
-			0.638310f,0.296805f,
-			0.637953f,0.312707f,
-			0.638310f,0.296805f,
-			0.508486f,0.294510f,
-			0.508486f,0.294510f,
-			0.508185f,0.310555f,
-			0.637953f,0.312707f,
-			0.760896f,0.291600f,
-			0.760744f,0.304580f,
-			0.638680f,0.302358f,
-			0.638680f,0.302358f,
-			0.638834f,0.289293f,
-			0.760896f,0.291600f,
-			0.760720f,0.290594f,
-			0.760896f,0.291600f,
-			0.638834f,0.289293f,
-			0.638834f,0.289293f,
-			0.638656f,0.288316f,
-			0.760720f,0.290594f,
-			0.760376f,0.298985f,
-			0.760720f,0.290594f,
-			0.638656f,0.288316f,
-			0.638656f,0.288316f,
-			0.638310f,0.296805f,
-			0.760376f,0.298985f,
-			0.760022f,0.314746f,
-			0.760376f,0.298985f,
-			0.638310f,0.296805f,
-			0.638310f,0.296805f,
-			0.637953f,0.312707f,
-			0.760022f,0.314746f,
-			0.881419f,0.293263f,
-			0.881289f,0.306176f,
-			0.760744f,0.304580f,
-			0.760744f,0.304580f,
-			0.760896f,0.291600f,
-			0.881419f,0.293263f,
-			0.881268f,0.292230f,
-			0.881419f,0.293263f,
-			0.760896f,0.291600f,
-			0.760896f,0.291600f,
-			0.760720f,0.290594f,
-			0.881268f,0.292230f,
-			0.880974f,0.300539f,
-			0.881268f,0.292230f,
-			0.760720f,0.290594f,
-			0.760720f,0.290594f,
-			0.760376f,0.298985f,
-			0.880974f,0.300539f,
-			0.880672f,0.316186f,
-			0.880974f,0.300539f,
-			0.760376f,0.298985f,
-			0.760376f,0.298985f,
-			0.760022f,0.314746f,
-			0.880672f,0.316186f,
-			1.006558f,0.294427f,
-			1.006469f,0.307289f,
-			0.881289f,0.306176f,
-			0.881289f,0.306176f,
-			0.881419f,0.293263f,
-			1.006558f,0.294427f,
-			1.006455f,0.293372f,
-			1.006558f,0.294427f,
-			0.881419f,0.293263f,
-			0.881419f,0.293263f,
-			0.881268f,0.292230f,
-			1.006455f,0.293372f,
-			1.006255f,0.301617f,
-			1.006455f,0.293372f,
-			0.881268f,0.292230f,
-			0.881268f,0.292230f,
-			0.880974f,0.300539f,
-			1.006255f,0.301617f,
-			1.006049f,0.317178f,
-			1.006255f,0.301617f,
-			0.880974f,0.300539f,
-			0.880974f,0.300539f,
-			0.880672f,0.316186f,
-			1.006049f,0.317178f,
-			1.130702f,0.295669f,
-			1.130667f,0.308487f,
-			1.006469f,0.307289f,
-			1.006469f,0.307289f,
-			1.006558f,0.294427f,
-			1.130702f,0.295669f,
-			1.130662f,0.294602f,
-			1.130702f,0.295669f,
-			1.006558f,0.294427f,
-			1.006558f,0.294427f,
-			1.006455f,0.293372f,
-			1.130662f,0.294602f,
-			1.130583f,0.302803f,
-			1.130662f,0.294602f,
-			1.006455f,0.293372f,
-			1.006455f,0.293372f,
-			1.006255f,0.301617f,
-			1.130583f,0.302803f,
-			1.130502f,0.318295f,
-			1.130583f,0.302803f,
-			1.006255f,0.301617f,
-			1.006255f,0.301617f,
-			1.006049f,0.317178f,
-			1.130502f,0.318295f,
-			1.248597f,0.295993f,
-			1.248618f,0.308802f,
-			1.130667f,0.308487f,
-			1.130667f,0.308487f,
-			1.130702f,0.295669f,
-			1.248597f,0.295993f,
-			1.248621f,0.294927f,
-			1.248597f,0.295993f,
-			1.130702f,0.295669f,
-			1.130702f,0.295669f,
-			1.130662f,0.294602f,
-			1.248621f,0.294927f,
-			1.248667f,0.303120f,
-			1.248621f,0.294927f,
-			1.130662f,0.294602f,
-			1.130662f,0.294602f,
-			1.130583f,0.302803f,
-			1.248667f,0.303120f,
-			1.248715f,0.318597f,
-			1.248667f,0.303120f,
-			1.130583f,0.302803f,
-			1.130583f,0.302803f,
-			1.130502f,0.318295f,
-			1.248715f,0.318597f,
-			1.366688f,0.295135f,
-			1.366762f,0.307974f,
-			1.248618f,0.308802f,
-			1.248618f,0.308802f,
-			1.248597f,0.295993f,
-			1.366688f,0.295135f,
-			1.366773f,0.294076f,
-			1.366688f,0.295135f,
-			1.248597f,0.295993f,
-			1.248597f,0.295993f,
-			1.248621f,0.294927f,
-			1.366773f,0.294076f,
-			1.366940f,0.302300f,
-			1.366773f,0.294076f,
-			1.248621f,0.294927f,
-			1.248621f,0.294927f,
-			1.248667f,0.303120f,
-			1.366940f,0.302300f,
-			1.367111f,0.317827f,
-			1.366940f,0.302300f,
-			1.248667f,0.303120f,
-			1.248667f,0.303120f,
-			1.248715f,0.318597f,
-			1.367111f,0.317827f,
-			1.491450f,0.293397f,
-			1.491570f,0.306300f,
-			1.366762f,0.307974f,
-			1.366762f,0.307974f,
-			1.366688f,0.295135f,
-			1.491450f,0.293397f,
-			1.491589f,0.292356f,
-			1.491450f,0.293397f,
-			1.366688f,0.295135f,
-			1.366688f,0.295135f,
-			1.366773f,0.294076f,
-			1.491589f,0.292356f,
-			1.491859f,0.300647f,
-			1.491589f,0.292356f,
-			1.366773f,0.294076f,
-			1.366773f,0.294076f,
-			1.366940f,0.302300f,
-			1.491859f,0.300647f,
-			1.492138f,0.316275f,
-			1.491859f,0.300647f,
-			1.366940f,0.302300f,
-			1.366940f,0.302300f,
-			1.367111f,0.317827f,
-			1.492138f,0.316275f,
-			1.619502f,0.391439f,
-			1.618425f,0.314975f,
-			1.492138f,0.316275f,
-			1.492138f,0.316275f,
-			1.493007f,0.392210f,
-			1.619502f,0.391439f,
-			1.620266f,0.462930f,
-			1.619502f,0.391439f,
-			1.493007f,0.392210f,
-			1.493007f,0.392210f,
-			1.493627f,0.463181f,
-			1.620266f,0.462930f,
-			1.620732f,0.524792f,
-			1.620266f,0.462930f,
-			1.493627f,0.463181f,
-			1.493627f,0.463181f,
-			1.494005f,0.524639f,
-			1.620732f,0.524792f,
-			1.620895f,0.578049f,
-			1.620732f,0.524792f,
-			1.494005f,0.524639f,
-			1.494005f,0.524639f,
-			1.494137f,0.577593f,
-			1.620895f,0.578049f,
-			1.741258f,0.390493f,
-			1.740137f,0.313406f,
-			1.618425f,0.314975f,
-			1.618425f,0.314975f,
-			1.619502f,0.391439f,
-			1.741258f,0.390493f,
-			1.742053f,0.462616f,
-			1.741258f,0.390493f,
-			1.619502f,0.391439f,
-			1.619502f,0.391439f,
-			1.620266f,0.462930f,
-			1.742053f,0.462616f,
-			1.742537f,0.524985f,
-			1.742053f,0.462616f,
-			1.620266f,0.462930f,
-			1.620266f,0.462930f,
-			1.620732f,0.524792f,
-			1.742537f,0.524985f,
-			1.742706f,0.578622f,
-			1.742537f,0.524985f,
-			1.620732f,0.524792f,
-			1.620732f,0.524792f,
-			1.620895f,0.578049f,
-			1.742706f,0.578622f,
-			1.864325f,0.389258f,
-			1.863321f,0.311425f,
-			1.740137f,0.313406f,
-			1.740137f,0.313406f,
-			1.741258f,0.390493f,
-			1.864325f,0.389258f,
-			1.865035f,0.462196f,
-			1.864325f,0.389258f,
-			1.741258f,0.390493f,
-			1.741258f,0.390493f,
-			1.742053f,0.462616f,
-			1.865035f,0.462196f,
-			1.865466f,0.525249f,
-			1.865035f,0.462196f,
-			1.742053f,0.462616f,
-			1.742053f,0.462616f,
-			1.742537f,0.524985f,
-			1.865466f,0.525249f,
-			1.865617f,0.579412f,
-			1.865466f,0.525249f,
-			1.742537f,0.524985f,
-			1.742537f,0.524985f,
-			1.742706f,0.578622f,
-			1.865617f,0.579412f,
-			1.994847f,0.388073f,
-			1.994136f,0.309548f,
-			1.863321f,0.311425f,
-			1.863321f,0.311425f,
-			1.864325f,0.389258f,
-			1.994847f,0.388073f,
-			1.995349f,0.461790f,
-			1.994847f,0.388073f,
-			1.864325f,0.389258f,
-			1.864325f,0.389258f,
-			1.865035f,0.462196f,
-			1.995349f,0.461790f,
-			1.995654f,0.525505f,
-			1.995349f,0.461790f,
-			1.865035f,0.462196f,
-			1.865035f,0.462196f,
-			1.865466f,0.525249f,
-			1.995654f,0.525505f,
-			1.995760f,0.580179f,
-			1.995654f,0.525505f,
-			1.865466f,0.525249f,
-			1.865466f,0.525249f,
-			1.865617f,0.579412f,
-			1.995760f,0.580179f,
-			0.125345f,0.387803f,
-			0.125060f,0.309061f,
-			-0.005864f,0.309548f,
-			-0.005864f,0.309548f,
-			-0.005153f,0.388073f,
-			0.125345f,0.387803f,
-			0.125547f,0.461708f,
-			0.125345f,0.387803f,
-			-0.005153f,0.388073f,
-			-0.005153f,0.388073f,
-			-0.004651f,0.461790f,
-			0.125547f,0.461708f,
-			0.125669f,0.525552f,
-			0.125547f,0.461708f,
-			-0.004651f,0.461790f,
-			-0.004651f,0.461790f,
-			-0.004346f,0.525505f,
-			0.125669f,0.525552f,
-			0.125711f,0.580315f,
-			0.125669f,0.525552f,
-			-0.004346f,0.525505f,
-			-0.004346f,0.525505f,
-			-0.004240f,0.580179f,
-			0.125711f,0.580315f,
-			0.250956f,0.387909f,
-			0.251125f,0.309204f,
-			0.125060f,0.309061f,
-			0.125060f,0.309061f,
-			0.125345f,0.387803f,
-			0.250956f,0.387909f,
-			0.250837f,0.461749f,
-			0.250956f,0.387909f,
-			0.125345f,0.387803f,
-			0.125345f,0.387803f,
-			0.125547f,0.461708f,
-			0.250837f,0.461749f,
-			0.250764f,0.525524f,
-			0.250837f,0.461749f,
-			0.125547f,0.461708f,
-			0.125547f,0.461708f,
-			0.125669f,0.525552f,
-			0.250764f,0.525524f,
-			0.250739f,0.580229f,
-			0.250764f,0.525524f,
-			0.125669f,0.525552f,
-			0.125669f,0.525552f,
-			0.125711f,0.580315f,
-			0.250739f,0.580229f,
-			0.376360f,0.388135f,
-			0.376956f,0.309601f,
-			0.251125f,0.309204f,
-			0.251125f,0.309204f,
-			0.250956f,0.387909f,
-			0.376360f,0.388135f,
-			0.375940f,0.461819f,
-			0.376360f,0.388135f,
-			0.250956f,0.387909f,
-			0.250956f,0.387909f,
-			0.250837f,0.461749f,
-			0.375940f,0.461819f,
-			0.375685f,0.525482f,
-			0.375940f,0.461819f,
-			0.250837f,0.461749f,
-			0.250837f,0.461749f,
-			0.250764f,0.525524f,
-			0.375685f,0.525482f,
-			0.375597f,0.580109f,
-			0.375685f,0.525482f,
-			0.250764f,0.525524f,
-			0.250764f,0.525524f,
-			0.250739f,0.580229f,
-			0.375597f,0.580109f,
-			0.507249f,0.388693f,
-			0.508185f,0.310555f,
-			0.376956f,0.309601f,
-			0.376956f,0.309601f,
-			0.376360f,0.388135f,
-			0.507249f,0.388693f,
-			0.506587f,0.461998f,
-			0.507249f,0.388693f,
-			0.376360f,0.388135f,
-			0.376360f,0.388135f,
-			0.375940f,0.461819f,
-			0.506587f,0.461998f,
-			0.506185f,0.525375f,
-			0.506587f,0.461998f,
-			0.375940f,0.461819f,
-			0.375940f,0.461819f,
-			0.375685f,0.525482f,
-			0.506185f,0.525375f,
-			0.506045f,0.579794f,
-			0.506185f,0.525375f,
-			0.375685f,0.525482f,
-			0.375685f,0.525482f,
-			0.375597f,0.580109f,
-			0.506045f,0.579794f,
-			0.636846f,0.390046f,
-			0.637953f,0.312707f,
-			0.508185f,0.310555f,
-			0.508185f,0.310555f,
-			0.507249f,0.388693f,
-			0.636846f,0.390046f,
-			0.636060f,0.462461f,
-			0.636846f,0.390046f,
-			0.507249f,0.388693f,
-			0.507249f,0.388693f,
-			0.506587f,0.461998f,
-			0.636060f,0.462461f,
-			0.635583f,0.525084f,
-			0.636060f,0.462461f,
-			0.506587f,0.461998f,
-			0.506587f,0.461998f,
-			0.506185f,0.525375f,
-			0.635583f,0.525084f,
-			0.635416f,0.578920f,
-			0.635583f,0.525084f,
-			0.506185f,0.525375f,
-			0.506185f,0.525375f,
-			0.506045f,0.579794f,
-			0.635416f,0.578920f,
-			0.758921f,0.391315f,
-			0.760022f,0.314746f,
-			0.637953f,0.312707f,
-			0.637953f,0.312707f,
-			0.636846f,0.390046f,
-			0.758921f,0.391315f,
-			0.758139f,0.462893f,
-			0.758921f,0.391315f,
-			0.636846f,0.390046f,
-			0.636846f,0.390046f,
-			0.636060f,0.462461f,
-			0.758139f,0.462893f,
-			0.757662f,0.524813f,
-			0.758139f,0.462893f,
-			0.636060f,0.462461f,
-			0.636060f,0.462461f,
-			0.635583f,0.525084f,
-			0.757662f,0.524813f,
-			0.757495f,0.578108f,
-			0.757662f,0.524813f,
-			0.635583f,0.525084f,
-			0.635583f,0.525084f,
-			0.635416f,0.578920f,
-			0.757495f,0.578108f,
-			0.879728f,0.392182f,
-			0.880672f,0.316186f,
-			0.760022f,0.314746f,
-			0.760022f,0.314746f,
-			0.758921f,0.391315f,
-			0.879728f,0.392182f,
-			0.879056f,0.463179f,
-			0.879728f,0.392182f,
-			0.758921f,0.391315f,
-			0.758921f,0.391315f,
-			0.758139f,0.462893f,
-			0.879056f,0.463179f,
-			0.878647f,0.524637f,
-			0.879056f,0.463179f,
-			0.758139f,0.462893f,
-			0.758139f,0.462893f,
-			0.757662f,0.524813f,
-			0.878647f,0.524637f,
-			0.878503f,0.577582f,
-			0.878647f,0.524637f,
-			0.757662f,0.524813f,
-			0.757662f,0.524813f,
-			0.757495f,0.578108f,
-			0.878503f,0.577582f,
-			1.005404f,0.392764f,
-			1.006049f,0.317178f,
-			0.880672f,0.316186f,
-			0.880672f,0.316186f,
-			0.879728f,0.392182f,
-			1.005404f,0.392764f,
-			1.004945f,0.463368f,
-			1.005404f,0.392764f,
-			0.879728f,0.392182f,
-			0.879728f,0.392182f,
-			0.879056f,0.463179f,
-			1.004945f,0.463368f,
-			1.004664f,0.524523f,
-			1.004945f,0.463368f,
-			0.879056f,0.463179f,
-			0.879056f,0.463179f,
-			0.878647f,0.524637f,
-			1.004664f,0.524523f,
-			1.004566f,0.577244f,
-			1.004664f,0.524523f,
-			0.878647f,0.524637f,
-			0.878647f,0.524637f,
-			0.878503f,0.577582f,
-			1.004566f,0.577244f,
-			1.130248f,0.393475f,
-			1.130502f,0.318295f,
-			1.006049f,0.317178f,
-			1.006049f,0.317178f,
-			1.005404f,0.392764f,
-			1.130248f,0.393475f,
-			1.130068f,0.463615f,
-			1.130248f,0.393475f,
-			1.005404f,0.392764f,
-			1.005404f,0.392764f,
-			1.004945f,0.463368f,
-			1.130068f,0.463615f,
-			1.129957f,0.524365f,
-			1.130068f,0.463615f,
-			1.004945f,0.463368f,
-			1.004945f,0.463368f,
-			1.004664f,0.524523f,
-			1.129957f,0.524365f,
-			1.129919f,0.576767f,
-			1.129957f,0.524365f,
-			1.004664f,0.524523f,
-			1.004664f,0.524523f,
-			1.004566f,0.577244f,
-			1.129919f,0.576767f,
-			1.248865f,0.393676f,
-			1.248715f,0.318597f,
-			1.130502f,0.318295f,
-			1.130502f,0.318295f,
-			1.130248f,0.393475f,
-			1.248865f,0.393676f,
-			1.248972f,0.463687f,
-			1.248865f,0.393676f,
-			1.130248f,0.393475f,
-			1.130248f,0.393475f,
-			1.130068f,0.463615f,
-			1.248972f,0.463687f,
-			1.249037f,0.524318f,
-			1.248972f,0.463687f,
-			1.130068f,0.463615f,
-			1.130068f,0.463615f,
-			1.129957f,0.524365f,
-			1.249037f,0.524318f,
-			1.249060f,0.576623f,
-			1.249037f,0.524318f,
-			1.129957f,0.524365f,
-			1.129957f,0.524365f,
-			1.129919f,0.576767f,
-			1.249060f,0.576623f,
-			1.367646f,0.393188f,
-			1.367111f,0.317827f,
-			1.248715f,0.318597f,
-			1.248715f,0.318597f,
-			1.248865f,0.393676f,
-			1.367646f,0.393188f,
-			1.368028f,0.463518f,
-			1.367646f,0.393188f,
-			1.248865f,0.393676f,
-			1.248865f,0.393676f,
-			1.248972f,0.463687f,
-			1.368028f,0.463518f,
-			1.368261f,0.524425f,
-			1.368028f,0.463518f,
-			1.248972f,0.463687f,
-			1.248972f,0.463687f,
-			1.249037f,0.524318f,
-			1.368261f,0.524425f,
-			1.368342f,0.576948f,
-			1.368261f,0.524425f,
-			1.249037f,0.524318f,
-			1.249037f,0.524318f,
-			1.249060f,0.576623f,
-			1.368342f,0.576948f,
-			1.493007f,0.392210f,
-			1.492138f,0.316275f,
-			1.367111f,0.317827f,
-			1.367111f,0.317827f,
-			1.367646f,0.393188f,
-			1.493007f,0.392210f,
-			1.493627f,0.463181f,
-			1.493007f,0.392210f,
-			1.367646f,0.393188f,
-			1.367646f,0.393188f,
-			1.368028f,0.463518f,
-			1.493627f,0.463181f,
-			1.494005f,0.524639f,
-			1.493627f,0.463181f,
-			1.368028f,0.463518f,
-			1.368028f,0.463518f,
-			1.368261f,0.524425f,
-			1.494005f,0.524639f,
-			1.494137f,0.577593f,
-			1.494005f,0.524639f,
-			1.368261f,0.524425f,
-			1.368261f,0.524425f,
-			1.368342f,0.576948f,
-			1.494137f,0.577593f,
-			1.620594f,0.624777f,
-			1.620895f,0.578049f,
-			1.494137f,0.577593f,
-			1.494137f,0.577593f,
-			1.493892f,0.624055f,
-			1.620594f,0.624777f,
-			1.619836f,0.666792f,
-			1.620594f,0.624777f,
-			1.493892f,0.624055f,
-			1.493892f,0.624055f,
-			1.493278f,0.665786f,
-			1.619836f,0.666792f,
-			1.618914f,0.701505f,
-			1.619836f,0.666792f,
-			1.493278f,0.665786f,
-			1.493278f,0.665786f,
-			1.492532f,0.700238f,
-			1.618914f,0.701505f,
-			1.618425f,0.720180f,
-			1.618914f,0.701505f,
-			1.492532f,0.700238f,
-			1.492532f,0.700238f,
-			1.492138f,0.718789f,
-			1.618425f,0.720180f,
-			1.742393f,0.625680f,
-			1.742706f,0.578622f,
-			1.620895f,0.578049f,
-			1.620895f,0.578049f,
-			1.620594f,0.624777f,
-			1.742393f,0.625680f,
-			1.741606f,0.668030f,
-			1.742393f,0.625680f,
-			1.620594f,0.624777f,
-			1.620594f,0.624777f,
-			1.619836f,0.666792f,
-			1.741606f,0.668030f,
-			1.740647f,0.703041f,
-			1.741606f,0.668030f,
-			1.619836f,0.666792f,
-			1.619836f,0.666792f,
-			1.618914f,0.701505f,
-			1.740647f,0.703041f,
-			1.740137f,0.721857f,
-			1.740647f,0.703041f,
-			1.618914f,0.701505f,
-			1.618914f,0.701505f,
-			1.618425f,0.720180f,
-			1.740137f,0.721857f,
-			1.865338f,0.626905f,
-			1.865617f,0.579412f,
-			1.742706f,0.578622f,
-			1.742706f,0.578622f,
-			1.742393f,0.625680f,
-			1.865338f,0.626905f,
-			1.864635f,0.669658f,
-			1.865338f,0.626905f,
-			1.742393f,0.625680f,
-			1.742393f,0.625680f,
-			1.741606f,0.668030f,
-			1.864635f,0.669658f,
-			1.863777f,0.705002f,
-			1.864635f,0.669658f,
-			1.741606f,0.668030f,
-			1.741606f,0.668030f,
-			1.740647f,0.703041f,
-			1.863777f,0.705002f,
-			1.863321f,0.723968f,
-			1.863777f,0.705002f,
-			1.740647f,0.703041f,
-			1.740647f,0.703041f,
-			1.740137f,0.721857f,
-			1.863321f,0.723968f,
-			1.995563f,0.628090f,
-			1.995760f,0.580179f,
-			1.865617f,0.579412f,
-			1.865617f,0.579412f,
-			1.865338f,0.626905f,
-			1.995563f,0.628090f,
-			1.995066f,0.671219f,
-			1.995563f,0.628090f,
-			1.865338f,0.626905f,
-			1.865338f,0.626905f,
-			1.864635f,0.669658f,
-			1.995066f,0.671219f,
-			1.994459f,0.706864f,
-			1.995066f,0.671219f,
-			1.864635f,0.669658f,
-			1.864635f,0.669658f,
-			1.863777f,0.705002f,
-			1.994459f,0.706864f,
-			1.994136f,0.725962f,
-			1.994459f,0.706864f,
-			1.863777f,0.705002f,
-			1.863777f,0.705002f,
-			1.863321f,0.723968f,
-			1.994136f,0.725962f,
-			0.125633f,0.628313f,
-			0.125711f,0.580315f,
-			-0.004240f,0.580179f,
-			-0.004240f,0.580179f,
-			-0.004437f,0.628090f,
-			0.125633f,0.628313f,
-			0.125433f,0.671557f,
-			0.125633f,0.628313f,
-			-0.004437f,0.628090f,
-			-0.004437f,0.628090f,
-			-0.004934f,0.671219f,
-			0.125433f,0.671557f,
-			0.125190f,0.707321f,
-			0.125433f,0.671557f,
-			-0.004934f,0.671219f,
-			-0.004934f,0.671219f,
-			-0.005541f,0.706864f,
-			0.125190f,0.707321f,
-			0.125060f,0.726479f,
-			0.125190f,0.707321f,
-			-0.005541f,0.706864f,
-			-0.005541f,0.706864f,
-			-0.005864f,0.725962f,
-			0.125060f,0.726479f,
-			0.250786f,0.628187f,
-			0.250739f,0.580229f,
-			0.125711f,0.580315f,
-			0.125711f,0.580315f,
-			0.125633f,0.628313f,
-			0.250786f,0.628187f,
-			0.250904f,0.671410f,
-			0.250786f,0.628187f,
-			0.125633f,0.628313f,
-			0.125633f,0.628313f,
-			0.125433f,0.671557f,
-			0.250904f,0.671410f,
-			0.251048f,0.707169f,
-			0.250904f,0.671410f,
-			0.125433f,0.671557f,
-			0.125433f,0.671557f,
-			0.125190f,0.707321f,
-			0.251048f,0.707169f,
-			0.251125f,0.726328f,
-			0.251048f,0.707169f,
-			0.125190f,0.707321f,
-			0.125190f,0.707321f,
-			0.125060f,0.726479f,
-			0.251125f,0.726328f,
-			0.375761f,0.627992f,
-			0.375597f,0.580109f,
-			0.250739f,0.580229f,
-			0.250739f,0.580229f,
-			0.250786f,0.628187f,
-			0.375761f,0.627992f,
-			0.376176f,0.671124f,
-			0.375761f,0.627992f,
-			0.250786f,0.628187f,
-			0.250786f,0.628187f,
-			0.250904f,0.671410f,
-			0.376176f,0.671124f,
-			0.376684f,0.706792f,
-			0.376176f,0.671124f,
-			0.250904f,0.671410f,
-			0.250904f,0.671410f,
-			0.251048f,0.707169f,
-			0.376684f,0.706792f,
-			0.376956f,0.725906f,
-			0.376684f,0.706792f,
-			0.251048f,0.707169f,
-			0.251048f,0.707169f,
-			0.251125f,0.726328f,
-			0.376956f,0.725906f,
-			0.506304f,0.627489f,
-			0.506045f,0.579794f,
-			0.375597f,0.580109f,
-			0.375597f,0.580109f,
-			0.375761f,0.627992f,
-			0.506304f,0.627489f,
-			0.506959f,0.670410f,
-			0.506304f,0.627489f,
-			0.375761f,0.627992f,
-			0.375761f,0.627992f,
-			0.376176f,0.671124f,
-			0.506959f,0.670410f,
-			0.507759f,0.705876f,
-			0.506959f,0.670410f,
-			0.376176f,0.671124f,
-			0.376176f,0.671124f,
-			0.376684f,0.706792f,
-			0.507759f,0.705876f,
-			0.508185f,0.724893f,
-			0.507759f,0.705876f,
-			0.376684f,0.706792f,
-			0.376684f,0.706792f,
-			0.376956f,0.725906f,
-			0.508185f,0.724893f,
-			0.635725f,0.626138f,
-			0.635416f,0.578920f,
-			0.506045f,0.579794f,
-			0.506045f,0.579794f,
-			0.506304f,0.627489f,
-			0.635725f,0.626138f,
-			0.636502f,0.668625f,
-			0.635725f,0.626138f,
-			0.506304f,0.627489f,
-			0.506304f,0.627489f,
-			0.506959f,0.670410f,
-			0.636502f,0.668625f,
-			0.637450f,0.703741f,
-			0.636502f,0.668625f,
-			0.506959f,0.670410f,
-			0.506959f,0.670410f,
-			0.507759f,0.705876f,
-			0.637450f,0.703741f,
-			0.637953f,0.722602f,
-			0.637450f,0.703741f,
-			0.507759f,0.705876f,
-			0.507759f,0.705876f,
-			0.508185f,0.724893f,
-			0.637953f,0.722602f,
-			0.757803f,0.624877f,
-			0.757495f,0.578108f,
-			0.635416f,0.578920f,
-			0.635416f,0.578920f,
-			0.635725f,0.626138f,
-			0.757803f,0.624877f,
-			0.758579f,0.666947f,
-			0.757803f,0.624877f,
-			0.635725f,0.626138f,
-			0.635725f,0.626138f,
-			0.636502f,0.668625f,
-			0.758579f,0.666947f,
-			0.759522f,0.701719f,
-			0.758579f,0.666947f,
-			0.636502f,0.668625f,
-			0.636502f,0.668625f,
-			0.637450f,0.703741f,
-			0.759522f,0.701719f,
-			0.760022f,0.720425f,
-			0.759522f,0.701719f,
-			0.637450f,0.703741f,
-			0.637450f,0.703741f,
-			0.637953f,0.722602f,
-			0.760022f,0.720425f,
-			0.878769f,0.624048f,
-			0.878503f,0.577582f,
-			0.757495f,0.578108f,
-			0.757495f,0.578108f,
-			0.757803f,0.624877f,
-			0.878769f,0.624048f,
-			0.879435f,0.665811f,
-			0.878769f,0.624048f,
-			0.757803f,0.624877f,
-			0.757803f,0.624877f,
-			0.758579f,0.666947f,
-			0.879435f,0.665811f,
-			0.880244f,0.700308f,
-			0.879435f,0.665811f,
-			0.758579f,0.666947f,
-			0.758579f,0.666947f,
-			0.759522f,0.701719f,
-			0.880244f,0.700308f,
-			0.880672f,0.718885f,
-			0.880244f,0.700308f,
-			0.759522f,0.701719f,
-			0.759522f,0.701719f,
-			0.760022f,0.720425f,
-			0.880672f,0.718885f,
-			1.004748f,0.623509f,
-			1.004566f,0.577244f,
-			0.878503f,0.577582f,
-			0.878503f,0.577582f,
-			0.878769f,0.624048f,
-			1.004748f,0.623509f,
-			1.005204f,0.665052f,
-			1.004748f,0.623509f,
-			0.878769f,0.624048f,
-			0.878769f,0.624048f,
-			0.879435f,0.665811f,
-			1.005204f,0.665052f,
-			1.005757f,0.699344f,
-			1.005204f,0.665052f,
-			0.879435f,0.665811f,
-			0.879435f,0.665811f,
-			0.880244f,0.700308f,
-			1.005757f,0.699344f,
-			1.006049f,0.717820f,
-			1.005757f,0.699344f,
-			0.880244f,0.700308f,
-			0.880244f,0.700308f,
-			0.880672f,0.718885f,
-			1.006049f,0.717820f,
-			1.129990f,0.622775f,
-			1.129919f,0.576767f,
-			1.004566f,0.577244f,
-			1.004566f,0.577244f,
-			1.004748f,0.623509f,
-			1.129990f,0.622775f,
-			1.130170f,0.664096f,
-			1.129990f,0.622775f,
-			1.004748f,0.623509f,
-			1.004748f,0.623509f,
-			1.005204f,0.665052f,
-			1.130170f,0.664096f,
-			1.130387f,0.698219f,
-			1.130170f,0.664096f,
-			1.005204f,0.665052f,
-			1.005204f,0.665052f,
-			1.005757f,0.699344f,
-			1.130387f,0.698219f,
-			1.130502f,0.716622f,
-			1.130387f,0.698219f,
-			1.005757f,0.699344f,
-			1.005757f,0.699344f,
-			1.006049f,0.717820f,
-			1.130502f,0.716622f,
-			1.249017f,0.622556f,
-			1.249060f,0.576623f,
-			1.129919f,0.576767f,
-			1.129919f,0.576767f,
-			1.129990f,0.622775f,
-			1.249017f,0.622556f,
-			1.248911f,0.663822f,
-			1.249017f,0.622556f,
-			1.129990f,0.622775f,
-			1.129990f,0.622775f,
-			1.130170f,0.664096f,
-			1.248911f,0.663822f,
-			1.248783f,0.697908f,
-			1.248911f,0.663822f,
-			1.130170f,0.664096f,
-			1.130170f,0.664096f,
-			1.130387f,0.698219f,
-			1.248783f,0.697908f,
-			1.248715f,0.716297f,
-			1.248783f,0.697908f,
-			1.130387f,0.698219f,
-			1.130387f,0.698219f,
-			1.130502f,0.716622f,
-			1.248715f,0.716297f,
-			1.368191f,0.623058f,
-			1.368342f,0.576948f,
-			1.249060f,0.576623f,
-			1.249060f,0.576623f,
-			1.249017f,0.622556f,
-			1.368191f,0.623058f,
-			1.367813f,0.664478f,
-			1.368191f,0.623058f,
-			1.249017f,0.622556f,
-			1.249017f,0.622556f,
-			1.248911f,0.663822f,
-			1.367813f,0.664478f,
-			1.367353f,0.698683f,
-			1.367813f,0.664478f,
-			1.248911f,0.663822f,
-			1.248911f,0.663822f,
-			1.248783f,0.697908f,
-			1.367353f,0.698683f,
-			1.367111f,0.717125f,
-			1.367353f,0.698683f,
-			1.248783f,0.697908f,
-			1.248783f,0.697908f,
-			1.248715f,0.716297f,
-			1.367111f,0.717125f,
-			1.493892f,0.624055f,
-			1.494137f,0.577593f,
-			1.368342f,0.576948f,
-			1.368342f,0.576948f,
-			1.368191f,0.623058f,
-			1.493892f,0.624055f,
-			1.493278f,0.665786f,
-			1.493892f,0.624055f,
-			1.368191f,0.623058f,
-			1.368191f,0.623058f,
-			1.367813f,0.664478f,
-			1.493278f,0.665786f,
-			1.492532f,0.700238f,
-			1.493278f,0.665786f,
-			1.367813f,0.664478f,
-			1.367813f,0.664478f,
-			1.367353f,0.698683f,
-			1.492532f,0.700238f,
-			1.492138f,0.718789f,
-			1.492532f,0.700238f,
-			1.367353f,0.698683f,
-			1.367353f,0.698683f,
-			1.367111f,0.717125f,
-			1.492138f,0.718789f,
-			1.618197f,0.730518f,
-			1.618425f,0.720180f,
-			1.492138f,0.718789f,
-			1.492138f,0.718789f,
-			1.491953f,0.729071f,
-			1.618197f,0.730518f,
-			1.616773f,0.757071f,
-			1.618197f,0.730518f,
-			1.491953f,0.729071f,
-			1.491953f,0.729071f,
-			1.490806f,0.755359f,
-			1.616773f,0.757071f,
-			1.610641f,0.825606f,
-			1.616773f,0.757071f,
-			1.490806f,0.755359f,
-			1.490806f,0.755359f,
-			1.485909f,0.823110f,
-			1.610641f,0.825606f,
-			1.204937f,0.989451f,
-			1.610641f,0.825606f,
-			1.485909f,0.823110f,
-			1.739900f,0.732256f,
-			1.740137f,0.721857f,
-			1.618425f,0.720180f,
-			1.618425f,0.720180f,
-			1.618197f,0.730518f,
-			1.739900f,0.732256f,
-			1.738411f,0.759100f,
-			1.739900f,0.732256f,
-			1.618197f,0.730518f,
-			1.618197f,0.730518f,
-			1.616773f,0.757071f,
-			1.738411f,0.759100f,
-			1.731939f,0.828479f,
-			1.738411f,0.759100f,
-			1.616773f,0.757071f,
-			1.616773f,0.757071f,
-			1.610641f,0.825606f,
-			1.731939f,0.828479f,
-			1.204937f,0.989451f,
-			1.731939f,0.828479f,
-			1.610641f,0.825606f,
-			1.863107f,0.734431f,
-			1.863321f,0.723968f,
-			1.740137f,0.721857f,
-			1.740137f,0.721857f,
-			1.739900f,0.732256f,
-			1.863107f,0.734431f,
-			1.861769f,0.761563f,
-			1.863107f,0.734431f,
-			1.739900f,0.732256f,
-			1.739900f,0.732256f,
-			1.738411f,0.759100f,
-			1.861769f,0.761563f,
-			1.855899f,0.831725f,
-			1.861769f,0.761563f,
-			1.738411f,0.759100f,
-			1.738411f,0.759100f,
-			1.731939f,0.828479f,
-			1.855899f,0.831725f,
-			1.204937f,0.989451f,
-			1.855899f,0.831725f,
-			1.731939f,0.828479f,
-			1.993984f,0.736481f,
-			1.994136f,0.725962f,
-			1.863321f,0.723968f,
-			1.863321f,0.723968f,
-			1.863107f,0.734431f,
-			1.993984f,0.736481f,
-			1.993033f,0.763861f,
-			1.993984f,0.736481f,
-			1.863107f,0.734431f,
-			1.863107f,0.734431f,
-			1.861769f,0.761563f,
-			1.993033f,0.763861f,
-			1.988824f,0.834680f,
-			1.993033f,0.763861f,
-			1.861769f,0.761563f,
-			1.861769f,0.761563f,
-			1.855899f,0.831725f,
-			1.988824f,0.834680f,
-			1.204937f,0.989451f,
-			1.988824f,0.834680f,
-			1.855899f,0.831725f,
-			0.124999f,0.737025f,
-			0.125060f,0.726479f,
-			-0.005864f,0.725962f,
-			-0.005864f,0.725962f,
-			-0.006016f,0.736481f,
-			0.124999f,0.737025f,
-			0.124616f,0.764547f,
-			0.124999f,0.737025f,
-			-0.006016f,0.736481f,
-			-0.006016f,0.736481f,
-			-0.006967f,0.763861f,
-			0.124616f,0.764547f,
-			0.122914f,0.835832f,
-			0.124616f,0.764547f,
-			-0.006967f,0.763861f,
-			-0.006967f,0.763861f,
-			-0.011176f,0.834680f,
-			0.122914f,0.835832f,
-			-0.795063f,0.989451f,
-			0.122914f,0.835832f,
-			-0.011176f,0.834680f,
-			0.251161f,0.736875f,
-			0.251125f,0.726328f,
-			0.125060f,0.726479f,
-			0.125060f,0.726479f,
-			0.124999f,0.737025f,
-			0.251161f,0.736875f,
-			0.251387f,0.764413f,
-			0.251161f,0.736875f,
-			0.124999f,0.737025f,
-			0.124999f,0.737025f,
-			0.124616f,0.764547f,
-			0.251387f,0.764413f,
-			0.252395f,0.835775f,
-			0.251387f,0.764413f,
-			0.124616f,0.764547f,
-			0.124616f,0.764547f,
-			0.122914f,0.835832f,
-			0.252395f,0.835775f,
-			-0.795063f,0.989451f,
-			0.252395f,0.835775f,
-			0.122914f,0.835832f,
-			0.377082f,0.736433f,
-			0.376956f,0.725906f,
-			0.251125f,0.726328f,
-			0.251125f,0.726328f,
-			0.251161f,0.736875f,
-			0.377082f,0.736433f,
-			0.377878f,0.763866f,
-			0.377082f,0.736433f,
-			0.251161f,0.736875f,
-			0.251161f,0.736875f,
-			0.251387f,0.764413f,
-			0.377878f,0.763866f,
-			0.381409f,0.834892f,
-			0.377878f,0.763866f,
-			0.251387f,0.764413f,
-			0.251387f,0.764413f,
-			0.252395f,0.835775f,
-			0.381409f,0.834892f,
-			1.204937f,0.989451f,
-			0.381409f,0.834892f,
-			0.252395f,0.835775f,
-			0.508384f,0.735377f,
-			0.508185f,0.724893f,
-			0.376956f,0.725906f,
-			0.376956f,0.725906f,
-			0.377082f,0.736433f,
-			0.508384f,0.735377f,
-			0.509634f,0.762591f,
-			0.508384f,0.735377f,
-			0.377082f,0.736433f,
-			0.377082f,0.736433f,
-			0.377878f,0.763866f,
-			0.509634f,0.762591f,
-			0.515130f,0.832934f,
-			0.509634f,0.762591f,
-			0.377878f,0.763866f,
-			0.377878f,0.763866f,
-			0.381409f,0.834892f,
-			0.515130f,0.832934f,
-			1.204937f,0.989451f,
-			0.515130f,0.832934f,
-			0.381409f,0.834892f,
-			0.638189f,0.733021f,
-			0.637953f,0.722602f,
-			0.508185f,0.724893f,
-			0.508185f,0.724893f,
-			0.508384f,0.735377f,
-			0.638189f,0.733021f,
-			0.639663f,0.759942f,
-			0.638189f,0.733021f,
-			0.508384f,0.735377f,
-			0.508384f,0.735377f,
-			0.509634f,0.762591f,
-			0.639663f,0.759942f,
-			0.646080f,0.829509f,
-			0.639663f,0.759942f,
-			0.509634f,0.762591f,
-			0.509634f,0.762591f,
-			0.515130f,0.832934f,
-			0.646080f,0.829509f,
-			1.204937f,0.989451f,
-			0.646080f,0.829509f,
-			0.515130f,0.832934f,
-			0.760256f,0.730777f,
-			0.760022f,0.720425f,
-			0.637953f,0.722602f,
-			0.637953f,0.722602f,
-			0.638189f,0.733021f,
-			0.760256f,0.730777f,
-			0.761716f,0.757402f,
-			0.760256f,0.730777f,
-			0.638189f,0.733021f,
-			0.638189f,0.733021f,
-			0.639663f,0.759942f,
-			0.761716f,0.757402f,
-			0.768015f,0.826171f,
-			0.761716f,0.757402f,
-			0.639663f,0.759942f,
-			0.639663f,0.759942f,
-			0.646080f,0.829509f,
-			0.768015f,0.826171f,
-			1.204937f,0.989451f,
-			0.768015f,0.826171f,
-			0.646080f,0.829509f,
-			0.880872f,0.729179f,
-			0.880672f,0.718885f,
-			0.760022f,0.720425f,
-			0.760022f,0.720425f,
-			0.760256f,0.730777f,
-			0.880872f,0.729179f,
-			0.882119f,0.755536f,
-			0.880872f,0.729179f,
-			0.760256f,0.730777f,
-			0.760256f,0.730777f,
-			0.761716f,0.757402f,
-			0.882119f,0.755536f,
-			0.887452f,0.823531f,
-			0.882119f,0.755536f,
-			0.761716f,0.757402f,
-			0.761716f,0.757402f,
-			0.768015f,0.826171f,
-			0.887452f,0.823531f,
-			1.204937f,0.989451f,
-			0.887452f,0.823531f,
-			0.768015f,0.826171f,
-			1.006186f,0.728070f,
-			1.006049f,0.717820f,
-			0.880672f,0.718885f,
-			0.880672f,0.718885f,
-			0.880872f,0.729179f,
-			1.006186f,0.728070f,
-			1.007034f,0.754214f,
-			1.006186f,0.728070f,
-			0.880872f,0.729179f,
-			0.880872f,0.729179f,
-			0.882119f,0.755536f,
-			1.007034f,0.754214f,
-			1.010642f,0.821570f,
-			1.007034f,0.754214f,
-			0.882119f,0.755536f,
-			0.882119f,0.755536f,
-			0.887452f,0.823531f,
-			1.010642f,0.821570f,
-			1.204937f,0.989451f,
-			1.010642f,0.821570f,
-			0.887452f,0.823531f,
-			1.130556f,0.726840f,
-			1.130502f,0.716622f,
-			1.006049f,0.717820f,
-			1.006049f,0.717820f,
-			1.006186f,0.728070f,
-			1.130556f,0.726840f,
-			1.130889f,0.752859f,
-			1.130556f,0.726840f,
-			1.006186f,0.728070f,
-			1.006186f,0.728070f,
-			1.007034f,0.754214f,
-			1.130889f,0.752859f,
-			1.132301f,0.819929f,
-			1.130889f,0.752859f,
-			1.007034f,0.754214f,
-			1.007034f,0.754214f,
-			1.010642f,0.821570f,
-			1.132301f,0.819929f,
-			1.204937f,0.989451f,
-			1.132301f,0.819929f,
-			1.010642f,0.821570f,
-			1.248683f,0.726510f,
-			1.248715f,0.716297f,
-			1.130502f,0.716622f,
-			1.130502f,0.716622f,
-			1.130556f,0.726840f,
-			1.248683f,0.726510f,
-			1.248486f,0.752514f,
-			1.248683f,0.726510f,
-			1.130556f,0.726840f,
-			1.130556f,0.726840f,
-			1.130889f,0.752859f,
-			1.248486f,0.752514f,
-			1.247653f,0.819574f,
-			1.248486f,0.752514f,
-			1.130889f,0.752859f,
-			1.130889f,0.752859f,
-			1.132301f,0.819929f,
-			1.247653f,0.819574f,
-			1.204937f,0.989451f,
-			1.247653f,0.819574f,
-			1.132301f,0.819929f,
-			1.366998f,0.727360f,
-			1.367111f,0.717125f,
-			1.248715f,0.716297f,
-			1.248715f,0.716297f,
-			1.248683f,0.726510f,
-			1.366998f,0.727360f,
-			1.366293f,0.753454f,
-			1.366998f,0.727360f,
-			1.248683f,0.726510f,
-			1.248683f,0.726510f,
-			1.248486f,0.752514f,
-			1.366293f,0.753454f,
-			1.363303f,0.820727f,
-			1.366293f,0.753454f,
-			1.248486f,0.752514f,
-			1.248486f,0.752514f,
-			1.247653f,0.819574f,
-			1.363303f,0.820727f,
-			1.204937f,0.989451f,
-			1.363303f,0.820727f,
-			1.247653f,0.819574f,
-			1.491953f,0.729071f,
-			1.492138f,0.718789f,
-			1.367111f,0.717125f,
-			1.367111f,0.717125f,
-			1.366998f,0.727360f,
-			1.491953f,0.729071f,
-			1.490806f,0.755359f,
-			1.491953f,0.729071f,
-			1.366998f,0.727360f,
-			1.366998f,0.727360f,
-			1.366293f,0.753454f,
-			1.490806f,0.755359f,
-			1.485909f,0.823110f,
-			1.490806f,0.755359f,
-			1.366293f,0.753454f,
-			1.366293f,0.753454f,
-			1.363303f,0.820727f,
-			1.485909f,0.823110f,
-			1.204937f,0.989451f,
-			1.485909f,0.823110f,
-			1.363303f,0.820727f,
-			0.479631f,0.402272f,
-			0.473232f,0.373287f,
-			0.507648f,0.380177f,
-			0.507648f,0.380177f,
-			0.505837f,0.406405f,
-			0.479631f,0.402272f,
-			0.482660f,0.419782f,
-			0.479631f,0.402272f,
-			0.505837f,0.406405f,
-			0.505837f,0.406405f,
-			0.504955f,0.422465f,
-			0.482660f,0.419782f,
-			0.484110f,0.435220f,
-			0.482660f,0.419782f,
-			0.504955f,0.422465f,
-			0.504955f,0.422465f,
-			0.504525f,0.436476f,
-			0.484110f,0.435220f,
-			0.484550f,0.454087f,
-			0.484110f,0.435220f,
-			0.504525f,0.436476f,
-			0.504525f,0.436476f,
-			0.504394f,0.453240f,
-			0.484550f,0.454087f,
-			0.471374f,0.393351f,
-			0.460984f,0.357852f,
-			0.473232f,0.373287f,
-			0.473232f,0.373287f,
-			0.479631f,0.402272f,
-			0.471374f,0.393351f,
-			0.475994f,0.414078f,
-			0.471374f,0.393351f,
-			0.479631f,0.402272f,
-			0.479631f,0.402272f,
-			0.482660f,0.419782f,
-			0.475994f,0.414078f,
-			0.478136f,0.432536f,
-			0.475994f,0.414078f,
-			0.482660f,0.419782f,
-			0.482660f,0.419782f,
-			0.484110f,0.435220f,
-			0.478136f,0.432536f,
-			0.478775f,0.455798f,
-			0.478136f,0.432536f,
-			0.484110f,0.435220f,
-			0.484110f,0.435220f,
-			0.484550f,0.454087f,
-			0.478775f,0.455798f,
-			0.480213f,0.384461f,
-			0.472012f,0.341523f,
-			0.460984f,0.357852f,
-			0.460984f,0.357852f,
-			0.471374f,0.393351f,
-			0.480213f,0.384461f,
-			0.483632f,0.408524f,
-			0.480213f,0.384461f,
-			0.471374f,0.393351f,
-			0.471374f,0.393351f,
-			0.475994f,0.414078f,
-			0.483632f,0.408524f,
-			0.485170f,0.429893f,
-			0.483632f,0.408524f,
-			0.475994f,0.414078f,
-			0.475994f,0.414078f,
-			0.478136f,0.432536f,
-			0.485170f,0.429893f,
-			0.485621f,0.457296f,
-			0.485170f,0.429893f,
-			0.478136f,0.432536f,
-			0.478136f,0.432536f,
-			0.478775f,0.455798f,
-			0.485621f,0.457296f,
-			0.505582f,0.380468f,
-			0.508185f,0.333868f,
-			0.472012f,0.341523f,
-			0.472012f,0.341523f,
-			0.480213f,0.384461f,
-			0.505582f,0.380468f,
-			0.504528f,0.406070f,
-			0.505582f,0.380468f,
-			0.480213f,0.384461f,
-			0.480213f,0.384461f,
-			0.483632f,0.408524f,
-			0.504528f,0.406070f,
-			0.504061f,0.428722f,
-			0.504528f,0.406070f,
-			0.483632f,0.408524f,
-			0.483632f,0.408524f,
-			0.485170f,0.429893f,
-			0.504061f,0.428722f,
-			0.503925f,0.457928f,
-			0.504061f,0.428722f,
-			0.485170f,0.429893f,
-			0.485170f,0.429893f,
-			0.485621f,0.457296f,
-			0.503925f,0.457928f,
-			0.530954f,0.384771f,
-			0.543968f,0.342308f,
-			0.508185f,0.333868f,
-			0.508185f,0.333868f,
-			0.505582f,0.380468f,
-			0.530954f,0.384771f,
-			0.525506f,0.408697f,
-			0.530954f,0.384771f,
-			0.505582f,0.380468f,
-			0.505582f,0.380468f,
-			0.504528f,0.406070f,
-			0.525506f,0.408697f,
-			0.523054f,0.430004f,
-			0.525506f,0.408697f,
-			0.504528f,0.406070f,
-			0.504528f,0.406070f,
-			0.504061f,0.428722f,
-			0.523054f,0.430004f,
-			0.522334f,0.457361f,
-			0.523054f,0.430004f,
-			0.504061f,0.428722f,
-			0.504061f,0.428722f,
-			0.503925f,0.457928f,
-			0.522334f,0.457361f,
-			0.539903f,0.393747f,
-			0.554483f,0.358771f,
-			0.543968f,0.342308f,
-			0.543968f,0.342308f,
-			0.530954f,0.384771f,
-			0.539903f,0.393747f,
-			0.533391f,0.414308f,
-			0.539903f,0.393747f,
-			0.530954f,0.384771f,
-			0.530954f,0.384771f,
-			0.525506f,0.408697f,
-			0.533391f,0.414308f,
-			0.530366f,0.432688f,
-			0.533391f,0.414308f,
-			0.525506f,0.408697f,
-			0.525506f,0.408697f,
-			0.523054f,0.430004f,
-			0.530366f,0.432688f,
-			0.529464f,0.455894f,
-			0.530366f,0.432688f,
-			0.523054f,0.430004f,
-			0.523054f,0.430004f,
-			0.522334f,0.457361f,
-			0.529464f,0.455894f,
-			0.531879f,0.402557f,
-			0.542036f,0.373898f,
-			0.554483f,0.358771f,
-			0.554483f,0.358771f,
-			0.539903f,0.393747f,
-			0.531879f,0.402557f,
-			0.527056f,0.419954f,
-			0.531879f,0.402557f,
-			0.539903f,0.393747f,
-			0.539903f,0.393747f,
-			0.533391f,0.414308f,
-			0.527056f,0.419954f,
-			0.524744f,0.435338f,
-			0.527056f,0.419954f,
-			0.533391f,0.414308f,
-			0.533391f,0.414308f,
-			0.530366f,0.432688f,
-			0.524744f,0.435338f,
-			0.524042f,0.454168f,
-			0.524744f,0.435338f,
-			0.530366f,0.432688f,
-			0.530366f,0.432688f,
-			0.529464f,0.455894f,
-			0.524042f,0.454168f,
-			0.505837f,0.406405f,
-			0.507648f,0.380177f,
-			0.542036f,0.373898f,
-			0.542036f,0.373898f,
-			0.531879f,0.402557f,
-			0.505837f,0.406405f,
-			0.504955f,0.422465f,
-			0.505837f,0.406405f,
-			0.531879f,0.402557f,
-			0.531879f,0.402557f,
-			0.527056f,0.419954f,
-			0.504955f,0.422465f,
-			0.504525f,0.436476f,
-			0.504955f,0.422465f,
-			0.527056f,0.419954f,
-			0.527056f,0.419954f,
-			0.524744f,0.435338f,
-			0.504525f,0.436476f,
-			0.504394f,0.453240f,
-			0.504525f,0.436476f,
-			0.524744f,0.435338f,
-			0.524744f,0.435338f,
-			0.524042f,0.454168f,
-			0.504394f,0.453240f,
-			0.484305f,0.479633f,
-			0.484550f,0.454087f,
-			0.504394f,0.453240f,
-			0.504394f,0.453240f,
-			0.504463f,0.476908f,
-			0.484305f,0.479633f,
-			0.483480f,0.510628f,
-			0.484305f,0.479633f,
-			0.504463f,0.476908f,
-			0.504463f,0.476908f,
-			0.504695f,0.506956f,
-			0.483480f,0.510628f,
-			0.481810f,0.546342f,
-			0.483480f,0.510628f,
-			0.504695f,0.506956f,
-			0.504695f,0.506956f,
-			0.505164f,0.541563f,
-			0.481810f,0.546342f,
-			0.478639f,0.587355f,
-			0.481810f,0.546342f,
-			0.505164f,0.541563f,
-			0.505164f,0.541563f,
-			0.506045f,0.579794f,
-			0.478639f,0.587355f,
-			0.478376f,0.485307f,
-			0.478775f,0.455798f,
-			0.484550f,0.454087f,
-			0.484550f,0.454087f,
-			0.484305f,0.479633f,
-			0.478376f,0.485307f,
-			0.477044f,0.518390f,
-			0.478376f,0.485307f,
-			0.484305f,0.479633f,
-			0.484305f,0.479633f,
-			0.483480f,0.510628f,
-			0.477044f,0.518390f,
-			0.474321f,0.556667f,
-			0.477044f,0.518390f,
-			0.483480f,0.510628f,
-			0.483480f,0.510628f,
-			0.481810f,0.546342f,
-			0.474321f,0.556667f,
-			0.468999f,0.604139f,
-			0.474321f,0.556667f,
-			0.481810f,0.546342f,
-			0.481810f,0.546342f,
-			0.478639f,0.587355f,
-			0.468999f,0.604139f,
-			0.485315f,0.490585f,
-			0.485621f,0.457296f,
-			0.478775f,0.455798f,
-			0.478775f,0.455798f,
-			0.478376f,0.485307f,
-			0.485315f,0.490585f,
-			0.484290f,0.525792f,
-			0.485315f,0.490585f,
-			0.478376f,0.485307f,
-			0.478376f,0.485307f,
-			0.477044f,0.518390f,
-			0.484290f,0.525792f,
-			0.482166f,0.566849f,
-			0.484290f,0.525792f,
-			0.477044f,0.518390f,
-			0.477044f,0.518390f,
-			0.474321f,0.556667f,
-			0.482166f,0.566849f,
-			0.477872f,0.621375f,
-			0.482166f,0.566849f,
-			0.474321f,0.556667f,
-			0.474321f,0.556667f,
-			0.468999f,0.604139f,
-			0.477872f,0.621375f,
-			0.504020f,0.492875f,
-			0.503925f,0.457928f,
-			0.485621f,0.457296f,
-			0.485621f,0.457296f,
-			0.485315f,0.490585f,
-			0.504020f,0.492875f,
-			0.504340f,0.529048f,
-			0.504020f,0.492875f,
-			0.485315f,0.490585f,
-			0.485315f,0.490585f,
-			0.484290f,0.525792f,
-			0.504340f,0.529048f,
-			0.505008f,0.571422f,
-			0.504340f,0.529048f,
-			0.484290f,0.525792f,
-			0.484290f,0.525792f,
-			0.482166f,0.566849f,
-			0.505008f,0.571422f,
-			0.506381f,0.629326f,
-			0.505008f,0.571422f,
-			0.482166f,0.566849f,
-			0.482166f,0.566849f,
-			0.477872f,0.621375f,
-			0.506381f,0.629326f,
-			0.522823f,0.490601f,
-			0.522334f,0.457361f,
-			0.503925f,0.457928f,
-			0.503925f,0.457928f,
-			0.504020f,0.492875f,
-			0.522823f,0.490601f,
-			0.524458f,0.525745f,
-			0.522823f,0.490601f,
-			0.504020f,0.492875f,
-			0.504020f,0.492875f,
-			0.504340f,0.529048f,
-			0.524458f,0.525745f,
-			0.527844f,0.566696f,
-			0.524458f,0.525745f,
-			0.504340f,0.529048f,
-			0.504340f,0.529048f,
-			0.505008f,0.571422f,
-			0.527844f,0.566696f,
-			0.534676f,0.620973f,
-			0.527844f,0.566696f,
-			0.505008f,0.571422f,
-			0.505008f,0.571422f,
-			0.506381f,0.629326f,
-			0.534676f,0.620973f,
-			0.530027f,0.485341f,
-			0.529464f,0.455894f,
-			0.522334f,0.457361f,
-			0.522334f,0.457361f,
-			0.522823f,0.490601f,
-			0.530027f,0.485341f,
-			0.531908f,0.518344f,
-			0.530027f,0.485341f,
-			0.522823f,0.490601f,
-			0.522823f,0.490601f,
-			0.524458f,0.525745f,
-			0.531908f,0.518344f,
-			0.535751f,0.556490f,
-			0.531908f,0.518344f,
-			0.524458f,0.525745f,
-			0.524458f,0.525745f,
-			0.527844f,0.566696f,
-			0.535751f,0.556490f,
-			0.543243f,0.603687f,
-			0.535751f,0.556490f,
-			0.527844f,0.566696f,
-			0.527844f,0.566696f,
-			0.534676f,0.620973f,
-			0.543243f,0.603687f,
-			0.524434f,0.479671f,
-			0.524042f,0.454168f,
-			0.529464f,0.455894f,
-			0.529464f,0.455894f,
-			0.530027f,0.485341f,
-			0.524434f,0.479671f,
-			0.525749f,0.510607f,
-			0.524434f,0.479671f,
-			0.530027f,0.485341f,
-			0.530027f,0.485341f,
-			0.531908f,0.518344f,
-			0.525749f,0.510607f,
-			0.528411f,0.546230f,
-			0.525749f,0.510607f,
-			0.531908f,0.518344f,
-			0.531908f,0.518344f,
-			0.535751f,0.556490f,
-			0.528411f,0.546230f,
-			0.533457f,0.587073f,
-			0.528411f,0.546230f,
-			0.535751f,0.556490f,
-			0.535751f,0.556490f,
-			0.543243f,0.603687f,
-			0.533457f,0.587073f,
-			0.504463f,0.476908f,
-			0.504394f,0.453240f,
-			0.524042f,0.454168f,
-			0.524042f,0.454168f,
-			0.524434f,0.479671f,
-			0.504463f,0.476908f,
-			0.504695f,0.506956f,
-			0.504463f,0.476908f,
-			0.524434f,0.479671f,
-			0.524434f,0.479671f,
-			0.525749f,0.510607f,
-			0.504695f,0.506956f,
-			0.505164f,0.541563f,
-			0.504695f,0.506956f,
-			0.525749f,0.510607f,
-			0.525749f,0.510607f,
-			0.528411f,0.546230f,
-			0.505164f,0.541563f,
-			0.506045f,0.579794f,
-			0.505164f,0.541563f,
-			0.528411f,0.546230f,
-			0.528411f,0.546230f,
-			0.533457f,0.587073f,
-			0.506045f,0.579794f,
-			1.542026f,0.495084f,
-			1.560710f,0.519530f,
-			1.493076f,0.496167f,
-			1.493076f,0.496167f,
-			1.494634f,0.481198f,
-			1.542026f,0.495084f,
-			1.528228f,0.456551f,
-			1.542026f,0.495084f,
-			1.494634f,0.481198f,
-			1.494634f,0.481198f,
-			1.495117f,0.448383f,
-			1.528228f,0.456551f,
-			1.517181f,0.416450f,
-			1.528228f,0.456551f,
-			1.495117f,0.448383f,
-			1.495117f,0.448383f,
-			1.495349f,0.412192f,
-			1.517181f,0.416450f,
-			1.511716f,0.392178f,
-			1.517181f,0.416450f,
-			1.495349f,0.412192f,
-			1.495349f,0.412192f,
-			1.495705f,0.388702f,
-			1.511716f,0.392178f,
-			1.555547f,0.523610f,
-			1.582369f,0.568686f,
-			1.560710f,0.519530f,
-			1.560710f,0.519530f,
-			1.542026f,0.495084f,
-			1.555547f,0.523610f,
-			1.537586f,0.473323f,
-			1.555547f,0.523610f,
-			1.542026f,0.495084f,
-			1.542026f,0.495084f,
-			1.528228f,0.456551f,
-			1.537586f,0.473323f,
-			1.523283f,0.425144f,
-			1.537586f,0.473323f,
-			1.528228f,0.456551f,
-			1.528228f,0.456551f,
-			1.517181f,0.416450f,
-			1.523283f,0.425144f,
-			1.515855f,0.399088f,
-			1.523283f,0.425144f,
-			1.517181f,0.416450f,
-			1.517181f,0.416450f,
-			1.511716f,0.392178f,
-			1.515855f,0.399088f,
-			1.539258f,0.550244f,
-			1.560710f,0.616659f,
-			1.582369f,0.568686f,
-			1.582369f,0.568686f,
-			1.555547f,0.523610f,
-			1.539258f,0.550244f,
-			1.526076f,0.488773f,
-			1.539258f,0.550244f,
-			1.555547f,0.523610f,
-			1.555547f,0.523610f,
-			1.537586f,0.473323f,
-			1.526076f,0.488773f,
-			1.515684f,0.432985f,
-			1.526076f,0.488773f,
-			1.537586f,0.473323f,
-			1.537586f,0.473323f,
-			1.523283f,0.425144f,
-			1.515684f,0.432985f,
-			1.510255f,0.405085f,
-			1.515684f,0.432985f,
-			1.523283f,0.425144f,
-			1.523283f,0.425144f,
-			1.515855f,0.399088f,
-			1.510255f,0.405085f,
-			1.495173f,0.561945f,
-			1.493076f,0.638645f,
-			1.560710f,0.616659f,
-			1.560710f,0.616659f,
-			1.539258f,0.550244f,
-			1.495173f,0.561945f,
-			1.495685f,0.495455f,
-			1.495173f,0.561945f,
-			1.539258f,0.550244f,
-			1.539258f,0.550244f,
-			1.526076f,0.488773f,
-			1.495685f,0.495455f,
-			1.495968f,0.436328f,
-			1.495685f,0.495455f,
-			1.526076f,0.488773f,
-			1.526076f,0.488773f,
-			1.515684f,0.432985f,
-			1.495968f,0.436328f,
-			1.496525f,0.407577f,
-			1.495968f,0.436328f,
-			1.515684f,0.432985f,
-			1.515684f,0.432985f,
-			1.510255f,0.405085f,
-			1.496525f,0.407577f,
-			1.451130f,0.550027f,
-			1.426073f,0.615679f,
-			1.493076f,0.638645f,
-			1.493076f,0.638645f,
-			1.495173f,0.561945f,
-			1.451130f,0.550027f,
-			1.465217f,0.488805f,
-			1.451130f,0.550027f,
-			1.495173f,0.561945f,
-			1.495173f,0.561945f,
-			1.495685f,0.495455f,
-			1.465217f,0.488805f,
-			1.476112f,0.433096f,
-			1.465217f,0.488805f,
-			1.495685f,0.495455f,
-			1.495685f,0.495455f,
-			1.495968f,0.436328f,
-			1.476112f,0.433096f,
-			1.482593f,0.405179f,
-			1.476112f,0.433096f,
-			1.495968f,0.436328f,
-			1.495968f,0.436328f,
-			1.496525f,0.407577f,
-			1.482593f,0.405179f,
-			1.434667f,0.523466f,
-			1.404870f,0.567900f,
-			1.426073f,0.615679f,
-			1.426073f,0.615679f,
-			1.451130f,0.550027f,
-			1.434667f,0.523466f,
-			1.453417f,0.473429f,
-			1.434667f,0.523466f,
-			1.451130f,0.550027f,
-			1.451130f,0.550027f,
-			1.465217f,0.488805f,
-			1.453417f,0.473429f,
-			1.468144f,0.425323f,
-			1.453417f,0.473429f,
-			1.465217f,0.488805f,
-			1.465217f,0.488805f,
-			1.476112f,0.433096f,
-			1.468144f,0.425323f,
-			1.476487f,0.399238f,
-			1.468144f,0.425323f,
-			1.476112f,0.433096f,
-			1.476112f,0.433096f,
-			1.482593f,0.405179f,
-			1.476487f,0.399238f,
-			1.447667f,0.495110f,
-			1.426073f,0.519353f,
-			1.404870f,0.567900f,
-			1.404870f,0.567900f,
-			1.434667f,0.523466f,
-			1.447667f,0.495110f,
-			1.462310f,0.456691f,
-			1.447667f,0.495110f,
-			1.434667f,0.523466f,
-			1.434667f,0.523466f,
-			1.453417f,0.473429f,
-			1.462310f,0.456691f,
-			1.473778f,0.416614f,
-			1.462310f,0.456691f,
-			1.453417f,0.473429f,
-			1.453417f,0.473429f,
-			1.468144f,0.425323f,
-			1.473778f,0.416614f,
-			1.480019f,0.392316f,
-			1.473778f,0.416614f,
-			1.468144f,0.425323f,
-			1.468144f,0.425323f,
-			1.476487f,0.399238f,
-			1.480019f,0.392316f,
-			1.494634f,0.481198f,
-			1.493076f,0.496167f,
-			1.426073f,0.519353f,
-			1.426073f,0.519353f,
-			1.447667f,0.495110f,
-			1.494634f,0.481198f,
-			1.495117f,0.448383f,
-			1.494634f,0.481198f,
-			1.447667f,0.495110f,
-			1.447667f,0.495110f,
-			1.462310f,0.456691f,
-			1.495117f,0.448383f,
-			1.495349f,0.412192f,
-			1.495117f,0.448383f,
-			1.462310f,0.456691f,
-			1.462310f,0.456691f,
-			1.473778f,0.416614f,
-			1.495349f,0.412192f,
-			1.495705f,0.388702f,
-			1.495349f,0.412192f,
-			1.473778f,0.416614f,
-			1.473778f,0.416614f,
-			1.480019f,0.392316f,
-			1.495705f,0.388702f,
-			1.510442f,0.390558f,
-			1.511716f,0.392178f,
-			1.495705f,0.388702f,
-			1.495705f,0.388702f,
-			1.495822f,0.387107f,
-			1.510442f,0.390558f,
-			1.508193f,0.390686f,
-			1.510442f,0.390558f,
-			1.495822f,0.387107f,
-			1.495822f,0.387107f,
-			1.495905f,0.387661f,
-			1.508193f,0.390686f,
-			1.506103f,0.392107f,
-			1.508193f,0.390686f,
-			1.495905f,0.387661f,
-			1.495905f,0.387661f,
-			1.495928f,0.389602f,
-			1.506103f,0.392107f,
-			1.505253f,0.394510f,
-			1.506103f,0.392107f,
-			1.495928f,0.389602f,
-			1.495928f,0.389602f,
-			1.495866f,0.392344f,
-			1.505253f,0.394510f,
-			1.514198f,0.397403f,
-			1.515855f,0.399088f,
-			1.511716f,0.392178f,
-			1.511716f,0.392178f,
-			1.510442f,0.390558f,
-			1.514198f,0.397403f,
-			1.511453f,0.396751f,
-			1.514198f,0.397403f,
-			1.510442f,0.390558f,
-			1.510442f,0.390558f,
-			1.508193f,0.390686f,
-			1.511453f,0.396751f,
-			1.508935f,0.397213f,
-			1.511453f,0.396751f,
-			1.508193f,0.390686f,
-			1.508193f,0.390686f,
-			1.506103f,0.392107f,
-			1.508935f,0.397213f,
-			1.507981f,0.399002f,
-			1.508935f,0.397213f,
-			1.506103f,0.392107f,
-			1.506103f,0.392107f,
-			1.505253f,0.394510f,
-			1.507981f,0.399002f,
-			1.509097f,0.403332f,
-			1.510255f,0.405085f,
-			1.515855f,0.399088f,
-			1.515855f,0.399088f,
-			1.514198f,0.397403f,
-			1.509097f,0.403332f,
-			1.507214f,0.402070f,
-			1.509097f,0.403332f,
-			1.514198f,0.397403f,
-			1.514198f,0.397403f,
-			1.511453f,0.396751f,
-			1.507214f,0.402070f,
-			1.505479f,0.401781f,
-			1.507214f,0.402070f,
-			1.511453f,0.396751f,
-			1.511453f,0.396751f,
-			1.508935f,0.397213f,
-			1.505479f,0.401781f,
-			1.504819f,0.403108f,
-			1.505479f,0.401781f,
-			1.508935f,0.397213f,
-			1.508935f,0.397213f,
-			1.507981f,0.399002f,
-			1.504819f,0.403108f,
-			1.496649f,0.405790f,
-			1.496525f,0.407577f,
-			1.510255f,0.405085f,
-			1.510255f,0.405085f,
-			1.509097f,0.403332f,
-			1.496649f,0.405790f,
-			1.496663f,0.404293f,
-			1.496649f,0.405790f,
-			1.509097f,0.403332f,
-			1.509097f,0.403332f,
-			1.507214f,0.402070f,
-			1.496663f,0.404293f,
-			1.496583f,0.403716f,
-			1.496663f,0.404293f,
-			1.507214f,0.402070f,
-			1.507214f,0.402070f,
-			1.505479f,0.401781f,
-			1.496583f,0.403716f,
-			1.496410f,0.404874f,
-			1.496583f,0.403716f,
-			1.505479f,0.401781f,
-			1.505479f,0.401781f,
-			1.504819f,0.403108f,
-			1.496410f,0.404874f,
-			1.483996f,0.403415f,
-			1.482593f,0.405179f,
-			1.496525f,0.407577f,
-			1.496525f,0.407577f,
-			1.496649f,0.405790f,
-			1.483996f,0.403415f,
-			1.485919f,0.402141f,
-			1.483996f,0.403415f,
-			1.496649f,0.405790f,
-			1.496649f,0.405790f,
-			1.496663f,0.404293f,
-			1.485919f,0.402141f,
-			1.487515f,0.401842f,
-			1.485919f,0.402141f,
-			1.496663f,0.404293f,
-			1.496663f,0.404293f,
-			1.496583f,0.403716f,
-			1.487515f,0.401842f,
-			1.487854f,0.403168f,
-			1.487515f,0.401842f,
-			1.496583f,0.403716f,
-			1.496583f,0.403716f,
-			1.496410f,0.404874f,
-			1.487854f,0.403168f,
-			1.478383f,0.397537f,
-			1.476487f,0.399238f,
-			1.482593f,0.405179f,
-			1.482593f,0.405179f,
-			1.483996f,0.403415f,
-			1.478383f,0.397537f,
-			1.481205f,0.396864f,
-			1.478383f,0.397537f,
-			1.483996f,0.403415f,
-			1.483996f,0.403415f,
-			1.485919f,0.402141f,
-			1.481205f,0.396864f,
-			1.483642f,0.397308f,
-			1.481205f,0.396864f,
-			1.485919f,0.402141f,
-			1.485919f,0.402141f,
-			1.487515f,0.401842f,
-			1.483642f,0.397308f,
-			1.484341f,0.399092f,
-			1.483642f,0.397308f,
-			1.487515f,0.401842f,
-			1.487515f,0.401842f,
-			1.487854f,0.403168f,
-			1.484341f,0.399092f,
-			1.481526f,0.390681f,
-			1.480019f,0.392316f,
-			1.476487f,0.399238f,
-			1.476487f,0.399238f,
-			1.478383f,0.397537f,
-			1.481526f,0.390681f,
-			1.483906f,0.390788f,
-			1.481526f,0.390681f,
-			1.478383f,0.397537f,
-			1.478383f,0.397537f,
-			1.481205f,0.396864f,
-			1.483906f,0.390788f,
-			1.485997f,0.392190f,
-			1.483906f,0.390788f,
-			1.481205f,0.396864f,
-			1.481205f,0.396864f,
-			1.483642f,0.397308f,
-			1.485997f,0.392190f,
-			1.486677f,0.394587f,
-			1.485997f,0.392190f,
-			1.483642f,0.397308f,
-			1.483642f,0.397308f,
-			1.484341f,0.399092f,
-			1.486677f,0.394587f,
-			1.495822f,0.387107f,
-			1.495705f,0.388702f,
-			1.480019f,0.392316f,
-			1.480019f,0.392316f,
-			1.481526f,0.390681f,
-			1.495822f,0.387107f,
-			1.495905f,0.387661f,
-			1.495822f,0.387107f,
-			1.481526f,0.390681f,
-			1.481526f,0.390681f,
-			1.483906f,0.390788f,
-			1.495905f,0.387661f,
-			1.495928f,0.389602f,
-			1.495905f,0.387661f,
-			1.483906f,0.390788f,
-			1.483906f,0.390788f,
-			1.485997f,0.392190f,
-			1.495928f,0.389602f,
-			1.495866f,0.392344f,
-			1.495928f,0.389602f,
-			1.485997f,0.392190f,
-			1.485997f,0.392190f,
-			1.486677f,0.394587f,
-			1.495866f,0.392344f,
-			1.204937f,0.008878f,
-			1.466814f,0.068670f,
-			1.586225f,0.065906f,
-			1.584264f,0.067749f,
-			1.586225f,0.065906f,
-			1.466814f,0.068670f,
-			1.466814f,0.068670f,
-			1.465350f,0.070717f,
-			1.584264f,0.067749f,
-			1.557632f,0.047361f,
-			1.584264f,0.067749f,
-			1.465350f,0.070717f,
-			1.465350f,0.070717f,
-			1.445887f,0.050640f,
-			1.557632f,0.047361f,
-			1.558483f,0.052872f,
-			1.557632f,0.047361f,
-			1.445887f,0.050640f,
-			1.445887f,0.050640f,
-			1.446614f,0.056487f,
-			1.558483f,0.052872f,
-			1.204937f,0.008878f,
-			1.586225f,0.065906f,
-			1.704916f,0.062762f,
-			1.702709f,0.064370f,
-			1.704916f,0.062762f,
-			1.586225f,0.065906f,
-			1.586225f,0.065906f,
-			1.584264f,0.067749f,
-			1.702709f,0.064370f,
-			1.671574f,0.043562f,
-			1.702709f,0.064370f,
-			1.584264f,0.067749f,
-			1.584264f,0.067749f,
-			1.557632f,0.047361f,
-			1.671574f,0.043562f,
-			1.672744f,0.048679f,
-			1.671574f,0.043562f,
-			1.557632f,0.047361f,
-			1.557632f,0.047361f,
-			1.558483f,0.052872f,
-			1.672744f,0.048679f,
-			1.204937f,0.008878f,
-			1.704916f,0.062762f,
-			1.830048f,0.059348f,
-			1.827906f,0.060708f,
-			1.830048f,0.059348f,
-			1.704916f,0.062762f,
-			1.704916f,0.062762f,
-			1.702709f,0.064370f,
-			1.827906f,0.060708f,
-			1.796114f,0.039443f,
-			1.827906f,0.060708f,
-			1.702709f,0.064370f,
-			1.702709f,0.064370f,
-			1.671574f,0.043562f,
-			1.796114f,0.039443f,
-			1.797549f,0.044166f,
-			1.796114f,0.039443f,
-			1.671574f,0.043562f,
-			1.671574f,0.043562f,
-			1.672744f,0.048679f,
-			1.797549f,0.044166f,
-			1.204937f,0.008878f,
-			1.830048f,0.059348f,
-			1.969738f,0.056249f,
-			1.968068f,0.057379f,
-			1.969738f,0.056249f,
-			1.830048f,0.059348f,
-			1.830048f,0.059348f,
-			1.827906f,0.060708f,
-			1.968068f,0.057379f,
-			1.942202f,0.035593f,
-			1.968068f,0.057379f,
-			1.827906f,0.060708f,
-			1.827906f,0.060708f,
-			1.796114f,0.039443f,
-			1.942202f,0.035593f,
-			1.943309f,0.039966f,
-			1.942202f,0.035593f,
-			1.796114f,0.039443f,
-			1.796114f,0.039443f,
-			1.797549f,0.044166f,
-			1.943309f,0.039966f,
-			-0.795063f,0.008878f,
-			-0.030262f,0.056249f,
-			0.115322f,0.054718f,
-			0.114598f,0.055709f,
-			0.115322f,0.054718f,
-			-0.030262f,0.056249f,
-			-0.030262f,0.056249f,
-			-0.031932f,0.057379f,
-			0.114598f,0.055709f,
-			0.103163f,0.033394f,
-			0.114598f,0.055709f,
-			-0.031932f,0.057379f,
-			-0.031932f,0.057379f,
-			-0.057798f,0.035593f,
-			0.103163f,0.033394f,
-			0.103453f,0.037544f,
-			0.103163f,0.033394f,
-			-0.057798f,0.035593f,
-			-0.057798f,0.035593f,
-			-0.056691f,0.039966f,
-			0.103453f,0.037544f,
-			-0.795063f,0.008878f,
-			-1.884678f,0.054718f,
-			-1.742923f,0.054658f,
-			0.257498f,0.055633f,
-			0.257077f,0.054658f,
-			0.115322f,0.054718f,
-			0.115322f,0.054718f,
-			0.114598f,0.055709f,
-			0.257498f,0.055633f,
-			0.264279f,0.033212f,
-			0.257498f,0.055633f,
-			0.114598f,0.055709f,
-			0.114598f,0.055709f,
-			0.103163f,0.033394f,
-			0.264279f,0.033212f,
-			0.263992f,0.037327f,
-			0.264279f,0.033212f,
-			0.103163f,0.033394f,
-			0.103163f,0.033394f,
-			0.103453f,0.037544f,
-			0.263992f,0.037327f,
-			1.204937f,0.008878f,
-			0.257077f,0.054658f,
-			0.397245f,0.055792f,
-			0.398687f,0.056872f,
-			0.397245f,0.055792f,
-			0.257077f,0.054658f,
-			0.257077f,0.054658f,
-			0.257498f,0.055633f,
-			0.398687f,0.056872f,
-			0.421124f,0.034848f,
-			0.398687f,0.056872f,
-			0.257498f,0.055633f,
-			0.257498f,0.055633f,
-			0.264279f,0.033212f,
-			0.421124f,0.034848f,
-			0.420369f,0.039136f,
-			0.421124f,0.034848f,
-			0.264279f,0.033212f,
-			0.264279f,0.033212f,
-			0.263992f,0.037327f,
-			0.420369f,0.039136f,
-			1.204937f,0.008878f,
-			0.397245f,0.055792f,
-			0.539406f,0.058203f,
-			0.541478f,0.059488f,
-			0.539406f,0.058203f,
-			0.397245f,0.055792f,
-			0.397245f,0.055792f,
-			0.398687f,0.056872f,
-			0.541478f,0.059488f,
-			0.572504f,0.038126f,
-			0.541478f,0.059488f,
-			0.398687f,0.056872f,
-			0.398687f,0.056872f,
-			0.421124f,0.034848f,
-			0.572504f,0.038126f,
-			0.571216f,0.042744f,
-			0.572504f,0.038126f,
-			0.421124f,0.034848f,
-			0.421124f,0.034848f,
-			0.420369f,0.039136f,
-			0.571216f,0.042744f,
-			1.204937f,0.008878f,
-			0.539406f,0.058203f,
-			0.673464f,0.061766f,
-			0.675677f,0.063309f,
-			0.673464f,0.061766f,
-			0.539406f,0.058203f,
-			0.539406f,0.058203f,
-			0.541478f,0.059488f,
-			0.675677f,0.063309f,
-			0.707411f,0.042432f,
-			0.675677f,0.063309f,
-			0.541478f,0.059488f,
-			0.541478f,0.059488f,
-			0.572504f,0.038126f,
-			0.707411f,0.042432f,
-			0.706031f,0.047447f,
-			0.707411f,0.042432f,
-			0.572504f,0.038126f,
-			0.572504f,0.038126f,
-			0.571216f,0.042744f,
-			0.706031f,0.047447f,
-			1.204937f,0.008878f,
-			0.673464f,0.061766f,
-			0.793567f,0.065219f,
-			0.795603f,0.067005f,
-			0.793567f,0.065219f,
-			0.673464f,0.061766f,
-			0.673464f,0.061766f,
-			0.675677f,0.063309f,
-			0.795603f,0.067005f,
-			0.823568f,0.046482f,
-			0.795603f,0.067005f,
-			0.675677f,0.063309f,
-			0.675677f,0.063309f,
-			0.707411f,0.042432f,
-			0.823568f,0.046482f,
-			0.822544f,0.051888f,
-			0.823568f,0.046482f,
-			0.707411f,0.042432f,
-			0.707411f,0.042432f,
-			0.706031f,0.047447f,
-			0.822544f,0.051888f,
-			1.204937f,0.008878f,
-			0.793567f,0.065219f,
-			0.908158f,0.068068f,
-			0.909794f,0.070062f,
-			0.908158f,0.068068f,
-			0.793567f,0.065219f,
-			0.793567f,0.065219f,
-			0.795603f,0.067005f,
-			0.909794f,0.070062f,
-			0.931562f,0.049855f,
-			0.909794f,0.070062f,
-			0.795603f,0.067005f,
-			0.795603f,0.067005f,
-			0.823568f,0.046482f,
-			0.931562f,0.049855f,
-			0.930899f,0.055611f,
-			0.931562f,0.049855f,
-			0.823568f,0.046482f,
-			0.823568f,0.046482f,
-			0.822544f,0.051888f,
-			0.930899f,0.055611f,
-			1.204937f,0.008878f,
-			0.908158f,0.068068f,
-			1.024478f,0.070247f,
-			1.025524f,0.072400f,
-			1.024478f,0.070247f,
-			0.908158f,0.068068f,
-			0.908158f,0.068068f,
-			0.909794f,0.070062f,
-			1.025524f,0.072400f,
-			1.039274f,0.052421f,
-			1.025524f,0.072400f,
-			0.909794f,0.070062f,
-			0.909794f,0.070062f,
-			0.931562f,0.049855f,
-			1.039274f,0.052421f,
-			1.038766f,0.058444f,
-			1.039274f,0.052421f,
-			0.931562f,0.049855f,
-			0.931562f,0.049855f,
-			0.930899f,0.055611f,
-			1.038766f,0.058444f,
-			1.204937f,0.008878f,
-			1.024478f,0.070247f,
-			1.137869f,0.071764f,
-			1.138250f,0.074006f,
-			1.137869f,0.071764f,
-			1.024478f,0.070247f,
-			1.024478f,0.070247f,
-			1.025524f,0.072400f,
-			1.138250f,0.074006f,
-			1.143367f,0.054020f,
-			1.138250f,0.074006f,
-			1.025524f,0.072400f,
-			1.025524f,0.072400f,
-			1.039274f,0.052421f,
-			1.143367f,0.054020f,
-			1.143060f,0.060182f,
-			1.143367f,0.054020f,
-			1.039274f,0.052421f,
-			1.039274f,0.052421f,
-			1.038766f,0.058444f,
-			1.143060f,0.060182f,
-			1.204937f,0.008878f,
-			1.137869f,0.071764f,
-			1.244511f,0.072037f,
-			1.244275f,0.074289f,
-			1.244511f,0.072037f,
-			1.137869f,0.071764f,
-			1.137869f,0.071764f,
-			1.138250f,0.074006f,
-			1.244275f,0.074289f,
-			1.241211f,0.054261f,
-			1.244275f,0.074289f,
-			1.138250f,0.074006f,
-			1.138250f,0.074006f,
-			1.143367f,0.054020f,
-			1.241211f,0.054261f,
-			1.241315f,0.060432f,
-			1.241211f,0.054261f,
-			1.143367f,0.054020f,
-			1.143367f,0.054020f,
-			1.143060f,0.060182f,
-			1.241315f,0.060432f,
-			1.204937f,0.008878f,
-			1.244511f,0.072037f,
-			1.351676f,0.070955f,
-			1.350831f,0.073143f,
-			1.351676f,0.070955f,
-			1.244511f,0.072037f,
-			1.244511f,0.072037f,
-			1.244275f,0.074289f,
-			1.350831f,0.073143f,
-			1.339672f,0.053116f,
-			1.350831f,0.073143f,
-			1.244275f,0.074289f,
-			1.244275f,0.074289f,
-			1.241211f,0.054261f,
-			1.339672f,0.053116f,
-			1.340198f,0.059187f,
-			1.339672f,0.053116f,
-			1.241211f,0.054261f,
-			1.241211f,0.054261f,
-			1.241315f,0.060432f,
-			1.340198f,0.059187f,
-			1.204937f,0.008878f,
-			1.351676f,0.070955f,
-			1.466814f,0.068670f,
-			1.465350f,0.070717f,
-			1.466814f,0.068670f,
-			1.351676f,0.070955f,
-			1.351676f,0.070955f,
-			1.350831f,0.073143f,
-			1.465350f,0.070717f,
-			1.445887f,0.050640f,
-			1.465350f,0.070717f,
-			1.350831f,0.073143f,
-			1.350831f,0.073143f,
-			1.339672f,0.053116f,
-			1.445887f,0.050640f,
-			1.446614f,0.056487f,
-			1.445887f,0.050640f,
-			1.339672f,0.053116f,
-			1.339672f,0.053116f,
-			1.340198f,0.059187f,
-			1.446614f,0.056487f,
-			1.596348f,0.118483f,
-			1.558483f,0.052872f,
-			1.446614f,0.056487f,
-			1.446614f,0.056487f,
-			1.474738f,0.122041f,
-			1.596348f,0.118483f,
-			1.610419f,0.201293f,
-			1.596348f,0.118483f,
-			1.474738f,0.122041f,
-			1.474738f,0.122041f,
-			1.485732f,0.203998f,
-			1.610419f,0.201293f,
-			1.615503f,0.262181f,
-			1.610419f,0.201293f,
-			1.485732f,0.203998f,
-			1.485732f,0.203998f,
-			1.489786f,0.264114f,
-			1.615503f,0.262181f,
-			1.616911f,0.293718f,
-			1.615503f,0.262181f,
-			1.489786f,0.264114f,
-			1.489786f,0.264114f,
-			1.490917f,0.295342f,
-			1.616911f,0.293718f,
-			1.716464f,0.114431f,
-			1.672744f,0.048679f,
-			1.558483f,0.052872f,
-			1.558483f,0.052872f,
-			1.596348f,0.118483f,
-			1.716464f,0.114431f,
-			1.731702f,0.198170f,
-			1.716464f,0.114431f,
-			1.596348f,0.118483f,
-			1.596348f,0.118483f,
-			1.610419f,0.201293f,
-			1.731702f,0.198170f,
-			1.737078f,0.259905f,
-			1.731702f,0.198170f,
-			1.610419f,0.201293f,
-			1.610419f,0.201293f,
-			1.615503f,0.262181f,
-			1.737078f,0.259905f,
-			1.738555f,0.291785f,
-			1.737078f,0.259905f,
-			1.615503f,0.262181f,
-			1.615503f,0.262181f,
-			1.616911f,0.293718f,
-			1.738555f,0.291785f,
-			1.841481f,0.110073f,
-			1.797549f,0.044166f,
-			1.672744f,0.048679f,
-			1.672744f,0.048679f,
-			1.716464f,0.114431f,
-			1.841481f,0.110073f,
-			1.855682f,0.194635f,
-			1.841481f,0.110073f,
-			1.716464f,0.114431f,
-			1.716464f,0.114431f,
-			1.731702f,0.198170f,
-			1.855682f,0.194635f,
-			1.860567f,0.257189f,
-			1.855682f,0.194635f,
-			1.731702f,0.198170f,
-			1.731702f,0.198170f,
-			1.737078f,0.259905f,
-			1.860567f,0.257189f,
-			1.861899f,0.289423f,
-			1.860567f,0.257189f,
-			1.737078f,0.259905f,
-			1.737078f,0.259905f,
-			1.738555f,0.291785f,
-			1.861899f,0.289423f,
-			1.978231f,0.106151f,
-			1.943309f,0.039966f,
-			1.797549f,0.044166f,
-			1.797549f,0.044166f,
-			1.841481f,0.110073f,
-			1.978231f,0.106151f,
-			1.988668f,0.191408f,
-			1.978231f,0.106151f,
-			1.841481f,0.110073f,
-			1.841481f,0.110073f,
-			1.855682f,0.194635f,
-			1.988668f,0.191408f,
-			1.992176f,0.254663f,
-			1.988668f,0.191408f,
-			1.855682f,0.194635f,
-			1.855682f,0.194635f,
-			1.860567f,0.257189f,
-			1.992176f,0.254663f,
-			1.993125f,0.287207f,
-			1.992176f,0.254663f,
-			1.860567f,0.257189f,
-			1.860567f,0.257189f,
-			1.861899f,0.289423f,
-			1.993125f,0.287207f,
-			0.118566f,0.104255f,
-			0.103453f,0.037544f,
-			-0.056691f,0.039966f,
-			-0.056691f,0.039966f,
-			-0.021769f,0.106151f,
-			0.118566f,0.104255f,
-			0.122851f,0.190139f,
-			0.118566f,0.104255f,
-			-0.021769f,0.106151f,
-			-0.021769f,0.106151f,
-			-0.011332f,0.191408f,
-			0.122851f,0.190139f,
-			0.124271f,0.253845f,
-			0.122851f,0.190139f,
-			-0.011332f,0.191408f,
-			-0.011332f,0.191408f,
-			-0.007824f,0.254663f,
-			0.124271f,0.253845f,
-			0.124653f,0.286550f,
-			0.124271f,0.253845f,
-			-0.007824f,0.254663f,
-			-0.007824f,0.254663f,
-			-0.006875f,0.287207f,
-			0.124653f,0.286550f,
-			0.254973f,0.104180f,
-			0.263992f,0.037327f,
-			0.103453f,0.037544f,
-			0.103453f,0.037544f,
-			0.118566f,0.104255f,
-			0.254973f,0.104180f,
-			0.252432f,0.190199f,
-			0.254973f,0.104180f,
-			0.118566f,0.104255f,
-			0.118566f,0.104255f,
-			0.122851f,0.190139f,
-			0.252432f,0.190199f,
-			0.251592f,0.253966f,
-			0.252432f,0.190199f,
-			0.122851f,0.190139f,
-			0.122851f,0.190139f,
-			0.124271f,0.253845f,
-			0.251592f,0.253966f,
-			0.251365f,0.286683f,
-			0.251592f,0.253966f,
-			0.124271f,0.253845f,
-			0.124271f,0.253845f,
-			0.124653f,0.286550f,
-			0.251365f,0.286683f,
-			0.390345f,0.105601f,
-			0.420369f,0.039136f,
-			0.263992f,0.037327f,
-			0.263992f,0.037327f,
-			0.254973f,0.104180f,
-			0.390345f,0.105601f,
-			0.381540f,0.191171f,
-			0.390345f,0.105601f,
-			0.254973f,0.104180f,
-			0.254973f,0.104180f,
-			0.252432f,0.190199f,
-			0.381540f,0.191171f,
-			0.378597f,0.254610f,
-			0.381540f,0.191171f,
-			0.252432f,0.190199f,
-			0.252432f,0.190199f,
-			0.251592f,0.253966f,
-			0.378597f,0.254610f,
-			0.377801f,0.287207f,
-			0.378597f,0.254610f,
-			0.251592f,0.253966f,
-			0.251592f,0.253966f,
-			0.251365f,0.286683f,
-			0.377801f,0.287207f,
-			0.528737f,0.108615f,
-			0.571216f,0.042744f,
-			0.420369f,0.039136f,
-			0.420369f,0.039136f,
-			0.390345f,0.105601f,
-			0.528737f,0.108615f,
-			0.515334f,0.193319f,
-			0.528737f,0.108615f,
-			0.390345f,0.105601f,
-			0.390345f,0.105601f,
-			0.381540f,0.191171f,
-			0.515334f,0.193319f,
-			0.510757f,0.256086f,
-			0.515334f,0.193319f,
-			0.381540f,0.191171f,
-			0.381540f,0.191171f,
-			0.378597f,0.254610f,
-			0.510757f,0.256086f,
-			0.509512f,0.288430f,
-			0.510757f,0.256086f,
-			0.378597f,0.254610f,
-			0.378597f,0.254610f,
-			0.377801f,0.287207f,
-			0.509512f,0.288430f,
-			0.661536f,0.113152f,
-			0.706031f,0.047447f,
-			0.571216f,0.042744f,
-			0.571216f,0.042744f,
-			0.528737f,0.108615f,
-			0.661536f,0.113152f,
-			0.646316f,0.197052f,
-			0.661536f,0.113152f,
-			0.528737f,0.108615f,
-			0.528737f,0.108615f,
-			0.515334f,0.193319f,
-			0.646316f,0.197052f,
-			0.640982f,0.258996f,
-			0.646316f,0.197052f,
-			0.515334f,0.193319f,
-			0.515334f,0.193319f,
-			0.510757f,0.256086f,
-			0.640982f,0.258996f,
-			0.639519f,0.290977f,
-			0.640982f,0.258996f,
-			0.510757f,0.256086f,
-			0.510757f,0.256086f,
-			0.509512f,0.288430f,
-			0.639519f,0.290977f,
-			0.782792f,0.117585f,
-			0.822544f,0.051888f,
-			0.706031f,0.047447f,
-			0.706031f,0.047447f,
-			0.661536f,0.113152f,
-			0.782792f,0.117585f,
-			0.768244f,0.200677f,
-			0.782792f,0.117585f,
-			0.661536f,0.113152f,
-			0.661536f,0.113152f,
-			0.646316f,0.197052f,
-			0.768244f,0.200677f,
-			0.763019f,0.261788f,
-			0.768244f,0.200677f,
-			0.646316f,0.197052f,
-			0.646316f,0.197052f,
-			0.640982f,0.258996f,
-			0.763019f,0.261788f,
-			0.761575f,0.293405f,
-			0.763019f,0.261788f,
-			0.640982f,0.258996f,
-			0.640982f,0.258996f,
-			0.639519f,0.290977f,
-			0.761575f,0.293405f,
-			0.899686f,0.121274f,
-			0.930899f,0.055611f,
-			0.822544f,0.051888f,
-			0.822544f,0.051888f,
-			0.782792f,0.117585f,
-			0.899686f,0.121274f,
-			0.887644f,0.203539f,
-			0.899686f,0.121274f,
-			0.782792f,0.117585f,
-			0.782792f,0.117585f,
-			0.768244f,0.200677f,
-			0.887644f,0.203539f,
-			0.883228f,0.263876f,
-			0.887644f,0.203539f,
-			0.768244f,0.200677f,
-			0.768244f,0.200677f,
-			0.763019f,0.261788f,
-			0.883228f,0.263876f,
-			0.881998f,0.295177f,
-			0.883228f,0.263876f,
-			0.763019f,0.261788f,
-			0.763019f,0.261788f,
-			0.761575f,0.293405f,
-			0.881998f,0.295177f,
-			1.018778f,0.124087f,
-			1.038766f,0.058444f,
-			0.930899f,0.055611f,
-			0.930899f,0.055611f,
-			0.899686f,0.121274f,
-			1.018778f,0.124087f,
-			1.010772f,0.205660f,
-			1.018778f,0.124087f,
-			0.899686f,0.121274f,
-			0.899686f,0.121274f,
-			0.887644f,0.203539f,
-			1.010772f,0.205660f,
-			1.007788f,0.265374f,
-			1.010772f,0.205660f,
-			0.887644f,0.203539f,
-			0.887644f,0.203539f,
-			0.883228f,0.263876f,
-			1.007788f,0.265374f,
-			1.006952f,0.296428f,
-			1.007788f,0.265374f,
-			0.883228f,0.263876f,
-			0.883228f,0.263876f,
-			0.881998f,0.295177f,
-			1.006952f,0.296428f,
-			1.135456f,0.126058f,
-			1.143060f,0.060182f,
-			1.038766f,0.058444f,
-			1.038766f,0.058444f,
-			1.018778f,0.124087f,
-			1.135456f,0.126058f,
-			1.132351f,0.207424f,
-			1.135456f,0.126058f,
-			1.018778f,0.124087f,
-			1.018778f,0.124087f,
-			1.010772f,0.205660f,
-			1.132351f,0.207424f,
-			1.131185f,0.266819f,
-			1.132351f,0.207424f,
-			1.010772f,0.205660f,
-			1.010772f,0.205660f,
-			1.007788f,0.265374f,
-			1.131185f,0.266819f,
-			1.130857f,0.297714f,
-			1.131185f,0.266819f,
-			1.007788f,0.265374f,
-			1.007788f,0.265374f,
-			1.006952f,0.296428f,
-			1.130857f,0.297714f,
-			1.245793f,0.126405f,
-			1.241315f,0.060432f,
-			1.143060f,0.060182f,
-			1.143060f,0.060182f,
-			1.135456f,0.126058f,
-			1.245793f,0.126405f,
-			1.247624f,0.207803f,
-			1.245793f,0.126405f,
-			1.135456f,0.126058f,
-			1.135456f,0.126058f,
-			1.132351f,0.207424f,
-			1.247624f,0.207803f,
-			1.248312f,0.267172f,
-			1.247624f,0.207803f,
-			1.132351f,0.207424f,
-			1.132351f,0.207424f,
-			1.131185f,0.266819f,
-			1.248312f,0.267172f,
-			1.248506f,0.298042f,
-			1.248312f,0.267172f,
-			1.131185f,0.266819f,
-			1.131185f,0.266819f,
-			1.130857f,0.297714f,
-			1.248506f,0.298042f,
-			1.356584f,0.125004f,
-			1.340198f,0.059187f,
-			1.241315f,0.060432f,
-			1.241315f,0.060432f,
-			1.245793f,0.126405f,
-			1.356584f,0.125004f,
-			1.363197f,0.206564f,
-			1.356584f,0.125004f,
-			1.245793f,0.126405f,
-			1.245793f,0.126405f,
-			1.247624f,0.207803f,
-			1.363197f,0.206564f,
-			1.365668f,0.266167f,
-			1.363197f,0.206564f,
-			1.247624f,0.207803f,
-			1.247624f,0.207803f,
-			1.248312f,0.267172f,
-			1.365668f,0.266167f,
-			1.366361f,0.297151f,
-			1.365668f,0.266167f,
-			1.248312f,0.267172f,
-			1.248312f,0.267172f,
-			1.248506f,0.298042f,
-			1.366361f,0.297151f,
-			1.474738f,0.122041f,
-			1.446614f,0.056487f,
-			1.340198f,0.059187f,
-			1.340198f,0.059187f,
-			1.356584f,0.125004f,
-			1.474738f,0.122041f,
-			1.485732f,0.203998f,
-			1.474738f,0.122041f,
-			1.356584f,0.125004f,
-			1.356584f,0.125004f,
-			1.363197f,0.206564f,
-			1.485732f,0.203998f,
-			1.489786f,0.264114f,
-			1.485732f,0.203998f,
-			1.363197f,0.206564f,
-			1.363197f,0.206564f,
-			1.365668f,0.266167f,
-			1.489786f,0.264114f,
-			1.490917f,0.295342f,
-			1.489786f,0.264114f,
-			1.365668f,0.266167f,
-			1.365668f,0.266167f,
-			1.366361f,0.297151f,
-			1.490917f,0.295342f,
+
+	//GLUT's data is a quarter of the rim, body, lid and bottom and half of the handle and spout.
+	//Reflections in x and y give all 32 patches. Newell's patches face inwards, so
+	//columns are reversed unless a single axis is mirrored, which flips them back.
+	//The result is turned y up and scaled to the size of Models::teapot.
+	static vector<vec3> teapotPatchPoints() {
+		const float reflections[4][2] = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+		const float scale = 0.285f, lift = -0.4f;
+		vector<vec3> points;
+
+		for (unsigned int p = 0; p < TeapotPatches::patchCount; p++) {
+			int copies = p < 6 ? 4 : 2;
+			for (int r = 0; r < copies; r++) {
+				float sx = reflections[r][0], sy = reflections[r][1];
+				for (int j = 0; j < 4; j++) {
+					for (int k = 0; k < 4; k++) {
+						int column = sx * sy < 0 ? k : 3 - k;
+						const float *c = TeapotPatches::controlPoints[TeapotPatches::patches[p][j * 4 + column]];
+						points.push_back(vec3(sx * c[0] * scale, c[2] * scale + lift, -sy * c[1] * scale));
+					}
+				}
+			}
+		}
+		return points;
+	}
+
+	BezierSurface teapotSurface(teapotPatchPoints());
+
+
+	namespace TeapotPatches {
+		//Newell's control points, z up (as distributed with GLUT)
+		float controlPoints[][3]={
+			1.4f,0.0f,2.4f,
+			1.4f,-0.784f,2.4f,
+			0.784f,-1.4f,2.4f,
+			0.0f,-1.4f,2.4f,
+			1.3375f,0.0f,2.53125f,
+			1.3375f,-0.749f,2.53125f,
+			0.749f,-1.3375f,2.53125f,
+			0.0f,-1.3375f,2.53125f,
+			1.4375f,0.0f,2.53125f,
+			1.4375f,-0.805f,2.53125f,
+			0.805f,-1.4375f,2.53125f,
+			0.0f,-1.4375f,2.53125f,
+			1.5f,0.0f,2.4f,
+			1.5f,-0.84f,2.4f,
+			0.84f,-1.5f,2.4f,
+			0.0f,-1.5f,2.4f,
+			1.75f,0.0f,1.875f,
+			1.75f,-0.98f,1.875f,
+			0.98f,-1.75f,1.875f,
+			0.0f,-1.75f,1.875f,
+			2.0f,0.0f,1.35f,
+			2.0f,-1.12f,1.35f,
+			1.12f,-2.0f,1.35f,
+			0.0f,-2.0f,1.35f,
+			2.0f,0.0f,0.9f,
+			2.0f,-1.12f,0.9f,
+			1.12f,-2.0f,0.9f,
+			0.0f,-2.0f,0.9f,
+			2.0f,0.0f,0.45f,
+			2.0f,-1.12f,0.45f,
+			1.12f,-2.0f,0.45f,
+			0.0f,-2.0f,0.45f,
+			1.5f,0.0f,0.225f,
+			1.5f,-0.84f,0.225f,
+			0.84f,-1.5f,0.225f,
+			0.0f,-1.5f,0.225f,
+			1.5f,0.0f,0.15f,
+			1.5f,-0.84f,0.15f,
+			0.84f,-1.5f,0.15f,
+			0.0f,-1.5f,0.15f,
+			0.0f,0.0f,3.15f,
+			0.0f,-0.002f,3.15f,
+			0.002f,0.0f,3.15f,
+			0.8f,0.0f,3.15f,
+			0.8f,-0.45f,3.15f,
+			0.45f,-0.8f,3.15f,
+			0.0f,-0.8f,3.15f,
+			0.0f,0.0f,2.85f,
+			0.2f,0.0f,2.7f,
+			0.2f,-0.112f,2.7f,
+			0.112f,-0.2f,2.7f,
+			0.0f,-0.2f,2.7f,
+			0.4f,0.0f,2.55f,
+			0.4f,-0.224f,2.55f,
+			0.224f,-0.4f,2.55f,
+			0.0f,-0.4f,2.55f,
+			1.3f,0.0f,2.55f,
+			1.3f,-0.728f,2.55f,
+			0.728f,-1.3f,2.55f,
+			0.0f,-1.3f,2.55f,
+			1.3f,0.0f,2.4f,
+			1.3f,-0.728f,2.4f,
+			0.728f,-1.3f,2.4f,
+			0.0f,-1.3f,2.4f,
+			0.0f,0.0f,0.0f,
+			0.0f,-1.425f,0.0f,
+			0.798f,-1.425f,0.0f,
+			1.425f,-0.798f,0.0f,
+			1.425f,0.0f,0.0f,
+			0.0f,-1.5f,0.075f,
+			0.84f,-1.5f,0.075f,
+			1.5f,-0.84f,0.075f,
+			1.5f,0.0f,0.075f,
+			-1.6f,0.0f,2.025f,
+			-1.6f,-0.3f,2.025f,
+			-1.5f,-0.3f,2.25f,
+			-1.5f,0.0f,2.25f,
+			-2.3f,0.0f,2.025f,
+			-2.3f,-0.3f,2.025f,
+			-2.5f,-0.3f,2.25f,
+			-2.5f,0.0f,2.25f,
+			-2.7f,0.0f,2.025f,
+			-2.7f,-0.3f,2.025f,
+			-3.0f,-0.3f,2.25f,
+			-3.0f,0.0f,2.25f,
+			-2.7f,0.0f,1.8f,
+			-2.7f,-0.3f,1.8f,
+			-3.0f,-0.3f,1.8f,
+			-3.0f,0.0f,1.8f,
+			-2.7f,0.0f,1.575f,
+			-2.7f,-0.3f,1.575f,
+			-3.0f,-0.3f,1.35f,
+			-3.0f,0.0f,1.35f,
+			-2.5f,0.0f,1.125f,
+			-2.5f,-0.3f,1.125f,
+			-2.65f,-0.3f,0.9375f,
+			-2.65f,0.0f,0.9375f,
+			-2.0f,0.0f,0.9f,
+			-2.0f,-0.3f,0.9f,
+			-1.9f,-0.3f,0.6f,
+			-1.9f,0.0f,0.6f,
+			1.7f,0.0f,1.425f,
+			1.7f,-0.66f,1.425f,
+			1.7f,-0.66f,0.6f,
+			1.7f,0.0f,0.6f,
+			2.6f,0.0f,1.425f,
+			2.6f,-0.66f,1.425f,
+			3.1f,-0.66f,0.825f,
+			3.1f,0.0f,0.825f,
+			2.3f,0.0f,2.1f,
+			2.3f,-0.25f,2.1f,
+			2.4f,-0.25f,2.025f,
+			2.4f,0.0f,2.025f,
+			2.7f,0.0f,2.4f,
+			2.7f,-0.25f,2.4f,
+			3.3f,-0.25f,2.4f,
+			3.3f,0.0f,2.4f,
+			2.8f,0.0f,2.475f,
+			2.8f,-0.25f,2.475f,
+			3.525f,-0.25f,2.49375f,
+			3.525f,0.0f,2.49375f,
+			2.9f,0.0f,2.475f,
+			2.9f,-0.15f,2.475f,
+			3.45f,-0.15f,2.5125f,
+			3.45f,0.0f,2.5125f,
+			2.8f,0.0f,2.4f,
+			2.8f,-0.15f,2.4f,
+			3.2f,-0.15f,2.4f,
+			3.2f,0.0f,2.4f,
 		};
 
-		float colors[]={
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
-			0.7f,1.0f,0.4f,1.0f,
+		//Rim, body (2), lid (2), bottom, handle (2), spout (2)
+		int patches[][16]={
+			{0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15},
+			{12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27},
+			{24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39},
+			{40,41,42,40,43,44,45,46,47,47,47,47,48,49,50,51},
+			{48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63},
+			{64,64,64,64,65,66,67,68,69,70,71,72,39,38,37,36},
+			{73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88},
+			{85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100},
+			{101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116},
+			{113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,128},
 		};
+
+		unsigned int patchCount=10;
+		unsigned int controlPointCount=129;
 	}
-}
\ No newline at end of file
+}
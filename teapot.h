@@ -16,35 +16,34 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef TEAPOT_H
 #define TEAPOT_H
 
-//Utah teapot model made out of triangles
-//Contains arrays
-//vertices - vertex positions in homogenous coordinates
-//normals -vertex normals in homogenous coordinates (flat shading)
-//vertexNormals - vertex normals in homogenous coordinates (smooth shading)
-//texCoords -  texturing coordinates
-//colors - vertex colors (rgba)
-//TBN friendly
+//Utah teapot model, loaded from teapot.mesh (made by meshconv from teapot.obj)
+//Level 0 is the model itself, coarser levels go to teapotLod
 //Culling GL_CW
+//TeapotPatches holds the original bicubic patches, teapotSurface (bezier.h)
+//tessellates them at any resolution
 
-#include "model.h"
+#include "meshfile.h"
 
 namespace Models {
-		
-	
-	namespace TeapotInternal {
-		extern float vertices[];
-		extern float normals[];
-		extern float vertexNormals[];
-		extern float texCoords[];
-		extern float colors[];
-		extern unsigned int vertexCount;
-	} 
- 
-	class Teapot: public Model {
+
+	namespace TeapotPatches {
+		extern float controlPoints[][3];
+		extern int patches[][16];
+		extern unsigned int patchCount;
+		extern unsigned int controlPointCount;
+	}
+
+	class Teapot: public MeshAsset {
 		public:
-			Teapot();			
+			Teapot();
 			virtual ~Teapot();
-			virtual void drawSolid(bool smooth=true);			
+			bool load(const char* path); //Maps the file, the model stays empty if it fails
+			void upload(); //GL buffers for every level
+			void release();
+
+		private:
+			MeshFile file;
+			vector<MeshAsset*> coarser;
 	};
 
 	extern Teapot teapot;
@@ -0,0 +1,400 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+#include <sys/stat.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <algorithm>
+#include "texturecache.h"
+#include "lodepng.h"
+#include "jobs.h"
+
+//lodepng's hook for decoding PNGs with restart points on all cores
+static void parallelFor(void (*task)(void*, unsigned), void* data, unsigned count, const LodePNGDecompressSettings*) {
+	Jobs::parallelFor(0, (int)count, 1, [=](int begin, int end) {
+		for (int i = begin; i < end; i++) task(data, (unsigned)i);
+	});
+}
+
+//Modification time in nanoseconds. Seconds alone would miss a re-save of the same size
+//within the second of the previous one, and hot reload would get the old hash back.
+static long long modifiedTime(const struct stat& st) {
+#if defined(_WIN32)
+	return (long long)st.st_mtime * 1000000000LL; //Only seconds in struct stat
+#elif defined(__APPLE__)
+	return (long long)st.st_mtimespec.tv_sec * 1000000000LL + st.st_mtimespec.tv_nsec;
+#else
+	return (long long)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+}
+
+static const uint64_t prime1 = 11400714785074694791ULL;
+static const uint64_t prime2 = 14029467366897019727ULL;
+static const uint64_t prime3 = 1609587929392839161ULL;
+static const uint64_t prime4 = 9650029242287828579ULL;
+static const uint64_t prime5 = 2870177450012600261ULL;
+
+static uint64_t rotateLeft(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t read64(const unsigned char* p) {
+	uint64_t v;
+	memcpy(&v, p, 8);
+	return v;
+}
+
+static uint64_t hashRound(uint64_t acc, uint64_t input) {
+	return rotateLeft(acc + input * prime2, 31) * prime1;
+}
+
+static uint64_t hashMerge(uint64_t acc, uint64_t v) {
+	return (acc ^ hashRound(0, v)) * prime1 + prime4;
+}
+
+uint64_t hashBytes(const unsigned char* data, size_t size, uint64_t seed) {
+	const unsigned char* p = data;
+	const unsigned char* end = data + size;
+	uint64_t h;
+	if (size >= 32) {
+		//Four independent lanes over 32 byte stripes
+		uint64_t v1 = seed + prime1 + prime2, v2 = seed + prime2, v3 = seed, v4 = seed - prime1;
+		for (; p + 32 <= end; p += 32) {
+			v1 = hashRound(v1, read64(p));
+			v2 = hashRound(v2, read64(p + 8));
+			v3 = hashRound(v3, read64(p + 16));
+			v4 = hashRound(v4, read64(p + 24));
+		}
+		h = rotateLeft(v1, 1) + rotateLeft(v2, 7) + rotateLeft(v3, 12) + rotateLeft(v4, 18);
+		h = hashMerge(hashMerge(hashMerge(hashMerge(h, v1), v2), v3), v4);
+	} else h = seed + prime5;
+	h += size;
+	for (; p + 8 <= end; p += 8) h = rotateLeft(h ^ hashRound(0, read64(p)), 27) * prime1 + prime4;
+	if (p + 4 <= end) {
+		uint32_t v;
+		memcpy(&v, p, 4);
+		h = rotateLeft(h ^ (uint64_t)v * prime1, 23) * prime2 + prime3;
+		p += 4;
+	}
+	for (; p < end; p++) h = rotateLeft(h ^ *p * prime5, 11) * prime1;
+	h ^= h >> 33;
+	h *= prime2;
+	h ^= h >> 29;
+	h *= prime3;
+	h ^= h >> 32;
+	return h;
+}
+
+static uint64_t alignLevel(uint64_t offset) {
+	return (offset + 15) & ~(uint64_t)15;
+}
+
+//2x2 box filter, the last row or column is repeated for odd sizes
+static void downsample(const unsigned char* src, unsigned srcWidth, unsigned srcHeight, unsigned char* dst, unsigned width, unsigned height, int channels) {
+	for (unsigned y = 0; y < height; y++) {
+		const unsigned char* row0 = src + (size_t)std::min(2 * y, srcHeight - 1) * srcWidth * channels;
+		const unsigned char* row1 = src + (size_t)std::min(2 * y + 1, srcHeight - 1) * srcWidth * channels;
+		for (unsigned x = 0; x < width; x++) {
+			unsigned x0 = std::min(2 * x, srcWidth - 1) * channels, x1 = std::min(2 * x + 1, srcWidth - 1) * channels;
+			for (int c = 0; c < channels; c++)
+				*dst++ = (unsigned char)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+		}
+	}
+}
+
+void buildTextureFile(const unsigned char* pixels, unsigned width, unsigned height, uint32_t format, bool mipmaps, uint64_t sourceHash, uint64_t sourceSize, std::vector<unsigned char>& out) {
+	const int channels = TextureImage::bytesPerPixel(format);
+	TextureFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, textureFileMagic, 4);
+	header.version = textureFileVersion;
+	header.sourceHash = sourceHash;
+	header.sourceSize = sourceSize;
+	header.width = width;
+	header.height = height;
+	header.format = format;
+
+	uint64_t offset = alignLevel(sizeof(header));
+	unsigned w = width, h = height;
+	for (;;) {
+		header.levels[header.levelCount++] = offset;
+		offset = alignLevel(offset + (uint64_t)w * h * channels);
+		if (!mipmaps || (w == 1 && h == 1) || header.levelCount == (uint32_t)textureMaxLevels) break;
+		w = std::max(w / 2, 1u);
+		h = std::max(h / 2, 1u);
+	}
+
+	out.assign((size_t)offset, 0);
+	memcpy(out.data(), &header, sizeof(header));
+	memcpy(out.data() + header.levels[0], pixels, (size_t)width * height * channels);
+	w = width;
+	h = height;
+	for (uint32_t level = 1; level < header.levelCount; level++) {
+		unsigned nw = std::max(w / 2, 1u), nh = std::max(h / 2, 1u);
+		downsample(out.data() + header.levels[level - 1], w, h, out.data() + header.levels[level], nw, nh, channels);
+		w = nw;
+		h = nh;
+	}
+}
+
+void TextureImage::release() {
+	mapping.close();
+	std::vector<unsigned char>().swap(memory);
+}
+
+TextureCache::TextureCache(const char* directory, uint64_t maxBytes, bool mipmaps) :
+	directory(directory), maxBytes(maxBytes), mipmaps(mipmaps),
+	opened(false), totalBytes(0), useCounter(0), dirty(false),
+	hits(0), misses(0), hitMicroseconds(0), missMicroseconds(0), bytesMapped(0) {
+}
+
+std::string TextureCache::entryPath(uint64_t hash) const {
+	char name[32];
+	snprintf(name, sizeof(name), "/%016llx.tex", (unsigned long long)hash);
+	return directory + name;
+}
+
+//Creates the directory and reads the index, called with the mutex held
+void TextureCache::open() {
+	opened = true;
+#ifdef _WIN32
+	_mkdir(directory.c_str());
+#else
+	mkdir(directory.c_str(), 0755);
+#endif
+	FILE* f = fopen((directory + "/index.txt").c_str(), "r");
+	if (f == NULL) return; //Empty cache
+	char line[4096];
+	while (fgets(line, sizeof(line), f)) {
+		unsigned long long hash, a, b;
+		long long modified;
+		int used = 0;
+		if (sscanf(line, "entry %llx %llu %llu", &hash, &a, &b) == 3) {
+			struct stat st;
+			if (stat(entryPath(hash).c_str(), &st) != 0 || (unsigned long long)st.st_size != a) continue; //Removed or replaced behind our back
+			Entry& entry = entries[hash];
+			entry.bytes = a;
+			entry.lastUse = b;
+			totalBytes += a;
+			useCounter = std::max(useCounter, (uint64_t)b);
+		} else if (sscanf(line, "source %llx %llu %lld %n", &hash, &a, &modified, &used) == 3 && used > 0) {
+			std::string path(line + used);
+			while (!path.empty() && (path.back() == '\n' || path.back() == '\r')) path.pop_back();
+			Source& source = sources[path];
+			source.size = a;
+			source.modified = modified;
+			source.hash = hash;
+		}
+	}
+	fclose(f);
+}
+
+void TextureCache::save() {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!opened || !dirty) return;
+	std::string index = directory + "/index.txt";
+	std::string temporary = index + ".tmp";
+	FILE* f = fopen(temporary.c_str(), "w");
+	if (f == NULL) {
+		fprintf(stderr, "%s: cannot create\n", temporary.c_str());
+		return;
+	}
+	fprintf(f, "# entry hash bytes lastUse\n# source hash size modifiedNanoseconds path\n");
+	for (const auto& e : entries)
+		fprintf(f, "entry %016llx %llu %llu\n", (unsigned long long)e.first, (unsigned long long)e.second.bytes, (unsigned long long)e.second.lastUse);
+	for (const auto& s : sources)
+		fprintf(f, "source %016llx %llu %lld %s\n", (unsigned long long)s.second.hash, (unsigned long long)s.second.size, s.second.modified, s.first.c_str());
+	bool ok = ferror(f) == 0;
+	if (fclose(f) != 0) ok = false;
+	remove(index.c_str()); //rename does not replace files on Windows
+	if (!ok || rename(temporary.c_str(), index.c_str()) != 0) {
+		fprintf(stderr, "%s: write failed\n", index.c_str());
+		return;
+	}
+	dirty = false;
+}
+
+//Maps the entry if the index has it and it is intact
+bool TextureCache::mapEntry(uint64_t hash, TextureImage& image) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto e = entries.find(hash);
+		if (e == entries.end()) return false;
+		e->second.lastUse = ++useCounter;
+		dirty = true;
+	}
+	std::string path = entryPath(hash);
+	bool valid = image.mapping.open(path.c_str()) && image.mapping.size() >= sizeof(TextureFileHeader);
+	if (valid) {
+		const TextureFileHeader& header = image.header();
+		valid = memcmp(header.magic, textureFileMagic, 4) == 0 && header.version == textureFileVersion &&
+			header.sourceHash == hash && (header.format == textureFormatRGBA8 || header.format == textureFormatRGB8) &&
+			header.levelCount >= 1 && header.levelCount <= (uint32_t)textureMaxLevels;
+		for (uint32_t level = 0; valid && level < header.levelCount; level++)
+			valid = header.levels[level] + (uint64_t)image.width(level) * image.height(level) * image.bytesPerPixel() <= image.mapping.size();
+	}
+	if (valid) return true;
+	fprintf(stderr, "%s: damaged cache entry, decoding again\n", path.c_str());
+	image.release();
+	std::lock_guard<std::mutex> lock(mutex);
+	auto e = entries.find(hash);
+	if (e != entries.end()) {
+		totalBytes -= e->second.bytes;
+		entries.erase(e);
+	}
+	return false;
+}
+
+//Records a written entry, called with the mutex held
+void TextureCache::addEntry(uint64_t hash, uint64_t bytes) {
+	Entry& entry = entries[hash];
+	totalBytes -= entry.bytes; //0 unless another thread wrote the same entry
+	entry.bytes = bytes;
+	entry.lastUse = ++useCounter;
+	totalBytes += bytes;
+	dirty = true;
+}
+
+//Removes least recently used entries until the cache fits, called with the mutex held.
+//Mapped entries stay readable on POSIX; on Windows their removal fails and the file is
+//left to be overwritten later.
+void TextureCache::evict(uint64_t keep) {
+	while (totalBytes > maxBytes) {
+		auto oldest = entries.end();
+		for (auto e = entries.begin(); e != entries.end(); ++e)
+			if (e->first != keep && (oldest == entries.end() || e->second.lastUse < oldest->second.lastUse)) oldest = e;
+		if (oldest == entries.end()) return;
+		remove(entryPath(oldest->first).c_str());
+		totalBytes -= oldest->second.bytes;
+		entries.erase(oldest);
+		dirty = true;
+	}
+}
+
+bool TextureCache::load(const char* path, TextureImage& image) {
+	auto start = std::chrono::steady_clock::now();
+	image.release();
+	struct stat st;
+	if (stat(path, &st) != 0) {
+		fprintf(stderr, "Can't read %s: file not found\n", path);
+		return false;
+	}
+
+	//Options change the entry, so they are part of the key
+	uint64_t seed = textureFileVersion * prime3 + (mipmaps ? prime4 : 0);
+	uint64_t hash = 0;
+	bool known = false;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!opened) open();
+		auto s = sources.find(path);
+		if (s != sources.end() && s->second.size == (uint64_t)st.st_size && s->second.modified == modifiedTime(st)) {
+			hash = s->second.hash;
+			known = true;
+		}
+	}
+
+	std::vector<unsigned char> png;
+	unsigned error = 0;
+	if (!known) {
+		error = lodepng::load_file(png, path);
+		if (error) {
+			fprintf(stderr, "Can't read %s: %s\n", path, lodepng_error_text(error));
+			return false;
+		}
+		hash = hashBytes(png.data(), png.size(), seed);
+		std::lock_guard<std::mutex> lock(mutex);
+		Source& source = sources[path];
+		source.size = (uint64_t)st.st_size;
+		source.modified = modifiedTime(st);
+		source.hash = hash;
+		dirty = true;
+	}
+
+	if (mapEntry(hash, image)) {
+		hits++;
+		bytesMapped += (long long)image.mapping.size();
+		hitMicroseconds += (long long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		return true;
+	}
+
+	//Miss: decode, write the entry under a temporary name and move it in place.
+	//The PNG is decoded in its own color type and converted once, straight to the
+	//format the entry keeps: RGB8 unless the PNG can have alpha.
+	if (png.empty()) error = lodepng::load_file(png, path);
+	std::vector<unsigned char> raw, pixels;
+	unsigned width = 0, height = 0;
+	uint32_t format = textureFormatRGBA8;
+	lodepng::State state;
+	state.decoder.zlibsettings.parallel_for = parallelFor;
+	state.decoder.color_convert = 0;
+	if (!error) error = lodepng::decode(raw, width, height, state, png);
+	if (!error) {
+		const LodePNGColorMode& color = state.info_png.color;
+		LodePNGColorMode target;
+		lodepng_color_mode_init(&target); //RGBA8
+		if (!lodepng_can_have_alpha(&color)) {
+			target.colortype = LCT_RGB;
+			format = textureFormatRGB8;
+		}
+		if (color.colortype == target.colortype && color.bitdepth == 8) raw.swap(pixels); //Already in the entry format
+		else {
+			pixels.resize(lodepng_get_raw_size(width, height, &target));
+			error = lodepng_convert(pixels.data(), raw.data(), &target, &color, width, height);
+		}
+	}
+	if (error) {
+		fprintf(stderr, "Can't read %s: %s\n", path, lodepng_error_text(error));
+		return false;
+	}
+	std::vector<unsigned char>().swap(raw);
+	buildTextureFile(pixels.data(), width, height, format, mipmaps, hash, png.size(), image.memory);
+	std::vector<unsigned char>().swap(pixels);
+
+	std::string entry = entryPath(hash);
+	char suffix[32];
+	static std::atomic<unsigned> temporaries(0);
+	snprintf(suffix, sizeof(suffix), ".%u.tmp", temporaries++);
+	std::string temporary = entry + suffix;
+	FILE* f = fopen(temporary.c_str(), "wb");
+	bool written = f != NULL && fwrite(image.memory.data(), 1, image.memory.size(), f) == image.memory.size();
+	if (f != NULL && fclose(f) != 0) written = false;
+	if (written && rename(temporary.c_str(), entry.c_str()) != 0) {
+		struct stat existing; //On Windows rename does not replace, another thread may have written the same entry
+		written = stat(entry.c_str(), &existing) == 0 && (uint64_t)existing.st_size == image.memory.size();
+	}
+	remove(temporary.c_str());
+	if (written) {
+		std::lock_guard<std::mutex> lock(mutex);
+		addEntry(hash, image.memory.size());
+		evict(hash);
+	} else fprintf(stderr, "%s: cannot write the cache entry\n", entry.c_str());
+
+	misses++;
+	missMicroseconds += (long long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	return true;
+}
+
+void TextureCache::printStats() {
+	std::lock_guard<std::mutex> lock(mutex);
+	printf("Texture cache %s: %d hits in %.1f ms (%.1f MB mapped), %d misses decoded in %.1f ms, %d entries, %.1f of %.1f MB\n",
+		directory.c_str(), hits.load(), hitMicroseconds.load() / 1000.0, bytesMapped.load() / 1048576.0,
+		misses.load(), missMicroseconds.load() / 1000.0, (int)entries.size(), totalBytes / 1048576.0, maxBytes / 1048576.0);
+}
@@ -0,0 +1,136 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef TEXTURECACHE_H
+#define TEXTURECACHE_H
+
+//Content addressed cache of decoded textures on disk.
+//A PNG is keyed by a 64 bit hash of its bytes; the entry <directory>/<hash>.tex
+//holds the pixels with their mip chain, laid out so the loader maps the
+//file and hands the levels to glTexImage2D without copying or decoding.
+//PNGs without alpha are kept as RGB8, the others as RGBA8, so opaque textures
+//take three quarters of the disk, ring and upload bytes.
+//Which path had which hash is remembered by size and modification time (nanoseconds), so a
+//warm start reads neither the PNGs nor anything besides the entries it maps.
+//The directory is bounded by maxBytes, least recently used entries are removed first.
+//
+//Entry layout, little endian:
+//TextureFileHeader
+//level 0 ... levelCount - 1 at the offsets in the header, each starting at a multiple of 16
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include "mappedfile.h"
+
+const char textureFileMagic[4] = { 'G', 'T', 'E', 'X' };
+const uint32_t textureFileVersion = 2;
+const uint32_t textureFormatRGBA8 = 0;
+const uint32_t textureFormatRGB8 = 1;
+const int textureMaxLevels = 16;
+
+struct TextureFileHeader {
+	char magic[4];
+	uint32_t version;
+	uint64_t sourceHash; //Key of the entry: hash of the PNG bytes and the cache options
+	uint64_t sourceSize;
+	uint32_t width; //Of level 0
+	uint32_t height;
+	uint32_t levelCount; //1 without mipmaps
+	uint32_t format; //textureFormatRGBA8 or textureFormatRGB8
+	uint64_t levels[textureMaxLevels]; //Offsets of the levels
+	uint64_t reserved;
+};
+
+//Decoded texture with its levels in the entry layout, either mapped from the cache
+//or, if the entry could not be written, held in memory
+class TextureImage {
+public:
+	bool empty() const { return base() == NULL; }
+	int levelCount() const { return empty() ? 0 : (int)header().levelCount; }
+	unsigned width(int level = 0) const { return levelSize(header().width, level); }
+	unsigned height(int level = 0) const { return levelSize(header().height, level); }
+	uint32_t format() const { return header().format; }
+	int bytesPerPixel() const { return bytesPerPixel(format()); }
+	const unsigned char* pixels(int level = 0) const { return base() + header().levels[level]; }
+	size_t levelOffset(int level) const { return (size_t)(header().levels[level] - header().levels[0]); } //From level 0
+	size_t dataSize() const { return empty() ? 0 : levelOffset(levelCount() - 1) + (size_t)width(levelCount() - 1) * height(levelCount() - 1) * bytesPerPixel(); } //All levels
+	static int bytesPerPixel(uint32_t format) { return format == textureFormatRGB8 ? 3 : 4; }
+	void release(); //Unmaps or frees the pixels
+
+private:
+	friend class TextureCache;
+	MappedFile mapping;
+	std::vector<unsigned char> memory;
+
+	const unsigned char* base() const { return mapping.isOpen() ? mapping.data() : (memory.empty() ? NULL : memory.data()); }
+	const TextureFileHeader& header() const { return *(const TextureFileHeader*)base(); }
+	static unsigned levelSize(unsigned size, int level) { size >>= level; return size ? size : 1; }
+};
+
+class TextureCache {
+public:
+	TextureCache(const char* directory, uint64_t maxBytes, bool mipmaps);
+
+	//Decodes path or maps its cached entry. Thread safe. Prints the reason and
+	//returns false if the PNG cannot be read, image is then empty.
+	bool load(const char* path, TextureImage& image);
+	void save(); //Writes the index, entries themselves are complete once load() returns
+	void printStats();
+
+private:
+	struct Entry {
+		uint64_t bytes;
+		uint64_t lastUse; //Value of useCounter, higher is more recent
+	};
+	struct Source {
+		uint64_t size;
+		long long modified; //Nanoseconds
+		uint64_t hash;
+	};
+
+	std::string directory;
+	uint64_t maxBytes;
+	bool mipmaps;
+
+	std::mutex mutex; //Guards everything below
+	bool opened; //Directory created and index read
+	std::map<uint64_t, Entry> entries;
+	std::map<std::string, Source> sources; //PNG path -> hash, valid while size and time match
+	uint64_t totalBytes;
+	uint64_t useCounter;
+	bool dirty;
+
+	std::atomic<int> hits, misses;
+	std::atomic<long long> hitMicroseconds, missMicroseconds, bytesMapped;
+
+	void open();
+	std::string entryPath(uint64_t hash) const;
+	bool mapEntry(uint64_t hash, TextureImage& image);
+	void addEntry(uint64_t hash, uint64_t bytes);
+	void evict(uint64_t keep);
+};
+
+//xxHash64 style hash of the bytes
+uint64_t hashBytes(const unsigned char* data, size_t size, uint64_t seed = 0);
+
+//Entry layout of an RGBA8 or RGB8 image: header, level 0 and, with mipmaps, the box filtered levels down to 1x1
+void buildTextureFile(const unsigned char* pixels, unsigned width, unsigned height, uint32_t format, bool mipmaps, uint64_t sourceHash, uint64_t sourceSize, std::vector<unsigned char>& out);
+
+#endif
@@ -14,6 +14,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "torus.h"
+#include <algorithm>
 
 
 namespace Models {
@@ -31,115 +32,54 @@ namespace Models {
 	Torus::~Torus() {		
 	}
 	
-	inline float Torus::d2r(float deg) {
-		return PI*deg/180.0f;
-	}
-
-	vec4 Torus::generateTorusPoint(float R,float r,float alpha,float beta) {
-		alpha=d2r(alpha);
-		beta=d2r(beta);
-		return vec4((R+r*cos(alpha))*cos(beta),(R+r*cos(alpha))*sin(beta),r*sin(alpha),1.0f);
-	}
-
-	vec4 Torus::computeVertexNormal(float alpha,float beta) {
-		alpha=d2r(alpha);
-		beta=d2r(beta);
-		return vec4(cos(alpha)*cos(beta),cos(alpha)*sin(beta),sin(alpha),0.0f);
-	}
-
-	vec4 Torus::computeFaceNormal(vector<vec4> &face) {
-		vec3 a=vec3(face[1]-face[0]);
-		vec3 b=vec3(face[2]-face[0]);
-		
-		return normalize(vec4(cross(b,a),0.0f));
-	}
-
-	void Torus::generateTorusFace(vector<vec4> &vertices, vector<vec4> &vertexNormals, vec4 &faceNormal,float R,float r,float alpha,float beta,float step_alpha,float step_beta) {
-		vertices.clear();
-		vertexNormals.clear();	
-		
-		vertices.push_back(generateTorusPoint(R,r,alpha,beta));
-		vertices.push_back(generateTorusPoint(R,r,alpha+step_alpha,beta));
-		vertices.push_back(generateTorusPoint(R,r,alpha+step_alpha,beta+step_beta));
-		vertices.push_back(generateTorusPoint(R,r,alpha,beta+step_beta));
-		
-		faceNormal=computeFaceNormal(vertices);
-		
-		vertexNormals.push_back(computeVertexNormal(alpha,beta));
-		vertexNormals.push_back(computeVertexNormal(alpha+step_alpha,beta));
-		vertexNormals.push_back(computeVertexNormal(alpha+step_alpha,beta+step_beta));
-		vertexNormals.push_back(computeVertexNormal(alpha,beta+step_beta));
-	}
-
-
-
+	//Grid of tubeDivs by mainDivs vertices, wrapping around in both directions.
+	//Angles come from tables; rings are filled in parallel into preallocated arrays.
 	void Torus::buildTorus(float R,float r,float mainDivs,float tubeDivs) {
-		vector<vec4> face;
-		vector<vec4> faceVertexNormals;
-		vec4 normal;
-
-		internalVertices.clear();
-		internalFaceNormals.clear();
-		internalVertexNormals.clear();
-			
-		float mult_alpha=360.0f/tubeDivs;
-		float mult_beta=360.0f/mainDivs;
-		
-		for (int alpha=0;alpha<round(tubeDivs);alpha++) {			
-			for (int beta=0;beta<round(mainDivs);beta++) {
-				
-				generateTorusFace(face,faceVertexNormals,normal,R,r,alpha*mult_alpha,beta*mult_beta,mult_alpha, mult_beta);			
-				
-				internalVertices.push_back(face[0]);
-				internalVertices.push_back(face[1]);
-				internalVertices.push_back(face[2]);
-				
-				internalVertices.push_back(face[0]);
-				internalVertices.push_back(face[2]);
-				internalVertices.push_back(face[3]);
-				
-				internalVertexNormals.push_back(faceVertexNormals[0]);
-				internalVertexNormals.push_back(faceVertexNormals[1]);
-				internalVertexNormals.push_back(faceVertexNormals[2]);
-				
-				internalVertexNormals.push_back(faceVertexNormals[0]);
-				internalVertexNormals.push_back(faceVertexNormals[2]);
-				internalVertexNormals.push_back(faceVertexNormals[3]);
-							
-				for (int i=0;i<6;i++) internalFaceNormals.push_back(normal);
-				
-				
+		int rings=std::max((int)round(tubeDivs),3);
+		int sectors=std::max((int)round(mainDivs),3);
+
+		vector<float> ringSin,ringCos,sectorSin,sectorCos;
+		sinCosTable(0,2*PI/rings,rings,ringSin,ringCos);
+		sinCosTable(0,2*PI/sectors,sectors,sectorSin,sectorCos);
+
+		internalVertices.resize((size_t)rings*sectors);
+		internalVertexNormals.resize(internalVertices.size());
+		internalTexCoords.clear();
+		internalIndices.resize(6*(size_t)rings*sectors);
+
+		parallelRanges(rings,64,[&](int begin,int end) {
+			for (int alpha=begin;alpha<end;alpha++) {
+				vec4 *v=&internalVertices[(size_t)alpha*sectors];
+				vec4 *n=&internalVertexNormals[(size_t)alpha*sectors];
+				float radius=R+r*ringCos[alpha];
+				for (int beta=0;beta<sectors;beta++) {
+					v[beta]=vec4(radius*sectorCos[beta],radius*sectorSin[beta],r*ringSin[alpha],1.0f);
+					n[beta]=vec4(ringCos[alpha]*sectorCos[beta],ringCos[alpha]*sectorSin[beta],ringSin[alpha],0.0f);
+				}
+
+				int nextAlpha=(alpha+1)%rings;
+				unsigned int *index=&internalIndices[6*(size_t)alpha*sectors];
+				for (int beta=0;beta<sectors;beta++) {
+					int nextBeta=(beta+1)%sectors;
+					unsigned int face[4]={
+						(unsigned int)(alpha*sectors+beta),
+						(unsigned int)(nextAlpha*sectors+beta),
+						(unsigned int)(nextAlpha*sectors+nextBeta),
+						(unsigned int)(alpha*sectors+nextBeta)
+					};
+
+					*index++=face[0];
+					*index++=face[1];
+					*index++=face[2];
+
+					*index++=face[0];
+					*index++=face[2];
+					*index++=face[3];
+				}
 			}
-		}
-		
-		vertices=(float*)internalVertices.data();
-		normals=(float*)internalFaceNormals.data();
-		vertexNormals=(float*)internalVertexNormals.data();
-		texCoords=vertexNormals;
-		vertexCount=internalVertices.size();
-	}
-
-	void Torus::drawSolid(bool smooth) {
+		});
 
-		glEnableVertexAttribArray(0);
-        glEnableVertexAttribArray(1);
-        glEnableVertexAttribArray(2);
-        //glEnableVertexAttribArray(3);
-
-
-        glVertexAttribPointer(0,4,GL_FLOAT,false,0,vertices);
-        if (!smooth) glVertexAttribPointer(1,4,GL_FLOAT,false,0,normals);
-        else glVertexAttribPointer(1,4,GL_FLOAT,false,0,vertexNormals);
-        glVertexAttribPointer(2,4,GL_FLOAT,false,0,texCoords);
-        //glVertexAttribPointer(3,4,GL_FLOAT,false,0,Models::CubeInternal::colors);
-
-        glDrawArrays(GL_TRIANGLES,0,vertexCount);
-
-        glDisableVertexAttribArray(0);
-        glDisableVertexAttribArray(1);
-        glDisableVertexAttribArray(2);
-        //glDisableVertexAttribArray(3);
+		finalize();
 	}
 
-
 }
@@ -16,14 +16,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef TORUS_H
 #define TORUS_H
 
-//Torus model made out of triangles
+//Torus model made out of indexed triangles, neighbouring faces share vertices
 //Contains arrays:
 //vertices - vertex positions in homogenous coordinates
-//normals - vertex normals in homogenous coordinates
+//vertexNormals - vertex normals in homogenous coordinates
 //texCoords - texturing coordinates
+//indices - triangle list (see mesh.h)
 
 
-#include "model.h"
+#include "mesh.h"
 
 
 namespace Models {
@@ -31,24 +32,14 @@ namespace Models {
 	using namespace std;
 	using namespace glm;
 	
-	class Torus: public Model {
+	class Torus: public Mesh {
 	
 		public:
 			Torus();
 			Torus(float R,float r,float mainDivs,float tubeDivs);
 			virtual ~Torus();
-			virtual void drawSolid(bool smooth=true);
-			
+
 		private:
-			vector<vec4> internalVertices;
-			vector<vec4> internalFaceNormals;
-			vector<vec4> internalVertexNormals;
-
-			inline float d2r(float deg);
-			vec4 generateTorusPoint(float R,float r,float alpha,float beta);
-			vec4 computeVertexNormal(float alpha,float beta);
-			vec4 computeFaceNormal(vector<vec4> &face);
-			void generateTorusFace(vector<vec4> &vertices, vector<vec4> &vertexNormals, vec4 &faceNormal,float R,float r,float alpha,float beta,float step_alpha,float step_beta);
 			void buildTorus(float R,float r,float mainDivs,float tubeDivs);
 			
 	};
@@ -0,0 +1,147 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "transforms.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TRANSFORMS_AVX2
+#define TRANSFORMS_SSE
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRANSFORMS_SSE
+#endif
+
+int TransformBatch::add(int parentIndex, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale) {
+	tx.push_back(translation.x); ty.push_back(translation.y); tz.push_back(translation.z);
+	qx.push_back(rotation.x); qy.push_back(rotation.y); qz.push_back(rotation.z); qw.push_back(rotation.w);
+	sx.push_back(scale.x); sy.push_back(scale.y); sz.push_back(scale.z);
+	parent.push_back(parentIndex);
+	return size() - 1;
+}
+
+int TransformBatch::add(int parentIndex, const glm::vec3& translation, const glm::vec3& scale) {
+	return add(parentIndex, translation, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), scale);
+}
+
+void TransformBatch::clear() {
+	tx.clear(); ty.clear(); tz.clear();
+	qx.clear(); qy.clear(); qz.clear(); qw.clear();
+	sx.clear(); sy.clear(); sz.clear();
+	parent.clear();
+}
+
+//Lanes of the local matrix stage
+#if defined(TRANSFORMS_AVX2)
+typedef __m256 Lanes;
+static const int laneCount = 8;
+static inline Lanes lanesLoad(const float* p) { return _mm256_loadu_ps(p); }
+static inline void lanesStore(float* p, Lanes a) { _mm256_store_ps(p, a); }
+static inline Lanes lanesSet1(float a) { return _mm256_set1_ps(a); }
+static inline Lanes lanesAdd(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+static inline Lanes lanesSub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+static inline Lanes lanesMul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+#elif defined(TRANSFORMS_SSE)
+typedef __m128 Lanes;
+static const int laneCount = 4;
+static inline Lanes lanesLoad(const float* p) { return _mm_loadu_ps(p); }
+static inline void lanesStore(float* p, Lanes a) { _mm_store_ps(p, a); }
+static inline Lanes lanesSet1(float a) { return _mm_set1_ps(a); }
+static inline Lanes lanesAdd(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+static inline Lanes lanesSub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+static inline Lanes lanesMul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+#else
+static const int laneCount = 1;
+#endif
+
+//M = P * L for the local matrix in column k of local (upper 3x4, one row per element), same sums as glm
+static void multiply(const glm::mat4* parents, int p, const float (*local)[laneCount], int k, glm::mat4& out) {
+	float* M = &out[0][0];
+	if (p < 0) {
+		for (int c = 0; c < 4; c++)
+			for (int r = 0; r < 3; r++) M[4 * c + r] = local[3 * c + r][k];
+		M[3] = M[7] = M[11] = 0.0f;
+		M[15] = 1.0f;
+		return;
+	}
+	const float* P = &parents[p][0][0];
+#ifdef TRANSFORMS_SSE
+	__m128 p0 = _mm_loadu_ps(P), p1 = _mm_loadu_ps(P + 4), p2 = _mm_loadu_ps(P + 8), p3 = _mm_loadu_ps(P + 12);
+	for (int c = 0; c < 4; c++) {
+		__m128 column = _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(p0, _mm_set1_ps(local[3 * c][k])),
+			_mm_mul_ps(p1, _mm_set1_ps(local[3 * c + 1][k]))),
+			_mm_mul_ps(p2, _mm_set1_ps(local[3 * c + 2][k])));
+		if (c == 3) column = _mm_add_ps(column, p3);
+		_mm_storeu_ps(M + 4 * c, column);
+	}
+#else
+	for (int c = 0; c < 4; c++)
+		for (int r = 0; r < 4; r++) {
+			float sum = P[r] * local[3 * c][k] + P[4 + r] * local[3 * c + 1][k] + P[8 + r] * local[3 * c + 2][k];
+			M[4 * c + r] = c == 3 ? sum + P[12 + r] : sum;
+		}
+#endif
+}
+
+void TransformBatch::compose(const glm::mat4* parents, glm::mat4* out, int begin, int end) const {
+	alignas(32) float local[12][laneCount];
+	int i = begin;
+#ifdef TRANSFORMS_SSE
+	const Lanes one = lanesSet1(1.0f), two = lanesSet1(2.0f);
+	for (; i + laneCount <= end; i += laneCount) {
+		Lanes x = lanesLoad(&qx[i]), y = lanesLoad(&qy[i]), z = lanesLoad(&qz[i]), w = lanesLoad(&qw[i]);
+		Lanes x2 = lanesMul(x, two), y2 = lanesMul(y, two), z2 = lanesMul(z, two);
+		Lanes xx = lanesMul(x, x2), yy = lanesMul(y, y2), zz = lanesMul(z, z2);
+		Lanes xy = lanesMul(x, y2), xz = lanesMul(x, z2), yz = lanesMul(y, z2);
+		Lanes wx = lanesMul(w, x2), wy = lanesMul(w, y2), wz = lanesMul(w, z2);
+		Lanes scaleX = lanesLoad(&sx[i]), scaleY = lanesLoad(&sy[i]), scaleZ = lanesLoad(&sz[i]);
+		lanesStore(local[0], lanesMul(lanesSub(one, lanesAdd(yy, zz)), scaleX));
+		lanesStore(local[1], lanesMul(lanesAdd(xy, wz), scaleX));
+		lanesStore(local[2], lanesMul(lanesSub(xz, wy), scaleX));
+		lanesStore(local[3], lanesMul(lanesSub(xy, wz), scaleY));
+		lanesStore(local[4], lanesMul(lanesSub(one, lanesAdd(xx, zz)), scaleY));
+		lanesStore(local[5], lanesMul(lanesAdd(yz, wx), scaleY));
+		lanesStore(local[6], lanesMul(lanesAdd(xz, wy), scaleZ));
+		lanesStore(local[7], lanesMul(lanesSub(yz, wx), scaleZ));
+		lanesStore(local[8], lanesMul(lanesSub(one, lanesAdd(xx, yy)), scaleZ));
+		lanesStore(local[9], lanesLoad(&tx[i]));
+		lanesStore(local[10], lanesLoad(&ty[i]));
+		lanesStore(local[11], lanesLoad(&tz[i]));
+		for (int k = 0; k < laneCount; k++) multiply(parents, parent[i + k], local, k, out[i + k]);
+	}
+#endif
+	//The rest one at a time, same arithmetic in lane 0
+	for (; i < end; i++) {
+		float x = qx[i], y = qy[i], z = qz[i], w = qw[i];
+		float x2 = x * 2.0f, y2 = y * 2.0f, z2 = z * 2.0f;
+		float xx = x * x2, yy = y * y2, zz = z * z2;
+		float xy = x * y2, xz = x * z2, yz = y * z2;
+		float wx = w * x2, wy = w * y2, wz = w * z2;
+		local[0][0] = (1.0f - (yy + zz)) * sx[i];
+		local[1][0] = (xy + wz) * sx[i];
+		local[2][0] = (xz - wy) * sx[i];
+		local[3][0] = (xy - wz) * sy[i];
+		local[4][0] = (1.0f - (xx + zz)) * sy[i];
+		local[5][0] = (yz + wx) * sy[i];
+		local[6][0] = (xz + wy) * sz[i];
+		local[7][0] = (yz - wx) * sz[i];
+		local[8][0] = (1.0f - (xx + yy)) * sz[i];
+		local[9][0] = tx[i];
+		local[10][0] = ty[i];
+		local[11][0] = tz[i];
+		multiply(parents, parent[i], local, 0, out[i]);
+	}
+}
@@ -0,0 +1,49 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef TRANSFORMS_H
+#define TRANSFORMS_H
+
+//Batches of translate-rotate-scale transforms in structure-of-arrays form.
+//compose() builds parent * T * R * S for every node: the local matrices of
+//eight (AVX2) or four (SSE2) nodes at a time from the component arrays, then
+//the parent products column by column on SSE registers, the way glm's SIMD
+//mat4 multiply does it. Results match glm::scale(glm::translate(parent, t) * mat4_cast(r), s).
+
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+class TransformBatch {
+public:
+	//Returns the node index, parent indexes the matrices passed to compose(), -1 is the identity
+	int add(int parent, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale);
+	int add(int parent, const glm::vec3& translation, const glm::vec3& scale); //No rotation
+	void clear();
+	int size() const { return (int)parent.size(); }
+
+	//out[i] = parents[parent[i]] * T * R * S for nodes [begin, end), ranges can be composed on different threads
+	void compose(const glm::mat4* parents, glm::mat4* out, int begin, int end) const;
+	void compose(const glm::mat4* parents, glm::mat4* out) const { compose(parents, out, 0, size()); }
+
+private:
+	std::vector<float> tx, ty, tz; //Translation
+	std::vector<float> qx, qy, qz, qw; //Rotation, unit quaternion
+	std::vector<float> sx, sy, sz; //Scale
+	std::vector<int> parent;
+};
+
+#endif
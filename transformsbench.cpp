@@ -0,0 +1,95 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+//Benchmark of TransformBatch::compose against composing each node with glm.
+//Usage: transformsbench [nodes] [parents]
+//Nodes get random translations, rotations and scales under random parents. Prints the best
+//of several runs of both and the largest difference between their matrix elements; exits
+//with 1 if that is above maxDifference.
+
+#define GLM_FORCE_RADIANS
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <glm/gtc/matrix_transform.hpp>
+#include "transforms.h"
+
+static const int runs = 20;
+static const float maxDifference = 1e-5f;
+
+static float randomFloat(float a, float b) {
+	return a + (b - a) * (rand() / (float)RAND_MAX);
+}
+
+static glm::vec3 randomVector(float a, float b) {
+	return glm::vec3(randomFloat(a, b), randomFloat(a, b), randomFloat(a, b));
+}
+
+static double milliseconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+	int nodeCount = argc > 1 ? std::max(1, atoi(argv[1])) : 100000;
+	int parentCount = argc > 2 ? std::max(1, atoi(argv[2])) : 64;
+	srand(1);
+
+	std::vector<glm::mat4> parents(parentCount);
+	for (glm::mat4 &p : parents)
+		p = glm::rotate(glm::translate(glm::mat4(1.0f), randomVector(-10, 10)), randomFloat(-3, 3), glm::normalize(randomVector(-1, 1) + 0.01f));
+
+	TransformBatch batch;
+	std::vector<int> parent(nodeCount);
+	std::vector<glm::vec3> translation(nodeCount), scale(nodeCount);
+	std::vector<glm::quat> rotation(nodeCount);
+	for (int i = 0; i < nodeCount; i++) {
+		parent[i] = rand() % parentCount;
+		translation[i] = randomVector(-1, 1);
+		scale[i] = randomVector(0.5f, 2.5f);
+		rotation[i] = glm::normalize(glm::quat(randomFloat(-1, 1), randomFloat(-1, 1), randomFloat(-1, 1), randomFloat(-1, 1)));
+		batch.add(parent[i], translation[i], rotation[i], scale[i]);
+	}
+
+	std::vector<glm::mat4> perCall(nodeCount), batched(nodeCount);
+	double perCallTime = 1e30, batchedTime = 1e30;
+	for (int run = 0; run < runs; run++) {
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < nodeCount; i++)
+			perCall[i] = glm::scale(glm::translate(parents[parent[i]], translation[i]) * glm::mat4_cast(rotation[i]), scale[i]);
+		perCallTime = std::min(perCallTime, milliseconds(start));
+		start = std::chrono::steady_clock::now();
+		batch.compose(parents.data(), batched.data());
+		batchedTime = std::min(batchedTime, milliseconds(start));
+	}
+
+	float difference = 0;
+	for (int i = 0; i < nodeCount; i++)
+		for (int c = 0; c < 4; c++)
+			for (int r = 0; r < 4; r++) difference = std::max(difference, fabsf(perCall[i][c][r] - batched[i][c][r]));
+
+	printf("%d nodes, %d parents\n", nodeCount, parentCount);
+	printf("glm per call: %8.3f ms, %6.1f ns per node\n", perCallTime, perCallTime * 1e6 / nodeCount);
+	printf("compose:      %8.3f ms, %6.1f ns per node (%.2fx)\n", batchedTime, batchedTime * 1e6 / nodeCount, perCallTime / batchedTime);
+	printf("largest difference %g\n", difference);
+	if (difference > maxDifference) {
+		fprintf(stderr, "compose differs from glm by more than %g\n", maxDifference);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+//Lock-free single producer, single consumer triple buffer.
+//The producer fills writeBuffer() and publish()es it; the consumer
+//acquire()s the newest published buffer and reads readBuffer() until the
+//next acquire(). Neither side ever waits for the other: the third buffer
+//is the one in the middle, swapped atomically together with a "fresh" flag.
+//Buffers are reused, so containers inside T keep their capacity.
+
+#include <atomic>
+
+template <class T> class TripleBuffer {
+public:
+	TripleBuffer() : middle(1), back(0), front(2) {}
+
+	T& writeBuffer() { return buffers[back]; } //Producer only
+	void publish() { back = middle.exchange(back | freshBit, std::memory_order_acq_rel) & indexMask; }
+
+	bool acquire() { //Consumer only, false if nothing new was published
+		if (!(middle.load(std::memory_order_acquire) & freshBit)) return false;
+		front = middle.exchange(front, std::memory_order_acq_rel) & indexMask;
+		return true;
+	}
+	const T& readBuffer() const { return buffers[front]; }
+
+	bool consumed() const { return !(middle.load(std::memory_order_acquire) & freshBit); } //The last publish() was acquired
+
+private:
+	static const int freshBit = 4;
+	static const int indexMask = 3;
+
+	T buffers[3];
+	std::atomic<int> middle;
+	int back; //Owned by the producer
+	int front; //Owned by the consumer
+};
+
+#endif
@@ -0,0 +1,139 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "uploadring.h"
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+
+UploadRing::UploadRing() {
+	buffer = 0;
+	memory = NULL;
+	capacity = 0;
+	head = 0;
+	uploads = 0;
+	misses = 0;
+	waitMs = 0;
+}
+
+void UploadRing::setup(size_t bytes) {
+	release();
+	if (!(GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage)) {
+		printf("Upload ring: buffer storage not supported, textures upload from client memory\n");
+		return;
+	}
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+	glBufferStorage(GL_PIXEL_UNPACK_BUFFER, bytes, NULL, flags);
+	memory = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, flags);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	if (memory == NULL) {
+		printf("Upload ring: mapping failed, textures upload from client memory\n");
+		glDeleteBuffers(1, &buffer);
+		buffer = 0;
+		return;
+	}
+	capacity = bytes;
+	head = 0;
+}
+
+void UploadRing::release() {
+	if (buffer == 0) return;
+	std::lock_guard<std::mutex> lock(mutex);
+	for (Allocation& a : allocations)
+		if (a.fence) {
+			glClientWaitSync(a.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+			glDeleteSync(a.fence);
+		}
+	allocations.clear();
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+	glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	glDeleteBuffers(1, &buffer);
+	buffer = 0;
+	memory = NULL;
+	capacity = 0;
+}
+
+UploadRing::Span UploadRing::allocate(size_t bytes) {
+	Span span = { NULL, 0, bytes };
+	if (buffer == 0 || bytes == 0) return span;
+	size_t size = (bytes + alignment - 1) / alignment * alignment;
+	std::lock_guard<std::mutex> lock(mutex);
+	size_t begin;
+	if (allocations.empty()) {
+		head = 0; //Everything is free
+		begin = size <= capacity ? 0 : capacity;
+	} else {
+		//Live memory runs from the oldest allocation to head, possibly wrapping around the end
+		size_t tail = allocations.front().begin;
+		if (head > tail) {
+			if (head + size <= capacity) begin = head;
+			else if (size < tail) begin = 0; //The rest of the end stays unused until the ring wraps
+			else begin = capacity;
+		} else begin = head + size < tail ? head : capacity; //head == tail: full
+	}
+	if (begin == capacity) {
+		misses++;
+		return span;
+	}
+	allocations.push_back({ begin, begin + size, 0 });
+	head = begin + size;
+	uploads++;
+	span.data = memory + begin;
+	span.offset = begin;
+	return span;
+}
+
+UploadRing::Allocation* UploadRing::find(const Span& span) {
+	for (Allocation& a : allocations)
+		if (a.begin == span.offset && a.fence == 0) return &a;
+	return NULL;
+}
+
+void UploadRing::uploaded(const Span& span) {
+	if (span.data == NULL) return;
+	std::lock_guard<std::mutex> lock(mutex);
+	Allocation* a = find(span);
+	if (a) a->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void UploadRing::retire(bool block) {
+	std::lock_guard<std::mutex> lock(mutex);
+	while (!allocations.empty()) {
+		Allocation& a = allocations.front();
+		if (a.fence == 0) return; //Still being written, later spans wait for it
+		double start = block ? glfwGetTime() : 0;
+		GLenum result = glClientWaitSync(a.fence, GL_SYNC_FLUSH_COMMANDS_BIT, block ? 1000000000ull : 0);
+		if (block) waitMs += (glfwGetTime() - start) * 1000.0;
+		if (result == GL_TIMEOUT_EXPIRED) return;
+		glDeleteSync(a.fence);
+		allocations.pop_front();
+		block = false; //Only wait for the oldest span
+	}
+}
+
+bool UploadRing::idle() {
+	std::lock_guard<std::mutex> lock(mutex);
+	return allocations.empty();
+}
+
+void UploadRing::printStats() {
+	if (buffer == 0) return;
+	std::lock_guard<std::mutex> lock(mutex);
+	printf("Upload ring: %.1f MB, %d uploads, %d did not fit, %.1f ms waiting for fences\n",
+		capacity / 1048576.0, uploads, misses, waitMs);
+}
@@ -0,0 +1,78 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef UPLOADRING_H
+#define UPLOADRING_H
+
+//Ring of persistently mapped pixel unpack buffer memory for texture uploads.
+//Any thread may allocate() a span and write pixels into it while the GL thread
+//keeps drawing; the GL thread then sources glTexImage* from the span's offset
+//with the buffer bound to GL_PIXEL_UNPACK_BUFFER and calls uploaded(), which
+//fences the span. Spans are recycled in allocation order once their fences
+//are signalled, so writers never touch memory the GPU still reads. Every
+//allocated span has to be uploaded, later spans are not recycled before it.
+//Needs OpenGL 4.4 or ARB_buffer_storage, without it enabled() is false and
+//callers upload from client memory as before.
+
+#include <GL/glew.h>
+#include <stddef.h>
+#include <deque>
+#include <mutex>
+
+class UploadRing {
+public:
+	struct Span {
+		unsigned char* data; //NULL if the allocation failed
+		size_t offset; //In the buffer, pass (void*)offset to glTexImage*
+		size_t size;
+	};
+
+	UploadRing();
+
+	void setup(size_t bytes); //GL thread
+	void release(); //GL thread, waits for uploads in flight
+	bool enabled() const { return buffer != 0; }
+	GLuint handle() const { return buffer; }
+
+	//Any thread: reserves bytes without waiting, data is NULL if they are not free yet
+	Span allocate(size_t bytes);
+	void uploaded(const Span& span); //GL thread, after the glTexImage* calls reading the span
+	void retire(bool block); //GL thread: recycles finished spans, block waits for the oldest one
+	bool idle(); //No span is in use
+	void printStats();
+
+	static const size_t alignment = 64;
+
+private:
+	struct Allocation {
+		size_t begin, end;
+		GLsync fence; //0 until uploaded()
+	};
+
+	GLuint buffer;
+	unsigned char* memory; //Persistent coherent mapping of buffer
+	size_t capacity;
+
+	std::mutex mutex; //Guards everything below
+	std::deque<Allocation> allocations; //Live spans, oldest first
+	size_t head; //End of the newest allocation
+	int uploads, misses; //Spans handed out, allocations that did not fit
+	double waitMs;
+
+	Allocation* find(const Span& span);
+};
+
+#endif
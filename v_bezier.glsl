@@ -0,0 +1,8 @@
+#version 400
+
+//Attributes
+layout (location=0) in vec4 vertex; //patch control point in model space
+
+void main(void) {
+    gl_Position=vertex; //Transformed after evaluation in te_bezier.glsl
+}
@@ -0,0 +1,41 @@
+#version 330
+
+//Uniform variables
+uniform mat4 P;
+uniform mat4 V;
+
+uniform mat4 parts[6]; //Body part matrices in the frame of a visitor
+uniform vec4 partColors[6]; //alpha 1 - fixed color, 0 - use the color of the visitor
+uniform int firstPart;
+uniform int partCount; //Consecutive instances that belong to one visitor
+
+uniform vec4 lightDir=vec4(0,0,1,0);
+
+//Attributes
+layout (location=0) in vec4 vertex; //vertex coordinates in model space
+layout (location=1) in vec4 normal; //vertex normal vector in model space
+layout (location=4) in vec4 placement; //Per visitor: xyz - position, w - rotation around y
+layout (location=5) in vec4 visitorColor; //Per visitor
+
+
+//varying variables
+out vec4 i_color;
+
+void main(void) {
+    int part=firstPart+gl_InstanceID%partCount;
+
+    float s=sin(placement.w);
+    float c=cos(placement.w);
+    mat4 visitor=mat4(c,0,-s,0, 0,1,0,0, s,0,c,0, placement.xyz,1);
+    mat4 M=visitor*parts[part];
+
+    gl_Position=P*V*M*vertex;
+
+    mat4 G=mat4(inverse(transpose(mat3(M))));
+    vec4 n=normalize(V*G*normal);
+
+    float nl=clamp(dot(n,lightDir),0,1);
+
+    vec4 color=partColors[part].a>0.5 ? partColors[part] : visitorColor;
+    i_color=vec4(color.rgb*nl,1);
+}
@@ -0,0 +1,44 @@
+#version 430
+#extension GL_ARB_shader_draw_parameters : require
+
+//Uniform variables
+uniform mat4 P;
+uniform mat4 V;
+uniform int cullDebug=0; //1 - show only the objects rejected by the occlusion culling
+
+//Per-object data
+struct DrawData {
+    mat4 M;
+    ivec4 params; //x - texture array layer
+};
+
+layout (std430, binding=0) readonly buffer Draws {
+    DrawData draws[];
+};
+
+//Object drawn by each command of the indirect list (identity unless the list was compacted)
+layout (std430, binding=1) readonly buffer DrawIds {
+    uint drawIds[];
+};
+
+layout (std430, binding=2) readonly buffer Flags {
+    uint visibleFlags[];
+};
+
+//Attributes
+layout (location=0) in vec4 vertex; //vertex coordinates in model space
+layout (location=2) in vec2 texCoord; //texturing coordinates
+
+
+//varying variables
+out vec2 i_tc;
+flat out int i_layer;
+
+void main(void) {
+    uint id=drawIds[gl_DrawIDARB];
+    DrawData d=draws[id];
+    gl_Position=P*V*d.M*vertex;
+    if (cullDebug!=0 && visibleFlags[id]!=0u) gl_Position=vec4(0,0,0,1); //Collapse visible objects
+    i_tc=texCoord;
+    i_layer=d.params.x;
+}